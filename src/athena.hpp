@@ -34,6 +34,30 @@ using Real = double;
 
 #endif // SINGLE_PRECISION_ENABLED
 
+//----------------------------------------------------------------------------------------
+// type alias for the interface states used by reconstruction and the Riemann solvers.
+// With Athena_MIXED_PRECISION these are binary32 while the conserved state and the
+// flux-divergence accumulation remain binary64
+
+#if MIXED_PRECISION_ENABLED
+using FluxReal = float;
+#else
+using FluxReal = Real;
+#endif
+
+//----------------------------------------------------------------------------------------
+// storage type for diagnostic-only arrays (derived output variables, coarsened output
+// moments, output staging) that never feed back into the evolution.  With
+// Athena_SINGLE_PRECISION_DIAGNOSTICS these are stored binary32 while kernels still
+// compute in Real, reclaiming device memory; the binary output formats write binary32
+// regardless, so the files are unchanged
+
+#if DIAG_SINGLE_PRECISION_ENABLED
+using DiagReal = float;
+#else
+using DiagReal = Real;
+#endif
+
 //----------------------------------------------------------------------------------------
 // general purpose macros (never modified)
 
@@ -89,6 +113,13 @@ struct MHDCons1D {
 using DevExeSpace = Kokkos::DefaultExecutionSpace;
 using DevMemSpace = Kokkos::DefaultExecutionSpace::memory_space;
 using HostMemSpace = Kokkos::HostSpace;
+// pinned host memory for staging MPI messages when GPU-aware MPI is disabled; falls
+// back to plain HostSpace with backends that do not provide a host-pinned space
+#if defined(KOKKOS_HAS_SHARED_HOST_PINNED_SPACE)
+using HostPinnedMemSpace = Kokkos::SharedHostPinnedSpace;
+#else
+using HostPinnedMemSpace = Kokkos::HostSpace;
+#endif
 using ScratchMemSpace = DevExeSpace::scratch_memory_space;
 using LayoutWrapper = Kokkos::LayoutRight;                // increments last index fastest
 using TeamMember_t = Kokkos::TeamPolicy<>::member_type;   // for Kokkos thread teams
@@ -123,6 +154,18 @@ using HostArray4D = Kokkos::View<T ****, LayoutWrapper, HostMemSpace>;
 template <typename T>
 using HostArray5D = Kokkos::View<T *****, LayoutWrapper, HostMemSpace>;
 
+// template declarations for construction of Kokkos::View in pinned host memory
+template <typename T>
+using StageArray1D = Kokkos::View<T *, LayoutWrapper, HostPinnedMemSpace>;
+template <typename T>
+using StageArray2D = Kokkos::View<T **, LayoutWrapper, HostPinnedMemSpace>;
+template <typename T>
+using StageArray3D = Kokkos::View<T ***, LayoutWrapper, HostPinnedMemSpace>;
+template <typename T>
+using StageArray4D = Kokkos::View<T ****, LayoutWrapper, HostPinnedMemSpace>;
+template <typename T>
+using StageArray5D = Kokkos::View<T *****, LayoutWrapper, HostPinnedMemSpace>;
+
 // template declarations for construction of Kokkos::DualViews
 template <typename T>
 using DualArray1D = Kokkos::DualView<T *, LayoutWrapper, DevMemSpace>;
@@ -332,6 +375,32 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   });
 }
 
+// launch-parameter overrides set by the first-cycles autotuner (<mesh>/autotune, see
+// src/utils/kernel_tuner.cpp); the defaults leave Kokkos' own choices in place
+namespace kernel_tuner {
+extern int team_size;   // fixed team size for par_for_outer (0 = Kokkos::AUTO)
+extern int scr_level;   // scratch level override (-1 = use call-site value)
+}  // namespace kernel_tuner
+
+// builds the TeamPolicy for a par_for_outer launch, applying any autotuner overrides.
+// A fixed team size is clamped to this kernel's maximum (which depends on its register
+// and scratch usage) so an aggressive global override can never break a launch
+template <typename Function>
+inline Kokkos::TeamPolicy<> MakeTeamPolicy(DevExeSpace exec_space, const int nleague,
+                                           size_t scr_size, const int scr_level,
+                                           const Function &kern) {
+  const int lvl = (kernel_tuner::scr_level < 0)? scr_level : kernel_tuner::scr_level;
+  Kokkos::TeamPolicy<> policy(exec_space, nleague, Kokkos::AUTO);
+  policy.set_scratch_size(lvl, Kokkos::PerTeam(scr_size));
+  if (kernel_tuner::team_size > 0) {
+    const int tmax = policy.team_size_max(kern, Kokkos::ParallelForTag());
+    const int ts = (kernel_tuner::team_size < tmax)? kernel_tuner::team_size : tmax;
+    policy = Kokkos::TeamPolicy<>(exec_space, nleague, ts);
+    policy.set_scratch_size(lvl, Kokkos::PerTeam(scr_size));
+  }
+  return policy;
+}
+
 //------------------------------------------
 // 1D outer parallel loop using Kokkos Teams
 template <typename Function>
@@ -339,12 +408,12 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
                           size_t scr_size, const int scr_level,
                           const int kl, const int ku, const Function &function) {
   const int nk = ku - kl + 1;
-  Kokkos::TeamPolicy<> policy(exec_space, nk, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
-  KOKKOS_LAMBDA(TeamMember_t tmember) {
+  auto kern = KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int k = tmember.league_rank() + kl;
     function(tmember, k);
-  });
+  };
+  Kokkos::parallel_for(name, MakeTeamPolicy(exec_space, nk, scr_size, scr_level, kern),
+                       kern);
 }
 
 //------------------------------------------
@@ -357,13 +426,13 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nk = ku - kl + 1;
   const int nj = ju - jl + 1;
   const int nkj = nk*nj;
-  Kokkos::TeamPolicy<> policy(exec_space, nkj, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
-  KOKKOS_LAMBDA(TeamMember_t tmember) {
+  auto kern = KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int k = tmember.league_rank()/nj + kl;
     const int j = tmember.league_rank()%nj + jl;
     function(tmember, k, j);
-  });
+  };
+  Kokkos::parallel_for(name, MakeTeamPolicy(exec_space, nkj, scr_size, scr_level, kern),
+                       kern);
 }
 
 //------------------------------------------
@@ -378,16 +447,16 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nj = ju - jl + 1;
   const int nkj  = nk*nj;
   const int nnkj = nn*nk*nj;
-  Kokkos::TeamPolicy<> policy(exec_space, nnkj, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
-  KOKKOS_LAMBDA(TeamMember_t tmember) {
+  auto kern = KOKKOS_LAMBDA(TeamMember_t tmember) {
     int n = (tmember.league_rank())/nkj;
     int k = (tmember.league_rank() - n*nkj)/nj;
     int j = (tmember.league_rank() - n*nkj - k*nj) + jl;
     n += nl;
     k += kl;
     function(tmember, n, k, j);
-  });
+  };
+  Kokkos::parallel_for(name, MakeTeamPolicy(exec_space, nnkj, scr_size, scr_level, kern),
+                       kern);
 }
 
 //------------------------------------------
@@ -405,9 +474,7 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nkj   = nk*nj;
   const int nnkj  = nn*nk*nj;
   const int nmnkj = nm*nn*nk*nj;
-  Kokkos::TeamPolicy<> policy(exec_space, nmnkj, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
-  KOKKOS_LAMBDA(TeamMember_t tmember) {
+  auto kern = KOKKOS_LAMBDA(TeamMember_t tmember) {
     int m = (tmember.league_rank())/nnkj;
     int n = (tmember.league_rank() - m*nnkj)/nkj;
     int k = (tmember.league_rank() - m*nnkj - n*nkj)/nj;
@@ -416,7 +483,9 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
     n += nl;
     k += kl;
     function(tmember, m, n, k, j);
-  });
+  };
+  Kokkos::parallel_for(name, MakeTeamPolicy(exec_space, nmnkj, scr_size, scr_level,
+                                            kern), kern);
 }
 
 //---------------------------------------------
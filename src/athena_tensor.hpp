@@ -543,4 +543,280 @@ AthenaScratchTensor<T, sym, ndim, 4>::AthenaScratchTensor() {
   }
 }
 
+//----------------------------------------------------------------------------------------
+// Pencil (spatially 1D) scratch tensors.  Unlike AthenaScratchTensor, which holds a
+// single tensor in registers, these hold one tensor per point of an x1-pencil in Kokkos
+// team scratch memory.  Team-based kernels use them to stage stencil results (e.g.
+// finite-difference derivatives) once per pencil, then share them across subsequent
+// phases of the calculation separated by team barriers; see Z4c::CalcRHS.  Views must
+// be allocated from the team scratch pad with NewAthenaScratchTensor() before use.
+template<typename T, TensorSymm sym, int ndim, int rank>
+class AthenaScratchTensor1D;
+
+//----------------------------------------------------------------------------------------
+// rank 0 pencil scratch tensor: scalar field along a pencil
+template<typename T, TensorSymm sym, int ndim>
+class AthenaScratchTensor1D<T, sym, ndim, 0> {
+ public:
+  // the default constructor/destructor/copy operators are sufficient
+  AthenaScratchTensor1D() = default;
+  ~AthenaScratchTensor1D() = default;
+  AthenaScratchTensor1D(AthenaScratchTensor1D<T, sym, ndim, 0> const &) = default;
+  AthenaScratchTensor1D<T, sym, ndim, 0> & operator=
+  (AthenaScratchTensor1D<T, sym, ndim, 0> const &) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  void NewAthenaScratchTensor(const TeamMember_t &member, int scr_level, int nx) {
+    data_ = ScrArray1D<T>(member.team_scratch(scr_level), nx);
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real operator()(int const i) const {
+    return data_(i);
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real & operator()(int const i) {
+    return data_(i);
+  }
+
+ private:
+  ScrArray1D<T> data_;
+};
+
+//----------------------------------------------------------------------------------------
+// rank 1 pencil scratch tensor: vector and co-vector fields along a pencil
+template<typename T, TensorSymm sym, int ndim>
+class AthenaScratchTensor1D<T, sym, ndim, 1> {
+ public:
+  // the default constructor/destructor/copy operators are sufficient
+  AthenaScratchTensor1D() = default;
+  ~AthenaScratchTensor1D() = default;
+  AthenaScratchTensor1D(AthenaScratchTensor1D<T, sym, ndim, 1> const &) = default;
+  AthenaScratchTensor1D<T, sym, ndim, 1> & operator=
+  (AthenaScratchTensor1D<T, sym, ndim, 1> const &) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  void NewAthenaScratchTensor(const TeamMember_t &member, int scr_level, int nx) {
+    data_ = ScrArray2D<T>(member.team_scratch(scr_level), ndim, nx);
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real operator()(int const a, int const i) const {
+    return data_(a,i);
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real & operator()(int const a, int const i) {
+    return data_(a,i);
+  }
+
+ private:
+  ScrArray2D<T> data_;
+};
+
+//----------------------------------------------------------------------------------------
+// rank 2 pencil scratch tensor
+template<typename T, TensorSymm sym, int ndim>
+class AthenaScratchTensor1D<T, sym, ndim, 2> {
+ public:
+  KOKKOS_INLINE_FUNCTION
+  AthenaScratchTensor1D();
+  // the default destructor/copy operators are sufficient
+  ~AthenaScratchTensor1D() = default;
+  AthenaScratchTensor1D(AthenaScratchTensor1D<T, sym, ndim, 2> const &) = default;
+  AthenaScratchTensor1D<T, sym, ndim, 2> & operator=
+  (AthenaScratchTensor1D<T, sym, ndim, 2> const &) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  void NewAthenaScratchTensor(const TeamMember_t &member, int scr_level, int nx) {
+    data_ = ScrArray2D<T>(member.team_scratch(scr_level), ndof_, nx);
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real operator()(int const a, int const b, int const i) const {
+    return data_(idxmap_[a][b],i);
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real & operator()(int const a, int const b, int const i) {
+    return data_(idxmap_[a][b],i);
+  }
+
+ private:
+  ScrArray2D<T> data_;
+  int idxmap_[3][3];
+  int ndof_;
+};
+
+//----------------------------------------------------------------------------------------
+// Implementation details
+template<typename T, TensorSymm sym, int ndim>
+KOKKOS_INLINE_FUNCTION
+AthenaScratchTensor1D<T, sym, ndim, 2>::AthenaScratchTensor1D() {
+  switch(sym) {
+    case TensorSymm::NONE:
+      ndof_ = 0;
+      for(int a = 0; a < ndim; ++a)
+      for(int b = 0; b < ndim; ++b) {
+        idxmap_[a][b] = ndof_++;
+      }
+      break;
+    case TensorSymm::SYM2:
+    case TensorSymm::ISYM2:
+      ndof_ = 0;
+      for(int a = 0; a < ndim; ++a)
+      for(int b = a; b < ndim; ++b) {
+        idxmap_[a][b] = ndof_++;
+        idxmap_[b][a] = idxmap_[a][b];
+      }
+      break;
+  }
+}
+
+//----------------------------------------------------------------------------------------
+// rank 3 pencil scratch tensor
+template<typename T, TensorSymm sym, int ndim>
+class AthenaScratchTensor1D<T, sym, ndim, 3> {
+ public:
+  KOKKOS_INLINE_FUNCTION
+  AthenaScratchTensor1D();
+  // the default destructor/copy operators are sufficient
+  ~AthenaScratchTensor1D() = default;
+  AthenaScratchTensor1D(AthenaScratchTensor1D<T, sym, ndim, 3> const &) = default;
+  AthenaScratchTensor1D<T, sym, ndim, 3> & operator=
+  (AthenaScratchTensor1D<T, sym, ndim, 3> const &) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  void NewAthenaScratchTensor(const TeamMember_t &member, int scr_level, int nx) {
+    data_ = ScrArray2D<T>(member.team_scratch(scr_level), ndof_, nx);
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real operator()(int const a, int const b, int const c, int const i) const {
+    return data_(idxmap_[a][b][c],i);
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real & operator()(int const a, int const b, int const c, int const i) {
+    return data_(idxmap_[a][b][c],i);
+  }
+
+ private:
+  ScrArray2D<T> data_;
+  int idxmap_[3][3][3];
+  int ndof_;
+};
+
+//----------------------------------------------------------------------------------------
+// Implementation details
+template<typename T, TensorSymm sym, int ndim>
+KOKKOS_INLINE_FUNCTION
+AthenaScratchTensor1D<T, sym, ndim, 3>::AthenaScratchTensor1D() {
+  switch(sym) {
+    case TensorSymm::NONE:
+      ndof_ = 0;
+      for(int a = 0; a < ndim; ++a)
+      for(int b = 0; b < ndim; ++b)
+      for(int c = 0; c < ndim; ++c) {
+        idxmap_[a][b][c] = ndof_++;
+      }
+      break;
+    case TensorSymm::SYM2:
+      ndof_ = 0;
+      for(int a = 0; a < ndim; ++a)
+      for(int b = 0; b < ndim; ++b)
+      for(int c = b; c < ndim; ++c) {
+        idxmap_[a][b][c] = ndof_++;
+        idxmap_[a][c][b] = idxmap_[a][b][c];
+      }
+      break;
+    case TensorSymm::ISYM2:
+      ndof_ = 0;
+      for(int a = 0; a < ndim; ++a)
+      for(int b = a; b < ndim; ++b)
+      for(int c = 0; c < ndim; ++c) {
+        idxmap_[a][b][c] = ndof_++;
+        idxmap_[b][a][c] = idxmap_[a][b][c];
+      }
+      break;
+  }
+}
+
+//----------------------------------------------------------------------------------------
+// rank 4 pencil scratch tensor
+template<typename T, TensorSymm sym, int ndim>
+class AthenaScratchTensor1D<T, sym, ndim, 4> {
+ public:
+  KOKKOS_INLINE_FUNCTION
+  AthenaScratchTensor1D();
+  // the default destructor/copy operators are sufficient
+  ~AthenaScratchTensor1D() = default;
+  AthenaScratchTensor1D(AthenaScratchTensor1D<T, sym, ndim, 4> const &) = default;
+  AthenaScratchTensor1D<T, sym, ndim, 4> & operator=
+  (AthenaScratchTensor1D<T, sym, ndim, 4> const &) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  void NewAthenaScratchTensor(const TeamMember_t &member, int scr_level, int nx) {
+    data_ = ScrArray2D<T>(member.team_scratch(scr_level), ndof_, nx);
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real operator()(int const a, int const b,
+                  int const c, int const d, int const i) const {
+    return data_(idxmap_[a][b][c][d],i);
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real & operator()(int const a, int const b,
+                    int const c, int const d, int const i) {
+    return data_(idxmap_[a][b][c][d],i);
+  }
+
+ private:
+  ScrArray2D<T> data_;
+  int idxmap_[3][3][3][3];
+  int ndof_;
+};
+
+//----------------------------------------------------------------------------------------
+// Implementation details
+template<typename T, TensorSymm sym, int ndim>
+KOKKOS_INLINE_FUNCTION
+AthenaScratchTensor1D<T, sym, ndim, 4>::AthenaScratchTensor1D() {
+  switch(sym) {
+    case TensorSymm::NONE:
+      ndof_ = 0;
+      for(int a = 0; a < ndim; ++a)
+      for(int b = 0; b < ndim; ++b)
+      for(int c = 0; c < ndim; ++c)
+      for(int d = 0; d < ndim; ++d) {
+        idxmap_[a][b][c][d] = ndof_++;
+      }
+      break;
+    case TensorSymm::SYM2:
+      ndof_ = 0;
+      for(int a = 0; a < ndim; ++a)
+      for(int b = 0; b < ndim; ++b)
+      for(int c = 0; c < ndim; ++c)
+      for(int d = c; d < ndim; ++d) {
+        idxmap_[a][b][c][d] = ndof_++;
+        idxmap_[a][b][d][c] = idxmap_[a][b][c][d];
+      }
+      break;
+    case TensorSymm::ISYM2:
+      ndof_ = 0;
+      for(int a = 0; a < ndim; ++a)
+      for(int b = a; b < ndim; ++b)
+      for(int c = 0; c < ndim; ++c)
+      for(int d = 0; d < ndim; ++d) {
+        idxmap_[a][b][c][d] = ndof_++;
+        idxmap_[b][a][c][d] = idxmap_[a][b][c][d];
+      }
+      break;
+    case TensorSymm::SYM22:
+      ndof_ = 0;
+      for(int a = 0; a < ndim; ++a)
+      for(int b = a; b < ndim; ++b)
+      for(int c = 0; c < ndim; ++c)
+      for(int d = c; d < ndim; ++d) {
+        idxmap_[a][b][c][d] = ndof_++;
+        idxmap_[b][a][c][d] = idxmap_[a][b][c][d];
+        idxmap_[a][b][d][c] = idxmap_[a][b][c][d];
+        idxmap_[b][a][d][c] = idxmap_[a][b][c][d];
+      }
+      break;
+  }
+}
+
 #endif // ATHENA_TENSOR_HPP_
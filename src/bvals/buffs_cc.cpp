@@ -30,17 +30,18 @@ void MeshBoundaryValuesCC::InitSendIndices(MeshBoundaryBuffer &buf,
   auto &mb_indcs  = pmy_pack->pmesh->mb_indcs;
   int ng  = mb_indcs.ng;
   int ng1 = ng - 1;
+  int ngc1 = ng_comm - 1;   // same-level exchanges may use a reduced ghost width
 
   // set indices for sends to neighbors on SAME level
   // Formulae taken from LoadBoundaryBufferSameLevel() in src/bvals/cc/bvals_cc.cpp
   if ((f1 == 0) && (f2 == 0)) {  // this buffer used for same level (e.g. #0,4,8,12,...)
     auto &isame = buf.isame[0];    // indices of buffer for neighbor same level
-    isame.bis = (ox1 > 0) ? (mb_indcs.ie - ng1) : mb_indcs.is;
-    isame.bie = (ox1 < 0) ? (mb_indcs.is + ng1) : mb_indcs.ie;
-    isame.bjs = (ox2 > 0) ? (mb_indcs.je - ng1) : mb_indcs.js;
-    isame.bje = (ox2 < 0) ? (mb_indcs.js + ng1) : mb_indcs.je;
-    isame.bks = (ox3 > 0) ? (mb_indcs.ke - ng1) : mb_indcs.ks;
-    isame.bke = (ox3 < 0) ? (mb_indcs.ks + ng1) : mb_indcs.ke;
+    isame.bis = (ox1 > 0) ? (mb_indcs.ie - ngc1) : mb_indcs.is;
+    isame.bie = (ox1 < 0) ? (mb_indcs.is + ngc1) : mb_indcs.ie;
+    isame.bjs = (ox2 > 0) ? (mb_indcs.je - ngc1) : mb_indcs.js;
+    isame.bje = (ox2 < 0) ? (mb_indcs.js + ngc1) : mb_indcs.je;
+    isame.bks = (ox3 > 0) ? (mb_indcs.ke - ngc1) : mb_indcs.ks;
+    isame.bke = (ox3 < 0) ? (mb_indcs.ks + ngc1) : mb_indcs.ke;
     buf.isame_ndat = (isame.bie - isame.bis + 1)*(isame.bje - isame.bjs + 1)*
                      (isame.bke - isame.bks + 1);
   }
@@ -165,6 +166,7 @@ void MeshBoundaryValuesCC::InitRecvIndices(MeshBoundaryBuffer &buf,
                                            int ox1, int ox2, int ox3, int f1, int f2) {
   auto &mb_indcs  = pmy_pack->pmesh->mb_indcs;
   int ng = mb_indcs.ng;
+  int ngc = ng_comm;   // same-level exchanges may use a reduced ghost width
 
   // set indices for receives from neighbors on SAME level
   // Formulae taken from SetBoundarySameLevel() in src/bvals/cc/bvals_cc.cpp
@@ -173,25 +175,25 @@ void MeshBoundaryValuesCC::InitRecvIndices(MeshBoundaryBuffer &buf,
     if (ox1 == 0) {
       isame.bis = mb_indcs.is;          isame.bie = mb_indcs.ie;
     } else if (ox1 > 0) {
-      isame.bis = mb_indcs.ie + 1;      isame.bie = mb_indcs.ie + ng;
+      isame.bis = mb_indcs.ie + 1;      isame.bie = mb_indcs.ie + ngc;
     } else {
-      isame.bis = mb_indcs.is - ng;     isame.bie = mb_indcs.is - 1;
+      isame.bis = mb_indcs.is - ngc;    isame.bie = mb_indcs.is - 1;
     }
 
     if (ox2 == 0) {
       isame.bjs = mb_indcs.js;          isame.bje = mb_indcs.je;
     } else if (ox2 > 0) {
-      isame.bjs = mb_indcs.je + 1;      isame.bje = mb_indcs.je + ng;
+      isame.bjs = mb_indcs.je + 1;      isame.bje = mb_indcs.je + ngc;
     } else {
-      isame.bjs = mb_indcs.js - ng;     isame.bje = mb_indcs.js - 1;
+      isame.bjs = mb_indcs.js - ngc;    isame.bje = mb_indcs.js - 1;
     }
 
     if (ox3 == 0) {
       isame.bks = mb_indcs.ks;          isame.bke = mb_indcs.ke;
     } else if (ox3 > 0) {
-      isame.bks = mb_indcs.ke + 1;      isame.bke = mb_indcs.ke + ng;
+      isame.bks = mb_indcs.ke + 1;      isame.bke = mb_indcs.ke + ngc;
     } else {
-      isame.bks = mb_indcs.ks - ng;     isame.bke = mb_indcs.ks - 1;
+      isame.bks = mb_indcs.ks - ngc;    isame.bke = mb_indcs.ks - 1;
     }
     buf.isame_ndat = (isame.bie - isame.bis + 1)*(isame.bje - isame.bjs + 1)*
                      (isame.bke - isame.bks + 1);
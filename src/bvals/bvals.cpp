@@ -7,10 +7,14 @@
 //! \brief constructors and initializers for both particle and Mesh variable boundary
 //! classes.
 
+#include <cstdint>
 #include <cstdlib>
+#include <iomanip>
 #include <iostream>
+#include <map>
 #include <utility>
-#include <algorithm> // max
+#include <vector>
+#include <algorithm> // max, sort
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -18,6 +22,7 @@
 #include "mesh/nghbr_index.hpp"
 #include "mesh/mesh.hpp"
 #include "particles/particles.hpp"
+#include "utils/memory_accounting.hpp"
 #include "bvals.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -43,11 +48,13 @@ MeshBoundaryValues::MeshBoundaryValues(MeshBlockPack *pp, ParameterInput *pin, b
     sendbuf[n].flux_req = new MPI_Request[nmb];
     recvbuf[n].vars_req = new MPI_Request[nmb];
     recvbuf[n].flux_req = new MPI_Request[nmb];
+    recvbuf[n].vars_req_alt = new MPI_Request[nmb];
     for (int m=0; m<nmb; ++m) {
       sendbuf[n].vars_req[m] = MPI_REQUEST_NULL;
       sendbuf[n].flux_req[m] = MPI_REQUEST_NULL;
       recvbuf[n].vars_req[m] = MPI_REQUEST_NULL;
       recvbuf[n].flux_req[m] = MPI_REQUEST_NULL;
+      recvbuf[n].vars_req_alt[m] = MPI_REQUEST_NULL;
     }
 #endif
     // initialize data sizes in each send/recv buffer to zero
@@ -69,6 +76,61 @@ MeshBoundaryValues::MeshBoundaryValues(MeshBlockPack *pp, ParameterInput *pin, b
   // create unique communicators for variables and fluxes in this BoundaryValues object
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_vars);
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_flux);
+
+  // optionally transmit Z4c variable messages in single precision, halving network
+  // volume for smooth fields; data in memory remains FP64 (conversion wraps MPI calls)
+  single_prec = (z4c)? pin->GetOrAddBoolean("z4c", "single_prec_bvals", false) : false;
+
+  // optionally move all variable buffers exchanged with each remote rank as a single
+  // neighborhood collective (MPI_Ineighbor_alltoallv) over a distributed-graph
+  // communicator, letting the MPI library schedule and combine transfers; on some
+  // fabrics this beats the hand-rolled point-to-point paths below
+  neighbor_coll = pin->GetOrAddBoolean("mesh", "neighbor_collective_bvals", false)
+                  && !single_prec;
+
+  // optionally coalesce all variable buffers exchanged with each remote rank into one
+  // message per rank pair (buffers are built lazily on first InitRecv call).  The
+  // neighborhood-collective mode reuses this gather/scatter machinery, so it implies
+  // coalesce.  Coalesced storage is Real, incompatible with single-precision messages
+  coalesce = (pin->GetOrAddBoolean("mesh", "coalesce_bvals", false) || neighbor_coll)
+             && !single_prec;
+
+  // optionally use persistent MPI requests for variable messages (best for static
+  // meshes).  Ignored with coalesce_bvals=true, which already amortizes request setup
+  // across all buffers exchanged with each rank
+  persistent = pin->GetOrAddBoolean("mesh", "persistent_bvals", false)
+               && !coalesce && !single_prec;
+
+  // optionally double-buffer receives: every InitRecv() also posts receives for the
+  // next exchange into an alternate staging plane, so messages from ranks running a
+  // stage ahead always pre-match a posted receive instead of queueing as unexpected.
+  // MPI non-overtaking between a rank pair keeps matching in exchange order.  The
+  // pre-posted receives assume the next exchange reuses the same topology, so eager
+  // mode is limited to static (non-adaptive) meshes; it also needs the staged
+  // point-to-point path, since receives must land outside the buffers being unpacked
+  eager_recv = pin->GetOrAddBoolean("mesh", "eager_recv_bvals", false)
+               && !coalesce && !persistent && !single_prec
+               && !(pmy_pack->pmesh->adaptive);
+#if GPU_AWARE_MPI_ENABLED
+  // receives land directly in device buffers, so there is no alternate plane
+  eager_recv = false;
+#endif
+
+  // optionally count messages and bytes sent to every rank (see OutputCommMatrix()).
+  // Counters are shared by all MeshBoundaryValues objects; sized on first construction
+  comm_matrix = pin->GetOrAddBoolean("mesh", "comm_matrix", false);
+  if (comm_matrix && comm_nmsg[0].empty()) {
+    for (int t=0; t<ncomm_msg; ++t) {
+      comm_nmsg[t].assign(global_variable::nranks, 0);
+      comm_nbyte[t].assign(global_variable::nranks, 0);
+    }
+  }
+#if !(GPU_AWARE_MPI_ENABLED)
+  // chunk length for pipelining device-to-pinned-host copies of coalesced messages with
+  // their network injection (per-neighbor messages are small and are staged whole)
+  stage_chunk_ = static_cast<int>(
+      1024*pin->GetOrAddInteger("mesh", "staging_chunk_kb", 4096)/sizeof(Real));
+#endif
 #endif
 }
 
@@ -78,11 +140,29 @@ MeshBoundaryValues::MeshBoundaryValues(MeshBlockPack *pp, ParameterInput *pin, b
 MeshBoundaryValues::~MeshBoundaryValues() {
 #if MPI_PARALLEL_ENABLED
   int nnghbr = pmy_pack->pmb->nnghbr;
+  // in eager mode receives are posted one exchange ahead, so at shutdown one plane
+  // still holds receives for an exchange that will never happen; cancel them before
+  // their storage is freed
+  if (eager_recv && eager_posted_) {
+    int nmb = std::max((pmy_pack->nmb_thispack), (pmy_pack->pmesh->nmb_maxperrank));
+    for (int n=0; n<nnghbr; ++n) {
+      for (int m=0; m<nmb; ++m) {
+        MPI_Request *reqs[2] = {&(recvbuf[n].vars_req[m]), &(recvbuf[n].vars_req_alt[m])};
+        for (int p=0; p<2; ++p) {
+          if (*(reqs[p]) != MPI_REQUEST_NULL) {
+            MPI_Cancel(reqs[p]);
+            MPI_Wait(reqs[p], MPI_STATUS_IGNORE);
+          }
+        }
+      }
+    }
+  }
   for (int n=0; n<nnghbr; ++n) {
     delete [] sendbuf[n].vars_req;
     delete [] sendbuf[n].flux_req;
     delete [] recvbuf[n].vars_req;
     delete [] recvbuf[n].flux_req;
+    delete [] recvbuf[n].vars_req_alt;
   }
 #endif
 }
@@ -97,6 +177,9 @@ MeshBoundaryValues::~MeshBoundaryValues() {
 //! virtual functions that only get instantiated when the derived classes are constructed
 
 void MeshBoundaryValues::InitializeBuffers(const int nvar) {
+  // attribute buffer allocations to bvals rather than the calling physics module
+  memory_accounting::Scope mem_scope("bvals");
+  nvar_base_ = nvar;   // FuseCC() reallocates message storage relative to this
   // allocate memory for inflow BCs (but only if domain not strictly periodic)
   if (!(pmy_pack->pmesh->strictly_periodic)) {
     Kokkos::realloc(u_in, nvar, 6);
@@ -122,8 +205,8 @@ void MeshBoundaryValues::InitializeBuffers(const int nvar) {
         int indx = NeighborIndex(n,0,0,fy,fz);
         InitSendIndices(sendbuf[indx],n, 0, 0, fy, fz);
         InitRecvIndices(recvbuf[indx],n, 0, 0, fy, fz);
-        sendbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
-        recvbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
+        sendbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
+        recvbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
         indx++;
       }
     }
@@ -138,8 +221,8 @@ void MeshBoundaryValues::InitializeBuffers(const int nvar) {
           int indx = NeighborIndex(0,m,0,fx,fz);
           InitSendIndices(sendbuf[indx],0, m, 0, fx, fz);
           InitRecvIndices(recvbuf[indx],0, m, 0, fx, fz);
-          sendbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
-          recvbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
+          sendbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
+          recvbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
           indx++;
         }
       }
@@ -152,8 +235,8 @@ void MeshBoundaryValues::InitializeBuffers(const int nvar) {
           int indx = NeighborIndex(n,m,0,fz,0);
           InitSendIndices(sendbuf[indx],n, m, 0, fz, 0);
           InitRecvIndices(recvbuf[indx],n, m, 0, fz, 0);
-          sendbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
-          recvbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
+          sendbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
+          recvbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
           indx++;
         }
       }
@@ -169,8 +252,8 @@ void MeshBoundaryValues::InitializeBuffers(const int nvar) {
           int indx = NeighborIndex(0,0,l,fx,fy);
           InitSendIndices(sendbuf[indx],0, 0, l, fx, fy);
           InitRecvIndices(recvbuf[indx],0, 0, l, fx, fy);
-          sendbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
-          recvbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
+          sendbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
+          recvbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
           indx++;
         }
       }
@@ -183,8 +266,8 @@ void MeshBoundaryValues::InitializeBuffers(const int nvar) {
           int indx = NeighborIndex(n,0,l,fy,0);
           InitSendIndices(sendbuf[indx],n, 0, l, fy, 0);
           InitRecvIndices(recvbuf[indx],n, 0, l, fy, 0);
-          sendbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
-          recvbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
+          sendbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
+          recvbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
           indx++;
         }
       }
@@ -197,8 +280,8 @@ void MeshBoundaryValues::InitializeBuffers(const int nvar) {
           int indx = NeighborIndex(0,m,l,fx,0);
           InitSendIndices(sendbuf[indx],0, m, l, fx, 0);
           InitRecvIndices(recvbuf[indx],0, m, l, fx, 0);
-          sendbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
-          recvbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
+          sendbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
+          recvbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
           indx++;
         }
       }
@@ -211,16 +294,536 @@ void MeshBoundaryValues::InitializeBuffers(const int nvar) {
           int indx = NeighborIndex(n,m,l,0,0);
           InitSendIndices(sendbuf[indx],n, m, l, 0, 0);
           InitRecvIndices(recvbuf[indx],n, m, l, 0, 0);
-          sendbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
-          recvbuf[indx].AllocateBuffers(nmb, nvar, is_z4c_);
+          sendbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
+          recvbuf[indx].ComputeBufferSizes(nvar, is_z4c_);
         }
       }
     }
   }
 
+  // back all buffer storage sized above with one slab allocation per slab type
+  AllocateBufferSlabs(nmb);
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::AllocateBufferSlabs
+//! \brief (re)allocates the storage slabs backing all 112 send/recv buffers and carves
+//! each buffer's vars/flux (and staging / FP32 wire copies, where enabled) out of them
+//! as unmanaged windows.  Buffer sizes must have been set with ComputeBufferSizes()
+//! first; buffers never sized (e.g. 3D buffers in a 2D run) get zero-width windows.
+//! Called from InitializeBuffers() and again from FuseCC(), which grows every buffer
+//! to carry the fused variable sets; either way the whole reconfiguration costs one
+//! device allocation per slab instead of one per buffer
+
+void MeshBoundaryValues::AllocateBufferSlabs(const int nmb) {
+  // attribute buffer allocations to bvals rather than the calling physics module
+  memory_accounting::Scope mem_scope("bvals");
+
+  // total elements across the vars and flux windows of all send and recv buffers
+  size_t nvars_tot = 0, nflux_tot = 0;
+  for (int n=0; n<56; ++n) {
+    nvars_tot += static_cast<size_t>(nmb)*(sendbuf[n].vars_ncols +
+                                           recvbuf[n].vars_ncols);
+    nflux_tot += static_cast<size_t>(nmb)*(sendbuf[n].flux_ncols +
+                                           recvbuf[n].flux_ncols);
+  }
+  Kokkos::realloc(buf_slab_, nvars_tot + nflux_tot);
+#if MPI_PARALLEL_ENABLED
+#if !(GPU_AWARE_MPI_ENABLED)
+  Kokkos::realloc(buf_slab_stage_, nvars_tot);
+  // alternate staging plane for recv buffers only, used by eager (double-buffered)
+  // receives to hold next-exchange messages while the current plane is unpacked
+  size_t nrecv_tot = 0;
+  if (eager_recv) {
+    for (int n=0; n<56; ++n) {
+      nrecv_tot += static_cast<size_t>(nmb)*recvbuf[n].vars_ncols;
+    }
+    Kokkos::realloc(buf_slab_stage_alt_, nrecv_tot);
+  }
+#endif
+  // FP32 wire copies mirror vars only, and only with <z4c>/single_prec_bvals
+  if (single_prec) {
+    Kokkos::realloc(buf_slab_sp_, nvars_tot);
+#if !(GPU_AWARE_MPI_ENABLED)
+    Kokkos::realloc(buf_slab_sp_stage_, nvars_tot);
+#endif
+  }
+#endif
+
+  // carve per-buffer windows out of the slabs; vars windows of the staging and FP32
+  // slabs share offsets with the vars windows of the device slab
+  size_t off = 0, off_v = 0, off_alt = 0;
+  for (int n=0; n<56; ++n) {
+    for (int sr=0; sr<2; ++sr) {
+      MeshBoundaryBuffer &buf = (sr == 0)? sendbuf[n] : recvbuf[n];
+      buf.vars = DvceArray2D<Real>(buf_slab_.data() + off, nmb, buf.vars_ncols);
+#if MPI_PARALLEL_ENABLED
+#if !(GPU_AWARE_MPI_ENABLED)
+      buf.vars_stage = StageArray2D<Real>(buf_slab_stage_.data() + off_v, nmb,
+                                          buf.vars_ncols);
+      if (eager_recv && (sr == 1)) {
+        buf.vars_stage_alt = StageArray2D<Real>(buf_slab_stage_alt_.data() + off_alt,
+                                                nmb, buf.vars_ncols);
+      }
+#endif
+      if (single_prec) {
+        buf.vars_sp = DvceArray2D<float>(buf_slab_sp_.data() + off_v, nmb,
+                                         buf.vars_ncols);
+#if !(GPU_AWARE_MPI_ENABLED)
+        buf.vars_sp_stage = StageArray2D<float>(buf_slab_sp_stage_.data() + off_v, nmb,
+                                                buf.vars_ncols);
+#endif
+      }
+#endif
+      off += static_cast<size_t>(nmb)*buf.vars_ncols;
+      off_v += static_cast<size_t>(nmb)*buf.vars_ncols;
+      if (sr == 1) {off_alt += static_cast<size_t>(nmb)*buf.vars_ncols;}
+      buf.flux = DvceArray2D<Real>(buf_slab_.data() + off, nmb, buf.flux_ncols);
+      off += static_cast<size_t>(nmb)*buf.flux_ncols;
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::InitProlongIndices()
+//! \brief builds flat device-resident lists of the (MeshBlock, buffer) pairs with
+//! coarser and same-level neighbors, used as work-item lists by the prolongation and
+//! boundary-restriction kernels.  Called lazily at the start of those kernels; rebuilt
+//! only when AMR or load balancing changes the MeshBlock distribution, so on SMR runs
+//! (fixed level structure) the lists are computed exactly once.
+
+void MeshBoundaryValues::InitProlongIndices() {
+  int gen = 0;
+  if (pmy_pack->pmesh->pmr != nullptr) {
+    gen = pmy_pack->pmesh->pmr->nmb_created + pmy_pack->pmesh->pmr->nmb_deleted
+        + pmy_pack->pmesh->pmr->nmb_sent_thisrank;
+  }
+  if (gen == prol_mesh_gen_) {return;}
+  prol_mesh_gen_ = gen;
+
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+
+  nprol = 0;
+  nsame = 0;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (nghbr.h_view(m,n).gid >= 0) {
+        if (nghbr.h_view(m,n).lev < mblev.h_view(m)) {
+          ++nprol;
+        } else if (nghbr.h_view(m,n).lev == mblev.h_view(m)) {
+          ++nsame;
+        }
+      }
+    }
+  }
+
+  Kokkos::realloc(prol_m, nprol);
+  Kokkos::realloc(prol_n, nprol);
+  Kokkos::realloc(same_m, nsame);
+  Kokkos::realloc(same_n, nsame);
+  int ip = 0, isl = 0;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (nghbr.h_view(m,n).gid >= 0) {
+        if (nghbr.h_view(m,n).lev < mblev.h_view(m)) {
+          prol_m.h_view(ip) = m;
+          prol_n.h_view(ip) = n;
+          ++ip;
+        } else if (nghbr.h_view(m,n).lev == mblev.h_view(m)) {
+          same_m.h_view(isl) = m;
+          same_n.h_view(isl) = n;
+          ++isl;
+        }
+      }
+    }
+  }
+  prol_m.template modify<HostMemSpace>();
+  prol_n.template modify<HostMemSpace>();
+  same_m.template modify<HostMemSpace>();
+  same_n.template modify<HostMemSpace>();
+  prol_m.template sync<DevExeSpace>();
+  prol_n.template sync<DevExeSpace>();
+  same_m.template sync<DevExeSpace>();
+  same_n.template sync<DevExeSpace>();
+  return;
+}
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::InitCoalescedBuffers()
+//! \brief builds the segment tables and contiguous storage used to exchange all variable
+//! buffers with each remote rank as one message per rank pair.  Both ends order segments
+//! by the (local ID, buffer index) of the *receiving* MeshBlock -- the same key encoded
+//! in MPI tags -- so offsets agree on both sides without any extra communication.
+//! Called lazily from InitRecv() on the first exchange and again whenever AMR changes
+//! the neighbor topology.
+
+void MeshBoundaryValues::InitCoalescedBuffers(const int nvar) {
+  // attribute message storage allocations to bvals (rebuilt at regrids)
+  memory_accounting::Scope mem_scope("bvals");
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  int my_rank = global_variable::my_rank;
+
+  // collect per-remote-rank lists of (m,n) segments with their ordering keys
+  struct Segment {
+    int key, m, n, size;
+  };
+  std::map<int, std::vector<Segment>> send_segs, recv_segs;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (nghbr.h_view(m,n).gid < 0) continue;
+      int drank = nghbr.h_view(m,n).rank;
+      if (drank == my_rank) continue;
+
+      // segment sizes use the same level logic as the individual messages they replace.
+      // Send and recv sizes differ on multilevel meshes (the send-side indices carry
+      // transverse +/-ng extensions the recv side does not; see InitSendIndices vs
+      // InitRecvIndices in buffs_cc.cpp), so each direction sizes its segments from its
+      // own buffers, exactly like the point-to-point sends and receives they replace
+      int ssize = nvar, rsize = nvar;
+      if (nghbr.h_view(m,n).lev < mblev.h_view(m)) {
+        ssize *= sendbuf[n].icoar_ndat;
+        rsize *= recvbuf[n].icoar_ndat;
+      } else if (nghbr.h_view(m,n).lev == mblev.h_view(m)) {
+        ssize *= (is_z4c_)? sendbuf[n].isame_z4c_ndat : sendbuf[n].isame_ndat;
+        rsize *= (is_z4c_)? recvbuf[n].isame_z4c_ndat : recvbuf[n].isame_ndat;
+      } else {
+        ssize *= sendbuf[n].ifine_ndat;
+        rsize *= recvbuf[n].ifine_ndat;
+      }
+
+      // ordering key is (receiving local ID, receiving buffer index): for receives that
+      // is (m,n) on this rank, for sends the (lid,dest) of the neighbor
+      int dlid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
+      int dn = nghbr.h_view(m,n).dest;
+      send_segs[drank].push_back({CreateBvals_MPI_Tag(dlid, dn), m, n, ssize});
+      recv_segs[drank].push_back({CreateBvals_MPI_Tag(m, n), m, n, rsize});
+    }
+  }
+
+  // build one MeshCoalescedBuffer per remote rank for each direction
+  auto build = [&](std::map<int, std::vector<Segment>> &segs,
+                   std::vector<MeshCoalescedBuffer> &coal) {
+    coal.clear();
+    for (auto &[rank, list] : segs) {
+      std::sort(list.begin(), list.end(),
+                [](const Segment &a, const Segment &b) {return a.key < b.key;});
+      MeshCoalescedBuffer cb;
+      cb.rank = rank;
+      cb.nseg = static_cast<int>(list.size());
+      Kokkos::realloc(cb.seg_m, cb.nseg);
+      Kokkos::realloc(cb.seg_n, cb.nseg);
+      Kokkos::realloc(cb.seg_offset, cb.nseg);
+      Kokkos::realloc(cb.seg_size, cb.nseg);
+      int offset = 0;
+      for (int s=0; s<cb.nseg; ++s) {
+        cb.seg_m.h_view(s) = list[s].m;
+        cb.seg_n.h_view(s) = list[s].n;
+        cb.seg_offset.h_view(s) = offset;
+        cb.seg_size.h_view(s) = list[s].size;
+        offset += list[s].size;
+      }
+      cb.ndat = offset;
+      cb.seg_m.template modify<HostMemSpace>();
+      cb.seg_n.template modify<HostMemSpace>();
+      cb.seg_offset.template modify<HostMemSpace>();
+      cb.seg_size.template modify<HostMemSpace>();
+      cb.seg_m.template sync<DevExeSpace>();
+      cb.seg_n.template sync<DevExeSpace>();
+      cb.seg_offset.template sync<DevExeSpace>();
+      cb.seg_size.template sync<DevExeSpace>();
+      Kokkos::realloc(cb.data, cb.ndat);
+#if GPU_AWARE_MPI_ENABLED
+      // GPU-aware MPI accesses device storage directly and sends the message whole
+      cb.chunk = cb.ndat;
+#else
+      // without GPU-aware MPI the message is staged through pinned host memory in
+      // chunks, each sent separately so copies overlap injection of earlier chunks.
+      // The neighborhood-collective mode stages whole, so skip the per-rank copies
+      if (!neighbor_coll) {Kokkos::realloc(cb.data_stage, cb.ndat);}
+      cb.chunk = std::min(cb.ndat, stage_chunk_);
+#endif
+      cb.req.assign((cb.ndat + cb.chunk - 1)/cb.chunk, MPI_REQUEST_NULL);
+      coal.push_back(cb);
+    }
+  };
+  build(send_segs, coal_send);
+  build(recv_segs, coal_recv);
+
+  // with the neighborhood-collective mode, concatenate the per-rank messages into one
+  // contiguous array per direction and describe them with the count/displacement
+  // tables of MPI_Ineighbor_alltoallv.  Counts come from each direction's own segment
+  // tables, so on multilevel meshes the recv counts are recv-sized and agree with the
+  // matching sender's send counts segment-by-segment (both orderings use the same
+  // receiving-block key).  The per-rank data Views are re-pointed at slices of the
+  // concatenated array, so the gather/scatter kernels are unchanged
+  if (neighbor_coll) {
+    auto concat = [](std::vector<MeshCoalescedBuffer> &coal, DvceArray1D<Real> &data,
+                     std::vector<int> &count, std::vector<int> &displ) {
+      int ndat_tot = 0;
+      count.clear();
+      displ.clear();
+      for (auto &cb : coal) {
+        count.push_back(cb.ndat);
+        displ.push_back(ndat_tot);
+        ndat_tot += cb.ndat;
+      }
+      Kokkos::realloc(data, ndat_tot);
+      for (std::size_t r=0; r<coal.size(); ++r) {
+        coal[r].data = Kokkos::subview(data,
+                                       std::make_pair(displ[r], displ[r] + count[r]));
+      }
+    };
+    concat(coal_send, nbr_send_data, nbr_scount, nbr_sdispl);
+    concat(coal_recv, nbr_recv_data, nbr_rcount, nbr_rdispl);
+#if !(GPU_AWARE_MPI_ENABLED)
+    // the collective is staged whole through pinned host memory (no chunk pipelining)
+    Kokkos::realloc(nbr_send_stage, nbr_send_data.extent(0));
+    Kokkos::realloc(nbr_recv_stage, nbr_recv_data.extent(0));
+#endif
+
+    // (re)create the distributed-graph communicator from the neighbor-rank lists:
+    // sources are the ranks received from, destinations the ranks sent to
+    if (comm_nbr != MPI_COMM_NULL) {MPI_Comm_free(&comm_nbr);}
+    std::vector<int> srcs, dsts;
+    for (auto &cb : coal_recv) {srcs.push_back(cb.rank);}
+    for (auto &cb : coal_send) {dsts.push_back(cb.rank);}
+    MPI_Dist_graph_create_adjacent(comm_vars,
+                                   static_cast<int>(srcs.size()), srcs.data(),
+                                   MPI_UNWEIGHTED,
+                                   static_cast<int>(dsts.size()), dsts.data(),
+                                   MPI_UNWEIGHTED, MPI_INFO_NULL, 0, &comm_nbr);
+  }
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MeshBoundaryValues::SendCoalesced()
+//! \brief gathers packed send buffers into contiguous per-rank messages and posts one
+//! MPI_Isend per remote rank (or one per chunk when staging through pinned host memory
+//! without GPU-aware MPI).  Send buffers must already be packed (by PackAndSendCC/FC)
+//! on the comm stream; the gather runs on the same stream and is fenced before sends.
+
+TaskStatus MeshBoundaryValues::SendCoalesced() {
+  auto &sbuf = sendbuf;
+  for (auto &cb : coal_send) {
+    auto cdata = cb.data;
+    auto seg_m = cb.seg_m.d_view;
+    auto seg_n = cb.seg_n.d_view;
+    auto seg_offset = cb.seg_offset.d_view;
+    auto seg_size = cb.seg_size.d_view;
+    Kokkos::TeamPolicy<> policy(pmy_pack->exec_comm, cb.nseg, Kokkos::AUTO);
+    Kokkos::parallel_for("CoalSend", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int s = tmember.league_rank();
+      const int m = seg_m(s);
+      const int n = seg_n(s);
+      const int offset = seg_offset(s);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, seg_size(s)),
+      [&](const int i) {
+        cdata(offset + i) = sbuf[n].vars(m,i);
+      });
+    });
+  }
+  pmy_pack->exec_comm.fence();
+
+  // in neighborhood-collective mode, hand the whole concatenated message to MPI as a
+  // single nonblocking collective; it carries the receives too, so none were posted
+  if (neighbor_coll) {
+#if GPU_AWARE_MPI_ENABLED
+    Real *sptr = nbr_send_data.data();
+    Real *rptr = nbr_recv_data.data();
+#else
+    // stage the concatenated message through pinned host memory
+    Kokkos::deep_copy(nbr_send_stage, nbr_send_data);
+    Real *sptr = nbr_send_stage.data();
+    Real *rptr = nbr_recv_stage.data();
+#endif
+    int ierr = MPI_Ineighbor_alltoallv(sptr, nbr_scount.data(), nbr_sdispl.data(),
+                                       MPI_ATHENA_REAL,
+                                       rptr, nbr_rcount.data(), nbr_rdispl.data(),
+                                       MPI_ATHENA_REAL, comm_nbr, &nbr_req);
+    if (ierr != MPI_SUCCESS) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in posting neighborhood collective" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (comm_matrix) {
+      // the collective moves one logical message per destination rank
+      for (auto &cb : coal_send) {
+        CountMsg(comm_msg_coal, cb.rank,
+                 static_cast<std::int64_t>(cb.ndat)*sizeof(Real));
+      }
+    }
+    return TaskStatus::complete;
+  }
+
+  bool no_errors=true;
+  for (auto &cb : coal_send) {
+    // all (lid,bufid) tags are folded into one message per rank pair, so the tag only
+    // distinguishes chunks (a single chunk with tag=0 when GPU-aware MPI is enabled)
+    int nchunk = static_cast<int>(cb.req.size());
+    for (int c=0; c<nchunk; ++c) {
+      int start = c*cb.chunk;
+      int len = std::min(cb.ndat - start, cb.chunk);
+#if GPU_AWARE_MPI_ENABLED
+      Real *buf = cb.data.data() + start;
+#else
+      // copy this chunk to pinned host memory, overlapping the device-to-host transfer
+      // with network injection of chunks already posted
+      auto rng = std::make_pair(start, start + len);
+      Kokkos::deep_copy(pmy_pack->exec_comm, Kokkos::subview(cb.data_stage, rng),
+                        Kokkos::subview(cb.data, rng));
+      pmy_pack->exec_comm.fence();
+      Real *buf = cb.data_stage.data() + start;
+#endif
+      int ierr = MPI_Isend(buf, len, MPI_ATHENA_REAL, cb.rank, c, comm_vars,
+                           &(cb.req[c]));
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+      if (comm_matrix) {
+        CountMsg(comm_msg_coal, cb.rank, static_cast<std::int64_t>(len)*sizeof(Real));
+      }
+    }
+  }
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in posting coalesced sends" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool MeshBoundaryValues::TestCoalescedRecvs()
+//! \brief returns true only when the coalesced message from every remote rank arrived
+
+bool MeshBoundaryValues::TestCoalescedRecvs() {
+  // in neighborhood-collective mode a single request tracks the whole exchange
+  if (neighbor_coll) {
+    int test;
+    int ierr = MPI_Test(&nbr_req, &test, MPI_STATUS_IGNORE);
+    if (ierr != MPI_SUCCESS) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in testing neighborhood collective" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return static_cast<bool>(test);
+  }
+  bool arrived = true;
+  bool no_errors=true;
+  for (auto &cb : coal_recv) {
+    for (auto &req : cb.req) {
+      int test;
+      int ierr = MPI_Test(&req, &test, MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+      if (!(static_cast<bool>(test))) {arrived = false;}
+    }
+  }
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in testing coalesced receives" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return arrived;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::ScatterCoalescedRecvs()
+//! \brief scatters arrived per-rank messages into the individual recv buffers, after
+//! which unpacking proceeds exactly as with individual messages.  Runs on the default
+//! execution space instance so the unpack kernels that follow are stream-ordered with it.
+
+void MeshBoundaryValues::ScatterCoalescedRecvs() {
+  auto &rbuf = recvbuf;
+#if !(GPU_AWARE_MPI_ENABLED)
+  // the neighborhood collective received into one pinned host staging array; copy the
+  // whole concatenated message to device before scattering
+  if (neighbor_coll) {
+    Kokkos::deep_copy(DevExeSpace(), nbr_recv_data, nbr_recv_stage);
+  }
+#endif
+  for (auto &cb : coal_recv) {
+#if !(GPU_AWARE_MPI_ENABLED)
+    // message arrived in pinned host staging; copy to device before scattering.  The
+    // copy and the scatter below share the default instance, so no fence is needed
+    if (!neighbor_coll) {
+      Kokkos::deep_copy(DevExeSpace(), cb.data, cb.data_stage);
+    }
+#endif
+    auto cdata = cb.data;
+    auto seg_m = cb.seg_m.d_view;
+    auto seg_n = cb.seg_n.d_view;
+    auto seg_offset = cb.seg_offset.d_view;
+    auto seg_size = cb.seg_size.d_view;
+    Kokkos::TeamPolicy<> policy(DevExeSpace(), cb.nseg, Kokkos::AUTO);
+    Kokkos::parallel_for("CoalRecv", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int s = tmember.league_rank();
+      const int m = seg_m(s);
+      const int n = seg_n(s);
+      const int offset = seg_offset(s);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, seg_size(s)),
+      [&](const int i) {
+        rbuf[n].vars(m,i) = cdata(offset + i);
+      });
+    });
+  }
+  return;
+}
+#endif
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::OutputCommMatrix()
+//! \brief Print matrix of messages and bytes sent between every pair of ranks,
+//! accumulated when <mesh>/comm_matrix=true.  Each rank counts only its own sends, so
+//! the per-destination rows are gathered to rank 0, which prints one line per
+//! (source, destination) pair with traffic.  Must be called on all ranks.  Totals run
+//! from the start of execution, so they include the Initialize() exchanges.
+
+void MeshBoundaryValues::OutputCommMatrix() {
+  if (!comm_matrix) {return;}
+  int nranks = global_variable::nranks;
+  std::vector<std::int64_t> nmsg_all[ncomm_msg], nbyte_all[ncomm_msg];
+  for (int t=0; t<ncomm_msg; ++t) {
+    if (global_variable::my_rank == 0) {
+      nmsg_all[t].assign(static_cast<std::size_t>(nranks)*nranks, 0);
+      nbyte_all[t].assign(static_cast<std::size_t>(nranks)*nranks, 0);
+    }
+    MPI_Gather(comm_nmsg[t].data(), nranks, MPI_INT64_T,
+               nmsg_all[t].data(), nranks, MPI_INT64_T, 0, MPI_COMM_WORLD);
+    MPI_Gather(comm_nbyte[t].data(), nranks, MPI_INT64_T,
+               nbyte_all[t].data(), nranks, MPI_INT64_T, 0, MPI_COMM_WORLD);
+  }
+  if (global_variable::my_rank != 0) {return;}
+
+  std::cout << std::endl << "Communication matrix (totals over run):" << std::endl
+    << "  src  dst    vars_nmsg   vars_bytes    flux_nmsg   flux_bytes    coal_nmsg"
+    << "   coal_bytes" << std::endl;
+  for (int s=0; s<nranks; ++s) {
+    for (int d=0; d<nranks; ++d) {
+      std::size_t i = static_cast<std::size_t>(s)*nranks + d;
+      std::int64_t tot = 0;
+      for (int t=0; t<ncomm_msg; ++t) {tot += nmsg_all[t][i];}
+      if (tot == 0) {continue;}  // print only pairs that exchanged something
+      std::cout << std::setw(5) << s << std::setw(5) << d;
+      for (int t=0; t<ncomm_msg; ++t) {
+        std::cout << std::setw(13) << nmsg_all[t][i] << std::setw(13) << nbyte_all[t][i];
+      }
+      std::cout << std::endl;
+    }
+  }
+  return;
+}
+#endif
+
 //----------------------------------------------------------------------------------------
 // ParticlesBoundaryValues constructor:
 
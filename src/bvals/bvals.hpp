@@ -20,6 +20,7 @@ enum class BoundaryFlag {undef=-1,block, reflect, inflow, outflow, diode, user,
                          shear_periodic, vacuum};
 
 #include <algorithm>
+#include <cstdint>
 #include <vector>
 
 #include "athena.hpp"
@@ -75,34 +76,80 @@ struct MeshBoundaryBuffer {
   // Maximum number of data elements (bie-bis+1) across 3 components of above
   int isame_ndat, isame_z4c_ndat, icoar_ndat, ifine_ndat, iflxs_ndat, iflxc_ndat;
 
-  // 2D Views that store buffer data on device, dimensioned (nmb, ndata)
+  // number of data elements per MeshBlock in vars/flux, set by ComputeBufferSizes()
+  int vars_ncols=0, flux_ncols=0;
+
+  // 2D Views that store buffer data on device, dimensioned (nmb, ndata).  All buffers
+  // of one MeshBoundaryValues object are unmanaged windows into a single slab owned by
+  // that object (see AllocateBufferSlabs), so (re)allocation on regrid is one device
+  // allocation per physics module instead of one per buffer, and adjacent buffers are
+  // contiguous in memory
   DvceArray2D<Real> vars, flux;
 
 #if MPI_PARALLEL_ENABLED
   // vectors of length (number of MBs) to hold MPI requests
   // Using STL vector causes problems with some GPU compilers, so just use plain C array
   MPI_Request *vars_req, *flux_req;
+  // requests for the alternate plane of eager (double-buffered) receives, allocated for
+  // recv buffers only (<mesh>/eager_recv_bvals)
+  MPI_Request *vars_req_alt = nullptr;
+#if !(GPU_AWARE_MPI_ENABLED)
+  // pinned host staging copy of vars, used when MPI cannot access device buffers
+  StageArray2D<Real> vars_stage;
+  // alternate staging plane holding next-exchange messages in eager mode
+  StageArray2D<Real> vars_stage_alt;
+#endif
+  // single-precision wire copy of vars, allocated only with <z4c>/single_prec_bvals.
+  // Messages are converted to/from FP32 around the MPI calls; memory stays FP64
+  DvceArray2D<float> vars_sp;
+#if !(GPU_AWARE_MPI_ENABLED)
+  StageArray2D<float> vars_sp_stage;
+#endif
 #endif
 
-  // function to allocate memory for buffers for variables and their fluxes
-  // Must only be called after BufferIndcs above are initialized
-  void AllocateBuffers(int nmb, int nvars, bool is_z4c) {
+  // function to compute sizes of buffers for variables and their fluxes
+  // Must only be called after BufferIndcs above are initialized.  Storage itself is
+  // carved out of the per-object slabs by MeshBoundaryValues::AllocateBufferSlabs()
+  void ComputeBufferSizes(int nvars, bool is_z4c) {
     // With Z4c, buffers may contain BOTH same and coarse data
     if (is_z4c) {
       int nmax = std::max(isame_z4c_ndat, std::max(icoar_ndat, ifine_ndat) );
-      Kokkos::realloc(vars, nmb, (nvars*nmax));
+      vars_ncols = nvars*nmax;
     } else {
       int nmax = std::max(isame_ndat, std::max(icoar_ndat, ifine_ndat) );
-      Kokkos::realloc(vars, nmb, (nvars*nmax));
+      vars_ncols = nvars*nmax;
     }
     int nmax = std::max(iflxs_ndat, iflxc_ndat);
-    Kokkos::realloc(flux, nmb, (nvars*nmax));
+    flux_ncols = nvars*nmax;
   }
 };
 
 // Forward declarations
 class MeshBlockPack;
 
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \struct MeshCoalescedBuffer
+//! \brief contiguous storage and segment table for all boundary buffer data exchanged
+//! with one remote rank as a single MPI message (see <mesh>/coalesce_bvals).  Both ends
+//! of a rank pair order segments by the (local ID, buffer index) of the *receiving*
+//! MeshBlock, the same key used for MPI tags, so offsets agree without communication.
+
+struct MeshCoalescedBuffer {
+  int rank;                  // remote rank
+  int ndat;                  // total number of Reals in message
+  int nseg;                  // number of (MeshBlock, buffer) segments in message
+  int chunk;                 // Reals per MPI message (=ndat with GPU-aware MPI)
+  DvceArray1D<Real> data;    // contiguous message storage
+#if !(GPU_AWARE_MPI_ENABLED)
+  StageArray1D<Real> data_stage;  // pinned host staging copy of data
+#endif
+  // per-segment MeshBlock index, buffer index, offset into data, and length
+  DualArray1D<int> seg_m, seg_n, seg_offset, seg_size;
+  std::vector<MPI_Request> req;   // one request per chunk
+};
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \class MeshBoundaryValues
 //  \brief Abstract base class for boundary values for different kinds of Mesh variables
@@ -123,12 +170,101 @@ class MeshBoundaryValues {
 #if MPI_PARALLEL_ENABLED
   // unique MPI communicators for each case (variables/fluxes)
   MPI_Comm comm_vars, comm_flux;
+
+  // optional coalesced messaging: all variable buffers exchanged with a given remote
+  // rank are gathered into one message per rank pair each stage, cutting the message
+  // count from one per (MeshBlock, neighbor) pair to one per neighboring rank
+  bool coalesce;
+  std::vector<MeshCoalescedBuffer> coal_send, coal_recv;
+  void InitCoalescedBuffers(const int nvar);
+  TaskStatus SendCoalesced();
+  bool TestCoalescedRecvs();
+  void ScatterCoalescedRecvs();
+
+  // optional neighborhood-collective exchange: the coalesced per-rank messages are
+  // moved by a single MPI_Ineighbor_alltoallv over a distributed-graph communicator
+  // built from the (static between regrids) neighbor-rank lists, letting the MPI
+  // library schedule and combine the transfers.  Implies coalesce; the per-rank data
+  // Views alias slices of the concatenated arrays so gather/scatter are unchanged
+  bool neighbor_coll;
+  MPI_Comm comm_nbr = MPI_COMM_NULL;       // distributed-graph communicator
+  MPI_Request nbr_req = MPI_REQUEST_NULL;  // single request for the collective
+  DvceArray1D<Real> nbr_send_data, nbr_recv_data;  // concatenated per-rank messages
+#if !(GPU_AWARE_MPI_ENABLED)
+  StageArray1D<Real> nbr_send_stage, nbr_recv_stage;
+#endif
+  // per-neighbor-rank count/displacement tables passed to the collective
+  std::vector<int> nbr_scount, nbr_sdispl, nbr_rcount, nbr_rdispl;
+
+  // optional persistent MPI requests for variable messages: created once with
+  // MPI_Send_init/MPI_Recv_init and restarted each stage with MPI_Start, amortizing
+  // request setup on static meshes.  Rebuilt only when AMR/load balancing regrids
+  bool persistent;
+  void InitPersistentRequests(const int nvar);
+
+  // optional eager (double-buffered) receives: each InitRecv() also posts the receives
+  // for the *next* exchange into an alternate staging plane, so messages from ranks
+  // running a stage ahead always pre-match a posted receive instead of landing in the
+  // unexpected-message queue.  Matching stays in exchange order because MPI guarantees
+  // non-overtaking between a rank pair on one communicator and every exchange posts
+  // and sends the same buffer topology.  Requires the staged (non-GPU-aware)
+  // point-to-point path and a static MeshBlock distribution
+  bool eager_recv;
+  void PostVariableRecvs(const int nvar, const int plane);
+  int eager_plane_ = 0;        // staging plane receiving the current exchange
+  bool eager_posted_ = false;  // receives for the next exchange are already posted
+
+  // optional single-precision wire format for variable messages (Z4c only): ghost
+  // values feed high-order stencils whose truncation error exceeds FP32 rounding for
+  // smooth fields, so messages can be sent as FP32 while memory stays FP64, halving
+  // network volume.  Mutually exclusive with coalesced messaging/persistent requests
+  bool single_prec;
+
+  // optional communication-matrix telemetry (<mesh>/comm_matrix): counts messages and
+  // bytes this rank sends to every destination rank, kept separately for variable,
+  // flux-correction, and coalesced messages and summed over all MeshBoundaryValues
+  // objects (hence static).  CountMsg() is called where each send is posted, so the
+  // totals reflect exactly the traffic placed on the wire; OutputCommMatrix() gathers
+  // the per-destination rows to rank 0 and prints the (source, destination) matrix
+  enum CommMsgType {comm_msg_vars=0, comm_msg_flux=1, comm_msg_coal=2, ncomm_msg=3};
+  inline static bool comm_matrix = false;
+  inline static std::vector<std::int64_t> comm_nmsg[ncomm_msg], comm_nbyte[ncomm_msg];
+  static void CountMsg(const CommMsgType t, const int drank, const std::int64_t nbyte) {
+    comm_nmsg[t][drank] += 1;
+    comm_nbyte[t][drank] += nbyte;
+  }
+  static void OutputCommMatrix();
 #endif
 
+  // fused multi-physics exchange (see MeshBoundaryValuesCC::FuseCC): cell-centered
+  // variable sets owned by other physics modules appended to this object's messages.
+  // Pointers to the owning Views are stored so regrids that reallocate them are handled
+  static const int nfused_max = 4;
+  int nfused = 0;
+  int fused_nv[nfused_max];
+  DvceArray5D<Real> *fused_a[nfused_max], *fused_ca[nfused_max];
+  bool fused_into = false;  // send/recv/clear become no-ops; another exchange carries us
+  int FusedNvar() const {
+    int nv = 0;
+    for (int f=0; f<nfused; ++f) {nv += fused_nv[f];}
+    return nv;
+  }
+
+  // flat work-item lists of (MeshBlock, buffer) pairs with a coarser neighbor (needing
+  // prolongation) and with a same-level neighbor (needing restriction of boundary data
+  // into the coarse array).  Built once and reused every exchange, so the prolongation
+  // kernels launch exactly the work that exists instead of scanning and discarding all
+  // (MeshBlock, buffer) pairs on device; rebuilt only when AMR/load balancing regrids
+  int nprol = 0, nsame = 0;
+  DualArray1D<int> prol_m, prol_n;
+  DualArray1D<int> same_m, same_n;
+  void InitProlongIndices();
+
   //functions
   virtual void InitSendIndices(MeshBoundaryBuffer &buf,int x,int y,int z,int a,int b)=0;
   virtual void InitRecvIndices(MeshBoundaryBuffer &buf,int x,int y,int z,int a,int b)=0;
   void InitializeBuffers(const int nvar);
+  void AllocateBufferSlabs(const int nmb);
 
   TaskStatus InitRecv(const int nvar);
   virtual TaskStatus InitFluxRecv(const int nvar)=0;
@@ -148,7 +284,29 @@ class MeshBoundaryValues {
   // must use pointer to MBPack and not parent physics module since parent can be one of
   // many types (Hydro, MHD, Radiation, Z4c, etc.)
   MeshBlockPack* pmy_pack;
+  // slabs backing the vars/flux storage of all 112 send/recv buffers above; each
+  // buffer's Views are unmanaged windows into these (see AllocateBufferSlabs)
+  DvceArray1D<Real> buf_slab_;
+#if MPI_PARALLEL_ENABLED
+#if !(GPU_AWARE_MPI_ENABLED)
+  StageArray1D<Real> buf_slab_stage_;       // pinned host copies of vars windows
+  StageArray1D<Real> buf_slab_stage_alt_;   // alternate recv plane for eager receives
+  StageArray1D<float> buf_slab_sp_stage_;   // ditto for the FP32 wire copies
+#endif
+  DvceArray1D<float> buf_slab_sp_;          // FP32 wire copies, only with single_prec
+#endif
   bool is_z4c_;   // flag to denote if this BoundaryValues is for Z4c module
+  int nvar_base_; // nvar passed to InitializeBuffers(), excluding fused variable sets
+  int prol_mesh_gen_ = -1;   // mesh generation stamp at build of prolongation lists
+#if MPI_PARALLEL_ENABLED
+  int coal_nvar_ = -1;       // nvar used to build coalesced buffers (-1 = not built)
+  int coal_mesh_gen_ = -1;   // mesh generation stamp at build (AMR invalidates buffers)
+  int pers_nvar_ = -1;       // nvar used to build persistent requests (-1 = not built)
+  int pers_mesh_gen_ = -1;   // mesh generation stamp at build (AMR invalidates requests)
+#if !(GPU_AWARE_MPI_ENABLED)
+  int stage_chunk_;          // Reals per chunk when staging through pinned host memory
+#endif
+#endif
 };
 
 //----------------------------------------------------------------------------------------
@@ -157,16 +315,60 @@ class MeshBoundaryValues {
 
 class MeshBoundaryValuesCC : public MeshBoundaryValues {
  public:
-  MeshBoundaryValuesCC(MeshBlockPack *ppack, ParameterInput *pin, bool z4c);
+  MeshBoundaryValuesCC(MeshBlockPack *ppack, ParameterInput *pin, bool z4c,
+                       int ngc = -1);
+
+  // ghost depth exchanged with same-level neighbors.  Defaults to mb_indcs.ng, but a
+  // physics module whose stencils need fewer ghost cells than the mesh-wide width
+  // (e.g. PLM fluid coupled to Z4c, which forces nghost=4) can pass a smaller value
+  // to shrink its buffers and message volume.  Ghost cells beyond this depth are
+  // never updated by the exchange, so it must cover the widest stencil applied to
+  // these variables; fused variable sets (FuseCC) ride the carrier's width.  Only
+  // same-level exchanges are reduced, so this requires a uniform (single-level) grid
+  int ng_comm;
 
   //functions
   void InitSendIndices(MeshBoundaryBuffer &b,int o1,int o2,int o3,int f1,int f2) override;
   void InitRecvIndices(MeshBoundaryBuffer &b,int o1,int o2,int o3,int f1,int f2) override;
   TaskStatus InitFluxRecv(const int nvar) override;
 
-  // functions to communicate CC data
+  // flat tile queues for the pack/unpack kernels: boundary buffers range from short
+  // corner strips to full-face slabs, so one team per (MeshBlock, buffer, variable)
+  // leaves corner teams idle while face teams work.  Each tile covers up to tile_ncell
+  // cells of one (MeshBlock, buffer) pair, giving every team (nearly) equal work.
+  // Separate queues hold same-rank pairs (ghost cells filled directly), off-rank pairs
+  // on the send side, and off-rank pairs on the recv side; rebuilt only when AMR or
+  // load balancing regrids
+  static const int tile_ncell = 256;
+  int ncopy_tiles = 0, npack_tiles = 0, nunpk_tiles = 0;
+  DualArray1D<int> copy_tile_m, copy_tile_n, copy_tile_c;
+  DualArray1D<int> pack_tile_m, pack_tile_n, pack_tile_c;
+  DualArray1D<int> unpk_tile_m, unpk_tile_n, unpk_tile_c;
+  void InitTileQueues();
+
+  // optional per-face variable masking (see SetFaceVarMasksCC): same-level face buffers
+  // carry only the subset of variables the receiving MeshBlock consumes from that
+  // direction, e.g. the hemisphere of angles propagating across the face for radiation
+  // intensities.  Edge, corner, and coarse/fine buffers always carry every variable.
+  // Send-side lists are copied or received from each receiving MeshBlock, so both ends
+  // of a message agree on its (shortened) length and layout
+  bool vmask = false;
+  DualArray2D<int> vmask_send_nv, vmask_recv_nv;  // (nmb,nnghbr) variables per buffer
+  DualArray3D<int> vmask_send_v, vmask_recv_v;    // (nmb,nnghbr,nvar) packed var lists
+  void SetFaceVarMasksCC(const DualArray3D<bool> &needed);
+
+  // functions to communicate CC data.  The workers are templated over the multilevel
+  // flag (like the rsolver template in Hydro::CalculateFluxes) so that unigrid runs
+  // execute kernels with all level-comparison branches and coarse-array transfers
+  // compiled out; the untemplated versions dispatch on pmesh->multilevel
+  TaskStatus PackAndSendCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+  TaskStatus RecvAndUnpackCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+  template <bool multilevel_>
   TaskStatus PackAndSendCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+  template <bool multilevel_>
   TaskStatus RecvAndUnpackCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+  // fuse another module's CC variable exchange into this object's messages
+  void FuseCC(DvceArray5D<Real> *a, DvceArray5D<Real> *ca, MeshBoundaryValues *follower);
   // functions to communicate fluxes of CC data
   TaskStatus PackAndSendFluxCC(DvceFaceFld5D<Real> &flx);
   TaskStatus RecvAndUnpackFluxCC(DvceFaceFld5D<Real> &flx);
@@ -181,6 +383,9 @@ class MeshBoundaryValuesCC : public MeshBoundaryValues {
                              DvceArray5D<Real> &prim);
   void PrimToConsFineBndry(const DvceArray5D<Real> &prim, const DvceFaceFld4D<Real> &b,
                            DvceArray5D<Real> &cons);
+
+ protected:
+  int tile_mesh_gen_ = -1;   // mesh generation stamp at build of tile queues
 };
 
 //----------------------------------------------------------------------------------------
@@ -253,6 +458,11 @@ class ParticlesBoundaryValues {
 
   int nprtcl_send, nprtcl_recv;
   DualArray1D<ParticleLocationData> sendlist;
+  // counters of consecutive steps each buffer was mostly empty, used to decide when the
+  // grow-only capacities may shrink (see EnsureCapacity in bvals_part.cpp)
+  int sendlist_nsmall=0;
+  int rsendbuf_nsmall=0, rrecvbuf_nsmall=0;
+  int isendbuf_nsmall=0, irecvbuf_nsmall=0;
 
   // Data needed to count number of messages and particles to send between ranks
   int nsends; // number of MPI sends to neighboring ranks on this rank
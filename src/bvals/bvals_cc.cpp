@@ -8,9 +8,11 @@
 //! Mesh variables.
 //! Prolongation of CC variables  occurs in ProlongateCC() function called from task list
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -22,8 +24,138 @@
 // BValCC constructor:
 
 MeshBoundaryValuesCC::MeshBoundaryValuesCC(MeshBlockPack *pp, ParameterInput *pin,
-                                           bool z4c) :
+                                           bool z4c, int ngc) :
   MeshBoundaryValues(pp, pin, z4c) {
+  int ng = pp->pmesh->mb_indcs.ng;
+  ng_comm = (ngc < 0)? ng : ngc;
+  if (ng_comm < 1 || ng_comm > ng) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Communicated ghost width nghost_comm=" << ng_comm
+              << " must satisfy 1 <= nghost_comm <= nghost=" << ng << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  if ((ng_comm != ng) && (pp->pmesh->multilevel)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Reduced ghost width nghost_comm=" << ng_comm
+              << " only supported on uniform (single-level) grids" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+namespace {
+// number of cells per variable spanned by a buffer index range
+int NCells(const MeshBufferIndcs &bi) {
+  return (bi.bie - bi.bis + 1)*(bi.bje - bi.bjs + 1)*(bi.bke - bi.bks + 1);
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValuesCC::InitTileQueues()
+//! \brief builds the flat tile queues consumed by the pack/unpack kernels.  Boundary
+//! buffers range from short corner strips to full-face slabs, so assigning one team per
+//! (MeshBlock, buffer, variable) leaves corner teams idle while face teams work; here
+//! each buffer is cut into tiles of (at most) tile_ncell cells so every team carries
+//! (nearly) equal work.  Called lazily at the start of the pack/unpack functions;
+//! rebuilt only when AMR or load balancing changes the MeshBlock distribution.
+
+void MeshBoundaryValuesCC::InitTileQueues() {
+  int gen = 0;
+  if (pmy_pack->pmesh->pmr != nullptr) {
+    gen = pmy_pack->pmesh->pmr->nmb_created + pmy_pack->pmesh->pmr->nmb_deleted
+        + pmy_pack->pmesh->pmr->nmb_sent_thisrank;
+  }
+  if (gen == tile_mesh_gen_) {return;}
+  tile_mesh_gen_ = gen;
+
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  int my_rank = global_variable::my_rank;
+
+  // two passes over all (MeshBlock, buffer) pairs: count tiles, then fill the queues
+  for (int pass=0; pass<2; ++pass) {
+    if (pass == 1) {
+      Kokkos::realloc(copy_tile_m, ncopy_tiles);
+      Kokkos::realloc(copy_tile_n, ncopy_tiles);
+      Kokkos::realloc(copy_tile_c, ncopy_tiles);
+      Kokkos::realloc(pack_tile_m, npack_tiles);
+      Kokkos::realloc(pack_tile_n, npack_tiles);
+      Kokkos::realloc(pack_tile_c, npack_tiles);
+      Kokkos::realloc(unpk_tile_m, nunpk_tiles);
+      Kokkos::realloc(unpk_tile_n, nunpk_tiles);
+      Kokkos::realloc(unpk_tile_c, nunpk_tiles);
+    }
+    ncopy_tiles = 0;
+    npack_tiles = 0;
+    nunpk_tiles = 0;
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<nnghbr; ++n) {
+        if (nghbr.h_view(m,n).gid < 0) {continue;}
+        // per-variable cell counts of the send and recv ranges of this pair, selected
+        // by the relative level of the neighbor exactly as in the kernels
+        int scell, rcell;
+        if (nghbr.h_view(m,n).lev < mblev.h_view(m)) {
+          scell = NCells(sendbuf[n].icoar[0]);
+          rcell = NCells(recvbuf[n].icoar[0]);
+        } else if (nghbr.h_view(m,n).lev == mblev.h_view(m)) {
+          scell = NCells(sendbuf[n].isame[0]);
+          rcell = NCells(recvbuf[n].isame[0]);
+        } else {
+          scell = NCells(sendbuf[n].ifine[0]);
+          rcell = NCells(recvbuf[n].ifine[0]);
+        }
+        if (nghbr.h_view(m,n).rank == my_rank) {
+          // same-rank pairs: ghost cells are filled directly from the source arrays
+          for (int c=0; c<scell; c+=tile_ncell) {
+            if (pass == 1) {
+              copy_tile_m.h_view(ncopy_tiles) = m;
+              copy_tile_n.h_view(ncopy_tiles) = n;
+              copy_tile_c.h_view(ncopy_tiles) = c;
+            }
+            ++ncopy_tiles;
+          }
+        } else {
+          // off-rank pairs: send buffers are packed and recv buffers unpacked
+          for (int c=0; c<scell; c+=tile_ncell) {
+            if (pass == 1) {
+              pack_tile_m.h_view(npack_tiles) = m;
+              pack_tile_n.h_view(npack_tiles) = n;
+              pack_tile_c.h_view(npack_tiles) = c;
+            }
+            ++npack_tiles;
+          }
+          for (int c=0; c<rcell; c+=tile_ncell) {
+            if (pass == 1) {
+              unpk_tile_m.h_view(nunpk_tiles) = m;
+              unpk_tile_n.h_view(nunpk_tiles) = n;
+              unpk_tile_c.h_view(nunpk_tiles) = c;
+            }
+            ++nunpk_tiles;
+          }
+        }
+      }
+    }
+  }
+  copy_tile_m.template modify<HostMemSpace>();
+  copy_tile_n.template modify<HostMemSpace>();
+  copy_tile_c.template modify<HostMemSpace>();
+  pack_tile_m.template modify<HostMemSpace>();
+  pack_tile_n.template modify<HostMemSpace>();
+  pack_tile_c.template modify<HostMemSpace>();
+  unpk_tile_m.template modify<HostMemSpace>();
+  unpk_tile_n.template modify<HostMemSpace>();
+  unpk_tile_c.template modify<HostMemSpace>();
+  copy_tile_m.template sync<DevExeSpace>();
+  copy_tile_n.template sync<DevExeSpace>();
+  copy_tile_c.template sync<DevExeSpace>();
+  pack_tile_m.template sync<DevExeSpace>();
+  pack_tile_n.template sync<DevExeSpace>();
+  pack_tile_c.template sync<DevExeSpace>();
+  unpk_tile_m.template sync<DevExeSpace>();
+  unpk_tile_n.template sync<DevExeSpace>();
+  unpk_tile_c.template sync<DevExeSpace>();
+  return;
 }
 
 //----------------------------------------------------------------------------------------
@@ -32,19 +164,54 @@ MeshBoundaryValuesCC::MeshBoundaryValuesCC(MeshBlockPack *pp, ParameterInput *pi
 //!
 //! This routine packs ALL the buffers on ALL the faces, edges, and corners simultaneously
 //! for ALL the MeshBlocks. This reduces the number of kernel launches when there are a
-//! large number of MeshBlocks per MPI rank. Buffer data are then sent (via MPI) or copied
-//! directly for periodic or block boundaries.
+//! large number of MeshBlocks per MPI rank. Buffer data are sent via MPI to off-rank
+//! neighbors; ghost cells of same-rank neighbors are filled directly in the packing
+//! kernel (zero-copy), bypassing the boundary buffers entirely.
 //!
 //! Input arrays must be 5D Kokkos View dimensioned (nmb, nvar, nx3, nx2, nx1)
 //! 5D Kokkos View of coarsened (restricted) array data also required with SMR/AMR
+//!
+//! The worker is templated over the multilevel flag; the unigrid instantiation folds
+//! every level comparison to the same-level branch so the kernels are compiled without
+//! refinement machinery or coarse-array traffic.  The untemplated version dispatches.
 
 TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
                                                DvceArray5D<Real> &ca) {
+  if (pmy_pack->pmesh->multilevel) {
+    return PackAndSendCC<true>(a, ca);
+  }
+  return PackAndSendCC<false>(a, ca);
+}
+
+template <bool multilevel_>
+TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
+                                               DvceArray5D<Real> &ca) {
+  // do nothing when this object's messages are carried by another exchange (FuseCC)
+  if (fused_into) {return TaskStatus::complete;}
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
   int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
 
+  // fused exchange: variable sets registered by other physics modules are appended to
+  // each message, indexed by flattened variable v in [nvar, nvtot)
+  int nvtot = nvar;
+  Kokkos::Array<DvceArray5D<Real>, nfused_max> f_a, f_ca;
+  Kokkos::Array<int, nfused_max> f_vs;
+  for (int f=0; f<nfused; ++f) {
+    f_a[f] = *(fused_a[f]);
+    f_ca[f] = *(fused_ca[f]);
+    f_vs[f] = nvtot;
+    nvtot += fused_nv[f];
+  }
+  const int nf = nfused;
+
+  // build (or reuse) the flat tile queues: each team below handles one tile of up to
+  // tile_ncell cells of one (MeshBlock, buffer) pair for one variable, so teams carry
+  // (nearly) equal work whether the buffer is a corner strip or a full-face slab
+  InitTileQueues();
+
   {int my_rank = global_variable::my_rank;
   auto &nghbr = pmy_pack->pmb->nghbr;
   auto &mbgid = pmy_pack->pmb->mb_gid;
@@ -52,35 +219,175 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
   auto &sbuf = sendbuf;
   auto &rbuf = recvbuf;
   auto &is_z4c = is_z4c_;
-  auto &multilevel = pmy_pack->pmesh->multilevel;
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-  int nmnv = nmb*nnghbr*nvar;
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
+  int nmnv = nmb*nnghbr*nvtot;
+  const int tile = tile_ncell;
+
+  // with face masking active, each buffer carries only its packed variable list
+  const bool vm = vmask;
+  auto &vm_snv = vmask_send_nv;
+  auto &vm_sv = vmask_send_v;
+
+  // Outer loop over (# of same-rank tiles)*(# of variables)
+  if (ncopy_tiles > 0) {
+  auto &cp_m = copy_tile_m;
+  auto &cp_n = copy_tile_n;
+  auto &cp_c = copy_tile_c;
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), (ncopy_tiles*nvtot), Kokkos::AUTO);
   Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
+    const int p = (tmember.league_rank())/nvtot;
+    const int v = (tmember.league_rank() - p*nvtot);
+    const int m = cp_m.d_view(p);
+    const int n = cp_n.d_view(p);
+    const int c0 = cp_c.d_view(p);
 
-    // only load buffers when neighbor exists
-    if (nghbr.d_view(m,n).gid >= 0) {
-      // if neighbor is at coarser level, use coar indices to pack buffer
+    // with face masking, v indexes this buffer's packed variable list; teams beyond
+    // the list (the excluded variables) have no work.  Masking excludes fused sets
+    if (vm && (v >= vm_snv.d_view(m,n))) {return;}
+
+    // map flattened v to source array and component: v >= nvar indexes a fused set
+    DvceArray5D<Real> av = a, cav = ca;
+    int vl = (vm)? vm_sv.d_view(m,n,v) : v;
+    for (int f=0; f<nf; ++f) {
+      if (v >= f_vs[f]) {av = f_a[f]; cav = f_ca[f]; vl = v - f_vs[f];}
+    }
+
+    // select source cell ranges by relative level of neighbor.  multilevel_ is a
+    // compile-time constant, so in the unigrid instantiation all comparisons below
+    // fold to the same-level branch and the others are eliminated
+    int il, iu, jl, ju, kl, ku;
+    if (multilevel_ && (nghbr.d_view(m,n).lev < mblev.d_view(m))) {
+      il = sbuf[n].icoar[0].bis;
+      iu = sbuf[n].icoar[0].bie;
+      jl = sbuf[n].icoar[0].bjs;
+      ju = sbuf[n].icoar[0].bje;
+      kl = sbuf[n].icoar[0].bks;
+      ku = sbuf[n].icoar[0].bke;
+    } else if (!(multilevel_) || (nghbr.d_view(m,n).lev == mblev.d_view(m))) {
+      il = sbuf[n].isame[0].bis;
+      iu = sbuf[n].isame[0].bie;
+      jl = sbuf[n].isame[0].bjs;
+      ju = sbuf[n].isame[0].bje;
+      kl = sbuf[n].isame[0].bks;
+      ku = sbuf[n].isame[0].bke;
+    } else {
+      il = sbuf[n].ifine[0].bis;
+      iu = sbuf[n].ifine[0].bie;
+      jl = sbuf[n].ifine[0].bjs;
+      ju = sbuf[n].ifine[0].bje;
+      kl = sbuf[n].ifine[0].bks;
+      ku = sbuf[n].ifine[0].bke;
+    }
+    int ni = iu - il + 1;
+    int nj = ju - jl + 1;
+    int nk = ku - kl + 1;
+    // last tile of each (MeshBlock, buffer) pair may cover fewer than tile cells
+    int tsize = ni*nj*nk - c0;
+    if (tsize > tile) {tsize = tile;}
+
+    // indices of recv'ing (destination) MB and buffer: MB IDs are stored sequentially
+    // in MeshBlockPacks, so array index equals (target_id - first_id)
+    int dm = nghbr.d_view(m,n).gid - mbgid.d_view(0);
+    int dn = nghbr.d_view(m,n).dest;
+
+    // starting indices of destination ghost cells, selected from the receiving block's
+    // point of view: it sees this block as finer/same/coarser when this block's level
+    // is greater-than/equal-to/less-than its own
+    int dil, djl, dkl;
+    if (multilevel_ && (nghbr.d_view(m,n).lev < mblev.d_view(m))) {
+      dil = rbuf[dn].ifine[0].bis;
+      djl = rbuf[dn].ifine[0].bjs;
+      dkl = rbuf[dn].ifine[0].bks;
+    } else if (!(multilevel_) || (nghbr.d_view(m,n).lev == mblev.d_view(m))) {
+      dil = rbuf[dn].isame[0].bis;
+      djl = rbuf[dn].isame[0].bjs;
+      dkl = rbuf[dn].isame[0].bks;
+    } else {
+      dil = rbuf[dn].icoar[0].bis;
+      djl = rbuf[dn].icoar[0].bjs;
+      dkl = rbuf[dn].icoar[0].bks;
+    }
+
+    // Inner loop over cells of this tile.  Destination ghost cells are filled directly
+    // (the queue holds only same-rank pairs), bypassing the pack/unpack buffers;
+    // buffers for off-rank neighbors are packed in a separate kernel below
+    // if neighbor is at same level, copy u0 into its ghost zones of u0
+    if (!(multilevel_) || (nghbr.d_view(m,n).lev == mblev.d_view(m))) {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(tmember, tsize), [&](const int t) {
+        int c = c0 + t;
+        int i = il + c%ni;
+        int j = jl + (c/ni)%nj;
+        int k = kl + c/(ni*nj);
+        av(dm, vl, dkl+(k-kl), djl+(j-jl), dil+(i-il)) = av(m,vl,k,j,i);
+      });
+    // if neighbor is at finer level, copy u0 into its coarse_u0 for prolongation
+    } else if (nghbr.d_view(m,n).lev > mblev.d_view(m)) {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(tmember, tsize), [&](const int t) {
+        int c = c0 + t;
+        int i = il + c%ni;
+        int j = jl + (c/ni)%nj;
+        int k = kl + c/(ni*nj);
+        cav(dm, vl, dkl+(k-kl), djl+(j-jl), dil+(i-il)) = av(m,vl,k,j,i);
+      });
+    // if neighbor is at coarser level, copy restricted coarse_u0 into its u0
+    } else {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(tmember, tsize), [&](const int t) {
+        int c = c0 + t;
+        int i = il + c%ni;
+        int j = jl + (c/ni)%nj;
+        int k = kl + c/(ni*nj);
+        av(dm, vl, dkl+(k-kl), djl+(j-jl), dil+(i-il)) = cav(m,vl,k,j,i);
+      });
+    }
+  }); // end par_for_outer
+  }
+
+#if MPI_PARALLEL_ENABLED
+  // Pack send buffers for off-rank neighbors on the comm stream; the tile queue holds
+  // only off-rank (MeshBlock, buffer) pairs.  Fence the default instance first so
+  // writes to input arrays are visible to the comm stream; the comm stream itself is
+  // fenced below before the MPI sends are posted, so kernels submitted to the default
+  // instance by subsequent tasks overlap with this packing and the sends.
+  Kokkos::fence();
+  if (npack_tiles > 0) {
+    auto &pk_m = pack_tile_m;
+    auto &pk_n = pack_tile_n;
+    auto &pk_c = pack_tile_c;
+    Kokkos::TeamPolicy<> policy_b(pmy_pack->exec_comm, (npack_tiles*nvtot),
+                                  Kokkos::AUTO);
+    Kokkos::parallel_for("SendBuff_mpi", policy_b, KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int p = (tmember.league_rank())/nvtot;
+      const int v = (tmember.league_rank() - p*nvtot);
+      const int m = pk_m.d_view(p);
+      const int n = pk_n.d_view(p);
+      const int c0 = pk_c.d_view(p);
+
+      // with face masking, v indexes this buffer's packed variable list; teams beyond
+      // the list have no work, and the message below shrinks to match
+      if (vm && (v >= vm_snv.d_view(m,n))) {return;}
+
+      // map flattened v to source array and component: v >= nvar indexes a fused set
+      DvceArray5D<Real> av = a, cav = ca;
+      int vl = (vm)? vm_sv.d_view(m,n,v) : v;
+      for (int f=0; f<nf; ++f) {
+        if (v >= f_vs[f]) {av = f_a[f]; cav = f_ca[f]; vl = v - f_vs[f];}
+      }
+
+      // select pack indices based on relative level of neighbor, as above
       int il, iu, jl, ju, kl, ku;
-      if (nghbr.d_view(m,n).lev < mblev.d_view(m)) {
+      if (multilevel_ && (nghbr.d_view(m,n).lev < mblev.d_view(m))) {
         il = sbuf[n].icoar[0].bis;
         iu = sbuf[n].icoar[0].bie;
         jl = sbuf[n].icoar[0].bjs;
         ju = sbuf[n].icoar[0].bje;
         kl = sbuf[n].icoar[0].bks;
         ku = sbuf[n].icoar[0].bke;
-      // if neighbor is at same level, use same indices to pack buffer
-      } else if (nghbr.d_view(m,n).lev == mblev.d_view(m)) {
+      } else if (!(multilevel_) || (nghbr.d_view(m,n).lev == mblev.d_view(m))) {
         il = sbuf[n].isame[0].bis;
         iu = sbuf[n].isame[0].bie;
         jl = sbuf[n].isame[0].bjs;
         ju = sbuf[n].isame[0].bje;
         kl = sbuf[n].isame[0].bks;
         ku = sbuf[n].isame[0].bke;
-      // if neighbor is at finer level, use fine indices to pack buffer
       } else {
         il = sbuf[n].ifine[0].bis;
         iu = sbuf[n].ifine[0].bie;
@@ -92,73 +399,58 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
       int ni = iu - il + 1;
       int nj = ju - jl + 1;
       int nk = ku - kl + 1;
-      int nkj  = nk*nj;
-
-      // indices of recv'ing (destination) MB and buffer: MB IDs are stored sequentially
-      // in MeshBlockPacks, so array index equals (target_id - first_id)
-      int dm = nghbr.d_view(m,n).gid - mbgid.d_view(0);
-      int dn = nghbr.d_view(m,n).dest;
-
-      // Middle loop over k,j
-      Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
-        int k = idx / nj;
-        int j = (idx - k * nj) + jl;
-        k += kl;
-
-        // Inner (vector) loop over i
-        // copy directly into recv buffer if MeshBlocks on same rank
-
-        if (nghbr.d_view(m,n).rank == my_rank) {
-          // if neighbor is at same or finer level, load data from u0
-          if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              rbuf[dn].vars(dm, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = a(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          // if neighbor is at coarser level, load data from coarse_u0
-          } else {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              rbuf[dn].vars(dm, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = ca(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          }
+      // flattened cell index c below equals the per-variable buffer offset, so the
+      // buffer layout (i-il + ni*(j-jl + nj*(k-kl + nk*v))) is written as c + ndat*v
+      int ndat = ni*nj*nk;
+      int tsize = ndat - c0;
+      if (tsize > tile) {tsize = tile;}
 
-        // else copy into send buffer for MPI communication below
-
-        } else {
-          // if neighbor is at same or finer level, load data from u0
-          if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              sbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = a(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          // if neighbor is at coarser level, load data from coarse_u0
-          } else {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              sbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = ca(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          }
-        }
-      });
-    } // end if-neighbor-exists block
-  }); // end par_for_outer
+      // Inner loop over cells of this tile
+      // if neighbor is at same or finer level, load data from u0
+      if (!(multilevel_) || (nghbr.d_view(m,n).lev >= mblev.d_view(m))) {
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(tmember, tsize), [&](const int t) {
+          int c = c0 + t;
+          int i = il + c%ni;
+          int j = jl + (c/ni)%nj;
+          int k = kl + c/(ni*nj);
+          sbuf[n].vars(m, (c + ndat*v)) = av(m,vl,k,j,i);
+        });
+      // if neighbor is at coarser level, load data from coarse_u0
+      } else {
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(tmember, tsize), [&](const int t) {
+          int c = c0 + t;
+          int i = il + c%ni;
+          int j = jl + (c/ni)%nj;
+          int k = kl + c/(ni*nj);
+          sbuf[n].vars(m, (c + ndat*v)) = cav(m,vl,k,j,i);
+        });
+      }
+    }); // end par_for_outer
+  }
+#endif
 
-  Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
+  // Z4c appendix kernel below writes both same-rank recv buffers and MPI send buffers,
+  // so in MPI builds it runs on the comm stream (fenced above and before sends below).
+  // The appendix only exists with SMR/AMR; the launch folds away when unigrid
+  if (multilevel_) {
+#if MPI_PARALLEL_ENABLED
+  Kokkos::TeamPolicy<> policy_z(pmy_pack->exec_comm, nmnv, Kokkos::AUTO);
+#else
+  Kokkos::TeamPolicy<> policy_z(DevExeSpace(), nmnv, Kokkos::AUTO);
+#endif
+  Kokkos::parallel_for("SendBuff", policy_z, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    // decode with nvtot so league index stays in range (Z4c is never fused, so
+    // nvtot == nvar whenever this kernel actually has work to do)
+    const int m = (tmember.league_rank())/(nnghbr*nvtot);
+    const int n = (tmember.league_rank() - m*(nnghbr*nvtot))/nvtot;
+    const int v = (tmember.league_rank() - m*(nnghbr*nvtot) - n*nvtot);
 
     // only load buffers when neighbor exists
     if (nghbr.d_view(m,n).gid >= 0) {
       int il, iu, jl, ju, kl, ku;
       // If neighbor is at same level and data is for Z4c module, append data from coarse
       // array for higher-order prolongation
-      if ((nghbr.d_view(m,n).lev == mblev.d_view(m)) && (is_z4c) && (multilevel)) {
+      if ((nghbr.d_view(m,n).lev == mblev.d_view(m)) && (is_z4c)) {
         il = sbuf[n].isame_z4c.bis;
         iu = sbuf[n].isame_z4c.bie;
         jl = sbuf[n].isame_z4c.bjs;
@@ -176,6 +468,11 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
         int dm = nghbr.d_view(m,n).gid - mbgid.d_view(0);
         int dn = nghbr.d_view(m,n).dest;
 
+        // starting indices of destination ghost cells in coarse array
+        int dil = rbuf[dn].isame_z4c.bis;
+        int djl = rbuf[dn].isame_z4c.bjs;
+        int dkl = rbuf[dn].isame_z4c.bks;
+
         // Middle loop over k,j
         Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
           int k = idx / nj;
@@ -183,12 +480,12 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
           k += kl;
 
           // Inner (vector) loop over i
-          // copy directly into recv buffer if MeshBlocks on same rank
+          // fill destination coarse array directly if MeshBlocks on same rank
           if (nghbr.d_view(m,n).rank == my_rank) {
             // load data from coarse_u0
             Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
             [&](const int i) {
-              rbuf[dn].vars(dm,ndat+ (i-il + ni*(j-jl + nj*(k-kl + nk*v))))=ca(m,v,k,j,i);
+              ca(dm, v, dkl+(k-kl), djl+(j-jl), dil+(i-il)) = ca(m,v,k,j,i);
             });
             tmember.team_barrier();
 
@@ -205,11 +502,35 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
       }
     } // end if-neighbor-exists block
   }); // end par_for_outer
+  }  // end if multilevel_
   }
 
 #if MPI_PARALLEL_ENABLED
-  // Send boundary buffer to neighboring MeshBlocks using MPI
-  Kokkos::fence();
+  // with coalesced messaging, gather buffers and send one message per remote rank;
+  // the gather kernel is stream-ordered after the packing kernels on the comm stream
+  if (coalesce) {
+    return SendCoalesced();
+  }
+
+  // with the single-precision wire format, demote packed messages to the FP32 mirror
+  // buffers.  Runs on the comm stream so it is ordered after the packing kernels and
+  // covered by the fence below
+  if (single_prec) {
+    Kokkos::TeamPolicy<> policy_sp(pmy_pack->exec_comm, (nmb*nnghbr), Kokkos::AUTO);
+    Kokkos::parallel_for("SendBuffSP", policy_sp, KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int m = (tmember.league_rank())/nnghbr;
+      const int n = (tmember.league_rank() - m*nnghbr);
+      const int ndat = sbuf[n].vars.extent_int(1);
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(tmember, ndat), [&](const int i) {
+        sbuf[n].vars_sp(m,i) = static_cast<float>(sbuf[n].vars(m,i));
+      });
+    });
+  }
+
+  // Send boundary buffer to neighboring MeshBlocks using MPI.  Only the comm stream
+  // (which packed the send buffers) needs to be fenced here; same-rank copies on the
+  // default instance are ordered with their consumers by stream order
+  pmy_pack->exec_comm.fence();
   auto &is_z4c = is_z4c_;
   int my_rank = global_variable::my_rank;
   auto &nghbr = pmy_pack->pmb->nghbr;
@@ -225,11 +546,15 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
           int lid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
           int tag = CreateBvals_MPI_Tag(lid, dn);
 
-          // get ptr to send buffer when neighbor is at coarser/same/fine level
-          int data_size = nvar;
-          if ( nghbr.h_view(m,n).lev < pmy_pack->pmb->mb_lev.h_view(m) ) {
+          // get ptr to send buffer when neighbor is at coarser/same/fine level.  With
+          // face masking the message carries only this buffer's packed variable list;
+          // the posted receive is unchanged since its size is a maximum count
+          int data_size = (vmask)? vmask_send_nv.h_view(m,n) : nvtot;
+          if ( multilevel_ &&
+               (nghbr.h_view(m,n).lev < pmy_pack->pmb->mb_lev.h_view(m)) ) {
             data_size *= sendbuf[n].icoar_ndat;
-          } else if ( nghbr.h_view(m,n).lev == pmy_pack->pmb->mb_lev.h_view(m) ) {
+          } else if ( !(multilevel_) ||
+                      (nghbr.h_view(m,n).lev == pmy_pack->pmb->mb_lev.h_view(m)) ) {
             if (is_z4c) {
               data_size *= sendbuf[n].isame_z4c_ndat;
             } else {
@@ -238,11 +563,41 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
           } else {
             data_size *= sendbuf[n].ifine_ndat;
           }
-          auto send_ptr = Kokkos::subview(sendbuf[n].vars, m, Kokkos::ALL);
-
-          int ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
+          int ierr;
+          if (single_prec) {
+            // single-precision wire format: send the FP32 mirror filled above.  The
+            // element count is unchanged; only the MPI datatype (and bytes) shrink
+#if GPU_AWARE_MPI_ENABLED
+            auto send_ptr = Kokkos::subview(sendbuf[n].vars_sp, m, Kokkos::ALL);
+#else
+            auto rng = std::make_pair(0, data_size);
+            auto send_ptr = Kokkos::subview(sendbuf[n].vars_sp_stage, m, rng);
+            Kokkos::deep_copy(send_ptr, Kokkos::subview(sendbuf[n].vars_sp, m, rng));
+#endif
+            ierr = MPI_Isend(send_ptr.data(), data_size, MPI_FLOAT, drank, tag,
+                             comm_vars, &(sendbuf[n].vars_req[m]));
+          } else {
+#if GPU_AWARE_MPI_ENABLED
+            auto send_ptr = Kokkos::subview(sendbuf[n].vars, m, Kokkos::ALL);
+#else
+            // stage message through pinned host memory when MPI cannot access device
+            auto rng = std::make_pair(0, data_size);
+            auto send_ptr = Kokkos::subview(sendbuf[n].vars_stage, m, rng);
+            Kokkos::deep_copy(send_ptr, Kokkos::subview(sendbuf[n].vars, m, rng));
+#endif
+            if (persistent) {
+              // request was created by InitPersistentRequests() with this buffer/size
+              ierr = MPI_Start(&(sendbuf[n].vars_req[m]));
+            } else {
+              ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
                                comm_vars, &(sendbuf[n].vars_req[m]));
+            }
+          }
           if (ierr != MPI_SUCCESS) {no_errors=false;}
+          if (comm_matrix) {
+            CountMsg(comm_msg_vars, drank, static_cast<std::int64_t>(data_size)*
+                     ((single_prec)? sizeof(float) : sizeof(Real)));
+          }
         }
       }
     }
@@ -260,128 +615,240 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
 //----------------------------------------------------------------------------------------
 // \!fn void RecvBuffers()
 // \brief Unpack boundary buffers
+//
+// As with PackAndSendCC(), the worker is templated over the multilevel flag so the
+// unigrid instantiation compiles without refinement branches; the untemplated version
+// dispatches.
 
 TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
                                                  DvceArray5D<Real> &ca) {
+  if (pmy_pack->pmesh->multilevel) {
+    return RecvAndUnpackCC<true>(a, ca);
+  }
+  return RecvAndUnpackCC<false>(a, ca);
+}
+
+template <bool multilevel_>
+TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
+                                                 DvceArray5D<Real> &ca) {
+  // do nothing when this object's messages are carried by another exchange (FuseCC)
+  if (fused_into) {return TaskStatus::complete;}
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
   auto &rbuf = recvbuf;
   auto &is_z4c = is_z4c_;
-  auto &multilevel = pmy_pack->pmesh->multilevel;
 #if MPI_PARALLEL_ENABLED
   //----- STEP 1: check that recv boundary buffer communications have all completed
 
-  bool bflag = false;
-  bool no_errors=true;
-  for (int m=0; m<nmb; ++m) {
-    for (int n=0; n<nnghbr; ++n) {
-      if (nghbr.h_view(m,n).gid >= 0) { // neighbor exists and not a physical boundary
-        if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
-          int test;
-          int ierr = MPI_Test(&(rbuf[n].vars_req[m]), &test, MPI_STATUS_IGNORE);
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          if (!(static_cast<bool>(test))) {
-            bflag = true;
+  // with coalesced messaging, test the single message from each remote rank and scatter
+  // arrived data into the individual recv buffers before the unpack kernel below
+  if (coalesce) {
+    if (!(TestCoalescedRecvs())) {return TaskStatus::incomplete;}
+    ScatterCoalescedRecvs();
+  } else {
+    // in eager mode the current exchange's messages are tracked by the requests (and
+    // land in the staging plane) selected at the last InitRecv() plane flip
+    const bool use_alt = (eager_recv && (eager_plane_ == 1));
+    bool bflag = false;
+    bool no_errors=true;
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<nnghbr; ++n) {
+        if (nghbr.h_view(m,n).gid >= 0) { // neighbor exists and not a physical boundary
+          if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
+            int test;
+            MPI_Request *req = (use_alt)? &(rbuf[n].vars_req_alt[m])
+                                        : &(rbuf[n].vars_req[m]);
+            int ierr = MPI_Test(req, &test, MPI_STATUS_IGNORE);
+            if (ierr != MPI_SUCCESS) {no_errors=false;}
+            if (!(static_cast<bool>(test))) {
+              bflag = true;
+            }
           }
         }
       }
     }
+    // Quit if MPI error detected
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MPI error in testing non-blocking receives"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    // exit if recv boundary buffer communications have not completed
+    if (bflag) {return TaskStatus::incomplete;}
+
+#if !(GPU_AWARE_MPI_ENABLED)
+    // messages arrived in pinned host staging; copy to device before unpacking.  The
+    // copies and the unpack kernel share the default instance, so no fence is needed
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<nnghbr; ++n) {
+        if ( (nghbr.h_view(m,n).gid >= 0) &&
+             (nghbr.h_view(m,n).rank != global_variable::my_rank) ) {
+          if (single_prec) {
+            Kokkos::deep_copy(DevExeSpace(),
+                              Kokkos::subview(rbuf[n].vars_sp, m, Kokkos::ALL),
+                              Kokkos::subview(rbuf[n].vars_sp_stage, m, Kokkos::ALL));
+          } else {
+            Kokkos::deep_copy(DevExeSpace(),
+                              Kokkos::subview(rbuf[n].vars, m, Kokkos::ALL),
+                              (use_alt)?
+                              Kokkos::subview(rbuf[n].vars_stage_alt, m, Kokkos::ALL) :
+                              Kokkos::subview(rbuf[n].vars_stage, m, Kokkos::ALL));
+          }
+        }
+      }
+    }
+#endif
+
+    // promote FP32 wire data back to Real before unpacking.  Same-rank rows are never
+    // read by the unpack kernel, so converting every row is harmless
+    if (single_prec) {
+      Kokkos::TeamPolicy<> policy_sp(DevExeSpace(), (nmb*nnghbr), Kokkos::AUTO);
+      Kokkos::parallel_for("RecvBuffSP", policy_sp, KOKKOS_LAMBDA(TeamMember_t tmember) {
+        const int m = (tmember.league_rank())/nnghbr;
+        const int n = (tmember.league_rank() - m*nnghbr);
+        const int ndat = rbuf[n].vars.extent_int(1);
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(tmember, ndat), [&](const int i) {
+          rbuf[n].vars(m,i) = static_cast<Real>(rbuf[n].vars_sp(m,i));
+        });
+      });
+    }
   }
-  // Quit if MPI error detected
-  if (!(no_errors)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl << "MPI error in testing non-blocking receives"
-              << std::endl;
-    std::exit(EXIT_FAILURE);
-  }
-  // exit if recv boundary buffer communications have not completed
-  if (bflag) {return TaskStatus::incomplete;}
 #endif
 
-  //----- STEP 2: buffers have all completed, so unpack
+  //----- STEP 2: buffers have all completed, so unpack.  Same-rank neighbors are skipped
+  // since PackAndSendCC() filled their ghost cells directly, bypassing the buffers
+
+  // build (or reuse) the flat tile queues; the unpack queue holds only off-rank pairs
+  InitTileQueues();
 
   int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
   auto &mblev = pmy_pack->pmb->mb_lev;
+  int my_rank = global_variable::my_rank;
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), (nmb*nnghbr*nvar), Kokkos::AUTO);
+  // with face masking active, each buffer carries only its packed variable list
+  const bool vm = vmask;
+  auto &vm_rnv = vmask_recv_nv;
+  auto &vm_rv = vmask_recv_v;
+
+  // fused exchange: variable sets registered by other physics modules are unpacked
+  // from each message, indexed by flattened variable v in [nvar, nvtot)
+  int nvtot = nvar;
+  Kokkos::Array<DvceArray5D<Real>, nfused_max> f_a, f_ca;
+  Kokkos::Array<int, nfused_max> f_vs;
+  for (int f=0; f<nfused; ++f) {
+    f_a[f] = *(fused_a[f]);
+    f_ca[f] = *(fused_ca[f]);
+    f_vs[f] = nvtot;
+    nvtot += fused_nv[f];
+  }
+  const int nf = nfused;
+
+  // Outer loop over (# of off-rank tiles)*(# of variables): each team unpacks one tile
+  // of up to tile_ncell cells of one (MeshBlock, buffer) pair for one variable, so
+  // teams carry (nearly) equal work whether the buffer is a corner strip or face slab
+  if (nunpk_tiles > 0) {
+  auto &up_m = unpk_tile_m;
+  auto &up_n = unpk_tile_n;
+  auto &up_c = unpk_tile_c;
+  const int tile = tile_ncell;
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), (nunpk_tiles*nvtot), Kokkos::AUTO);
   Kokkos::parallel_for("RecvBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
+    const int p = (tmember.league_rank())/nvtot;
+    const int v = (tmember.league_rank() - p*nvtot);
+    const int m = up_m.d_view(p);
+    const int n = up_n.d_view(p);
+    const int c0 = up_c.d_view(p);
 
-    // only unpack buffers when neighbor exists
-    if (nghbr.d_view(m,n).gid >= 0) {
-      int il, iu, jl, ju, kl, ku;
-      // if neighbor is at coarser level, use coar indices to unpack buffer
-      if (nghbr.d_view(m,n).lev < mblev.d_view(m)) {
-        il = rbuf[n].icoar[0].bis;
-        iu = rbuf[n].icoar[0].bie;
-        jl = rbuf[n].icoar[0].bjs;
-        ju = rbuf[n].icoar[0].bje;
-        kl = rbuf[n].icoar[0].bks;
-        ku = rbuf[n].icoar[0].bke;
-      // if neighbor is at same level, use same indices to unpack buffer
-      } else if (nghbr.d_view(m,n).lev == mblev.d_view(m)) {
-        il = rbuf[n].isame[0].bis;
-        iu = rbuf[n].isame[0].bie;
-        jl = rbuf[n].isame[0].bjs;
-        ju = rbuf[n].isame[0].bje;
-        kl = rbuf[n].isame[0].bks;
-        ku = rbuf[n].isame[0].bke;
-      // if neighbor is at finer level, use fine indices to unpack buffer
-      } else {
-        il = rbuf[n].ifine[0].bis;
-        iu = rbuf[n].ifine[0].bie;
-        jl = rbuf[n].ifine[0].bjs;
-        ju = rbuf[n].ifine[0].bje;
-        kl = rbuf[n].ifine[0].bks;
-        ku = rbuf[n].ifine[0].bke;
-      }
-      int ni = iu - il + 1;
-      int nj = ju - jl + 1;
-      int nk = ku - kl + 1;
-      int nkj  = nk*nj;
+    // with face masking, v indexes this buffer's packed variable list, matching the
+    // layout the sender packed; teams beyond the list have no work
+    if (vm && (v >= vm_rnv.d_view(m,n))) {return;}
 
-      // Middle loop over k,j
-      Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
-        int k = idx / nj;
-        int j = (idx - k * nj) + jl;
-        k += kl;
+    // map flattened v to destination array and component: v >= nvar is a fused set
+    DvceArray5D<Real> av = a, cav = ca;
+    int vl = (vm)? vm_rv.d_view(m,n,v) : v;
+    for (int f=0; f<nf; ++f) {
+      if (v >= f_vs[f]) {av = f_a[f]; cav = f_ca[f]; vl = v - f_vs[f];}
+    }
 
-        // if neighbor is at same or finer level, load data directly into u0
-        if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
-          Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-          [&](const int i) {
-            a(m,v,k,j,i) = rbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) );
-          });
-          tmember.team_barrier();
+    int il, iu, jl, ju, kl, ku;
+    // if neighbor is at coarser level, use coar indices to unpack buffer (the level
+    // comparisons fold to the same-level branch in the unigrid instantiation)
+    if (multilevel_ && (nghbr.d_view(m,n).lev < mblev.d_view(m))) {
+      il = rbuf[n].icoar[0].bis;
+      iu = rbuf[n].icoar[0].bie;
+      jl = rbuf[n].icoar[0].bjs;
+      ju = rbuf[n].icoar[0].bje;
+      kl = rbuf[n].icoar[0].bks;
+      ku = rbuf[n].icoar[0].bke;
+    // if neighbor is at same level, use same indices to unpack buffer
+    } else if (!(multilevel_) || (nghbr.d_view(m,n).lev == mblev.d_view(m))) {
+      il = rbuf[n].isame[0].bis;
+      iu = rbuf[n].isame[0].bie;
+      jl = rbuf[n].isame[0].bjs;
+      ju = rbuf[n].isame[0].bje;
+      kl = rbuf[n].isame[0].bks;
+      ku = rbuf[n].isame[0].bke;
+    // if neighbor is at finer level, use fine indices to unpack buffer
+    } else {
+      il = rbuf[n].ifine[0].bis;
+      iu = rbuf[n].ifine[0].bie;
+      jl = rbuf[n].ifine[0].bjs;
+      ju = rbuf[n].ifine[0].bje;
+      kl = rbuf[n].ifine[0].bks;
+      ku = rbuf[n].ifine[0].bke;
+    }
+    int ni = iu - il + 1;
+    int nj = ju - jl + 1;
+    int nk = ku - kl + 1;
+    // flattened cell index c below equals the per-variable buffer offset, so the
+    // buffer layout (i-il + ni*(j-jl + nj*(k-kl + nk*v))) is read as c + ndat*v
+    int ndat = ni*nj*nk;
+    int tsize = ndat - c0;
+    if (tsize > tile) {tsize = tile;}
 
-        // if neighbor is at coarser level, load data into coarse_u0
-        } else {
-          Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-          [&](const int i) {
-            ca(m,v,k,j,i) = rbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) );
-          });
-          tmember.team_barrier();
-        }
+    // Inner loop over cells of this tile
+    // if neighbor is at same or finer level, load data directly into u0
+    if (!(multilevel_) || (nghbr.d_view(m,n).lev >= mblev.d_view(m))) {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(tmember, tsize), [&](const int t) {
+        int c = c0 + t;
+        int i = il + c%ni;
+        int j = jl + (c/ni)%nj;
+        int k = kl + c/(ni*nj);
+        av(m,vl,k,j,i) = rbuf[n].vars(m, (c + ndat*v));
       });
-    }  // end if-neighbor-exists block
+    // if neighbor is at coarser level, load data into coarse_u0
+    } else {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(tmember, tsize), [&](const int t) {
+        int c = c0 + t;
+        int i = il + c%ni;
+        int j = jl + (c/ni)%nj;
+        int k = kl + c/(ni*nj);
+        cav(m,vl,k,j,i) = rbuf[n].vars(m, (c + ndat*v));
+      });
+    }
   });  // end par_for_outer
+  }
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-  Kokkos::parallel_for("RecvBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
-    // only unpack buffers when neighbor exists
-    if (nghbr.d_view(m,n).gid >= 0) {
+  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables).  The Z4c
+  // appendix only exists with SMR/AMR; the launch folds away when unigrid
+  if (multilevel_) {
+  Kokkos::TeamPolicy<> policy_z(DevExeSpace(), (nmb*nnghbr*nvtot), Kokkos::AUTO);
+  Kokkos::parallel_for("RecvBuff", policy_z, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    // decode with nvtot so league index stays in range (Z4c is never fused, so
+    // nvtot == nvar whenever this kernel actually has work to do)
+    const int m = (tmember.league_rank())/(nnghbr*nvtot);
+    const int n = (tmember.league_rank() - m*(nnghbr*nvtot))/nvtot;
+    const int v = (tmember.league_rank() - m*(nnghbr*nvtot) - n*nvtot);
+    // only unpack buffers for off-rank neighbors
+    if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).rank != my_rank)) {
       int il, iu, jl, ju, kl, ku;
       // If neighbor is at same level and data is for Z4c module, unpack data from coarse
       // array for higher-order prolongation
-      if ((nghbr.d_view(m,n).lev == mblev.d_view(m)) && (is_z4c) && (multilevel)) {
+      if ((nghbr.d_view(m,n).lev == mblev.d_view(m)) && (is_z4c)) {
         il = rbuf[n].isame_z4c.bis;
         iu = rbuf[n].isame_z4c.bie;
         jl = rbuf[n].isame_z4c.bjs;
@@ -410,6 +877,204 @@ TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
       }
     }  // end if-neighbor-exists block
   });  // end par_for_outer
+  }  // end if multilevel_
 
   return TaskStatus::complete;
 }
+
+// explicitly instantiate unigrid and SMR/AMR variants of the templated workers
+template TaskStatus MeshBoundaryValuesCC::PackAndSendCC<false>(
+  DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+template TaskStatus MeshBoundaryValuesCC::PackAndSendCC<true>(
+  DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+template TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC<false>(
+  DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+template TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC<true>(
+  DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValuesCC::FuseCC()
+//! \brief registers the cell-centered variables exchanged by another physics module so
+//! they are appended to this object's messages, halving the message count in
+//! multi-physics runs and amortizing pack/unpack index computation across modules.  The
+//! follower object's own send/recv/clear functions become no-ops.  Pointers to the
+//! Views are stored (not copies) so reallocation on regrid is handled transparently.
+//! Must be called after InitializeBuffers(); incompatible with the Z4c buffer layout.
+
+void MeshBoundaryValuesCC::FuseCC(DvceArray5D<Real> *a, DvceArray5D<Real> *ca,
+                                  MeshBoundaryValues *follower) {
+  if ((is_z4c_) || (nfused >= nfused_max)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "Cannot fuse boundary exchange (Z4c layout or too many sets)"
+       << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  fused_a[nfused] = a;
+  fused_ca[nfused] = ca;
+  fused_nv[nfused] = a->extent_int(1);
+  ++nfused;
+  follower->fused_into = true;
+
+  // re-size message storage to hold the additional variables, then re-slab: growing
+  // every buffer costs one allocation per slab, not one per buffer
+  int nmb = std::max((pmy_pack->nmb_thispack), (pmy_pack->pmesh->nmb_maxperrank));
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  int nvtot = nvar_base_ + FusedNvar();
+  for (int n=0; n<nnghbr; ++n) {
+    sendbuf[n].ComputeBufferSizes(nvtot, is_z4c_);
+    recvbuf[n].ComputeBufferSizes(nvtot, is_z4c_);
+  }
+  AllocateBufferSlabs(nmb);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValuesCC::SetFaceVarMasksCC()
+//! \brief restricts same-level face buffers to a subset of variables.  Input flags are
+//! indexed (MeshBlock, BoundaryFace, variable) and mark the variables this MeshBlock
+//! consumes from its ghost zones on each face; Radiation uses this to exchange only the
+//! hemisphere of angles propagating across each face.  Ghost values of excluded
+//! variables are never written.  Edge, corner, and coarse/fine buffers are not masked.
+//! The send-side list of each buffer is copied (same rank) or received (MPI) from the
+//! MeshBlock that consumes the data, so both ends of every message agree on its length
+//! and layout; the posted receives are unchanged since their sizes are maximum counts.
+//! Must be called after InitializeBuffers().  Incompatible with the Z4c buffer layout,
+//! fused exchanges, and the coalesced/persistent/single-precision message paths, all of
+//! which assume every buffer carries every variable.
+
+void MeshBoundaryValuesCC::SetFaceVarMasksCC(const DualArray3D<bool> &needed) {
+  bool incompatible = (is_z4c_) || (nfused > 0) || (fused_into);
+#if MPI_PARALLEL_ENABLED
+  incompatible = incompatible || coalesce || persistent || single_prec;
+#endif
+  if (incompatible) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "Face variable masks require the plain per-buffer message path "
+       << "with unfused, full-variable buffers" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  int nvar = nvar_base_;
+  Kokkos::realloc(vmask_send_nv, nmb, nnghbr);
+  Kokkos::realloc(vmask_recv_nv, nmb, nnghbr);
+  Kokkos::realloc(vmask_send_v, nmb, nnghbr, nvar);
+  Kokkos::realloc(vmask_recv_v, nmb, nnghbr, nvar);
+
+  // recv side: packed list of the variables this MeshBlock consumes from each buffer.
+  // Only same-level face buffers are masked; every other buffer lists all variables
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      // map buffer index onto BoundaryFace: x1 faces are buffers [0,8), x2 faces
+      // [8,16), x3 faces [24,32), with 4 sub-block slots per face (see
+      // InitializeBuffers); everything else is an edge or corner
+      int face = -1;
+      if (n < 8) {
+        face = (n < 4)? BoundaryFace::inner_x1 : BoundaryFace::outer_x1;
+      } else if (n < 16) {
+        face = (n < 12)? BoundaryFace::inner_x2 : BoundaryFace::outer_x2;
+      } else if ((n >= 24) && (n < 32)) {
+        face = (n < 28)? BoundaryFace::inner_x3 : BoundaryFace::outer_x3;
+      }
+      bool masked = (face >= 0) && (nghbr.h_view(m,n).gid >= 0) &&
+                    (nghbr.h_view(m,n).lev == mblev.h_view(m));
+      int nv = 0;
+      for (int v=0; v<nvar; ++v) {
+        if (!(masked) || needed.h_view(m,face,v)) {
+          vmask_recv_v.h_view(m,n,nv) = v;
+          ++nv;
+        }
+      }
+      vmask_recv_nv.h_view(m,n) = nv;
+    }
+  }
+
+  // send side: each send buffer packs exactly the list its receiving MeshBlock
+  // unpacks.  Same-rank destinations are in this pack, so their recv lists are read
+  // directly; off-rank lists are exchanged once below
+  auto &mbgid = pmy_pack->pmb->mb_gid;
+  int my_rank = global_variable::my_rank;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      vmask_send_nv.h_view(m,n) = nvar;
+      for (int v=0; v<nvar; ++v) {vmask_send_v.h_view(m,n,v) = v;}
+      if ((nghbr.h_view(m,n).gid >= 0) && (nghbr.h_view(m,n).rank == my_rank)) {
+        int dm = nghbr.h_view(m,n).gid - mbgid.h_view(0);
+        int dn = nghbr.h_view(m,n).dest;
+        vmask_send_nv.h_view(m,n) = vmask_recv_nv.h_view(dm,dn);
+        for (int v=0; v<nvar; ++v) {
+          vmask_send_v.h_view(m,n,v) = vmask_recv_v.h_view(dm,dn,v);
+        }
+      }
+    }
+  }
+
+#if MPI_PARALLEL_ENABLED
+  // exchange lists with off-rank neighbors: the consumer of each buffer sends its recv
+  // list to the rank that packs it.  Tags reuse the (receiving local ID, receiving
+  // buffer index) key of the variable messages; no variable messages are in flight
+  // during setup, so the tag spaces cannot collide
+  {
+    std::vector<MPI_Request> req;
+    std::vector<int> smsg(nmb*nnghbr*(nvar+1)), rmsg(nmb*nnghbr*(nvar+1));
+    bool no_errors = true;
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<nnghbr; ++n) {
+        if ((nghbr.h_view(m,n).gid < 0) ||
+            (nghbr.h_view(m,n).rank == my_rank)) {continue;}
+        int drank = nghbr.h_view(m,n).rank;
+        int *sdata = &(smsg[(m*nnghbr + n)*(nvar+1)]);
+        int *rdata = &(rmsg[(m*nnghbr + n)*(nvar+1)]);
+
+        // send this buffer's recv list to the rank that packs it, keyed by this
+        // (receiving) MeshBlock's local ID and buffer index
+        sdata[0] = vmask_recv_nv.h_view(m,n);
+        for (int v=0; v<nvar; ++v) {sdata[v+1] = vmask_recv_v.h_view(m,n,v);}
+        req.push_back(MPI_REQUEST_NULL);
+        int ierr = MPI_Isend(sdata, (nvar+1), MPI_INT, drank,
+                             CreateBvals_MPI_Tag(m, n), comm_vars, &(req.back()));
+        if (ierr != MPI_SUCCESS) {no_errors = false;}
+
+        // receive the list this MeshBlock's send buffer must pack, keyed by the
+        // destination MeshBlock's local ID and buffer index
+        int lid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
+        int dn = nghbr.h_view(m,n).dest;
+        req.push_back(MPI_REQUEST_NULL);
+        ierr = MPI_Irecv(rdata, (nvar+1), MPI_INT, drank,
+                         CreateBvals_MPI_Tag(lid, dn), comm_vars, &(req.back()));
+        if (ierr != MPI_SUCCESS) {no_errors = false;}
+      }
+    }
+    if (MPI_Waitall(static_cast<int>(req.size()), req.data(), MPI_STATUSES_IGNORE)
+        != MPI_SUCCESS) {no_errors = false;}
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in exchanging face variable masks" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<nnghbr; ++n) {
+        if ((nghbr.h_view(m,n).gid < 0) ||
+            (nghbr.h_view(m,n).rank == my_rank)) {continue;}
+        int *rdata = &(rmsg[(m*nnghbr + n)*(nvar+1)]);
+        vmask_send_nv.h_view(m,n) = rdata[0];
+        for (int v=0; v<nvar; ++v) {vmask_send_v.h_view(m,n,v) = rdata[v+1];}
+      }
+    }
+  }
+#endif
+
+  vmask_send_nv.template modify<HostMemSpace>();
+  vmask_recv_nv.template modify<HostMemSpace>();
+  vmask_send_v.template modify<HostMemSpace>();
+  vmask_recv_v.template modify<HostMemSpace>();
+  vmask_send_nv.template sync<DevExeSpace>();
+  vmask_recv_nv.template sync<DevExeSpace>();
+  vmask_send_v.template sync<DevExeSpace>();
+  vmask_recv_v.template sync<DevExeSpace>();
+  vmask = true;
+  return;
+}
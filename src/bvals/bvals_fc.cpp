@@ -189,6 +189,12 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
 #if MPI_PARALLEL_ENABLED
   // Send boundary buffer to neighboring MeshBlocks using MPI
   Kokkos::fence();
+
+  // with coalesced messaging, gather buffers and send one message per remote rank.
+  // The fence above guarantees the packed send buffers are visible to the gather
+  if (coalesce) {
+    return SendCoalesced();
+  }
   int my_rank = global_variable::my_rank;
   auto &nghbr = pmy_pack->pmb->nghbr;
   bool no_errors=true;
@@ -212,11 +218,28 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
           } else {
             data_size *= sendbuf[n].ifine_ndat;
           }
+#if GPU_AWARE_MPI_ENABLED
           auto send_ptr = Kokkos::subview(sendbuf[n].vars, m, Kokkos::ALL);
+#else
+          // stage message through pinned host memory when MPI cannot access device
+          auto rng = std::make_pair(0, data_size);
+          auto send_ptr = Kokkos::subview(sendbuf[n].vars_stage, m, rng);
+          Kokkos::deep_copy(send_ptr, Kokkos::subview(sendbuf[n].vars, m, rng));
+#endif
 
-          int ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
-                               comm_vars, &(sendbuf[n].vars_req[m]));
+          int ierr;
+          if (persistent) {
+            // request was created by InitPersistentRequests() with this buffer/size
+            ierr = MPI_Start(&(sendbuf[n].vars_req[m]));
+          } else {
+            ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
+                             comm_vars, &(sendbuf[n].vars_req[m]));
+          }
           if (ierr != MPI_SUCCESS) {no_errors=false;}
+          if (comm_matrix) {
+            CountMsg(comm_msg_vars, drank,
+                     static_cast<std::int64_t>(data_size)*sizeof(Real));
+          }
         }
       }
     }
@@ -245,31 +268,60 @@ TaskStatus MeshBoundaryValuesFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b,
 #if MPI_PARALLEL_ENABLED
   //----- STEP 1: check that recv boundary buffer communications have all completed
 
-  bool bflag = false;
-  bool no_errors=true;
-  for (int m=0; m<nmb; ++m) {
-    for (int n=0; n<nnghbr; ++n) {
-      if (nghbr.h_view(m,n).gid >= 0) { // ID != -1, so not a physical boundary
-        if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
-          int test;
-          int ierr = MPI_Test(&(rbuf[n].vars_req[m]), &test, MPI_STATUS_IGNORE);
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          if (!(static_cast<bool>(test))) {
-            bflag = true;
+  // with coalesced messaging, test the single message from each remote rank and scatter
+  // arrived data into the individual recv buffers before the unpack kernel below
+  if (coalesce) {
+    if (!(TestCoalescedRecvs())) {return TaskStatus::incomplete;}
+    ScatterCoalescedRecvs();
+  } else {
+    // in eager mode the current exchange's messages are tracked by the requests (and
+    // land in the staging plane) selected at the last InitRecv() plane flip
+    const bool use_alt = (eager_recv && (eager_plane_ == 1));
+    bool bflag = false;
+    bool no_errors=true;
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<nnghbr; ++n) {
+        if (nghbr.h_view(m,n).gid >= 0) { // ID != -1, so not a physical boundary
+          if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
+            int test;
+            MPI_Request *req = (use_alt)? &(rbuf[n].vars_req_alt[m])
+                                        : &(rbuf[n].vars_req[m]);
+            int ierr = MPI_Test(req, &test, MPI_STATUS_IGNORE);
+            if (ierr != MPI_SUCCESS) {no_errors=false;}
+            if (!(static_cast<bool>(test))) {
+              bflag = true;
+            }
           }
         }
       }
     }
+    // Quit if MPI error detected
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MPI error in testing non-blocking receives"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    // exit if recv boundary buffer communications have not completed
+    if (bflag) {return TaskStatus::incomplete;}
+
+#if !(GPU_AWARE_MPI_ENABLED)
+    // messages arrived in pinned host staging; copy to device before unpacking.  The
+    // copies and the unpack kernel share the default instance, so no fence is needed
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<nnghbr; ++n) {
+        if ( (nghbr.h_view(m,n).gid >= 0) &&
+             (nghbr.h_view(m,n).rank != global_variable::my_rank) ) {
+          Kokkos::deep_copy(DevExeSpace(),
+                            Kokkos::subview(rbuf[n].vars, m, Kokkos::ALL),
+                            (use_alt)?
+                            Kokkos::subview(rbuf[n].vars_stage_alt, m, Kokkos::ALL) :
+                            Kokkos::subview(rbuf[n].vars_stage, m, Kokkos::ALL));
+        }
+      }
+    }
+#endif
   }
-  // Quit if MPI error detected
-  if (!(no_errors)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl << "MPI error in testing non-blocking receives"
-              << std::endl;
-    std::exit(EXIT_FAILURE);
-  }
-  // exit if recv boundary buffer communications have not completed
-  if (bflag) {return TaskStatus::incomplete;}
 #endif
 
   //----- STEP 2: buffers have all completed, so unpack 3-components of field
@@ -23,6 +23,31 @@
 #include "bvals.hpp"
 
 namespace particles {
+//----------------------------------------------------------------------------------------
+//! \fn void EnsureCapacity()
+//! \brief grow-only buffer sizing with hysteresis.  Capacity grows with slack whenever
+//! the needed size exceeds it, and shrinks only after the needed size has stayed below
+//! a quarter of capacity for many consecutive calls, so steady-state stepping with
+//! fluctuating particle counts performs no allocations or associated fences.
+
+template <typename ViewType>
+static void EnsureCapacity(ViewType &buf, int needed, int &nsmall) {
+  constexpr Real slack = 1.5;    // extra capacity factor applied on each (re)allocation
+  constexpr int nshrink = 1000;  // consecutive mostly-empty calls before shrinking
+  int cap = static_cast<int>(buf.extent(0));
+  if (needed > cap) {
+    Kokkos::realloc(buf, static_cast<int>(slack*needed));
+    nsmall = 0;
+  } else if (4*needed < cap) {
+    if (++nsmall >= nshrink) {
+      Kokkos::realloc(buf, static_cast<int>(slack*needed));
+      nsmall = 0;
+    }
+  } else {
+    nsmall = 0;
+  }
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void ParticlesBoundaryValues::UpdateGID()
 //! \brief Updates GID of particles that cross boundary of their parent MeshBlock.  If
@@ -65,7 +90,7 @@ TaskStatus ParticlesBoundaryValues::SetNewPrtclGID() {
   bool &multi_d = pmy_part->pmy_pack->pmesh->multi_d;
   bool &three_d = pmy_part->pmy_pack->pmesh->three_d;
 
-  Kokkos::realloc(sendlist, static_cast<int>(0.1*npart));
+  EnsureCapacity(sendlist, static_cast<int>(0.1*npart), sendlist_nsmall);
   par_for("part_update",DevExeSpace(),0,(npart-1), KOKKOS_LAMBDA(const int p) {
     int m = pi(PGID,p) - gids;
     int mylevel = mblev.d_view(m);
@@ -171,7 +196,8 @@ TaskStatus ParticlesBoundaryValues::SetNewPrtclGID() {
     }
   });
   nprtcl_send = counter;
-  Kokkos::resize(sendlist, nprtcl_send);
+  // only the first nprtcl_send entries of sendlist are valid; capacity is retained
+  // across steps so later passes must bound their loops/sorts by nprtcl_send
   // sync sendlist device array with host
   sendlist.template modify<DevExeSpace>();
   sendlist.template sync<HostMemSpace>();
@@ -187,7 +213,8 @@ TaskStatus ParticlesBoundaryValues::CountSendsAndRecvs() {
 #if MPI_PARALLEL_ENABLED
   // Sort sendlist on host by destrank.
   namespace KE = Kokkos::Experimental;
-  std::sort(KE::begin(sendlist.h_view), KE::end(sendlist.h_view), SortByRank);
+  std::sort(KE::begin(sendlist.h_view), KE::begin(sendlist.h_view) + nprtcl_send,
+            SortByRank);
   // sync sendlist host array with device.  This results in sorted array on device
   sendlist.template modify<HostMemSpace>();
   sendlist.template sync<DevExeSpace>();
@@ -267,9 +294,9 @@ TaskStatus ParticlesBoundaryValues::InitPrtclRecv() {
     nprtcl_recv += recvs_thisrank[n].nprtcls;
   }
 
-  // Allocate receive buffer
-  Kokkos::realloc(prtcl_rrecvbuf, (pmy_part->nrdata)*nprtcl_recv);
-  Kokkos::realloc(prtcl_irecvbuf, (pmy_part->nidata)*nprtcl_recv);
+  // Ensure receive buffer capacity (grow-only with hysteresis)
+  EnsureCapacity(prtcl_rrecvbuf, (pmy_part->nrdata)*nprtcl_recv, rrecvbuf_nsmall);
+  EnsureCapacity(prtcl_irecvbuf, (pmy_part->nidata)*nprtcl_recv, irecvbuf_nsmall);
 
   // Post non-blocking receives
   bool no_errors=true;
@@ -337,9 +364,9 @@ TaskStatus ParticlesBoundaryValues::PackAndSendPrtcls() {
 
   bool no_errors=true;
   if (nprtcl_send > 0) {
-    // Allocate send buffer
-    Kokkos::realloc(prtcl_rsendbuf, (pmy_part->nrdata)*nprtcl_send);
-    Kokkos::realloc(prtcl_isendbuf, (pmy_part->nidata)*nprtcl_send);
+    // Ensure send buffer capacity (grow-only with hysteresis)
+    EnsureCapacity(prtcl_rsendbuf, (pmy_part->nrdata)*nprtcl_send, rsendbuf_nsmall);
+    EnsureCapacity(prtcl_isendbuf, (pmy_part->nidata)*nprtcl_send, isendbuf_nsmall);
 
     // sendlist on device is already sorted by destrank in CountSendAndRecvs()
     // Use sendlist on device to load particles into send buffer ordered by dest_rank
@@ -420,7 +447,8 @@ TaskStatus ParticlesBoundaryValues::RecvAndUnpackPrtcls() {
 #if MPI_PARALLEL_ENABLED
   // Sort sendlist on host by index in particle array
   namespace KE = Kokkos::Experimental;
-  std::sort(KE::begin(sendlist.h_view), KE::end(sendlist.h_view), SortByIndex);
+  std::sort(KE::begin(sendlist.h_view), KE::begin(sendlist.h_view) + nprtcl_send,
+            SortByIndex);
   // sync sendlist host array with device.  This results in sorted array on device
   sendlist.template modify<HostMemSpace>();
   sendlist.template sync<DevExeSpace>();
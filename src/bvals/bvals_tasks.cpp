@@ -14,6 +14,7 @@
 //! Note2: task list functions for particle communication are all implemented in
 //! bvals_part.cpp file.
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <utility>
@@ -29,12 +30,125 @@
 //! \brief Posts non-blocking receives (with MPI) for boundary communications of vars.
 
 TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
+  // do nothing when this object's messages are carried by another exchange (FuseCC)
+  if (fused_into) {return TaskStatus::complete;}
 #if MPI_PARALLEL_ENABLED
   int &nmb = pmy_pack->nmb_thispack;
   int &nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
 
+  // fused exchange: messages also carry variable sets registered by other modules
+  const int nvars_tot = nvars + FusedNvar();
+
+  // with coalesced messaging, post one receive per remote rank instead of one per
+  // (MeshBlock, neighbor) pair.  Buffers are (re)built on the first call and whenever
+  // AMR or load balancing changes the MeshBlock distribution
+  if (coalesce) {
+    int gen = 0;
+    if (pmy_pack->pmesh->pmr != nullptr) {
+      gen = pmy_pack->pmesh->pmr->nmb_created + pmy_pack->pmesh->pmr->nmb_deleted
+          + pmy_pack->pmesh->pmr->nmb_sent_thisrank;
+    }
+    if ((nvars_tot != coal_nvar_) || (gen != coal_mesh_gen_)) {
+      InitCoalescedBuffers(nvars_tot);
+      coal_nvar_ = nvars_tot;
+      coal_mesh_gen_ = gen;
+    }
+    // in neighborhood-collective mode both directions are carried by one nonblocking
+    // collective posted in SendCoalesced(), so there are no receives to post here
+    if (neighbor_coll) {return TaskStatus::complete;}
+    bool no_err=true;
+    for (auto &cb : coal_recv) {
+      int nchunk = static_cast<int>(cb.req.size());
+      for (int c=0; c<nchunk; ++c) {
+        int start = c*cb.chunk;
+        int len = std::min(cb.ndat - start, cb.chunk);
+#if GPU_AWARE_MPI_ENABLED
+        Real *buf = cb.data.data() + start;
+#else
+        // receive into pinned host staging; copied to device once the message arrives
+        Real *buf = cb.data_stage.data() + start;
+#endif
+        int ierr = MPI_Irecv(buf, len, MPI_ATHENA_REAL, cb.rank, c, comm_vars,
+                             &(cb.req[c]));
+        if (ierr != MPI_SUCCESS) {no_err=false;}
+      }
+    }
+    if (!(no_err)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in posting coalesced receives" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return TaskStatus::complete;
+  }
+
+  // with persistent requests, create MPI_Send_init/MPI_Recv_init requests on the first
+  // call and whenever AMR or load balancing changes the MeshBlock distribution, then
+  // just (re)start the receives each stage
+  if (persistent) {
+    int gen = 0;
+    if (pmy_pack->pmesh->pmr != nullptr) {
+      gen = pmy_pack->pmesh->pmr->nmb_created + pmy_pack->pmesh->pmr->nmb_deleted
+          + pmy_pack->pmesh->pmr->nmb_sent_thisrank;
+    }
+    if ((nvars_tot != pers_nvar_) || (gen != pers_mesh_gen_)) {
+      InitPersistentRequests(nvars_tot);
+      pers_nvar_ = nvars_tot;
+      pers_mesh_gen_ = gen;
+    }
+    bool no_err=true;
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<nnghbr; ++n) {
+        if ( (nghbr.h_view(m,n).gid >= 0) &&
+             (nghbr.h_view(m,n).rank != global_variable::my_rank) ) {
+          int ierr = MPI_Start(&(recvbuf[n].vars_req[m]));
+          if (ierr != MPI_SUCCESS) {no_err=false;}
+        }
+      }
+    }
+    if (!(no_err)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in starting persistent receives" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return TaskStatus::complete;
+  }
+
+#if !(GPU_AWARE_MPI_ENABLED)
+  // eager mode: this exchange's receives were already posted during the previous one
+  // (except on the very first call).  Flip to the pre-posted plane, then post the next
+  // exchange's receives into the other plane so arriving messages always pre-match
+  if (eager_recv) {
+    if (eager_posted_) {
+      eager_plane_ ^= 1;
+    } else {
+      PostVariableRecvs(nvars_tot, eager_plane_);
+    }
+    PostVariableRecvs(nvars_tot, (eager_plane_^1));
+    eager_posted_ = true;
+    return TaskStatus::complete;
+  }
+#endif
+
   // Initialize communications of variables
+  PostVariableRecvs(nvars_tot, 0);
+#endif
+  return TaskStatus::complete;
+}
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn  void MeshBoundaryValues::PostVariableRecvs
+//! \brief posts the non-blocking receives for one full exchange of variables into the
+//! given staging plane.  Plane 0 is the normal recv storage; plane 1 is the alternate
+//! plane into which eager (double-buffered) mode receives the next exchange while the
+//! current one is still being unpacked
+
+void MeshBoundaryValues::PostVariableRecvs(const int nvars_tot, const int plane) {
+  int &nmb = pmy_pack->nmb_thispack;
+  int &nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+
   bool no_errors=true;
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<nnghbr; ++n) {
@@ -48,7 +162,7 @@ TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
           int tag = CreateBvals_MPI_Tag(m, n);
 
           // calculate amount of data to be passed, get pointer to variables
-          int data_size = nvars;
+          int data_size = nvars_tot;
           if ( nghbr.h_view(m,n).lev < pmy_pack->pmb->mb_lev.h_view(m) ) {
             data_size *= recvbuf[n].icoar_ndat;
           } else if ( nghbr.h_view(m,n).lev == pmy_pack->pmb->mb_lev.h_view(m) ) {
@@ -60,11 +174,34 @@ TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
           } else {
             data_size *= recvbuf[n].ifine_ndat;
           }
-          auto recv_ptr = Kokkos::subview(recvbuf[n].vars, m, Kokkos::ALL);
-
-          // Post non-blocking receive for this buffer on this MeshBlock
-          int ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
-                               comm_vars, &(recvbuf[n].vars_req[m]));
+          // Post non-blocking receive for this buffer on this MeshBlock.  With the
+          // single-precision wire format messages arrive in the FP32 mirror buffers
+          // and are converted to Real before unpacking
+          int ierr;
+          if (single_prec) {
+#if GPU_AWARE_MPI_ENABLED
+            auto recv_ptr = Kokkos::subview(recvbuf[n].vars_sp, m, Kokkos::ALL);
+#else
+            auto recv_ptr = Kokkos::subview(recvbuf[n].vars_sp_stage, m, Kokkos::ALL);
+#endif
+            ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_FLOAT, drank, tag,
+                             comm_vars, &(recvbuf[n].vars_req[m]));
+          } else {
+#if GPU_AWARE_MPI_ENABLED
+            auto recv_ptr = Kokkos::subview(recvbuf[n].vars, m, Kokkos::ALL);
+            ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
+                             comm_vars, &(recvbuf[n].vars_req[m]));
+#else
+            // receive into pinned host staging; copied to device once message arrives
+            auto recv_ptr = (plane == 0)?
+                Kokkos::subview(recvbuf[n].vars_stage, m, Kokkos::ALL) :
+                Kokkos::subview(recvbuf[n].vars_stage_alt, m, Kokkos::ALL);
+            MPI_Request *req = (plane == 0)? &(recvbuf[n].vars_req[m])
+                                           : &(recvbuf[n].vars_req_alt[m]);
+            ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
+                             comm_vars, req);
+#endif
+          }
           if (ierr != MPI_SUCCESS) {no_errors=false;}
         }
       }
@@ -76,9 +213,98 @@ TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
        << std::endl << "MPI error in posting non-blocking receives" << std::endl;
     std::exit(EXIT_FAILURE);
   }
+  return;
+}
 #endif
-  return TaskStatus::complete;
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn  void MeshBoundaryValues::InitPersistentRequests
+//! \brief creates persistent MPI requests for sends and receives of variables with
+//! MPI_Send_init/MPI_Recv_init.  Message envelopes (rank, tag, size) and buffer
+//! addresses are fixed by the neighbor topology, so on static meshes the same requests
+//! are restarted every stage with MPI_Start; called again only after a regrid.
+
+void MeshBoundaryValues::InitPersistentRequests(const int nvar) {
+  int &nmb = pmy_pack->nmb_thispack;
+  int &nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  int my_rank = global_variable::my_rank;
+
+  // free requests built for a previous topology.  In persistent mode nothing resets
+  // entries to MPI_REQUEST_NULL, so any non-null handle is an inactive persistent
+  // request left over from before the regrid
+  int nmb_alloc = std::max((pmy_pack->nmb_thispack), (pmy_pack->pmesh->nmb_maxperrank));
+  for (int n=0; n<nnghbr; ++n) {
+    for (int m=0; m<nmb_alloc; ++m) {
+      if (sendbuf[n].vars_req[m] != MPI_REQUEST_NULL) {
+        MPI_Request_free(&(sendbuf[n].vars_req[m]));
+      }
+      if (recvbuf[n].vars_req[m] != MPI_REQUEST_NULL) {
+        MPI_Request_free(&(recvbuf[n].vars_req[m]));
+      }
+    }
+  }
+
+  bool no_errors=true;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (nghbr.h_view(m,n).gid >= 0) {
+        int drank = nghbr.h_view(m,n).rank;
+        if (drank == my_rank) {continue;}
+
+        // recv request: tag from (local ID, buffer index) of this MeshBlock, message
+        // size set by level of neighbor, exactly as in InitRecv()
+        int tag = CreateBvals_MPI_Tag(m, n);
+        int data_size = nvar;
+        if ( nghbr.h_view(m,n).lev < pmy_pack->pmb->mb_lev.h_view(m) ) {
+          data_size *= recvbuf[n].icoar_ndat;
+        } else if ( nghbr.h_view(m,n).lev == pmy_pack->pmb->mb_lev.h_view(m) ) {
+          data_size *= (is_z4c_)? recvbuf[n].isame_z4c_ndat : recvbuf[n].isame_ndat;
+        } else {
+          data_size *= recvbuf[n].ifine_ndat;
+        }
+#if GPU_AWARE_MPI_ENABLED
+        auto recv_ptr = Kokkos::subview(recvbuf[n].vars, m, Kokkos::ALL);
+#else
+        auto recv_ptr = Kokkos::subview(recvbuf[n].vars_stage, m, Kokkos::ALL);
+#endif
+        int ierr = MPI_Recv_init(recv_ptr.data(), data_size, MPI_ATHENA_REAL, drank,
+                                 tag, comm_vars, &(recvbuf[n].vars_req[m]));
+        if (ierr != MPI_SUCCESS) {no_errors=false;}
+
+        // send request: tag from (local ID, buffer index) of the *receiving* MeshBlock
+        int dn = nghbr.h_view(m,n).dest;
+        int dlid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
+        tag = CreateBvals_MPI_Tag(dlid, dn);
+        data_size = nvar;
+        if ( nghbr.h_view(m,n).lev < pmy_pack->pmb->mb_lev.h_view(m) ) {
+          data_size *= sendbuf[n].icoar_ndat;
+        } else if ( nghbr.h_view(m,n).lev == pmy_pack->pmb->mb_lev.h_view(m) ) {
+          data_size *= (is_z4c_)? sendbuf[n].isame_z4c_ndat : sendbuf[n].isame_ndat;
+        } else {
+          data_size *= sendbuf[n].ifine_ndat;
+        }
+#if GPU_AWARE_MPI_ENABLED
+        auto send_ptr = Kokkos::subview(sendbuf[n].vars, m, Kokkos::ALL);
+#else
+        auto send_ptr = Kokkos::subview(sendbuf[n].vars_stage, m, Kokkos::ALL);
+#endif
+        ierr = MPI_Send_init(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank,
+                             tag, comm_vars, &(sendbuf[n].vars_req[m]));
+        if (ierr != MPI_SUCCESS) {no_errors=false;}
+      }
+    }
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in creating persistent requests" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return;
 }
+#endif
 
 //----------------------------------------------------------------------------------------
 //! \fn  void MeshBoundaryValues::ClearRecv
@@ -86,18 +312,46 @@ TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
 //! to complete before allowing execution to continue
 
 TaskStatus MeshBoundaryValues::ClearRecv() {
+  // do nothing when this object's messages are carried by another exchange (FuseCC)
+  if (fused_into) {return TaskStatus::complete;}
 #if MPI_PARALLEL_ENABLED
   bool no_errors=true;
+  if (coalesce) {
+    // in neighborhood-collective mode a single request tracks the whole exchange;
+    // the wait is a no-op if the other clear task (or a test) already completed it
+    if (neighbor_coll) {
+      int ierr = MPI_Wait(&nbr_req, MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    } else {
+      for (auto &cb : coal_recv) {
+        for (auto &req : cb.req) {
+          int ierr = MPI_Wait(&req, MPI_STATUS_IGNORE);
+          if (ierr != MPI_SUCCESS) {no_errors=false;}
+        }
+      }
+    }
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in clearing coalesced receives" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return TaskStatus::complete;
+  }
   int &nmb = pmy_pack->nmb_thispack;
   int &nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
 
-  // wait for all non-blocking receives for vars to finish before continuing
+  // wait for all non-blocking receives for vars to finish before continuing.  In eager
+  // mode only the current plane is waited on; the other plane holds receives already
+  // posted for the next exchange
+  const bool use_alt = (eager_recv && (eager_plane_ == 1));
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<nnghbr; ++n) {
       if ( (nghbr.h_view(m,n).gid >= 0) &&
            (nghbr.h_view(m,n).rank != global_variable::my_rank) ) {
-        int ierr = MPI_Wait(&(recvbuf[n].vars_req[m]), MPI_STATUS_IGNORE);
+        MPI_Request *req = (use_alt)? &(recvbuf[n].vars_req_alt[m])
+                                    : &(recvbuf[n].vars_req[m]);
+        int ierr = MPI_Wait(req, MPI_STATUS_IGNORE);
         if (ierr != MPI_SUCCESS) {no_errors=false;}
       }
     }
@@ -118,8 +372,31 @@ TaskStatus MeshBoundaryValues::ClearRecv() {
 //! to complete before allowing execution to continue
 
 TaskStatus MeshBoundaryValues::ClearSend() {
+  // do nothing when this object's messages are carried by another exchange (FuseCC)
+  if (fused_into) {return TaskStatus::complete;}
 #if MPI_PARALLEL_ENABLED
   bool no_errors=true;
+  if (coalesce) {
+    // in neighborhood-collective mode a single request tracks the whole exchange;
+    // the wait is a no-op if the other clear task (or a test) already completed it
+    if (neighbor_coll) {
+      int ierr = MPI_Wait(&nbr_req, MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    } else {
+      for (auto &cb : coal_send) {
+        for (auto &req : cb.req) {
+          int ierr = MPI_Wait(&req, MPI_STATUS_IGNORE);
+          if (ierr != MPI_SUCCESS) {no_errors=false;}
+        }
+      }
+    }
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in clearing coalesced sends" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return TaskStatus::complete;
+  }
   int &nmb = pmy_pack->nmb_thispack;
   int &nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
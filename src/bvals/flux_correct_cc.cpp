@@ -180,6 +180,10 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC(DvceFaceFld5D<Real> &flx) {
           int ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
                                comm_flux, &(sendbuf[n].flux_req[m]));
           if (ierr != MPI_SUCCESS) {no_errors=false;}
+          if (comm_matrix) {
+            CountMsg(comm_msg_flux, drank,
+                     static_cast<std::int64_t>(data_size)*sizeof(Real));
+          }
         }
       }
     }
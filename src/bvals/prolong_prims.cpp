@@ -35,11 +35,11 @@
 void MeshBoundaryValuesCC::ConsToPrimCoarseBndry(const DvceArray5D<Real> &cons,
                                                  DvceArray5D<Real> &prim) {
   // create local references for variables in kernel
-  int nmb = pmy_pack->nmb_thispack;
-  int nnghbr = pmy_pack->pmb->nnghbr;
-
-  auto &nghbr = pmy_pack->pmb->nghbr;
-  auto &mblev = pmy_pack->pmb->mb_lev;
+  // (re)build flat lists of (MeshBlock, buffer) work items if mesh has changed
+  InitProlongIndices();
+  if (nprol == 0) {return;}
+  auto &pm = prol_m;
+  auto &pn = prol_n;
   auto &rbuf = recvbuf;
   auto &indcs  = pmy_pack->pmesh->mb_indcs;
   const bool multi_d = pmy_pack->pmesh->multi_d;
@@ -53,14 +53,15 @@ void MeshBoundaryValuesCC::ConsToPrimCoarseBndry(const DvceArray5D<Real> &cons,
   int &nhyd  = pmy_pack->phydro->nhydro;
   int &nscal = pmy_pack->phydro->nscalars;
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), (nmb*nnghbr), Kokkos::AUTO);
+  // Outer loop over (# of prolongation work items)
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nprol, Kokkos::AUTO);
   Kokkos::parallel_for("Prol_C2P_CC", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = tmember.league_rank()/nnghbr;
-    const int n = tmember.league_rank() - m*nnghbr;
+    const int p = tmember.league_rank();
+    const int m = pm.d_view(p);
+    const int n = pn.d_view(p);
 
-    // only convert coarse vars when neighbor exists and is at coarser level
-    if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).lev < mblev.d_view(m))) {
+    // list only contains pairs whose neighbor exists and is at coarser level
+    {
       // use indices for prolongation on this buffer as loop limits.
       // Note that one extra cell is added to match stencil of 2nd-order prolongation
       int il = rbuf[n].iprol[0].bis - 1;
@@ -190,11 +191,11 @@ void MeshBoundaryValuesCC::ConsToPrimCoarseBndry(const DvceArray5D<Real> &cons,
 void MeshBoundaryValuesCC::PrimToConsFineBndry(const DvceArray5D<Real> &prim,
                                                DvceArray5D<Real> &cons) {
   // create local references for variables in kernel
-  int nmb = pmy_pack->nmb_thispack;
-  int nnghbr = pmy_pack->pmb->nnghbr;
-
-  auto &nghbr = pmy_pack->pmb->nghbr;
-  auto &mblev = pmy_pack->pmb->mb_lev;
+  // (re)build flat lists of (MeshBlock, buffer) work items if mesh has changed
+  InitProlongIndices();
+  if (nprol == 0) {return;}
+  auto &pm = prol_m;
+  auto &pn = prol_n;
   auto &rbuf = recvbuf;
   auto &indcs  = pmy_pack->pmesh->mb_indcs;
   const bool multi_d = pmy_pack->pmesh->multi_d;
@@ -208,14 +209,15 @@ void MeshBoundaryValuesCC::PrimToConsFineBndry(const DvceArray5D<Real> &prim,
   int &nhyd  = pmy_pack->phydro->nhydro;
   int &nscal = pmy_pack->phydro->nscalars;
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), (nmb*nnghbr), Kokkos::AUTO);
+  // Outer loop over (# of prolongation work items)
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nprol, Kokkos::AUTO);
   Kokkos::parallel_for("ProlCC", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = tmember.league_rank()/nnghbr;
-    const int n = tmember.league_rank() - m*nnghbr;
+    const int p = tmember.league_rank();
+    const int m = pm.d_view(p);
+    const int n = pn.d_view(p);
 
-    // only prolongate when neighbor exists and is at coarser level
-    if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).lev < mblev.d_view(m))) {
+    // list only contains pairs whose neighbor exists and is at coarser level
+    {
       // loop over indices for prolongation on this buffer
       // Convert indices from coarse to fine arrays
       int il = (rbuf[n].iprol[0].bis - indcs.cis)*2 + indcs.is;
@@ -303,11 +305,11 @@ void MeshBoundaryValuesCC::PrimToConsFineBndry(const DvceArray5D<Real> &prim,
 void MeshBoundaryValuesCC::ConsToPrimCoarseBndry(const DvceArray5D<Real> &cons,
                                  const DvceFaceFld4D<Real> &b, DvceArray5D<Real> &prim) {
   // create local references for variables in kernel
-  int nmb = pmy_pack->nmb_thispack;
-  int nnghbr = pmy_pack->pmb->nnghbr;
-
-  auto &nghbr = pmy_pack->pmb->nghbr;
-  auto &mblev = pmy_pack->pmb->mb_lev;
+  // (re)build flat lists of (MeshBlock, buffer) work items if mesh has changed
+  InitProlongIndices();
+  if (nprol == 0) {return;}
+  auto &pm = prol_m;
+  auto &pn = prol_n;
   auto &rbuf = recvbuf;
   auto &indcs  = pmy_pack->pmesh->mb_indcs;
   const bool multi_d = pmy_pack->pmesh->multi_d;
@@ -321,14 +323,15 @@ void MeshBoundaryValuesCC::ConsToPrimCoarseBndry(const DvceArray5D<Real> &cons,
   int &nmhd  = pmy_pack->pmhd->nmhd;
   int &nscal = pmy_pack->pmhd->nscalars;
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), (nmb*nnghbr), Kokkos::AUTO);
+  // Outer loop over (# of prolongation work items)
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nprol, Kokkos::AUTO);
   Kokkos::parallel_for("ProlCC", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = tmember.league_rank()/nnghbr;
-    const int n = tmember.league_rank() - m*nnghbr;
+    const int p = tmember.league_rank();
+    const int m = pm.d_view(p);
+    const int n = pn.d_view(p);
 
-    // only convert coarse vars when neighbor exists and is at coarser level
-    if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).lev < mblev.d_view(m))) {
+    // list only contains pairs whose neighbor exists and is at coarser level
+    {
       // use indices for prolongation on this buffer as loop limits
       // Note that one extra cell is added to match stencil of 2nd-order prolongation
       int il = rbuf[n].iprol[0].bis - 1;
@@ -465,11 +468,11 @@ void MeshBoundaryValuesCC::ConsToPrimCoarseBndry(const DvceArray5D<Real> &cons,
 void MeshBoundaryValuesCC::PrimToConsFineBndry(const DvceArray5D<Real> &prim,
                                const DvceFaceFld4D<Real> &b, DvceArray5D<Real> &cons) {
   // create local references for variables in kernel
-  int nmb = pmy_pack->nmb_thispack;
-  int nnghbr = pmy_pack->pmb->nnghbr;
-
-  auto &nghbr = pmy_pack->pmb->nghbr;
-  auto &mblev = pmy_pack->pmb->mb_lev;
+  // (re)build flat lists of (MeshBlock, buffer) work items if mesh has changed
+  InitProlongIndices();
+  if (nprol == 0) {return;}
+  auto &pm = prol_m;
+  auto &pn = prol_n;
   auto &rbuf = recvbuf;
   auto &indcs  = pmy_pack->pmesh->mb_indcs;
   const bool multi_d = pmy_pack->pmesh->multi_d;
@@ -483,14 +486,15 @@ void MeshBoundaryValuesCC::PrimToConsFineBndry(const DvceArray5D<Real> &prim,
   int &nmhd  = pmy_pack->pmhd->nmhd;
   int &nscal = pmy_pack->pmhd->nscalars;
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), (nmb*nnghbr), Kokkos::AUTO);
+  // Outer loop over (# of prolongation work items)
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nprol, Kokkos::AUTO);
   Kokkos::parallel_for("ProlCC", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = tmember.league_rank()/nnghbr;
-    const int n = tmember.league_rank() - m*nnghbr;
+    const int p = tmember.league_rank();
+    const int m = pm.d_view(p);
+    const int n = pn.d_view(p);
 
-    // only prolongate when neighbor exists and is at coarser level
-    if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).lev < mblev.d_view(m))) {
+    // list only contains pairs whose neighbor exists and is at coarser level
+    {
       // loop over indices for prolongation on this buffer
       // Convert indices from coarse to fine arrays
       int il = (rbuf[n].iprol[0].bis - indcs.cis)*2 + indcs.is;
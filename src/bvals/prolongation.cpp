@@ -30,14 +30,7 @@ void MeshBoundaryValuesCC::FillCoarseInBndryCC(DvceArray5D<Real> &a,
                                                DvceArray5D<Real> &ca,
                                                bool is_z4c) {
   // create local references for variables in kernel
-  int nmb = pmy_pack->nmb_thispack;
-  int nnghbr = pmy_pack->pmb->nnghbr;
-  //bool not_z4c = (pmbp->pz4c == nullptr)? true : false;
-
   int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
-  int nmnv = nmb*nnghbr*nvar;
-  auto &nghbr = pmy_pack->pmb->nghbr;
-  auto &mblev = pmy_pack->pmb->mb_lev;
   auto &rbuf = recvbuf;
   auto &indcs  = pmy_pack->pmesh->mb_indcs;
   const bool multi_d = pmy_pack->pmesh->multi_d;
@@ -49,24 +42,31 @@ void MeshBoundaryValuesCC::FillCoarseInBndryCC(DvceArray5D<Real> &a,
   auto& restrict_4th = pmy_pack->pmesh->pmr->weights.restrict_4th;
   auto& restrict_4th_edge = pmy_pack->pmesh->pmr->weights.restrict_4th_edge;
 
+  // (re)build flat lists of (MeshBlock, buffer) work items if mesh has changed
+  InitProlongIndices();
+  auto &sm = same_m;
+  auto &sn = same_n;
+
   // Restrict data into coarse array in any boundary filled with data from the same
   // level.  This ensures data in the coarse array at corners where one direction is a
   // coarser level and the other the same level is filled properly.
   // (Only needed in multidimensions)
 
-  if (multi_d) {
+  if (multi_d && (nsame > 0)) {
     auto &cis = indcs.cis;
     auto &cjs = indcs.cjs;
     auto &cks = indcs.cks;
-    // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
+    // Outer loop over (# of same-level work items)*(# of variables)
+    int nmnv = nsame*nvar;
     Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
     Kokkos::parallel_for("ProlCCSame", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-      const int m = (tmember.league_rank())/(nnghbr*nvar);
-      const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-      const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
+      const int p = (tmember.league_rank())/nvar;
+      const int v = (tmember.league_rank() - p*nvar);
+      const int m = sm.d_view(p);
+      const int n = sn.d_view(p);
 
-      // only restrict when neighbor exists and is at SAME level
-      if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).lev == mblev.d_view(m))) {
+      // list only contains pairs whose neighbor exists and is at the SAME level
+      {
         // loop over indices for receives at same level, but convert loop limits to
         // coarse array
         int il = (rbuf[n].isame[0].bis + cis)/2;
@@ -134,16 +134,7 @@ void MeshBoundaryValuesCC::FillCoarseInBndryCC(DvceArray5D<Real> &a,
 void MeshBoundaryValuesCC::ProlongateCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
     bool is_z4c) {
   // create local references for variables in kernel
-  int nmb = pmy_pack->nmb_thispack;
-  int nnghbr = pmy_pack->pmb->nnghbr;
-
-  // ptr to z4c, which requires different prolongation/restriction scheme
-  //bool not_z4c = (pmbp->pz4c == nullptr)? true : false;
-
   int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
-  int nmnv = nmb*nnghbr*nvar;
-  auto &nghbr = pmy_pack->pmb->nghbr;
-  auto &mblev = pmy_pack->pmb->mb_lev;
   auto &rbuf = recvbuf;
   auto &indcs  = pmy_pack->pmesh->mb_indcs;
   const bool multi_d = pmy_pack->pmesh->multi_d;
@@ -154,15 +145,23 @@ void MeshBoundaryValuesCC::ProlongateCC(DvceArray5D<Real> &a, DvceArray5D<Real>
   auto& prolong_2nd = pmy_pack->pmesh->pmr->weights.prolong_2nd;
   auto& prolong_4th = pmy_pack->pmesh->pmr->weights.prolong_4th;
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
+  // (re)build flat lists of (MeshBlock, buffer) work items if mesh has changed
+  InitProlongIndices();
+  if (nprol == 0) {return;}
+  auto &pm = prol_m;
+  auto &pn = prol_n;
+
+  // Outer loop over (# of prolongation work items)*(# of variables)
+  int nmnv = nprol*nvar;
   Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
   Kokkos::parallel_for("ProlCC", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
+    const int p = (tmember.league_rank())/nvar;
+    const int v = (tmember.league_rank() - p*nvar);
+    const int m = pm.d_view(p);
+    const int n = pn.d_view(p);
 
-    // only prolongate when neighbor exists and is at coarser level
-    if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).lev < mblev.d_view(m))) {
+    // list only contains pairs whose neighbor exists and is at coarser level
+    {
       // loop over indices for prolongation on this buffer
       int il = rbuf[n].iprol[0].bis;
       int iu = rbuf[n].iprol[0].bie;
@@ -219,33 +218,34 @@ void MeshBoundaryValuesCC::ProlongateCC(DvceArray5D<Real> &a, DvceArray5D<Real>
 void MeshBoundaryValuesFC::FillCoarseInBndryFC(DvceFaceFld4D<Real> &b,
                                            DvceFaceFld4D<Real> &cb) {
   // create local references for variables in kernel
-  int nmb = pmy_pack->nmb_thispack;
-  int nnghbr = pmy_pack->pmb->nnghbr;
-
-  auto &nghbr = pmy_pack->pmb->nghbr;
   auto &indcs  = pmy_pack->pmesh->mb_indcs;
-  auto &mblev = pmy_pack->pmb->mb_lev;
   bool &multi_d = pmy_pack->pmesh->multi_d;
   bool &three_d = pmy_pack->pmesh->three_d;
 
+  // (re)build flat lists of (MeshBlock, buffer) work items if mesh has changed
+  InitProlongIndices();
+  auto &sm = same_m;
+  auto &sn = same_n;
+
   // Restrict data into coarse array in any boundary filled with data from the same
   // level. (Only needed in multidimensions)
 
-  if (multi_d) {
-    int nmnv = 3*nmb*nnghbr;
+  if (multi_d && (nsame > 0)) {
+    int nmnv = 3*nsame;
     auto &rbuf = recvbuf;
     auto &cis = indcs.cis;
     auto &cjs = indcs.cjs;
     auto &cks = indcs.cks;
-    // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
+    // Outer loop over (# of same-level work items)*(three field components)
     Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
     Kokkos::parallel_for("ProlFCSame", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-      const int m = (tmember.league_rank())/(3*nnghbr);
-      const int n = (tmember.league_rank() - m*(3*nnghbr))/3;
-      const int v = (tmember.league_rank() - m*(3*nnghbr) - 3*n);
+      const int p = (tmember.league_rank())/3;
+      const int v = (tmember.league_rank() - 3*p);
+      const int m = sm.d_view(p);
+      const int n = sn.d_view(p);
 
-      // only restrict when neighbor exists and is at SAME level
-      if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).lev == mblev.d_view(m))) {
+      // list only contains pairs whose neighbor exists and is at the SAME level
+      {
         // loop over indices for receives at same level, but convert loop limits to
         // coarse array
         int il = (rbuf[n].isame[v].bis + cis)/2;
@@ -314,30 +314,32 @@ void MeshBoundaryValuesFC::FillCoarseInBndryFC(DvceFaceFld4D<Real> &b,
 
 void MeshBoundaryValuesFC::ProlongateFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb) {
   // create local references for variables in kernel
-  int nmb = pmy_pack->nmb_thispack;
-  int nnghbr = pmy_pack->pmb->nnghbr;
-
-  auto &nghbr = pmy_pack->pmb->nghbr;
   auto &indcs  = pmy_pack->pmesh->mb_indcs;
-  auto &mblev = pmy_pack->pmb->mb_lev;
   bool &multi_d = pmy_pack->pmesh->multi_d;
   bool &three_d = pmy_pack->pmesh->three_d;
 
+  // (re)build flat lists of (MeshBlock, buffer) work items if mesh has changed
+  InitProlongIndices();
+  if (nprol == 0) {return;}
+  auto &pm = prol_m;
+  auto &pn = prol_n;
+
   // Prolongate b.x1f/b.x2f/b.x3f at all shared coarse/fine cell edges
   // Code here is based on MeshRefinement::ProlongateSharedFieldX1/2/3() and
   // MeshRefinement::ProlongateInternalField() in C++ version
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(three field components)
-  {int nmnv = 3*nmb*nnghbr;
+  // Outer loop over (# of prolongation work items)*(three field components)
+  {int nmnv = 3*nprol;
   auto &rbuf = recvbuf;
   Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
   Kokkos::parallel_for("ProFC-2d-shared", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(3*nnghbr);
-    const int n = (tmember.league_rank() - m*(3*nnghbr))/3;
-    const int v = (tmember.league_rank() - m*(3*nnghbr) - 3*n);
+    const int p = (tmember.league_rank())/3;
+    const int v = (tmember.league_rank() - 3*p);
+    const int m = pm.d_view(p);
+    const int n = pn.d_view(p);
 
-    // only prolongate when neighbor exists and is at coarser level
-    if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).lev < mblev.d_view(m))) {
+    // list only contains pairs whose neighbor exists and is at coarser level
+    {
       int il = rbuf[n].iprol[v].bis;
       int iu = rbuf[n].iprol[v].bie;
       int jl = rbuf[n].iprol[v].bjs;
@@ -381,17 +383,17 @@ void MeshBoundaryValuesFC::ProlongateFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Re
   // Note prolongation at shared coarse/fine cell edges must be completed first as
   // interpolation formulae use these values.
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)
-  {int nmn = nmb*nnghbr;
-  bool &one_d = pmy_pack->pmesh->one_d;
+  // Outer loop over (# of prolongation work items)
+  {bool &one_d = pmy_pack->pmesh->one_d;
   auto &rbuf = recvbuf;
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), nmn, Kokkos::AUTO);
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nprol, Kokkos::AUTO);
   Kokkos::parallel_for("ProFC-2d-int", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr);
-    const int n = (tmember.league_rank() - m*(nnghbr));
+    const int p = tmember.league_rank();
+    const int m = pm.d_view(p);
+    const int n = pn.d_view(p);
 
-    // only prolongate when neighbor exists and is at coarser level
-    if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).lev < mblev.d_view(m))) {
+    // list only contains pairs whose neighbor exists and is at coarser level
+    {
       // use prolongation indices of different field components for interior fine cells
       int il = rbuf[n].iprol[2].bis;
       int iu = rbuf[n].iprol[2].bie;
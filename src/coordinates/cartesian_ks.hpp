@@ -15,6 +15,7 @@
 #include "globals.hpp"
 #include "mesh/mesh.hpp"
 #include "coordinates/adm.hpp"
+#include "coordinates/coordinates.hpp"
 
 // #define SMALL_NUMBER 1.0e-5
 
@@ -98,6 +99,34 @@ void ComputeMetricAndInverse(Real x, Real y, Real z, bool minkowski, Real a,
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MetricAndInverseAt
+//! \brief returns metric and inverse at the cell center (loc=0) or x1/x2/x3-face center
+//! (loc=1/2/3) of cell (m,k,j,i), reading the precomputed cache when enabled (see
+//! Coordinates::BuildMetricCache()) and otherwise computing the metric in place from
+//! the position (x,y,z) of that location
+
+KOKKOS_INLINE_FUNCTION
+void MetricAndInverseAt(const CoordData &coord, const int loc, const int m, const int k,
+                        const int j, const int i, Real x, Real y, Real z,
+                        Real glower[][4], Real gupper[][4]) {
+  if (coord.cache_metric) {
+    int n=0;
+    for (int a=0; a<4; ++a) {
+      for (int b=a; b<4; ++b) {
+        glower[a][b] = coord.mcache(loc,m,n   ,k,j,i);
+        gupper[a][b] = coord.mcache(loc,m,n+10,k,j,i);
+        glower[b][a] = glower[a][b];
+        gupper[b][a] = gupper[a][b];
+        ++n;
+      }
+    }
+  } else {
+    ComputeMetricAndInverse(x, y, z, coord.is_minkowski, coord.bh_spin, glower, gupper);
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void ComputeADMDecomposition
 //! \brief computes ADM quantitiese in Cartesian Kerr-Schild coordinates
@@ -86,13 +86,82 @@ Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack) :
       int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
       Kokkos::realloc(excision_floor, nmb, ncells3, ncells2, ncells1);
       Kokkos::realloc(excision_flux, nmb, ncells3, ncells2, ncells1);
+      Kokkos::realloc(excision_pencil, nmb, ncells3, ncells2);
       if (coord_data.excision_scheme == ExcisionScheme::fixed) {
         SetExcisionMasks(excision_floor, excision_flux);
+        SetExcisionPencilMask();
+      }
+    }
+
+    // optional precomputed metric cache.  Only available for stationary (analytic)
+    // spacetimes on static meshes, where the metric never changes after construction
+    if (is_general_relativistic) {
+      coord_data.cache_metric = pin->GetOrAddBoolean("coord","cache_metric",false);
+      if (coord_data.cache_metric) {
+        if (ppack->pmesh->adaptive) {
+          std::cout << "### FATAL ERROR in "<< __FILE__ <<" at line " << __LINE__
+                    << std::endl << "<coord>/cache_metric does not support AMR"
+                    << std::endl;
+          std::exit(EXIT_FAILURE);
+        }
+        BuildMetricCache();
       }
     }
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::BuildMetricCache()
+//! \brief precompute metric and inverse at cell centers and face centers of all cells
+//! (including ghosts) of every MeshBlock.  The spacetime is stationary so this is done
+//! once; kernels then read the 10 unique components of each tensor through
+//! MetricAndInverseAt() instead of re-evaluating the metric functions per cell
+
+void Coordinates::BuildMetricCache() {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  int nmb = pmy_pack->nmb_thispack;
+  auto &size = pmy_pack->pmb->mb_size;
+  auto &flat = coord_data.is_minkowski;
+  auto &spin = coord_data.bh_spin;
+
+  // one extra point in each direction holds the upper faces of the last cells
+  Kokkos::realloc(coord_data.mcache, 4, nmb, 20, ncells3+1, ncells2+1, ncells1+1);
+  auto &mcache = coord_data.mcache;
+
+  par_for("metric_cache", DevExeSpace(), 0, 3, 0, (nmb-1), 0, ncells3, 0, ncells2,
+  0, ncells1, KOKKOS_LAMBDA(const int loc, const int m, const int k, const int j,
+                            const int i) {
+    Real &x1min = size.d_view(m).x1min;
+    Real &x1max = size.d_view(m).x1max;
+    Real &x2min = size.d_view(m).x2min;
+    Real &x2max = size.d_view(m).x2max;
+    Real &x3min = size.d_view(m).x3min;
+    Real &x3max = size.d_view(m).x3max;
+    Real x1v = (loc==1)? LeftEdgeX(i-is, indcs.nx1, x1min, x1max)
+                       : CellCenterX(i-is, indcs.nx1, x1min, x1max);
+    Real x2v = (loc==2)? LeftEdgeX(j-js, indcs.nx2, x2min, x2max)
+                       : CellCenterX(j-js, indcs.nx2, x2min, x2max);
+    Real x3v = (loc==3)? LeftEdgeX(k-ks, indcs.nx3, x3min, x3max)
+                       : CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+    Real glower[4][4], gupper[4][4];
+    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+
+    int n=0;
+    for (int a=0; a<4; ++a) {
+      for (int b=a; b<4; ++b) {
+        mcache(loc,m,n   ,k,j,i) = glower[a][b];
+        mcache(loc,m,n+10,k,j,i) = gupper[a][b];
+        ++n;
+      }
+    }
+  });
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn
 // Coordinate (geometric) source term function for GR hydrodynamics
@@ -107,6 +176,7 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = coord_data.is_minkowski;
   auto &spin = coord_data.bh_spin;
+  auto &coord = coord_data;
 
   Real gamma_prime = eos.gamma / (eos.gamma - 1.0);
 
@@ -127,7 +197,7 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    MetricAndInverseAt(coord, 0, m, k, j, i, x1v, x2v, x3v, glower, gupper);
 
     // Extract primitives
     const Real &rho  = prim(m,IDN,k,j,i);
@@ -230,6 +300,7 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = coord_data.is_minkowski;
   auto &spin = coord_data.bh_spin;
+  auto &coord = coord_data;
 
   Real gamma_prime = eos.gamma / (eos.gamma - 1.0);
 
@@ -250,7 +321,7 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    MetricAndInverseAt(coord, 0, m, k, j, i, x1v, x2v, x3v, glower, gupper);
 
     // Extract primitives
     const Real &rho  = prim(m,IDN,k,j,i);
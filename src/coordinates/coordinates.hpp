@@ -41,6 +41,13 @@ struct CoordData {
   Real flux_excise_r;              // reduce to first-order inside this radius
   ExcisionScheme excision_scheme;  // excision method
   Real excise_lapse;               // if excision_scheme = lapse, excise under this lapse
+
+  // optional metric cache for stationary spacetimes (<coord>/cache_metric=true).
+  // Stores the 10 unique components of g_ab followed by those of g^ab at cell centers
+  // (location 0) and x1/x2/x3-face centers (locations 1-3), trading memory bandwidth
+  // for the transcendental metric evaluation repeated in every flux/c2p/source kernel
+  bool cache_metric=false;
+  DvceArray6D<Real> mcache;        // (location,mb,component,k,j,i)
 };
 
 //----------------------------------------------------------------------------------------
@@ -63,13 +70,19 @@ class Coordinates {
   // excision masks
   DvceArray4D<bool> excision_floor;  // cell-centered mask for C2P flooring about horizon
   DvceArray4D<bool> excision_flux;   // cell-centered mask for FOFC about horizon
+  // pencil-level collapse of excision_flux: true where every cell of an i-pencil is
+  // flux-masked, so FOFC rebuilds all of its faces at first order and the high-order
+  // flux sweeps may skip the pencil entirely
+  DvceArray3D<bool> excision_pencil;
 
   // functions
   void CoordSrcTerms(const DvceArray5D<Real> &w0, const EOS_Data &eos, const Real dt,
                      DvceArray5D<Real> &u0);
   void CoordSrcTerms(const DvceArray5D<Real> &w0, const DvceArray5D<Real> &bcc,
                      const EOS_Data &eos, const Real dt, DvceArray5D<Real> &u0);
+  void BuildMetricCache();
   void SetExcisionMasks(DvceArray4D<bool> &floor, DvceArray4D<bool> &flux);
+  void SetExcisionPencilMask();
 
   void UpdateExcisionMasks();
 
@@ -166,6 +166,35 @@ void Coordinates::SetExcisionMasks(DvceArray4D<bool> &excision_floor,
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::SetExcisionPencilMask()
+//  \brief Collapses excision_flux along i into a per-pencil mask. A pencil is marked
+//  only if every one of its cells carries the flux mask; FOFC then rebuilds every face
+//  of those cells at first order each stage, so the high-order flux sweeps can skip
+//  the whole pencil without leaving any consumed face unset.
+
+void Coordinates::SetExcisionPencilMask() {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int n1 = indcs.nx1 + 2*ng;
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng) : 1;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  auto &flux = excision_flux;
+  auto &pencil = excision_pencil;
+
+  par_for("set_excision_pencil", DevExeSpace(), 0, nmb1, 0, (n3-1), 0, (n2-1),
+  KOKKOS_LAMBDA(const int m, const int k, const int j) {
+    bool all_masked = true;
+    for (int i=0; i<n1; ++i) {
+      all_masked = all_masked && flux(m,k,j,i);
+    }
+    pencil(m,k,j) = all_masked;
+  });
+
+  return;
+}
+
 void Coordinates::UpdateExcisionMasks() {
   if (coord_data.excision_scheme == ExcisionScheme::lapse) {
     // capture variables for kernel
@@ -187,5 +216,7 @@ void Coordinates::UpdateExcisionMasks() {
       floor(m,k,j,i) = excise;
       flux(m,k,j,i) = excise;
     });
+
+    SetExcisionPencilMask();
   }
 }
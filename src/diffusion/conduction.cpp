@@ -120,22 +120,19 @@ void Conduction::IsotropicHeatFlux(const DvceArray5D<Real> &w0, const EOS_Data &
   Real gm1 = eos.gamma-1.0;
   Real kappa_ = kappa;
 
+  // stencil work is done per-row by the IsoHeatFluxXn() functions, which are shared
+  // with the fused path inside the Hydro/MHD flux kernels
+  int scr_level = 0;
+  size_t scr_size = 0;
+
   //--------------------------------------------------------------------------------------
   // fluxes in x1-direction
 
   auto &flx1 = flx.x1f;
 
-  par_for("conduct1", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
-  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    // Add heat fluxes into fluxes of conserved variables: energy
-    Real dtempdx = 0.0;
-    if (use_e) {
-      dtempdx = (w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i) - w0(m,IEN,k,j,i-1)/w0(m,IDN,k,j,i-1))
-                * gm1 / size.d_view(m).dx1;
-    } else {
-      dtempdx = (w0(m,ITM,k,j,i) - w0(m,ITM,k,j,i-1)) / size.d_view(m).dx1;
-    }
-    flx1(m,IEN,k,j,i) -= kappa_ * dtempdx;
+  par_for_outer("conduct1",DevExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke, js, je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    IsoHeatFluxX1(member, use_e, gm1, size, kappa_, m, k, j, is, ie+1, w0, flx1);
   });
   if (pmy_pack->pmesh->one_d) {return;}
 
@@ -144,17 +141,9 @@ void Conduction::IsotropicHeatFlux(const DvceArray5D<Real> &w0, const EOS_Data &
 
   auto &flx2 = flx.x2f;
 
-  par_for("conduct2",DevExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
-  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    // Add heat fluxes into fluxes of conserved variables: energy
-    Real dtempdx = 0.0;
-    if (use_e) {
-      dtempdx = (w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i) - w0(m,IEN,k,j-1,i)/w0(m,IDN,k,j-1,i))
-                * gm1 / size.d_view(m).dx2;
-    } else {
-      dtempdx = (w0(m,ITM,k,j,i) - w0(m,ITM,k,j-1,i)) / size.d_view(m).dx2;
-    }
-    flx2(m,IEN,k,j,i) -= kappa_ * dtempdx;
+  par_for_outer("conduct2",DevExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke, js, je+1,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    IsoHeatFluxX2(member, use_e, gm1, size, kappa_, m, k, j, is, ie, w0, flx2);
   });
   if (pmy_pack->pmesh->two_d) {return;}
 
@@ -163,17 +152,9 @@ void Conduction::IsotropicHeatFlux(const DvceArray5D<Real> &w0, const EOS_Data &
 
   auto &flx3 = flx.x3f;
 
-  par_for("conduct3",DevExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
-  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    // Add heat fluxes into fluxes of conserved variables: energy
-    Real dtempdx = 0.0;
-    if (use_e) {
-      dtempdx = (w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i) - w0(m,IEN,k-1,j,i)/w0(m,IDN,k-1,j,i))
-                * gm1 / size.d_view(m).dx3;
-    } else {
-      dtempdx = (w0(m,ITM,k,j,i) - w0(m,ITM,k-1,j,i)) / size.d_view(m).dx3;
-    }
-    flx3(m,IEN,k,j,i) -= kappa_ * dtempdx;
+  par_for_outer("conduct3",DevExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke+1, js, je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    IsoHeatFluxX3(member, use_e, gm1, size, kappa_, m, k, j, is, ie, w0, flx3);
   });
 
   return;
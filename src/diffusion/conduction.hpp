@@ -13,6 +13,7 @@
 
 #include "athena.hpp"
 #include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
 
 //----------------------------------------------------------------------------------------
 //! \class Conduction
@@ -42,4 +43,75 @@ class Conduction {
  private:
   MeshBlockPack* pmy_pack;
 };
+
+//----------------------------------------------------------------------------------------
+//! \fn void IsoHeatFluxX1
+//! \brief Adds isotropic heat flux to the x1-fluxes of one row of cells.  Called from
+//! within the team kernels of IsotropicHeatFlux() and of the Hydro/MHD flux functions,
+//! so the heat flux can be added while the row is still in cache.
+
+KOKKOS_INLINE_FUNCTION
+void IsoHeatFluxX1(TeamMember_t const &member, const bool use_e, const Real gm1,
+     const DualArray1D<RegionSize> &size, const Real kappa,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &w0, const DvceArray5D<Real> &flx1) {
+  par_for_inner(member, il, iu, [&](const int i) {
+    // Add heat fluxes into fluxes of conserved variables: energy
+    Real dtempdx = 0.0;
+    if (use_e) {
+      dtempdx = (w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i) - w0(m,IEN,k,j,i-1)/w0(m,IDN,k,j,i-1))
+                * gm1 / size.d_view(m).dx1;
+    } else {
+      dtempdx = (w0(m,ITM,k,j,i) - w0(m,ITM,k,j,i-1)) / size.d_view(m).dx1;
+    }
+    flx1(m,IEN,k,j,i) -= kappa * dtempdx;
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void IsoHeatFluxX2
+//! \brief Adds isotropic heat flux to the x2-fluxes of one row of cells
+
+KOKKOS_INLINE_FUNCTION
+void IsoHeatFluxX2(TeamMember_t const &member, const bool use_e, const Real gm1,
+     const DualArray1D<RegionSize> &size, const Real kappa,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &w0, const DvceArray5D<Real> &flx2) {
+  par_for_inner(member, il, iu, [&](const int i) {
+    // Add heat fluxes into fluxes of conserved variables: energy
+    Real dtempdx = 0.0;
+    if (use_e) {
+      dtempdx = (w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i) - w0(m,IEN,k,j-1,i)/w0(m,IDN,k,j-1,i))
+                * gm1 / size.d_view(m).dx2;
+    } else {
+      dtempdx = (w0(m,ITM,k,j,i) - w0(m,ITM,k,j-1,i)) / size.d_view(m).dx2;
+    }
+    flx2(m,IEN,k,j,i) -= kappa * dtempdx;
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void IsoHeatFluxX3
+//! \brief Adds isotropic heat flux to the x3-fluxes of one row of cells
+
+KOKKOS_INLINE_FUNCTION
+void IsoHeatFluxX3(TeamMember_t const &member, const bool use_e, const Real gm1,
+     const DualArray1D<RegionSize> &size, const Real kappa,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &w0, const DvceArray5D<Real> &flx3) {
+  par_for_inner(member, il, iu, [&](const int i) {
+    // Add heat fluxes into fluxes of conserved variables: energy
+    Real dtempdx = 0.0;
+    if (use_e) {
+      dtempdx = (w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i) - w0(m,IEN,k-1,j,i)/w0(m,IDN,k-1,j,i))
+                * gm1 / size.d_view(m).dx3;
+    } else {
+      dtempdx = (w0(m,ITM,k,j,i) - w0(m,ITM,k-1,j,i)) / size.d_view(m).dx3;
+    }
+    flx3(m,IEN,k,j,i) -= kappa * dtempdx;
+  });
+  return;
+}
 #endif // DIFFUSION_CONDUCTION_HPP_
@@ -37,4 +37,130 @@ class Viscosity {
   MeshBlockPack* pmy_pack;
 };
 
+//----------------------------------------------------------------------------------------
+//! \fn void IsoViscousFluxX1
+//! \brief Adds isotropic viscous fluxes to the x1-fluxes of one row of cells.  Called
+//! from within the team kernels of IsotropicViscousFlux() and of the Hydro/MHD flux
+//! functions, so the viscous terms can be added while the row is still in cache.
+
+KOKKOS_INLINE_FUNCTION
+void IsoViscousFluxX1(TeamMember_t const &member, const bool is_ideal,
+     const DualArray1D<RegionSize> &size, const Real nu_iso,
+     const bool multi_d, const bool three_d,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &w0, const DvceArray5D<Real> &flx1) {
+  par_for_inner(member, il, iu, [&](const int i) {
+    // Add [2(dVx/dx)-(2/3)dVx/dx, dVy/dx, dVz/dx]
+    Real fvx = 4.0*(w0(m,IVX,k,j,i) - w0(m,IVX,k,j,i-1))/(3.0*size.d_view(m).dx1);
+    Real fvy =     (w0(m,IVY,k,j,i) - w0(m,IVY,k,j,i-1))/size.d_view(m).dx1;
+    Real fvz =     (w0(m,IVZ,k,j,i) - w0(m,IVZ,k,j,i-1))/size.d_view(m).dx1;
+
+    // In 2D/3D Add [(-2/3)dVy/dy, dVx/dy, 0]
+    if (multi_d) {
+      fvx -= ((w0(m,IVY,k,j+1,i) + w0(m,IVY,k,j+1,i-1)) -
+              (w0(m,IVY,k,j-1,i) + w0(m,IVY,k,j-1,i-1)))/(6.0*size.d_view(m).dx2);
+      fvy += ((w0(m,IVX,k,j+1,i) + w0(m,IVX,k,j+1,i-1)) -
+              (w0(m,IVX,k,j-1,i) + w0(m,IVX,k,j-1,i-1)))/(4.0*size.d_view(m).dx2);
+    }
+
+    // In 3D Add [(-2/3)dVz/dz, 0,  dVx/dz]
+    if (three_d) {
+      fvx -= ((w0(m,IVZ,k+1,j,i) + w0(m,IVZ,k+1,j,i-1)) -
+              (w0(m,IVZ,k-1,j,i) + w0(m,IVZ,k-1,j,i-1)))/(6.0*size.d_view(m).dx3);
+      fvz += ((w0(m,IVX,k+1,j,i) + w0(m,IVX,k+1,j,i-1)) -
+              (w0(m,IVX,k-1,j,i) + w0(m,IVX,k-1,j,i-1)))/(4.0*size.d_view(m).dx3);
+    }
+
+    // Sum viscous fluxes into fluxes of conserved variables; including energy fluxes
+    Real nud = 0.5*nu_iso*(w0(m,IDN,k,j,i) + w0(m,IDN,k,j,i-1));
+    flx1(m,IVX,k,j,i) -= nud*fvx;
+    flx1(m,IVY,k,j,i) -= nud*fvy;
+    flx1(m,IVZ,k,j,i) -= nud*fvz;
+    if (is_ideal) {
+      flx1(m,IEN,k,j,i) -= 0.5*nud*((w0(m,IVX,k,j,i-1) + w0(m,IVX,k,j,i))*fvx +
+                                    (w0(m,IVY,k,j,i-1) + w0(m,IVY,k,j,i))*fvy +
+                                    (w0(m,IVZ,k,j,i-1) + w0(m,IVZ,k,j,i))*fvz);
+    }
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void IsoViscousFluxX2
+//! \brief Adds isotropic viscous fluxes to the x2-fluxes of one row of cells
+
+KOKKOS_INLINE_FUNCTION
+void IsoViscousFluxX2(TeamMember_t const &member, const bool is_ideal,
+     const DualArray1D<RegionSize> &size, const Real nu_iso, const bool three_d,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &w0, const DvceArray5D<Real> &flx2) {
+  par_for_inner(member, il, iu, [&](const int i) {
+    // Add [(dVx/dy+dVy/dx), 2(dVy/dy)-(2/3)(dVx/dx+dVy/dy), dVz/dy]
+    Real fvx = (w0(m,IVX,k,j,i  ) - w0(m,IVX,k,j-1,i  ))/size.d_view(m).dx2 +
+              ((w0(m,IVY,k,j,i+1) + w0(m,IVY,k,j-1,i+1)) -
+               (w0(m,IVY,k,j,i-1) + w0(m,IVY,k,j-1,i-1)))/(4.0*size.d_view(m).dx1);
+    Real fvy = (w0(m,IVY,k,j,i) - w0(m,IVY,k,j-1,i))*4.0/(3.0*size.d_view(m).dx2) -
+              ((w0(m,IVX,k,j,i+1) + w0(m,IVX,k,j-1,i+1)) -
+               (w0(m,IVX,k,j,i-1) + w0(m,IVX,k,j-1,i-1)))/(6.0*size.d_view(m).dx1);
+    Real fvz = (w0(m,IVZ,k,j,i  ) - w0(m,IVZ,k,j-1,i  ))/size.d_view(m).dx2;
+
+    // In 3D Add [0, (-2/3)dVz/dz, dVy/dz]
+    if (three_d) {
+      fvy -= ((w0(m,IVZ,k+1,j,i) + w0(m,IVZ,k+1,j-1,i)) -
+              (w0(m,IVZ,k-1,j,i) + w0(m,IVZ,k-1,j-1,i)))/(6.0*size.d_view(m).dx3);
+      fvz += ((w0(m,IVY,k+1,j,i) + w0(m,IVY,k+1,j-1,i)) -
+              (w0(m,IVY,k-1,j,i) + w0(m,IVY,k-1,j-1,i)))/(4.0*size.d_view(m).dx3);
+    }
+
+    // Sum viscous fluxes into fluxes of conserved variables; including energy fluxes
+    Real nud = 0.5*nu_iso*(w0(m,IDN,k,j,i) + w0(m,IDN,k,j-1,i));
+    flx2(m,IVX,k,j,i) -= nud*fvx;
+    flx2(m,IVY,k,j,i) -= nud*fvy;
+    flx2(m,IVZ,k,j,i) -= nud*fvz;
+    if (is_ideal) {
+      flx2(m,IEN,k,j,i) -= 0.5*nud*((w0(m,IVX,k,j-1,i) + w0(m,IVX,k,j,i))*fvx +
+                                    (w0(m,IVY,k,j-1,i) + w0(m,IVY,k,j,i))*fvy +
+                                    (w0(m,IVZ,k,j-1,i) + w0(m,IVZ,k,j,i))*fvz);
+    }
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void IsoViscousFluxX3
+//! \brief Adds isotropic viscous fluxes to the x3-fluxes of one row of cells
+
+KOKKOS_INLINE_FUNCTION
+void IsoViscousFluxX3(TeamMember_t const &member, const bool is_ideal,
+     const DualArray1D<RegionSize> &size, const Real nu_iso,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &w0, const DvceArray5D<Real> &flx3) {
+  par_for_inner(member, il, iu, [&](const int i) {
+    // Add [(dVx/dz+dVz/dx), (dVy/dz+dVz/dy), 2(dVz/dz)-(2/3)(dVx/dx+dVy/dy+dVz/dz)]
+    Real fvx = (w0(m,IVX,k,j,i  ) - w0(m,IVX,k-1,j,i  ))/size.d_view(m).dx3 +
+              ((w0(m,IVZ,k,j,i+1) + w0(m,IVZ,k-1,j,i+1)) -
+               (w0(m,IVZ,k,j,i-1) + w0(m,IVZ,k-1,j,i-1)))/(4.0*size.d_view(m).dx1);
+    Real fvy = (w0(m,IVY,k,j,i  ) - w0(m,IVY,k-1,j,i  ))/size.d_view(m).dx3 +
+              ((w0(m,IVZ,k,j+1,i) + w0(m,IVZ,k-1,j+1,i)) -
+               (w0(m,IVZ,k,j-1,i) + w0(m,IVZ,k-1,j-1,i)))/(4.0*size.d_view(m).dx2);
+    Real fvz = (w0(m,IVZ,k,j,i) - w0(m,IVZ,k-1,j,i))*4.0/(3.0*size.d_view(m).dx3) -
+              ((w0(m,IVX,k,j,i+1) + w0(m,IVX,k-1,j,i+1)) -
+               (w0(m,IVX,k,j,i-1) + w0(m,IVX,k-1,j,i-1)))/(6.0*size.d_view(m).dx1) -
+              ((w0(m,IVY,k,j+1,i) + w0(m,IVY,k-1,j+1,i)) -
+               (w0(m,IVY,k,j-1,i) + w0(m,IVY,k-1,j-1,i)))/(6.0*size.d_view(m).dx2);
+
+    // Sum viscous fluxes into fluxes of conserved variables; including energy fluxes
+    Real nud = 0.5*nu_iso*(w0(m,IDN,k,j,i) + w0(m,IDN,k-1,j,i));
+    flx3(m,IVX,k,j,i) -= nud*fvx;
+    flx3(m,IVY,k,j,i) -= nud*fvy;
+    flx3(m,IVZ,k,j,i) -= nud*fvz;
+    if (is_ideal) {
+      flx3(m,IEN,k,j,i) -= 0.5*nud*((w0(m,IVX,k-1,j,i) + w0(m,IVX,k,j,i))*fvx +
+                                    (w0(m,IVY,k-1,j,i) + w0(m,IVY,k,j,i))*fvy +
+                                    (w0(m,IVZ,k-1,j,i) + w0(m,IVZ,k,j,i))*fvz);
+    }
+  });
+  return;
+}
+
 #endif // DIFFUSION_VISCOSITY_HPP_
@@ -6,29 +6,72 @@
 //! \file driver.cpp
 //  \brief implementation of functions in class Driver
 
+#include <cmath>      // ceil(), sqrt()
+#include <cstdio>     // fopen(), fprintf(), fclose()
 #include <iostream>
 #include <iomanip>    // std::setprecision()
 #include <limits>
 #include <algorithm>
 #include <string> // string
+#include <thread>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
 #include "outputs/outputs.hpp"
+#include "bvals/bvals.hpp"
+#include "coordinates/coordinates.hpp"
+#include "diffusion/viscosity.hpp"
+#include "diffusion/conduction.hpp"
+#include "srcterms/srcterms.hpp"
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
 #include "z4c/z4c.hpp"
 #include "dyn_grmhd/dyn_grmhd.hpp"
 #include "ion-neutral/ion-neutral.hpp"
 #include "radiation/radiation.hpp"
+#include "utils/kernel_tuner.hpp"
+#include "utils/memory_accounting.hpp"
+#include "utils/startup_timing.hpp"
+#include "utils/sync_audit.hpp"
+#include "utils/uvm_spill.hpp"
 #include "driver.hpp"
 
 #if MPI_PARALLEL_ENABLED
 #include <mpi.h>
 #endif
 
+// Aliases for the CUDA/HIP graph runtime API used by ExecuteTaskListGraph()
+#if defined(KOKKOS_ENABLE_CUDA)
+#include <cuda_runtime.h>
+#define gpuGraph_t cudaGraph_t
+#define gpuGraphExec_t cudaGraphExec_t
+#define gpuStream_t cudaStream_t
+#define gpuError_t cudaError_t
+#define gpuSuccess cudaSuccess
+#define gpuStreamBeginCapture cudaStreamBeginCapture
+#define gpuStreamEndCapture cudaStreamEndCapture
+#define gpuStreamCaptureModeThreadLocal cudaStreamCaptureModeThreadLocal
+#define gpuGraphLaunch cudaGraphLaunch
+#define gpuGraphDestroy cudaGraphDestroy
+#define gpuGraphExecDestroy cudaGraphExecDestroy
+#elif defined(KOKKOS_ENABLE_HIP)
+#include <hip/hip_runtime.h>
+#define gpuGraph_t hipGraph_t
+#define gpuGraphExec_t hipGraphExec_t
+#define gpuStream_t hipStream_t
+#define gpuError_t hipError_t
+#define gpuSuccess hipSuccess
+#define gpuStreamBeginCapture hipStreamBeginCapture
+#define gpuStreamEndCapture hipStreamEndCapture
+#define gpuStreamCaptureModeThreadLocal hipStreamCaptureModeThreadLocal
+#define gpuGraphLaunch hipGraphLaunch
+#define gpuGraphDestroy hipGraphDestroy
+#define gpuGraphExecDestroy hipGraphExecDestroy
+#endif
+
 //----------------------------------------------------------------------------------------
 // constructor, initializes data structures and parameters
 //
@@ -59,6 +102,8 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
   tlim(-1.0),
   nlim(-1),
   ndiag(1),
+  ndiag_break(0),
+  startup_report(false),
   nmb_updated_(0),
   npart_updated_(0),
   lb_efficiency_(0),
@@ -81,12 +126,93 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
     }
   } // extra brace to limit scope of string
 
+  // per-phase startup timing report, printed just before cycling begins
+  startup_report = pin->GetOrAddBoolean("time", "startup_report", false);
+
   // read <time> parameters controlling driver if run requires time-evolution
   if (time_evolution != TimeEvolution::tstatic) {
     integrator = pin->GetOrAddString("time", "integrator", "rk2");
     tlim = pin->GetReal("time", "tlim");
     nlim = pin->GetOrAddInteger("time", "nlim", -1);
     ndiag = pin->GetOrAddInteger("time", "ndiag", 1);
+    kernel_graph = pin->GetOrAddBoolean("time", "kernel_graph", false);
+    // super-time-stepping of explicit diffusion (viscosity and thermal conduction),
+    // operator-split from the main integrator; see SuperTimeStep()
+    sts = pin->GetOrAddBoolean("time", "sts", false);
+    sts_nstages = 0;
+    pmesh->sts_diffusion = sts;
+    TaskList::timing = pin->GetOrAddBoolean("time", "task_timing", false);
+    // cadence of rolling cycle-time breakdown lines; needs the per-task timers
+    ndiag_break = pin->GetOrAddInteger("time", "ndiag_breakdown", 0);
+    if (ndiag_break > 0) {TaskList::timing = true;}
+    // wrap every task call in a named Kokkos Profiling region for external profilers
+    TaskList::profiling_regions = pin->GetOrAddBoolean("time", "profiling_regions",
+                                                       false);
+    task_trace = pin->GetOrAddBoolean("time", "task_trace", false);
+    if (task_trace) {
+      trace_start_ = pin->GetOrAddInteger("time", "task_trace_start", 0);
+      trace_stop_ = pin->GetOrAddInteger("time", "task_trace_stop", trace_start_ + 10);
+    }
+
+    // kernel_graph mode captures each stage's kernel sequence into a CUDA/HIP graph and
+    // submits it as a single launch.  Capture forbids host synchronization of the device
+    // stream, so this mode requires a non-MPI GPU build (MPI boundary tasks fence before
+    // sends) and a static mesh (AMR changes the kernel sequence between cycles).
+    if (kernel_graph) {
+#if !(defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP))
+      std::cout<<"### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+               <<"<time> kernel_graph=true requires a CUDA or HIP build" << std::endl;
+      std::exit(EXIT_FAILURE);
+#endif
+#if MPI_PARALLEL_ENABLED
+      std::cout<<"### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+               <<"<time> kernel_graph=true is not supported with MPI" << std::endl;
+      std::exit(EXIT_FAILURE);
+#endif
+      if (pmesh->adaptive) {
+        std::cout<<"### FATAL ERROR in "<< __FILE__ <<" at line "<< __LINE__ << std::endl
+                 <<"<time> kernel_graph=true is not supported with AMR" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
+    // hybrid MPI+threads mode for CPU partitions: worker threads drive disjoint sets of
+    // this rank's MeshBlockPacks through their own task lists, sharing the rank's MPI
+    // endpoint (MPI is initialized with MPI_THREAD_MULTIPLE, and every
+    // MeshBoundaryValues object communicates on its own duplicated communicator).  With
+    // the single pack per rank supported today this degenerates to the serial
+    // round-robin in ExecuteTaskList(); it becomes effective once
+    // <mesh>/nmb_packs_per_rank>1 is supported.  The Kokkos host backend must tolerate
+    // kernel launches from concurrent host threads, which the Serial backend does but
+    // the OpenMP backend does not (enforced below); thread count times backend threads
+    // should not exceed the cores available to the rank
+    pack_threads = pin->GetOrAddInteger("time", "pack_threads", 1);
+    if (pack_threads > 1) {
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP)
+      std::cout<<"### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+               <<"<time> pack_threads>1 requires a CPU (host backend) build" << std::endl;
+      std::exit(EXIT_FAILURE);
+#elif defined(KOKKOS_ENABLE_OPENMP)
+      std::cout<<"### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+               <<"<time> pack_threads>1 requires a host backend that supports kernel "
+               <<"launches from concurrent host threads (e.g. Serial, not OpenMP)"
+               << std::endl;
+      std::exit(EXIT_FAILURE);
+#endif
+      // the profiling/tracing diagnostics record from the driving thread and are not
+      // thread-safe, so they cannot be combined with threaded pack execution
+      if (TaskList::profiling_regions || task_trace) {
+        std::cout<<"### FATAL ERROR in "<< __FILE__ <<" at line "<< __LINE__ << std::endl
+                 <<"<time> pack_threads>1 is not supported with profiling_regions or "
+                 <<"task_trace" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
+    // 2N (Williamson) integrators store the running increment in u1; all others store
+    // a copy of U^n there
+    low_storage = false;
+    flux_accum = false;
 
     if (integrator == "rk1") {
       // RK1: first-order Runge-Kutta / the forward Euler (FE) method
@@ -158,6 +284,35 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
       delta[1] = 0.217683334308543;
       delta[2] = 1.065841341361089;
       delta[3] = 0.0;
+    } else if (integrator == "rk3_2n") {
+      // RK3(2N): Williamson (1980) case 7; classic 2N-storage three-stage, third-order RK
+      // Instead of holding a copy of U^n, the second register accumulates the increment
+      //    dU^{l} = a_{l}*dU^{l-1} + dt*R(U^{l-1}),   U^{l} = U^{l-1} + b_{l}*dU^{l},
+      // so the stage-one state copy is skipped and u1 only ever holds O(dt) increments.
+      // Only the Z4c update implements this form; FOFC, constrained transport, and the
+      // post-update source terms in Hydro/MHD all consume a copy of U^n, so the option
+      // is restricted to vacuum spacetime evolution.
+      nimp_stages = 0;
+      nexp_stages = 3;
+      cfl_limit = 1.0;
+      low_storage = true;
+
+      a2n[0] = 0.0;
+      b2n[0] = 1.0/3.0;
+
+      a2n[1] = -5.0/9.0;
+      b2n[1] = 15.0/16.0;
+
+      a2n[2] = -153.0/128.0;
+      b2n[2] = 8.0/15.0;
+
+      if (pin->DoesBlockExist("hydro") || pin->DoesBlockExist("mhd") ||
+          pin->DoesBlockExist("radiation")) {
+        std::cout<<"### FATAL ERROR in "<< __FILE__ <<" at line "<< __LINE__ << std::endl
+                 <<"<time> integrator = rk3_2n only supports vacuum spacetime (z4c) "
+                 <<"evolution" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
     } else if (integrator == "imex2") {
       // IMEX-SSP2(3,2,2): Pareschi & Russo (2005) Table III.
       // two-stage explicit, three-stage implicit, second-order ImEx
@@ -234,6 +389,21 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
          << "Valid choices are [rk1,rk2,rk3,imex2,imex3]." << std::endl;
       exit(EXIT_FAILURE);
     }
+
+    // <time>/flux_accumulation eliminates the second (stage-0 state) register for one-
+    // and two-stage integrators: u1/b1 become aliases of u0/b0 and the weighted stage
+    // combination is rebuilt by re-applying the first stage's flux divergence, which is
+    // still in the flux arrays when the second stage begins (see Hydro::CopyCons()).
+    // Only these integrators keep the stage-0 state within one flux application of the
+    // current one; feature restrictions are validated in Initialize(), once the physics
+    // modules exist
+    flux_accum = pin->GetOrAddBoolean("time", "flux_accumulation", false);
+    if (flux_accum && ((nexp_stages > 2) || (nimp_stages > 0) || low_storage)) {
+      std::cout<<"### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+               <<"<time> flux_accumulation=true requires integrator rk1 or rk2"
+               << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
   }
 }
 
@@ -244,23 +414,180 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
 //! these tasks are to be performed, e.g. which stage of a multi-stage RK integrator.
 
 void Driver::ExecuteTaskList(Mesh *pm, std::string tl, int stage) {
-  MeshBlockPack* pmbp = pm->pmb_pack;
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP)
+  // optionally capture/submit the stage kernel sequence as a single GPU graph
+  if (kernel_graph && (tl.compare("stagen") == 0)) {
+    ExecuteTaskListGraph(pm, tl, stage);
+    return;
+  }
+#endif
   for (int p=0; p<(pm->nmb_packs_thisrank); ++p) {
-    if (!(pmbp->tl_map[tl]->Empty())) {pmbp->tl_map[tl]->Reset();}
+    auto &ptl = pm->pmb_packs[p]->tl_map[tl];
+    if (!(ptl->Empty())) {ptl->Reset();}
+  }
+#if !(defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP) || \
+      defined(KOKKOS_ENABLE_OPENMP))
+  // hybrid threads mode (CPU builds with a thread-tolerant host backend; the ctor
+  // rejects pack_threads>1 on OpenMP builds): worker threads drive disjoint subsets of
+  // this rank's packs concurrently, each running its packs' task lists to completion.
+  // All MPI traffic shares the rank's endpoint; MPI_THREAD_MULTIPLE plus the per-object
+  // duplicated communicators keep concurrent boundary exchanges race-free
+  int nworker = std::min(pack_threads, pm->nmb_packs_thisrank);
+  if (nworker > 1) {
+    std::vector<std::thread> workers;
+    for (int w=0; w<nworker; ++w) {
+      workers.emplace_back([=]() {
+        for (int p=w; p<(pm->nmb_packs_thisrank); p+=nworker) {
+          auto &ptl = pm->pmb_packs[p]->tl_map[tl];
+          if (ptl->Empty()) {continue;}
+          while (ptl->DoAvailable(this, stage) != TaskListStatus::complete) {}
+        }
+      });
+    }
+    for (auto &w : workers) {w.join();}
+    return;
+  }
+#endif
+  // outer profiling region naming the list/stage; DoAvailable() nests one per task
+  if (TaskList::profiling_regions) {
+    Kokkos::Profiling::pushRegion(tl + " stage=" + std::to_string(stage));
   }
+  // round-robin over packs, running whatever tasks have become available in each, so
+  // (e.g.) communication posted by one pack overlaps with compute in another
   int npack_left = (pm->nmb_packs_thisrank);
   while (npack_left > 0) {
-    if (pmbp->tl_map[tl]->Empty()) {
-      npack_left--;
-    } else {
-      if (!pmbp->tl_map[tl]->IsComplete()) {
-        auto status = pmbp->tl_map[tl]->DoAvailable(this, stage);
-        if (status == TaskListStatus::complete) { npack_left--; }
+    npack_left = 0;
+    for (int p=0; p<(pm->nmb_packs_thisrank); ++p) {
+      auto &ptl = pm->pmb_packs[p]->tl_map[tl];
+      if (ptl->Empty() || ptl->IsComplete()) {continue;}
+      auto status = ptl->DoAvailable(this, stage);
+      if (status != TaskListStatus::complete) {npack_left++;}
+    }
+  }
+  if (TaskList::profiling_regions) {Kokkos::Profiling::popRegion();}
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Driver::ExecuteTaskListGraph()
+//! \brief Run the TaskList under CUDA/HIP stream capture and submit the captured kernel
+//! sequence as a single graph launch.  Per-launch latency dominates when MeshBlockPacks
+//! are small, so replacing the ~30 individual kernel submissions per stage with one
+//! graph launch shortens the host critical path.  Kernel parameters (notably dt) change
+//! every cycle, so the sequence is re-captured each call; the capture itself enqueues no
+//! work and is cheap, while graph instantiation is expensive and is only done once per
+//! stage (on the first cycle), after which the instantiated graph is updated in place.
+
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP)
+void Driver::ExecuteTaskListGraph(Mesh *pm, std::string tl, int stage) {
+  // one instantiated graph per explicit stage, persistent across cycles
+  static gpuGraphExec_t graph_exec[5] = {nullptr, nullptr, nullptr, nullptr, nullptr};
+  MeshBlockPack* pmbp = pm->pmb_pack;
+  if (pmbp->tl_map[tl]->Empty()) {return;}
+#if defined(KOKKOS_ENABLE_CUDA)
+  gpuStream_t stream = DevExeSpace().cuda_stream();
+#else
+  gpuStream_t stream = DevExeSpace().hip_stream();
+#endif
+
+  // run task list to completion under capture; no kernels execute during capture, and
+  // in non-MPI builds no stage task blocks on kernel results, so this loop terminates
+  pmbp->tl_map[tl]->Reset();
+  gpuError_t err = gpuStreamBeginCapture(stream, gpuStreamCaptureModeThreadLocal);
+  if (err == gpuSuccess) {
+    while (!(pmbp->tl_map[tl]->IsComplete())) {
+      (void) pmbp->tl_map[tl]->DoAvailable(this, stage);
+    }
+    gpuGraph_t graph;
+    err = gpuStreamEndCapture(stream, &graph);
+    if (err != gpuSuccess) {
+      std::cout<<"### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+               <<"stream capture of stage " << stage << " task list failed; a stage task "
+               <<"performed an operation not permitted during capture" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    // update instantiated graph in place when possible, else (re-)instantiate
+    bool updated = false;
+    if (graph_exec[stage] != nullptr) {
+#if defined(KOKKOS_ENABLE_CUDA)
+#if CUDART_VERSION >= 12000
+      cudaGraphExecUpdateResultInfo update_info;
+      updated = (cudaGraphExecUpdate(graph_exec[stage], graph, &update_info)
+                 == cudaSuccess);
+#else
+      cudaGraphNode_t error_node;
+      cudaGraphExecUpdateResult update_result;
+      updated = (cudaGraphExecUpdate(graph_exec[stage], graph, &error_node,
+                                     &update_result) == cudaSuccess);
+#endif
+#else
+      hipGraphNode_t error_node;
+      hipGraphExecUpdateResult update_result;
+      updated = (hipGraphExecUpdate(graph_exec[stage], graph, &error_node,
+                                    &update_result) == hipSuccess);
+#endif
+      if (!updated) {
+        gpuGraphExecDestroy(graph_exec[stage]);
+        graph_exec[stage] = nullptr;
       }
     }
+    if (!updated) {
+#if defined(KOKKOS_ENABLE_CUDA)
+#if CUDART_VERSION >= 12000
+      err = cudaGraphInstantiate(&(graph_exec[stage]), graph, 0);
+#else
+      err = cudaGraphInstantiate(&(graph_exec[stage]), graph, nullptr, nullptr, 0);
+#endif
+#else
+      err = hipGraphInstantiate(&(graph_exec[stage]), graph, nullptr, nullptr, 0);
+#endif
+      if (err != gpuSuccess) {
+        std::cout<<"### FATAL ERROR in "<< __FILE__ <<" at line "<< __LINE__ << std::endl
+                 <<"instantiation of stage " << stage << " kernel graph failed"
+                 << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+    gpuGraphDestroy(graph);
+
+    // single submission of the whole stage
+    gpuGraphLaunch(graph_exec[stage], stream);
+  } else {
+    // capture unavailable (e.g. another capture in progress); fall back to direct launch
+    pmbp->tl_map[tl]->Reset();
+    while (!(pmbp->tl_map[tl]->IsComplete())) {
+      (void) pmbp->tl_map[tl]->DoAvailable(this, stage);
+    }
   }
   return;
 }
+#endif  // defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP)
+
+//----------------------------------------------------------------------------------------
+//! \fn MaxAbsDiff()
+//  \brief returns maximum absolute difference between the current contents of a device
+//  array and a host copy saved earlier; used to verify warm restarts
+
+namespace {
+Real MaxAbsDiff(const DvceArray5D<Real> &arr, const HostArray5D<Real> &old) {
+  auto now = Kokkos::create_mirror(arr);
+  Kokkos::deep_copy(now, arr);
+  Real dmax = 0.0;
+  for (size_t m=0; m<arr.extent(0); ++m) {
+    for (size_t n=0; n<arr.extent(1); ++n) {
+      for (size_t k=0; k<arr.extent(2); ++k) {
+        for (size_t j=0; j<arr.extent(3); ++j) {
+          for (size_t i=0; i<arr.extent(4); ++i) {
+            dmax = fmax(dmax, fabs(now(m,n,k,j,i) - old(m,n,k,j,i)));
+          }
+        }
+      }
+    }
+  }
+  return dmax;
+}
+} // namespace
 
 //----------------------------------------------------------------------------------------
 // Driver::Initialize()
@@ -268,14 +595,155 @@ void Driver::ExecuteTaskList(Mesh *pm, std::string tl, int stage) {
 //  outputting ICs, and computing initial time step
 
 void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool res_flag) {
-  //---- Step 1.  Set conserved variables in ghost zones for all physics
-  InitBoundaryValuesAndPrimitives(pmesh);
-
-  //---- Step 2.  Compute time step (if problem involves time evolution)
   hydro::Hydro *phydro = pmesh->pmb_pack->phydro;
   mhd::MHD *pmhd = pmesh->pmb_pack->pmhd;
   radiation::Radiation *prad = pmesh->pmb_pack->prad;
   z4c::Z4c *pz4c = pmesh->pmb_pack->pz4c;
+  dyngr::DynGRMHD *pdyngr = pmesh->pmb_pack->pdyngr;
+
+  //---- Step 0.  Validate super-time-stepping configuration (see SuperTimeStep())
+  if (sts) {
+    bool has_diff = false;
+    if (phydro != nullptr) {
+      has_diff = (phydro->pvisc != nullptr) || (phydro->pcond != nullptr);
+    }
+    if (pmhd != nullptr) {
+      has_diff = has_diff || (pmhd->pvisc != nullptr) || (pmhd->pcond != nullptr);
+    }
+    if (!has_diff) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<time> sts=true requires viscosity and/or conduction "
+                << "in <hydro> or <mhd>" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (pmesh->pmb_pack->pcoord->is_special_relativistic ||
+        pmesh->pmb_pack->pcoord->is_general_relativistic) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<time> sts=true only implemented for non-relativistic "
+                << "flows" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    // STS stages do not exchange flux corrections, so conservation at fine/coarse
+    // boundaries would be violated with SMR/AMR
+    if (pmesh->multilevel) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<time> sts=true does not support SMR/AMR" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+
+  //---- Step 0b.  Validate flux-accumulation register elimination (see constructor).
+  // The stage-0 state can only be rebuilt from the saved flux arrays when every term
+  // of the update is in flux form, so anything applied to u0 outside the flux
+  // divergence (source terms, radiation coupling, the orbital remaps of the shearing
+  // box) is excluded, as are physics whose task lists copy into their own second
+  // registers (z4c, radiation, ion-neutral)
+  if ((time_evolution != TimeEvolution::tstatic) && flux_accum) {
+    if (sts) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<time> flux_accumulation=true cannot be used with sts"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if ((prad != nullptr) || (pz4c != nullptr) || (pdyngr != nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<time> flux_accumulation=true is only implemented for "
+                << "hydro and mhd evolution" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    bool has_src = (pmesh->pgen->user_srcs) ||
+                   (pmesh->pmb_pack->pcoord->is_general_relativistic);
+    if (phydro != nullptr) {
+      has_src = has_src || (phydro->psrc->const_accel) || (phydro->psrc->ism_cooling) ||
+                (phydro->psrc->rel_cooling) || (phydro->psrc->shearing_box);
+    }
+    if (pmhd != nullptr) {
+      has_src = has_src || (pmhd->psrc->const_accel) || (pmhd->psrc->ism_cooling) ||
+                (pmhd->psrc->rel_cooling) || (pmhd->psrc->shearing_box);
+    }
+    if (has_src) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<time> flux_accumulation=true cannot be used with "
+                << "source terms (including shearing box and GR coordinate terms)"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if ((pmhd != nullptr) && (pmhd->fused_corner_e_ct)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<time> flux_accumulation=true cannot be used with "
+                << "<mhd>/fused_corner_e_ct (interior corner EMFs are never stored)"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+
+  //---- Step 1.  Set conserved variables in ghost zones for all physics
+  // Restart dumps store conserved variables including ghost zones, which were current
+  // when the file was written, so on restarts with <job>/warm_restart=true the full
+  // boundary exchange is redundant and is skipped; only derived quantities not stored
+  // in the file (primitives, ADM variables) are recomputed.  Setting
+  // <job>/warm_restart_verify=true instead runs the full exchange and reports the
+  // maximum change it makes to the conserved variables read from the file, which should
+  // be zero for a consistent restart.
+  bool warm_restart = false, verify = false;
+  if (res_flag) {
+    warm_restart = pin->GetOrAddBoolean("job", "warm_restart", false);
+    verify = warm_restart && pin->GetOrAddBoolean("job", "warm_restart_verify", false);
+  }
+
+  if (warm_restart && !verify) {
+    if (phydro != nullptr) {
+      (void) phydro->ConToPrim(this, 0);
+    }
+    if (pmhd != nullptr) {
+      if (pdyngr == nullptr) {
+        (void) pmhd->ConToPrim(this, 0);
+      } else {
+        if (pz4c != nullptr) {
+          (void) pz4c->ConvertZ4cToADM(this, 0);
+        }
+        (void) pdyngr->ConToPrim(this, 0);
+      }
+    }
+  } else {
+    HostArray5D<Real> hyd_old, mhd_old, z4c_old;
+    if (verify) {
+      // create_mirror always allocates, so these are copies even on host-only builds
+      if (phydro != nullptr) {
+        hyd_old = Kokkos::create_mirror(phydro->u0);
+        Kokkos::deep_copy(hyd_old, phydro->u0);
+      }
+      if (pmhd != nullptr) {
+        mhd_old = Kokkos::create_mirror(pmhd->u0);
+        Kokkos::deep_copy(mhd_old, pmhd->u0);
+      }
+      if (pz4c != nullptr) {
+        z4c_old = Kokkos::create_mirror(pz4c->u0);
+        Kokkos::deep_copy(z4c_old, pz4c->u0);
+      }
+    }
+    InitBoundaryValuesAndPrimitives(pmesh);
+    if (verify) {
+      Real dmax = 0.0;
+      if (phydro != nullptr) {dmax = fmax(dmax, MaxAbsDiff(phydro->u0, hyd_old));}
+      if (pmhd != nullptr) {dmax = fmax(dmax, MaxAbsDiff(pmhd->u0, mhd_old));}
+      if (pz4c != nullptr) {dmax = fmax(dmax, MaxAbsDiff(pz4c->u0, z4c_old));}
+#if MPI_PARALLEL_ENABLED
+      MPI_Allreduce(MPI_IN_PLACE, &dmax, 1, MPI_ATHENA_REAL, MPI_MAX, MPI_COMM_WORLD);
+#endif
+      if (global_variable::my_rank == 0) {
+        std::cout << "warm_restart_verify: boundary exchange changed conserved "
+                  << "variables by at most " << dmax << std::endl;
+        if (dmax > 0.0) {
+          std::cout << "WARNING: restart file ghost zones differ from exchange; "
+                    << "warm_restart=true would not reproduce this run" << std::endl;
+        }
+      }
+    }
+  }
+  startup_timing::MarkPhase("initial_exchanges");
+
+  //---- Step 2.  Compute time step (if problem involves time evolution)
   if (time_evolution != TimeEvolution::tstatic) {
     if (phydro != nullptr) {
       (void) pmesh->pmb_pack->phydro->NewTimeStep(this, nexp_stages);
@@ -300,6 +768,7 @@ void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool re
       out->WriteOutputFile(pmesh, pin);
     }
   }
+  startup_timing::MarkPhase("initial_outputs");
 
   //---- Step 4.  Initialize various counters, timers, etc.
   run_time_.reset();
@@ -334,6 +803,8 @@ void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool re
 //! performs outputs. Updates counters like (ncycle, time, etc.)
 
 void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
+  // print per-phase startup timing (collective, so called on all ranks)
+  if (startup_report) {startup_timing::Report();}
   if (global_variable::my_rank == 0) {
     std::cout << "\nSetup complete, executing task list(s)...\n" << std::endl;
   }
@@ -349,7 +820,28 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
            (elapsed_time < wall_time)) {
       if (global_variable::my_rank == 0) {OutputCycleDiagnostics(pmesh);}
 
+      // roll per-cycle host-device sync counters when <mesh>/sync_audit=true
+      sync_audit::BeginCycle(pmesh->ncycle);
+      // roll per-cycle armed-allocation counters when <mesh>/alloc_audit=true
+      memory_accounting::AuditBeginCycle(pmesh->ncycle);
+
+      // apply the launch-parameter candidate to be timed when <mesh>/autotune=true
+      kernel_tuner::BeginCycle();
+
+      // record task intervals for cycles inside the trace window
+      if (task_trace) {
+        TaskTrace::active = (pmesh->ncycle >= trace_start_) &&
+                            (pmesh->ncycle <= trace_stop_);
+        TaskTrace::cycle = pmesh->ncycle;
+      }
+
       // Execute TaskLists
+      // time full cycle when feeding measured MeshBlock costs to the load balancer
+      Kokkos::Timer cycle_timer;
+      // in strict mode, any host-device sync inside task list execution is fatal
+      sync_audit::ArmStrict();
+      // count (or, in strict mode, forbid) allocations inside task list execution
+      memory_accounting::ArmAudit();
       // Work before time integrator indicated by "0" in stage
       ExecuteTaskList(pmesh, "before_timeintegrator", 0);
 
@@ -360,8 +852,24 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
         ExecuteTaskList(pmesh, "after_stagen", stage);
       }
 
+      // operator-split super-time-stepped update of diffusive terms
+      if (sts) {SuperTimeStep(pmesh);}
+
       // Work after time integrator indicated by "1" in stage
       ExecuteTaskList(pmesh, "after_timeintegrator", 1);
+      sync_audit::DisarmStrict();  // AMR, load balancing, and outputs may sync
+      memory_accounting::DisarmAudit();  // AMR, load balancing, and outputs may allocate
+
+      // record measured cycle time for the autotuner sweep (no-op once tuning is done)
+      kernel_tuner::EndCycle(cycle_timer);
+
+      // fold measured cycle wallclock and/or per-block particle counts into the
+      // per-MeshBlock costs for the load balancer
+      if (pmesh->adaptive &&
+          (pmesh->pmr->lb_measured_cost || pmesh->pmr->lb_particle_cost)) {
+        Kokkos::fence();  // ensure all kernels from this cycle are charged to it
+        pmesh->pmr->UpdateMeasuredCosts(cycle_timer.seconds());
+      }
 
       // Work outside of TaskLists:
       // increment time, ncycle, etc.
@@ -380,6 +888,7 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       }
 
       // Test for/make outputs
+      Kokkos::Timer output_timer;
       for (auto &out : pout->pout_list) {
         // compare at floating point (32-bit) precision to reduce effect of round off
         float time_32 = static_cast<float>(pmesh->time);
@@ -393,6 +902,7 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
           out->WriteOutputFile(pmesh, pin);
         }
       }
+      time_output_ += output_timer.seconds();
 
       // AMR
       if (pmesh->adaptive) {pmesh->pmr->AdaptiveMeshRefinement(this, pin);}
@@ -408,6 +918,88 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn Driver::SuperTimeStep()
+//! \brief Advances viscosity and thermal conduction over the full timestep using the
+//! s-stage RKL2 super-time-stepping scheme of Meyer, Balsara, & Aslam (2014), operator-
+//! split from the main integrator.  The super-step is stable for
+//!     dt <= dt_exp*(s^2 + s - 2)/4,
+//! where dt_exp is the explicit diffusive stability limit, so the number of diffusive
+//! RHS evaluations per cycle grows only as sqrt(dt/dt_exp) instead of the dt/dt_exp of
+//! plain subcycling.  Each stage applies only the diffusive operators (computed from
+//! current primitives via the same flux functions used by the main integrator), then
+//! performs a full boundary exchange and con2prim so the next stage sees updated ghost
+//! zones.  Resistivity updates face-centered fields through the corner EMFs in the CT
+//! algorithm and remains on the main integrator.
+
+void Driver::SuperTimeStep(Mesh *pm) {
+  hydro::Hydro *phydro = pm->pmb_pack->phydro;
+  mhd::MHD *pmhd = pm->pmb_pack->pmhd;
+  Real dt = pm->dt;
+
+  // only advance physics that have a super-time-stepped operator (their STS registers
+  // are only allocated in that case)
+  bool do_hyd = (phydro != nullptr) &&
+                ((phydro->pvisc != nullptr) || (phydro->pcond != nullptr));
+  bool do_mhd = (pmhd != nullptr) &&
+                ((pmhd->pvisc != nullptr) || (pmhd->pcond != nullptr));
+
+  // explicit stability limit of the super-time-stepped operators, with the same CFL
+  // factor Mesh::NewTimeStep() would have applied had they limited the timestep
+  Real dt_exp = static_cast<Real>(std::numeric_limits<float>::max());
+  if (phydro != nullptr) {
+    if (phydro->pvisc != nullptr) {
+      dt_exp = std::min(dt_exp, (pm->cfl_no)*(phydro->pvisc->dtnew));
+    }
+    if (phydro->pcond != nullptr) {
+      dt_exp = std::min(dt_exp, (pm->cfl_no)*(phydro->pcond->dtnew));
+    }
+  }
+  if (pmhd != nullptr) {
+    if (pmhd->pvisc != nullptr) {
+      dt_exp = std::min(dt_exp, (pm->cfl_no)*(pmhd->pvisc->dtnew));
+    }
+    if (pmhd->pcond != nullptr) {
+      dt_exp = std::min(dt_exp, (pm->cfl_no)*(pmhd->pcond->dtnew));
+    }
+  }
+
+  // smallest stage count s >= 2 satisfying the stability condition above
+  int s = 2;
+  if (dt > dt_exp) {
+    s = static_cast<int>(std::ceil(0.5*(std::sqrt(9.0 + 16.0*(dt/dt_exp)) - 1.0)));
+    s = std::max(s, 2);
+  }
+  sts_nstages = s;
+
+  // RKL2 recurrence (MBA14 eqs. 2.9-2.10):
+  //   Y_0 = U^n,   Y_1 = Y_0 + mu_tilde_1*dt*L(Y_0),
+  //   Y_j = mu_j*Y_{j-1} + nu_j*Y_{j-2} + (1 - mu_j - nu_j)*Y_0
+  //       + mu_tilde_j*dt*L(Y_{j-1}) + gamma_tilde_j*dt*L(Y_0),
+  // with b_0 = b_1 = 1/3 and b_j = (j^2+j-2)/(2j(j+1)) thereafter.  The first stage
+  // also saves Y_0 and L(Y_0), which every later stage reuses
+  Real w1 = 4.0/(static_cast<Real>(s)*s + s - 2.0);
+  if (do_hyd) {phydro->STSUpdate(1, dt, 0.0, 0.0, w1/3.0, 0.0);}
+  if (do_mhd) {pmhd->STSUpdate(1, dt, 0.0, 0.0, w1/3.0, 0.0);}
+  InitBoundaryValuesAndPrimitives(pm);
+
+  Real bjm2 = 1.0/3.0, bjm1 = 1.0/3.0;
+  for (int j=2; j<=s; ++j) {
+    Real jr = static_cast<Real>(j);
+    Real bj = (jr*jr + jr - 2.0)/(2.0*jr*(jr + 1.0));
+    Real mu = ((2.0*jr - 1.0)/jr)*(bj/bjm1);
+    Real nu = -((jr - 1.0)/jr)*(bj/bjm2);
+    Real mu_tilde = w1*mu;
+    Real gamma_tilde = -(1.0 - bjm1)*mu_tilde;
+    if (do_hyd) {phydro->STSUpdate(j, dt, mu, nu, mu_tilde, gamma_tilde);}
+    if (do_mhd) {pmhd->STSUpdate(j, dt, mu, nu, mu_tilde, gamma_tilde);}
+    InitBoundaryValuesAndPrimitives(pm);
+    bjm2 = bjm1;
+    bjm1 = bj;
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn Driver::Finalize()
 //! \brief Tasks to be performed after execution of Driver, such as making final output
@@ -450,6 +1042,11 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       std::cout << "time=" << pmesh->time << " cycle=" << pmesh->ncycle << std::endl;
       std::cout << "tlim=" << tlim << " nlim=" << nlim << std::endl;
 
+      if (pmesh->async_dt && (pmesh->async_dt_nviol > 0)) {
+        std::cout << std::endl << "async_dt: lagged dt exceeded global min dt in "
+          << pmesh->async_dt_nviol << " cycle(s)" << std::endl;
+      }
+
       if (pmesh->adaptive) {
         std::cout << std::endl << "Current number of MeshBlocks = " << pmesh->nmb_total
           << std::endl << pmesh->pmr->nmb_created << " MeshBlocks created, "
@@ -472,6 +1069,23 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       std::cout << "zone-cycles/cpu_second = " << zcps << std::endl;
       std::cout << "particle-updates/cpu_second = " << pups << std::endl;
     }
+
+    // print per-task timing table (called on all ranks for MPI reduction)
+    if (TaskList::timing) {OutputTaskTimes(pmesh);}
+#if MPI_PARALLEL_ENABLED
+    // print communication matrix when enabled (called on all ranks for MPI gather)
+    MeshBoundaryValues::OutputCommMatrix();
+#endif
+    // print per-subsystem device memory table when <mesh>/memory_accounting=true
+    memory_accounting::Report();
+    // print table of in-cycle allocations when <mesh>/alloc_audit=true
+    memory_accounting::AuditReport();
+    // print per-label host-device sync table when <mesh>/sync_audit=true
+    sync_audit::Report();
+    // print table of managed-memory (spill) arrays when <mesh>/uvm_spill=true
+    uvm_spill::Report();
+    // write per-rank Chrome trace of task execution intervals
+    if (task_trace) {OutputTaskTrace();}
   }
   return;
 }
@@ -487,7 +1101,163 @@ void Driver::OutputCycleDiagnostics(Mesh *pm) {
     Real elapsed = pwall_clock_->seconds();
     std::cout << "elapsed=" << elapsed << std::scientific << std::setprecision(dtprcsn)
               << " cycle=" << pm->ncycle << std::scientific << std::setprecision(dtprcsn)
-              << " time=" << pm->time << " dt=" << pm->dt << std::endl;
+              << " time=" << pm->time << " dt=" << pm->dt;
+    if (sts && (sts_nstages > 0)) {
+      std::cout << " sts_nstages=" << sts_nstages;
+    }
+    std::cout << std::endl;
+    // one-line device memory totals, printed only when they changed (i.e. at regrids)
+    memory_accounting::ReportIfChanged();
+  }
+  // rolling breakdown of where wallclock went since the previous breakdown line, built
+  // from the per-task timers (see OutputTaskTimes).  Tasks whose name contains Send/
+  // Recv/Clear, plus all polling time, are counted as "comm"; this absorbs MPI waits,
+  // buffer packing, and the associated host<->device copies.  "io" is time spent in
+  // the output loop, and "other" is the remainder (AMR, timestep reduction, etc.).
+  // Values are rank 0's own times, not averages over ranks.
+  if ((ndiag_break > 0) && (pm->ncycle % ndiag_break == 0)) {
+    double exec_comp = 0.0, exec_comm = 0.0, poll = 0.0;
+    for (auto &tli : pm->pmb_pack->tl_map) {
+      for (auto &task : tli.second->GetTasks()) {
+        std::string name = task.GetName();
+        if ((name.find("Send") != std::string::npos) ||
+            (name.find("Recv") != std::string::npos) ||
+            (name.find("Clear") != std::string::npos)) {
+          exec_comm += task.time_exec;
+        } else {
+          exec_comp += task.time_exec;
+        }
+        poll += task.time_poll;
+      }
+    }
+    double elapsed = pwall_clock_->seconds();
+    double comp = exec_comp - prev_exec_comp_;
+    double comm = (exec_comm - prev_exec_comm_) + (poll - prev_poll_);
+    double io = time_output_ - prev_time_output_;
+    double other = (elapsed - prev_elapsed_) - comp - comm - io;
+    std::cout << "breakdown: comp=" << std::setprecision(3) << comp
+              << " comm=" << comm << " io=" << io << " other=" << other << std::endl;
+    prev_exec_comp_ = exec_comp;
+    prev_exec_comm_ = exec_comm;
+    prev_poll_ = poll;
+    prev_time_output_ = time_output_;
+    prev_elapsed_ = elapsed;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Driver::OutputTaskTimes()
+//! \brief Print table of per-task wallclock times accumulated by TaskList::DoAvailable()
+//! when <time>/task_timing=true, sorted by execution time.  Task lists are identical on
+//! every rank, so per-task entries are summed across ranks element-wise before rank 0
+//! prints.  "t_exec" is time in calls that completed the task, "t_poll" is time in calls
+//! that returned incomplete (e.g. probing for messages that have not arrived).
+
+void Driver::OutputTaskTimes(Mesh *pm) {
+  // flatten tasks into arrays in deterministic (map, then list) order
+  std::vector<std::string> names;
+  std::vector<double> texec, tpoll;
+  std::vector<std::int64_t> ncalls, npolls;
+  for (auto &tli : pm->pmb_pack->tl_map) {
+    for (auto &task : tli.second->GetTasks()) {
+      names.push_back(tli.first + "/" + task.GetName());
+      texec.push_back(task.time_exec);
+      tpoll.push_back(task.time_poll);
+      ncalls.push_back(task.ncalls);
+      npolls.push_back(task.npolls);
+    }
+  }
+  int ntask = static_cast<int>(names.size());
+  if (ntask == 0) {return;}
+
+  // per-rank total task time, reduced to max/avg across ranks as a load-imbalance
+  // measure (1.0 = perfectly balanced) before the per-task entries are summed below
+  double my_total = 0.0;
+  for (int n=0; n<ntask; ++n) {my_total += texec[n] + tpoll[n];}
+  double max_total = my_total, avg_total = my_total;
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, &max_total, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &avg_total, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  avg_total /= global_variable::nranks;
+#endif
+
+#if MPI_PARALLEL_ENABLED
+  if (global_variable::my_rank == 0) {
+    MPI_Reduce(MPI_IN_PLACE, texec.data(), ntask, MPI_DOUBLE, MPI_SUM, 0,MPI_COMM_WORLD);
+    MPI_Reduce(MPI_IN_PLACE, tpoll.data(), ntask, MPI_DOUBLE, MPI_SUM, 0,MPI_COMM_WORLD);
+    MPI_Reduce(MPI_IN_PLACE, ncalls.data(), ntask, MPI_INT64_T, MPI_SUM, 0,
+               MPI_COMM_WORLD);
+    MPI_Reduce(MPI_IN_PLACE, npolls.data(), ntask, MPI_INT64_T, MPI_SUM, 0,
+               MPI_COMM_WORLD);
+  } else {
+    MPI_Reduce(texec.data(), nullptr, ntask, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(tpoll.data(), nullptr, ntask, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(ncalls.data(), nullptr, ntask, MPI_INT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(npolls.data(), nullptr, ntask, MPI_INT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+    return;
+  }
+#endif
+  if (global_variable::my_rank != 0) {return;}
+
+  // sort tasks by decreasing execution time
+  std::vector<int> indx(ntask);
+  for (int n=0; n<ntask; ++n) {indx[n] = n;}
+  std::sort(indx.begin(), indx.end(),
+            [&](int a, int b) {return texec[a] > texec[b];});
+
+  std::cout << std::endl << "Task timing, summed over " << global_variable::nranks
+            << " rank(s):" << std::endl;
+  std::cout << std::left << std::setw(48) << "task" << std::right
+            << std::setw(12) << "t_exec" << std::setw(12) << "t_poll"
+            << std::setw(9) << "ncalls" << std::setw(9) << "npolls" << std::endl;
+  for (int n : indx) {
+    std::cout << std::left << std::setw(48) << names[n] << std::right
+              << std::scientific << std::setprecision(3)
+              << std::setw(12) << texec[n] << std::setw(12) << tpoll[n]
+              << std::setw(9) << ncalls[n] << std::setw(9) << npolls[n] << std::endl;
+  }
+  std::cout << "task-time imbalance (max/avg over ranks) = "
+            << ((avg_total > 0.0)? (max_total/avg_total) : 1.0) << std::endl;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Driver::OutputTaskTrace()
+//! \brief Write task execution intervals recorded by TaskList::DoAvailable() over the
+//! <time>/task_trace_start/stop cycle window to 'tasktrace.<rank>.json' in the Chrome
+//! tracing format ("X" complete events, timestamps in microseconds).  Each rank writes
+//! its own file; load them together in a trace viewer (chrome://tracing, Perfetto) to
+//! see comm/compute overlap across ranks.  Events use pid=rank and tid=stage, with task
+//! name and cycle in the event fields, so stages appear as separate rows per rank.
+
+void Driver::OutputTaskTrace() {
+  std::string fname = "tasktrace." + std::to_string(global_variable::my_rank) + ".json";
+  FILE *pfile;
+  if ((pfile = std::fopen(fname.c_str(),"w")) == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Trace file '" << fname << "' could not be opened"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  std::fprintf(pfile, "{\"traceEvents\":[\n");
+  bool first = true;
+  for (auto &ev : TaskTrace::events) {
+    std::fprintf(pfile,
+      "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+      "\"pid\":%d,\"tid\":%d,\"args\":{\"cycle\":%d}}",
+      (first? "" : ",\n"), ev.name.c_str(), 1.0e6*ev.start, 1.0e6*(ev.stop - ev.start),
+      global_variable::my_rank, ev.stage, ev.cycle);
+    first = false;
+  }
+  std::fprintf(pfile, "\n]}\n");
+  std::fclose(pfile);
+
+  if (global_variable::my_rank == 0) {
+    std::cout << std::endl << "task trace: " << TaskTrace::events.size()
+              << " events written to " << fname << " (and one file per rank)"
+              << std::endl;
   }
   return;
 }
@@ -36,12 +36,22 @@ class Driver {
   Real tlim;      // stopping time
   int nlim;       // cycle-limit
   int ndiag;      // cycles between output of diagnostic information
+  int ndiag_break;  // cycles between cycle-time breakdown lines (0 = disabled)
+  bool startup_report;  // print per-phase startup timing before cycling begins
   // variables for various SSP and ImEx RK integrators
   std::string integrator;          // integrator name (rk1, rk2, rk3)
+  bool kernel_graph;               // capture/launch stage kernels as single GPU graph
+  int pack_threads = 1;            // host threads driving MeshBlockPack task lists
+  bool task_trace;                 // record task intervals for Chrome trace export
+  bool sts;                        // super-time-step viscosity/conduction (RKL2)
+  int sts_nstages;                 // RKL2 stage count used this cycle (diagnostic)
   int nimp_stages;                 // number of implicit stages (ImEx only)
   int nexp_stages;                 // number of explicit stages (both SSP-RK and ImEx)
   Real gam0[4], gam1[4], beta[4];  // weights and fractional timestep per explicit stage
   Real delta[4];                   // weights for updating the intermediate stage (u1)
+  bool low_storage;                // u1 holds the running increment dU (2N integrators)
+  bool flux_accum;                 // u1/b1 alias u0/b0; see <time>/flux_accumulation
+  Real a2n[4], b2n[4];             // Williamson 2N weights per explicit stage
   Real a_twid[4][4], a_impl;       // matrix elements for implicit stages in ImEx
   Real cfl_limit;                  // maximum CFL number for integrator
   Kokkos::Timer* pwall_clock_;     // timer for tracking the wall clock
@@ -49,8 +59,12 @@ class Driver {
 
   // functions
   void ExecuteTaskList(Mesh *pm, std::string tl, int stage);
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP)
+  void ExecuteTaskListGraph(Mesh *pm, std::string tl, int stage);
+#endif
   void Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool rflag);
   void Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout);
+  void SuperTimeStep(Mesh *pm);
   void Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout);
   void InitBoundaryValuesAndPrimitives(Mesh *pm);
 
@@ -59,7 +73,15 @@ class Driver {
   std::uint64_t nmb_updated_;   // running total of MB updated during run
   std::uint64_t npart_updated_; // running total of particles updated during run
   float lb_efficiency_;         // measure of how efficient was load balancing
+  int trace_start_, trace_stop_;  // cycle window recorded when task_trace=true
+  // accumulated output-writing wallclock and snapshots of the category sums at the
+  // last breakdown line, used by OutputCycleDiagnostics() when ndiag_break > 0
+  double time_output_ = 0.0;
+  double prev_exec_comp_ = 0.0, prev_exec_comm_ = 0.0;
+  double prev_poll_ = 0.0, prev_time_output_ = 0.0, prev_elapsed_ = 0.0;
   void OutputCycleDiagnostics(Mesh *pm);
+  void OutputTaskTimes(Mesh *pm);
+  void OutputTaskTrace();
   Real UpdateWallClock();
 };
 #endif // DRIVER_DRIVER_HPP_
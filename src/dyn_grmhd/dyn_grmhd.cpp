@@ -132,7 +132,6 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::QueueDynGRMHDTasks() {
   using namespace mhd;  // NOLINT(build/namespaces)
   using namespace z4c;  // NOLINT(build/namespaces)
   using namespace numrel; // NOLINT(build/namespaces)
-  Z4c *pz4c = pmy_pack->pz4c;
   MHD *pmhd = pmy_pack->pmhd;
   NumericalRelativity *pnr = pmy_pack->pnr;
 
@@ -156,22 +155,14 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::QueueDynGRMHDTasks() {
     abort();
   }
 
-  // Now the rest of the MHD run tasks
-  if (pz4c != nullptr) {
-    pnr->QueueTask(&DynGRMHD::SetTmunu, this, MHD_SetTmunu, "MHD_SetTmunu",
-                   Task_Run, {MHD_CopyU});
-  }
+  // Now the rest of the MHD run tasks. The stress-energy assembly is fused into the
+  // flux sweep (see CalcFluxes), so MHD_Flux also publishes Tmunu for the Z4c RHS.
   pnr->QueueTask(&MHD::SendFlux, pmhd, MHD_SendFlux, "MHD_SendFlux",
                  Task_Run, {MHD_Flux});
   pnr->QueueTask(&MHD::RecvFlux, pmhd, MHD_RecvFlux, "MHD_RecvFlux",
                  Task_Run, {MHD_SendFlux});
-  if (pz4c != nullptr) {
-    pnr->QueueTask(&MHD::RKUpdate, pmhd, MHD_ExplRK, "MHD_ExplRK", Task_Run,
-                   {MHD_RecvFlux, MHD_SetTmunu});
-  } else {
-    pnr->QueueTask(&MHD::RKUpdate, pmhd, MHD_ExplRK, "MHD_ExplRK", Task_Run,
-                   {MHD_RecvFlux});
-  }
+  pnr->QueueTask(&MHD::RKUpdate, pmhd, MHD_ExplRK, "MHD_ExplRK", Task_Run,
+                 {MHD_RecvFlux});
   pnr->QueueTask(&MHD::MHDSrcTerms, pmhd, MHD_AddSrc, "MHD_AddSrc", Task_Run,
                  {MHD_ExplRK});
   pnr->QueueTask(&MHD::RestrictU, pmhd, MHD_RestU, "MHD_RestU", Task_Run, {MHD_AddSrc});
@@ -203,8 +194,7 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::QueueDynGRMHDTasks() {
 template<class EOSPolicy, class ErrorPolicy>
 void DynGRMHDPS<EOSPolicy, ErrorPolicy>::PrimToConInit(int is, int ie, int js, int je,
                                                     int ks, int ke) {
-  eos.PrimToCons(pmy_pack->pmhd->w0, pmy_pack->pmhd->bcc0, pmy_pack->pmhd->u0,
-                 is, ie, js, je, ks, ke);
+  PrimToConBC(is, ie, js, je, ks, ke);
   if (pmy_pack->ptmunu != nullptr) {
     bool fixed = fixed_evolution;
     fixed_evolution = false;
@@ -213,6 +203,18 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::PrimToConInit(int is, int ie, int js, i
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn  void DynGRMHD::PrimToConBC
+//  \brief Batched prim-to-con over an index slab, without the Tmunu refresh done by
+//  PrimToConInit(). Callers that convert several slabs back-to-back (e.g. the boundary
+//  slabs in ApplyPhysicalBCs()) only need a single Tmunu recomputation after the last.
+template<class EOSPolicy, class ErrorPolicy>
+void DynGRMHDPS<EOSPolicy, ErrorPolicy>::PrimToConBC(int is, int ie, int js, int je,
+                                                  int ks, int ke) {
+  eos.PrimToCons(pmy_pack->pmhd->w0, pmy_pack->pmhd->bcc0, pmy_pack->pmhd->u0,
+                 is, ie, js, je, ks, ke);
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn  void DynGRMHD::ConvertInternalEnergyToPressure
 //  \brief
@@ -334,17 +336,26 @@ TaskStatus DynGRMHD::ApplyPhysicalBCs(Driver *pdrive, int stage) {
 
   // We now need to do a PrimToCon on all these boundary points.
   // X1-boundary
-  PrimToConInit(is-ng, is, 0, (n2-1), 0, (n3-1));
-  PrimToConInit(ie, ie+ng, 0, (n2-1), 0, (n3-1));
+  PrimToConBC(is-ng, is, 0, (n2-1), 0, (n3-1));
+  PrimToConBC(ie, ie+ng, 0, (n2-1), 0, (n3-1));
   // X2-boundary
   if (pm->multi_d) {
-    PrimToConInit(0, (n1-1), js-ng, js, 0, (n3-1));
-    PrimToConInit(0, (n1-1), je, je+ng, 0, (n3-1));
+    PrimToConBC(0, (n1-1), js-ng, js, 0, (n3-1));
+    PrimToConBC(0, (n1-1), je, je+ng, 0, (n3-1));
   }
   // X3-boundary
   if (pm->three_d) {
-    PrimToConInit(0, (n1-1), 0, (n2-1), ks-ng, ks);
-    PrimToConInit(0, (n1-1), 0, (n2-1), ke, ke+ng);
+    PrimToConBC(0, (n1-1), 0, (n2-1), ks-ng, ks);
+    PrimToConBC(0, (n1-1), 0, (n2-1), ke, ke+ng);
+  }
+
+  // Refresh Tmunu once for all the slab conversions above; routing each slab through
+  // PrimToConInit() would recompute it over the full interior six times per call.
+  if (pmy_pack->ptmunu != nullptr) {
+    bool fixed = fixed_evolution;
+    fixed_evolution = false;
+    SetTmunu(nullptr, 0);
+    fixed_evolution = fixed;
   }
 
   return TaskStatus::complete;
@@ -354,6 +365,9 @@ TaskStatus DynGRMHD::ApplyPhysicalBCs(Driver *pdrive, int stage) {
 //! \fn  TaskStatus DynGRMHD::SetTmunu(Driver *pdrive, int stage)
 //! \brief Add the perfect fluid contribution to the stress-energy tensor. This is assumed
 //!  to be the first contribution, so it sets the values rather than adding.
+//!  During the evolution the same assembly is fused into the x1 flux sweep (see
+//!  CalcFluxes); this standalone pass only refreshes Tmunu at initialization and after
+//!  the physical-boundary prim/con conversions.
 TaskStatus DynGRMHD::SetTmunu(Driver *pdrive, int stage) {
   if (fixed_evolution) {
     return TaskStatus::complete;
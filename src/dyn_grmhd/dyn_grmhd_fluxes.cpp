@@ -15,6 +15,7 @@
 #include "dyn_grmhd.hpp"
 #include "dyn_grmhd_util.hpp"
 #include "coordinates/adm.hpp"
+#include "z4c/tmunu.hpp"
 #include "eos/eos.hpp"
 #include "diffusion/viscosity.hpp"
 #include "diffusion/conduction.hpp"
@@ -64,6 +65,22 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
     return TaskStatus::complete;
   }
 
+  // When coupled to Z4c, assemble the stress-energy source inside the x1 pass below:
+  // its teams sweep every interior cell and already stream the cell-centered
+  // primitives, field, and metric, so the coupling costs no extra full-grid pass.
+  const bool set_tmunu = (pmy_pack->ptmunu != nullptr);
+  Tmunu::Tmunu_vars tmunu_;
+  if (set_tmunu) {
+    tmunu_ = pmy_pack->ptmunu->tmunu;
+  }
+  auto &u0_ = pmy_pack->pmhd->u0;
+
+  // With excision, FOFC rebuilds every face of a fully flux-masked pencil at first
+  // order each stage, so high-order fluxes computed there are always discarded; the
+  // sweeps below skip such pencils outright.
+  const bool excise_ = pmy_pack->pcoord->coord_data.bh_excise;
+  auto &excision_pencil_ = pmy_pack->pcoord->excision_pencil;
+
   //--------------------------------------------------------------------------------------
   // i-direction
 
@@ -90,6 +107,58 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
   par_for_outer("dyngrflux_x1",DevExeSpace(), scr_size, scr_level,
       0, nmb1, kl, ku, jl, ju,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    // Fused stress-energy assembly (same algebra as DynGRMHD::SetTmunu): only the
+    // interior (k,j) rows of this pass write, and the conserved variables still hold
+    // their beginning-of-stage values because the RK update waits on this task.
+    if (set_tmunu && k >= ks && k <= ke && j >= js && j <= je) {
+      par_for_inner(member, is, ie, [&](const int i) {
+        // Calculate the determinant/volume form
+        Real detg = adm::SpatialDet(adm.g_dd(m,0,0,k,j,i),adm.g_dd(m,0,1,k,j,i),
+                                    adm.g_dd(m,0,2,k,j,i),adm.g_dd(m,1,1,k,j,i),
+                                    adm.g_dd(m,1,2,k,j,i),adm.g_dd(m,2,2,k,j,i));
+        Real ivol = 1.0/sqrt(detg);
+
+        // Calculate the lower velocity components
+        Real v_d[3] = {0.0};
+        Real iW = 0.;
+        Real B_d[3] = {0.0};
+        for (int a = 0; a < 3; ++a) {
+          for (int b = 0; b < 3; ++b) {
+            v_d[a] += w0_(m, IVX + b, k, j, i)*adm.g_dd(m, a, b, k, j, i);
+            iW += w0_(m, IVX + a, k, j, i)*w0_(m, IVX + b, k, j, i) *
+                    adm.g_dd(m, a, b, k, j, i);
+            B_d[a] += b0_(m, b, k, j, i)*adm.g_dd(m, a, b, k, j, i)*ivol;
+          }
+        }
+        iW = 1.0/sqrt(1. + iW);
+        Real Bv = 0.;
+        Real Bsq = 0.;
+        for (int a = 0; a < 3; ++a) {
+          Bv += b0_(m, a, k, j, i) * v_d[a]*ivol;
+          Bsq += b0_(m, a, k, j, i) * B_d[a]*ivol;
+        }
+        Real bsq = (Bsq + Bv*Bv)*(iW*iW);
+
+        tmunu_.E(m, k, j, i) = (u0_(m, IEN, k, j, i) + u0_(m, IDN, k, j, i))*ivol;
+        for (int a = 0; a < 3; ++a) {
+          tmunu_.S_d(m, a, k, j, i) = u0_(m, IM1 + a, k, j, i)*ivol;
+          for (int b = a; b < 3; ++b) {
+            tmunu_.S_dd(m, a, b, k, j, i) =
+                  u0_(m, IM1 + a, k, j, i)*ivol*v_d[b]*iW
+                  - (B_d[a] + Bv*v_d[a])*SQR(iW)*B_d[b]
+                  + (w0_(m, IPR, k, j, i) + 0.5*bsq)*adm.g_dd(m, a, b, k, j, i);
+          }
+        }
+      });
+    }
+
+    // Skip the reconstruction and Riemann solve for fully flux-masked pencils; the
+    // stress-energy assembly above still runs so the matter source stays consistent
+    // with the floored state inside the excision region.
+    if (excise_ && excision_pencil_(m,k,j)) {
+      return;
+    }
+
     ScrArray2D<Real> wl(member.team_scratch(scr_level), nvars, ncells1);
     ScrArray2D<Real> wr(member.team_scratch(scr_level), nvars, ncells1);
     ScrArray2D<Real> bl(member.team_scratch(scr_level), 3, ncells1);
@@ -205,31 +274,40 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
           bl_jp1 = scr4;
         }
 
+        // FOFC rebuilds face j of a fully flux-masked pencil at first order, so its
+        // Riemann solve is skipped; reconstruction is only needed if face j or face
+        // j+1 survives
+        const bool skip_j = excise_ && excision_pencil_(m,k,j);
+        const bool skip_recon =
+            skip_j && (j == ju || excision_pencil_(m,k,j+1));
+
         // Reconstruct qR[j] and qL[j+1]
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
-            DonorCellX2(member, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
-            DonorCellX2(member, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
-            break;
-          case ReconstructionMethod::plm:
-            PiecewiseLinearX2(member, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
-            PiecewiseLinearX2(member, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
-            break;
-          // JF: These higher-order reconstruction methods all need EOS_Data to calculate
-          // a floor. However, it isn't used by DynGRMHD.
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
-            PiecewiseParabolicX2(member,eos_,extrema,false, m, k, j, is-1, ie+1,
-                                 w0_, wl_jp1, wr);
-            PiecewiseParabolicX2(member,eos_,extrema,false, m, k, j, is-1, ie+1,
-                                 b0_, bl_jp1, br);
-            break;
-          case ReconstructionMethod::wenoz:
-            WENOZX2(member, eos_, false, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
-            WENOZX2(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
-            break;
-          default:
-            break;
+        if (!skip_recon) {
+          switch (recon_method_) {
+            case ReconstructionMethod::dc:
+              DonorCellX2(member, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
+              DonorCellX2(member, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
+              break;
+            case ReconstructionMethod::plm:
+              PiecewiseLinearX2(member, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
+              PiecewiseLinearX2(member, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
+              break;
+            // JF: These higher-order reconstruction methods all need EOS_Data to
+            // calculate a floor. However, it isn't used by DynGRMHD.
+            case ReconstructionMethod::ppm4:
+            case ReconstructionMethod::ppmx:
+              PiecewiseParabolicX2(member,eos_,extrema,false, m, k, j, is-1, ie+1,
+                                   w0_, wl_jp1, wr);
+              PiecewiseParabolicX2(member,eos_,extrema,false, m, k, j, is-1, ie+1,
+                                   b0_, bl_jp1, br);
+              break;
+            case ReconstructionMethod::wenoz:
+              WENOZX2(member, eos_, false, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
+              WENOZX2(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
+              break;
+            default:
+              break;
+          }
         }
         // Sync all threads in the team so that scratch memory is consistent
         member.team_barrier();
@@ -247,7 +325,7 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
         auto nscal_ = nvars - nhyd;
         auto &adm_ = adm;
         //int il = is; int iu = ie;
-        if (j>(jl)) {
+        if (j>(jl) && !skip_j) {
           if constexpr (rsolver_method_ == DynGRMHD_RSolver::llf_dyngr) {
             LLF_DYNGR<IVY>(member, dyn_eos, indcs, size, coord, m, k, j, is-1, ie+1,
                       wl, wr, bl, br, by, nhyd_, nscal_, adm_, flx2, e12, e32);
@@ -259,7 +337,7 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
         member.team_barrier();
 
         // Calculate fluxes of scalars (if any)
-        if (nvars > nhyd) {
+        if (nvars > nhyd && !skip_j) {
           for (int n=nhyd; n<nvars; ++n) {
             par_for_inner(member, is-1, ie+1, [&](const int i) {
               if (flx2(m,IDN,k,j,i) >= 0.0) {
@@ -313,31 +391,40 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
           bl_kp1 = scr4;
         }
 
+        // FOFC rebuilds face k of a fully flux-masked pencil at first order, so its
+        // Riemann solve is skipped; reconstruction is only needed if face k or face
+        // k+1 survives
+        const bool skip_k = excise_ && excision_pencil_(m,k,j);
+        const bool skip_recon =
+            skip_k && (k == ku || excision_pencil_(m,k+1,j));
+
         // Reconstruct qR[j] and qL[j+1]
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
-            DonorCellX3(member, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
-            DonorCellX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
-            break;
-          case ReconstructionMethod::plm:
-            PiecewiseLinearX3(member, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
-            PiecewiseLinearX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
-            break;
-          // JF: These higher-order reconstruction methods all need EOS_Data to calculate
-          // a floor. However, it isn't used by DynGRMHD.
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
-            PiecewiseParabolicX3(member,eos_,extrema,false, m, k, j, is-1, ie+1,
-                                 w0_, wl_kp1, wr);
-            PiecewiseParabolicX3(member,eos_,extrema,false, m, k, j, is-1, ie+1,
-                                 b0_, bl_kp1, br);
-            break;
-          case ReconstructionMethod::wenoz:
-            WENOZX3(member, eos_, false, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
-            WENOZX3(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
-            break;
-          default:
-            break;
+        if (!skip_recon) {
+          switch (recon_method_) {
+            case ReconstructionMethod::dc:
+              DonorCellX3(member, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
+              DonorCellX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
+              break;
+            case ReconstructionMethod::plm:
+              PiecewiseLinearX3(member, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
+              PiecewiseLinearX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
+              break;
+            // JF: These higher-order reconstruction methods all need EOS_Data to
+            // calculate a floor. However, it isn't used by DynGRMHD.
+            case ReconstructionMethod::ppm4:
+            case ReconstructionMethod::ppmx:
+              PiecewiseParabolicX3(member,eos_,extrema,false, m, k, j, is-1, ie+1,
+                                   w0_, wl_kp1, wr);
+              PiecewiseParabolicX3(member,eos_,extrema,false, m, k, j, is-1, ie+1,
+                                   b0_, bl_kp1, br);
+              break;
+            case ReconstructionMethod::wenoz:
+              WENOZX3(member, eos_, false, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
+              WENOZX3(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
+              break;
+            default:
+              break;
+          }
         }
         // Sync all threads in the team so that scratch memory is consistent
         member.team_barrier();
@@ -355,7 +442,7 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
         auto &nhyd_ = nhyd;
         auto nscal_ = nvars - nhyd;
         //int il = is; int iu = ie;
-        if (k>(kl)) {
+        if (k>(kl) && !skip_k) {
           if constexpr (rsolver_method_ == DynGRMHD_RSolver::llf_dyngr) {
             LLF_DYNGR<IVZ>(member, dyn_eos, indcs, size, coord, m, k, j, is-1, ie+1,
                       wl, wr, bl, br, bz, nhyd_, nscal_, adm_, flx3, e23, e13);
@@ -367,7 +454,7 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
         member.team_barrier();
 
         // Calculate fluxes of scalars (if any)
-        if (nvars > nhyd) {
+        if (nvars > nhyd && !skip_k) {
           for (int n=nhyd; n<nvars; ++n) {
             par_for_inner(member, is-1, ie+1, [&](const int i) {
               if (flx3(m,IDN,k,j,i) >= 0.0) {
@@ -164,9 +164,15 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::FOFC(Driver *pdriver, int stage) {
   if (multi_d) { jl = js-1, ju = je+1; }
   if (three_d) { kl = ks-1, ku = ke+1; }
 
-  // Replace fluxes with first-order LLF fluxes at i,j,k faces for any cell where FOFC
-  // and/or excision is used (if GR+excising)
-  par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
+  // Build compacted list of indices of all flagged cells, so that the (typically rare
+  // but expensive) flux replacements below are launched over flagged cells only
+  int ni = iu - il + 1;
+  int nji = (ju - jl + 1)*ni;
+  int nkji = (ku - kl + 1)*nji;
+  auto &flist_ = pmy_pack->pmhd->fofc_list;
+  auto &fcnt_ = pmy_pack->pmhd->fofc_count;
+  Kokkos::deep_copy(fcnt_, 0);
+  par_for("FOFC-list", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Check for FOFC flag
     bool fofc_flag = false;
@@ -176,8 +182,32 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::FOFC(Driver *pdriver, int stage) {
     bool fofc_excision = false;
     if (use_excise_) { fofc_excision = excision_flux_(m,k,j,i); }
 
-    // Apply FOFC
     if (fofc_flag || fofc_excision) {
+      int indx = Kokkos::atomic_fetch_add(&fcnt_(0), 1);
+      flist_(indx) = m*nkji + (k-kl)*nji + (j-jl)*ni + (i-il);
+    }
+  });
+
+  // copy number of flagged cells to host; skip the correction passes if none flagged
+  Kokkos::deep_copy(pmy_pack->pmhd->fofc_count_host, fcnt_);
+  int nflagged = pmy_pack->pmhd->fofc_count_host(0);
+  if (nflagged == 0) { return; }
+
+  // Replace fluxes with first-order LLF fluxes at i,j,k faces for any cell where FOFC
+  // and/or excision is used (if GR+excising)
+  par_for("FOFC-flx", DevExeSpace(), 0, nflagged-1,
+  KOKKOS_LAMBDA(const int n) {
+    // Decode flagged cell indices from compacted list
+    int indx = flist_(n);
+    int m = indx/nkji;
+    int k = (indx - m*nkji)/nji;
+    int j = (indx - m*nkji - k*nji)/ni;
+    int i = (indx - m*nkji - k*nji - j*ni) + il;
+    k += kl;
+    j += jl;
+
+    // Apply FOFC
+    {
       // Reconstruct states
       Real wli[NPRIM], wri[NPRIM];
       Real bli[NMAG], bri[NMAG];
@@ -293,18 +323,19 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::FOFC(Driver *pdriver, int stage) {
 
   // Replace fluxes with first-order LLF fluxes at i+1,j+1,k+1 faces for any cell where
   // FOFC and/or excision is used (if GR+excising)
-  par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
-  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    // Check for FOFC flag
-    bool fofc_flag = false;
-    if (use_fofc_) { fofc_flag = fofc_(m,k,j,i); }
-
-    // Check for GR + excision
-    bool fofc_excision = false;
-    if (use_excise_) { fofc_excision = excision_flux_(m,k,j,i); }
+  par_for("FOFC-flx", DevExeSpace(), 0, nflagged-1,
+  KOKKOS_LAMBDA(const int n) {
+    // Decode flagged cell indices from compacted list
+    int indx = flist_(n);
+    int m = indx/nkji;
+    int k = (indx - m*nkji)/nji;
+    int j = (indx - m*nkji - k*nji)/ni;
+    int i = (indx - m*nkji - k*nji - j*ni) + il;
+    k += kl;
+    j += jl;
 
     // Apply FOFC
-    if (fofc_flag || fofc_excision) {
+    {
       // Reconstruct states
       Real wli[NPRIM], wri[NPRIM];
       Real bli[NMAG], bri[NMAG];
@@ -23,6 +23,13 @@ EquationOfState::EquationOfState(std::string bk, MeshBlockPack* pp, ParameterInp
   eos_data.pfloor = pin->GetOrAddReal(bk,"pfloor",(FLT_MIN));
   eos_data.tfloor = pin->GetOrAddReal(bk,"tfloor",(FLT_MIN));
   eos_data.sfloor = pin->GetOrAddReal(bk,"sfloor",(FLT_MIN));
+  // convergence tolerances for the iterative relativistic c2p solvers.  With
+  // c2p_tol_adapt enabled, cells with small velocity and magnetization are only
+  // converged to c2p_tol_loose (truncation error dominates there anyways), which
+  // removes a significant fraction of the total solver iterations
+  eos_data.c2p_tol = pin->GetOrAddReal(bk,"c2p_tol",1.0e-12);
+  eos_data.c2p_tol_loose = pin->GetOrAddReal(bk,"c2p_tol_loose",1.0e-8);
+  eos_data.c2p_tol_adapt = pin->GetOrAddBoolean(bk,"c2p_tol_adapt",false);
 }
 
 //----------------------------------------------------------------------------------------
@@ -31,6 +31,9 @@ struct EOS_Data {
   bool use_e, use_t; // use internal energy density (e) or temperature (t) as primitive
   Real dfloor, pfloor, tfloor, sfloor;  // density, pressure, temperature, entropy floors
   Real gamma_max;    // ceiling on Lorentz factor in SR/GR
+  Real c2p_tol;      // convergence tolerance for iterative relativistic c2p solvers
+  Real c2p_tol_loose;  // looser tolerance used in smooth regions when c2p_tol_adapt set
+  bool c2p_tol_adapt;  // enable per-cell tolerance selection in SR/GR MHD c2p
 
   // IDEAL GAS PRESSURE: converts primitive variable (either internal energy density e
   // or temperature e/d) into pressure.
@@ -358,6 +361,9 @@ class IdealSRMHD : public EquationOfState {
   using EquationOfState::PrimToCons;
 
   IdealSRMHD(MeshBlockPack *pp, ParameterInput *pin);
+  // converged root of the c2p master function per cell, used to warm start the next
+  // inversion (zero entries mean no previous solution)
+  DvceArray4D<Real> c2p_mu;
   void ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
                   DvceArray5D<Real> &prim, DvceArray5D<Real> &bcc,
                   const bool only_testfloors,
@@ -379,6 +385,18 @@ class IdealGRMHD : public EquationOfState {
   using EquationOfState::PrimToCons;
 
   IdealGRMHD(MeshBlockPack *pp, ParameterInput *pin);
+  // converged root of the c2p master function per cell, used to warm start the next
+  // inversion (zero entries mean no previous solution)
+  DvceArray4D<Real> c2p_mu;
+  // sweep the whole grid with a small iteration cap, then re-solve the (rare)
+  // non-converged cells from a compacted list with the full cap (<mhd>/two_pass_c2p)
+  bool two_pass_c2p;
+  // route cells with rest-mass density below atm_threshold*dfloor directly to the
+  // static atmosphere state, skipping the iterative inversion (<mhd>/c2p_atmosphere)
+  bool c2p_atmosphere;
+  Real atm_threshold;
+  DvceArray1D<int> c2p_list;   // compacted list of flattened indices of retry cells
+  DvceArray1D<int> c2p_count;  // single-element device counter for retry cells
   void ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
                   DvceArray5D<Real> &prim, DvceArray5D<Real> &bcc,
                   const bool only_testfloors,
@@ -103,7 +103,9 @@ Real EquationC22(Real z, Real &u_d, Real q, Real r, EOS_Data eos) {
 //----------------------------------------------------------------------------------------
 //! \fn void SingleC2P_IdealSRHyd()
 //! \brief Converts single state of conserved variables into primitive variables for
-//! special relativistic hydrodynamics with an ideal gas EOS.
+//! special relativistic hydrodynamics with an ideal gas EOS.  Roots are found with a
+//! safeguarded Newton fast path inside the analytic bracket (C23), falling back to the
+//! false-position method when the fast path is not applicable.
 
 KOKKOS_INLINE_FUNCTION
 void SingleC2P_IdealSRHyd(HydCons1D &u, const EOS_Data &eos, const Real s2, HydPrim1D &w,
@@ -145,13 +147,49 @@ void SingleC2P_IdealSRHyd(HydCons1D &u, const EOS_Data &eos, const Real s2, HydP
   Real fm = EquationC22(zm, u.d, q, r, eos);
   Real fp = EquationC22(zp, u.d, q, r, eos);
 
-  // For simplicity on the GPU, find roots using the false position method
-  int iterations = max_iterations;
+  Real z = 0.5*(zm + zp);
+  bool converged = false;
   // If bracket within tolerances, don't bother doing any iterations
   if ((fabs(zm-zp) < tol) || ((fabs(fm) + fabs(fp)) < 2.0*tol)) {
-    iterations = -1;
+    converged = true;
   }
-  Real z = 0.5*(zm + zp);
+
+  // Fast path: in SR hydro (no B field) the master function is smooth and the bracket
+  // (C23) is tight, so safeguarded Newton steps from the bracket midpoint, using the
+  // analytic derivative of (C22), nearly always converge in 2-3 iterations.  Fall
+  // through to the false-position loop below if an iterate leaves the bracket, lands on
+  // the internal-energy floor, or has not converged after a few steps.
+  const int newton_iterations = 3;
+  for (iter_used=0; (iter_used < newton_iterations) && !(converged); ++iter_used) {
+    // evaluate (C22) and its z-derivative; mirrors EquationC22() away from the floor
+    Real const lor = sqrt(1.0 + z*z);                 // (C15)
+    Real const wd = u.d/lor;                          // (C15)
+    Real eps = lor*q - z*r + (z*z)/(1.0 + lor);       // (C16)
+    Real epsmin = fmax(eos.pfloor/(wd*gm1), eos.sfloor*pow(wd, gm1)/gm1);
+    if (eps <= epsmin) {break;}  // floored (atmosphere) state; use the robust loop
+    Real const h = 1.0 + eos.gamma*eps;               // (C1) & (C21)
+    Real f = z - r/h;                                 // (C22)
+    if (fabs(f) < tol) {
+      converged = true;
+      break;
+    }
+    Real depsdz = q*z/lor - r + z*(2.0 + lor + 1.0/lor)/SQR(1.0 + lor);
+    Real dfdz = 1.0 + r*eos.gamma*depsdz/SQR(h);
+    Real znew = z - f/dfdz;
+    if (!((znew > zm) && (znew < zp))) {break;}  // left the bracket; use the robust loop
+    // keep the bracket current so a fallback resumes from the narrowed interval
+    if (f*fp < 0.0) {
+      zm = z;
+      fm = f;
+    } else {
+      zp = z;
+      fp = f;
+    }
+    z = znew;
+  }
+
+  // For simplicity on the GPU, find roots using the false position method
+  int iterations = (converged) ? -1 : max_iterations;
 
   for (iter_used=0; iter_used < iterations; ++iter_used) {
     z =  (zm*fp - zp*fm)/(fp-fm);  // linear interpolation to point f(z)=0
@@ -122,14 +122,19 @@ Real Equation44(const Real mu, const Real b2, const Real rpar, const Real r, con
 //! \brief Converts single state of conserved variables into primitive variables for
 //! special relativistic MHD with an ideal gas EOS. Note input CONSERVED state contains
 //! cell-centered magnetic fields, but PRIMITIVE state returned via arguments does not.
+//! The mu argument carries the converged root of the master function in and out: a
+//! positive input is used as a warm start for the bracketing, and the converged value
+//! (or zero on failure) is returned for use as the next inversion's guess.  iter_cap
+//! bounds the false-position iterations; a cell that hits the cap is reported as a c2p
+//! failure, which a caller may treat as "retry with a larger cap" (see ideal_grmhd.cpp).
 
 KOKKOS_INLINE_FUNCTION
 void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, Real rpar,
                           HydPrim1D &w, bool &dfloor_used, bool &efloor_used,
-                          bool &c2p_failure, int &max_iter) {
+                          bool &c2p_failure, int &max_iter, Real &mu,
+                          const int iter_cap = 25) {
   // Parameters
-  const int max_iterations = 25;
-  const Real tol = 1.0e-12;
+  const int max_iterations = iter_cap;
   const Real gm1 = eos.gamma - 1.0;
 
   // apply density floor, without changing momentum or energy
@@ -156,59 +161,87 @@ void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, R
   b2 /= u.d;
   rpar *= isqrtd;
 
-  // Need to find initial bracket. Requires separate solve
-  Real zm=0.;
-  Real zp=1.; // This is the lowest specific enthalpy admitted by the EOS
-
-  // Evaluate master function (eq 49) at bracket values
-  Real fm = Equation49(zm, b2, rpar, r, q);
-  Real fp = Equation49(zp, b2, rpar, r, q);
-
-  // For simplicity on the GPU, find roots using the false position method
-  int iterations = max_iterations;
-  // If bracket within tolerances, don't bother doing any iterations
-  if ((fabs(zm-zp) < tol) || ((fabs(fm) + fabs(fp)) < 2.0*tol)) {
-    iterations = -1;
+  // Convergence tolerance.  With c2p_tol_adapt, cells with small velocity and
+  // magnetization (r ~ h*W*v and b2 ~ 2*p_mag/rho after normalization) only iterate to
+  // the looser tolerance: such states converge far past the truncation error of the
+  // scheme, so the extra iterations buy nothing.  Strongly relativistic or magnetized
+  // cells (e.g. near horizons) always use the tight tolerance.
+  Real tol = eos.c2p_tol;
+  if (eos.c2p_tol_adapt && ((r + b2) < 0.1)) {
+    tol = eos.c2p_tol_loose;
   }
-  Real z = 0.5*(zm + zp);
 
+  // Establish brackets for the root of the master function (eq 44).  When a converged
+  // root from a previous inversion of this cell is passed in (warm start, mu > 0), the
+  // new root almost always lies in a narrow window around it, which the false position
+  // method then collapses in a few iterations.  If the window fails to bracket (root
+  // moved too far, or stale guess after regridding), fall back to the generic cold
+  // start, which requires a separate solve for the upper bound (root of eq 49)
+  Real zm, zp, fm, fp;
   int iter;
-  for (iter=0; iter<iterations; ++iter) {
-    z =  (zm*fp - zp*fm)/(fp-fm);  // linear interpolation to point f(z)=0
-    Real f = Equation49(z, b2, rpar, r, q);
-    // Quit if convergence reached
-    // NOTE(@ermost): both z and f are of order unity
-    if ((fabs(zm-zp) < tol) || (fabs(f) < tol)) {
-      break;
+  bool warm_start = false;
+  if (mu > 0.0) {
+    zm = 0.9*mu;
+    zp = 1.1*mu;
+    fm = Equation44(zm, b2, rpar, r, q, u.d, eos);
+    fp = Equation44(zp, b2, rpar, r, q, u.d, eos);
+    warm_start = (fm*fp < 0.0);
+  }
+
+  if (!(warm_start)) {
+    // Need to find initial bracket. Requires separate solve
+    zm=0.;
+    zp=1.; // This is the lowest specific enthalpy admitted by the EOS
+
+    // Evaluate master function (eq 49) at bracket values
+    fm = Equation49(zm, b2, rpar, r, q);
+    fp = Equation49(zp, b2, rpar, r, q);
+
+    // For simplicity on the GPU, find roots using the false position method
+    int iterations = max_iterations;
+    // If bracket within tolerances, don't bother doing any iterations
+    if ((fabs(zm-zp) < tol) || ((fabs(fm) + fabs(fp)) < 2.0*tol)) {
+      iterations = -1;
     }
-    // assign zm-->zp if root bracketed by [z,zp]
-    if (f*fp < 0.0) {
-      zm = zp;
-      fm = fp;
-      zp = z;
-      fp = f;
-    } else {  // assign zp-->z if root bracketed by [zm,z]
-      fm = 0.5*fm; // 1/2 comes from "Illinois algorithm" to accelerate convergence
-      zp = z;
-      fp = f;
+    Real z0 = 0.5*(zm + zp);
+
+    for (iter=0; iter<iterations; ++iter) {
+      z0 =  (zm*fp - zp*fm)/(fp-fm);  // linear interpolation to point f(z)=0
+      Real f = Equation49(z0, b2, rpar, r, q);
+      // Quit if convergence reached
+      // NOTE(@ermost): both z and f are of order unity
+      if ((fabs(zm-zp) < tol) || (fabs(f) < tol)) {
+        break;
+      }
+      // assign zm-->zp if root bracketed by [z,zp]
+      if (f*fp < 0.0) {
+        zm = zp;
+        fm = fp;
+        zp = z0;
+        fp = f;
+      } else {  // assign zp-->z if root bracketed by [zm,z]
+        fm = 0.5*fm; // 1/2 comes from "Illinois algorithm" to accelerate convergence
+        zp = z0;
+        fp = f;
+      }
     }
-  }
-  max_iter = (iter > max_iter) ? iter : max_iter;
+    max_iter = (iter > max_iter) ? iter : max_iter;
 
-  // Found brackets. Now find solution in bounded interval, again using the
-  // false position method
-  zm= 0.;
-  zp= z;
+    // Found brackets. Now find solution in bounded interval, again using the
+    // false position method
+    zm= 0.;
+    zp= z0;
 
-  // Evaluate master function (eq 44) at bracket values
-  fm = Equation44(zm, b2, rpar, r, q, u.d, eos);
-  fp = Equation44(zp, b2, rpar, r, q, u.d, eos);
+    // Evaluate master function (eq 44) at bracket values
+    fm = Equation44(zm, b2, rpar, r, q, u.d, eos);
+    fp = Equation44(zp, b2, rpar, r, q, u.d, eos);
+  }
 
-  iterations = max_iterations;
+  int iterations = max_iterations;
   if ((fabs(zm-zp) < tol) || ((fabs(fm) + fabs(fp)) < 2.0*tol)) {
     iterations = -1;
   }
-  z = 0.5*(zm + zp);
+  Real z = 0.5*(zm + zp);
 
   for (iter=0; iter<iterations; ++iter) {
     z = (zm*fp - zp*fm)/(fp-fm);  // linear interpolation to point f(z)=0
@@ -243,11 +276,13 @@ void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, R
     w.vy = 0.0;
     w.vz = 0.0;
     c2p_failure = true;
+    mu = 0.0;  // invalidate warm-start cache for this cell
     return;
   }
 
-  // iterations ended, compute primitives from resulting value of z
-  Real &mu = z;
+  // iterations ended, compute primitives from resulting value of z, and return the
+  // converged root so it can seed the next inversion of this cell
+  mu = z;
   Real const x = 1./(1.+mu*b2);                               // (26)
   Real rbar = (x*x*r*r + mu*x*(1.+x)*rpar*rpar);              // (38)
   Real qbar = q - 0.5*b2 - 0.5*(mu*mu*(b2*rbar - rpar*rpar)); // (31)
@@ -283,6 +318,21 @@ void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, R
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void SingleC2P_IdealSRMHD()
+//! \brief Overload without the warm-start argument; always performs a cold start.  Used
+//! by one-shot inversions (e.g. prolongation, turbulence driver) with no cached root.
+
+KOKKOS_INLINE_FUNCTION
+void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, Real rpar,
+                          HydPrim1D &w, bool &dfloor_used, bool &efloor_used,
+                          bool &c2p_failure, int &max_iter) {
+  Real mu = 0.0;
+  SingleC2P_IdealSRMHD(u, eos, s2, b2, rpar, w, dfloor_used, efloor_used,
+                       c2p_failure, max_iter, mu);
+  return;
+}
+
 //--------------------------------------------------------------------------------------
 //! \fn void SingleP2C_IdealSRMHD()
 //! \brief Converts single set of primitive into conserved variables in SRMHD.
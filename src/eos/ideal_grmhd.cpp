@@ -8,6 +8,8 @@
 
 #include <float.h>
 
+#include <algorithm>
+
 #include "athena.hpp"
 #include "mhd/mhd.hpp"
 #include "eos.hpp"
@@ -21,13 +23,40 @@
 // ctor: also calls EOS base class constructor
 
 IdealGRMHD::IdealGRMHD(MeshBlockPack *pp, ParameterInput *pin) :
-    EquationOfState("mhd", pp, pin) {
+    EquationOfState("mhd", pp, pin),
+    c2p_mu("c2p_mu",1,1,1,1),
+    c2p_list("c2p_list",1),
+    c2p_count("c2p_count",1) {
   eos_data.is_ideal = true;
   eos_data.gamma = pin->GetReal("mhd","gamma");
   eos_data.iso_cs = 0.0;
   eos_data.use_e = true;  // ideal gas EOS always uses internal energy
   eos_data.use_t = false;
   eos_data.gamma_max = pin->GetOrAddReal("mhd","gamma_max",(FLT_MAX));  // gamma ceiling
+
+  // allocate warm-start cache for the c2p root-find.  Cached values are only initial
+  // guesses, so entries left stale by AMR or load balancing are harmless
+  auto &indcs = pp->pmesh->mb_indcs;
+  int nmb = std::max((pp->nmb_thispack), (pp->pmesh->nmb_maxperrank));
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  Kokkos::realloc(c2p_mu, nmb, ncells3, ncells2, ncells1);
+  Kokkos::deep_copy(c2p_mu, 0.0);
+
+  // two-pass c2p: the first sweep uses a small iteration cap so warps are not held
+  // hostage by the handful of near-atmosphere cells that iterate to the full cap;
+  // those cells are compacted into a list and re-solved in a second pass
+  two_pass_c2p = pin->GetOrAddBoolean("mhd","two_pass_c2p",false);
+  if (two_pass_c2p) {
+    Kokkos::realloc(c2p_list, nmb*ncells3*ncells2*ncells1);
+  }
+
+  // atmosphere pre-test: cells with rest-mass density below atm_threshold*dfloor are
+  // reset to the static atmosphere state in-kernel, without running the inversion.
+  // Useful for torus/TOV runs where much of the domain sits at the density floor.
+  c2p_atmosphere = pin->GetOrAddBoolean("mhd","c2p_atmosphere",false);
+  atm_threshold = pin->GetOrAddReal("mhd","atm_threshold",1.0);
 }
 
 //----------------------------------------------------------------------------------------
@@ -47,11 +76,20 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
   int &nscal = pmy_pack->pmhd->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
   auto &fofc_ = pmy_pack->pmhd->fofc;
+  auto &c2p_mu_ = c2p_mu;
+  auto &c2p_list_ = c2p_list;
+  auto &c2p_cnt_ = c2p_count;
+  // when two-pass c2p is enabled, the first sweep uses a reduced iteration cap and
+  // defers non-converged cells to the compacted retry pass below
+  const bool retry = two_pass_c2p && !(only_testfloors);
+  const int iter_cap = (retry) ? 8 : 25;
+  if (retry) {Kokkos::deep_copy(c2p_cnt_, 0);}
+  const bool atm_c2p = c2p_atmosphere;
+  const Real atm_dmax = atm_threshold*eos_data.dfloor;
   auto eos = eos_data;
   Real gm1 = eos_data.gamma - 1.0;
 
-  auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
-  auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &coord = pmy_pack->pcoord->coord_data;
   auto &use_excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_floor_ = pmy_pack->pcoord->excision_floor;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
@@ -63,9 +101,11 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
   const int nkji = (ku - kl + 1)*nji;
   const int nmkji = nmb*nkji;
 
-  int nfloord_=0, nfloore_=0, nceilv_=0, nfail_=0, maxit_=0;
-  Kokkos::parallel_reduce("grmhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumv, int &sumf, int &max_it) {
+  // counters are accumulated in the device-resident event counter array with atomics
+  // on the (rare) floor-activation paths, so no per-launch reduction or host sync
+  auto &ectr = pmy_pack->pmesh->ecounter_dvce;
+  Kokkos::parallel_for("grmhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx) {
     int m = (idx)/nkji;
     int k = (idx - m*nkji)/nji;
     int j = (idx - m*nkji - k*nji)/ni;
@@ -108,7 +148,7 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    MetricAndInverseAt(coord, 0, m, k, j, i, x1v, x2v, x3v, glower, gupper);
 
     HydPrim1D w;
     bool dfloor_used=false, efloor_used=false;
@@ -139,24 +179,48 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
       Real s2, b2, rpar;
       TransformToSRMHD(u,glower,gupper,s2,b2,rpar,u_sr);
 
-      // call c2p function
-      // (inline function in ideal_c2p_mhd.hpp file)
-      SingleC2P_IdealSRMHD(u_sr, eos, s2, b2, rpar, w,
-                           dfloor_used, efloor_used, c2p_failure, iter_used);
-
-      // apply velocity ceiling if necessary
-      Real tmp = glower[1][1]*SQR(w.vx)
-               + glower[2][2]*SQR(w.vy)
-               + glower[3][3]*SQR(w.vz)
-               + 2.0*glower[1][2]*w.vx*w.vy + 2.0*glower[1][3]*w.vx*w.vz
-               + 2.0*glower[2][3]*w.vy*w.vz;
-      Real lor = sqrt(1.0+tmp);
-      if (lor > eos.gamma_max) {
-        vceiling_used = true;
-        Real factor = sqrt((SQR(eos.gamma_max)-1.0)/(SQR(lor)-1.0));
-        w.vx *= factor;
-        w.vy *= factor;
-        w.vz *= factor;
+      // atmosphere pre-test: a cell whose rest-mass density sits at/below the floor is
+      // routed straight to the static atmosphere state, skipping the inversion
+      if (atm_c2p && (u_sr.d < atm_dmax)) {
+        w.d = eos.dfloor;
+        w.vx = 0.0;
+        w.vy = 0.0;
+        w.vz = 0.0;
+        w.e = eos.pfloor/gm1;
+        dfloor_used = true;
+        efloor_used = true;
+        c2p_mu_(m,k,j,i) = 0.0;  // no converged root to warm-start from
+      } else {
+        // call c2p function
+        // (inline function in ideal_c2p_mhd.hpp file)
+        Real mu = c2p_mu_(m,k,j,i);  // warm start from previously converged root (if any)
+        SingleC2P_IdealSRMHD(u_sr, eos, s2, b2, rpar, w,
+                             dfloor_used, efloor_used, c2p_failure, iter_used, mu,
+                             iter_cap);
+        c2p_mu_(m,k,j,i) = mu;
+
+        // defer cells that did not converge within the reduced cap to the retry pass,
+        // which re-solves them with the full cap and stores their output
+        if (retry && c2p_failure) {
+          int indx = Kokkos::atomic_fetch_add(&c2p_cnt_(0), 1);
+          c2p_list_(indx) = idx;
+          return;
+        }
+
+        // apply velocity ceiling if necessary
+        Real tmp = glower[1][1]*SQR(w.vx)
+                 + glower[2][2]*SQR(w.vy)
+                 + glower[3][3]*SQR(w.vz)
+                 + 2.0*glower[1][2]*w.vx*w.vy + 2.0*glower[1][3]*w.vx*w.vz
+                 + 2.0*glower[2][3]*w.vy*w.vz;
+        Real lor = sqrt(1.0+tmp);
+        if (lor > eos.gamma_max) {
+          vceiling_used = true;
+          Real factor = sqrt((SQR(eos.gamma_max)-1.0)/(SQR(lor)-1.0));
+          w.vx *= factor;
+          w.vy *= factor;
+          w.vz *= factor;
+        }
       }
     }
 
@@ -164,14 +228,14 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     if (only_testfloors) {
       if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
         fofc_(m,k,j,i) = true;
-        sumd++;  // use dfloor as counter for when either is true
+        Kokkos::atomic_add(&ectr(ECNFOFC), 1);
       }
     } else {
-      if (dfloor_used) {sumd++;}
-      if (efloor_used) {sume++;}
-      if (vceiling_used) {sumv++;}
-      if (c2p_failure) {sumf++;}
-      max_it = (iter_used > max_it) ? iter_used : max_it;
+      if (dfloor_used) {Kokkos::atomic_add(&ectr(ECDFLOOR), 1);}
+      if (efloor_used) {Kokkos::atomic_add(&ectr(ECEFLOOR), 1);}
+      if (vceiling_used) {Kokkos::atomic_add(&ectr(ECVCEIL), 1);}
+      if (c2p_failure) {Kokkos::atomic_add(&ectr(ECFAIL), 1);}
+      Kokkos::atomic_max(&ectr(ECMAXIT), iter_used);
 
       // store primitive state in 3D array
       prim(m,IDN,k,j,i) = w.d;
@@ -212,18 +276,132 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
         prim(m,n,k,j,i) = cons(m,n,k,j,i)/u.d;
       }
     }
-  }, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_), Kokkos::Sum<int>(nceilv_),
-     Kokkos::Sum<int>(nfail_), Kokkos::Max<int>(maxit_));
-
-  // store appropriate counters
-  if (only_testfloors) {
-    pmy_pack->pmesh->ecounter.nfofc += nfloord_;
-  } else {
-    pmy_pack->pmesh->ecounter.neos_dfloor += nfloord_;
-    pmy_pack->pmesh->ecounter.neos_efloor += nfloore_;
-    pmy_pack->pmesh->ecounter.neos_vceil  += nceilv_;
-    pmy_pack->pmesh->ecounter.neos_fail   += nfail_;
-    pmy_pack->pmesh->ecounter.maxit_c2p = maxit_;
+  });
+
+  // second pass: re-solve the non-converged cells from the compacted list with the
+  // full iteration cap.  Typically a tiny fraction of the grid, so this narrow kernel
+  // costs little while the wide first pass above runs free of its slowest lanes
+  if (retry) {
+    auto cnt_host = Kokkos::create_mirror(c2p_count);
+    Kokkos::deep_copy(cnt_host, c2p_count);
+    int nretry = cnt_host(0);
+    if (nretry > 0) {
+      Kokkos::parallel_for("grmhd_c2p_retry",
+        Kokkos::RangePolicy<>(DevExeSpace(), 0, nretry),
+      KOKKOS_LAMBDA(const int &n) {
+        int idx = c2p_list_(n);
+        int m = (idx)/nkji;
+        int k = (idx - m*nkji)/nji;
+        int j = (idx - m*nkji - k*nji)/ni;
+        int i = (idx - m*nkji - k*nji - j*ni) + il;
+        j += jl;
+        k += kl;
+
+        // load single state conserved variables and face-averaged fields (cells in the
+        // retry list are never excised, and this pass never runs for only_testfloors)
+        MHDCons1D u;
+        u.d  = cons(m,IDN,k,j,i);
+        u.mx = cons(m,IM1,k,j,i);
+        u.my = cons(m,IM2,k,j,i);
+        u.mz = cons(m,IM3,k,j,i);
+        u.e  = cons(m,IEN,k,j,i);
+        u.bx = 0.5*(b.x1f(m,k,j,i) + b.x1f(m,k,j,i+1));
+        u.by = 0.5*(b.x2f(m,k,j,i) + b.x2f(m,k,j+1,i));
+        u.bz = 0.5*(b.x3f(m,k,j,i) + b.x3f(m,k+1,j,i));
+
+        // Extract components of metric
+        Real &x1min = size.d_view(m).x1min;
+        Real &x1max = size.d_view(m).x1max;
+        Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+        Real &x2min = size.d_view(m).x2min;
+        Real &x2max = size.d_view(m).x2max;
+        Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+        Real &x3min = size.d_view(m).x3min;
+        Real &x3max = size.d_view(m).x3max;
+        Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+        Real glower[4][4], gupper[4][4];
+        MetricAndInverseAt(coord, 0, m, k, j, i, x1v, x2v, x3v, glower, gupper);
+
+        // calculate SR conserved quantities
+        MHDCons1D u_sr;
+        Real s2, b2, rpar;
+        TransformToSRMHD(u,glower,gupper,s2,b2,rpar,u_sr);
+
+        // re-solve with the full iteration cap; the first pass zeroed the warm-start
+        // cache for this cell, so this is a cold start
+        HydPrim1D w;
+        bool dfloor_used=false, efloor_used=false;
+        bool vceiling_used=false, c2p_failure=false;
+        int iter_used=0;
+        Real mu = c2p_mu_(m,k,j,i);
+        SingleC2P_IdealSRMHD(u_sr, eos, s2, b2, rpar, w,
+                             dfloor_used, efloor_used, c2p_failure, iter_used, mu);
+        c2p_mu_(m,k,j,i) = mu;
+
+        // apply velocity ceiling if necessary
+        Real tmp = glower[1][1]*SQR(w.vx)
+                 + glower[2][2]*SQR(w.vy)
+                 + glower[3][3]*SQR(w.vz)
+                 + 2.0*glower[1][2]*w.vx*w.vy + 2.0*glower[1][3]*w.vx*w.vz
+                 + 2.0*glower[2][3]*w.vy*w.vz;
+        Real lor = sqrt(1.0+tmp);
+        if (lor > eos.gamma_max) {
+          vceiling_used = true;
+          Real factor = sqrt((SQR(eos.gamma_max)-1.0)/(SQR(lor)-1.0));
+          w.vx *= factor;
+          w.vy *= factor;
+          w.vz *= factor;
+        }
+
+        if (dfloor_used) {Kokkos::atomic_add(&ectr(ECDFLOOR), 1);}
+        if (efloor_used) {Kokkos::atomic_add(&ectr(ECEFLOOR), 1);}
+        if (vceiling_used) {Kokkos::atomic_add(&ectr(ECVCEIL), 1);}
+        if (c2p_failure) {Kokkos::atomic_add(&ectr(ECFAIL), 1);}
+        Kokkos::atomic_max(&ectr(ECMAXIT), iter_used);
+
+        // store primitive state in 3D array
+        prim(m,IDN,k,j,i) = w.d;
+        prim(m,IVX,k,j,i) = w.vx;
+        prim(m,IVY,k,j,i) = w.vy;
+        prim(m,IVZ,k,j,i) = w.vz;
+        prim(m,IEN,k,j,i) = w.e;
+
+        // store cell-centered fields in 3D array
+        bcc(m,IBX,k,j,i) = u.bx;
+        bcc(m,IBY,k,j,i) = u.by;
+        bcc(m,IBZ,k,j,i) = u.bz;
+
+        // reset conserved variables if floor, ceiling, or failure encountered
+        if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
+          MHDPrim1D w_in;
+          w_in.d  = w.d;
+          w_in.vx = w.vx;
+          w_in.vy = w.vy;
+          w_in.vz = w.vz;
+          w_in.e  = w.e;
+          w_in.bx = u.bx;
+          w_in.by = u.by;
+          w_in.bz = u.bz;
+
+          HydCons1D u_out;
+          SingleP2C_IdealGRMHD(glower, gupper, w_in, eos.gamma, u_out);
+          cons(m,IDN,k,j,i) = u_out.d;
+          cons(m,IM1,k,j,i) = u_out.mx;
+          cons(m,IM2,k,j,i) = u_out.my;
+          cons(m,IM3,k,j,i) = u_out.mz;
+          cons(m,IEN,k,j,i) = u_out.e;
+          u.d = u_out.d;  // (needed if there are scalars below)
+        }
+
+        // convert scalars (if any)
+        for (int n2=nmhd; n2<(nmhd+nscal); ++n2) {
+          prim(m,n2,k,j,i) = cons(m,n2,k,j,i)/u.d;
+        }
+      });
+    }
   }
 
   return;
@@ -240,8 +418,7 @@ void IdealGRMHD::PrimToCons(const DvceArray5D<Real> &prim, const DvceArray5D<Rea
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int &is = indcs.is, &js = indcs.js, &ks = indcs.ks;
   auto &size = pmy_pack->pmb->mb_size;
-  auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
-  auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &coord = pmy_pack->pcoord->coord_data;
   int &nmhd  = pmy_pack->pmhd->nmhd;
   int &nscal = pmy_pack->pmhd->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
@@ -263,7 +440,7 @@ void IdealGRMHD::PrimToCons(const DvceArray5D<Real> &prim, const DvceArray5D<Rea
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    MetricAndInverseAt(coord, 0, m, k, j, i, x1v, x2v, x3v, glower, gupper);
 
     // Load single state of primitive variables
     MHDPrim1D w;
@@ -43,9 +43,11 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
   const int nkji = (ku - kl + 1)*nji;
   const int nmkji = nmb*nkji;
 
-  int nfloord_=0, nfloore_=0, nfloort_=0;
-  Kokkos::parallel_reduce("hyd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumt) {
+  // counters are accumulated in the device-resident event counter array with atomics
+  // on the (rare) floor-activation paths, so no per-launch reduction or host sync
+  auto &ectr = pmy_pack->pmesh->ecounter_dvce;
+  Kokkos::parallel_for("hyd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx) {
     int m = (idx)/nkji;
     int k = (idx - m*nkji)/nji;
     int j = (idx - m*nkji - k*nji)/ni;
@@ -71,21 +73,21 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     if (only_testfloors) {
       if (dfloor_used || efloor_used || tfloor_used) {
         fofc_(m,k,j,i) = true;
-        sumd++;  // use dfloor as counter for when either is true
+        Kokkos::atomic_add(&ectr(ECNFOFC), 1);
       }
     } else {
       // update counter, reset conserved if floor was hit
       if (dfloor_used) {
         cons(m,IDN,k,j,i) = u.d;
-        sumd++;
+        Kokkos::atomic_add(&ectr(ECDFLOOR), 1);
       }
       if (efloor_used) {
         cons(m,IEN,k,j,i) = u.e;
-        sume++;
+        Kokkos::atomic_add(&ectr(ECEFLOOR), 1);
       }
       if (tfloor_used) {
         cons(m,IEN,k,j,i) = u.e;
-        sumt++;
+        Kokkos::atomic_add(&ectr(ECTFLOOR), 1);
       }
       // store primitive state in 3D array
       prim(m,IDN,k,j,i) = w.d;
@@ -102,16 +104,7 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
         prim(m,n,k,j,i) = cons(m,n,k,j,i)/u.d;
       }
     }
-  }, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_), Kokkos::Sum<int>(nfloort_));
-
-  // store appropriate counters
-  if (only_testfloors) {
-    pmy_pack->pmesh->ecounter.nfofc += nfloord_;
-  } else {
-    pmy_pack->pmesh->ecounter.neos_dfloor += nfloord_;
-    pmy_pack->pmesh->ecounter.neos_efloor += nfloore_;
-    pmy_pack->pmesh->ecounter.neos_tfloor += nfloort_;
-  }
+  });
 
   return;
 }
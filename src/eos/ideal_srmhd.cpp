@@ -8,6 +8,8 @@
 
 #include <float.h>
 
+#include <algorithm>
+
 #include "athena.hpp"
 #include "mhd/mhd.hpp"
 #include "eos.hpp"
@@ -17,13 +19,24 @@
 // ctor: also calls EOS base class constructor
 
 IdealSRMHD::IdealSRMHD(MeshBlockPack *pp, ParameterInput *pin) :
-    EquationOfState("mhd", pp, pin) {
+    EquationOfState("mhd", pp, pin),
+    c2p_mu("c2p_mu",1,1,1,1) {
   eos_data.is_ideal = true;
   eos_data.gamma = pin->GetReal("mhd","gamma");
   eos_data.iso_cs = 0.0;
   eos_data.use_e = true;  // ideal gas EOS always uses internal energy
   eos_data.use_t = false;
   eos_data.gamma_max = pin->GetOrAddReal("mhd","gamma_max",(FLT_MAX));  // gamma ceiling
+
+  // allocate warm-start cache for the c2p root-find.  Cached values are only initial
+  // guesses, so entries left stale by AMR or load balancing are harmless
+  auto &indcs = pp->pmesh->mb_indcs;
+  int nmb = std::max((pp->nmb_thispack), (pp->pmesh->nmb_maxperrank));
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  Kokkos::realloc(c2p_mu, nmb, ncells3, ncells2, ncells1);
+  Kokkos::deep_copy(c2p_mu, 0.0);
 }
 
 //----------------------------------------------------------------------------------------
@@ -60,15 +73,18 @@ void IdealSRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
   int &nmb = pmy_pack->nmb_thispack;
   auto eos = eos_data;
   auto &fofc_ = pmy_pack->pmhd->fofc;
+  auto &c2p_mu_ = c2p_mu;
 
   const int ni   = (iu - il + 1);
   const int nji  = (ju - jl + 1)*ni;
   const int nkji = (ku - kl + 1)*nji;
   const int nmkji = nmb*nkji;
 
-  int nfloord_=0, nfloore_=0, nceilv_=0, nfail_=0, maxit_=0;
-  Kokkos::parallel_reduce("srmhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumv, int &sumf, int &max_it) {
+  // counters are accumulated in the device-resident event counter array with atomics
+  // on the (rare) floor-activation paths, so no per-launch reduction or host sync
+  auto &ectr = pmy_pack->pmesh->ecounter_dvce;
+  Kokkos::parallel_for("srmhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx) {
     int m = (idx)/nkji;
     int k = (idx - m*nkji)/nji;
     int j = (idx - m*nkji - k*nji)/ni;
@@ -108,8 +124,10 @@ void IdealSRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     bool dfloor_used=false, efloor_used=false;
     bool vceiling_used=false, c2p_failure=false;
     int iter_used=0;
+    Real mu = c2p_mu_(m,k,j,i);  // warm start from previously converged root (if any)
     SingleC2P_IdealSRMHD(u, eos, s2, b2, rpar, w,
-                         dfloor_used, efloor_used, c2p_failure, iter_used);
+                         dfloor_used, efloor_used, c2p_failure, iter_used, mu);
+    c2p_mu_(m,k,j,i) = mu;
     // apply velocity ceiling if necessary
     Real lor = sqrt(1.0+SQR(w.vx)+SQR(w.vy)+SQR(w.vz));
     if (lor > eos.gamma_max) {
@@ -124,14 +142,14 @@ void IdealSRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     if (only_testfloors) {
       if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
         fofc_(m,k,j,i) = true;
-        sumd++;  // use dfloor as counter for when either is true
+        Kokkos::atomic_add(&ectr(ECNFOFC), 1);
       }
     } else {
-      if (dfloor_used) {sumd++;}
-      if (efloor_used) {sume++;}
-      if (vceiling_used) {sumv++;}
-      if (c2p_failure) {sumf++;}
-      max_it = (iter_used > max_it) ? iter_used : max_it;
+      if (dfloor_used) {Kokkos::atomic_add(&ectr(ECDFLOOR), 1);}
+      if (efloor_used) {Kokkos::atomic_add(&ectr(ECEFLOOR), 1);}
+      if (vceiling_used) {Kokkos::atomic_add(&ectr(ECVCEIL), 1);}
+      if (c2p_failure) {Kokkos::atomic_add(&ectr(ECFAIL), 1);}
+      Kokkos::atomic_max(&ectr(ECMAXIT), iter_used);
 
       // store primitive state in 3D array
       prim(m,IDN,k,j,i) = w.d;
@@ -172,19 +190,7 @@ void IdealSRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
         prim(m,n,k,j,i) = cons(m,n,k,j,i)/u.d;
       }
     }
-  }, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_), Kokkos::Sum<int>(nceilv_),
-     Kokkos::Sum<int>(nfail_), Kokkos::Max<int>(maxit_));
-
-  // store appropriate counters
-  if (only_testfloors) {
-    pmy_pack->pmesh->ecounter.nfofc += nfloord_;
-  } else {
-    pmy_pack->pmesh->ecounter.neos_dfloor += nfloord_;
-    pmy_pack->pmesh->ecounter.neos_efloor += nfloore_;
-    pmy_pack->pmesh->ecounter.neos_vceil  += nceilv_;
-    pmy_pack->pmesh->ecounter.neos_fail   += nfail_;
-    pmy_pack->pmesh->ecounter.maxit_c2p = maxit_;
-  }
+  });
 
   return;
 }
@@ -60,6 +60,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         host_log_nb(in) = log(table_nb[in]);
       }
       m_id_log_nb = 1.0/(host_log_nb(1) - host_log_nb(0));
+      m_log_nb0 = host_log_nb(0);
       min_n = table_nb[0];
       max_n = table_nb[m_nn-1];
     }
@@ -70,6 +71,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         host_yq(iy) = table_yq[iy];
       }
       m_id_yq = 1.0/(host_yq(1) - host_yq(0));
+      m_yq0 = host_yq(0);
       min_Y[0] = table_yq[0];
       max_Y[0] = table_yq[m_ny-1];
     }
@@ -80,6 +82,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         host_log_t(it) = log(table_t[it]);
       }
       m_id_log_t = 1.0/(host_log_t(1) - host_log_t(0));
+      m_log_t0 = host_log_t(0);
       min_T = table_t[1];      // These are different
       max_T = table_t[m_nt-2]; // on purpose
     }
@@ -173,6 +176,8 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
     Kokkos::deep_copy(m_yq,     host_yq);
     Kokkos::deep_copy(m_log_t,  host_log_t);
     Kokkos::deep_copy(m_table,  host_table);
+    // bind the read-only RandomAccess alias used by the interpolation hot path
+    m_table_ra = m_table;
 
     m_initialized = true;
 
@@ -53,6 +53,9 @@ class EOSCompOSE : public EOSPolicyInterface {
     m_id_log_nb = std::numeric_limits<Real>::quiet_NaN();
     m_id_log_t = std::numeric_limits<Real>::quiet_NaN();
     m_id_yq = std::numeric_limits<Real>::quiet_NaN();
+    m_log_nb0 = std::numeric_limits<Real>::quiet_NaN();
+    m_log_t0 = std::numeric_limits<Real>::quiet_NaN();
+    m_yq0 = std::numeric_limits<Real>::quiet_NaN();
     m_nn = std::numeric_limits<int>::quiet_NaN();
     m_nt = std::numeric_limits<int>::quiet_NaN();
     m_ny = std::numeric_limits<int>::quiet_NaN();
@@ -239,28 +242,32 @@ class EOSCompOSE : public EOSPolicyInterface {
     weight_idx_lt(&wt0, &wt1, &it, log_t);
 
     return
-      wn0 * (wy0 * (wt0 * m_table(iv, in+0, iy+0, it+0)   +
-                    wt1 * m_table(iv, in+0, iy+0, it+1))  +
-             wy1 * (wt0 * m_table(iv, in+0, iy+1, it+0)   +
-                    wt1 * m_table(iv, in+0, iy+1, it+1))) +
-      wn1 * (wy0 * (wt0 * m_table(iv, in+1, iy+0, it+0)   +
-                    wt1 * m_table(iv, in+1, iy+0, it+1))  +
-             wy1 * (wt0 * m_table(iv, in+1, iy+1, it+0)   +
-                    wt1 * m_table(iv, in+1, iy+1, it+1)));
+      wn0 * (wy0 * (wt0 * m_table_ra(iv, in+0, iy+0, it+0)   +
+                    wt1 * m_table_ra(iv, in+0, iy+0, it+1))  +
+             wy1 * (wt0 * m_table_ra(iv, in+0, iy+1, it+0)   +
+                    wt1 * m_table_ra(iv, in+0, iy+1, it+1))) +
+      wn1 * (wy0 * (wt0 * m_table_ra(iv, in+1, iy+0, it+0)   +
+                    wt1 * m_table_ra(iv, in+1, iy+0, it+1))  +
+             wy1 * (wt0 * m_table_ra(iv, in+1, iy+1, it+0)   +
+                    wt1 * m_table_ra(iv, in+1, iy+1, it+1)));
   }
 
-  /// Evaluate interpolation weight for density
+  /// Evaluate interpolation weight for density.  The axes are uniformly spaced, so the
+  /// index and weights follow arithmetically from the first node and reciprocal step;
+  /// no axis nodes are gathered from device memory
   KOKKOS_INLINE_FUNCTION void weight_idx_ln(Real *w0, Real *w1, int *in, Real log_n)
       const {
-    *in = (log_n - m_log_nb(0))*m_id_log_nb;
-    *w1 = (log_n - m_log_nb(*in))*m_id_log_nb;
+    Real x = (log_n - m_log_nb0)*m_id_log_nb;
+    *in = static_cast<int>(x);
+    *w1 = x - static_cast<Real>(*in);
     *w0 = 1.0 - (*w1);
     return;
   }
   /// Evaluate interpolation weight for composition
   KOKKOS_INLINE_FUNCTION void weight_idx_yq(Real *w0, Real *w1, int *iy, Real yq) const {
-    *iy = (yq - m_yq(0))*m_id_yq;
-    *w1 = (yq - m_yq(*iy))*m_id_yq;
+    Real x = (yq - m_yq0)*m_id_yq;
+    *iy = static_cast<int>(x);
+    *w1 = x - static_cast<Real>(*iy);
     *w0 = 1.0 - (*w1);
     return;
   }
@@ -268,8 +275,9 @@ class EOSCompOSE : public EOSPolicyInterface {
   /// Evaluate interpolation weight for temperature
   KOKKOS_INLINE_FUNCTION void weight_idx_lt(Real *w0, Real *w1, int *it, Real log_t)
       const {
-    *it = (log_t - m_log_t(0))*m_id_log_t;
-    *w1 = (log_t - m_log_t(*it))*m_id_log_t;
+    Real x = (log_t - m_log_t0)*m_id_log_t;
+    *it = static_cast<int>(x);
+    *w1 = x - static_cast<Real>(*it);
     *w0 = 1.0 - (*w1);
     return;
   }
@@ -285,10 +293,10 @@ class EOSCompOSE : public EOSPolicyInterface {
 
     auto f = [=](int it){
       Real var_pt =
-        wn0 * (wy0 * m_table(iv, in+0, iy+0, it)  +
-               wy1 * m_table(iv, in+0, iy+1, it)) +
-        wn1 * (wy0 * m_table(iv, in+1, iy+0, it)  +
-               wy1 * m_table(iv, in+1, iy+1, it));
+        wn0 * (wy0 * m_table_ra(iv, in+0, iy+0, it)  +
+               wy1 * m_table_ra(iv, in+0, iy+1, it)) +
+        wn1 * (wy0 * m_table_ra(iv, in+1, iy+0, it)  +
+               wy1 * m_table_ra(iv, in+1, iy+1, it));
 
       return var - var_pt;
     };
@@ -352,6 +360,9 @@ class EOSCompOSE : public EOSPolicyInterface {
  private:
   // Inverse of table spacing
   Real m_id_log_nb, m_id_yq, m_id_log_t;
+  // First node of each (uniformly spaced) axis, so interpolation weights are computed
+  // arithmetically instead of gathering axis nodes from device memory on every lookup
+  Real m_log_nb0, m_yq0, m_log_t0;
   // Table size
   int m_nn, m_nt, m_ny;
   // Minimum enthalpy per baryon
@@ -366,6 +377,11 @@ class EOSCompOSE : public EOSPolicyInterface {
   DvceArray1D<Real> m_yq;
   DvceArray1D<Real> m_log_t;
   DvceArray4D<Real> m_table;
+  // read-only alias of m_table with the RandomAccess memory trait; on CUDA/HIP builds
+  // gathers through this view go via the texture/read-only data cache, which is the
+  // portable equivalent of binding the table to texture memory
+  Kokkos::View<const Real****, LayoutWrapper, DevMemSpace,
+               Kokkos::MemoryTraits<Kokkos::RandomAccess>> m_table_ra;
 };
 
 }; // namespace Primitive
@@ -201,12 +201,16 @@ class PrimitiveSolver {
 
  public:
   Real tol;
+  Real tol_loose;     // looser tolerance applied in smooth regions when adaptive_tol set
+  bool adaptive_tol;  // enable per-cell tolerance selection in ConToPrim
 
   /// Constructor
   //PrimitiveSolver(EOS<EOSPolicy, ErrorPolicy> *eos) : peos(eos) {
   PrimitiveSolver() {
     //root = NumTools::Root();
     tol = 1e-15;
+    tol_loose = 1e-10;
+    adaptive_tol = false;
     root.iterations = 30;
   }
 
@@ -439,27 +443,42 @@ SolverResult PrimitiveSolver<EOSPolicy, ErrorPolicy>::ConToPrim(Real prim[NPRIM]
     rsqr = Contract(r_u, r_d);
   }
 
-  // If rsqr is identically zero, we can solve the problem analytically.
-  /*if (rsqr == 0.0 || rsqr == -0.0) {
+  // If rsqr is identically zero, the inversion is analytic: the velocity is exactly
+  // zero, so W=1, the density follows from D, and the energy from tau. This is the
+  // common case for cells the conserved floor just reset to atmosphere, so it skips
+  // both the bracketing and the root solve. The primitive floor and the conserved
+  // write-back are applied exactly as in the iterative branch below.
+  if (rsqr == 0.0) {
     Real n = D/eos.GetBaryonMass();
-    prim[PRH] = n;
-    prim[PVX] = prim[PVY] = prim[PVZ] = 0.0;
     Real e = tau + (1.0 - 0.5*bsqr)*D;
-    prim[PTM] = eos.GetTemperatureFromE(n, e, Y);
-    prim[PPR] = eos.GetPressure(n, prim[PTM], Y);
+    Real T = eos.GetTemperatureFromE(n, e, Y);
+    Real P = eos.GetPressure(n, T, Y);
+    Real Wv_u[3] = {0.0, 0.0, 0.0};
+    floored = eos.ApplyPrimitiveFloor(n, Wv_u, P, T, Y);
+    solver_result.prim_floor = floored;
+    if (floored && eos.IsPrimitiveFlooringFailure()) {
+      HandleFailure(prim, cons, b, g3d);
+      solver_result.error = Error::PRIM_FLOOR;
+      return solver_result;
+    }
+    solver_result.cons_adjusted = solver_result.cons_adjusted || floored ||
+                                  solver_result.cons_floor;
+    prim[PRH] = n;
+    prim[PPR] = P;
+    prim[PTM] = T;
+    prim[PVX] = Wv_u[0];
+    prim[PVY] = Wv_u[1];
+    prim[PVZ] = Wv_u[2];
     for (int s = 0; s < n_species; s++) {
       prim[PYF + s] = Y[s];
     }
-    if (solver_result.cons_floor || solver_result.cons_adjusted) {
-      cons[CDN] = D;
-      cons[CSX] = cons[CSY] = cons[CSZ] = 0.0;
-      cons[CTA] = tau;
-      for (int s = 0; s < n_species; s++) {
-        cons[CYD + s] = D*Y[s];
-      }
+    if (solver_result.cons_adjusted && eos.KeepPrimAndConConsistent()) {
+      PrimToCon(prim, cons, b, g3d);
+    } else {
+      solver_result.cons_adjusted = false;
     }
     return solver_result;
-  }*/
+  }
 
   // Ensure that the dominant energy condition is obeyed.
   // FIXME(JMF): This should become part of the error response!
@@ -512,9 +531,16 @@ SolverResult PrimitiveSolver<EOSPolicy, ErrorPolicy>::ConToPrim(Real prim[NPRIM]
   }
 
 
-  // Do the root solve.
+  // Do the root solve.  With adaptive_tol, cells with small velocity and magnetization
+  // (rsqr ~ (hWv)^2 and bsqr ~ 2 p_mag/rho, both normalized by D) only iterate to the
+  // looser tolerance; such states converge far past the truncation error of the
+  // evolution scheme.  Strongly relativistic or magnetized cells keep the tight one.
+  Real tol_cell = tol;
+  if (adaptive_tol && ((rsqr + bsqr) < 0.01)) {
+    tol_cell = tol_loose;
+  }
   Real n, P, T, mu;
-  bool result = root.FalsePosition(RootFunction, mul, muh, mu, tol,
+  bool result = root.FalsePosition(RootFunction, mul, muh, mu, tol_cell,
                                    D, q, bsqr, rsqr, rbsqr, Y, &eos, &n, &T, &P);
   // WARNING: the reported number of iterations is not thread-safe and should only be
   // trusted on single-thread benchmarks.
@@ -101,6 +101,8 @@ class PrimitiveSolverHydro {
     ps.GetEOSMutable().SetTemperatureFloor(pin->GetOrAddReal(block, "tfloor", (FLT_MIN)));
     ps.GetEOSMutable().SetThreshold(pin->GetOrAddReal(block, "dthreshold", 1.0));
     ps.tol = pin->GetOrAddReal(block, "c2p_tol", 1e-15);
+    ps.tol_loose = pin->GetOrAddReal(block, "c2p_tol_loose", 1e-10);
+    ps.adaptive_tol = pin->GetOrAddBoolean(block, "c2p_tol_adapt", false);
     ps.GetRootSolverMutable().iterations = pin->GetOrAddInteger(block, "c2p_iter", 50);
     errcap = pin->GetOrAddInteger(block, "c2perrs", 1000);
 
@@ -269,10 +271,15 @@ class PrimitiveSolverHydro {
     return;
   }
 
-  void ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &bfc,
+  // Kernel implementation templated on the (kernel-uniform) floors_only flag, in the
+  // same spirit as the rsolver templating in CalculateFluxes: each mode compiles to
+  // straight-line per-cell code instead of re-testing a runtime flag in the hot loop.
+  // Dispatched once per call by the ConsToPrim() wrapper below.
+  template<bool floors_only>
+  void ConsToPrimTmpl(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &bfc,
                   DvceArray5D<Real> &bcc0, DvceArray5D<Real> &prim,
                   const int il, const int iu, const int jl, const int ju,
-                  const int kl, const int ku, bool floors_only=false) {
+                  const int kl, const int ku) {
     int &nhyd = pmy_pack->pmhd->nmhd;
     int &nscal = pmy_pack->pmhd->nscalars;
     int &nmb = pmy_pack->nmb_thispack;
@@ -301,8 +308,8 @@ class PrimitiveSolverHydro {
     Real mb = eos_.GetBaryonMass();
 
     // FIXME: This only works for a flooring policy that has these functions!
-    bool prim_failure, cons_failure;
-    if (floors_only) {
+    bool prim_failure = false, cons_failure = false;
+    if constexpr (floors_only) {
       prim_failure = ps.GetEOSMutable().IsPrimitiveFlooringFailure();
       cons_failure = ps.GetEOSMutable().IsConservedFlooringFailure();
       ps.GetEOSMutable().SetPrimitiveFloorFailure(true);
@@ -322,13 +329,22 @@ class PrimitiveSolverHydro {
       k += kl;
 
       // Add in a short circuit where FOFC is guaranteed.
-      if (floors_only && fofc_(m, k, j, i)) {
-        return;
-      }
-      if (floors_only && excise) {
-        if (excision_flux_(m,k,j,i)) {
+      if constexpr (floors_only) {
+        if (fofc_(m, k, j, i)) {
           return;
         }
+        if (excise) {
+          if (excision_flux_(m,k,j,i)) {
+            return;
+          }
+        }
+      }
+
+      // Excised cells take fixed primitives below and only need the lower metric,
+      // so the inverse is computed just for cells that run the primitive solver.
+      bool excised_pt = false;
+      if (excise) {
+        excised_pt = excision_floor_(m,k,j,i);
       }
 
       // Extract the metric
@@ -342,9 +358,11 @@ class PrimitiveSolverHydro {
       detg = Primitive::GetDeterminant(g3d);
       sdetg = sqrt(detg);
       Real isdetg = 1.0/sdetg;
-      adm::SpatialInv(1.0/detg,
-                  g3d[S11], g3d[S12], g3d[S13], g3d[S22], g3d[S23], g3d[S33],
-                 &g3u[S11], &g3u[S12], &g3u[S13], &g3u[S22], &g3u[S23], &g3u[S33]);
+      if (!excised_pt) {
+        adm::SpatialInv(1.0/detg,
+                    g3d[S11], g3d[S12], g3d[S13], g3d[S22], g3d[S23], g3d[S33],
+                   &g3u[S11], &g3u[S12], &g3u[S13], &g3u[S22], &g3u[S23], &g3u[S33]);
+      }
 
       // Extract the conserved variables
       Real cons_pt[NCONS], cons_pt_old[NCONS], prim_pt[NPRIM];
@@ -358,7 +376,7 @@ class PrimitiveSolverHydro {
       }
       // If we're only testing the floors, we can use the CC fields.
       Real b3u[NMAG];
-      if (floors_only) {
+      if constexpr (floors_only) {
         b3u[IBX] = bcc0(m, IBX, k, j, i)*isdetg;
         b3u[IBY] = bcc0(m, IBY, k, j, i)*isdetg;
         b3u[IBZ] = bcc0(m, IBZ, k, j, i)*isdetg;
@@ -375,36 +393,34 @@ class PrimitiveSolverHydro {
 
       // If we're in an excised region, set the primitives to some default value.
       Primitive::SolverResult result;
-      if (excise) {
-        if (excision_floor_(m,k,j,i)) {
-          prim_pt[PRH] = dexcise_/mb;
-          prim_pt[PVX] = 0.0;
-          prim_pt[PVY] = 0.0;
-          prim_pt[PVZ] = 0.0;
-          prim_pt[PPR] = pexcise_;
-          for (int n = 0; n < nscal; n++) {
-            // FIXME: Particle abundances should probably be set to a
-            // default inside an excised region.
-            prim_pt[PYF + n] = cons_pt[CYD]/cons_pt[CDN];
-          }
-          prim_pt[PTM] =
-            eos_.GetTemperatureFromP(prim_pt[PRH], prim_pt[PPR], &prim_pt[PYF]);
-          result.error = Primitive::Error::SUCCESS;
-          result.iterations = 0;
-          result.cons_floor = false;
-          result.prim_floor = false;
-          result.cons_adjusted = true;
-          ps_.PrimToCon(prim_pt, cons_pt, b3u, g3d);
-        } else {
-          result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
+      if (excised_pt) {
+        prim_pt[PRH] = dexcise_/mb;
+        prim_pt[PVX] = 0.0;
+        prim_pt[PVY] = 0.0;
+        prim_pt[PVZ] = 0.0;
+        prim_pt[PPR] = pexcise_;
+        for (int n = 0; n < nscal; n++) {
+          // FIXME: Particle abundances should probably be set to a
+          // default inside an excised region.
+          prim_pt[PYF + n] = cons_pt[CYD]/cons_pt[CDN];
         }
+        prim_pt[PTM] =
+          eos_.GetTemperatureFromP(prim_pt[PRH], prim_pt[PPR], &prim_pt[PYF]);
+        result.error = Primitive::Error::SUCCESS;
+        result.iterations = 0;
+        result.cons_floor = false;
+        result.prim_floor = false;
+        result.cons_adjusted = true;
+        ps_.PrimToCon(prim_pt, cons_pt, b3u, g3d);
       } else {
         result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
       }
 
-      if (result.error != Primitive::Error::SUCCESS && floors_only) {
-        fofc_(m,k,j,i) = true;
-      } else if (!floors_only) {
+      if constexpr (floors_only) {
+        if (result.error != Primitive::Error::SUCCESS) {
+          fofc_(m,k,j,i) = true;
+        }
+      } else {
         if (result.error != Primitive::Error::SUCCESS && (nerrs_ + sumerrs < errcap_)) {
           // TODO(JF): put in a proper error response here.
           sumerrs++;
@@ -497,7 +513,7 @@ class PrimitiveSolverHydro {
       }
     }, Kokkos::Sum<int>(count_errs));
 
-    if (floors_only) {
+    if constexpr (floors_only) {
       ps.GetEOSMutable().SetPrimitiveFloorFailure(prim_failure);
       ps.GetEOSMutable().SetConservedFloorFailure(cons_failure);
     } else {
@@ -505,6 +521,18 @@ class PrimitiveSolverHydro {
     }
   }
 
+  // Runtime entry point; selects the compile-time specialization once per call
+  void ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &bfc,
+                  DvceArray5D<Real> &bcc0, DvceArray5D<Real> &prim,
+                  const int il, const int iu, const int jl, const int ju,
+                  const int kl, const int ku, bool floors_only=false) {
+    if (floors_only) {
+      ConsToPrimTmpl<true>(cons, bfc, bcc0, prim, il, iu, jl, ju, kl, ku);
+    } else {
+      ConsToPrimTmpl<false>(cons, bfc, bcc0, prim, il, iu, jl, ju, kl, ku);
+    }
+  }
+
   // Get the transformed magnetosonic speeds at a point in a given direction.
   KOKKOS_INLINE_FUNCTION
   void GetGRFastMagnetosonicSpeeds(Real& lambda_p, Real& lambda_m,
@@ -34,7 +34,11 @@ GeodesicGrid::GeodesicGrid(int nlev, bool rotate, bool fluxes) :
     cart_pos_mid("cart_pos_mid",1,1,1),
     polar_pos("polar_pos",1,1),
     polar_pos_mid("polar_pos_mid",1,1,1),
-    unit_flux("unit_flux",1,1,1) {
+    unit_flux("unit_flux",1,1,1),
+    nbr_offsets("nbr_offsets",1),
+    nbr_indices("nbr_indices",1),
+    nbr_arc_solid("nbr_arc_solid",1),
+    coarse_map("coarse_map",1) {
   if (nlevel > 0) {  // construct geodesic mesh
     // number of angles
     nangles = 5*2*SQR(nlevel) + 2;
@@ -312,6 +316,25 @@ GeodesicGrid::GeodesicGrid(int nlev, bool rotate, bool fluxes) :
                                                                               nupsi);
         }
       }
+
+      // build CSR-flattened connectivity for the angular transport stencil.  The packed
+      // geometric factor folds in the division by the solid angle so the flux kernel
+      // performs a single multiply per edge
+      int nedges = 0;
+      for (int n=0; n<nangles; ++n) { nedges += numn.h_view(n); }
+      Kokkos::realloc(nbr_offsets,nangles+1);
+      Kokkos::realloc(nbr_indices,nedges);
+      Kokkos::realloc(nbr_arc_solid,nedges);
+      int offset = 0;
+      for (int n=0; n<nangles; ++n) {
+        nbr_offsets.h_view(n) = offset;
+        for (int nb=0; nb<numn.h_view(n); ++nb) {
+          nbr_indices.h_view(offset) = indn.h_view(n,nb);
+          nbr_arc_solid.h_view(offset) = arcl.h_view(n,nb)/solid_angles.h_view(n);
+          offset += 1;
+        }
+      }
+      nbr_offsets.h_view(nangles) = offset;
     }
 
     // sync dual arrays
@@ -336,6 +359,12 @@ GeodesicGrid::GeodesicGrid(int nlev, bool rotate, bool fluxes) :
     if (geo_fluxes) {
       unit_flux.template modify<HostMemSpace>();
       unit_flux.template sync<DevExeSpace>();
+      nbr_offsets.template modify<HostMemSpace>();
+      nbr_offsets.template sync<DevExeSpace>();
+      nbr_indices.template modify<HostMemSpace>();
+      nbr_indices.template sync<DevExeSpace>();
+      nbr_arc_solid.template modify<HostMemSpace>();
+      nbr_arc_solid.template sync<DevExeSpace>();
     }
 
   } else if (nlevel==0) {  // one angle per octant
@@ -426,6 +455,37 @@ void GeodesicGrid::GridCartPositionMid(int n, int nb, Real& x, Real& y, Real& z)
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void GeodesicGrid::InitCoarseMap
+//! \brief build map onto a coarser geodesic grid for angular restriction/prolongation.
+//  Each angle on this grid is assigned to the angle on cgrid whose center direction is
+//  nearest, so a solid-angle-weighted sum over each bin of the map conserves the
+//  angle-integrated intensity (restriction) and injection distributes it back
+//  (prolongation).  Intended for multi-resolution angular transport.
+
+void GeodesicGrid::InitCoarseMap(GeodesicGrid *cgrid) {
+  Kokkos::realloc(coarse_map,nangles);
+  for (int n=0; n<nangles; ++n) {
+    Real x, y, z;
+    GridCartPosition(n,x,y,z);
+    int cbest = 0;
+    Real cosd_max = -2.0;
+    for (int c=0; c<cgrid->nangles; ++c) {
+      Real xc, yc, zc;
+      cgrid->GridCartPosition(c,xc,yc,zc);
+      Real cosd = x*xc + y*yc + z*zc;
+      if (cosd > cosd_max) {
+        cosd_max = cosd;
+        cbest = c;
+      }
+    }
+    coarse_map.h_view(n) = cbest;
+  }
+  coarse_map.template modify<HostMemSpace>();
+  coarse_map.template sync<DevExeSpace>();
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void GeodesicGrid::Neighbors
 //! \brief retrieve number of neighbors and indexing of neighbors
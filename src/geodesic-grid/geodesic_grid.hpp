@@ -29,9 +29,19 @@ class GeodesicGrid {
   DualArray2D<Real> polar_pos;            // polar coordinates at face center
   DualArray3D<Real> polar_pos_mid;        // polar coordinates at face edges
   DualArray3D<Real> unit_flux;            // angular unit vectors computed at face edges
+  // CSR-flattened neighbor connectivity for the angular transport stencil.  Packing the
+  // (n,nb) indirection into contiguous arrays coalesces the gather in the angular-flux
+  // kernel; built once at construction when fluxes are enabled
+  DualArray1D<int>  nbr_offsets;    // start of each angle's packed entries (nangles+1)
+  DualArray1D<int>  nbr_indices;    // packed neighbor angle indices
+  DualArray1D<Real> nbr_arc_solid;  // packed arc length over solid angle for each edge
+  // map onto a coarser geodesic grid for angular restriction/prolongation (each angle
+  // is assigned to the coarse angle with the nearest center); built by InitCoarseMap()
+  DualArray1D<int>  coarse_map;     // coarse angle index for each angle on this grid
 
   // functions
   void GridCartPosition(int n, Real& x, Real& y, Real& z);
+  void InitCoarseMap(GeodesicGrid *cgrid);
   void GridCartPositionMid(int n, int nb, Real& x, Real& y, Real& z);
   void Neighbors(int n, int& num_nghbr, int neighbors[6]);
   void CircumcenterNormalized(Real x1, Real x2, Real x3, Real y1, Real y2, Real y3,
@@ -42,6 +42,12 @@ SphericalGrid::SphericalGrid(MeshBlockPack *ppack, int nlev, Real rad):
   SetInterpolationIndices();
   SetInterpolationWeights();
 
+  // record the AMR event count at which the map was built so that InterpolateToSphere()
+  // only rebuilds it after an actual regrid
+  MeshRefinement *pmr = pmy_pack->pmesh->pmr;
+  interp_mesh_count = (pmr == nullptr)? 0 :
+                      (pmr->nmb_created + pmr->nmb_deleted + pmr->nmb_sent_thisrank);
+
   return;
 }
 
@@ -97,47 +103,50 @@ void SphericalGrid::SetInterpolationIndices() {
   int nmb1 = pmy_pack->nmb_thispack - 1;
   int nang1 = nangles - 1;
 
+  // build (angle -> MeshBlock, zone) map on device; one thread per angle scans the
+  // MeshBlocks of this pack
   auto &rcoord = interp_coord;
   auto &iindcs = interp_indcs;
-  for (int n=0; n<=nang1; ++n) {
+  par_for("sphgrid_indcs",DevExeSpace(),0,nang1,
+  KOKKOS_LAMBDA(int n) {
     // indices default to -1 if angle does not reside in this MeshBlockPack
-    iindcs.h_view(n,0) = -1;
-    iindcs.h_view(n,1) = -1;
-    iindcs.h_view(n,2) = -1;
-    iindcs.h_view(n,3) = -1;
+    iindcs.d_view(n,0) = -1;
+    iindcs.d_view(n,1) = -1;
+    iindcs.d_view(n,2) = -1;
+    iindcs.d_view(n,3) = -1;
     for (int m=0; m<=nmb1; ++m) {
       // extract MeshBlock bounds
-      Real &x1min = size.h_view(m).x1min;
-      Real &x1max = size.h_view(m).x1max;
-      Real &x2min = size.h_view(m).x2min;
-      Real &x2max = size.h_view(m).x2max;
-      Real &x3min = size.h_view(m).x3min;
-      Real &x3max = size.h_view(m).x3max;
+      Real &x1min = size.d_view(m).x1min;
+      Real &x1max = size.d_view(m).x1max;
+      Real &x2min = size.d_view(m).x2min;
+      Real &x2max = size.d_view(m).x2max;
+      Real &x3min = size.d_view(m).x3min;
+      Real &x3max = size.d_view(m).x3max;
 
       // extract MeshBlock grid cell spacings
-      Real &dx1 = size.h_view(m).dx1;
-      Real &dx2 = size.h_view(m).dx2;
-      Real &dx3 = size.h_view(m).dx3;
+      Real &dx1 = size.d_view(m).dx1;
+      Real &dx2 = size.d_view(m).dx2;
+      Real &dx3 = size.d_view(m).dx3;
 
       // save MeshBlock and zone indicies for nearest position to spherical patch center
       // if this angle position resides in this MeshBlock
-      if ((rcoord.h_view(n,0) >= x1min && rcoord.h_view(n,0) <= x1max) &&
-          (rcoord.h_view(n,1) >= x2min && rcoord.h_view(n,1) <= x2max) &&
-          (rcoord.h_view(n,2) >= x3min && rcoord.h_view(n,2) <= x3max)) {
-        iindcs.h_view(n,0) = m;
-        iindcs.h_view(n,1) = static_cast<int>(std::floor((rcoord.h_view(n,0)-
-                                                          (x1min+dx1/2.0))/dx1));
-        iindcs.h_view(n,2) = static_cast<int>(std::floor((rcoord.h_view(n,1)-
-                                                          (x2min+dx2/2.0))/dx2));
-        iindcs.h_view(n,3) = static_cast<int>(std::floor((rcoord.h_view(n,2)-
-                                                          (x3min+dx3/2.0))/dx3));
+      if ((rcoord.d_view(n,0) >= x1min && rcoord.d_view(n,0) <= x1max) &&
+          (rcoord.d_view(n,1) >= x2min && rcoord.d_view(n,1) <= x2max) &&
+          (rcoord.d_view(n,2) >= x3min && rcoord.d_view(n,2) <= x3max)) {
+        iindcs.d_view(n,0) = m;
+        iindcs.d_view(n,1) = static_cast<int>(floor((rcoord.d_view(n,0)-
+                                                     (x1min+dx1/2.0))/dx1));
+        iindcs.d_view(n,2) = static_cast<int>(floor((rcoord.d_view(n,1)-
+                                                     (x2min+dx2/2.0))/dx2));
+        iindcs.d_view(n,3) = static_cast<int>(floor((rcoord.d_view(n,2)-
+                                                     (x3min+dx3/2.0))/dx3));
       }
     }
-  }
+  });
 
-  // sync dual arrays
-  interp_indcs.template modify<HostMemSpace>();
-  interp_indcs.template sync<DevExeSpace>();
+  // sync dual arrays (device is authoritative; host copy kept for host-side consumers)
+  interp_indcs.template modify<DevExeSpace>();
+  interp_indcs.template sync<HostMemSpace>();
 
   return;
 }
@@ -150,61 +159,66 @@ void SphericalGrid::SetInterpolationWeights() {
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   auto &size = pmy_pack->pmb->mb_size;
   int &ng = indcs.ng;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int nang1 = nangles - 1;
 
+  // build Lagrange interpolation weights on device; one thread per angle
+  auto &rcoord = interp_coord;
   auto &iindcs = interp_indcs;
   auto &iwghts = interp_wghts;
-  for (int n=0; n<nangles; ++n) {
+  par_for("sphgrid_wghts",DevExeSpace(),0,nang1,
+  KOKKOS_LAMBDA(int n) {
     // extract indices
-    int &ii0 = iindcs.h_view(n,0);
-    int &ii1 = iindcs.h_view(n,1);
-    int &ii2 = iindcs.h_view(n,2);
-    int &ii3 = iindcs.h_view(n,3);
+    int ii0 = iindcs.d_view(n,0);
+    int ii1 = iindcs.d_view(n,1);
+    int ii2 = iindcs.d_view(n,2);
+    int ii3 = iindcs.d_view(n,3);
 
     if (ii0==-1) {  // angle not on this rank
       for (int i=0; i<2*ng; ++i) {
-        iwghts.h_view(n,i,0) = 0.0;
-        iwghts.h_view(n,i,1) = 0.0;
-        iwghts.h_view(n,i,2) = 0.0;
+        iwghts.d_view(n,i,0) = 0.0;
+        iwghts.d_view(n,i,1) = 0.0;
+        iwghts.d_view(n,i,2) = 0.0;
       }
     } else {
       // extract spherical grid positions
-      Real &x0 = interp_coord.h_view(n,0);
-      Real &y0 = interp_coord.h_view(n,1);
-      Real &z0 = interp_coord.h_view(n,2);
+      Real &x0 = rcoord.d_view(n,0);
+      Real &y0 = rcoord.d_view(n,1);
+      Real &z0 = rcoord.d_view(n,2);
 
       // extract MeshBlock bounds
-      Real &x1min = size.h_view(ii0).x1min;
-      Real &x1max = size.h_view(ii0).x1max;
-      Real &x2min = size.h_view(ii0).x2min;
-      Real &x2max = size.h_view(ii0).x2max;
-      Real &x3min = size.h_view(ii0).x3min;
-      Real &x3max = size.h_view(ii0).x3max;
+      Real &x1min = size.d_view(ii0).x1min;
+      Real &x1max = size.d_view(ii0).x1max;
+      Real &x2min = size.d_view(ii0).x2min;
+      Real &x2max = size.d_view(ii0).x2max;
+      Real &x3min = size.d_view(ii0).x3min;
+      Real &x3max = size.d_view(ii0).x3max;
 
       // set interpolation weights
       for (int i=0; i<2*ng; ++i) {
-        iwghts.h_view(n,i,0) = 1.;
-        iwghts.h_view(n,i,1) = 1.;
-        iwghts.h_view(n,i,2) = 1.;
+        iwghts.d_view(n,i,0) = 1.;
+        iwghts.d_view(n,i,1) = 1.;
+        iwghts.d_view(n,i,2) = 1.;
         for (int j=0; j<2*ng; ++j) {
           if (j != i) {
-            Real x1vpi1 = CellCenterX(ii1-ng+i+1, indcs.nx1, x1min, x1max);
-            Real x1vpj1 = CellCenterX(ii1-ng+j+1, indcs.nx1, x1min, x1max);
-            iwghts.h_view(n,i,0) *= (x0-x1vpj1)/(x1vpi1-x1vpj1);
-            Real x2vpi1 = CellCenterX(ii2-ng+i+1, indcs.nx2, x2min, x2max);
-            Real x2vpj1 = CellCenterX(ii2-ng+j+1, indcs.nx2, x2min, x2max);
-            iwghts.h_view(n,i,1) *= (y0-x2vpj1)/(x2vpi1-x2vpj1);
-            Real x3vpi1 = CellCenterX(ii3-ng+i+1, indcs.nx3, x3min, x3max);
-            Real x3vpj1 = CellCenterX(ii3-ng+j+1, indcs.nx3, x3min, x3max);
-            iwghts.h_view(n,i,2) *= (z0-x3vpj1)/(x3vpi1-x3vpj1);
+            Real x1vpi1 = CellCenterX(ii1-ng+i+1, nx1, x1min, x1max);
+            Real x1vpj1 = CellCenterX(ii1-ng+j+1, nx1, x1min, x1max);
+            iwghts.d_view(n,i,0) *= (x0-x1vpj1)/(x1vpi1-x1vpj1);
+            Real x2vpi1 = CellCenterX(ii2-ng+i+1, nx2, x2min, x2max);
+            Real x2vpj1 = CellCenterX(ii2-ng+j+1, nx2, x2min, x2max);
+            iwghts.d_view(n,i,1) *= (y0-x2vpj1)/(x2vpi1-x2vpj1);
+            Real x3vpi1 = CellCenterX(ii3-ng+i+1, nx3, x3min, x3max);
+            Real x3vpj1 = CellCenterX(ii3-ng+j+1, nx3, x3min, x3max);
+            iwghts.d_view(n,i,2) *= (z0-x3vpj1)/(x3vpi1-x3vpj1);
           }
         }
       }
     }
-  }
+  });
 
-  // sync dual arrays
-  interp_wghts.template modify<HostMemSpace>();
-  interp_wghts.template sync<DevExeSpace>();
+  // sync dual arrays (device is authoritative; host copy kept for host-side consumers)
+  interp_wghts.template modify<DevExeSpace>();
+  interp_wghts.template sync<HostMemSpace>();
 
   return;
 }
@@ -214,10 +228,16 @@ void SphericalGrid::SetInterpolationWeights() {
 //! \brief interpolate Cartesian data to surface of sphere
 
 void SphericalGrid::InterpolateToSphere(int nvars, DvceArray5D<Real> &val) {
-  // reinitialize interpolation indices and weights if AMR
+  // reinitialize interpolation indices and weights with AMR, but only after an actual
+  // regrid (tracked via the cumulative refinement/load-balance event counts)
   if (pmy_pack->pmesh->adaptive) {
-    SetInterpolationIndices();
-    SetInterpolationWeights();
+    MeshRefinement *pmr = pmy_pack->pmesh->pmr;
+    int mesh_count = pmr->nmb_created + pmr->nmb_deleted + pmr->nmb_sent_thisrank;
+    if (mesh_count != interp_mesh_count) {
+      SetInterpolationIndices();
+      SetInterpolationWeights();
+      interp_mesh_count = mesh_count;
+    }
   }
 
   // capturing variables for kernel
@@ -227,8 +247,12 @@ void SphericalGrid::InterpolateToSphere(int nvars, DvceArray5D<Real> &val) {
   int nang1 = nangles - 1;
   int nvar1 = nvars - 1;
 
-  // reallocate container
-  Kokkos::realloc(interp_vals,nangles,nvars);
+  // reallocate container only when its shape changes (avoids a device allocation on
+  // every extraction)
+  if (interp_vals.d_view.extent_int(0) != nangles ||
+      interp_vals.d_view.extent_int(1) != nvars) {
+    Kokkos::realloc(interp_vals,nangles,nvars);
+  }
 
   auto &iindcs = interp_indcs;
   auto &iwghts = interp_wghts;
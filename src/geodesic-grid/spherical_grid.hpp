@@ -33,6 +33,7 @@ class SphericalGrid: public GeodesicGrid {
     MeshBlockPack* pmy_pack;  // ptr to MeshBlockPack containing this Hydro
     DualArray2D<int> interp_indcs;   // indices of MeshBlock and zones therein for interp
     DualArray3D<Real> interp_wghts;  // weights for interpolation
+    int interp_mesh_count;  // AMR event count at which interpolation map was last built
     void SetInterpolationCoordinates();  // set indexing for interpolation
     void SetInterpolationIndices();      // set indexing for interpolation
     void SetInterpolationWeights();      // set weights for interpolation
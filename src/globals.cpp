@@ -16,4 +16,5 @@
 namespace global_variable {
 int my_rank;   // MPI rank of this process; set at start of main();
 int nranks;    // total number of MPI ranks; set at start of main();
+int mpi_thread_provided = 0;  // thread support level provided by MPI_Init_thread()
 }
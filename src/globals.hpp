@@ -10,6 +10,7 @@
 
 namespace global_variable {
 extern int my_rank, nranks;
+extern int mpi_thread_provided;
 }
 
 #endif // GLOBALS_HPP_
@@ -0,0 +1,189 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file fft_solver.cpp
+//  \brief FFT pipeline of the self-gravity module: remap density into x-pencils,
+//  transform one direction at a time (transposing between pencil orientations), divide
+//  by the eigenvalues of the discrete Laplacian, transform back, and scatter the
+//  potential (including its ghost zones) back to MeshBlocks.  All transforms and
+//  pack/unpack steps run on the device; see gravity.cpp for the decomposition and maps.
+
+#include <cmath>
+#include <vector>
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "gravity.hpp"
+
+namespace gravity {
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::RowTransform()
+//  \brief In-place radix-2 complex FFT along each of 'nrows' contiguous rows of length
+//  'len' (a power of two).  One thread per row: with pencil decompositions the number
+//  of rows per rank is large, so parallelism across rows saturates the device while
+//  each thread runs the standard iterative bit-reversal/butterfly sequence serially
+
+void Gravity::RowTransform(DvceArray1D<Real> &a, const int nrows, const int len,
+                           const bool inverse) {
+  if (len < 2) {return;}
+  const Real isign = (inverse)? 1.0 : -1.0;
+  par_for("grav_fft", DevExeSpace(), 0, nrows-1, KOKKOS_LAMBDA(const int r) {
+    const int base = 2*r*len;
+    // bit-reversal permutation
+    for (int i=1, j=0; i<len; ++i) {
+      int bit = len >> 1;
+      for (; j & bit; bit >>= 1) {j ^= bit;}
+      j |= bit;
+      if (i < j) {
+        Real tr = a(base+2*i);
+        Real ti = a(base+2*i+1);
+        a(base+2*i  ) = a(base+2*j);
+        a(base+2*i+1) = a(base+2*j+1);
+        a(base+2*j  ) = tr;
+        a(base+2*j+1) = ti;
+      }
+    }
+    // iterative Cooley-Tukey butterflies
+    for (int mlen=2; mlen<=len; mlen <<= 1) {
+      Real ang = isign*2.0*M_PI/mlen;
+      Real wr0 = cos(ang);
+      Real wi0 = sin(ang);
+      for (int s=0; s<len; s += mlen) {
+        Real wr = 1.0, wi = 0.0;
+        for (int t=0; t<mlen/2; ++t) {
+          int p = base + 2*(s+t);
+          int q = base + 2*(s+t+mlen/2);
+          Real xr = a(q  )*wr - a(q+1)*wi;
+          Real xi = a(q  )*wi + a(q+1)*wr;
+          a(q  ) = a(p  ) - xr;
+          a(q+1) = a(p+1) - xi;
+          a(p  ) += xr;
+          a(p+1) += xi;
+          Real wrn = wr*wr0 - wi*wi0;
+          wi = wr*wi0 + wi*wr0;
+          wr = wrn;
+        }
+      }
+    }
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::SolveFFT()
+//  \brief Solves the Poisson equation Lap(phi) = 4 pi G rho on the global grid for the
+//  current density field, leaving the potential (with ghost zones filled) in phi
+
+void Gravity::SolveFFT() {
+  Mesh *pm = pmy_pack->pmesh;
+  auto &indcs = pm->mb_indcs;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int nmb = pmy_pack->nmb_thispack;
+
+  // (1) gather density into a flat device array in the canonical (m,k,j,i) order used
+  // by the communication maps
+  auto &dens_ = dens;
+  DvceArray5D<Real> u0;
+  if (pmy_pack->phydro != nullptr) {u0 = pmy_pack->phydro->u0;}
+  if (pmy_pack->pmhd   != nullptr) {u0 = pmy_pack->pmhd->u0;}
+  par_for("grav_dens", DevExeSpace(), 0, nmb-1, 0, nx3-1, 0, nx2-1, 0, nx1-1,
+  KOKKOS_LAMBDA(const int m, const int kk, const int jj, const int ii) {
+    dens_(((m*nx3 + kk)*nx2 + jj)*nx1 + ii) = u0(m,IDN,kk+ks,jj+js,ii+is);
+  });
+
+  // (2) remap density into x-pencils (real data; imaginary parts zeroed on unpack)
+  int nsend = 0, nrecv = 0;
+  for (int c : mb2x_scnt) {nsend += c;}
+  for (int c : mb2x_rcnt) {nrecv += c;}
+  auto &sbuf = sendbuf;
+  auto &rbuf = recvbuf;
+  auto &dx_ = data_x;
+  auto &dz_ = data_z;
+  {
+    auto &pack_ = mb2x_pack;
+    auto &unpk_ = mb2x_unpk;
+    par_for("grav_dpack", DevExeSpace(), 0, nsend-1, KOKKOS_LAMBDA(const int p) {
+      sbuf(p) = dens_(pack_.d_view(p));
+    });
+    Exchange(mb2x_scnt, mb2x_rcnt, 1);
+    par_for("grav_dunpk", DevExeSpace(), 0, nrecv-1, KOKKOS_LAMBDA(const int p) {
+      int e = unpk_.d_view(p);
+      dx_(2*e  ) = rbuf(p);
+      dx_(2*e+1) = 0.0;
+    });
+  }
+
+  // (3) forward transforms, transposing x -> y -> z
+  RowTransform(data_x, xrow_end - xrow_beg, gnx1, false);
+  TransposeComplex(data_x, data_y, x2y_pack, x2y_unpk, x2y_scnt, x2y_rcnt);
+  RowTransform(data_y, yrow_end - yrow_beg, gnx2, false);
+  TransposeComplex(data_y, data_z, y2z_pack, y2z_unpk, y2z_scnt, y2z_rcnt);
+  RowTransform(data_z, zrow_end - zrow_beg, gnx3, false);
+
+  // (4) multiply by the Green's function of the discrete Laplacian (zeroing the mean
+  // mode) with the inverse-transform normalization folded in
+  {
+    int nloc = (zrow_end - zrow_beg)*gnx3;
+    int zbeg = zrow_beg;
+    int n1 = gnx1, n2 = gnx2, n3 = gnx3;
+    Real d1 = dx1, d2 = dx2, d3 = dx3;
+    Real fpg = four_pi_G;
+    Real norm = 1.0/(static_cast<Real>(n1)*static_cast<Real>(n2)*static_cast<Real>(n3));
+    par_for("grav_green", DevExeSpace(), 0, nloc-1, KOKKOS_LAMBDA(const int e) {
+      int row = zbeg + e/n3;
+      int gk = e%n3;
+      int gi = row%n1;
+      int gj = row/n1;
+      // eigenvalue of the central-difference Laplacian for this Fourier mode
+      Real lam = (2.0*cos(2.0*M_PI*gi/n1) - 2.0)/(d1*d1)
+               + (2.0*cos(2.0*M_PI*gj/n2) - 2.0)/(d2*d2)
+               + (2.0*cos(2.0*M_PI*gk/n3) - 2.0)/(d3*d3);
+      Real fac = (lam == 0.0)? 0.0 : norm*fpg/lam;
+      dz_(2*e  ) *= fac;
+      dz_(2*e+1) *= fac;
+    });
+  }
+
+  // (5) inverse transforms, transposing back z -> y -> x by reusing the forward maps
+  // with the pack/unpack roles (and counts) swapped
+  RowTransform(data_z, zrow_end - zrow_beg, gnx3, true);
+  TransposeComplex(data_z, data_y, y2z_unpk, y2z_pack, y2z_rcnt, y2z_scnt);
+  RowTransform(data_y, yrow_end - yrow_beg, gnx2, true);
+  TransposeComplex(data_y, data_x, x2y_unpk, x2y_pack, x2y_rcnt, x2y_scnt);
+  RowTransform(data_x, xrow_end - xrow_beg, gnx1, true);
+
+  // (6) scatter the potential back to MeshBlocks.  The map covers ghost zones through
+  // periodic wrap of the global indices, so phi needs no further boundary exchange
+  nsend = 0; nrecv = 0;
+  for (int c : x2mb_scnt) {nsend += c;}
+  for (int c : x2mb_rcnt) {nrecv += c;}
+  {
+    int ncells1 = indcs.nx1 + 2*(indcs.ng);
+    int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+    int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+    auto &pack_ = x2mb_pack;
+    auto &unpk_ = x2mb_unpk;
+    auto &phi_ = phi;
+    par_for("grav_ppack", DevExeSpace(), 0, nsend-1, KOKKOS_LAMBDA(const int p) {
+      sbuf(p) = dx_(2*pack_.d_view(p));  // real part of the inverse transform
+    });
+    Exchange(x2mb_scnt, x2mb_rcnt, 1);
+    par_for("grav_punpk", DevExeSpace(), 0, nrecv-1, KOKKOS_LAMBDA(const int p) {
+      int e = unpk_.d_view(p);
+      int i = e%ncells1;
+      int j = (e/ncells1)%ncells2;
+      int k = (e/(ncells1*ncells2))%ncells3;
+      int m = e/(ncells1*ncells2*ncells3);
+      phi_(m,0,k,j,i) = rbuf(p);
+    });
+  }
+  return;
+}
+
+} // namespace gravity
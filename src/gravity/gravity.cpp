@@ -0,0 +1,497 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file gravity.cpp
+//  \brief implementation of constructor, pencil decomposition, communication maps, and
+//  task functions for the self-gravity module.  The FFT pipeline itself is in
+//  fft_solver.cpp.
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "eos/eos.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "gravity.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace gravity {
+
+//----------------------------------------------------------------------------------------
+// constructor, initializes data structures and parameters
+
+Gravity::Gravity(MeshBlockPack *pp, ParameterInput *pin) :
+    pmy_pack(pp) {
+  Mesh *pm = pmy_pack->pmesh;
+
+  four_pi_G = pin->GetReal("gravity", "four_pi_G");
+
+  // self-gravity requires a fluid, but not two of them
+  if ((pmy_pack->phydro == nullptr) && (pmy_pack->pmhd == nullptr)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "<gravity> block requires either <hydro> or <mhd>" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  if ((pmy_pack->phydro != nullptr) && (pmy_pack->pmhd != nullptr)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Self-gravity is not implemented for two-fluid (ion-neutral) "
+        << "calculations" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // both solvers require a uniform grid with periodic boundaries in every direction
+  if (pm->multilevel) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Self-gravity only works on uniform grids (no SMR/AMR)"
+        << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  for (int f=0; f<6; ++f) {
+    if (pm->mesh_bcs[f] != BoundaryFlag::periodic) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Self-gravity requires periodic boundaries on every face "
+          << "of the mesh" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+
+  std::string solver = pin->GetOrAddString("gravity", "solver", "fft");
+  use_multigrid = (solver.compare("multigrid") == 0);
+  if (!use_multigrid && solver.compare("fft") != 0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "<gravity>/solver = '" << solver << "' not recognized; "
+        << "must be 'fft' or 'multigrid'" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  gnx1 = pm->mesh_indcs.nx1;
+  gnx2 = pm->mesh_indcs.nx2;
+  gnx3 = pm->mesh_indcs.nx3;
+  dx1 = pm->mesh_size.dx1;
+  dx2 = pm->mesh_size.dx2;
+  dx3 = pm->mesh_size.dx3;
+
+  // radix-2 transforms (and coarsening to a 2^3 grid) require power-of-two dimensions
+  for (int n : {gnx1, gnx2, gnx3}) {
+    if ((n & (n-1)) != 0) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Self-gravity requires power-of-two mesh dimensions, but "
+          << "mesh has " << n << " cells in one direction" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+
+  // allocate potential (with ghost zones) and density scratch array
+  auto &indcs = pm->mb_indcs;
+  int nmb = pmy_pack->nmb_thispack;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  Kokkos::realloc(phi, nmb, 1, ncells3, ncells2, ncells1);
+  Kokkos::realloc(dens, nmb*(indcs.nx1)*(indcs.nx2)*(indcs.nx3));
+
+  auto total = [](std::vector<int> &cnt) {
+    int n = 0;
+    for (int c : cnt) {n += c;}
+    return n;
+  };
+  int nsend, nrecv;
+  if (!use_multigrid) {
+    // pencil row counts and the ranges owned by this rank.  Rows are 1D lines of the
+    // global grid: (j,k) pairs for the x-stage, (i,k) for y, (i,j) for z
+    int myrank = global_variable::my_rank;
+    nrow_x = gnx2*gnx3;
+    nrow_y = gnx1*gnx3;
+    nrow_z = gnx1*gnx2;
+    xrow_beg = RowBeg(nrow_x, myrank);  xrow_end = RowBeg(nrow_x, myrank+1);
+    yrow_beg = RowBeg(nrow_y, myrank);  yrow_end = RowBeg(nrow_y, myrank+1);
+    zrow_beg = RowBeg(nrow_z, myrank);  zrow_end = RowBeg(nrow_z, myrank+1);
+
+    Kokkos::realloc(data_x, 2*(xrow_end - xrow_beg)*gnx1);
+    Kokkos::realloc(data_y, 2*(yrow_end - yrow_beg)*gnx2);
+    Kokkos::realloc(data_z, 2*(zrow_end - zrow_beg)*gnx3);
+
+    // build the communication maps, then size the staging buffers for the largest
+    // exchange (transposes carry complex data, hence the factor two)
+    BuildMaps();
+    nsend = std::max({total(mb2x_scnt), total(x2mb_scnt),
+                      2*total(x2y_scnt), 2*total(y2z_scnt)});
+    nrecv = std::max({total(mb2x_rcnt), total(x2mb_rcnt),
+                      2*total(x2y_rcnt), 2*total(y2z_rcnt)});
+  } else {
+    // the slab decomposition of the multigrid solver requires a 3D mesh with at least
+    // one x3-plane per rank
+    if (!(pm->three_d)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Multigrid self-gravity requires a 3D mesh" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (global_variable::nranks > gnx3) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Multigrid self-gravity requires nranks <= nx3 of the mesh"
+          << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    mg_tol = pin->GetOrAddReal("gravity", "tolerance", 1.0e-6);
+    nsmooth = pin->GetOrAddInteger("gravity", "nsmooth", 2);
+    max_vcycles = pin->GetOrAddInteger("gravity", "max_vcycles", 50);
+
+    BuildMultigrid();
+    int nhalo = 2*gnx2*gnx1;  // the fine-level halo is the largest of the hierarchy
+    nsend = std::max({total(mb2s_scnt), total(s2mb_scnt), nhalo});
+    nrecv = std::max({total(mb2s_rcnt), total(s2mb_rcnt), nhalo});
+  }
+  Kokkos::realloc(sendbuf, std::max(nsend, 1));
+  Kokkos::realloc(recvbuf, std::max(nrecv, 1));
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::SolvePotential()
+//  \brief Solves the Poisson equation Lap(phi) = 4 pi G rho on the global grid for the
+//  current density field with the selected solver, leaving the potential (with ghost
+//  zones filled) in phi
+
+void Gravity::SolvePotential() {
+  if (use_multigrid) {
+    SolveMG();
+  } else {
+    SolveFFT();
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::BuildMaps()
+//  \brief Builds the index maps and message counts for the four all-to-all exchanges:
+//  MeshBlock layout to x-pencils, x- to y-pencils, y- to z-pencils, and x-pencils back
+//  to MeshBlocks (the last includes ghost zones, filled by periodic wrap of the global
+//  indices).  Every rank knows the global MeshBlock layout (lloc_eachmb) and the pencil
+//  row distributions, so both sides of each exchange replay the same deterministic
+//  traversal: source ranks in ascending order, elements of each in a canonical order.
+//  Maps are built once; the grid is uniform so they never change.  The inverse
+//  transposes of the solve reuse the forward maps with the pack/unpack roles swapped.
+
+void Gravity::BuildMaps() {
+  Mesh *pm = pmy_pack->pmesh;
+  int nranks = global_variable::nranks;
+  int myrank = global_variable::my_rank;
+  auto &indcs = pm->mb_indcs;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int ncells1 = nx1 + 2*(indcs.ng);
+  int ncells2 = (nx2 > 1)? (nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (nx3 > 1)? (nx3 + 2*(indcs.ng)) : 1;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+
+  // generic two-pass builder: pass 0 accumulates counts, pass 1 (after allocating the
+  // maps from the counts) fills pack positions (for elements this rank sends) and
+  // unpack destinations (for elements this rank receives)
+  std::vector<int> sdis(nranks), rdis(nranks);
+
+  auto start_fill = [&](std::vector<int> &scnt, std::vector<int> &rcnt,
+                        DualArray1D<int> &pack, DualArray1D<int> &unpk) {
+    sdis[0] = 0; rdis[0] = 0;
+    for (int r=1; r<nranks; ++r) {
+      sdis[r] = sdis[r-1] + scnt[r-1];
+      rdis[r] = rdis[r-1] + rcnt[r-1];
+    }
+    int nsend = sdis[nranks-1] + scnt[nranks-1];
+    int nrecv = rdis[nranks-1] + rcnt[nranks-1];
+    Kokkos::realloc(pack, std::max(nsend, 1));
+    Kokkos::realloc(unpk, std::max(nrecv, 1));
+  };
+  auto finish_fill = [&](DualArray1D<int> &pack, DualArray1D<int> &unpk) {
+    pack.template modify<HostMemSpace>();
+    pack.template sync<DevExeSpace>();
+    unpk.template modify<HostMemSpace>();
+    unpk.template sync<DevExeSpace>();
+  };
+
+  // (1) MeshBlock interiors to x-pencils, and (4) x-pencils back to MeshBlocks with
+  // ghost zones.  Both traverse MeshBlocks in gid order and cells in (k,j,i) order;
+  // in (1) the MB side sends, in (4) it receives
+  mb2x_scnt.assign(nranks, 0);  mb2x_rcnt.assign(nranks, 0);
+  x2mb_scnt.assign(nranks, 0);  x2mb_rcnt.assign(nranks, 0);
+  for (int pass=0; pass<2; ++pass) {
+    if (pass == 1) {
+      start_fill(mb2x_scnt, mb2x_rcnt, mb2x_pack, mb2x_unpk);
+    }
+    std::vector<int> spos(sdis), rpos(rdis);
+    for (int s=0; s<nranks; ++s) {
+      for (int g=pm->gids_eachrank[s]; g<(pm->gids_eachrank[s]+pm->nmb_eachrank[s]);
+           ++g) {
+        LogicalLocation &loc = pm->lloc_eachmb[g];
+        int m = g - pm->gids_eachrank[s];
+        for (int kk=0; kk<nx3; ++kk) {
+        for (int jj=0; jj<nx2; ++jj) {
+        for (int ii=0; ii<nx1; ++ii) {
+          int gi = static_cast<int>(loc.lx1)*nx1 + ii;
+          int gj = static_cast<int>(loc.lx2)*nx2 + jj;
+          int gk = static_cast<int>(loc.lx3)*nx3 + kk;
+          int row = gk*gnx2 + gj;
+          int d = RowOwner(nrow_x, row);
+          if (pass == 0) {
+            if (s == myrank) {mb2x_scnt[d]++;}
+            if (d == myrank) {mb2x_rcnt[s]++;}
+          } else {
+            if (s == myrank) {
+              mb2x_pack.h_view(spos[d]++) = ((m*nx3 + kk)*nx2 + jj)*nx1 + ii;
+            }
+            if (d == myrank) {
+              mb2x_unpk.h_view(rpos[s]++) = (row - xrow_beg)*gnx1 + gi;
+            }
+          }
+        }}}
+      }
+    }
+    if (pass == 1) {finish_fill(mb2x_pack, mb2x_unpk);}
+  }
+  for (int pass=0; pass<2; ++pass) {
+    if (pass == 1) {
+      start_fill(x2mb_scnt, x2mb_rcnt, x2mb_pack, x2mb_unpk);
+    }
+    std::vector<int> spos(sdis), rpos(rdis);
+    // here the MB side is the destination ('d' loops over receiving ranks)
+    for (int d=0; d<nranks; ++d) {
+      for (int g=pm->gids_eachrank[d]; g<(pm->gids_eachrank[d]+pm->nmb_eachrank[d]);
+           ++g) {
+        LogicalLocation &loc = pm->lloc_eachmb[g];
+        int m = g - pm->gids_eachrank[d];
+        for (int kk=0; kk<ncells3; ++kk) {
+        for (int jj=0; jj<ncells2; ++jj) {
+        for (int ii=0; ii<ncells1; ++ii) {
+          int gi = (static_cast<int>(loc.lx1)*nx1 + ii - is + gnx1)%gnx1;
+          int gj = (static_cast<int>(loc.lx2)*nx2 + jj - js + gnx2)%gnx2;
+          int gk = (static_cast<int>(loc.lx3)*nx3 + kk - ks + gnx3)%gnx3;
+          int row = gk*gnx2 + gj;
+          int s = RowOwner(nrow_x, row);
+          if (pass == 0) {
+            if (s == myrank) {x2mb_scnt[d]++;}
+            if (d == myrank) {x2mb_rcnt[s]++;}
+          } else {
+            if (s == myrank) {
+              x2mb_pack.h_view(spos[d]++) = (row - xrow_beg)*gnx1 + gi;
+            }
+            if (d == myrank) {
+              x2mb_unpk.h_view(rpos[s]++) = ((m*ncells3 + kk)*ncells2 + jj)*ncells1 + ii;
+            }
+          }
+        }}}
+      }
+    }
+    if (pass == 1) {finish_fill(x2mb_pack, x2mb_unpk);}
+  }
+
+  // (2) x-pencils to y-pencils: traverse each rank's x-rows, then points along x
+  x2y_scnt.assign(nranks, 0);  x2y_rcnt.assign(nranks, 0);
+  for (int pass=0; pass<2; ++pass) {
+    if (pass == 1) {
+      start_fill(x2y_scnt, x2y_rcnt, x2y_pack, x2y_unpk);
+    }
+    std::vector<int> spos(sdis), rpos(rdis);
+    for (int s=0; s<nranks; ++s) {
+      for (int row=RowBeg(nrow_x, s); row<RowBeg(nrow_x, s+1); ++row) {
+        int gj = row%gnx2;
+        int gk = row/gnx2;
+        for (int gi=0; gi<gnx1; ++gi) {
+          int row_y = gk*gnx1 + gi;
+          int d = RowOwner(nrow_y, row_y);
+          if (pass == 0) {
+            if (s == myrank) {x2y_scnt[d]++;}
+            if (d == myrank) {x2y_rcnt[s]++;}
+          } else {
+            if (s == myrank) {
+              x2y_pack.h_view(spos[d]++) = (row - xrow_beg)*gnx1 + gi;
+            }
+            if (d == myrank) {
+              x2y_unpk.h_view(rpos[s]++) = (row_y - yrow_beg)*gnx2 + gj;
+            }
+          }
+        }
+      }
+    }
+    if (pass == 1) {finish_fill(x2y_pack, x2y_unpk);}
+  }
+
+  // (3) y-pencils to z-pencils: traverse each rank's y-rows, then points along y
+  y2z_scnt.assign(nranks, 0);  y2z_rcnt.assign(nranks, 0);
+  for (int pass=0; pass<2; ++pass) {
+    if (pass == 1) {
+      start_fill(y2z_scnt, y2z_rcnt, y2z_pack, y2z_unpk);
+    }
+    std::vector<int> spos(sdis), rpos(rdis);
+    for (int s=0; s<nranks; ++s) {
+      for (int row=RowBeg(nrow_y, s); row<RowBeg(nrow_y, s+1); ++row) {
+        int gi = row%gnx1;
+        int gk = row/gnx1;
+        for (int gj=0; gj<gnx2; ++gj) {
+          int row_z = gj*gnx1 + gi;
+          int d = RowOwner(nrow_z, row_z);
+          if (pass == 0) {
+            if (s == myrank) {y2z_scnt[d]++;}
+            if (d == myrank) {y2z_rcnt[s]++;}
+          } else {
+            if (s == myrank) {
+              y2z_pack.h_view(spos[d]++) = (row - yrow_beg)*gnx2 + gj;
+            }
+            if (d == myrank) {
+              y2z_unpk.h_view(rpos[s]++) = (row_z - zrow_beg)*gnx3 + gk;
+            }
+          }
+        }
+      }
+    }
+    if (pass == 1) {finish_fill(y2z_pack, y2z_unpk);}
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::Exchange()
+//  \brief All-to-all exchange of the staging buffers, with counts in elements of
+//  'ncomp' Reals each (1 for real data, 2 for complex).  Buffers are device-resident;
+//  with MPI the library is handed device pointers directly, like the boundary
+//  communication elsewhere in the code (requires GPU-aware MPI)
+
+void Gravity::Exchange(std::vector<int> &scnt, std::vector<int> &rcnt, const int ncomp) {
+  int nranks = global_variable::nranks;
+#if MPI_PARALLEL_ENABLED
+  std::vector<int> sc(nranks), so(nranks), rc(nranks), ro(nranks);
+  for (int r=0; r<nranks; ++r) {
+    sc[r] = ncomp*scnt[r];
+    rc[r] = ncomp*rcnt[r];
+    so[r] = (r == 0)? 0 : so[r-1] + sc[r-1];
+    ro[r] = (r == 0)? 0 : ro[r-1] + rc[r-1];
+  }
+  Kokkos::fence();  // ensure packing kernel is complete before handing buffers to MPI
+  MPI_Alltoallv(sendbuf.data(), sc.data(), so.data(), MPI_ATHENA_REAL,
+                recvbuf.data(), rc.data(), ro.data(), MPI_ATHENA_REAL, MPI_COMM_WORLD);
+#else
+  // single rank: the "exchange" is a device-to-device copy
+  std::size_t n = static_cast<std::size_t>(ncomp)*scnt[0];
+  auto ssub = Kokkos::subview(sendbuf, std::make_pair(static_cast<std::size_t>(0), n));
+  auto rsub = Kokkos::subview(recvbuf, std::make_pair(static_cast<std::size_t>(0), n));
+  Kokkos::deep_copy(rsub, ssub);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::TransposeComplex()
+//  \brief Repacks complex pencil data from one orientation into another: gathers send
+//  elements through 'pack', exchanges, and scatters received elements through 'unpk'.
+//  Passing a forward unpack map as 'pack' (with the counts swapped) performs the
+//  inverse transpose, so the maps built for the forward sweep serve both directions
+
+void Gravity::TransposeComplex(DvceArray1D<Real> &src, DvceArray1D<Real> &dst,
+                               DualArray1D<int> &pack, DualArray1D<int> &unpk,
+                               std::vector<int> &scnt, std::vector<int> &rcnt) {
+  int nsend = 0, nrecv = 0;
+  for (int c : scnt) {nsend += c;}
+  for (int c : rcnt) {nrecv += c;}
+
+  auto &sbuf = sendbuf;
+  auto &rbuf = recvbuf;
+  auto &pack_ = pack;
+  auto &unpk_ = unpk;
+  par_for("grav_tpack", DevExeSpace(), 0, nsend-1, KOKKOS_LAMBDA(const int p) {
+    int e = pack_.d_view(p);
+    sbuf(2*p  ) = src(2*e  );
+    sbuf(2*p+1) = src(2*e+1);
+  });
+  Exchange(scnt, rcnt, 2);
+  par_for("grav_tunpk", DevExeSpace(), 0, nrecv-1, KOKKOS_LAMBDA(const int p) {
+    int e = unpk_.d_view(p);
+    dst(2*e  ) = rbuf(2*p  );
+    dst(2*e+1) = rbuf(2*p+1);
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::IncludeSelfGravityTasks()
+//  \brief Inserts the self-gravity task (Poisson solve plus source terms) into the
+//  stage run task list, between the flux and update tasks of the fluid, like the
+//  turbulence driver forcing task.  Called by MeshBlockPack::AddPhysics()
+
+void Gravity::IncludeSelfGravityTasks(std::shared_ptr<TaskList> tl, TaskID start) {
+  if (pmy_pack->phydro != nullptr) {
+    auto id = tl->InsertTask(&Gravity::ApplySelfGravity, this,
+                             pmy_pack->phydro->id.flux, pmy_pack->phydro->id.rkupdt,
+        "Gravity::ApplySelfGravity");
+  } else if (pmy_pack->pmhd != nullptr) {
+    auto id = tl->InsertTask(&Gravity::ApplySelfGravity, this,
+                             pmy_pack->pmhd->id.flux, pmy_pack->pmhd->id.rkupdt,
+        "Gravity::ApplySelfGravity");
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Gravity::ApplySelfGravity()
+//  \brief Solves for the potential from the current density field, then adds the
+//  gravitational acceleration to the fluid as an explicit source term in each stage
+
+TaskStatus Gravity::ApplySelfGravity(Driver *pdrive, int stage) {
+  SolvePotential();
+
+  Real beta_dt = (pdrive->beta[stage-1])*(pmy_pack->pmesh->dt);
+  if (pmy_pack->phydro != nullptr) {
+    AddGravitySourceTerm(pmy_pack->phydro->u0,
+                         pmy_pack->phydro->peos->eos_data.is_ideal, beta_dt);
+  } else if (pmy_pack->pmhd != nullptr) {
+    AddGravitySourceTerm(pmy_pack->pmhd->u0,
+                         pmy_pack->pmhd->peos->eos_data.is_ideal, beta_dt);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::AddGravitySourceTerm()
+//  \brief Adds -rho*grad(phi) to the momenta and -mom.grad(phi) to the energy, with the
+//  potential gradient from central differences (ghost zones of phi are filled by the
+//  solver's inverse remap)
+
+void Gravity::AddGravitySourceTerm(DvceArray5D<Real> &u0, const bool is_ideal,
+                                   const Real bdt) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  int nmb = pmy_pack->nmb_thispack;
+  bool multi_d = pmy_pack->pmesh->multi_d;
+  bool three_d = pmy_pack->pmesh->three_d;
+  Real idx1 = 1.0/(2.0*dx1), idx2 = 1.0/(2.0*dx2), idx3 = 1.0/(2.0*dx3);
+
+  auto &phi_ = phi;
+  par_for("grav_accel", DevExeSpace(), 0, nmb-1, ks, ke, js, je, is, ie,
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    Real dpx = (phi_(m,0,k,j,i+1) - phi_(m,0,k,j,i-1))*idx1;
+    Real dpy = (multi_d)? (phi_(m,0,k,j+1,i) - phi_(m,0,k,j-1,i))*idx2 : 0.0;
+    Real dpz = (three_d)? (phi_(m,0,k+1,j,i) - phi_(m,0,k-1,j,i))*idx3 : 0.0;
+
+    Real den = u0(m,IDN,k,j,i);
+    if (is_ideal) {
+      u0(m,IEN,k,j,i) -= bdt*(u0(m,IM1,k,j,i)*dpx + u0(m,IM2,k,j,i)*dpy
+                            + u0(m,IM3,k,j,i)*dpz);
+    }
+    u0(m,IM1,k,j,i) -= bdt*den*dpx;
+    u0(m,IM2,k,j,i) -= bdt*den*dpy;
+    u0(m,IM3,k,j,i) -= bdt*den*dpz;
+  });
+  return;
+}
+
+} // namespace gravity
@@ -0,0 +1,141 @@
+#ifndef GRAVITY_GRAVITY_HPP_
+#define GRAVITY_GRAVITY_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file gravity.hpp
+//  \brief definitions for self-gravity via distributed Poisson solvers.  Restricted
+//  to uniform grids (no SMR/AMR) with periodic boundaries in every direction and
+//  power-of-two mesh dimensions.  Two solvers are provided, selected by the 'solver'
+//  parameter in the <gravity> block:
+//  (1) solver=fft (default): the global density field is remapped into pencils
+//  distributed over ranks, transformed one direction at a time with device-resident
+//  FFT kernels (transposing between pencil orientations with all-to-all exchanges of
+//  device buffers), multiplied by the Green's function of the discrete Laplacian, and
+//  transformed back.
+//  (2) solver=multigrid: geometric multigrid V-cycles on a hierarchy of x3-slab
+//  decomposed global grids, with red-black Gauss-Seidel smoothing and the cell-centered
+//  restriction/prolongation stencils used by the mesh refinement machinery as the
+//  inter-level transfer operators (see multigrid.cpp).
+//  In both solvers the inverse remap fills the ghost zones of the potential directly
+//  from the global solution, so no separate boundary exchange is required.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "parameter_input.hpp"
+
+// forward declarations
+class Driver;
+
+namespace gravity {
+
+//----------------------------------------------------------------------------------------
+// even floor distribution of ntot rows (or planes) over ranks: first row owned by rank
+// r, and the rank owning a given row.  Used by both the pencil decomposition of the FFT
+// solver and the slab decomposition of the multigrid solver
+
+inline int RowBeg(const int ntot, const int r) {
+  return static_cast<int>((static_cast<std::int64_t>(ntot)*r)/global_variable::nranks);
+}
+
+inline int RowOwner(const int ntot, const int row) {
+  int nranks = global_variable::nranks;
+  int r = static_cast<int>((static_cast<std::int64_t>(row)*nranks)/ntot);
+  while (RowBeg(ntot, r+1) <= row) {r++;}
+  while (RowBeg(ntot, r) > row) {r--;}
+  return r;
+}
+
+//----------------------------------------------------------------------------------------
+//! \class Gravity
+
+class Gravity {
+ public:
+  Gravity(MeshBlockPack *pp, ParameterInput *pin);
+  ~Gravity() = default;
+
+  // data
+  Real four_pi_G;            // 4 pi G in code units
+  DvceArray5D<Real> phi;     // gravitational potential (with ghost zones)
+
+  // functions
+  void IncludeSelfGravityTasks(std::shared_ptr<TaskList> tl, TaskID start);
+  TaskStatus ApplySelfGravity(Driver *pdrive, int stage);
+  void SolvePotential();
+
+ private:
+  MeshBlockPack *pmy_pack;
+  bool use_multigrid;        // solver=multigrid selected in the <gravity> block
+
+  // global mesh dimensions and cell sizes
+  int gnx1, gnx2, gnx3;
+  Real dx1, dx2, dx3;
+
+  // pencil decomposition: rows (1D lines of the global grid) are distributed evenly
+  // over ranks for each transform direction.  nrow_* counts rows over the whole mesh;
+  // *row_beg/*row_end bound the rows owned by this rank (half-open)
+  int nrow_x, nrow_y, nrow_z;
+  int xrow_beg, xrow_end, yrow_beg, yrow_end, zrow_beg, zrow_end;
+
+  // device-resident pencil data (complex interleaved: element e at [2e], [2e+1]) and
+  // staging buffers for the all-to-all exchanges
+  DvceArray1D<Real> data_x, data_y, data_z;
+  DvceArray1D<Real> dens, sendbuf, recvbuf;
+
+  // index maps for the remap/transpose exchanges, built once at construction.  Pack
+  // maps give the source element for each send-buffer slot; unpack maps give the
+  // destination element for each recv-buffer slot.  Counts/displacements are in
+  // elements (scaled to Reals inside Exchange)
+  DualArray1D<int> mb2x_pack, mb2x_unpk, x2y_pack, x2y_unpk, y2z_pack, y2z_unpk,
+                   x2mb_pack, x2mb_unpk;
+  std::vector<int> mb2x_scnt, mb2x_rcnt, x2y_scnt, x2y_rcnt, y2z_scnt, y2z_rcnt,
+                   x2mb_scnt, x2mb_rcnt;
+
+  // one level of the multigrid hierarchy: the global grid of this level decomposed
+  // into x3-slabs.  The solution array u carries one ghost plane on each side of the
+  // owned planes, filled by the halo exchange (periodic wrap in x1/x2 is done with
+  // index arithmetic inside the stencil kernels, since whole planes are rank-local)
+  struct MGLevel {
+    int n1, n2, n3;          // global dimensions of this level
+    int kbeg, kend;          // x3-planes of this level owned by this rank (half-open)
+    Real dx1, dx2, dx3;      // cell sizes of this level
+    DvceArray1D<Real> u, rhs, res;
+    DualArray1D<int> halo_pack, halo_unpk;
+    std::vector<int> halo_scnt, halo_rcnt;
+  };
+  int nlevels, nsmooth, max_vcycles;
+  Real mg_tol;
+  std::vector<MGLevel> mg;
+  DualArray1D<int> mb2s_pack, mb2s_unpk, s2mb_pack, s2mb_unpk;
+  std::vector<int> mb2s_scnt, mb2s_rcnt, s2mb_scnt, s2mb_rcnt;
+
+  // functions
+  void BuildMaps();
+  void Exchange(std::vector<int> &scnt, std::vector<int> &rcnt, const int ncomp);
+  void SolveFFT();
+  void RowTransform(DvceArray1D<Real> &a, const int nrows, const int len,
+                    const bool inverse);
+  void TransposeComplex(DvceArray1D<Real> &src, DvceArray1D<Real> &dst,
+                        DualArray1D<int> &pack, DualArray1D<int> &unpk,
+                        std::vector<int> &scnt, std::vector<int> &rcnt);
+  void SolveMG();
+  void BuildMultigrid();
+  void SlabHaloExchange(const int l);
+  void SmoothLevel(const int l);
+  void ResidualLevel(const int l);
+  void RestrictLevel(const int l);
+  void ProlongateLevel(const int l);
+  void VCycle(const int l);
+  void AddGravitySourceTerm(DvceArray5D<Real> &u0, const bool is_ideal,
+                            const Real bdt);
+};
+
+} // namespace gravity
+#endif // GRAVITY_GRAVITY_HPP_
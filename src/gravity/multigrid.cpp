@@ -0,0 +1,541 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file multigrid.cpp
+//  \brief geometric multigrid Poisson solver of the self-gravity module.  The global
+//  grid is coarsened by two in every direction down to a level with at least one
+//  x3-plane per rank, each level decomposed into x3-slabs.  Slab ownership is fixed at
+//  the coarsest level and refined by doubling, so the fine planes of any coarse plane
+//  live on the same rank and the inter-level transfers need no communication; only the
+//  one-plane halo exchange of each level communicates, through the same map-based
+//  device-buffer machinery as the FFT solver.  Smoothing is red-black Gauss-Seidel,
+//  and the inter-level transfers mirror the cell-centered stencils of the mesh
+//  refinement operators: the restriction is the eight-point average of RestrictCC, and
+//  the prolongation the min-mod limited piecewise-linear interpolation of ProlongCC.
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "gravity.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace gravity {
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::BuildMultigrid()
+//  \brief Constructs the level hierarchy and the communication maps of the multigrid
+//  solver: per-level halo maps, plus the remap between the MeshBlock layout and the
+//  fine-level slabs.  Like the pencil maps, both sides of every exchange replay the
+//  same deterministic traversal, and the maps never change on a uniform grid
+
+void Gravity::BuildMultigrid() {
+  Mesh *pm = pmy_pack->pmesh;
+  int nranks = global_variable::nranks;
+  int myrank = global_variable::my_rank;
+
+  // number of levels: coarsen by two in every direction while all dimensions stay
+  // at least two and the coarsest grid keeps at least one x3-plane per rank
+  nlevels = 1;
+  while (((gnx1>>nlevels) >= 2) && ((gnx2>>nlevels) >= 2) && ((gnx3>>nlevels) >= 2) &&
+         ((gnx3>>nlevels) >= nranks)) {nlevels++;}
+  int n3c = gnx3>>(nlevels-1);  // x3-planes of the coarsest level
+
+  mg.resize(nlevels);
+  for (int l=0; l<nlevels; ++l) {
+    MGLevel &lev = mg[l];
+    lev.n1 = gnx1>>l;
+    lev.n2 = gnx2>>l;
+    lev.n3 = gnx3>>l;
+    lev.dx1 = dx1*(1<<l);
+    lev.dx2 = dx2*(1<<l);
+    lev.dx3 = dx3*(1<<l);
+    int fac = 1<<(nlevels-1-l);
+    lev.kbeg = RowBeg(n3c, myrank)*fac;
+    lev.kend = RowBeg(n3c, myrank+1)*fac;
+    int nloc = lev.kend - lev.kbeg;
+    Kokkos::realloc(lev.u,   (nloc+2)*(lev.n2)*(lev.n1));
+    Kokkos::realloc(lev.rhs, nloc*(lev.n2)*(lev.n1));
+    Kokkos::realloc(lev.res, nloc*(lev.n2)*(lev.n1));
+    Kokkos::deep_copy(lev.u, 0.0);
+  }
+
+  std::vector<int> sdis(nranks), rdis(nranks);
+  auto start_fill = [&](std::vector<int> &scnt, std::vector<int> &rcnt,
+                        DualArray1D<int> &pack, DualArray1D<int> &unpk) {
+    sdis[0] = 0; rdis[0] = 0;
+    for (int r=1; r<nranks; ++r) {
+      sdis[r] = sdis[r-1] + scnt[r-1];
+      rdis[r] = rdis[r-1] + rcnt[r-1];
+    }
+    int nsend = sdis[nranks-1] + scnt[nranks-1];
+    int nrecv = rdis[nranks-1] + rcnt[nranks-1];
+    Kokkos::realloc(pack, std::max(nsend, 1));
+    Kokkos::realloc(unpk, std::max(nrecv, 1));
+  };
+  auto finish_fill = [&](DualArray1D<int> &pack, DualArray1D<int> &unpk) {
+    pack.template modify<HostMemSpace>();
+    pack.template sync<DevExeSpace>();
+    unpk.template modify<HostMemSpace>();
+    unpk.template sync<DevExeSpace>();
+  };
+
+  // (1) halo maps for each level.  Every rank sends its first owned plane to the rank
+  // below and its last owned plane to the rank above (periodic wrap); by symmetry a
+  // first-plane send always fills the receiver's upper ghost plane, and a last-plane
+  // send its lower ghost plane, which keeps the replay unambiguous even when both
+  // planes travel between the same pair of ranks
+  for (int l=0; l<nlevels; ++l) {
+    MGLevel &lev = mg[l];
+    int fac = 1<<(nlevels-1-l);
+    int n1 = lev.n1, n2 = lev.n2, n3 = lev.n3;
+    lev.halo_scnt.assign(nranks, 0);
+    lev.halo_rcnt.assign(nranks, 0);
+    for (int pass=0; pass<2; ++pass) {
+      if (pass == 1) {
+        start_fill(lev.halo_scnt, lev.halo_rcnt, lev.halo_pack, lev.halo_unpk);
+      }
+      std::vector<int> spos(sdis), rpos(rdis);
+      for (int s=0; s<nranks; ++s) {
+        int skbeg = RowBeg(n3c, s)*fac;
+        int skend = RowBeg(n3c, s+1)*fac;
+        int snloc = skend - skbeg;
+        int dests[2] = {RowOwner(n3c, (((skbeg - 1) + n3)%n3)/fac),
+                        RowOwner(n3c, (skend%n3)/fac)};
+        for (int h=0; h<2; ++h) {
+          int d = dests[h];
+          for (int j=0; j<n2; ++j) {
+          for (int i=0; i<n1; ++i) {
+            if (pass == 0) {
+              if (s == myrank) {lev.halo_scnt[d]++;}
+              if (d == myrank) {lev.halo_rcnt[s]++;}
+            } else {
+              if (s == myrank) {
+                int lk = (h == 0)? 1 : snloc;  // local plane index in u (ghost offset)
+                lev.halo_pack.h_view(spos[d]++) = (lk*n2 + j)*n1 + i;
+              }
+              if (d == myrank) {
+                int lk = (h == 0)? (lev.kend - lev.kbeg + 1) : 0;
+                lev.halo_unpk.h_view(rpos[s]++) = (lk*n2 + j)*n1 + i;
+              }
+            }
+          }}
+        }
+      }
+      if (pass == 1) {finish_fill(lev.halo_pack, lev.halo_unpk);}
+    }
+  }
+
+  // (2) MeshBlock interiors to fine-level slabs, and (3) fine-level slabs back to
+  // MeshBlocks with ghost zones (filled by periodic wrap of the global indices).
+  // Mirrors the mb2x/x2mb builders of the pencil decomposition
+  auto &indcs = pm->mb_indcs;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int ncells1 = nx1 + 2*(indcs.ng);
+  int ncells2 = nx2 + 2*(indcs.ng);
+  int ncells3 = nx3 + 2*(indcs.ng);
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  int fac0 = 1<<(nlevels-1);
+  int kbeg0 = mg[0].kbeg;
+
+  mb2s_scnt.assign(nranks, 0);  mb2s_rcnt.assign(nranks, 0);
+  s2mb_scnt.assign(nranks, 0);  s2mb_rcnt.assign(nranks, 0);
+  for (int pass=0; pass<2; ++pass) {
+    if (pass == 1) {
+      start_fill(mb2s_scnt, mb2s_rcnt, mb2s_pack, mb2s_unpk);
+    }
+    std::vector<int> spos(sdis), rpos(rdis);
+    for (int s=0; s<nranks; ++s) {
+      for (int g=pm->gids_eachrank[s]; g<(pm->gids_eachrank[s]+pm->nmb_eachrank[s]);
+           ++g) {
+        LogicalLocation &loc = pm->lloc_eachmb[g];
+        int m = g - pm->gids_eachrank[s];
+        for (int kk=0; kk<nx3; ++kk) {
+        for (int jj=0; jj<nx2; ++jj) {
+        for (int ii=0; ii<nx1; ++ii) {
+          int gi = static_cast<int>(loc.lx1)*nx1 + ii;
+          int gj = static_cast<int>(loc.lx2)*nx2 + jj;
+          int gk = static_cast<int>(loc.lx3)*nx3 + kk;
+          int d = RowOwner(n3c, gk/fac0);
+          if (pass == 0) {
+            if (s == myrank) {mb2s_scnt[d]++;}
+            if (d == myrank) {mb2s_rcnt[s]++;}
+          } else {
+            if (s == myrank) {
+              mb2s_pack.h_view(spos[d]++) = ((m*nx3 + kk)*nx2 + jj)*nx1 + ii;
+            }
+            if (d == myrank) {
+              mb2s_unpk.h_view(rpos[s]++) = ((gk - kbeg0)*gnx2 + gj)*gnx1 + gi;
+            }
+          }
+        }}}
+      }
+    }
+    if (pass == 1) {finish_fill(mb2s_pack, mb2s_unpk);}
+  }
+  for (int pass=0; pass<2; ++pass) {
+    if (pass == 1) {
+      start_fill(s2mb_scnt, s2mb_rcnt, s2mb_pack, s2mb_unpk);
+    }
+    std::vector<int> spos(sdis), rpos(rdis);
+    for (int d=0; d<nranks; ++d) {
+      for (int g=pm->gids_eachrank[d]; g<(pm->gids_eachrank[d]+pm->nmb_eachrank[d]);
+           ++g) {
+        LogicalLocation &loc = pm->lloc_eachmb[g];
+        int m = g - pm->gids_eachrank[d];
+        for (int kk=0; kk<ncells3; ++kk) {
+        for (int jj=0; jj<ncells2; ++jj) {
+        for (int ii=0; ii<ncells1; ++ii) {
+          int gi = (static_cast<int>(loc.lx1)*nx1 + ii - is + gnx1)%gnx1;
+          int gj = (static_cast<int>(loc.lx2)*nx2 + jj - js + gnx2)%gnx2;
+          int gk = (static_cast<int>(loc.lx3)*nx3 + kk - ks + gnx3)%gnx3;
+          int s = RowOwner(n3c, gk/fac0);
+          if (pass == 0) {
+            if (s == myrank) {s2mb_scnt[d]++;}
+            if (d == myrank) {s2mb_rcnt[s]++;}
+          } else {
+            if (s == myrank) {
+              s2mb_pack.h_view(spos[d]++) = ((gk - kbeg0 + 1)*gnx2 + gj)*gnx1 + gi;
+            }
+            if (d == myrank) {
+              s2mb_unpk.h_view(rpos[s]++) = ((m*ncells3 + kk)*ncells2 + jj)*ncells1 + ii;
+            }
+          }
+        }}}
+      }
+    }
+    if (pass == 1) {finish_fill(s2mb_pack, s2mb_unpk);}
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::SlabHaloExchange()
+//  \brief Fills the two ghost planes of the solution array of the given level from the
+//  neighboring slabs (periodic wrap in x3)
+
+void Gravity::SlabHaloExchange(const int l) {
+  MGLevel &lev = mg[l];
+  int nsend = 0, nrecv = 0;
+  for (int c : lev.halo_scnt) {nsend += c;}
+  for (int c : lev.halo_rcnt) {nrecv += c;}
+
+  auto &sbuf = sendbuf;
+  auto &rbuf = recvbuf;
+  auto &pack_ = lev.halo_pack;
+  auto &unpk_ = lev.halo_unpk;
+  auto &u_ = lev.u;
+  par_for("grav_mg_hpack", DevExeSpace(), 0, nsend-1, KOKKOS_LAMBDA(const int p) {
+    sbuf(p) = u_(pack_.d_view(p));
+  });
+  Exchange(lev.halo_scnt, lev.halo_rcnt, 1);
+  par_for("grav_mg_hunpk", DevExeSpace(), 0, nrecv-1, KOKKOS_LAMBDA(const int p) {
+    u_(unpk_.d_view(p)) = rbuf(p);
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::SmoothLevel()
+//  \brief One red-black Gauss-Seidel sweep on the given level, exchanging halos before
+//  each color so the stencil always reads current neighbor planes
+
+void Gravity::SmoothLevel(const int l) {
+  MGLevel &lev = mg[l];
+  int n1 = lev.n1, n2 = lev.n2;
+  int kbeg = lev.kbeg;
+  int nloc = lev.kend - lev.kbeg;
+  Real ix = 1.0/((lev.dx1)*(lev.dx1));
+  Real iy = 1.0/((lev.dx2)*(lev.dx2));
+  Real iz = 1.0/((lev.dx3)*(lev.dx3));
+  Real diag = 2.0*(ix + iy + iz);
+  auto &u_ = lev.u;
+  auto &rhs_ = lev.rhs;
+
+  for (int color=0; color<2; ++color) {
+    SlabHaloExchange(l);
+    par_for("grav_mg_smooth", DevExeSpace(), 0, nloc-1, 0, n2-1, 0, n1-1,
+    KOKKOS_LAMBDA(const int kk, const int j, const int i) {
+      if (((kbeg + kk + j + i)%2) != color) {return;}
+      int k = kk + 1;  // ghost-plane offset in u
+      int ip = (i+1)%n1, im = (i-1+n1)%n1;
+      int jp = (j+1)%n2, jm = (j-1+n2)%n2;
+      Real nbr = ix*(u_((k*n2 + j)*n1 + ip) + u_((k*n2 + j)*n1 + im))
+               + iy*(u_((k*n2 + jp)*n1 + i) + u_((k*n2 + jm)*n1 + i))
+               + iz*(u_(((k+1)*n2 + j)*n1 + i) + u_(((k-1)*n2 + j)*n1 + i));
+      u_((k*n2 + j)*n1 + i) = (nbr - rhs_((kk*n2 + j)*n1 + i))/diag;
+    });
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::ResidualLevel()
+//  \brief Computes res = rhs - Lap(u) on the given level.  Halos of u must be current
+
+void Gravity::ResidualLevel(const int l) {
+  MGLevel &lev = mg[l];
+  int n1 = lev.n1, n2 = lev.n2;
+  int nloc = lev.kend - lev.kbeg;
+  Real ix = 1.0/((lev.dx1)*(lev.dx1));
+  Real iy = 1.0/((lev.dx2)*(lev.dx2));
+  Real iz = 1.0/((lev.dx3)*(lev.dx3));
+  Real diag = 2.0*(ix + iy + iz);
+  auto &u_ = lev.u;
+  auto &rhs_ = lev.rhs;
+  auto &res_ = lev.res;
+
+  par_for("grav_mg_resid", DevExeSpace(), 0, nloc-1, 0, n2-1, 0, n1-1,
+  KOKKOS_LAMBDA(const int kk, const int j, const int i) {
+    int k = kk + 1;
+    int ip = (i+1)%n1, im = (i-1+n1)%n1;
+    int jp = (j+1)%n2, jm = (j-1+n2)%n2;
+    Real lap = ix*(u_((k*n2 + j)*n1 + ip) + u_((k*n2 + j)*n1 + im))
+             + iy*(u_((k*n2 + jp)*n1 + i) + u_((k*n2 + jm)*n1 + i))
+             + iz*(u_(((k+1)*n2 + j)*n1 + i) + u_(((k-1)*n2 + j)*n1 + i))
+             - diag*u_((k*n2 + j)*n1 + i);
+    res_((kk*n2 + j)*n1 + i) = rhs_((kk*n2 + j)*n1 + i) - lap;
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::RestrictLevel()
+//  \brief Restricts the residual of level l into the right-hand side of level l+1 with
+//  the eight-point average of the cell-centered mesh refinement restriction.  The fine
+//  planes of every coarse plane are rank-local by construction of the slab ownership
+
+void Gravity::RestrictLevel(const int l) {
+  MGLevel &fin = mg[l];
+  MGLevel &crs = mg[l+1];
+  int fn1 = fin.n1, fn2 = fin.n2;
+  int cn1 = crs.n1, cn2 = crs.n2;
+  int cnloc = crs.kend - crs.kbeg;
+  auto &res_ = fin.res;
+  auto &crhs_ = crs.rhs;
+
+  par_for("grav_mg_restrict", DevExeSpace(), 0, cnloc-1, 0, cn2-1, 0, cn1-1,
+  KOKKOS_LAMBDA(const int ckk, const int cj, const int ci) {
+    int fk = 2*ckk, fj = 2*cj, fi = 2*ci;
+    crhs_((ckk*cn2 + cj)*cn1 + ci) = 0.125*(
+        res_((fk*fn2 + fj)*fn1 + fi)         + res_((fk*fn2 + fj)*fn1 + fi+1)
+      + res_((fk*fn2 + fj+1)*fn1 + fi)       + res_((fk*fn2 + fj+1)*fn1 + fi+1)
+      + res_(((fk+1)*fn2 + fj)*fn1 + fi)     + res_(((fk+1)*fn2 + fj)*fn1 + fi+1)
+      + res_(((fk+1)*fn2 + fj+1)*fn1 + fi)   + res_(((fk+1)*fn2 + fj+1)*fn1 + fi+1));
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::ProlongateLevel()
+//  \brief Prolongates the correction of level l+1 onto level l and adds it to the fine
+//  solution, with the min-mod limited piecewise-linear interpolation of the
+//  cell-centered mesh refinement prolongation.  Halos of the coarse u must be current
+
+void Gravity::ProlongateLevel(const int l) {
+  MGLevel &fin = mg[l];
+  MGLevel &crs = mg[l+1];
+  int fn1 = fin.n1, fn2 = fin.n2;
+  int cn1 = crs.n1, cn2 = crs.n2;
+  int cnloc = crs.kend - crs.kbeg;
+  auto &uf_ = fin.u;
+  auto &uc_ = crs.u;
+
+  par_for("grav_mg_prolong", DevExeSpace(), 0, cnloc-1, 0, cn2-1, 0, cn1-1,
+  KOKKOS_LAMBDA(const int ckk, const int cj, const int ci) {
+    int ck = ckk + 1;  // ghost-plane offset in coarse u
+    int cip = (ci+1)%cn1, cim = (ci-1+cn1)%cn1;
+    int cjp = (cj+1)%cn2, cjm = (cj-1+cn2)%cn2;
+    Real cc = uc_((ck*cn2 + cj)*cn1 + ci);
+
+    Real dl = cc - uc_((ck*cn2 + cj)*cn1 + cim);
+    Real dr = uc_((ck*cn2 + cj)*cn1 + cip) - cc;
+    Real dvar1 = 0.125*(SIGN(dl) + SIGN(dr))*fmin(fabs(dl), fabs(dr));
+
+    dl = cc - uc_((ck*cn2 + cjm)*cn1 + ci);
+    dr = uc_((ck*cn2 + cjp)*cn1 + ci) - cc;
+    Real dvar2 = 0.125*(SIGN(dl) + SIGN(dr))*fmin(fabs(dl), fabs(dr));
+
+    dl = cc - uc_(((ck-1)*cn2 + cj)*cn1 + ci);
+    dr = uc_(((ck+1)*cn2 + cj)*cn1 + ci) - cc;
+    Real dvar3 = 0.125*(SIGN(dl) + SIGN(dr))*fmin(fabs(dl), fabs(dr));
+
+    int fk = 2*ckk + 1, fj = 2*cj, fi = 2*ci;  // +1 is the ghost-plane offset in uf
+    uf_((fk*fn2 + fj)*fn1 + fi)         += cc - dvar1 - dvar2 - dvar3;
+    uf_((fk*fn2 + fj)*fn1 + fi+1)       += cc + dvar1 - dvar2 - dvar3;
+    uf_((fk*fn2 + fj+1)*fn1 + fi)       += cc - dvar1 + dvar2 - dvar3;
+    uf_((fk*fn2 + fj+1)*fn1 + fi+1)     += cc + dvar1 + dvar2 - dvar3;
+    uf_(((fk+1)*fn2 + fj)*fn1 + fi)     += cc - dvar1 - dvar2 + dvar3;
+    uf_(((fk+1)*fn2 + fj)*fn1 + fi+1)   += cc + dvar1 - dvar2 + dvar3;
+    uf_(((fk+1)*fn2 + fj+1)*fn1 + fi)   += cc - dvar1 + dvar2 + dvar3;
+    uf_(((fk+1)*fn2 + fj+1)*fn1 + fi+1) += cc + dvar1 + dvar2 + dvar3;
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::VCycle()
+//  \brief One V-cycle starting at the given level: pre-smooth, restrict the residual,
+//  recurse from a zero initial guess, prolongate the correction, post-smooth.  The
+//  coarsest level is solved approximately by extra smoothing sweeps
+
+void Gravity::VCycle(const int l) {
+  if (l == (nlevels-1)) {
+    for (int n=0; n<(4*nsmooth); ++n) {SmoothLevel(l);}
+    return;
+  }
+  for (int n=0; n<nsmooth; ++n) {SmoothLevel(l);}
+  SlabHaloExchange(l);
+  ResidualLevel(l);
+  RestrictLevel(l);
+  Kokkos::deep_copy(mg[l+1].u, 0.0);
+  VCycle(l+1);
+  SlabHaloExchange(l+1);
+  ProlongateLevel(l);
+  for (int n=0; n<nsmooth; ++n) {SmoothLevel(l);}
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::SolveMG()
+//  \brief Solves the Poisson equation Lap(phi) = 4 pi G rho on the global grid with
+//  V-cycles to the requested tolerance, leaving the potential (with ghost zones filled)
+//  in phi.  The fine-level solution persists between calls, so each solve warm-starts
+//  from the potential of the previous stage
+
+void Gravity::SolveMG() {
+  Mesh *pm = pmy_pack->pmesh;
+  auto &indcs = pm->mb_indcs;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int nmb = pmy_pack->nmb_thispack;
+
+  // (1) gather density into a flat device array in the canonical (m,k,j,i) order used
+  // by the communication maps
+  auto &dens_ = dens;
+  DvceArray5D<Real> u0;
+  if (pmy_pack->phydro != nullptr) {u0 = pmy_pack->phydro->u0;}
+  if (pmy_pack->pmhd   != nullptr) {u0 = pmy_pack->pmhd->u0;}
+  par_for("grav_mg_dens", DevExeSpace(), 0, nmb-1, 0, nx3-1, 0, nx2-1, 0, nx1-1,
+  KOKKOS_LAMBDA(const int m, const int kk, const int jj, const int ii) {
+    dens_(((m*nx3 + kk)*nx2 + jj)*nx1 + ii) = u0(m,IDN,kk+ks,jj+js,ii+is);
+  });
+
+  // (2) remap density into the fine-level slabs, scaling to the right-hand side
+  int nsend = 0, nrecv = 0;
+  for (int c : mb2s_scnt) {nsend += c;}
+  for (int c : mb2s_rcnt) {nrecv += c;}
+  auto &sbuf = sendbuf;
+  auto &rbuf = recvbuf;
+  auto &rhs0_ = mg[0].rhs;
+  Real fpg = four_pi_G;
+  {
+    auto &pack_ = mb2s_pack;
+    auto &unpk_ = mb2s_unpk;
+    par_for("grav_mg_dpack", DevExeSpace(), 0, nsend-1, KOKKOS_LAMBDA(const int p) {
+      sbuf(p) = dens_(pack_.d_view(p));
+    });
+    Exchange(mb2s_scnt, mb2s_rcnt, 1);
+    par_for("grav_mg_dunpk", DevExeSpace(), 0, nrecv-1, KOKKOS_LAMBDA(const int p) {
+      rhs0_(unpk_.d_view(p)) = fpg*rbuf(p);
+    });
+  }
+
+  // (3) subtract the global mean of the right-hand side: the periodic problem only
+  // admits solutions for a zero-mean source (the counterpart of the zeroed mean mode
+  // in the FFT solver)
+  int ntot0 = (mg[0].kend - mg[0].kbeg)*gnx2*gnx1;
+  Real rsum = 0.0;
+  Kokkos::parallel_reduce("grav_mg_mean", Kokkos::RangePolicy<>(DevExeSpace(), 0, ntot0),
+  KOKKOS_LAMBDA(const int e, Real &lsum) {
+    lsum += rhs0_(e);
+  }, Kokkos::Sum<Real>(rsum));
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, &rsum, 1, MPI_ATHENA_REAL, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  Real mean = rsum/(static_cast<Real>(gnx1)*static_cast<Real>(gnx2)
+                   *static_cast<Real>(gnx3));
+  par_for("grav_mg_demean", DevExeSpace(), 0, ntot0-1, KOKKOS_LAMBDA(const int e) {
+    rhs0_(e) -= mean;
+  });
+
+  // (4) reference norm of the right-hand side for the convergence test
+  Real rhs2 = 0.0;
+  Kokkos::parallel_reduce("grav_mg_norm0", Kokkos::RangePolicy<>(DevExeSpace(), 0,ntot0),
+  KOKKOS_LAMBDA(const int e, Real &lsum) {
+    lsum += rhs0_(e)*rhs0_(e);
+  }, Kokkos::Sum<Real>(rhs2));
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, &rhs2, 1, MPI_ATHENA_REAL, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  Real norm0 = std::sqrt(rhs2);
+
+  // (5) V-cycles until the fine-level residual drops below tolerance
+  if (norm0 > 0.0) {
+    auto &res0_ = mg[0].res;
+    Real rnorm = norm0;
+    int it = 0;
+    while (it < max_vcycles) {
+      VCycle(0);
+      it++;
+      SlabHaloExchange(0);
+      ResidualLevel(0);
+      Real res2 = 0.0;
+      Kokkos::parallel_reduce("grav_mg_rnorm",
+      Kokkos::RangePolicy<>(DevExeSpace(), 0, ntot0),
+      KOKKOS_LAMBDA(const int e, Real &lsum) {
+        lsum += res0_(e)*res0_(e);
+      }, Kokkos::Sum<Real>(res2));
+#if MPI_PARALLEL_ENABLED
+      MPI_Allreduce(MPI_IN_PLACE, &res2, 1, MPI_ATHENA_REAL, MPI_SUM, MPI_COMM_WORLD);
+#endif
+      rnorm = std::sqrt(res2);
+      if (rnorm <= mg_tol*norm0) {break;}
+    }
+    if ((rnorm > mg_tol*norm0) && (global_variable::my_rank == 0)) {
+      std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+          << "Multigrid gravity solver did not converge in " << max_vcycles
+          << " V-cycles; relative residual = " << rnorm/norm0 << std::endl;
+    }
+  }
+
+  // (6) scatter the potential back to MeshBlocks.  The map covers ghost zones through
+  // periodic wrap of the global indices, so phi needs no further boundary exchange
+  nsend = 0; nrecv = 0;
+  for (int c : s2mb_scnt) {nsend += c;}
+  for (int c : s2mb_rcnt) {nrecv += c;}
+  {
+    int ncells1 = indcs.nx1 + 2*(indcs.ng);
+    int ncells2 = indcs.nx2 + 2*(indcs.ng);
+    int ncells3 = indcs.nx3 + 2*(indcs.ng);
+    auto &pack_ = s2mb_pack;
+    auto &unpk_ = s2mb_unpk;
+    auto &u0_ = mg[0].u;
+    auto &phi_ = phi;
+    par_for("grav_mg_ppack", DevExeSpace(), 0, nsend-1, KOKKOS_LAMBDA(const int p) {
+      sbuf(p) = u0_(pack_.d_view(p));
+    });
+    Exchange(s2mb_scnt, s2mb_rcnt, 1);
+    par_for("grav_mg_punpk", DevExeSpace(), 0, nrecv-1, KOKKOS_LAMBDA(const int p) {
+      int e = unpk_.d_view(p);
+      int i = e%ncells1;
+      int j = (e/ncells1)%ncells2;
+      int k = (e/(ncells1*ncells2))%ncells3;
+      int m = e/(ncells1*ncells2*ncells3);
+      phi_(m,0,k,j,i) = rbuf(p);
+    });
+  }
+  return;
+}
+
+} // namespace gravity
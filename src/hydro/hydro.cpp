@@ -19,6 +19,8 @@
 #include "srcterms/srcterms.hpp"
 #include "shearing_box/shearing_box.hpp"
 #include "bvals/bvals.hpp"
+#include "utils/memory_accounting.hpp"
+#include "utils/uvm_spill.hpp"
 #include "hydro/hydro.hpp"
 
 namespace hydro {
@@ -34,7 +36,13 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     u1("cons1",1,1,1,1,1),
     uflx("uflx",1,1,1,1,1),
     utest("utest",1,1,1,1,1),
-    fofc("fofc",1,1,1,1) {
+    fofc("fofc",1,1,1,1),
+    fofc_list("fofc_list",1),
+    fofc_count("fofc_count",1),
+    fofc_count_host("fofc_count_host",1),
+    dtmin_flx("dtmin_flx",1) {
+  // attribute device allocations made in this constructor to the hydro subsystem
+  memory_accounting::Scope mem_scope("hydro");
   // Total number of MeshBlocks on this rank to be used in array dimensioning
   int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
 
@@ -111,12 +119,17 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     int n_ccells1 = indcs.cnx1 + 2*(indcs.ng);
     int n_ccells2 = (indcs.cnx2 > 1)? (indcs.cnx2 + 2*(indcs.ng)) : 1;
     int n_ccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
-    Kokkos::realloc(coarse_u0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
-    Kokkos::realloc(coarse_w0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    uvm_spill::Realloc(coarse_u0, "hydro_coarse_u0",
+                       nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    uvm_spill::Realloc(coarse_w0, "hydro_coarse_w0",
+                       nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
   }
 
-  // allocate boundary buffers for conserved (cell-centered) variables
-  pbval_u = new MeshBoundaryValuesCC(ppack, pin, false);
+  // allocate boundary buffers for conserved (cell-centered) variables.  Optional
+  // <hydro>/nghost_comm exchanges fewer ghost cells than <mesh>/nghost when the mesh
+  // width is set by a more demanding module (e.g. Z4c); it must cover the hydro stencil
+  pbval_u = new MeshBoundaryValuesCC(ppack, pin, false,
+                                     pin->GetOrAddInteger("hydro", "nghost_comm", -1));
   pbval_u->InitializeBuffers((nhydro+nscalars));
 
   // Orbital advection and shearing box BCs (if requested in input file)
@@ -133,6 +146,84 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     // determine if FOFC is enabled
     use_fofc = pin->GetOrAddBoolean("hydro","fofc",false);
 
+    // determine if flux-divergence accumulation is fused into the flux kernels.  This
+    // saves a full re-read of the flux arrays in the RK update, but cannot be used with
+    // anything that modifies the fluxes after CalculateFluxes() runs
+    fused_fluxes = pin->GetOrAddBoolean("hydro","fused_fluxes",false);
+    if (fused_fluxes && (use_fofc || pvisc != nullptr || pcond != nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<hydro>/fused_fluxes cannot be used with FOFC, "
+                << "viscosity, or conduction" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (fused_fluxes && pmy_pack->pcoord->is_general_relativistic &&
+        pmy_pack->pcoord->coord_data.bh_excise) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<hydro>/fused_fluxes cannot be used with black hole "
+                << "excision, which applies FOFC to the fluxes" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    // determine if all three flux directions are computed in a single kernel launch,
+    // which reads the primitives once instead of once per direction
+    one_pass_fluxes = pin->GetOrAddBoolean("hydro","one_pass_fluxes",false);
+    if (one_pass_fluxes && (use_fofc || fused_fluxes)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<hydro>/one_pass_fluxes cannot be used with FOFC "
+                << "or fused_fluxes" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    // determine if the flux kernels also reduce the minimum cell-crossing time over the
+    // grid on the final stage, replacing the dedicated full-grid sweep in NewTimeStep
+    fused_newdt = pin->GetOrAddBoolean("hydro","fused_newdt",false);
+    if (fused_newdt &&
+        (pmy_pack->pcoord->is_special_relativistic ||
+         pmy_pack->pcoord->is_general_relativistic ||
+         pmy_pack->pcoord->is_dynamical_relativistic ||
+         evolution_t.compare("kinematic") == 0)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<hydro>/fused_newdt requires non-relativistic "
+                << "dynamic evolution" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    // determine if the RK update also converts the freshly-updated conserved state to
+    // primitives in registers, so ConToPrim only needs to sweep the ghost zones.  Only
+    // valid when nothing modifies u0 in active cells between the update and ConToPrim,
+    // so source terms (applied after the update) and SMR/AMR are excluded
+    fused_update_c2p = pin->GetOrAddBoolean("hydro","fused_update_c2p",false);
+    if (fused_update_c2p &&
+        (pmy_pack->pcoord->is_special_relativistic ||
+         pmy_pack->pcoord->is_general_relativistic ||
+         pmy_pack->pcoord->is_dynamical_relativistic ||
+         evolution_t.compare("kinematic") == 0)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<hydro>/fused_update_c2p requires non-relativistic "
+                << "dynamic evolution" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (fused_update_c2p && pmy_pack->pmesh->multilevel) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<hydro>/fused_update_c2p requires a single-level mesh"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (fused_update_c2p &&
+        (psrc->const_accel || psrc->ism_cooling || psrc->rel_cooling ||
+         psrc->shearing_box ||
+         pin->GetOrAddBoolean("problem","user_srcs",false))) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<hydro>/fused_update_c2p cannot be used with source "
+                << "terms, which modify u0 after the update" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    // determine if ConToPrim is split so the active cells (which need only the local
+    // update) are converted while RecvU waits on neighbor messages, leaving just the
+    // ghost-zone slabs for the post-receive sweep
+    overlap_c2p = pin->GetOrAddBoolean("hydro","overlap_c2p",false);
+
     // select reconstruction method (default PLM)
     std::string xorder = pin->GetOrAddString("hydro","reconstruct","plm");
     if (xorder.compare("dc") == 0) {
@@ -179,6 +270,157 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
       std::exit(EXIT_FAILURE);
     }
 
+    // optionally project PPM reconstruction onto characteristic variables
+    char_proj = pin->GetOrAddBoolean("hydro","char_projection",false);
+    if (char_proj) {
+      if (!(recon_method == ReconstructionMethod::ppm4 ||
+            recon_method == ReconstructionMethod::ppmx)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/char_projection requires ppm4 or ppmx "
+                  << "reconstruction" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (pmy_pack->pcoord->is_special_relativistic ||
+          pmy_pack->pcoord->is_general_relativistic ||
+          !(peos->eos_data.is_ideal) || !(peos->eos_data.use_e)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/char_projection only works for "
+                  << "non-relativistic ideal-gas hydrodynamics" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
+    // optionally stage the x3 reconstruction stencil in scratch: each w0 plane is then
+    // loaded once per sweep instead of five times, equalizing per-direction cost
+    staged_x3 = pin->GetOrAddBoolean("hydro","staged_x3",false);
+    if (staged_x3 && char_proj) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<hydro>/staged_x3 cannot be used with "
+                << "<hydro>/char_projection" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    // optionally correct the scheme to fourth-order accuracy with quadrature terms
+    // (cf. McCorquodale & Colella 2011; Felker & Stone 2018): cell-averaged conserved
+    // variables are deconvolved to point values before the cons-to-prim conversion,
+    // and the face-centered point fluxes are convolved to face averages with
+    // transverse Laplacians after the flux kernels
+    fourth_order = pin->GetOrAddBoolean("hydro","fourth_order",false);
+    if (fourth_order) {
+      auto &indcs = pmy_pack->pmesh->mb_indcs;
+      if (!(recon_method == ReconstructionMethod::ppm4 ||
+            recon_method == ReconstructionMethod::ppmx ||
+            recon_method == ReconstructionMethod::wenoz)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/fourth_order requires ppm4, ppmx, or "
+                  << "wenoz reconstruction" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (indcs.ng < 4) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/fourth_order requires at least 4 ghost "
+                  << "zones, but <mesh>/nghost=" << indcs.ng << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (pmy_pack->pcoord->is_special_relativistic ||
+          pmy_pack->pcoord->is_general_relativistic ||
+          (peos->eos_data.is_ideal && !(peos->eos_data.use_e))) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/fourth_order only works for "
+                  << "non-relativistic hydrodynamics" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (pmy_pack->pmesh->multilevel) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/fourth_order requires a single-level mesh "
+                  << "(prolongation and restriction are second order)" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (use_fofc || one_pass_fluxes || fused_fluxes) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/fourth_order cannot be used with FOFC, "
+                  << "one_pass_fluxes, or fused_fluxes" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
+    // optionally exchange ghost zones only every N stages, widening the flux and update
+    // sweeps into the ghost regions on the stages in between.  The redundant ghost
+    // updates repeat the neighbor's interior arithmetic exactly on a uniform grid, so
+    // only the communication pattern changes, not the answer.  Requires enough ghost
+    // zones to feed the reconstruction stencil for every skipped exchange
+    gce_interval = pin->GetOrAddInteger("hydro","ghost_exchange_interval",1);
+    if (gce_interval > 1) {
+      auto &indcs = pmy_pack->pmesh->mb_indcs;
+      if (recon_method == ReconstructionMethod::dc) {
+        gce_stencil = 1;
+      } else if (recon_method == ReconstructionMethod::plm) {
+        gce_stencil = 2;
+      } else {
+        gce_stencil = 3;
+      }
+      if (indcs.ng < gce_interval*gce_stencil) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/ghost_exchange_interval=" << gce_interval
+                  << " with this reconstruction requires <mesh>/nghost >= "
+                  << gce_interval*gce_stencil << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (pmy_pack->pmesh->multilevel) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/ghost_exchange_interval requires a "
+                  << "single-level mesh" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (pmy_pack->pcoord->is_general_relativistic) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/ghost_exchange_interval cannot be used in GR "
+                  << "(coordinate source terms are only applied in the interior)"
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (use_fofc || fourth_order ||
+          pin->GetOrAddBoolean("time","flux_accumulation",false)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/ghost_exchange_interval cannot be used with "
+                  << "FOFC, fourth_order, or flux_accumulation" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if ((pvisc != nullptr) || (pcond != nullptr)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/ghost_exchange_interval cannot be used with "
+                  << "viscosity or conduction" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (psrc->const_accel || psrc->ism_cooling || psrc->rel_cooling ||
+          psrc->shearing_box || pin->GetOrAddBoolean("problem","user_srcs",false)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/ghost_exchange_interval cannot be used with "
+                  << "source terms (they are only applied in the interior)" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (pin->DoesBlockExist("mhd") || pin->DoesBlockExist("radiation") ||
+          pin->DoesBlockExist("z4c")) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/ghost_exchange_interval only works for "
+                  << "pure hydrodynamics" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (pin->GetOrAddInteger("hydro","nghost_comm",-1) != -1) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/ghost_exchange_interval cannot be used with "
+                  << "<hydro>/nghost_comm (full-depth exchanges are required)"
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (pin->GetOrAddString("time","integrator","rk2").compare("rk4") == 0) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro>/ghost_exchange_interval does not support the "
+                  << "rk4 integrator" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
     // select Riemann solver (no default).  Test for compatibility of options
     std::string rsolver = pin->GetString("hydro","rsolver");
     // Special relativistic dynamic solvers
@@ -272,7 +514,16 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
       int ncells1 = indcs.nx1 + 2*(indcs.ng);
       int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
       int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
-      Kokkos::realloc(u1,       nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      // with <time>/flux_accumulation the second register is eliminated: u1 aliases u0
+      // and CopyCons() rebuilds the weighted stage combination by re-applying the first
+      // stage's flux divergence (two-stage integrators only; validated by the Driver)
+      flux_accum = pin->GetOrAddBoolean("time", "flux_accumulation", false);
+      if (flux_accum) {
+        u1 = u0;
+      } else {
+        uvm_spill::Realloc(u1, "hydro_u1",
+                           nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      }
       Kokkos::realloc(uflx.x1f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
       Kokkos::realloc(uflx.x2f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
       Kokkos::realloc(uflx.x3f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
@@ -282,6 +533,31 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
         Kokkos::realloc(fofc,  nmb, ncells3, ncells2, ncells1);
         Kokkos::realloc(utest, nmb, nhydro, ncells3, ncells2, ncells1);
       }
+
+      // allocate compacted list of flagged-cell indices used with FOFC and/or excision
+      if (use_fofc || (pmy_pack->pcoord->is_general_relativistic &&
+                       pmy_pack->pcoord->coord_data.bh_excise)) {
+        Kokkos::realloc(fofc_list, nmb*ncells3*ncells2*ncells1);
+      }
+
+      // allocate fourth-order primitives and the point-flux scratch array
+      if (fourth_order) {
+        Kokkos::realloc(wfv,   nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+        Kokkos::realloc(flxpt, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      }
+
+      // allocate flux-divergence accumulator used by the fused flux kernels
+      if (fused_fluxes) {
+        Kokkos::realloc(udivf, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      }
+
+      // allocate registers for super-time-stepped diffusion.  Passive scalars are not
+      // diffused, so only nhydro components are stored
+      if (pin->GetOrAddBoolean("time", "sts", false) &&
+          ((pvisc != nullptr) || (pcond != nullptr))) {
+        Kokkos::realloc(u_sts0,   nmb, nhydro, ncells3, ncells2, ncells1);
+        Kokkos::realloc(rhs_sts0, nmb, nhydro, ncells3, ncells2, ncells1);
+      }
     }
   }
 }
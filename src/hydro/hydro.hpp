@@ -43,6 +43,7 @@ struct HydroTaskIDs {
   TaskID sendf;
   TaskID recvf;
   TaskID rkupdt;
+  TaskID rkupdtb;
   TaskID srctrms;
   TaskID sendu_oa;
   TaskID recvu_oa;
@@ -53,6 +54,7 @@ struct HydroTaskIDs {
   TaskID recvu_shr;
   TaskID bcs;
   TaskID prol;
+  TaskID c2p_int;
   TaskID c2p;
   TaskID newdt;
   TaskID csend;
@@ -103,6 +105,40 @@ class Hydro {
   DvceArray4D<bool> fofc;  // flag for each cell to indicate if FOFC is needed
   bool use_fofc = false;   // flag to enable FOFC
   DvceArray5D<Real> utest;  // scratch array for FOFC
+  DvceArray1D<int> fofc_list;   // compacted list of flattened indices of flagged cells
+  DvceArray1D<int> fofc_count;  // single-element device counter for flagged cells
+  StageArray1D<int> fofc_count_host;  // persistent pinned landing buffer for the count
+
+  // following used for super-time-stepped diffusion (<time>/sts=true)
+  DvceArray5D<Real> u_sts0;    // state at start of super-step (Y_0 in RKL2 recurrence)
+  DvceArray5D<Real> rhs_sts0;  // diffusive RHS of Y_0, reused by every RKL2 stage
+
+  // following used for fused flux kernels
+  bool fused_fluxes = false;  // accumulate flux divergence inside the flux kernels
+  DvceArray5D<Real> udivf;    // flux divergence accumulated by the fused flux kernels
+  bool one_pass_fluxes = false;  // compute all three flux directions in one kernel
+  bool fused_newdt = false;      // flux kernels reduce min cell-crossing time in-place
+  bool char_proj = false;  // PPM limits in characteristic variables (ideal hydro only)
+  bool staged_x3 = false;  // x3 sweep stages stencil planes in scratch, loaded once each
+  bool dtmin_computed = false;   // true once the flux kernels have reduced a timestep
+  bool fused_update_c2p = false;  // RK update also converts cons to prims in registers
+  bool fused_c2p_done = false;    // true once RKUpdateC2P() has filled w0 in active cells
+  bool flux_accum = false;  // u1 aliases u0; stage-0 combination rebuilt in CopyCons()
+  bool overlap_c2p = false;  // convert active cells while RecvU waits; ghosts afterward
+  DvceArray1D<Real> dtmin_flx;   // single-element device min of cell-crossing time
+
+  // following used for ghost-cell expansion (<hydro>/ghost_exchange_interval): the
+  // full-depth halo is exchanged only every gce_interval stages (and on the final stage
+  // of each step), and in between the flux/update sweeps widen into the ghost zones so
+  // ghost cells are evolved redundantly with the same arithmetic as the neighbor's
+  // interior.  Trades extra flops for fewer messages in latency-bound runs
+  int gce_interval = 1;  // stages between ghost-zone exchanges (1 = every stage)
+  int gce_stencil = 2;   // ghost depth consumed per redundant stage (set from recon)
+
+  // following used for fourth-order flux quadrature (<hydro>/fourth_order)
+  bool fourth_order = false;  // correct fluxes to fourth-order face averages
+  DvceArray5D<Real> wfv;      // fourth-order accurate cell-averaged primitives
+  DvceArray5D<Real> flxpt;    // scratch copy of face-centered point fluxes
 
   // container to hold names of TaskIDs
   HydroTaskIDs id;
@@ -117,6 +153,18 @@ class Hydro {
   TaskStatus SendFlux(Driver *d, int stage);
   TaskStatus RecvFlux(Driver *d, int stage);
   TaskStatus RKUpdate(Driver *d, int stage);
+  TaskStatus RKUpdateInterior(Driver *d, int stage);
+  TaskStatus RKUpdateBndry(Driver *d, int stage);
+  TaskStatus RKUpdateRange(Driver *d, int stage,
+                           int is, int ie, int js, int je, int ks, int ke);
+  // ...and templated over dimensionality (same dispatch pattern as CalculateFluxes),
+  // so 1D/2D runs compile without the x2/x3 divergence terms and index arithmetic
+  template <int NDIM>
+  TaskStatus RKUpdateRange(Driver *d, int stage,
+                           int is, int ie, int js, int je, int ks, int ke);
+  TaskStatus RKUpdateC2P(Driver *d, int stage);
+  template <int NDIM>
+  TaskStatus RKUpdateC2P(Driver *d, int stage);
   TaskStatus HydroSrcTerms(Driver *d, int stage);
   TaskStatus SendU_OA(Driver *d, int stage);
   TaskStatus RecvU_OA(Driver *d, int stage);
@@ -127,19 +175,37 @@ class Hydro {
   TaskStatus RecvU_Shr(Driver *d, int stage);
   TaskStatus ApplyPhysicalBCs(Driver* pdrive, int stage);
   TaskStatus Prolongate(Driver* pdrive, int stage);
+  TaskStatus ConToPrimInterior(Driver *d, int stage);
   TaskStatus ConToPrim(Driver *d, int stage);
   TaskStatus NewTimeStep(Driver *d, int stage);
+  // ...helpers for ghost-cell expansion (see hydro_tasks.cpp)
+  bool GhostExchangeThisStage(Driver *d, int stage) const;
+  int GhostExpand(Driver *d, int stage) const;
   // ...in "after_stagen_tl" list
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);  // also in Driver::Initialize
 
-  // CalculateFluxes function templated over Riemann Solvers
+  // CalculateFluxes function templated over Riemann Solvers; selects reconstruction
+  // method at compile time and calls the doubly-templated version below
   template <Hydro_RSolver T>
   void CalculateFluxes(Driver *d, int stage);
+  // ...and templated over both Riemann solver and reconstruction method, so that each
+  // combination compiles to a fully specialized kernel
+  template <Hydro_RSolver T, ReconstructionMethod R>
+  void CalculateFluxes(Driver *d, int stage);
 
   // first-order flux correction
   void FOFC(Driver *d, int stage);
 
+  // fourth-order quadrature steps bracketing the flux kernels (see
+  // hydro_fourth_order.cpp); both called from CalculateFluxes
+  void ConvertPrimFourthOrder();
+  void FluxQuadratureCorrection();
+
+  // super-time-stepped diffusion (called from Driver::SuperTimeStep())
+  void STSUpdate(const int jstage, const Real dt, const Real mu, const Real nu,
+                 const Real mu_tilde, const Real gamma_tilde);
+
  private:
   MeshBlockPack* pmy_pack;  // ptr to MeshBlockPack containing this Hydro
 };
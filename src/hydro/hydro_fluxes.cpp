@@ -7,12 +7,15 @@
 //! \brief Calculate 3D fluxes for hydro
 
 #include <iostream>
+#include <limits>
 
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
 #include "coordinates/coordinates.hpp"
 #include "hydro.hpp"
 #include "eos/eos.hpp"
+#include "diffusion/viscosity.hpp"
+#include "diffusion/conduction.hpp"
 #include "reconstruct/dc.hpp"
 #include "reconstruct/plm.hpp"
 #include "reconstruct/ppm.hpp"
@@ -32,9 +35,10 @@ namespace hydro {
 //----------------------------------------------------------------------------------------
 //! \fn void Hydro::CalculateFluxes
 //! \brief Calls reconstruction and Riemann solver functions to compute hydro fluxes
-//! Note this function is templated over RS for better performance on GPUs.
+//! Note this function is templated over both RS and reconstruction method for better
+//! performance on GPUs, so each combination compiles to a fully specialized kernel.
 
-template <Hydro_RSolver rsolver_method_>
+template <Hydro_RSolver rsolver_method_, ReconstructionMethod recon_method_>
 void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   RegionIndcs &indcs_ = pmy_pack->pmesh->mb_indcs;
   int is = indcs_.is, ie = indcs_.ie;
@@ -42,24 +46,331 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   int ks = indcs_.ks, ke = indcs_.ke;
   int ncells1 = indcs_.nx1 + 2*(indcs_.ng);
 
+  // with ghost-cell expansion, widen every sweep so the ghost strip that must stay
+  // valid until the next exchange is evolved with the same fluxes as the neighbor's
+  // interior.  All direction-specific loop bounds below derive from these locals
+  int gw = GhostExpand(pdriver, stage);
+  if (gw > 0) {
+    is -= gw;  ie += gw;
+    if (pmy_pack->pmesh->multi_d) {js -= gw;  je += gw;}
+    if (pmy_pack->pmesh->three_d) {ks -= gw;  ke += gw;}
+  }
+
   int &nhyd_  = nhydro;
   int nvars = nhydro + nscalars;
   int nmb1 = pmy_pack->nmb_thispack - 1;
-  const auto recon_method_ = recon_method;
   bool extrema = false;
-  if (recon_method == ReconstructionMethod::ppmx) {
+  if constexpr (recon_method_ == ReconstructionMethod::ppmx) {
     extrema = true;
   }
+  bool cproj = char_proj;
 
   auto &eos_ = peos->eos_data;
   auto &size_ = pmy_pack->pmb->mb_size;
   auto &coord_ = pmy_pack->pcoord->coord_data;
-  auto &w0_ = w0;
+  // with fourth_order, reconstruct from the fourth-order cell-averaged primitives
+  // assembled by ConvertPrimFourthOrder(); the resulting face-centered point fluxes
+  // are convolved to face averages after the three sweeps below
+  if (fourth_order) {ConvertPrimFourthOrder();}
+  auto &w0_ = (fourth_order)? wfv : w0;
+  bool fused_ = fused_fluxes;
+  auto &udivf_ = udivf;
+
+  // viscous and (isotropic) conductive fluxes are added inside the kernels below, while
+  // each row of fluxes is still in cache.  The temperature-dependent conductivity keeps
+  // its own pass (see Fluxes); with super-time-stepping the diffusive operators are
+  // applied by Driver::SuperTimeStep() instead
+  bool add_visc_ = (pvisc != nullptr) && !(pdriver->sts);
+  Real nu_iso_ = (add_visc_)? pvisc->nu_iso : 0.0;
+  bool add_cond_ = (pcond != nullptr) && !(pdriver->sts) &&
+                   !(pcond->tdep_kappa) && (pcond->kappa > 0.0);
+  Real kappa_ = (add_cond_)? pcond->kappa : 0.0;
+  const bool is_ideal_ = eos_.is_ideal;
+  const bool use_e_ = eos_.use_e;
+  Real gm1_ = eos_.gamma - 1.0;
+
+  // on the final stage with fused_newdt, the x1-flux kernel also reduces the minimum
+  // cell-crossing time while this row of w0 is still in cache, so the dedicated
+  // full-grid sweep in NewTimeStep can be skipped
+  bool compute_dt_ = fused_newdt && (stage == pdriver->nexp_stages);
+  auto &dtmin_ = dtmin_flx;
+  bool multi_d_ = pmy_pack->pmesh->multi_d;
+  bool three_d_ = pmy_pack->pmesh->three_d;
+  if (compute_dt_) {
+    Kokkos::deep_copy(dtmin_, static_cast<Real>(std::numeric_limits<float>::max()));
+    dtmin_computed = true;
+  }
+
+  //--------------------------------------------------------------------------------------
+  // single-launch mode: compute fluxes in all three directions in one kernel, so each
+  // row's stencil of w0 is read while still resident in cache.  The x2/x3 interface
+  // states are built by reconstructing both adjacent rows, trading some redundant
+  // reconstruction work for a 3x reduction in reads of the primitives
+
+  if (one_pass_fluxes) {
+    size_t scr_size_1p = ScrArray2D<FluxReal>::shmem_size(nvars, ncells1) * 3;
+    bool multi_d = pmy_pack->pmesh->multi_d;
+    bool three_d = pmy_pack->pmesh->three_d;
+    int ku_1p = (three_d)? ke+1 : ke;
+    int ju_1p = (multi_d)? je+1 : je;
+    auto &flx1_1p = uflx.x1f;
+    auto &flx2_1p = uflx.x2f;
+    auto &flx3_1p = uflx.x3f;
+
+    par_for_outer("hflux_1pass",DevExeSpace(), scr_size_1p, 0, 0, nmb1,
+                  ks, ku_1p, js, ju_1p,
+    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+      ScrArray2D<FluxReal> wl(member.team_scratch(0), nvars, ncells1);
+      ScrArray2D<FluxReal> wr(member.team_scratch(0), nvars, ncells1);
+      ScrArray2D<FluxReal> wtmp(member.team_scratch(0), nvars, ncells1);
+      // NOTE(@pdmullen): Capture variables prior to if constexpr.  Required for cuda
+      // 11.6+.
+      auto eos = eos_;
+      auto indcs = indcs_;
+      auto size = size_;
+      auto coord = coord_;
+      auto flx1 = flx1_1p;
+      auto flx2 = flx2_1p;
+      auto flx3 = flx3_1p;
+
+      // x1-fluxes for this row: reconstruct qR[i] and qL[i+1]
+      if ((k <= ke) && (j <= je)) {
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX1(member, m, k, j, is-1, ie+1, w0_, wl, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX1(member, m, k, j, is-1, ie+1, w0_, wl, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          if (cproj) {
+            PiecewiseParabolicCharX1(member,eos,extrema,true,m,k,j,is-1,ie+1,w0_,wl,wr);
+          } else {
+            PiecewiseParabolicX1(member,eos,extrema,true,m,k,j,is-1,ie+1, w0_, wl, wr);
+          }
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX1(member, eos, true, m, k, j, is-1, ie+1, w0_, wl, wr);
+        }
+        member.team_barrier();
+
+        if constexpr (rsolver_method_ == Hydro_RSolver::advect) {
+          Advect(member, eos, indcs, size, coord, m, k, j, is, ie+1, IVX, wl, wr, flx1);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::llf) {
+          LLF(member, eos, indcs, size, coord, m, k, j, is, ie+1, IVX, wl, wr, flx1);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle) {
+          HLLE(member, eos, indcs, size, coord, m, k, j, is, ie+1, IVX, wl, wr, flx1);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hllc) {
+          HLLC(member, eos, indcs, size, coord, m, k, j, is, ie+1, IVX, wl, wr, flx1);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::roe) {
+          Roe(member, eos, indcs, size, coord, m, k, j, is, ie+1, IVX, wl, wr, flx1);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::llf_sr) {
+          LLF_SR(member, eos, indcs, size, coord, m, k, j, is, ie+1, IVX, wl, wr, flx1);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle_sr) {
+          HLLE_SR(member, eos, indcs, size, coord, m, k, j, is, ie+1, IVX, wl, wr, flx1);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hllc_sr) {
+          HLLC_SR(member, eos, indcs, size, coord, m, k, j, is, ie+1, IVX, wl, wr, flx1);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::llf_gr) {
+          LLF_GR(member, eos, indcs, size, coord, m, k, j, is, ie+1, IVX, wl, wr, flx1);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle_gr) {
+          HLLE_GR(member, eos, indcs, size, coord, m, k, j, is, ie+1, IVX, wl, wr, flx1);
+        }
+        member.team_barrier();
+
+        if (nvars > nhyd_) {
+          for (int n=nhyd_; n<nvars; ++n) {
+            par_for_inner(member, is, ie+1, [&](const int i) {
+              if (flx1(m,IDN,k,j,i) >= 0.0) {
+                flx1(m,n,k,j,i) = flx1(m,IDN,k,j,i)*wl(n,i);
+              } else {
+                flx1(m,n,k,j,i) = flx1(m,IDN,k,j,i)*wr(n,i);
+              }
+            });
+          }
+          member.team_barrier();
+        }
+
+        // add diffusive fluxes while this row is still in cache
+        if (add_visc_) {
+          IsoViscousFluxX1(member, is_ideal_, size, nu_iso_, multi_d_, three_d_,
+                           m, k, j, is, ie+1, w0_, flx1);
+        }
+        if (add_cond_) {
+          IsoHeatFluxX1(member, use_e_, gm1_, size, kappa_, m, k, j, is, ie+1,
+                        w0_, flx1);
+        }
+
+        // on the final stage with fused_newdt, reduce min cell-crossing time
+        if (compute_dt_) {
+          Real row_dtmin;
+          Kokkos::parallel_reduce(Kokkos::TeamVectorRange(member, is, ie+1),
+          [&](const int i, Real &min_dt) {
+            Real cs;
+            if (eos.is_ideal) {
+              cs = eos.IdealHydroSoundSpeed(w0_(m,IDN,k,j,i),
+                                            eos.IdealGasPressure(w0_(m,IEN,k,j,i)));
+            } else {
+              cs = eos.iso_cs;
+            }
+            Real dtc = size.d_view(m).dx1/(fabs(w0_(m,IVX,k,j,i)) + cs);
+            if (multi_d_) {
+              dtc = fmin(dtc, size.d_view(m).dx2/(fabs(w0_(m,IVY,k,j,i)) + cs));
+            }
+            if (three_d_) {
+              dtc = fmin(dtc, size.d_view(m).dx3/(fabs(w0_(m,IVZ,k,j,i)) + cs));
+            }
+            min_dt = fmin(dtc, min_dt);
+          }, Kokkos::Min<Real>(row_dtmin));
+          Kokkos::single(Kokkos::PerTeam(member), [&]() {
+            Kokkos::atomic_min(&dtmin_(0), row_dtmin);
+          });
+        }
+      }
+
+      // x2-fluxes on interface j: qL from reconstructing row j-1, qR from row j
+      if (multi_d && (k <= ke)) {
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX2(member, m, k, j-1, is, ie, w0_, wl, wtmp);
+          DonorCellX2(member, m, k, j,   is, ie, w0_, wtmp, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX2(member, m, k, j-1, is, ie, w0_, wl, wtmp);
+          PiecewiseLinearX2(member, m, k, j,   is, ie, w0_, wtmp, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          if (cproj) {
+            PiecewiseParabolicCharX2(member,eos,extrema,true,m,k,j-1,is,ie,w0_,wl,wtmp);
+            PiecewiseParabolicCharX2(member,eos,extrema,true,m,k,j,  is,ie,w0_,wtmp,wr);
+          } else {
+            PiecewiseParabolicX2(member,eos,extrema,true, m,k,j-1, is,ie, w0_, wl, wtmp);
+            PiecewiseParabolicX2(member,eos,extrema,true, m,k,j,   is,ie, w0_, wtmp, wr);
+          }
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX2(member, eos, true, m, k, j-1, is, ie, w0_, wl, wtmp);
+          WENOZX2(member, eos, true, m, k, j,   is, ie, w0_, wtmp, wr);
+        }
+        member.team_barrier();
+
+        if constexpr (rsolver_method_ == Hydro_RSolver::advect) {
+          Advect(member, eos, indcs, size, coord, m, k, j, is, ie, IVY, wl, wr, flx2);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::llf) {
+          LLF(member, eos, indcs, size, coord, m, k, j, is, ie, IVY, wl, wr, flx2);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle) {
+          HLLE(member, eos, indcs, size, coord, m, k, j, is, ie, IVY, wl, wr, flx2);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hllc) {
+          HLLC(member, eos, indcs, size, coord, m, k, j, is, ie, IVY, wl, wr, flx2);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::roe) {
+          Roe(member, eos, indcs, size, coord, m, k, j, is, ie, IVY, wl, wr, flx2);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::llf_sr) {
+          LLF_SR(member, eos, indcs, size, coord, m, k, j, is, ie, IVY, wl, wr, flx2);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle_sr) {
+          HLLE_SR(member, eos, indcs, size, coord, m, k, j, is, ie, IVY, wl, wr, flx2);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hllc_sr) {
+          HLLC_SR(member, eos, indcs, size, coord, m, k, j, is, ie, IVY, wl, wr, flx2);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::llf_gr) {
+          LLF_GR(member, eos, indcs, size, coord, m, k, j, is, ie, IVY, wl, wr, flx2);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle_gr) {
+          HLLE_GR(member, eos, indcs, size, coord, m, k, j, is, ie, IVY, wl, wr, flx2);
+        }
+        member.team_barrier();
+
+        if (nvars > nhyd_) {
+          for (int n=nhyd_; n<nvars; ++n) {
+            par_for_inner(member, is, ie, [&](const int i) {
+              if (flx2(m,IDN,k,j,i) >= 0.0) {
+                flx2(m,n,k,j,i) = flx2(m,IDN,k,j,i)*wl(n,i);
+              } else {
+                flx2(m,n,k,j,i) = flx2(m,IDN,k,j,i)*wr(n,i);
+              }
+            });
+          }
+          member.team_barrier();
+        }
+
+        // add diffusive fluxes while this row is still in cache
+        if (add_visc_) {
+          IsoViscousFluxX2(member, is_ideal_, size, nu_iso_, three_d_,
+                           m, k, j, is, ie, w0_, flx2);
+        }
+        if (add_cond_) {
+          IsoHeatFluxX2(member, use_e_, gm1_, size, kappa_, m, k, j, is, ie,
+                        w0_, flx2);
+        }
+      }
+
+      // x3-fluxes on interface k: qL from reconstructing row k-1, qR from row k
+      if (three_d && (j <= je)) {
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX3(member, m, k-1, j, is, ie, w0_, wl, wtmp);
+          DonorCellX3(member, m, k,   j, is, ie, w0_, wtmp, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX3(member, m, k-1, j, is, ie, w0_, wl, wtmp);
+          PiecewiseLinearX3(member, m, k,   j, is, ie, w0_, wtmp, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          if (cproj) {
+            PiecewiseParabolicCharX3(member,eos,extrema,true,m,k-1,j,is,ie,w0_,wl,wtmp);
+            PiecewiseParabolicCharX3(member,eos,extrema,true,m,k,  j,is,ie,w0_,wtmp,wr);
+          } else {
+            PiecewiseParabolicX3(member,eos,extrema,true, m,k-1,j, is,ie, w0_, wl, wtmp);
+            PiecewiseParabolicX3(member,eos,extrema,true, m,k,  j, is,ie, w0_, wtmp, wr);
+          }
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX3(member, eos, true, m, k-1, j, is, ie, w0_, wl, wtmp);
+          WENOZX3(member, eos, true, m, k,   j, is, ie, w0_, wtmp, wr);
+        }
+        member.team_barrier();
+
+        if constexpr (rsolver_method_ == Hydro_RSolver::advect) {
+          Advect(member, eos, indcs, size, coord, m, k, j, is, ie, IVZ, wl, wr, flx3);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::llf) {
+          LLF(member, eos, indcs, size, coord, m, k, j, is, ie, IVZ, wl, wr, flx3);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle) {
+          HLLE(member, eos, indcs, size, coord, m, k, j, is, ie, IVZ, wl, wr, flx3);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hllc) {
+          HLLC(member, eos, indcs, size, coord, m, k, j, is, ie, IVZ, wl, wr, flx3);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::roe) {
+          Roe(member, eos, indcs, size, coord, m, k, j, is, ie, IVZ, wl, wr, flx3);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::llf_sr) {
+          LLF_SR(member, eos, indcs, size, coord, m, k, j, is, ie, IVZ, wl, wr, flx3);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle_sr) {
+          HLLE_SR(member, eos, indcs, size, coord, m, k, j, is, ie, IVZ, wl, wr, flx3);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hllc_sr) {
+          HLLC_SR(member, eos, indcs, size, coord, m, k, j, is, ie, IVZ, wl, wr, flx3);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::llf_gr) {
+          LLF_GR(member, eos, indcs, size, coord, m, k, j, is, ie, IVZ, wl, wr, flx3);
+        } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle_gr) {
+          HLLE_GR(member, eos, indcs, size, coord, m, k, j, is, ie, IVZ, wl, wr, flx3);
+        }
+        member.team_barrier();
+
+        if (nvars > nhyd_) {
+          for (int n=nhyd_; n<nvars; ++n) {
+            par_for_inner(member, is, ie, [&](const int i) {
+              if (flx3(m,IDN,k,j,i) >= 0.0) {
+                flx3(m,n,k,j,i) = flx3(m,IDN,k,j,i)*wl(n,i);
+              } else {
+                flx3(m,n,k,j,i) = flx3(m,IDN,k,j,i)*wr(n,i);
+              }
+            });
+          }
+          member.team_barrier();
+        }
+
+        // add diffusive fluxes while this row is still in cache
+        if (add_visc_) {
+          IsoViscousFluxX3(member, is_ideal_, size, nu_iso_, m, k, j, is, ie,
+                           w0_, flx3);
+        }
+        if (add_cond_) {
+          IsoHeatFluxX3(member, use_e_, gm1_, size, kappa_, m, k, j, is, ie,
+                        w0_, flx3);
+        }
+      }
+    });
+    return;
+  }
 
   //--------------------------------------------------------------------------------------
   // i-direction
 
-  size_t scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * 2;
+  size_t scr_size = ScrArray2D<FluxReal>::shmem_size(nvars, ncells1) * 2;
   int scr_level = 0;
   auto &flx1_ = uflx.x1f;
 
@@ -73,29 +384,31 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
       jl = js-1, ju = je+1, kl = ks-1, ku = ke+1;
     }
   }
+  // fourth_order needs one extra transverse layer of faces for the flux quadrature
+  if (fourth_order) {
+    if (pmy_pack->pmesh->multi_d) {jl = js-1, ju = je+1;}
+    if (pmy_pack->pmesh->three_d) {kl = ks-1, ku = ke+1;}
+  }
 
   par_for_outer("hflux_x1",DevExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku, jl, ju,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
-    ScrArray2D<Real> wl(member.team_scratch(scr_level), nvars, ncells1);
-    ScrArray2D<Real> wr(member.team_scratch(scr_level), nvars, ncells1);
+    ScrArray2D<FluxReal> wl(member.team_scratch(scr_level), nvars, ncells1);
+    ScrArray2D<FluxReal> wr(member.team_scratch(scr_level), nvars, ncells1);
 
     // Reconstruct qR[i] and qL[i+1]
-    switch (recon_method_) {
-      case ReconstructionMethod::dc:
-        DonorCellX1(member, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      case ReconstructionMethod::plm:
-        PiecewiseLinearX1(member, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      case ReconstructionMethod::ppm4:
-      case ReconstructionMethod::ppmx:
+    if constexpr (recon_method_ == ReconstructionMethod::dc) {
+      DonorCellX1(member, m, k, j, il-1, iu, w0_, wl, wr);
+    } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+      PiecewiseLinearX1(member, m, k, j, il-1, iu, w0_, wl, wr);
+    } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                         recon_method_ == ReconstructionMethod::ppmx) {
+      if (cproj) {
+        PiecewiseParabolicCharX1(member,eos_,extrema,true, m, k, j, il-1, iu, w0_,wl,wr);
+      } else {
         PiecewiseParabolicX1(member,eos_,extrema,true, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      case ReconstructionMethod::wenoz:
-        WENOZX1(member, eos_, true, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      default:
-        break;
+      }
+    } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+      WENOZX1(member, eos_, true, m, k, j, il-1, iu, w0_, wl, wr);
     }
     // Sync all threads in the team so that scratch memory is consistent
     member.team_barrier();
@@ -142,13 +455,63 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
         });
       }
     }
+
+    // add diffusive fluxes while this row is still in cache
+    if ((add_visc_ || add_cond_) && (k >= ks) && (k <= ke) && (j >= js) && (j <= je)) {
+      if (add_visc_) {
+        IsoViscousFluxX1(member, is_ideal_, size, nu_iso_, multi_d_, three_d_,
+                         m, k, j, is, ie+1, w0_, flx1);
+      }
+      if (add_cond_) {
+        IsoHeatFluxX1(member, use_e_, gm1_, size, kappa_, m, k, j, is, ie+1,
+                      w0_, flx1);
+      }
+    }
+
+    // on fused path, accumulate x1-flux divergence into RHS while this row of fluxes
+    // is still in cache; the x1-contribution initializes the sum
+    if (fused_) {
+      member.team_barrier();
+      for (int n=0; n<nvars; ++n) {
+        par_for_inner(member, is, ie, [&](const int i) {
+          udivf_(m,n,k,j,i) = (flx1_(m,n,k,j,i+1) - flx1_(m,n,k,j,i))/
+                              size_.d_view(m).dx1;
+        });
+      }
+    }
+
+    // on the final stage with fused_newdt, reduce min cell-crossing time for this row
+    if (compute_dt_ && (k >= ks) && (k <= ke) && (j >= js) && (j <= je)) {
+      Real row_dtmin;
+      Kokkos::parallel_reduce(Kokkos::TeamVectorRange(member, is, ie+1),
+      [&](const int i, Real &min_dt) {
+        Real cs;
+        if (eos.is_ideal) {
+          cs = eos.IdealHydroSoundSpeed(w0_(m,IDN,k,j,i),
+                                        eos.IdealGasPressure(w0_(m,IEN,k,j,i)));
+        } else {
+          cs = eos.iso_cs;
+        }
+        Real dtc = size.d_view(m).dx1/(fabs(w0_(m,IVX,k,j,i)) + cs);
+        if (multi_d_) {
+          dtc = fmin(dtc, size.d_view(m).dx2/(fabs(w0_(m,IVY,k,j,i)) + cs));
+        }
+        if (three_d_) {
+          dtc = fmin(dtc, size.d_view(m).dx3/(fabs(w0_(m,IVZ,k,j,i)) + cs));
+        }
+        min_dt = fmin(dtc, min_dt);
+      }, Kokkos::Min<Real>(row_dtmin));
+      Kokkos::single(Kokkos::PerTeam(member), [&]() {
+        Kokkos::atomic_min(&dtmin_(0), row_dtmin);
+      });
+    }
   });
 
   //--------------------------------------------------------------------------------------
   // j-direction
 
   if (pmy_pack->pmesh->multi_d) {
-    scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * 3;
+    scr_size = ScrArray2D<FluxReal>::shmem_size(nvars, ncells1) * 3;
     auto &flx2_ = uflx.x2f;
 
     // set the loop limits for 1D/2D/3D problems
@@ -161,12 +524,17 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
         il = is-1, iu = ie+1, kl = ks-1, ku = ke+1;
       }
     }
+    // fourth_order needs one extra transverse layer of faces for the flux quadrature
+    if (fourth_order) {
+      il = is-1, iu = ie+1;
+      if (pmy_pack->pmesh->three_d) {kl = ks-1, ku = ke+1;}
+    }
 
     par_for_outer("hflux_x2",DevExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku,
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k) {
-      ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
-      ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
-      ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
+      ScrArray2D<FluxReal> scr1(member.team_scratch(scr_level), nvars, ncells1);
+      ScrArray2D<FluxReal> scr2(member.team_scratch(scr_level), nvars, ncells1);
+      ScrArray2D<FluxReal> scr3(member.team_scratch(scr_level), nvars, ncells1);
 
       for (int j=jl; j<=ju; ++j) {
         // Permute scratch arrays.
@@ -179,22 +547,19 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
         }
 
         // Reconstruct qR[j] and qL[j+1]
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
-            DonorCellX2(member, m, k, j, il, iu, w0_, wl_jp1, wr);
-            break;
-          case ReconstructionMethod::plm:
-            PiecewiseLinearX2(member, m, k, j, il, iu, w0_, wl_jp1, wr);
-            break;
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX2(member, m, k, j, il, iu, w0_, wl_jp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX2(member, m, k, j, il, iu, w0_, wl_jp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          if (cproj) {
+            PiecewiseParabolicCharX2(member,eos_,extrema,true,m,k,j,il,iu,w0_,wl_jp1,wr);
+          } else {
             PiecewiseParabolicX2(member,eos_,extrema,true,m,k,j,il,iu, w0_, wl_jp1, wr);
-            break;
-          case ReconstructionMethod::wenoz:
-            WENOZX2(member, eos_, true, m, k, j, il, iu, w0_, wl_jp1, wr);
-            break;
-          default:
-            break;
+          }
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX2(member, eos_, true, m, k, j, il, iu, w0_, wl_jp1, wr);
         }
         member.team_barrier();
 
@@ -233,7 +598,7 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
         // calculate fluxes of scalars (if any)
         if (nvars > nhyd_) {
           for (int n=nhyd_; n<nvars; ++n) {
-            par_for_inner(member, is, ie, [&](const int i) {
+            par_for_inner(member, il, iu, [&](const int i) {
               if (flx2_(m,IDN,k,j,i) >= 0.0) {
                 flx2_(m,n,k,j,i) = flx2_(m,IDN,k,j,i)*wl(n,i);
               } else {
@@ -242,6 +607,31 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
             });
           }
         }
+
+        // add diffusive fluxes while this row is still in cache
+        if ((add_visc_ || add_cond_) && (k >= ks) && (k <= ke) &&
+            (j >= js) && (j <= je+1)) {
+          if (add_visc_) {
+            IsoViscousFluxX2(member, is_ideal_, size_, nu_iso_, three_d_,
+                             m, k, j, is, ie, w0_, flx2_);
+          }
+          if (add_cond_) {
+            IsoHeatFluxX2(member, use_e_, gm1_, size_, kappa_, m, k, j, is, ie,
+                          w0_, flx2_);
+          }
+        }
+
+        // on fused path, accumulate x2-flux divergence into RHS for row j-1, whose
+        // interface fluxes are now both complete
+        if (fused_ && j>(jl+1)) {
+          member.team_barrier();
+          for (int n=0; n<nvars; ++n) {
+            par_for_inner(member, is, ie, [&](const int i) {
+              udivf_(m,n,k,j-1,i) += (flx2_(m,n,k,j,i) - flx2_(m,n,k,j-1,i))/
+                                     size_.d_view(m).dx2;
+            });
+          }
+        }
       } // end of loop over j
     });
   }
@@ -250,18 +640,44 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   // k-direction. Note order of k,j loops switched
 
   if (pmy_pack->pmesh->three_d) {
-    scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * 3;
+    scr_size = ScrArray2D<FluxReal>::shmem_size(nvars, ncells1) * 3;
+    // optional staging tile holding a five-plane rolling window of w0, so each plane is
+    // loaded from the global array once per sweep rather than once per stencil touch
+    bool staged_ = staged_x3;
+    int stage_cols = (staged_)? 5*ncells1 : 0;
+    scr_size += ScrArray2D<FluxReal>::shmem_size(nvars, stage_cols);
     auto &flx3_ = uflx.x3f;
 
     // set the loop limits
     il = is, iu = ie, jl = js, ju = je, kl = ks-1, ku = ke+1;
     if (use_fofc) { il = is-1, iu = ie+1, jl = js-1, ju = je+1, kl = ks-2, ku = ke+2; }
+    // fourth_order needs one extra transverse layer of faces for the flux quadrature
+    if (fourth_order) { il = is-1, iu = ie+1, jl = js-1, ju = je+1; }
 
     par_for_outer("hflux_x3",DevExeSpace(), scr_size, scr_level, 0, nmb1, jl, ju,
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int j) {
-      ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
-      ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
-      ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
+      ScrArray2D<FluxReal> scr1(member.team_scratch(scr_level), nvars, ncells1);
+      ScrArray2D<FluxReal> scr2(member.team_scratch(scr_level), nvars, ncells1);
+      ScrArray2D<FluxReal> scr3(member.team_scratch(scr_level), nvars, ncells1);
+      ScrArray2D<FluxReal> w0s(member.team_scratch(scr_level), nvars, stage_cols);
+
+      // stencil radius of the reconstruction method, sizing the staged plane window
+      constexpr int rad =
+          (recon_method_ == ReconstructionMethod::dc)  ? 0 :
+          (recon_method_ == ReconstructionMethod::plm) ? 1 : 2;
+
+      // preload all but the leading plane of the rolling window; plane p lives at
+      // column offset ((p-kl+rad)%5)*ncells1 of the tile
+      if (staged_) {
+        for (int kk=kl-rad; kk<=kl+rad-1; ++kk) {
+          int s = ((kk-kl+rad)%5)*ncells1;
+          for (int n=0; n<nvars; ++n) {
+            par_for_inner(member, il, iu, [&](const int i) {
+              w0s(n,s+i) = w0_(m,n,kk,j,i);
+            });
+          }
+        }
+      }
 
       for (int k=kl; k<=ku; ++k) {
         // Permute scratch arrays.
@@ -273,23 +689,54 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
           wl_kp1 = scr1;
         }
 
+        // load the leading plane of the rolling window, replacing the plane that has
+        // fallen out of the stencil, then compute this iteration's column offsets
+        int sm2=0, sm1=0, sc=0, sp1=0, sp2=0;
+        if (staged_) {
+          int s = ((k-kl+2*rad)%5)*ncells1;
+          for (int n=0; n<nvars; ++n) {
+            par_for_inner(member, il, iu, [&](const int i) {
+              w0s(n,s+i) = w0_(m,n,k+rad,j,i);
+            });
+          }
+          member.team_barrier();
+          sm2 = ((k-kl  )%5)*ncells1;
+          sm1 = ((k-kl+1)%5)*ncells1;
+          sc  = ((k-kl+2)%5)*ncells1;
+          sp1 = ((k-kl+3)%5)*ncells1;
+          sp2 = ((k-kl+4)%5)*ncells1;
+        }
+
         // Reconstruct qR[k] and qL[k+1]
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          if (staged_) {
+            DonorCellX3Staged(member, il, iu, w0s, sm2, wl_kp1, wr);
+          } else {
             DonorCellX3(member, m, k, j, il, iu, w0_, wl_kp1, wr);
-            break;
-          case ReconstructionMethod::plm:
+          }
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          if (staged_) {
+            PiecewiseLinearX3Staged(member, il, iu, w0s, sm2, sm1, sc, wl_kp1, wr);
+          } else {
             PiecewiseLinearX3(member, m, k, j, il, iu, w0_, wl_kp1, wr);
-            break;
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
+          }
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          if (staged_) {
+            PiecewiseParabolicX3Staged(member, eos_, extrema, true, il, iu, w0s,
+                                       sm2, sm1, sc, sp1, sp2, wl_kp1, wr);
+          } else if (cproj) {
+            PiecewiseParabolicCharX3(member,eos_,extrema,true,m,k,j,il,iu,w0_,wl_kp1,wr);
+          } else {
             PiecewiseParabolicX3(member,eos_,extrema,true,m,k,j,il,iu, w0_, wl_kp1, wr);
-            break;
-          case ReconstructionMethod::wenoz:
+          }
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          if (staged_) {
+            WENOZX3Staged(member, eos_, true, il, iu, w0s, sm2, sm1, sc, sp1, sp2,
+                          wl_kp1, wr);
+          } else {
             WENOZX3(member, eos_, true, m, k, j, il, iu, w0_, wl_kp1, wr);
-            break;
-          default:
-            break;
+          }
         }
         member.team_barrier();
 
@@ -328,7 +775,7 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
         // calculate fluxes of scalars (if any)
         if (nvars > nhyd_) {
           for (int n=nhyd_; n<nvars; ++n) {
-            par_for_inner(member, is, ie, [&](const int i) {
+            par_for_inner(member, il, iu, [&](const int i) {
               if (flx3_(m,IDN,k,j,i) >= 0.0) {
                 flx3_(m,n,k,j,i) = flx3_(m,IDN,k,j,i)*wl(n,i);
               } else {
@@ -337,10 +784,68 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
             });
           }
         }
+
+        // add diffusive fluxes while this row is still in cache
+        if ((add_visc_ || add_cond_) && (k >= ks) && (k <= ke+1) &&
+            (j >= js) && (j <= je)) {
+          if (add_visc_) {
+            IsoViscousFluxX3(member, is_ideal_, size_, nu_iso_, m, k, j, is, ie,
+                             w0_, flx3_);
+          }
+          if (add_cond_) {
+            IsoHeatFluxX3(member, use_e_, gm1_, size_, kappa_, m, k, j, is, ie,
+                          w0_, flx3_);
+          }
+        }
+
+        // on fused path, accumulate x3-flux divergence into RHS for row k-1, whose
+        // interface fluxes are now both complete
+        if (fused_ && k>(kl+1)) {
+          member.team_barrier();
+          for (int n=0; n<nvars; ++n) {
+            par_for_inner(member, is, ie, [&](const int i) {
+              udivf_(m,n,k-1,j,i) += (flx3_(m,n,k,j,i) - flx3_(m,n,k-1,j,i))/
+                                     size_.d_view(m).dx3;
+            });
+          }
+        }
       } // end loop over k
     });
   }
 
+  // convolve face-centered point fluxes to face averages with transverse Laplacian
+  // quadrature corrections (no transverse extent in 1D, where faces are points)
+  if (fourth_order && pmy_pack->pmesh->multi_d) {FluxQuadratureCorrection();}
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Hydro::CalculateFluxes
+//! \brief Selects reconstruction method at compile time, so that the flux kernels above
+//! are fully specialized over both the Riemann solver and the reconstruction method
+
+template <Hydro_RSolver rsolver_method_>
+void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
+  switch (recon_method) {
+    case ReconstructionMethod::dc:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::dc>(pdriver, stage);
+      break;
+    case ReconstructionMethod::plm:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::plm>(pdriver, stage);
+      break;
+    case ReconstructionMethod::ppm4:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::ppm4>(pdriver, stage);
+      break;
+    case ReconstructionMethod::ppmx:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::ppmx>(pdriver, stage);
+      break;
+    case ReconstructionMethod::wenoz:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::wenoz>(pdriver, stage);
+      break;
+    default:
+      break;
+  }
   return;
 }
 
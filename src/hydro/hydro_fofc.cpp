@@ -97,9 +97,15 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
   if (multi_d) { jl = js-1, ju = je+1; }
   if (three_d) { kl = ks-1, ku = ke+1; }
 
-  // Now replace fluxes with first-order LLF fluxes for any cell where floors needed (if
-  // using FOFC) and/or for any cell about the excision (if GR+excising)
-  par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
+  // Build compacted list of indices of all flagged cells, so that the (typically rare)
+  // flux replacements below are launched over flagged cells only, not the entire grid
+  int ni = iu - il + 1;
+  int nji = (ju - jl + 1)*ni;
+  int nkji = (ku - kl + 1)*nji;
+  auto &flist_ = fofc_list;
+  auto &fcnt_ = fofc_count;
+  Kokkos::deep_copy(fcnt_, 0);
+  par_for("FOFC-list", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Check for FOFC flag
     bool fofc_flag = false;
@@ -111,8 +117,33 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
       if (use_excise) { fofc_excision = excision_flux_(m,k,j,i); }
     }
 
-    // Apply FOFC
     if (fofc_flag || fofc_excision) {
+      int indx = Kokkos::atomic_fetch_add(&fcnt_(0), 1);
+      flist_(indx) = m*nkji + (k-kl)*nji + (j-jl)*ni + (i-il);
+    }
+  });
+
+  // copy number of flagged cells to host (persistent pinned buffer, so nothing is
+  // allocated here); skip the correction pass if none are flagged
+  Kokkos::deep_copy(fofc_count_host, fofc_count);
+  int nflagged = fofc_count_host(0);
+  if (nflagged == 0) { return; }
+
+  // Now replace fluxes with first-order LLF fluxes for any cell where floors needed (if
+  // using FOFC) and/or for any cell about the excision (if GR+excising)
+  par_for("FOFC-flx", DevExeSpace(), 0, nflagged-1,
+  KOKKOS_LAMBDA(const int n) {
+    // Decode flagged cell indices from compacted list
+    int indx = flist_(n);
+    int m = indx/nkji;
+    int k = (indx - m*nkji)/nji;
+    int j = (indx - m*nkji - k*nji)/ni;
+    int i = (indx - m*nkji - k*nji - j*ni) + il;
+    k += kl;
+    j += jl;
+
+    // Apply FOFC
+    {
       // replace x1-flux at i
       // load left state
       HydPrim1D wim1;
@@ -361,7 +392,7 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
       }
 
       // reset FOFC flag (do not reset excision flag)
-      if (use_fofc_ && fofc_flag) { fofc_(m,k,j,i) = false; }
+      if (use_fofc_) { fofc_(m,k,j,i) = false; }
     }
   });
 
@@ -67,6 +67,21 @@ TaskStatus Hydro::NewTimeStep(Driver *pdrive, int stage) {
       min_dt2 = fmin((mbsize.d_view(m).dx2/fabs(w0_(m,IVY,k,j,i))), min_dt2);
       min_dt3 = fmin((mbsize.d_view(m).dx3/fabs(w0_(m,IVZ,k,j,i))), min_dt3);
     }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3));
+  } else if (is_general_relativistic_ || is_dynamical_relativistic_) {
+    // in GR the maximum signal speed is the speed of light, so the minimum dt depends
+    // only on the grid spacing of each MeshBlock; reduce over blocks on the host
+    // instead of sweeping the whole grid
+    for (int m=0; m<(pmy_pack->nmb_thispack); ++m) {
+      dt1 = std::min(dt1, mbsize.h_view(m).dx1);
+      dt2 = std::min(dt2, mbsize.h_view(m).dx2);
+      dt3 = std::min(dt3, mbsize.h_view(m).dx3);
+    }
+  } else if (fused_newdt && dtmin_computed) {
+    // minimum cell-crossing time was already reduced by the flux kernels on the final
+    // stage (from beginning-of-stage primitives); just copy the result to the host
+    auto dtmin_host = Kokkos::create_mirror(dtmin_flx);
+    Kokkos::deep_copy(dtmin_host, dtmin_flx);
+    dt1 = dtmin_host(0);
   } else {
     // find smallest dx/(v +/- Cs) in each direction for hydrodynamic problems
     Kokkos::parallel_reduce("HydroNudt2",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
@@ -81,11 +96,7 @@ TaskStatus Hydro::NewTimeStep(Driver *pdrive, int stage) {
 
       Real max_dv1 = 0.0, max_dv2 = 0.0, max_dv3 = 0.0;
 
-      if (is_general_relativistic_ || is_dynamical_relativistic_) {
-        max_dv1 = 1.0;
-        max_dv2 = 1.0;
-        max_dv3 = 1.0;
-      } else if (is_special_relativistic_) {
+      if (is_special_relativistic_) {
         Real v2 = SQR(w0_(m,IVX,k,j,i)) + SQR(w0_(m,IVY,k,j,i)) + SQR(w0_(m,IVZ,k,j,i));
         Real lor = sqrt(1.0 + v2);
         // FIXME ERM: Ideal fluid for now
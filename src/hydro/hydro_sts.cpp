@@ -0,0 +1,98 @@
+//========================================================================================
+// AthenaK astrophysical fluid dynamics and numerical relativity code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file hydro_sts.cpp
+//! \brief Performs one stage of the RKL2 super-time-stepped update of the diffusive
+//! (viscosity and thermal conduction) terms in Hydro.  The stage loop, coefficients,
+//! and inter-stage boundary exchanges are driven by Driver::SuperTimeStep().
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "eos/eos.hpp"
+#include "diffusion/viscosity.hpp"
+#include "diffusion/conduction.hpp"
+#include "hydro.hpp"
+
+namespace hydro {
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::STSUpdate
+//  \brief Computes diffusive fluxes from current primitives and applies one stage of the
+//  RKL2 recurrence to u0.  Stage 1 additionally saves the starting state (Y_0) and its
+//  RHS, which every later stage reuses; u1 serves as the Y_{j-2} register (it only holds
+//  live data during the stages of the main integrator).
+
+void Hydro::STSUpdate(const int jstage, const Real dt, const Real mu, const Real nu,
+                      const Real mu_tilde, const Real gamma_tilde) {
+  // zero flux registers; only the diffusive fluxes below contribute in STS stages
+  Kokkos::deep_copy(DevExeSpace(), uflx.x1f, 0.0);
+  Kokkos::deep_copy(DevExeSpace(), uflx.x2f, 0.0);
+  Kokkos::deep_copy(DevExeSpace(), uflx.x3f, 0.0);
+  if (pvisc != nullptr) {
+    pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
+  }
+  if (pcond != nullptr) {
+    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  }
+
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nv1 = nhydro - 1;   // passive scalars are not diffused
+  auto u0_ = u0;
+  auto u1_ = u1;
+  auto y0_ = u_sts0;
+  auto rhs0_ = rhs_sts0;
+  auto flx1 = uflx.x1f;
+  auto flx2 = uflx.x2f;
+  auto flx3 = uflx.x3f;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  Real mdt = mu_tilde*dt;
+  Real gdt = gamma_tilde*dt;
+
+  if (jstage == 1) {
+    // Y_1 = Y_0 + mu_tilde_1*dt*L(Y_0); save Y_0 and L(Y_0) for later stages
+    par_for("h_sts_update1",DevExeSpace(),0,nmb1,0,nv1,ks,ke,js,je,is,ie,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      Real divf = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+      if (multi_d) {
+        divf += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+      }
+      if (three_d) {
+        divf += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+      }
+      Real y0 = u0_(m,n,k,j,i);
+      y0_(m,n,k,j,i) = y0;
+      rhs0_(m,n,k,j,i) = -divf;
+      u1_(m,n,k,j,i) = y0;
+      u0_(m,n,k,j,i) = y0 - mdt*divf;
+    });
+  } else {
+    // Y_j = mu_j*Y_{j-1} + nu_j*Y_{j-2} + (1 - mu_j - nu_j)*Y_0
+    //     + mu_tilde_j*dt*L(Y_{j-1}) + gamma_tilde_j*dt*L(Y_0)
+    par_for("h_sts_update",DevExeSpace(),0,nmb1,0,nv1,ks,ke,js,je,is,ie,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      Real divf = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+      if (multi_d) {
+        divf += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+      }
+      if (three_d) {
+        divf += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+      }
+      Real yjm1 = u0_(m,n,k,j,i);
+      u0_(m,n,k,j,i) = mu*yjm1 + nu*u1_(m,n,k,j,i)
+                     + (1.0 - mu - nu)*y0_(m,n,k,j,i)
+                     - mdt*divf + gdt*rhs0_(m,n,k,j,i);
+      u1_(m,n,k,j,i) = yjm1;
+    });
+  }
+  return;
+}
+
+} // namespace hydro
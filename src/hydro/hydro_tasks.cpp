@@ -48,32 +48,73 @@ void Hydro::AssembleHydroTasks(std::map<std::string, std::shared_ptr<TaskList>>
   TaskID none(0);
 
   // assemble "before_stagen" task list
-  id.irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, this, none);
+  id.irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, this, none,
+      "Hydro::InitRecv");
 
   // assemble "stagen" task list
-  id.copyu     = tl["stagen"]->AddTask(&Hydro::CopyCons, this, none);
-  id.flux      = tl["stagen"]->AddTask(&Hydro::Fluxes,this,id.copyu);
-  id.sendf     = tl["stagen"]->AddTask(&Hydro::SendFlux, this, id.flux);
-  id.recvf     = tl["stagen"]->AddTask(&Hydro::RecvFlux, this, id.sendf);
-  id.rkupdt    = tl["stagen"]->AddTask(&Hydro::RKUpdate, this, id.recvf);
-  id.srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, this, id.rkupdt);
-  id.sendu_oa  = tl["stagen"]->AddTask(&Hydro::SendU_OA, this, id.srctrms);
-  id.recvu_oa  = tl["stagen"]->AddTask(&Hydro::RecvU_OA, this, id.sendu_oa);
-  id.restu     = tl["stagen"]->AddTask(&Hydro::RestrictU, this, id.recvu_oa);
-  id.sendu     = tl["stagen"]->AddTask(&Hydro::SendU, this, id.restu);
-  id.recvu     = tl["stagen"]->AddTask(&Hydro::RecvU, this, id.sendu);
-  id.sendu_shr = tl["stagen"]->AddTask(&Hydro::SendU_Shr, this, id.recvu);
-  id.recvu_shr = tl["stagen"]->AddTask(&Hydro::RecvU_Shr, this, id.sendu_shr);
-  id.bcs       = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu_shr);
-  id.prol      = tl["stagen"]->AddTask(&Hydro::Prolongate, this, id.bcs);
-  id.c2p       = tl["stagen"]->AddTask(&Hydro::ConToPrim, this, id.prol);
-  id.newdt     = tl["stagen"]->AddTask(&Hydro::NewTimeStep, this, id.c2p);
+  id.copyu     = tl["stagen"]->AddTask(&Hydro::CopyCons, this, none, "Hydro::CopyCons");
+  id.flux      = tl["stagen"]->AddTask(&Hydro::Fluxes,this,id.copyu, "Hydro::Fluxes");
+  id.sendf     = tl["stagen"]->AddTask(&Hydro::SendFlux, this, id.flux,
+      "Hydro::SendFlux");
+  id.recvf     = tl["stagen"]->AddTask(&Hydro::RecvFlux, this, id.sendf,
+      "Hydro::RecvFlux");
+  // interior update does not depend on corrected fluxes, so it only waits on Fluxes and
+  // overlaps with flux-correction communication; the one-cell strip adjacent to the
+  // MeshBlock faces is updated separately once RecvFlux completes
+  id.rkupdt    = tl["stagen"]->AddTask(&Hydro::RKUpdateInterior, this, id.flux,
+      "Hydro::RKUpdateInterior");
+  TaskID dep_rkb = id.recvf | id.rkupdt;
+  id.rkupdtb   = tl["stagen"]->AddTask(&Hydro::RKUpdateBndry, this, dep_rkb,
+      "Hydro::RKUpdateBndry");
+  id.srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, this, id.rkupdtb,
+      "Hydro::HydroSrcTerms");
+  id.sendu_oa  = tl["stagen"]->AddTask(&Hydro::SendU_OA, this, id.srctrms,
+      "Hydro::SendU_OA");
+  id.recvu_oa  = tl["stagen"]->AddTask(&Hydro::RecvU_OA, this, id.sendu_oa,
+      "Hydro::RecvU_OA");
+  id.restu     = tl["stagen"]->AddTask(&Hydro::RestrictU, this, id.recvu_oa,
+      "Hydro::RestrictU");
+  id.sendu     = tl["stagen"]->AddTask(&Hydro::SendU, this, id.restu, "Hydro::SendU");
+  id.recvu     = tl["stagen"]->AddTask(&Hydro::RecvU, this, id.sendu, "Hydro::RecvU");
+  id.sendu_shr = tl["stagen"]->AddTask(&Hydro::SendU_Shr, this, id.recvu,
+      "Hydro::SendU_Shr");
+  id.recvu_shr = tl["stagen"]->AddTask(&Hydro::RecvU_Shr, this, id.sendu_shr,
+      "Hydro::RecvU_Shr");
+  id.bcs       = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu_shr,
+      "Hydro::ApplyPhysicalBCs");
+  id.prol      = tl["stagen"]->AddTask(&Hydro::Prolongate, this, id.bcs,
+      "Hydro::Prolongate");
+  // with overlap_c2p the active cells need only the local update, so their conversion
+  // runs as soon as RestrictU completes and overlaps with the RecvU wait; the ghost-zone
+  // slabs are converted by ConToPrim once prolongation has filled them
+  if (overlap_c2p) {
+    id.c2p_int = tl["stagen"]->AddTask(&Hydro::ConToPrimInterior, this, id.restu,
+        "Hydro::ConToPrimInterior");
+  }
+  id.c2p       = tl["stagen"]->AddTask(&Hydro::ConToPrim, this, id.prol,
+      "Hydro::ConToPrim");
+  TaskID dep_newdt = id.c2p;
+  if (overlap_c2p) {dep_newdt = dep_newdt | id.c2p_int;}
+  id.newdt     = tl["stagen"]->AddTask(&Hydro::NewTimeStep, this, dep_newdt,
+      "Hydro::NewTimeStep");
+
+  // hoist send-side tasks ahead of local-only work and drain receives last, so MPI
+  // messages are on the wire before long compute kernels run and polling for messages
+  // that have not arrived does not block tasks that are ready
+  tl["stagen"]->SetPriority(id.sendf, 1);
+  tl["stagen"]->SetPriority(id.sendu, 1);
+  tl["stagen"]->SetPriority(id.sendu_shr, 1);
+  tl["stagen"]->SetPriority(id.recvf, -1);
+  tl["stagen"]->SetPriority(id.recvu, -1);
+  tl["stagen"]->SetPriority(id.recvu_shr, -1);
 
   // assemble "after_stagen" task list
-  id.csend = tl["after_stagen"]->AddTask(&Hydro::ClearSend, this, none);
+  id.csend = tl["after_stagen"]->AddTask(&Hydro::ClearSend, this, none,
+      "Hydro::ClearSend");
   // although RecvFlux/U functions check that all recvs complete, add ClearRecv to
   // task list anyways to catch potential bugs in MPI communication logic
-  id.crecv = tl["after_stagen"]->AddTask(&Hydro::ClearRecv, this, id.csend);
+  id.crecv = tl["after_stagen"]->AddTask(&Hydro::ClearRecv, this, id.csend,
+      "Hydro::ClearRecv");
 
   return;
 }
@@ -84,9 +125,13 @@ void Hydro::AssembleHydroTasks(std::map<std::string, std::shared_ptr<TaskList>>
 //! initialize all boundary receive status flags to waiting (with or without MPI).
 
 TaskStatus Hydro::InitRecv(Driver *pdrive, int stage) {
-  // post receives for U
-  TaskStatus tstat = pbval_u->InitRecv(nhydro+nscalars);
-  if (tstat != TaskStatus::complete) return tstat;
+  // post receives for U (skipped on stages where ghost-cell expansion defers the
+  // exchange; see GhostExchangeThisStage below)
+  TaskStatus tstat = TaskStatus::complete;
+  if (GhostExchangeThisStage(pdrive, stage)) {
+    tstat = pbval_u->InitRecv(nhydro+nscalars);
+    if (tstat != TaskStatus::complete) return tstat;
+  }
 
   // with SMR/AMR post receives for fluxes of U
   // do not post receives for fluxes when stage < 0 (i.e. ICs)
@@ -121,9 +166,62 @@ TaskStatus Hydro::InitRecv(Driver *pdrive, int stage) {
 //----------------------------------------------------------------------------------------
 //! \fn  void Hydro::CopyCons
 //! \brief Simple task list function that copies u0 --> u1 in first stage.  Extended to
-//!  handle RK register logic at given stage
+//!  handle RK register logic at given stage.
+//!  With <time>/flux_accumulation u1 aliases u0 and there is nothing to copy; instead,
+//!  at the second stage this task re-applies the first stage's flux divergence (still
+//!  in uflx/udivf, which the Fluxes task has not yet overwritten) with weight
+//!  gam1*beta0*dt.  Since U^1 = U^0 - beta0*dt*divF0, this turns u0 into the weighted
+//!  combination gam0*U^1 + gam1*U^0 that the update kernels would otherwise assemble
+//!  from the two registers, and their gam0*u0 + gam1*u1 then reduces to u0 exactly
+//!  (gam0 + gam1 = 1 for rk1/rk2).  Divergence terms are accumulated per direction in
+//!  the same order as RKUpdateRange() so round-off matches the two-register update.
 
 TaskStatus Hydro::CopyCons(Driver *pdrive, int stage) {
+  if (flux_accum) {
+    if (stage == 2) {
+      auto &indcs = pmy_pack->pmesh->mb_indcs;
+      int is = indcs.is, ie = indcs.ie;
+      int js = indcs.js, je = indcs.je;
+      int ks = indcs.ks, ke = indcs.ke;
+      // FOFC tests a one-cell ring outside the active cells, where first-stage fluxes
+      // were also computed, so rebuild the combination there as well
+      if (use_fofc) {
+        is -= 1; ie += 1;
+        if (pmy_pack->pmesh->multi_d) {js -= 1; je += 1;}
+        if (pmy_pack->pmesh->three_d) {ks -= 1; ke += 1;}
+      }
+      bool &multi_d = pmy_pack->pmesh->multi_d;
+      bool &three_d = pmy_pack->pmesh->three_d;
+      Real g1b0_dt = (pdrive->gam1[1])*(pdrive->beta[0])*(pmy_pack->pmesh->dt);
+      int nmb1 = pmy_pack->nmb_thispack - 1;
+      int nvar = nhydro + nscalars;
+      auto u0_ = u0;
+      auto &mbsize = pmy_pack->pmb->mb_size;
+      if (fused_fluxes) {
+        auto divf_ = udivf;
+        par_for("h_flx_accum",DevExeSpace(),0,nmb1,0,nvar-1,ks,ke,js,je,is,ie,
+        KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+          u0_(m,n,k,j,i) += g1b0_dt*divf_(m,n,k,j,i);
+        });
+      } else {
+        auto flx1 = uflx.x1f;
+        auto flx2 = uflx.x2f;
+        auto flx3 = uflx.x3f;
+        par_for("h_flx_accum",DevExeSpace(),0,nmb1,0,nvar-1,ks,ke,js,je,is,ie,
+        KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+          Real divf = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+          if (multi_d) {
+            divf += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+          }
+          if (three_d) {
+            divf += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+          }
+          u0_(m,n,k,j,i) += g1b0_dt*divf;
+        });
+      }
+    }
+    return TaskStatus::complete;
+  }
   if (stage == 1) {
     Kokkos::deep_copy(DevExeSpace(), u1, u0);
   } else {
@@ -176,12 +274,11 @@ TaskStatus Hydro::Fluxes(Driver *pdrive, int stage) {
     CalculateFluxes<Hydro_RSolver::hlle_gr>(pdrive, stage);
   }
 
-  // Add viscous, heat-flux, etc fluxes
-  if (pvisc != nullptr) {
-    pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
-  }
-  if (pcond != nullptr) {
-    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  // Viscous and isotropic conductive fluxes are fused into the flux kernels above; only
+  // the temperature-dependent conductivity requires its own full-grid pass.  With
+  // super-time-stepping these operators are applied by Driver::SuperTimeStep() instead
+  if ((pcond != nullptr) && !(pdrive->sts) && pcond->tdep_kappa) {
+    pcond->TempDependentHeatFlux(w0, peos->eos_data, uflx);
   }
 
   // call FOFC if necessary
@@ -299,6 +396,7 @@ TaskStatus Hydro::RestrictU(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to pack/send cell-centered conserved variables
 
 TaskStatus Hydro::SendU(Driver *pdrive, int stage) {
+  if (!(GhostExchangeThisStage(pdrive, stage))) {return TaskStatus::complete;}
   TaskStatus tstat = pbval_u->PackAndSendCC(u0, coarse_u0);
   return tstat;
 }
@@ -308,6 +406,7 @@ TaskStatus Hydro::SendU(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to receive/unpack cell-centered conserved variables
 
 TaskStatus Hydro::RecvU(Driver *pdrive, int stage) {
+  if (!(GhostExchangeThisStage(pdrive, stage))) {return TaskStatus::complete;}
   TaskStatus tstat = pbval_u->RecvAndUnpackCC(u0, coarse_u0);
   return tstat;
 }
@@ -376,6 +475,20 @@ TaskStatus Hydro::Prolongate(Driver *pdrive, int stage) {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn TaskList Hydro::ConToPrimInterior
+//! \brief Wrapper task list function to call ConsToPrim over the active cells only, run
+//! with overlap_c2p while RecvU is still waiting on neighbor messages
+
+TaskStatus Hydro::ConToPrimInterior(Driver *pdrive, int stage) {
+  // active cells were already converted in registers by RKUpdateC2P()
+  if (fused_update_c2p && fused_c2p_done) {return TaskStatus::complete;}
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  peos->ConsToPrim(u0, w0, false, indcs.is, indcs.ie, indcs.js, indcs.je,
+                   indcs.ks, indcs.ke);
+  return TaskStatus::complete;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskList Hydro::ConToPrim
 //! \brief Wrapper task list function to call ConsToPrim over entire mesh (including gz)
@@ -386,6 +499,25 @@ TaskStatus Hydro::ConToPrim(Driver *pdrive, int stage) {
   int n1m1 = indcs.nx1 + 2*ng - 1;
   int n2m1 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng - 1) : 0;
   int n3m1 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng - 1) : 0;
+  // active cells were already converted (in registers by RKUpdateC2P(), or by the
+  // overlapped ConToPrimInterior task), so only sweep the ghost zones.  The (up to)
+  // six slabs below partition the ghost region exactly
+  if ((fused_update_c2p && fused_c2p_done) || overlap_c2p) {
+    int is = indcs.is, ie = indcs.ie;
+    int js = indcs.js, je = indcs.je;
+    int ks = indcs.ks, ke = indcs.ke;
+    peos->ConsToPrim(u0, w0, false, 0, is-1, js, je, ks, ke);
+    peos->ConsToPrim(u0, w0, false, ie+1, n1m1, js, je, ks, ke);
+    if (pmy_pack->pmesh->multi_d) {
+      peos->ConsToPrim(u0, w0, false, 0, n1m1, 0, js-1, ks, ke);
+      peos->ConsToPrim(u0, w0, false, 0, n1m1, je+1, n2m1, ks, ke);
+    }
+    if (pmy_pack->pmesh->three_d) {
+      peos->ConsToPrim(u0, w0, false, 0, n1m1, 0, n2m1, 0, ks-1);
+      peos->ConsToPrim(u0, w0, false, 0, n1m1, 0, n2m1, ke+1, n3m1);
+    }
+    return TaskStatus::complete;
+  }
   peos->ConsToPrim(u0, w0, false, 0, n1m1, 0, n2m1, 0, n3m1);
   return TaskStatus::complete;
 }
@@ -400,9 +532,10 @@ TaskStatus Hydro::ConToPrim(Driver *pdrive, int stage) {
 //! If stage=(-4):              clears sends of                 U_Shr
 
 TaskStatus Hydro::ClearSend(Driver *pdrive, int stage) {
-  TaskStatus tstat;
-  // check sends of U complete
-  if ((stage >= 0) || (stage == -1)) {
+  TaskStatus tstat = TaskStatus::complete;
+  // check sends of U complete (no sends were posted on stages where ghost-cell
+  // expansion deferred the exchange)
+  if (((stage >= 0) || (stage == -1)) && GhostExchangeThisStage(pdrive, stage)) {
     tstat = pbval_u->ClearSend();
     if (tstat != TaskStatus::complete) return tstat;
   }
@@ -443,9 +576,10 @@ TaskStatus Hydro::ClearSend(Driver *pdrive, int stage) {
 //! If stage=(-4):              clears recvs of                 U_Shr
 
 TaskStatus Hydro::ClearRecv(Driver *pdrive, int stage) {
-  TaskStatus tstat;
-  // check receives of U complete
-  if ((stage >= 0) || (stage == -1)) {
+  TaskStatus tstat = TaskStatus::complete;
+  // check receives of U complete (no receives were posted on stages where ghost-cell
+  // expansion deferred the exchange)
+  if (((stage >= 0) || (stage == -1)) && GhostExchangeThisStage(pdrive, stage)) {
     tstat = pbval_u->ClearRecv();
     if (tstat != TaskStatus::complete) return tstat;
   }
@@ -476,4 +610,31 @@ TaskStatus Hydro::ClearRecv(Driver *pdrive, int stage) {
   return tstat;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn bool Hydro::GhostExchangeThisStage
+//! \brief Returns true if the ghost zones of U are exchanged at the given stage.  With
+//! <hydro>/ghost_exchange_interval > 1 the exchange runs only every gce_interval stages
+//! and on the final stage of each step (so every step ends with valid full-depth
+//! ghosts); negative stages (initialization paths in the Driver) always exchange.
+
+bool Hydro::GhostExchangeThisStage(Driver *pdrive, int stage) const {
+  if ((gce_interval <= 1) || (stage < 0)) {return true;}
+  return ((stage%gce_interval) == 0) || (stage == pdrive->nexp_stages);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int Hydro::GhostExpand
+//! \brief Width of the ghost strip evolved redundantly at the given stage: zero when
+//! ghost-cell expansion is disabled or when this stage ends with an exchange, and one
+//! reconstruction stencil per remaining stage up to and including the next exchange
+//! otherwise, so each of those stages finds enough freshly-evolved ghost depth to feed
+//! its own stencil.  The constructor checks that nghost covers the worst case.
+
+int Hydro::GhostExpand(Driver *pdrive, int stage) const {
+  if (GhostExchangeThisStage(pdrive, stage)) {return 0;}
+  int next = stage + 1;
+  while (!(GhostExchangeThisStage(pdrive, next))) {next++;}
+  return gce_stencil*(next - stage);
+}
+
 } // namespace hydro
@@ -13,19 +13,66 @@
 #include "mesh/mesh.hpp"
 #include "driver/driver.hpp"
 #include "eos/eos.hpp"
+#include "eos/ideal_c2p_hyd.hpp"
 #include "hydro.hpp"
 
 namespace hydro {
 //----------------------------------------------------------------------------------------
 //! \fn  void Hydro::Update
-//  \brief Explicit RK update including flux divergence terms
+//  \brief Explicit RK update including flux divergence terms over all active cells.
+//  Wrapper over RKUpdateRange(); used directly by task lists (e.g. ion-neutral,
+//  radiation) that do not split the update around flux-correction receives.
 
 TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  return RKUpdateRange(pdriver, stage, indcs.is, indcs.ie, indcs.js, indcs.je,
+                       indcs.ks, indcs.ke);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::RKUpdateInterior
+//  \brief Explicit RK update of interior cells, i.e. those whose flux divergence cannot
+//  be changed by flux corrections from finer neighbors (which only overwrite fluxes on
+//  the outermost faces of a MeshBlock).  Runs without waiting on RecvFlux, so this
+//  update overlaps with flux-correction communication; the remaining one-cell-wide
+//  strip is updated by RKUpdateBndry() once the corrected fluxes have arrived.
+
+TaskStatus Hydro::RKUpdateInterior(Driver *pdriver, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  // on single-level meshes there are no flux corrections, so update everything here
+  if (!(pmy_pack->pmesh->multilevel)) {
+    if (fused_update_c2p) {return RKUpdateC2P(pdriver, stage);}
+    // with ghost-cell expansion, also update the ghost strip evolved redundantly on
+    // stages that skip the exchange (see CalculateFluxes, which widened the fluxes)
+    int gw = GhostExpand(pdriver, stage);
+    int il = indcs.is - gw, iu = indcs.ie + gw;
+    int jl = indcs.js, ju = indcs.je;
+    int kl = indcs.ks, ku = indcs.ke;
+    if (pmy_pack->pmesh->multi_d) {jl -= gw; ju += gw;}
+    if (pmy_pack->pmesh->three_d) {kl -= gw; ku += gw;}
+    return RKUpdateRange(pdriver, stage, il, iu, jl, ju, kl, ku);
+  }
+  int il = indcs.is + 1, iu = indcs.ie - 1;
+  int jl = indcs.js, ju = indcs.je;
+  int kl = indcs.ks, ku = indcs.ke;
+  if (pmy_pack->pmesh->multi_d) {jl += 1; ju -= 1;}
+  if (pmy_pack->pmesh->three_d) {kl += 1; ku -= 1;}
+  return RKUpdateRange(pdriver, stage, il, iu, jl, ju, kl, ku);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::RKUpdateBndry
+//  \brief Explicit RK update of the one-cell-wide strip adjacent to MeshBlock faces,
+//  skipped by RKUpdateInterior().  Gated on RecvFlux in the task list, so it sees
+//  corrected fluxes on faces shared with finer neighbors.  No-op on single-level
+//  meshes, where RKUpdateInterior() already updated every cell.
+
+TaskStatus Hydro::RKUpdateBndry(Driver *pdriver, int stage) {
+  if (!(pmy_pack->pmesh->multilevel)) {return TaskStatus::complete;}
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int is = indcs.is, ie = indcs.ie;
   int js = indcs.js, je = indcs.je;
   int ks = indcs.ks, ke = indcs.ke;
-  int ncells1 = indcs.nx1 + 2*(indcs.ng);
   bool &multi_d = pmy_pack->pmesh->multi_d;
   bool &three_d = pmy_pack->pmesh->three_d;
 
@@ -41,6 +88,82 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
   auto flx3 = uflx.x3f;
   auto &mbsize = pmy_pack->pmb->mb_size;
 
+  // loop over all (k,j) rows; rows on x2/x3 faces update every i, while rows interior
+  // in x2/x3 update only the two cells on the x1 faces.  This partitions the strip
+  // exactly, so no cell is updated twice.  Divergence terms are accumulated in the same
+  // per-direction order as RKUpdateRange() so round-off is identical to unsplit update
+  par_for_outer("h_update_bndry",DevExeSpace(),0,0,0,nmb1,0,nvar-1,ks,ke,js,je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int n, const int k, const int j) {
+    bool row_on_face = (multi_d && ((j == js) || (j == je))) ||
+                       (three_d && ((k == ks) || (k == ke)));
+    par_for_inner(member, is, ie, [&](const int i) {
+      if (row_on_face || (i == is) || (i == ie)) {
+        Real divf = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+        if (multi_d) {
+          divf += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+        }
+        if (three_d) {
+          divf += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+        }
+        u0_(m,n,k,j,i) = gam0*u0_(m,n,k,j,i) + gam1*u1_(m,n,k,j,i) - beta_dt*divf;
+      }
+    });
+  });
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::RKUpdateRange
+//  \brief Explicit RK update of cells in [is:ie,js:je,ks:ke] on every MeshBlock.
+//  Dispatches at runtime on the mesh dimensionality to the templated version below,
+//  following the same pattern used to select Riemann solvers in CalculateFluxes()
+
+TaskStatus Hydro::RKUpdateRange(Driver *pdriver, int stage,
+                                int is, int ie, int js, int je, int ks, int ke) {
+  if (pmy_pack->pmesh->three_d) {
+    return RKUpdateRange<3>(pdriver, stage, is, ie, js, je, ks, ke);
+  } else if (pmy_pack->pmesh->multi_d) {
+    return RKUpdateRange<2>(pdriver, stage, is, ie, js, je, ks, ke);
+  }
+  return RKUpdateRange<1>(pdriver, stage, is, ie, js, je, ks, ke);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::RKUpdateRange (templated over dimensionality)
+//  \brief Explicit RK update of cells in [is:ie,js:je,ks:ke] on every MeshBlock.  The
+//  x2/x3 divergence terms are guarded by if constexpr on NDIM, so the 1D and 2D
+//  instantiations carry no index arithmetic or branches for the absent dimensions
+
+template <int NDIM>
+TaskStatus Hydro::RKUpdateRange(Driver *pdriver, int stage,
+                                int is, int ie, int js, int je, int ks, int ke) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+
+  Real &gam0 = pdriver->gam0[stage-1];
+  Real &gam1 = pdriver->gam1[stage-1];
+  Real beta_dt = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nvar = nhydro + nscalars;
+  auto u0_ = u0;
+  auto u1_ = u1;
+  auto flx1 = uflx.x1f;
+  auto flx2 = uflx.x2f;
+  auto flx3 = uflx.x3f;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+
+  // on fused path the flux divergence was already accumulated into udivf by
+  // CalculateFluxes(), so the update is a simple weighted sum
+  if (fused_fluxes) {
+    auto divf_ = udivf;
+    par_for("h_update_fused",DevExeSpace(),0,nmb1,0,nvar-1,ks,ke,js,je,is,ie,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      u0_(m,n,k,j,i) = gam0*u0_(m,n,k,j,i) + gam1*u1_(m,n,k,j,i)
+                     - beta_dt*divf_(m,n,k,j,i);
+    });
+    return TaskStatus::complete;
+  }
+
   // hierarchical parallel loop that updates conserved variables to intermediate step
   // using weights and fractional time step appropriate to stages of time-integrator.
   // Vector inner loop used for good performance on cpus
@@ -59,7 +182,7 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
 
     // Add dF2/dx2
     // Fluxes must be summed in pairs to symmetrize round-off error in each dir
-    if (multi_d) {
+    if constexpr (NDIM >= 2) {
       par_for_inner(member, is, ie, [&](const int i) {
         divf(i) += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
       });
@@ -68,7 +191,7 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
 
     // Add dF3/dx3
     // Fluxes must be summed in pairs to symmetrize round-off error in each dir
-    if (three_d) {
+    if constexpr (NDIM >= 3) {
       par_for_inner(member, is, ie, [&](const int i) {
         divf(i) += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
       });
@@ -81,4 +204,158 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
   });
   return TaskStatus::complete;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::RKUpdateC2P
+//  \brief Explicit RK update of all active cells fused with the conversion to
+//  primitives: the freshly-updated conserved state is inverted while it is still in
+//  registers and w0 is written alongside u0, removing the separate full-array c2p pass
+//  per stage.  Enabled by <hydro>/fused_update_c2p, which requires a single-level mesh
+//  without source terms so that u0 in active cells is final when this task runs;
+//  ConToPrim() then sweeps only the ghost zones.  Floors are applied and counted
+//  exactly as in the EOS ConsToPrim() functions.
+
+TaskStatus Hydro::RKUpdateC2P(Driver *pdriver, int stage) {
+  if (pmy_pack->pmesh->three_d) {
+    return RKUpdateC2P<3>(pdriver, stage);
+  } else if (pmy_pack->pmesh->multi_d) {
+    return RKUpdateC2P<2>(pdriver, stage);
+  }
+  return RKUpdateC2P<1>(pdriver, stage);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::RKUpdateC2P (templated over dimensionality)
+//  \brief Dimension-specialized body of the fused update+c2p; the per-cell multi_d and
+//  three_d tests in the divergence accumulation become if constexpr on NDIM
+
+template <int NDIM>
+TaskStatus Hydro::RKUpdateC2P(Driver *pdriver, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  // with ghost-cell expansion, extend into the redundantly-evolved ghost strip
+  int gw = GhostExpand(pdriver, stage);
+  is -= gw;  ie += gw;
+  if constexpr (NDIM >= 2) {js -= gw;  je += gw;}
+  if constexpr (NDIM >= 3) {ks -= gw;  ke += gw;}
+
+  Real &gam0 = pdriver->gam0[stage-1];
+  Real &gam1 = pdriver->gam1[stage-1];
+  Real beta_dt = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  int nmb = pmy_pack->nmb_thispack;
+  int nhyd = nhydro;
+  int nscal = nscalars;
+  auto u0_ = u0;
+  auto u1_ = u1;
+  auto w0_ = w0;
+  auto flx1 = uflx.x1f;
+  auto flx2 = uflx.x2f;
+  auto flx3 = uflx.x3f;
+  auto divf_ = udivf;
+  bool fused_flx = fused_fluxes;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  auto &eos = peos->eos_data;
+
+  const int ni   = (ie - is + 1);
+  const int nji  = (je - js + 1)*ni;
+  const int nkji = (ke - ks + 1)*nji;
+  const int nmkji = nmb*nkji;
+
+  // counters are accumulated in the device-resident event counter array with atomics
+  // on the (rare) floor-activation paths, so no per-launch reduction or host sync
+  auto &ectr = pmy_pack->pmesh->ecounter_dvce;
+  Kokkos::parallel_for("h_update_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx) {
+    int m = (idx)/nkji;
+    int k = (idx - m*nkji)/nji;
+    int j = (idx - m*nkji - k*nji)/ni;
+    int i = (idx - m*nkji - k*nji - j*ni) + is;
+    j += js;
+    k += ks;
+
+    // RK combination of one conserved variable, evaluated in registers.  Divergence
+    // terms are accumulated per direction in the same order as RKUpdateRange(), so
+    // round-off is identical to the unfused update
+    auto RKCombine = [&](const int n) -> Real {
+      Real divf;
+      if (fused_flx) {
+        divf = divf_(m,n,k,j,i);
+      } else {
+        divf = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+        if constexpr (NDIM >= 2) {
+          divf += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+        }
+        if constexpr (NDIM >= 3) {
+          divf += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+        }
+      }
+      return gam0*u0_(m,n,k,j,i) + gam1*u1_(m,n,k,j,i) - beta_dt*divf;
+    };
+
+    HydCons1D u;
+    u.d  = RKCombine(IDN);
+    u.mx = RKCombine(IM1);
+    u.my = RKCombine(IM2);
+    u.mz = RKCombine(IM3);
+    if (eos.is_ideal) {u.e = RKCombine(IEN);}
+
+    // convert to primitives before the updated state leaves registers
+    HydPrim1D w;
+    bool dfloor_used=false, efloor_used=false, tfloor_used=false;
+    if (eos.is_ideal) {
+      SingleC2P_IdealHyd(u, eos, w, dfloor_used, efloor_used, tfloor_used);
+    } else {
+      // isothermal inversion (mirrors SingleC2P_IsothermalHyd in isothermal_hyd.cpp)
+      if (u.d < eos.dfloor) {
+        u.d = eos.dfloor;
+        dfloor_used = true;
+      }
+      w.d = u.d;
+      Real di = 1.0/u.d;
+      w.vx = di*u.mx;
+      w.vy = di*u.my;
+      w.vz = di*u.mz;
+    }
+    if (dfloor_used) {Kokkos::atomic_add(&ectr(ECDFLOOR), 1);}
+    if (efloor_used) {Kokkos::atomic_add(&ectr(ECEFLOOR), 1);}
+    if (tfloor_used) {Kokkos::atomic_add(&ectr(ECTFLOOR), 1);}
+
+    // store conserved (floored where necessary) and primitive states
+    u0_(m,IDN,k,j,i) = u.d;
+    u0_(m,IM1,k,j,i) = u.mx;
+    u0_(m,IM2,k,j,i) = u.my;
+    u0_(m,IM3,k,j,i) = u.mz;
+    w0_(m,IDN,k,j,i) = w.d;
+    w0_(m,IVX,k,j,i) = w.vx;
+    w0_(m,IVY,k,j,i) = w.vy;
+    w0_(m,IVZ,k,j,i) = w.vz;
+    if (eos.is_ideal) {
+      u0_(m,IEN,k,j,i) = u.e;
+      w0_(m,IEN,k,j,i) = w.e;
+    }
+    // update and convert scalars (if any)
+    for (int n=nhyd; n<(nhyd+nscal); ++n) {
+      Real s = RKCombine(n);
+      if (s < 0.0) {s = 0.0;}  // apply scalar floor
+      u0_(m,n,k,j,i) = s;
+      w0_(m,n,k,j,i) = s/u.d;
+    }
+  });
+
+  fused_c2p_done = true;
+  return TaskStatus::complete;
+}
+
+// explicit instantiation of the dimension-specialized update functions
+template TaskStatus Hydro::RKUpdateRange<1>(Driver *pdriver, int stage,
+                                    int is, int ie, int js, int je, int ks, int ke);
+template TaskStatus Hydro::RKUpdateRange<2>(Driver *pdriver, int stage,
+                                    int is, int ie, int js, int je, int ks, int ke);
+template TaskStatus Hydro::RKUpdateRange<3>(Driver *pdriver, int stage,
+                                    int is, int ie, int js, int je, int ks, int ke);
+template TaskStatus Hydro::RKUpdateC2P<1>(Driver *pdriver, int stage);
+template TaskStatus Hydro::RKUpdateC2P<2>(Driver *pdriver, int stage);
+template TaskStatus Hydro::RKUpdateC2P<3>(Driver *pdriver, int stage);
 } // namespace hydro
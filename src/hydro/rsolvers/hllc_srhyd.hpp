@@ -23,11 +23,12 @@ namespace hydro {
 //! \brief The HLLC Riemann solver for SR hydrodynamics.  Based on HLLCTransforming()
 //! function in Athena++ (C++ version)
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void HLLC_SR(TeamMember_t const &member, const EOS_Data &eos,
      const RegionIndcs &indcs,const DualArray1D<RegionSize> &size,const CoordData &coord,
      const int m, const int k, const int j, const int il, const int iu, const int ivx,
-     const ScrArray2D<Real> &wl, const ScrArray2D<Real> &wr, DvceArray5D<Real> flx) {
+     const ScrArray2D<T> &wl, const ScrArray2D<T> &wr, DvceArray5D<Real> flx) {
   int ivy = IVX + ((ivx-IVX)+1)%3;
   int ivz = IVX + ((ivx-IVX)+2)%3;
   const Real gamma_prime = eos.gamma/(eos.gamma - 1.0);
@@ -37,10 +38,10 @@ void HLLC_SR(TeamMember_t const &member, const EOS_Data &eos,
     // Recall in SR the primitive variables are (\rho, u^i, P_gas), where \rho is the
     // mass density in the comoving/fluid frame, u^i = \gamma v^i are the spatial
     // components of the 4-velocity (v^i is the 3-velocity), and P_gas is the pressure.
-    Real &rho_l  = wl(IDN,i);
-    Real &ux_l   = wl(ivx,i);
-    Real &uy_l   = wl(ivy,i);
-    Real &uz_l   = wl(ivz,i);
+    const T &rho_l  = wl(IDN,i);
+    const T &ux_l   = wl(ivx,i);
+    const T &uy_l   = wl(ivy,i);
+    const T &uz_l   = wl(ivz,i);
     Real u_l[4];
     u_l[0] = sqrt(1.0 + SQR(ux_l) + SQR(uy_l) + SQR(uz_l));  // Lorentz factor in L-state
     u_l[1] = ux_l;
@@ -48,10 +49,10 @@ void HLLC_SR(TeamMember_t const &member, const EOS_Data &eos,
     u_l[3] = uz_l;
 
     // Extract right primitives
-    Real &rho_r  = wr(IDN,i);
-    Real &ux_r   = wr(ivx,i);
-    Real &uy_r   = wr(ivy,i);
-    Real &uz_r   = wr(ivz,i);
+    const T &rho_r  = wr(IDN,i);
+    const T &ux_r   = wr(ivx,i);
+    const T &uy_r   = wr(ivy,i);
+    const T &uz_r   = wr(ivz,i);
     Real u_r[4];
     u_r[0] = sqrt(1.0 + SQR(ux_r) + SQR(uy_r) + SQR(uz_r));  // Lorentz factor in R-state
     u_r[1] = ux_r;
@@ -28,5 +28,13 @@ IonNeutral::IonNeutral(MeshBlockPack *pp, ParameterInput *pin) :
   drag_coeff = pin->GetReal("ion-neutral","drag_coeff");
   ionization_coeff = pin->GetOrAddReal("ion-neutral","ionization_coeff",0.0);
   recombination_coeff = pin->GetOrAddReal("ion-neutral","recombination_coeff",0.0);
+
+  // optionally pack the neutral (Hydro) conserved-variable exchange into the ion (MHD)
+  // exchange, so each neighbor pair trades one message per stage instead of two
+  fuse_bvals = pin->GetOrAddBoolean("ion-neutral","fuse_bvals",false);
+  if (fuse_bvals) {
+    pp->pmhd->pbval_u->FuseCC(&(pp->phydro->u0), &(pp->phydro->coarse_u0),
+                              pp->phydro->pbval_u);
+  }
 }
 } // namespace ion_neutral
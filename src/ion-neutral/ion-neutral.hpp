@@ -75,6 +75,9 @@ class IonNeutral {
   Real ionization_coeff;         // ionization rate, xi
   Real recombination_coeff;      // recombination rate, alpha
 
+  // fuse neutral (Hydro) conserved-variable exchange into the ion (MHD) exchange
+  bool fuse_bvals;
+
   // container to hold names of TaskIDs
   IonNeutralTaskIDs id;
 
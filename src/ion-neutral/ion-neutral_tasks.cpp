@@ -36,52 +36,70 @@ void IonNeutral::AssembleIonNeutralTasks(
   Hydro *phyd = pmy_pack->phydro;
 
   // assemble "before_stagen_tl" task list
-  id.i_irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, pmhd, none);
-  id.n_irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, phyd, none);
+  id.i_irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, pmhd, none, "MHD::InitRecv");
+  id.n_irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, phyd, none,
+      "Hydro::InitRecv");
 
   // assemble "stagen_tl" task list
   // FirstTwoImpRK task does CopyCons
-  id.impl_2x = tl["stagen"]->AddTask(&IonNeutral::FirstTwoImpRK, this, none);
-
-  id.i_flux   = tl["stagen"]->AddTask(&MHD::Fluxes, pmhd, id.impl_2x);
-  id.i_sendf  = tl["stagen"]->AddTask(&MHD::SendFlux, pmhd, id.i_flux);
-  id.i_recvf  = tl["stagen"]->AddTask(&MHD::RecvFlux, pmhd, id.i_sendf);
-  id.i_rkupdt = tl["stagen"]->AddTask(&MHD::RKUpdate, pmhd, id.i_recvf);
-
-  id.n_flux   = tl["stagen"]->AddTask(&Hydro::Fluxes, phyd, id.i_rkupdt);
-  id.n_sendf  = tl["stagen"]->AddTask(&Hydro::SendFlux, phyd, id.n_flux);
-  id.n_recvf  = tl["stagen"]->AddTask(&Hydro::RecvFlux, phyd, id.n_sendf);
-  id.n_rkupdt = tl["stagen"]->AddTask(&Hydro::RKUpdate, phyd, id.n_recvf);
-
-  id.impl     = tl["stagen"]->AddTask(&IonNeutral::ImpRKUpdate, this, id.n_rkupdt);
-  id.i_restu  = tl["stagen"]->AddTask(&MHD::RestrictU, pmhd, id.impl);
-  id.n_restu  = tl["stagen"]->AddTask(&Hydro::RestrictU, phyd, id.i_restu);
-
-  id.i_sendu  = tl["stagen"]->AddTask(&MHD::SendU, pmhd, id.n_restu);
-  id.n_sendu  = tl["stagen"]->AddTask(&Hydro::SendU, phyd, id.n_restu);
-  id.i_recvu  = tl["stagen"]->AddTask(&MHD::RecvU, pmhd, id.i_sendu);
-  id.n_recvu  = tl["stagen"]->AddTask(&Hydro::RecvU, phyd, id.n_sendu);
-
-  id.efld     = tl["stagen"]->AddTask(&MHD::CornerE, pmhd, id.i_recvu);
-  id.sende    = tl["stagen"]->AddTask(&MHD::SendE, pmhd, id.efld);
-  id.recve    = tl["stagen"]->AddTask(&MHD::RecvE, pmhd, id.sende);
-  id.ct       = tl["stagen"]->AddTask(&MHD::CT, pmhd, id.recve);
-  id.restb    = tl["stagen"]->AddTask(&MHD::RestrictB, pmhd, id.ct);
-  id.sendb    = tl["stagen"]->AddTask(&MHD::SendB, pmhd, id.restb);
-  id.recvb    = tl["stagen"]->AddTask(&MHD::RecvB, pmhd, id.sendb);
-
-  id.i_bcs    = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, pmhd, id.recvb);
-  id.n_bcs    = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, phyd, id.n_recvu);
-  id.i_prol   = tl["stagen"]->AddTask(&MHD::Prolongate, pmhd, id.i_bcs);
-  id.n_prol   = tl["stagen"]->AddTask(&Hydro::Prolongate, phyd, id.n_bcs);
-  id.i_c2p    = tl["stagen"]->AddTask(&MHD::ConToPrim, pmhd, id.i_prol);
-  id.n_c2p    = tl["stagen"]->AddTask(&Hydro::ConToPrim, phyd, id.n_prol);
-  id.i_newdt  = tl["stagen"]->AddTask(&MHD::NewTimeStep, pmhd, id.i_c2p);
-  id.n_newdt  = tl["stagen"]->AddTask(&Hydro::NewTimeStep, phyd, id.n_c2p);
+  id.impl_2x = tl["stagen"]->AddTask(&IonNeutral::FirstTwoImpRK, this, none,
+      "IonNeutral::FirstTwoImpRK");
+
+  id.i_flux   = tl["stagen"]->AddTask(&MHD::Fluxes, pmhd, id.impl_2x, "MHD::Fluxes");
+  id.i_sendf  = tl["stagen"]->AddTask(&MHD::SendFlux, pmhd, id.i_flux, "MHD::SendFlux");
+  id.i_recvf  = tl["stagen"]->AddTask(&MHD::RecvFlux, pmhd, id.i_sendf, "MHD::RecvFlux");
+  id.i_rkupdt = tl["stagen"]->AddTask(&MHD::RKUpdate, pmhd, id.i_recvf, "MHD::RKUpdate");
+
+  id.n_flux   = tl["stagen"]->AddTask(&Hydro::Fluxes, phyd, id.i_rkupdt, "Hydro::Fluxes");
+  id.n_sendf  = tl["stagen"]->AddTask(&Hydro::SendFlux, phyd, id.n_flux,
+      "Hydro::SendFlux");
+  id.n_recvf  = tl["stagen"]->AddTask(&Hydro::RecvFlux, phyd, id.n_sendf,
+      "Hydro::RecvFlux");
+  id.n_rkupdt = tl["stagen"]->AddTask(&Hydro::RKUpdate, phyd, id.n_recvf,
+      "Hydro::RKUpdate");
+
+  id.impl     = tl["stagen"]->AddTask(&IonNeutral::ImpRKUpdate, this, id.n_rkupdt,
+      "IonNeutral::ImpRKUpdate");
+  id.i_restu  = tl["stagen"]->AddTask(&MHD::RestrictU, pmhd, id.impl, "MHD::RestrictU");
+  id.n_restu  = tl["stagen"]->AddTask(&Hydro::RestrictU, phyd, id.i_restu,
+      "Hydro::RestrictU");
+
+  id.i_sendu  = tl["stagen"]->AddTask(&MHD::SendU, pmhd, id.n_restu, "MHD::SendU");
+  id.n_sendu  = tl["stagen"]->AddTask(&Hydro::SendU, phyd, id.n_restu, "Hydro::SendU");
+  id.i_recvu  = tl["stagen"]->AddTask(&MHD::RecvU, pmhd, id.i_sendu, "MHD::RecvU");
+  id.n_recvu  = tl["stagen"]->AddTask(&Hydro::RecvU, phyd, id.n_sendu, "Hydro::RecvU");
+
+  id.efld     = tl["stagen"]->AddTask(&MHD::CornerE, pmhd, id.i_recvu, "MHD::CornerE");
+  id.sende    = tl["stagen"]->AddTask(&MHD::SendE, pmhd, id.efld, "MHD::SendE");
+  id.recve    = tl["stagen"]->AddTask(&MHD::RecvE, pmhd, id.sende, "MHD::RecvE");
+  id.ct       = tl["stagen"]->AddTask(&MHD::CT, pmhd, id.recve, "MHD::CT");
+  id.restb    = tl["stagen"]->AddTask(&MHD::RestrictB, pmhd, id.ct, "MHD::RestrictB");
+  id.sendb    = tl["stagen"]->AddTask(&MHD::SendB, pmhd, id.restb, "MHD::SendB");
+  id.recvb    = tl["stagen"]->AddTask(&MHD::RecvB, pmhd, id.sendb, "MHD::RecvB");
+
+  id.i_bcs    = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, pmhd, id.recvb,
+      "MHD::ApplyPhysicalBCs");
+  // when the neutral exchange is fused into the ion exchange, the hydro ghost zones are
+  // actually filled by MHD::RecvU, so the neutral BCs must wait on it as well
+  TaskID n_udep = (fuse_bvals)? (id.n_recvu | id.i_recvu) : id.n_recvu;
+  id.n_bcs    = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, phyd, n_udep,
+      "Hydro::ApplyPhysicalBCs");
+  id.i_prol   = tl["stagen"]->AddTask(&MHD::Prolongate, pmhd, id.i_bcs,
+      "MHD::Prolongate");
+  id.n_prol   = tl["stagen"]->AddTask(&Hydro::Prolongate, phyd, id.n_bcs,
+      "Hydro::Prolongate");
+  id.i_c2p    = tl["stagen"]->AddTask(&MHD::ConToPrim, pmhd, id.i_prol, "MHD::ConToPrim");
+  id.n_c2p    = tl["stagen"]->AddTask(&Hydro::ConToPrim, phyd, id.n_prol,
+      "Hydro::ConToPrim");
+  id.i_newdt  = tl["stagen"]->AddTask(&MHD::NewTimeStep, pmhd, id.i_c2p,
+      "MHD::NewTimeStep");
+  id.n_newdt  = tl["stagen"]->AddTask(&Hydro::NewTimeStep, phyd, id.n_c2p,
+      "Hydro::NewTimeStep");
 
   // assemble "after_stagen_tl" task list
-  id.i_clear = tl["after_stagen"]->AddTask(&MHD::ClearSend, pmhd, none);
-  id.n_clear = tl["after_stagen"]->AddTask(&Hydro::ClearSend, phyd, none);
+  id.i_clear = tl["after_stagen"]->AddTask(&MHD::ClearSend, pmhd, none, "MHD::ClearSend");
+  id.n_clear = tl["after_stagen"]->AddTask(&Hydro::ClearSend, phyd, none,
+      "Hydro::ClearSend");
 
   return;
 }
@@ -150,126 +168,110 @@ TaskStatus IonNeutral::ImpRKUpdate(Driver *pdriver, int estage) {
   int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*indcs.ng) : 1;
   int nmb1 = pmy_pack->nmb_thispack - 1;
 
-  // Add stiff source term (ion-neutral drag) evaluated with values from previous stages,
-  // i.e. the R(U^1), R(U^2), etc. terms, to partially updated conserved variables.
-  // Only required for istage = (2,3,4,[5])
+  // All three steps of the implicit stage (accumulating the stiff source terms from
+  // previous stages, solving the implicit difference equations, and evaluating the new
+  // stiff source term) are pointwise, so they are fused into a single kernel applied
+  // while both fluids' cell state is in registers: each u0 array is read and written
+  // once per stage instead of three times
   mhd::MHD *pmhd = pmy_pack->pmhd;
   hydro::Hydro *phyd = pmy_pack->phydro;
-  if (istage > 1) {
-    int scr_level = 0;
-    size_t scr_size = 0;
-    auto ui = pmhd->u0;
-    auto un = phyd->u0;
-    auto &a_twid = pdriver->a_twid;
-    Real dt = pmy_pack->pmesh->dt;
-    auto ru_ = pdriver->impl_src;
-    par_for_outer("imex_exp",DevExeSpace(),scr_size,scr_level,0,nmb1,0,(n3-1),0,(n2-1),
-    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+  auto ui = pmhd->u0;
+  auto un = phyd->u0;
+  auto ru_ = pdriver->impl_src;
+  auto &a_twid = pdriver->a_twid;
+  Real dt = pmy_pack->pmesh->dt;
+  // Accumulation of R(U^1), R(U^2), etc. only required for istage = (2,3,4,[5]);
+  // implicit solve and new source term only required for istage = (1,2,3,[4])
+  bool add_exp = (istage > 1);
+  bool do_imp = (estage < pdriver->nexp_stages);
+  Real gamma_adt = drag_coeff*(pdriver->a_impl)*dt;
+  Real xi_adt = ionization_coeff*(pdriver->a_impl)*dt;
+  Real alpha_adt = recombination_coeff*(pdriver->a_impl)*dt;
+  auto drag = drag_coeff;
+  auto xi = ionization_coeff;
+  auto alpha = recombination_coeff;
+  int s_new = istage-1;
+
+  par_for("imex_fused",DevExeSpace(),0,nmb1,0,(n3-1),0,(n2-1),0,(n1-1),
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    // load both fluids' densities and momenta
+    Real di = ui(m,IDN,k,j,i), dn = un(m,IDN,k,j,i);
+    Real m1i = ui(m,IM1,k,j,i), m1n = un(m,IM1,k,j,i);
+    Real m2i = ui(m,IM2,k,j,i), m2n = un(m,IM2,k,j,i);
+    Real m3i = ui(m,IM3,k,j,i), m3n = un(m,IM3,k,j,i);
+
+    // Add stiff source terms (ion-neutral drag) evaluated with values from previous
+    // stages, i.e. the R(U^1), R(U^2), etc. terms, to partially updated variables
+    if (add_exp) {
       for (int s=0; s<=(istage-2); ++s) {
         Real adt = a_twid[istage-2][s]*dt;
-        par_for_inner(member, 0, (n1-1), [&](const int i) {
-          ui(m,IM1,k,j,i) += adt*ru_(s,m,0,k,j,i);
-          ui(m,IM2,k,j,i) += adt*ru_(s,m,1,k,j,i);
-          ui(m,IM3,k,j,i) += adt*ru_(s,m,2,k,j,i);
-          un(m,IM1,k,j,i) += adt*ru_(s,m,3,k,j,i);
-          un(m,IM2,k,j,i) += adt*ru_(s,m,4,k,j,i);
-          un(m,IM3,k,j,i) += adt*ru_(s,m,5,k,j,i);
-          ui(m,IDN,k,j,i) += adt*ru_(s,m,6,k,j,i);
-          un(m,IDN,k,j,i) += adt*ru_(s,m,7,k,j,i);
-        });
+        m1i += adt*ru_(s,m,0,k,j,i);
+        m2i += adt*ru_(s,m,1,k,j,i);
+        m3i += adt*ru_(s,m,2,k,j,i);
+        m1n += adt*ru_(s,m,3,k,j,i);
+        m2n += adt*ru_(s,m,4,k,j,i);
+        m3n += adt*ru_(s,m,5,k,j,i);
+        di  += adt*ru_(s,m,6,k,j,i);
+        dn  += adt*ru_(s,m,7,k,j,i);
       }
-    });
-  }
-
-  // Update ion/neutral momentum equations with analytic solution of implicit difference
-  // equations for ion-neutral drag.
-  // Only required for istage = (1,2,3,[4])
-  if (estage < pdriver->nexp_stages) {
-    Real gamma_adt = drag_coeff*(pdriver->a_impl)*(pmy_pack->pmesh->dt);
-    Real xi_adt = ionization_coeff*(pdriver->a_impl)*(pmy_pack->pmesh->dt);
-    Real alpha_adt = recombination_coeff*(pdriver->a_impl)*(pmy_pack->pmesh->dt);
-    auto ui = pmhd->u0;
-    auto un = phyd->u0;
-    par_for("imex_imp",DevExeSpace(),0,nmb1,0,(n3-1),0,(n2-1),0,(n1-1),
-    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-      Real rho_i = ui(m,IDN,k,j,i);
+    }
+
+    if (do_imp) {
+      // Update ion/neutral equations with analytic solution of implicit difference
+      // equations for ion-neutral drag
+      Real rho_i = di;
       if (alpha_adt > 0) { // to avoid division by zero
         Real d = 1./4./alpha_adt/alpha_adt + xi_adt/2./alpha_adt/alpha_adt
-                 + xi_adt*xi_adt/4./alpha_adt/alpha_adt + ui(m,IDN,k,j,i)/alpha_adt +
-                 xi_adt/alpha_adt * (ui(m,IDN,k,j,i)+un(m,IDN,k,j,i));
+                 + xi_adt*xi_adt/4./alpha_adt/alpha_adt + di/alpha_adt +
+                 xi_adt/alpha_adt * (di+dn);
         rho_i = -1./2./alpha_adt - xi_adt/2./alpha_adt + sqrt(d);
       }
-      Real rho_n = ui(m,IDN,k,j,i) + un(m,IDN,k,j,i) - rho_i;
-      ui(m,IDN,k,j,i) = rho_i;
-      un(m,IDN,k,j,i) = rho_n;
+      Real rho_n = di + dn - rho_i;
+      di = rho_i;
+      dn = rho_n;
 
       Real denom = 1.0 + gamma_adt*(rho_i+rho_n) + xi_adt + alpha_adt*rho_i;
       // compute new ion/neutral momenta in x1
-      Real sum = (ui(m,IM1,k,j,i) + un(m,IM1,k,j,i));
-      Real u_i = (ui(m,IM1,k,j,i) +
-                 (gamma_adt*rho_i + xi_adt)*sum)/denom;
-      Real u_n = sum - u_i;
-      ui(m,IM1,k,j,i) = u_i;
-      un(m,IM1,k,j,i) = u_n;
+      Real sum = (m1i + m1n);
+      Real u_i = (m1i + (gamma_adt*rho_i + xi_adt)*sum)/denom;
+      m1i = u_i;
+      m1n = sum - u_i;
       // compute new ion/neutral momenta in x2
-      sum = (ui(m,IM2,k,j,i) + un(m,IM2,k,j,i));
-      u_i = (ui(m,IM2,k,j,i) +
-                 (gamma_adt*rho_i + xi_adt)*sum)/denom;
-      u_n = sum - u_i;
-      ui(m,IM2,k,j,i) = u_i;
-      un(m,IM2,k,j,i) = u_n;
+      sum = (m2i + m2n);
+      u_i = (m2i + (gamma_adt*rho_i + xi_adt)*sum)/denom;
+      m2i = u_i;
+      m2n = sum - u_i;
       // compute new ion/neutral momenta in x3
-      sum = (ui(m,IM3,k,j,i) + un(m,IM3,k,j,i));
-      u_i = (ui(m,IM3,k,j,i) +
-                 (gamma_adt*rho_i + xi_adt)*sum)/denom;
-      u_n = sum - u_i;
-      ui(m,IM3,k,j,i) = u_i;
-      un(m,IM3,k,j,i) = u_n;
-    });
-  }
-
-  // Compute stiff source term (ion-neutral drag) using variables updated in this stage,
-  // i.e R(U^n), for use in later stages.  Only required for istage = (1,2,3,[4])
-  if (estage < pdriver->nexp_stages) {
-    int s = istage-1;
-    auto ui = pmhd->u0;
-    auto un = phyd->u0;
-    auto drag = drag_coeff;
-    auto xi = ionization_coeff;
-    auto alpha = recombination_coeff;
-    auto ru_ = pdriver->impl_src;
-    par_for("imex_rup",DevExeSpace(),0,nmb1,0,(n3-1),0,(n2-1),0,(n1-1),
-    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-      // drag term in IM1 component of ion momentum
-      ru_(s,m,0,k,j,i) = drag*(ui(m,IDN,k,j,i)*un(m,IM1,k,j,i) -
-                              un(m,IDN,k,j,i)*ui(m,IM1,k,j,i)) +
-                              xi*un(m,IM1,k,j,i) - alpha*ui(m,IDN,k,j,i)*ui(m,IM1,k,j,i);
-      // drag term in IM2 component of ion momentum
-      ru_(s,m,1,k,j,i) = drag*(ui(m,IDN,k,j,i)*un(m,IM2,k,j,i) -
-                              un(m,IDN,k,j,i)*ui(m,IM2,k,j,i)) +
-                              xi*un(m,IM2,k,j,i) - alpha*ui(m,IDN,k,j,i)*ui(m,IM2,k,j,i);
-      // drag term in IM3 component of ion momentum
-      ru_(s,m,2,k,j,i) = drag*(ui(m,IDN,k,j,i)*un(m,IM3,k,j,i) -
-                              un(m,IDN,k,j,i)*ui(m,IM3,k,j,i)) +
-                              xi*un(m,IM3,k,j,i) - alpha*ui(m,IDN,k,j,i)*ui(m,IM3,k,j,i);
-      // drag term in IM1 component of neutral momentum
-      ru_(s,m,3,k,j,i) = drag*(un(m,IDN,k,j,i)*ui(m,IM1,k,j,i) -
-                              ui(m,IDN,k,j,i)*un(m,IM1,k,j,i)) -
-                              xi*un(m,IM1,k,j,i) + alpha*ui(m,IDN,k,j,i)*ui(m,IM1,k,j,i);
-      // drag term in IM2 component of neutral momentum
-      ru_(s,m,4,k,j,i) = drag*(un(m,IDN,k,j,i)*ui(m,IM2,k,j,i) -
-                              ui(m,IDN,k,j,i)*un(m,IM2,k,j,i)) -
-                              xi*un(m,IM2,k,j,i) + alpha*ui(m,IDN,k,j,i)*ui(m,IM2,k,j,i);
-      // drag term in IM3 component of neutral momentum
-      ru_(s,m,5,k,j,i) = drag*(un(m,IDN,k,j,i)*ui(m,IM3,k,j,i) -
-                              ui(m,IDN,k,j,i)*un(m,IM3,k,j,i)) -
-                              xi*un(m,IM3,k,j,i) + alpha*ui(m,IDN,k,j,i)*ui(m,IM3,k,j,i);
-      // drag term in IDN component of ion momentum
-      ru_(s,m,6,k,j,i) = xi*un(m,IDN,k,j,i) - alpha*ui(m,IDN,k,j,i)*ui(m,IDN,k,j,i);
-      // drag term in IDN component of neutral momentum
-      ru_(s,m,7,k,j,i) =-xi*un(m,IDN,k,j,i) + alpha*ui(m,IDN,k,j,i)*ui(m,IDN,k,j,i);
-    });
-  }
+      sum = (m3i + m3n);
+      u_i = (m3i + (gamma_adt*rho_i + xi_adt)*sum)/denom;
+      m3i = u_i;
+      m3n = sum - u_i;
+
+      // Compute stiff source term (ion-neutral drag) using variables updated in this
+      // stage, i.e R(U^n), for use in later stages
+      // drag terms in IM1/IM2/IM3 components of ion momentum
+      ru_(s_new,m,0,k,j,i) = drag*(di*m1n - dn*m1i) + xi*m1n - alpha*di*m1i;
+      ru_(s_new,m,1,k,j,i) = drag*(di*m2n - dn*m2i) + xi*m2n - alpha*di*m2i;
+      ru_(s_new,m,2,k,j,i) = drag*(di*m3n - dn*m3i) + xi*m3n - alpha*di*m3i;
+      // drag terms in IM1/IM2/IM3 components of neutral momentum
+      ru_(s_new,m,3,k,j,i) = drag*(dn*m1i - di*m1n) - xi*m1n + alpha*di*m1i;
+      ru_(s_new,m,4,k,j,i) = drag*(dn*m2i - di*m2n) - xi*m2n + alpha*di*m2i;
+      ru_(s_new,m,5,k,j,i) = drag*(dn*m3i - di*m3n) - xi*m3n + alpha*di*m3i;
+      // drag terms in IDN components of ion and neutral densities
+      ru_(s_new,m,6,k,j,i) = xi*dn - alpha*di*di;
+      ru_(s_new,m,7,k,j,i) =-xi*dn + alpha*di*di;
+    }
+
+    // write back both fluids' updated state
+    ui(m,IDN,k,j,i) = di;
+    un(m,IDN,k,j,i) = dn;
+    ui(m,IM1,k,j,i) = m1i;
+    un(m,IM1,k,j,i) = m1n;
+    ui(m,IM2,k,j,i) = m2i;
+    un(m,IM2,k,j,i) = m2n;
+    ui(m,IM3,k,j,i) = m3i;
+    un(m,IM3,k,j,i) = m3n;
+  });
 
   return TaskStatus::complete;
 }
@@ -34,6 +34,11 @@
 #include "athena.hpp"
 #include "globals.hpp"
 #include "utils/utils.hpp"
+#include "utils/kernel_tuner.hpp"
+#include "utils/memory_accounting.hpp"
+#include "utils/startup_timing.hpp"
+#include "utils/sync_audit.hpp"
+#include "utils/uvm_spill.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
 #include "outputs/outputs.hpp"
@@ -89,12 +94,17 @@ int main(int argc, char *argv[]) {
     MPI_Finalize();
     return(0);
   }
+  global_variable::mpi_thread_provided = mpiprv;
 #else  // no OpenMP
-  if (MPI_SUCCESS != MPI_Init(&argc, &argv)) {
+  // Request MPI_THREAD_MULTIPLE (needed for asynchronous output writer threads), but do
+  // not require it; features that need it test global_variable::mpi_thread_provided
+  int mpiprv;
+  if (MPI_SUCCESS != MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &mpiprv)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
               << "MPI Initialization failed." << std::endl;
     return(0);
   }
+  global_variable::mpi_thread_provided = mpiprv;
 #endif  // OPENMP_PARALLEL_ENABLED
   // Get process id (rank) in MPI_COMM_WORLD
   if (MPI_SUCCESS != MPI_Comm_rank(MPI_COMM_WORLD, &(global_variable::my_rank))) {
@@ -118,6 +128,9 @@ int main(int argc, char *argv[]) {
 
   Kokkos::initialize(argc, argv);
 
+  // verify MPI library can access device memory if compiled with GPU-aware MPI
+  ValidateGPUAwareMPI();
+
   //--- Step 2. --------------------------------------------------------------------------
   // Check for command line options and respond.
 
@@ -223,6 +236,7 @@ int main(int argc, char *argv[]) {
   // Start the wall clock timer. This is done here rather than in the Driver to ensure
   // that the time taken in ProblemGenerator is also captured.
   Kokkos::Timer timer;
+  startup_timing::Begin();
 
   //--- Step 3. --------------------------------------------------------------------------
   // Construct ParameterInput object and load data either from restart or input file.
@@ -243,6 +257,7 @@ int main(int argc, char *argv[]) {
     infile.Close();
   }
   pinput->ModifyFromCmdline(argc, argv);
+  startup_timing::MarkPhase("read_input");
 
   // Dump input parameters and quit if code was run with -n option.
   if (narg_flag) {
@@ -261,12 +276,43 @@ int main(int argc, char *argv[]) {
   // on this rank.  Latter cannot be performed in Mesh constructor since it requires
   // pointer to Mesh.
 
+  // install device memory accounting callbacks before any Mesh allocations are made
+  if (pinput->GetOrAddBoolean("mesh", "memory_accounting", false)) {
+    memory_accounting::Enable();
+  }
+  // install host-device sync auditing callbacks before any DualArrays are built
+  if (pinput->GetOrAddBoolean("mesh", "sync_audit", false)) {
+    sync_audit::Enable(pinput->GetOrAddBoolean("mesh", "sync_audit_strict", false));
+  }
+  // audit (or, in strict mode, forbid) allocations during task-list execution
+  if (pinput->GetOrAddBoolean("mesh", "alloc_audit", false)) {
+    memory_accounting::EnableAudit(
+        pinput->GetOrAddBoolean("mesh", "alloc_audit_strict", false));
+  }
+  // detect and report rank-to-host/CPU/device placement (collective)
+  if (pinput->GetOrAddBoolean("job", "placement_report", false)) {
+    ReportRuntimePlacement();
+  }
+  // place designated cold arrays in managed memory to run slightly over device capacity
+  if (pinput->GetOrAddBoolean("mesh", "uvm_spill", false)) {
+    uvm_spill::Enable();
+  }
+
   Mesh* pmesh = new Mesh(pinput);
   if (!res_flag) {
     pmesh->BuildTreeFromScratch(pinput);
   } else {
     pmesh->BuildTreeFromRestart(pinput, restartfile);
   }
+  startup_timing::MarkPhase("mesh_tree_build");
+
+  // optionally autotune team-kernel launch parameters over the first cycles, with the
+  // chosen configuration cached per (architecture, MeshBlock size) for later runs
+  if (pinput->GetOrAddBoolean("mesh", "autotune", false)) {
+    kernel_tuner::Enable(
+        pinput->GetOrAddString("mesh", "autotune_file", "kernel_tune.cache"),
+        pmesh->mb_indcs.nx1, pmesh->mb_indcs.nx2, pmesh->mb_indcs.nx3);
+  }
 
   //  If code was run with -m option, write mesh structure to file and quit.
   if (marg_flag) {
@@ -287,6 +333,7 @@ int main(int argc, char *argv[]) {
   // is fully constructed.
 
   pmesh->AddCoordinatesAndPhysics(pinput);
+  startup_timing::MarkPhase("physics_buffers");
   if (!res_flag) {
     // set ICs using ProblemGenerator constructor for new runs
     pmesh->pgen = std::make_unique<ProblemGenerator>(pinput, pmesh);
@@ -295,6 +342,11 @@ int main(int argc, char *argv[]) {
     pmesh->pgen = std::make_unique<ProblemGenerator>(pinput, pmesh, restartfile);
     restartfile.Close();
   }
+  startup_timing::MarkPhase("problem_generator");
+
+  // migrate any managed-memory (spill) arrays to the device before cycling begins, so
+  // their pages are resident rather than faulted in on first touch
+  uvm_spill::PrefetchAll();
 
   //--- Step 6. --------------------------------------------------------------------------
   // Construct Driver and Outputs. Actual outputs (including initial conditions) are made
@@ -303,6 +355,7 @@ int main(int argc, char *argv[]) {
   ChangeRunDir(run_dir);
   Driver* pdriver = new Driver(pinput, pmesh, wtlim, &timer);
   Outputs* pout = new Outputs(pinput, pmesh);
+  startup_timing::MarkPhase("driver_outputs_ctor");
 
   //--- Step 7. --------------------------------------------------------------------------
   // Execute Driver.
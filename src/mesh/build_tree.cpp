@@ -261,8 +261,19 @@ void Mesh::BuildTreeFromScratch(ParameterInput *pin) {
   int mbp_gide = mbp_gids + nmb_eachrank[global_variable::my_rank] - 1;
   nmb_thisrank = nmb_eachrank[global_variable::my_rank];
 
+  // Number of MBPacks per rank is runtime-tunable so that each pack's working set can
+  // eventually be sized to CPU cache.  Only a single pack spanning all rank-local
+  // MeshBlocks is supported so far: outputs, problem generators, and the boundary
+  // buffers address MeshBlocks through the single pmb_pack and are not yet pack-aware
+  nmb_packs_thisrank = pin->GetOrAddInteger("mesh", "nmb_packs_per_rank", 1);
+  if (nmb_packs_thisrank != 1) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "<mesh>/nmb_packs_per_rank=" << nmb_packs_thisrank
+       << " is not yet supported; only 1 MeshBlockPack per rank allowed" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
   pmb_pack = new MeshBlockPack(this, mbp_gids, mbp_gide);
-  nmb_packs_thisrank = 1;
+  pmb_packs.push_back(pmb_pack);
   pmb_pack->AddMeshBlocks(pin);
   pmb_pack->pmb->SetNeighbors(ptree, rank_eachmb);
 
@@ -304,6 +315,8 @@ void Mesh::BuildTreeFromScratch(ParameterInput *pin) {
   time = pin->GetOrAddReal("time", "start_time", 0.0);
   dt   = std::numeric_limits<float>::max();
   cfl_no = pin->GetReal("time", "cfl_number");
+  async_dt = pin->GetOrAddBoolean("time", "async_dt", false);
+  async_dt_safety = pin->GetOrAddReal("time", "async_dt_safety", 0.9);
   ncycle = 0;
   if (global_variable::my_rank == 0) {PrintMeshDiagnostics();}
 
@@ -321,10 +334,23 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile) {
   // data has already been read in main(). Thus the file pointer is set to after <par_end>
   IOWrapperSizeT headeroffset = resfile.GetPosition();
 
+  // floating-point width of the build that wrote this file, recorded by restart.cpp in
+  // <job>/real_size.  When it differs from this build's Real the header and payload are
+  // converted on read, so a campaign can switch precision at a restart boundary.  Files
+  // from before the parameter was recorded can only be read at the native width
+  const IOWrapperSizeT frsz = pin->GetOrAddInteger("job", "real_size", sizeof(Real));
+  if ((frsz != sizeof(float)) && (frsz != sizeof(double))) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "<job>/real_size = " << frsz << " in restart file is not a supported "
+              << "floating-point width" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   // following must be identical to calculation of headeroffset (excluding size of
-  // ParameterInput data) in restart.cpp
-  IOWrapperSizeT headersize = 3*sizeof(int) + 2*sizeof(Real)
-    + sizeof(RegionSize) + 2*sizeof(RegionIndcs);
+  // ParameterInput data) in restart.cpp, with Reals at the width of the writing build.
+  // RegionSize is 12 Reals with no padding, so its file size is 12*frsz
+  IOWrapperSizeT headersize = 3*sizeof(int) + 2*frsz
+    + 12*frsz + 2*sizeof(RegionIndcs);
   char *headerdata = new char[headersize];
 
   if (global_variable::my_rank == 0) { // the master process reads the header data
@@ -349,16 +375,20 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile) {
   hdos += sizeof(int);
   std::memcpy(&root_level, &(headerdata[hdos]), sizeof(int));
   hdos += sizeof(int);
-  std::memcpy(&mesh_size, &(headerdata[hdos]), sizeof(RegionSize));
-  hdos += sizeof(RegionSize);
+  {
+    Real msize[12];
+    IOWrapper::UnpackReals(msize, &(headerdata[hdos]), 12, frsz);
+    std::memcpy(&mesh_size, msize, sizeof(RegionSize));
+    hdos += 12*frsz;
+  }
   std::memcpy(&mesh_indcs, &(headerdata[hdos]), sizeof(RegionIndcs));
   hdos += sizeof(RegionIndcs);
   std::memcpy(&mb_indcs, &(headerdata[hdos]), sizeof(RegionIndcs));
   hdos += sizeof(RegionIndcs);
-  std::memcpy(&time, &(headerdata[hdos]), sizeof(Real));
-  hdos += sizeof(Real);
-  std::memcpy(&dt, &(headerdata[hdos]), sizeof(Real));
-  hdos += sizeof(Real);
+  IOWrapper::UnpackReals(&time, &(headerdata[hdos]), 1, frsz);
+  hdos += frsz;
+  IOWrapper::UnpackReals(&dt, &(headerdata[hdos]), 1, frsz);
+  hdos += frsz;
   std::memcpy(&ncycle, &(headerdata[hdos]), sizeof(int));
   delete [] headerdata;
 
@@ -419,10 +449,12 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile) {
   delete [] idlist;
   if (!adaptive) max_level = current_level;
 
-  // rebuild the MeshBlockTree
+  // rebuild the MeshBlockTree.  The batched insert partitions the curve-ordered
+  // location list into subtree ranges recursively, so each entry is visited only along
+  // its own root-to-leaf path instead of being descended from the root one at a time
   ptree = std::make_unique<MeshBlockTree>(this);
   ptree->CreateRootGrid();
-  for (int i=0; i<nmb_total; i++) {ptree->AddNodeWithoutRefinement(lloc_eachmb[i]);}
+  ptree->AddNodesWithoutRefinement(lloc_eachmb, nmb_total);
 
   // check the tree structure by making sure total # of MBs counted in tree same as the
   // number read from the restart file.
@@ -447,6 +479,11 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile) {
   }
 #endif
 
+  // Compute the block distribution for the *current* rank count before any payload is
+  // read.  Restart records are stored by global (Z-ordered) id, so each rank then reads
+  // exactly its final blocks directly from the file by offset in the restart
+  // ProblemGenerator constructor; restarting on a different rank count involves no
+  // read-then-redistribute traffic.
   LoadBalance(cost_eachmb, rank_eachmb, gids_eachrank, nmb_eachrank, nmb_total);
 
   // create MeshBlockPack for this rank
@@ -454,7 +491,16 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile) {
   int mbp_gide = mbp_gids + nmb_eachrank[global_variable::my_rank] - 1;
   nmb_thisrank = nmb_eachrank[global_variable::my_rank];
 
+  // see comments on <mesh>/nmb_packs_per_rank in BuildTreeFromScratch()
+  nmb_packs_thisrank = pin->GetOrAddInteger("mesh", "nmb_packs_per_rank", 1);
+  if (nmb_packs_thisrank != 1) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "<mesh>/nmb_packs_per_rank=" << nmb_packs_thisrank
+       << " is not yet supported; only 1 MeshBlockPack per rank allowed" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
   pmb_pack = new MeshBlockPack(this, mbp_gids, mbp_gide);
+  pmb_packs.push_back(pmb_pack);
   pmb_pack->AddMeshBlocks(pin);
   pmb_pack->pmb->SetNeighbors(ptree, rank_eachmb);
 
@@ -486,5 +532,7 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile) {
 
   // set remaining parameters, output diagnostics
   cfl_no = pin->GetReal("time", "cfl_number");
+  async_dt = pin->GetOrAddBoolean("time", "async_dt", false);
+  async_dt_safety = pin->GetOrAddReal("time", "async_dt_safety", 0.9);
   if (global_variable::my_rank == 0) {PrintMeshDiagnostics();}
 }
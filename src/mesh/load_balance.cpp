@@ -10,7 +10,9 @@
 #include <iostream>
 #include <limits> // numeric_limits<>
 #include <algorithm> // max
+#include <cstdint> // int64_t
 #include <utility> // make_pair
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -18,6 +20,7 @@
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
 #include "z4c/z4c.hpp"
+#include "utils/grow_view.hpp"
 
 #if MPI_PARALLEL_ENABLED
 #include <mpi.h>
@@ -124,15 +127,6 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
       }
     }
   }
-  if (nmb_recv == 0) return;  // nothing to do
-
-  // allocate array of recv buffers
-  Kokkos::realloc(recvbuf, nmb_recv);
-  recv_req = new MPI_Request[nmb_recv];
-  for (int n=0; n<nmb_recv; ++n) {
-    recv_req[n] = MPI_REQUEST_NULL;
-  }
-
   // count number of cell- and face-centered variables communicated depending on physics
   int ncc_tosend=0, nfc_tosend=0;
   if (pmy_mesh->pmb_pack->phydro != nullptr) {
@@ -146,6 +140,20 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
     ncc_tosend += (pmy_mesh->pmb_pack->pz4c->nz4c);
   }
 
+  // partition the transfers of this regrid into waves when a staging budget is set
+  // (single wave otherwise).  Must run even on ranks that only send, so it precedes
+  // the nothing-to-receive early return below
+  ComputeLBWaves(nleaf, ncc_tosend, nfc_tosend);
+
+  if (nmb_recv == 0) return;  // nothing to do
+
+  // allocate array of recv buffers (grow-only, with headroom for future regrids)
+  GrowView(recvbuf, nmb_recv);
+  recv_req = new MPI_Request[nmb_recv];
+  for (int n=0; n<nmb_recv; ++n) {
+    recv_req[n] = MPI_REQUEST_NULL;
+  }
+
   // Step 2. (InitRecvAMR)
   // loop over new MBs on this rank, initialize recv buffers
   auto &indcs = pmy_mesh->mb_indcs;
@@ -195,6 +203,9 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
                                          nfc_tosend*(recvbuf.h_view(rb_idx).cntfc);
           recvbuf.h_view(rb_idx).lid   = newm - nmbs;
           recvbuf.h_view(rb_idx).use_coarse = false;
+          // store sending rank and tag (using local ID of *receiving* MeshBlock)
+          recvbuf.h_view(rb_idx).trank = pmy_mesh->rank_eachmb[oldm+l];
+          recvbuf.h_view(rb_idx).tag   = CreateAMR_MPI_Tag(newm-nmbs, ox1, ox2, ox3);
           if (rb_idx > 0) {
             recvbuf.h_view(rb_idx).offset = recvbuf.h_view((rb_idx-1)).offset +
                                              recvbuf.h_view((rb_idx-1)).cnt;
@@ -218,6 +229,8 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
                                      nfc_tosend*(recvbuf.h_view(rb_idx).cntfc);
         recvbuf.h_view(rb_idx).lid = newm - nmbs;
         recvbuf.h_view(rb_idx).use_coarse = false;
+        recvbuf.h_view(rb_idx).trank = pmy_mesh->rank_eachmb[oldm];
+        recvbuf.h_view(rb_idx).tag   = CreateAMR_MPI_Tag(newm-nmbs, 0, 0, 0);
         if (rb_idx > 0) {
           recvbuf.h_view(rb_idx).offset = recvbuf.h_view((rb_idx-1)).offset +
                                           recvbuf.h_view((rb_idx-1)).cnt;
@@ -243,6 +256,8 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
                                      nfc_tosend*(recvbuf.h_view(rb_idx).cntfc);
         recvbuf.h_view(rb_idx).lid = newm - nmbs;
         recvbuf.h_view(rb_idx).use_coarse = true;
+        recvbuf.h_view(rb_idx).trank = pmy_mesh->rank_eachmb[oldm];
+        recvbuf.h_view(rb_idx).tag   = CreateAMR_MPI_Tag(newm-nmbs, 0, 0, 0);
         if (rb_idx > 0) {
           recvbuf.h_view(rb_idx).offset = recvbuf.h_view((rb_idx-1)).offset +
                                           recvbuf.h_view((rb_idx-1)).cnt;
@@ -253,82 +268,177 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
       }
     }
   }
-  // Sync dual array, reallocate receive data array
+  // Sync dual array, reallocate receive data array: the whole volume with a single
+  // wave, otherwise the largest wave plus a pinned host holding area for the rest
   recvbuf.template modify<HostMemSpace>();
   recvbuf.template sync<DevExeSpace>();
-  {
+  if (lb_nwaves == 1) {
     int ndata = recvbuf.h_view((nmb_recv-1)).offset + recvbuf.h_view((nmb_recv-1)).cnt;
-    Kokkos::realloc(recv_data, ndata);
+    GrowView(recv_data, ndata);
+  } else {
+    GrowView(recv_data, lb_recv_wmax+1);
+    if (static_cast<int>(recv_hold.extent(0)) < lb_recv_total) {
+      Kokkos::realloc(recv_hold, lb_recv_total);
+    }
   }
 
   // Step 3. (InitRecvAMR)
-  // loop over new MBs on this rank, post non-blocking recvs
+  // post non-blocking recvs for the first wave (= every transfer with a single wave)
   // Receive requests will only be accessed on host, so no need to sync after this step.
-  rb_idx = 0;   // recv buffer index
+  PostRecvAMRWave(0);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::PostRecvAMRWave()
+//! \brief Posts non-blocking receives for one wave of load balancing transfers, using
+//! the sender rank and tag stored in the receive buffer metadata by InitRecvAMR().  With
+//! a single wave this covers all of recv_data; with bounded staging the wave's data
+//! offsets are rebased so each wave starts at the beginning of the staging array.
+
+void MeshRefinement::PostRecvAMRWave(int w) {
+#if MPI_PARALLEL_ENABLED
+  int rbs = 0, rbe = nmb_recv;
+  if (lb_nwaves > 1) {
+    rbs = lb_recv_wstart[w];
+    rbe = lb_recv_wstart[w+1];
+  }
+  if (rbe == rbs) return;  // nothing received in this wave
+  int base = (lb_nwaves == 1)? 0 : recvbuf.h_view(rbs).offset;
   bool no_errors=true;
-  for (int newm=nmbs; newm<=nmbe; newm++) {
+  for (int n=rbs; n<rbe; ++n) {
+    int vs = recvbuf.h_view(n).offset - base;
+    int ve = vs + recvbuf.h_view(n).cnt + 1;
+    auto pdata = Kokkos::subview(recv_data, std::make_pair(vs,ve));
+    // post non-blocking receive
+    int ierr = MPI_Irecv(pdata.data(), recvbuf.h_view(n).cnt, MPI_ATHENA_REAL,
+               recvbuf.h_view(n).trank, recvbuf.h_view(n).tag, amr_comm,
+               &(recv_req[n]));
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+  }
+
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in posting non-blocking receives with AMR" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::ComputeLBWaves()
+//! \brief Partitions the load balancing transfers of this regrid into waves whose send
+//! and receive staging both fit within the <mesh_refinement>/amr_staging_mb budget on
+//! every rank (a single transfer larger than the budget gets a wave of its own).  The
+//! transfer list, sizes, and endpoints are all derivable from the replicated old/new
+//! tree maps, so every rank walks the same global list in the same (Z-)order and arrives
+//! at the same wave assignment without communication.  Records, for this rank, the range
+//! of send/recv buffer indices in each wave plus the staging sizes needed.  With no
+//! budget set, this reduces to a single wave covering every transfer.
+
+void MeshRefinement::ComputeLBWaves(int nleaf, int ncc, int nfc) {
+#if MPI_PARALLEL_ENABLED
+  lb_nwaves = 1;
+  if (amr_staging_count <= 0) return;   // unbounded staging: single wave
+
+  // per-transfer element counts for the three cases, matching the cnt fields computed
+  // by InitRecvAMR()/PackAndSendAMR()
+  auto &indcs = pmy_mesh->mb_indcs;
+  auto &cnx1 = indcs.cnx1, &cnx2 = indcs.cnx2, &cnx3 = indcs.cnx3;
+  auto &nx1 = indcs.nx1, &nx2 = indcs.nx2, &nx3 = indcs.nx3;
+  auto &ng = indcs.ng;
+  // same level: whole fine MB without ghost zones
+  std::int64_t cnt_same = ncc*(nx1*nx2*nx3) +
+                          nfc*(3*nx1*nx2*nx3 + nx2*nx3 + nx1*nx3 + nx1*nx2);
+  // de-refined leaf: coarse array without ghost zones
+  std::int64_t cnt_coar = ncc*(cnx1*cnx2*cnx3) +
+                          nfc*(3*cnx1*cnx2*cnx3 + cnx2*cnx3 + cnx1*cnx3 + cnx1*cnx2);
+  // refined MB: coarse array including ghost zones in each active dimension
+  int ni = cnx1 + 2*ng;
+  int nj = cnx2 + ((pmy_mesh->multi_d)? 2*ng : 0);
+  int nk = cnx3 + ((pmy_mesh->three_d)? 2*ng : 0);
+  std::int64_t cnt_fine = ncc*(ni*nj*nk) +
+                          nfc*((ni+1)*nj*nk + ni*(nj+1)*nk + ni*nj*(nk+1));
+
+  const std::int64_t budget = amr_staging_count;
+  const int me = global_variable::my_rank;
+  std::vector<std::int64_t> sacc(global_variable::nranks, 0);
+  std::vector<std::int64_t> racc(global_variable::nranks, 0);
+  int isend = 0, irecv = 0;   // this rank's running send/recv buffer indices
+  lb_send_wstart.assign(1, 0);
+  lb_recv_wstart.assign(1, 0);
+  lb_send_wmax = 0;
+  lb_recv_wmax = 0;
+  lb_recv_total = 0;
+  int wave = 0;
+
+  // appends one transfer to the current wave, closing it first (on every rank, since
+  // waves are global) whenever the budget would be exceeded on sender or receiver
+  auto place = [&](int src, int dst, std::int64_t cnt) {
+    if ((sacc[src] + cnt > budget) || (racc[dst] + cnt > budget)) {
+      std::fill(sacc.begin(), sacc.end(), 0);
+      std::fill(racc.begin(), racc.end(), 0);
+      wave++;
+      lb_send_wstart.push_back(isend);
+      lb_recv_wstart.push_back(irecv);
+    }
+    sacc[src] += cnt;
+    racc[dst] += cnt;
+    if (src == me) {
+      isend++;
+      lb_send_wmax = std::max(lb_send_wmax, static_cast<int>(sacc[src]));
+    }
+    if (dst == me) {
+      irecv++;
+      lb_recv_wmax = std::max(lb_recv_wmax, static_cast<int>(racc[dst]));
+      lb_recv_total += static_cast<int>(cnt);
+    }
+  };
+
+  // walk global list of new MBs in Z-order; mirrors the per-rank enumeration loops in
+  // InitRecvAMR()/PackAndSendAMR() so per-wave buffer indices are contiguous ranges
+  int new_nmb_tot = new_gids_eachrank[global_variable::nranks-1] +
+                    new_nmb_eachrank[global_variable::nranks-1];
+  for (int newm=0; newm<new_nmb_tot; newm++) {
     int oldm = newtoold[newm];
     LogicalLocation &old_lloc = pmy_mesh->lloc_eachmb[oldm];
     LogicalLocation &new_lloc = new_lloc_eachmb[newm];
-    if (old_lloc.level > new_lloc.level) {        // old MB was de-refined
+    int dst = new_rank_eachmb[newm];
+    if (old_lloc.level > new_lloc.level) {          // old MB was de-refined
       for (int l=0; l<nleaf; l++) {
-        // recv whenever root MB changes rank, or if any leaf on different rank than root
-        if ((pmy_mesh->rank_eachmb[oldm] != global_variable::my_rank) ||
-            (pmy_mesh->rank_eachmb[oldm+l] != global_variable::my_rank)) {
-          LogicalLocation &lloc = pmy_mesh->lloc_eachmb[oldm+l];
-          int ox1 = ((lloc.lx1 & 1) == 1);
-          int ox2 = ((lloc.lx2 & 1) == 1);
-          int ox3 = ((lloc.lx3 & 1) == 1);
-          int vs = recvbuf.h_view(rb_idx).offset;
-          int ve = vs + recvbuf.h_view(rb_idx).cnt + 1;
-          auto pdata = Kokkos::subview(recv_data, std::make_pair(vs,ve));
-          // create tag using local ID of *receiving* MeshBlock, post receive
-          int tag = CreateAMR_MPI_Tag(newm-nmbs, ox1, ox2, ox3);
-          // post non-blocking receive
-          int ierr = MPI_Irecv(pdata.data(), recvbuf.h_view(rb_idx).cnt,
-                     MPI_ATHENA_REAL, pmy_mesh->rank_eachmb[oldm+l], tag, amr_comm,
-                     &(recv_req[rb_idx]));
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          rb_idx++;
+        int src = pmy_mesh->rank_eachmb[oldm+l];
+        // sent whenever root MB changes rank, or any leaf on different rank than root
+        if ((pmy_mesh->rank_eachmb[oldm] != dst) || (src != dst)) {
+          place(src, dst, cnt_coar);
         }
       }
-    } else if (old_lloc.level == new_lloc.level) {   // old MB at same level
-      if (pmy_mesh->rank_eachmb[oldm] != global_variable::my_rank) {
-        int vs = recvbuf.h_view(rb_idx).offset;
-        int ve = vs + recvbuf.h_view(rb_idx).cnt + 1;
-        auto pdata = Kokkos::subview(recv_data, std::make_pair(vs,ve));
-        // create tag using local ID of *receiving* MeshBlock, post receive
-        int tag = CreateAMR_MPI_Tag(newm-nmbs, 0, 0, 0);
-        // post non-blocking receive
-        int ierr = MPI_Irecv(pdata.data(), recvbuf.h_view(rb_idx).cnt, MPI_ATHENA_REAL,
-                   pmy_mesh->rank_eachmb[oldm], tag, amr_comm,
-                   &(recv_req[rb_idx]));
-        if (ierr != MPI_SUCCESS) {no_errors=false;}
-        rb_idx++;
+    } else if (old_lloc.level == new_lloc.level) {  // old MB at same level
+      int src = pmy_mesh->rank_eachmb[oldm];
+      if (src != dst) {
+        place(src, dst, cnt_same);
       }
     } else {                                        // old MB was refined
-      // recv whenever refined MB changes rank, or if any leaf on different rank than root
-      if ((new_rank_eachmb[oldtonew[oldm]] != global_variable::my_rank) ||
-          (pmy_mesh->rank_eachmb[oldm] != global_variable::my_rank)) {
-        int vs = recvbuf.h_view(rb_idx).offset;
-        int ve = vs + recvbuf.h_view(rb_idx).cnt + 1;
-        auto pdata = Kokkos::subview(recv_data, std::make_pair(vs,ve));
-        // create tag using local ID of *receiving* MeshBlock, post receive
-        int tag = CreateAMR_MPI_Tag(newm-nmbs, 0, 0, 0);
-        // post non-blocking receive
-        int ierr = MPI_Irecv(pdata.data(), recvbuf.h_view(rb_idx).cnt, MPI_ATHENA_REAL,
-                   pmy_mesh->rank_eachmb[oldm], tag, amr_comm,
-                   &(recv_req[rb_idx]));
-        if (ierr != MPI_SUCCESS) {no_errors=false;}
-        rb_idx++;
+      int src = pmy_mesh->rank_eachmb[oldm];
+      // sent whenever refined MB changes rank, or any leaf on different rank than root
+      if ((new_rank_eachmb[oldtonew[oldm]] != dst) || (src != dst)) {
+        place(src, dst, cnt_fine);
       }
     }
   }
+  lb_nwaves = wave + 1;
+  lb_send_wstart.push_back(isend);
+  lb_recv_wstart.push_back(irecv);
 
-  // Quit if MPI error detected
-  if (!(no_errors)) {
+  // the global walk must reproduce this rank's receive count exactly; anything else
+  // means the wave assignment has diverged from the buffer enumeration
+  if (irecv != nmb_recv) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-       << std::endl << "MPI error in posting non-blocking receives with AMR" << std::endl;
+              << std::endl << "AMR transfer wave assignment found " << irecv
+              << " receives on this rank but " << nmb_recv << " were enumerated"
+              << std::endl;
     std::exit(EXIT_FAILURE);
   }
 #endif
@@ -376,8 +486,8 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
 
   if (nmb_send == 0) return;  // nothing to do
 
-  // allocate array of send buffers
-  Kokkos::realloc(sendbuf, nmb_send);
+  // allocate array of send buffers (grow-only, with headroom for future regrids)
+  GrowView(sendbuf, nmb_send);
   send_req = new MPI_Request[nmb_send];
   for (int n=0; n<nmb_send; ++n) {
     send_req[n] = MPI_REQUEST_NULL;
@@ -445,6 +555,11 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
                                          nfc_tosend*(sendbuf.h_view(sb_idx).cntfc);
           sendbuf.h_view(sb_idx).lid   = oldm - ombs;
           sendbuf.h_view(sb_idx).use_coarse = false;
+          // store receiving rank and tag (using local ID of *receiving* MeshBlock)
+          int drank = new_rank_eachmb[newm+l];
+          sendbuf.h_view(sb_idx).trank = drank;
+          sendbuf.h_view(sb_idx).tag =
+              CreateAMR_MPI_Tag((newm+l) - new_gids_eachrank[drank], 0, 0, 0);
           if (sb_idx > 0) {
             sendbuf.h_view(sb_idx).offset = sendbuf.h_view((sb_idx-1)).offset +
                                             sendbuf.h_view((sb_idx-1)).cnt;
@@ -469,6 +584,10 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
                                        nfc_tosend*(sendbuf.h_view(sb_idx).cntfc);
           sendbuf.h_view(sb_idx).lid = oldm - ombs;
           sendbuf.h_view(sb_idx).use_coarse = false;
+          int drank = new_rank_eachmb[newm];
+          sendbuf.h_view(sb_idx).trank = drank;
+          sendbuf.h_view(sb_idx).tag =
+              CreateAMR_MPI_Tag(newm - new_gids_eachrank[drank], 0, 0, 0);
           if (sb_idx > 0) {
             sendbuf.h_view(sb_idx).offset = sendbuf.h_view((sb_idx-1)).offset +
                                             sendbuf.h_view((sb_idx-1)).cnt;
@@ -494,6 +613,13 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
           sendbuf.h_view(sb_idx).cnt = ncc_tosend*(sendbuf.h_view(sb_idx).cntcc) +
                                        nfc_tosend*(sendbuf.h_view(sb_idx).cntfc);
           sendbuf.h_view(sb_idx).lid = oldm - ombs;
+          int drank = new_rank_eachmb[newm];
+          int ox1 = ((old_lloc.lx1 & 1) == 1);
+          int ox2 = ((old_lloc.lx2 & 1) == 1);
+          int ox3 = ((old_lloc.lx3 & 1) == 1);
+          sendbuf.h_view(sb_idx).trank = drank;
+          sendbuf.h_view(sb_idx).tag =
+              CreateAMR_MPI_Tag(newm - new_gids_eachrank[drank], ox1, ox2, ox3);
           if (sb_idx > 0) {
             sendbuf.h_view(sb_idx).offset = sendbuf.h_view((sb_idx-1)).offset +
                                             sendbuf.h_view((sb_idx-1)).cnt;
@@ -505,15 +631,50 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
       }
     }
   }
-  // Sync dual array, reallocate send data array
+  // Sync dual array, reallocate send data array: the whole volume with a single wave,
+  // otherwise the largest wave (device staging is reused wave by wave)
   sendbuf.template modify<HostMemSpace>();
   sendbuf.template sync<DevExeSpace>();
-  {
+  if (lb_nwaves == 1) {
     int ndata = sendbuf.h_view((nmb_send-1)).offset + sendbuf.h_view((nmb_send-1)).cnt;
-    Kokkos::realloc(send_data, ndata);
+    GrowView(send_data, ndata);
+  } else {
+    GrowView(send_data, lb_send_wmax+1);
+    // the global wave walk must reproduce this rank's send count exactly; anything
+    // else means the wave assignment has diverged from the buffer enumeration
+    if (lb_send_wstart[lb_nwaves] != nmb_send) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "AMR transfer wave assignment found "
+                << lb_send_wstart[lb_nwaves] << " sends on this rank but " << nmb_send
+                << " were enumerated" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
   }
 
-  // Step 3. (PackAndSendAMR)
+  // Steps 3-4. (PackAndSendAMR)
+  // Pack and send the first wave (= every transfer with a single wave)
+  PackAndSendAMRWave(0);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::PackAndSendAMRWave()
+//! \brief Packs and sends one wave of load balancing transfers, using the receiver rank
+//! and tag stored in the send buffer metadata by PackAndSendAMR().  With bounded staging
+//! the wave's data offsets are rebased so each wave starts at the beginning of the
+//! (reused) staging array.  Send requests are only accessed on host, so no sync needed.
+
+void MeshRefinement::PackAndSendAMRWave(int w) {
+#if MPI_PARALLEL_ENABLED
+  int sbs = 0, sbe = nmb_send;
+  if (lb_nwaves > 1) {
+    sbs = lb_send_wstart[w];
+    sbe = lb_send_wstart[w+1];
+  }
+  if (sbe == sbs) return;  // nothing sent in this wave
+  int base = (lb_nwaves == 1)? 0 : sendbuf.h_view(sbs).offset;
+
   // Pack data into send buffers in parallel
   hydro::Hydro* phydro = pmy_mesh->pmb_pack->phydro;
   mhd::MHD* pmhd = pmy_mesh->pmb_pack->pmhd;
@@ -521,93 +682,89 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
 
   int ncc_sent = 0, nfc_sent = 0;
   if (phydro != nullptr) {
-    PackAMRBuffersCC(phydro->u0, phydro->coarse_u0, ncc_sent, nfc_sent);
+    PackAMRBuffersCC(phydro->u0, phydro->coarse_u0, ncc_sent, nfc_sent, sbs, sbe, base);
     ncc_sent += phydro->nhydro;
   }
   if (pmhd != nullptr) {
-    PackAMRBuffersCC(pmhd->u0, pmhd->coarse_u0, ncc_sent, nfc_sent);
+    PackAMRBuffersCC(pmhd->u0, pmhd->coarse_u0, ncc_sent, nfc_sent, sbs, sbe, base);
     ncc_sent += pmhd->nmhd;
-    PackAMRBuffersFC(pmhd->b0, pmhd->coarse_b0, ncc_sent, nfc_sent);
+    PackAMRBuffersFC(pmhd->b0, pmhd->coarse_b0, ncc_sent, nfc_sent, sbs, sbe, base);
     nfc_sent += 1;
   }
   if (pz4c != nullptr) {
-    PackAMRBuffersCC(pz4c->u0, pz4c->coarse_u0, ncc_sent, nfc_sent);
+    PackAMRBuffersCC(pz4c->u0, pz4c->coarse_u0, ncc_sent, nfc_sent, sbs, sbe, base);
     ncc_sent += pz4c->nz4c;
   }
 
-  // Step 4. (PackAndSendAMR)
-  // loop over old MBs on this rank, send data using MPI non-blocking sends
-  // Send requests will only be accessed on host, so no need to sync after this step.
+  // send data using MPI non-blocking sends
   Kokkos::fence();
   bool no_errors=true;
-  sb_idx = 0;     // send buffer index
-  for (int oldm=ombs; oldm<=ombe; oldm++) {
-    int newm = oldtonew[oldm];
-    LogicalLocation &old_lloc = pmy_mesh->lloc_eachmb[oldm];
-    LogicalLocation &new_lloc = new_lloc_eachmb[newm];
-    if (old_lloc.level < new_lloc.level) {      // old MB was refined
-      for (int l=0; l<nleaf; l++) {
-        // send if refined MB changes rank, or if any leaf on different rank than root
-        if ((new_rank_eachmb[newm] != global_variable::my_rank) ||
-            (new_rank_eachmb[newm + l] != global_variable::my_rank)) {
-          int vs = sendbuf.h_view(sb_idx).offset;
-          int ve = vs + sendbuf.h_view(sb_idx).cnt + 1;
-          auto pdata = Kokkos::subview(send_data, std::make_pair(vs,ve));
-          // create tag using local ID of *receiving* MeshBlock
-          int lid = (newm + l) - new_gids_eachrank[new_rank_eachmb[newm+l]];
-          int tag = CreateAMR_MPI_Tag(lid, 0, 0, 0);
-          // post non-blocking send
-          int ierr = MPI_Isend(pdata.data(), sendbuf.h_view(sb_idx).cnt, MPI_ATHENA_REAL,
-                     new_rank_eachmb[newm+l], tag, amr_comm,
-                     &(send_req[sb_idx]));
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          sb_idx++;
-        }
-      }
-    } else {   // same level or de-refinement
-      if (old_lloc.level == new_lloc.level) {   // old MB at same level
-        if (new_rank_eachmb[newm] != global_variable::my_rank) {
-          int vs = sendbuf.h_view(sb_idx).offset;
-          int ve = vs + sendbuf.h_view(sb_idx).cnt + 1;
-          auto pdata = Kokkos::subview(send_data, std::make_pair(vs,ve));
-          // create tag using local ID of *receiving* MeshBlock
-          int lid = newm - new_gids_eachrank[new_rank_eachmb[newm]];
-          int tag = CreateAMR_MPI_Tag(lid, 0, 0, 0);
-          // post non-blocking send
-          int ierr = MPI_Isend(pdata.data(), sendbuf.h_view(sb_idx).cnt, MPI_ATHENA_REAL,
-                     new_rank_eachmb[newm], tag, amr_comm,
-                     &(send_req[sb_idx]));
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          sb_idx++;
-        }
-      } else {                                  // old MB was de-refined
-        // send whenever root MB changes rank, or if any leaf on different rank than root
-        if ((pmy_mesh->rank_eachmb[newtoold[newm]] != global_variable::my_rank) ||
-            (new_rank_eachmb[newm] != global_variable::my_rank)) {
-          int vs = sendbuf.h_view(sb_idx).offset;
-          int ve = vs + sendbuf.h_view(sb_idx).cnt + 1;
-          auto pdata = Kokkos::subview(send_data, std::make_pair(vs,ve));
-          // create tag using local ID of *receiving* MeshBlock
-          int ox1 = ((old_lloc.lx1 & 1) == 1);
-          int ox2 = ((old_lloc.lx2 & 1) == 1);
-          int ox3 = ((old_lloc.lx3 & 1) == 1);
-          int lid = newm - new_gids_eachrank[new_rank_eachmb[newm]];
-          int tag = CreateAMR_MPI_Tag(lid, ox1, ox2, ox3);
-          // post non-blocking send
-          int ierr = MPI_Isend(pdata.data(), sendbuf.h_view(sb_idx).cnt, MPI_ATHENA_REAL,
-                     new_rank_eachmb[newm], tag, amr_comm,
-                     &(send_req[sb_idx]));
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          sb_idx++;
-        }
-      }
+  for (int n=sbs; n<sbe; ++n) {
+    int vs = sendbuf.h_view(n).offset - base;
+    int ve = vs + sendbuf.h_view(n).cnt + 1;
+    auto pdata = Kokkos::subview(send_data, std::make_pair(vs,ve));
+    // post non-blocking send
+    int ierr = MPI_Isend(pdata.data(), sendbuf.h_view(n).cnt, MPI_ATHENA_REAL,
+               sendbuf.h_view(n).trank, sendbuf.h_view(n).tag, amr_comm,
+               &(send_req[n]));
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+  }
+
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "MPI error in posting non-blocking sends with AMR"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::DrainAMRWaves()
+//! \brief With bounded staging, completes the remaining waves of load balancing
+//! transfers: received data is parked in the pinned host holding area so the device
+//! receive staging can be reused, and each wave's sends are completed before the send
+//! staging is repacked for the next wave.  Must be called before any local data moves,
+//! since later waves pack from the unmodified old arrays.  No-op with a single wave.
+//! The wave schedule cannot deadlock: a rank posts its receives for wave w before
+//! waiting on anything in wave w, so by induction over waves every send can complete.
+
+void MeshRefinement::DrainAMRWaves() {
+#if MPI_PARALLEL_ENABLED
+  if (lb_nwaves <= 1) return;
+  bool no_errors=true;
+  for (int w=0; w<lb_nwaves; ++w) {
+    // wait for this wave's receives, then park the data in the pinned holding area
+    int rbs = lb_recv_wstart[w], rbe = lb_recv_wstart[w+1];
+    for (int n=rbs; n<rbe; ++n) {
+      int ierr = MPI_Wait(&(recv_req[n]), MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    }
+    if (rbe > rbs) {
+      int base = recvbuf.h_view(rbs).offset;
+      int len = recvbuf.h_view(rbe-1).offset + recvbuf.h_view(rbe-1).cnt - base;
+      auto hold = Kokkos::subview(recv_hold, std::make_pair(base, base+len));
+      auto stag = Kokkos::subview(recv_data, std::make_pair(0, len));
+      Kokkos::deep_copy(hold, stag);
+    }
+    // wait for this wave's sends to complete so the send staging can be reused
+    for (int n=lb_send_wstart[w]; n<lb_send_wstart[w+1]; ++n) {
+      int ierr = MPI_Wait(&(send_req[n]), MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    }
+    // post receives and pack/send the next wave
+    if ((w+1) < lb_nwaves) {
+      PostRecvAMRWave(w+1);
+      PackAndSendAMRWave(w+1);
     }
   }
 
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl << "MPI error in posting non-blocking receives with AMR"
+              << std::endl << "MPI error while draining chunked AMR transfer waves"
               << std::endl;
     std::exit(EXIT_FAILURE);
   }
@@ -622,17 +779,18 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
 //! PrepareSendFineToCoarseAMR() functions in amr_loadbalance.cpp
 
 void MeshRefinement::PackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
-                                      int ncc, int nfc) {
+                                      int ncc, int nfc, int nbs, int nbe, int base) {
 #if MPI_PARALLEL_ENABLED
+  if (nbe < 0) {nbe = nmb_send;}
   auto &sbuf = sendbuf;
   auto &sdata = send_data;
-  // Outer loop over (# of MeshBlocks sent)*(# of variables)
+  // Outer loop over (# of MeshBlocks sent in wave)*(# of variables)
   int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
-  int nnv = nmb_send*nvar;
+  int nnv = (nbe - nbs)*nvar;
   Kokkos::TeamPolicy<> policy(DevExeSpace(), nnv, Kokkos::AUTO);
   Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int n = (tmember.league_rank())/nvar;
-    const int v = (tmember.league_rank() - n*nvar);
+    const int n = nbs + (tmember.league_rank())/nvar;
+    const int v = (tmember.league_rank() - (n-nbs)*nvar);
 
     const int il = sbuf.d_view(n).bis;
     const int jl = sbuf.d_view(n).bjs;
@@ -643,7 +801,7 @@ void MeshRefinement::PackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &c
     const int nkji = nk*nj*ni;
     const int nji  = nj*ni;
     const int m  = sbuf.d_view(n).lid;
-    const int offset = sbuf.d_view(n).offset +
+    const int offset = sbuf.d_view(n).offset - base +
                        (ncc*sbuf.d_view(n).cntcc + nfc*sbuf.d_view(n).cntfc);
 
     // Middle loop over k,j,i
@@ -671,16 +829,17 @@ void MeshRefinement::PackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &c
 //! \brief Packs face-centered data into AMR communication buffers for all MBs being sent
 
 void MeshRefinement::PackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb,
-                                      int ncc, int nfc) {
+                                      int ncc, int nfc, int nbs, int nbe, int base) {
 #if MPI_PARALLEL_ENABLED
+  if (nbe < 0) {nbe = nmb_send;}
   auto &sbuf = sendbuf;
   auto &sdata = send_data;
-  // Outer loop over (# of MeshBlocks sent)*(3 compnts of field)
-  int nn = 3*nmb_send;
+  // Outer loop over (# of MeshBlocks sent in wave)*(3 compnts of field)
+  int nn = 3*(nbe - nbs);
   Kokkos::TeamPolicy<> policy(DevExeSpace(), nn, Kokkos::AUTO);
   Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int n = (tmember.league_rank())/3;
-    const int v = (tmember.league_rank() - 3*n);
+    const int n = nbs + (tmember.league_rank())/3;
+    const int v = (tmember.league_rank() - 3*(n-nbs));
 
     const int il = sbuf.d_view(n).bis;
     const int jl = sbuf.d_view(n).bjs;
@@ -692,7 +851,7 @@ void MeshRefinement::PackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real
 
     // pack x1 component
     if (v==0) {
-      const int offset = sbuf.d_view(n).offset +
+      const int offset = sbuf.d_view(n).offset - base +
                          (ncc*sbuf.d_view(n).cntcc + nfc*sbuf.d_view(n).cntfc);
       const int ni = nicc + 1;  // add b.x1f at (ie+1)
       const int nj = njcc;
@@ -718,7 +877,7 @@ void MeshRefinement::PackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real
 
     // pack x2 component
     } else if (v==1) {
-      const int offset = sbuf.d_view(n).offset +
+      const int offset = sbuf.d_view(n).offset - base +
                          (ncc*sbuf.d_view(n).cntcc + nfc*sbuf.d_view(n).cntfc) +
                          (nicc+1)*njcc*nkcc;
       const int ni = nicc;
@@ -745,7 +904,7 @@ void MeshRefinement::PackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real
 
     // pack x3 component
     } else {
-      const int offset = sbuf.d_view(n).offset +
+      const int offset = sbuf.d_view(n).offset - base +
                          (ncc*sbuf.d_view(n).cntcc + nfc*sbuf.d_view(n).cntfc) +
                          (nicc+1)*njcc*nkcc + nicc*(njcc+1)*nkcc;
       const int ni = nicc;
@@ -803,21 +962,55 @@ void MeshRefinement::ClearRecvAndUnpackAMR() {
   mhd::MHD* pmhd = pmy_mesh->pmb_pack->pmhd;
   z4c::Z4c* pz4c = pmy_mesh->pmb_pack->pz4c;
 
-  int ncc_recv=0, nfc_recv=0;
+  if (lb_nwaves == 1) {
+    int ncc_recv=0, nfc_recv=0;
 
-  if (phydro != nullptr) {
-    UnpackAMRBuffersCC(phydro->u0, phydro->coarse_u0, ncc_recv, nfc_recv);
-    ncc_recv += phydro->nhydro;
-  }
-  if (pmhd != nullptr) {
-    UnpackAMRBuffersCC(pmhd->u0, pmhd->coarse_u0, ncc_recv, nfc_recv);
-    ncc_recv += pmhd->nmhd;
-    UnpackAMRBuffersFC(pmhd->b0, pmhd->coarse_b0, ncc_recv, nfc_recv);
-    nfc_recv += 1;
-  }
-  if (pz4c != nullptr) {
-    UnpackAMRBuffersCC(pz4c->u0, pz4c->coarse_u0, ncc_recv, nfc_recv);
-    ncc_recv += pz4c->nz4c;
+    if (phydro != nullptr) {
+      UnpackAMRBuffersCC(phydro->u0, phydro->coarse_u0, ncc_recv, nfc_recv);
+      ncc_recv += phydro->nhydro;
+    }
+    if (pmhd != nullptr) {
+      UnpackAMRBuffersCC(pmhd->u0, pmhd->coarse_u0, ncc_recv, nfc_recv);
+      ncc_recv += pmhd->nmhd;
+      UnpackAMRBuffersFC(pmhd->b0, pmhd->coarse_b0, ncc_recv, nfc_recv);
+      nfc_recv += 1;
+    }
+    if (pz4c != nullptr) {
+      UnpackAMRBuffersCC(pz4c->u0, pz4c->coarse_u0, ncc_recv, nfc_recv);
+      ncc_recv += pz4c->nz4c;
+    }
+  } else {
+    // with bounded staging, replay each drained wave from the pinned host holding area
+    // through the (reused) device staging and unpack it
+    for (int w=0; w<lb_nwaves; ++w) {
+      int rbs = lb_recv_wstart[w], rbe = lb_recv_wstart[w+1];
+      if (rbe == rbs) {continue;}
+      int base = recvbuf.h_view(rbs).offset;
+      int len = recvbuf.h_view(rbe-1).offset + recvbuf.h_view(rbe-1).cnt - base;
+      auto hold = Kokkos::subview(recv_hold, std::make_pair(base, base+len));
+      auto stag = Kokkos::subview(recv_data, std::make_pair(0, len));
+      Kokkos::deep_copy(stag, hold);
+
+      int ncc_recv=0, nfc_recv=0;
+      if (phydro != nullptr) {
+        UnpackAMRBuffersCC(phydro->u0, phydro->coarse_u0, ncc_recv, nfc_recv,
+                           rbs, rbe, base);
+        ncc_recv += phydro->nhydro;
+      }
+      if (pmhd != nullptr) {
+        UnpackAMRBuffersCC(pmhd->u0, pmhd->coarse_u0, ncc_recv, nfc_recv,
+                           rbs, rbe, base);
+        ncc_recv += pmhd->nmhd;
+        UnpackAMRBuffersFC(pmhd->b0, pmhd->coarse_b0, ncc_recv, nfc_recv,
+                           rbs, rbe, base);
+        nfc_recv += 1;
+      }
+      if (pz4c != nullptr) {
+        UnpackAMRBuffersCC(pz4c->u0, pz4c->coarse_u0, ncc_recv, nfc_recv,
+                           rbs, rbe, base);
+        ncc_recv += pz4c->nz4c;
+      }
+    }
   }
 #endif
   return;
@@ -831,17 +1024,18 @@ void MeshRefinement::ClearRecvAndUnpackAMR() {
 //! FinishRecvFineToCoarseAMR() functions in amr_loadbalance.cpp
 
 void MeshRefinement::UnpackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
-                                        int ncc, int nfc) {
+                                        int ncc, int nfc, int nbs, int nbe, int base) {
 #if MPI_PARALLEL_ENABLED
+  if (nbe < 0) {nbe = nmb_recv;}
   auto &rbuf = recvbuf;
   auto &rdata = recv_data;
-  // Outer loop over (# of MeshBlocks recv)*(# of variables)
+  // Outer loop over (# of MeshBlocks recv in wave)*(# of variables)
   int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
-  int nnv = nmb_recv*nvar;
+  int nnv = (nbe - nbs)*nvar;
   Kokkos::TeamPolicy<> policy(DevExeSpace(), nnv, Kokkos::AUTO);
   Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int n = (tmember.league_rank())/nvar;
-    const int v = (tmember.league_rank() - n*nvar);
+    const int n = nbs + (tmember.league_rank())/nvar;
+    const int v = (tmember.league_rank() - (n-nbs)*nvar);
 
     const int il = rbuf.d_view(n).bis;
     const int jl = rbuf.d_view(n).bjs;
@@ -852,7 +1046,7 @@ void MeshRefinement::UnpackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real>
     const int nkji = nk*nj*ni;
     const int nji  = nj*ni;
     const int m  = rbuf.d_view(n).lid;
-    const int offset = rbuf.d_view(n).offset +
+    const int offset = rbuf.d_view(n).offset - base +
                        (ncc*rbuf.d_view(n).cntcc + nfc*rbuf.d_view(n).cntfc);
 
     // Middle loop over k,j,i
@@ -881,16 +1075,17 @@ void MeshRefinement::UnpackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real>
 //! coarse or fine arrays for all MBs received during load balancing.
 
 void MeshRefinement::UnpackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb,
-                                        int ncc, int nfc) {
+                                        int ncc, int nfc, int nbs, int nbe, int base) {
 #if MPI_PARALLEL_ENABLED
+  if (nbe < 0) {nbe = nmb_recv;}
   auto &rbuf = recvbuf;
   auto &rdata = recv_data;
-  // Outer loop over (# of MeshBlocks recv)*(3 compnts of field)
-  int nnv = 3*nmb_recv;
+  // Outer loop over (# of MeshBlocks recv in wave)*(3 compnts of field)
+  int nnv = 3*(nbe - nbs);
   Kokkos::TeamPolicy<> policy(DevExeSpace(), nnv, Kokkos::AUTO);
   Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int n = (tmember.league_rank())/3;
-    const int v = (tmember.league_rank() - n*3);
+    const int n = nbs + (tmember.league_rank())/3;
+    const int v = (tmember.league_rank() - (n-nbs)*3);
 
     const int il = rbuf.d_view(n).bis;
     const int jl = rbuf.d_view(n).bjs;
@@ -902,7 +1097,7 @@ void MeshRefinement::UnpackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Re
 
     // unpack x1 component
     if (v==0) {
-      const int offset = rbuf.d_view(n).offset +
+      const int offset = rbuf.d_view(n).offset - base +
                          (ncc*rbuf.d_view(n).cntcc + nfc*rbuf.d_view(n).cntfc);
       const int ni = nicc + 1;  // add b.x1f at (ie+1)
       const int nj = njcc;
@@ -928,7 +1123,7 @@ void MeshRefinement::UnpackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Re
 
     // unpack x2 component
     } else if (v==1) {
-      const int offset = rbuf.d_view(n).offset +
+      const int offset = rbuf.d_view(n).offset - base +
                          (ncc*rbuf.d_view(n).cntcc + nfc*rbuf.d_view(n).cntfc) +
                          (nicc+1)*njcc*nkcc;
       const int ni = nicc;
@@ -955,7 +1150,7 @@ void MeshRefinement::UnpackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Re
 
     // unpack x3 component
     } else {
-      const int offset = rbuf.d_view(n).offset +
+      const int offset = rbuf.d_view(n).offset - base +
                          (ncc*rbuf.d_view(n).cntcc + nfc*rbuf.d_view(n).cntfc) +
                          (nicc+1)*njcc*nkcc + nicc*(njcc+1)*nkcc;
       const int ni = nicc;
@@ -60,6 +60,11 @@ Mesh::Mesh(ParameterInput *pin) :
   mesh_size.x3min = pin->GetReal("mesh", "x3min");
   mesh_size.x3max = pin->GetReal("mesh", "x3max");
 
+  // device-resident event counters, accumulated with atomics inside kernels and
+  // drained by the event log output
+  ecounter_dvce = DvceArray1D<int>("ecounter_dvce", NEVENT_CTR);
+  Kokkos::deep_copy(ecounter_dvce, 0);
+
   mesh_indcs.ng  = pin->GetOrAddReal("mesh", "nghost", 2);
   mesh_indcs.nx1 = pin->GetInteger("mesh", "nx1");
   mesh_indcs.nx2 = pin->GetInteger("mesh", "nx2");
@@ -175,6 +180,23 @@ Mesh::Mesh(ParameterInput *pin) :
   multilevel = (adaptive || pin->GetString("mesh_refinement","refinement") == "static")
     ?  true : false;
 
+  // select space-filling curve used to order MeshBlocks (and hence rank partitions in
+  // LoadBalance).  Hilbert ordering gives more spatially compact partitions than the
+  // default Morton (Z-)ordering, reducing off-rank ghost zone traffic
+  {
+    std::string bord = pin->GetOrAddString("mesh", "block_ordering", "morton");
+    if (bord == "hilbert") {
+      hilbert_ordering = true;
+    } else if (bord == "morton") {
+      hilbert_ordering = false;
+    } else {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<mesh>/block_ordering = '" << bord
+                << "' not recognized, must be 'morton' or 'hilbert'" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+
   // FIXME: The shearing box is not currently compatible with SMR/AMR
   if (multilevel && pin->DoesBlockExist("shearing_box")) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
@@ -335,12 +357,19 @@ Mesh::Mesh(ParameterInput *pin) :
 // destructor
 
 Mesh::~Mesh() {
+#if MPI_PARALLEL_ENABLED
+  // complete any dt reduction still in flight before requests go out of scope
+  if (async_dt_pending_) {
+    MPI_Wait(&async_dt_req_, MPI_STATUS_IGNORE);
+    async_dt_pending_ = false;
+  }
+#endif
   delete [] cost_eachmb;
   delete [] rank_eachmb;
   delete [] lloc_eachmb;
   delete [] gids_eachrank;
   delete [] nmb_eachrank;
-  delete pmb_pack;
+  for (MeshBlockPack* ppack : pmb_packs) {delete ppack;}
   if (multilevel) {
     delete pmr;
   }
@@ -579,12 +608,12 @@ void Mesh::NewTimeStep(const Real tlim) {
   // Hydro timestep
   if (pmb_pack->phydro != nullptr) {
     dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->dtnew) );
-    // viscosity timestep
-    if (pmb_pack->phydro->pvisc != nullptr) {
+    // viscosity timestep (not a limit when diffusion is super-time-stepped)
+    if (pmb_pack->phydro->pvisc != nullptr && !sts_diffusion) {
       dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->pvisc->dtnew) );
     }
-    // thermal conduction timestep
-    if (pmb_pack->phydro->pcond != nullptr) {
+    // thermal conduction timestep (not a limit when diffusion is super-time-stepped)
+    if (pmb_pack->phydro->pcond != nullptr && !sts_diffusion) {
       dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->pcond->dtnew) );
     }
     // source terms timestep
@@ -593,16 +622,16 @@ void Mesh::NewTimeStep(const Real tlim) {
   // MHD timestep
   if (pmb_pack->pmhd != nullptr) {
     dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->dtnew) );
-    // viscosity timestep
-    if (pmb_pack->pmhd->pvisc != nullptr) {
+    // viscosity timestep (not a limit when diffusion is super-time-stepped)
+    if (pmb_pack->pmhd->pvisc != nullptr && !sts_diffusion) {
       dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->pvisc->dtnew) );
     }
-    // resistivity timestep
+    // resistivity timestep (remains explicit even with super-time-stepping)
     if (pmb_pack->pmhd->presist != nullptr) {
       dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->presist->dtnew) );
     }
-    // thermal conduction timestep
-    if (pmb_pack->pmhd->pcond != nullptr) {
+    // thermal conduction timestep (not a limit when diffusion is super-time-stepped)
+    if (pmb_pack->pmhd->pcond != nullptr && !sts_diffusion) {
       dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->pcond->dtnew) );
     }
     // source terms timestep
@@ -622,8 +651,40 @@ void Mesh::NewTimeStep(const Real tlim) {
   }
 
 #if MPI_PARALLEL_ENABLED
-  // get minimum dt over all MPI ranks
-  MPI_Allreduce(MPI_IN_PLACE, &dt, 1, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD);
+  if (async_dt) {
+    // Pipelined reduction: instead of blocking on an Allreduce every cycle, consume the
+    // result of the Iallreduce posted last cycle (scaled by a safety factor), and post
+    // a new Iallreduce over this cycle's local minimum for use next cycle.  All ranks
+    // apply the same factor to the same lagged global value, so dt stays identical
+    // across ranks.  If the dt actually used last cycle exceeded the true global
+    // minimum (dt dropped faster than the safety factor allows), count and warn.
+    Real dt_local = dt;
+    if (async_dt_pending_) {
+      MPI_Wait(&async_dt_req_, MPI_STATUS_IGNORE);  // normally already complete
+      async_dt_pending_ = false;
+      if (dtold > async_dt_min_) {
+        async_dt_nviol++;
+        if (global_variable::my_rank == 0) {
+          std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "async_dt: dt used last cycle (" << dtold << ") exceeded "
+            << "global min dt (" << async_dt_min_ << "); consider smaller "
+            << "<time>/async_dt_safety" << std::endl;
+        }
+      }
+      dt = (async_dt_safety)*(async_dt_min_);
+    } else {
+      // no reduction in flight (first cycle): fall back to a blocking reduction
+      MPI_Allreduce(MPI_IN_PLACE, &dt_local, 1, MPI_ATHENA_REAL, MPI_MIN,MPI_COMM_WORLD);
+      dt = dt_local;
+    }
+    async_dt_min_ = dt_local;
+    MPI_Iallreduce(MPI_IN_PLACE, &async_dt_min_, 1, MPI_ATHENA_REAL, MPI_MIN,
+                   MPI_COMM_WORLD, &async_dt_req_);
+    async_dt_pending_ = true;
+  } else {
+    // get minimum dt over all MPI ranks
+    MPI_Allreduce(MPI_IN_PLACE, &dt, 1, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD);
+  }
 #endif
 
   // limit last time step to stop at tlim *exactly*
@@ -638,8 +699,8 @@ void Mesh::NewTimeStep(const Real tlim) {
 void Mesh::AddCoordinatesAndPhysics(ParameterInput *pinput) {
   // cycle over MeshBlockPacks on this rank and add Coordinates and Physics
   for (int n=0; n<nmb_packs_thisrank; ++n) {
-    pmb_pack->AddCoordinates(pinput);
-    pmb_pack->AddPhysics(pinput);
+    pmb_packs[n]->AddCoordinates(pinput);
+    pmb_packs[n]->AddPhysics(pinput);
   }
 
   // Determine total number of particles across all ranks
@@ -647,7 +708,7 @@ void Mesh::AddCoordinatesAndPhysics(ParameterInput *pinput) {
   if (ppart != nullptr) {
     nprtcl_thisrank = 0;
     for (int n=0; n<nmb_packs_thisrank; ++n) {
-      nprtcl_thisrank += pmb_pack->ppart->nprtcl_thispack;
+      nprtcl_thisrank += pmb_packs[n]->ppart->nprtcl_thispack;
     }
     nprtcl_eachrank = new int[global_variable::nranks];
     nprtcl_eachrank[global_variable::my_rank] = nprtcl_thisrank;
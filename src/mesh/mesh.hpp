@@ -14,6 +14,7 @@
 #include <cstdint>  // int32_t
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 
@@ -74,6 +75,13 @@ struct EventCounters {
                     neos_vceil(0), neos_fail(0), maxit_c2p(0) {}
 };
 
+// slots in the device-resident event counter array (Mesh::ecounter_dvce).  Kernels
+// accumulate into these slots with atomics as floors/ceilings are applied, so no
+// per-launch reduction or host synchronization is needed; the event log drains the
+// array into EventCounters at output time.  All slots sum except ECMAXIT (max).
+enum EventCounterIndex {ECNFOFC=0, ECDFLOOR=1, ECEFLOOR=2, ECTFLOOR=3, ECVCEIL=4,
+                        ECFAIL=5, ECMAXIT=6, NEVENT_CTR=7};
+
 // Forward declarations required due to recursive definitions amongst mesh classes
 class MeshBlock;
 class MeshBlockPack;
@@ -115,6 +123,7 @@ class Mesh {
   bool multi_d;               // flag to indicate 2D and 3D calculations
   bool multilevel;            // true for SMR and AMR
   bool adaptive;              // true only for AMR
+  bool hilbert_ordering;      // order MBs along Hilbert (instead of Morton) curve
 
   int nmb_rootx1, nmb_rootx2, nmb_rootx3; // # of MeshBlocks at root level in each dir
   int nmb_total;           // total number of MeshBlocks across all levels/ranks
@@ -140,10 +149,24 @@ class Mesh {
 
   Real time, dt, dtold, cfl_no;
   int ncycle;
+  // true when viscosity/conduction are advanced by the super-time-stepping scheme in
+  // the Driver (<time>/sts=true); their stability limits are then excluded from dt
+  bool sts_diffusion=false;
   EventCounters ecounter;
+  DvceArray1D<int> ecounter_dvce;  // device counters, see EventCounterIndex
+
+  // optional pipelined timestep reduction: the per-cycle MPI_Allreduce over the minimum
+  // dt is replaced by an MPI_Iallreduce whose result is consumed one cycle late with a
+  // safety factor (see NewTimeStep()).  Violations (cycles where the lagged dt exceeded
+  // the true global minimum) are counted and reported
+  bool async_dt;          // enable one-cycle-lagged non-blocking dt reduction
+  Real async_dt_safety;   // safety factor (<1) applied to lagged global min dt
+  int async_dt_nviol=0;   // number of cycles where lagged dt exceeded true global min
 
   int nmb_packs_thisrank;                  // number of MBPacks on this rank
-  MeshBlockPack* pmb_pack;                 // container for MeshBlocks on this rank
+  MeshBlockPack* pmb_pack;                 // first MBPack (access point for code that
+                                           // is not yet pack-aware)
+  std::vector<MeshBlockPack*> pmb_packs;   // all MBPacks on this rank
   std::unique_ptr<ProblemGenerator> pgen;  // class containing functions to set ICs
   MeshRefinement *pmr=nullptr;             // mesh refinement data/functions (if needed)
 
@@ -176,5 +199,11 @@ class Mesh {
  private:
   std::unique_ptr<MeshBlockTree> ptree;  // pointer to root node in binary/quad/oct-tree
   void LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb);
+#if MPI_PARALLEL_ENABLED
+  // state for pipelined (one-cycle-lagged) dt reduction
+  MPI_Request async_dt_req_;       // request for pending Iallreduce
+  Real async_dt_min_;              // in-place send/recv buffer for Iallreduce
+  bool async_dt_pending_ = false;  // true while an Iallreduce is in flight
+#endif
 };
 #endif  // MESH_MESH_HPP_
@@ -23,11 +23,13 @@
 
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
+#include "particles/particles.hpp"
 #include "radiation/radiation.hpp"
 #include "z4c/z4c.hpp"
 #include "z4c/z4c_amr.hpp"
 #include "prolongation.hpp"
 #include "restriction.hpp"
+#include "utils/grow_view.hpp"
 
 #if MPI_PARALLEL_ENABLED
 #include <mpi.h>
@@ -46,16 +48,42 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
   nmb_sent_thisrank(0),
   ncyc_check_amr(1),
   refinement_interval(5),
+  derefine_interval(5),
   prolong_prims(false),
+  lb_measured_cost(false),
+  lb_particle_cost(false),
+  pipelined_regrid(false),
+  amr_staging_count(0),
   d_threshold_(0.0),
   dd_threshold_(0.0),
   dp_threshold_(0.0),
   dv_threshold_(0.0),
-  check_cons_(false) {
+  d_deref_(0.0),
+  dd_deref_(0.0),
+  dp_deref_(0.0),
+  check_cons_(false),
+  lb_cost_alpha_(0.25),
+  lb_particle_weight_(0.0),
+  lb_imbalance_max_(1.25),
+  cycle_cost_ema_(-1.0),
+  regrid_pending_(false),
+  pending_nnew_(0),
+  pending_ndel_(0),
+  ncyc_check_base_(1),
+  ncyc_check_max_(1) {
   if (pin->DoesBlockExist("mesh_refinement")) {
-    // read interval (in cycles) between check of AMR and derefinement
+    // read interval (in cycles) between check of AMR and derefinement.  When
+    // ncycle_check_max > ncycle_check, the interval backs off geometrically whenever a
+    // check flags no changes (see AdaptiveMeshRefinement()) up to that ceiling
     ncyc_check_amr = pin->GetOrAddReal("mesh_refinement", "ncycle_check", 1);
+    ncyc_check_base_ = ncyc_check_amr;
+    ncyc_check_max_ = pin->GetOrAddReal("mesh_refinement", "ncycle_check_max",
+                                        ncyc_check_amr);
     refinement_interval = pin->GetOrAddReal("mesh_refinement", "refinement_interval", 5);
+    // minimum lifetime (in cycles) before a MB may be de-refined; raising it above
+    // refinement_interval damps refine/derefine ping-pong near thresholds
+    derefine_interval = pin->GetOrAddReal("mesh_refinement", "derefine_interval",
+                                          refinement_interval);
     // read prolongate primitives flag
     if (pin->DoesParameterExist("mesh_refinement", "prolong_primitives")) {
       prolong_prims = pin->GetBoolean("mesh_refinement", "prolong_primitives");
@@ -77,6 +105,34 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
       dd_threshold_ = pin->GetReal("mesh_refinement", "dvel_max");
       check_cons_ = true;
     }
+    // read de-refinement thresholds.  Defaults reproduce the historical behavior
+    // (de-refine below the refinement threshold itself for the density maximum, and
+    // below 1/4 of it for the gradient criteria); setting them lower widens the
+    // hysteresis band in which blocks keep their current level
+    if (check_cons_) {
+      d_deref_ = pin->GetOrAddReal("mesh_refinement", "dens_max_deref", d_threshold_);
+      dd_deref_ = pin->GetOrAddReal("mesh_refinement", "ddens_max_deref",
+                                    0.25*dd_threshold_);
+      dp_deref_ = pin->GetOrAddReal("mesh_refinement", "dpres_max_deref",
+                                    0.25*dp_threshold_);
+    }
+    // read measured-cost load balancing options
+    lb_measured_cost = pin->GetOrAddBoolean("mesh_refinement", "measured_cost", false);
+    lb_cost_alpha_ = pin->GetOrAddReal("mesh_refinement", "cost_average_weight", 0.25);
+    lb_imbalance_max_ = pin->GetOrAddReal("mesh_refinement", "max_cost_imbalance", 1.25);
+    // cost added per particle on a MeshBlock, so tracer-heavy blocks read as expensive
+    // to the load balancer.  Units follow the block cost: seconds per particle when
+    // measured_cost=true, else relative to the unit cost of a particle-free block
+    lb_particle_weight_ = pin->GetOrAddReal("mesh_refinement", "particle_cost_weight",
+                                            0.0);
+    lb_particle_cost = (lb_particle_weight_ > 0.0);
+    // read pipelined (deferred-commit) regridding flag
+    pipelined_regrid = pin->GetOrAddBoolean("mesh_refinement", "pipelined_regrid", false);
+    // read device staging budget (in MiB, per direction) for load balancing transfers.
+    // When positive, MeshBlocks are moved in waves whose send/recv staging fits the
+    // budget instead of staging every moving block at once (0 = unbounded)
+    Real stage_mb = pin->GetOrAddReal("mesh_refinement", "amr_staging_mb", 0.0);
+    amr_staging_count = static_cast<int>(stage_mb*1048576.0/sizeof(Real));
   }
 
   if (pm->adaptive) {  // allocate arrays for AMR
@@ -89,10 +145,12 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
   // be sure Views are initialized to zero
   for (int m=0; m<(pm->nmb_total); ++m) {
     refine_flag.h_view(m) = 0;
-    ncyc_since_ref(m) = 0;
+    ncyc_since_ref.h_view(m) = 0;
   }
   refine_flag.template modify<HostMemSpace>();
   refine_flag.template sync<DevExeSpace>();
+  ncyc_since_ref.template modify<HostMemSpace>();
+  ncyc_since_ref.template sync<DevExeSpace>();
 
   // initialize interpolation weights for prolongation and restriction
   InitInterpWghts();
@@ -120,15 +178,59 @@ MeshRefinement::~MeshRefinement() {
 //! \brief Simple driver function for adaptive mesh refinement
 
 void MeshRefinement::AdaptiveMeshRefinement(Driver *pdriver, ParameterInput *pin) {
-  // first check refinement criteria
-  CheckForRefinement(pmy_mesh->pmb_pack);
-
-  // then update mesh tree if MeshBlock anywhere (on any rank) is flagged for refinement
   int nnew = 0, ndel = 0;
-  UpdateMeshBlockTree(nnew, ndel);
+  bool rebalance;
+  if (pipelined_regrid && regrid_pending_) {
+    // commit the regrid decided at the previous step boundary.  Evolution has taken one
+    // more step on the old mesh since the criteria were evaluated; the buffer region
+    // built into the refinement criteria keeps this safe
+    nnew = pending_nnew_;
+    ndel = pending_ndel_;
+    regrid_pending_ = false;
+    rebalance = true;
+  } else {
+    // first check refinement criteria (device-side; true only if any MeshBlock on any
+    // rank was flagged, in which case the flags have been gathered on the host)
+    bool any_flagged = CheckForRefinement(pmy_mesh->pmb_pack);
+
+    // then update mesh tree if MeshBlock anywhere (on any rank) is flagged for refinement
+    if (any_flagged) {UpdateMeshBlockTree(nnew, ndel);}
+
+    // With measured costs, also redistribute MBs when the cost imbalance across ranks
+    // exceeds the threshold, even if no MeshBlock was refined/de-refined this cycle
+    rebalance = ((nnew != 0) || (ndel != 0));
+    if ((lb_measured_cost || lb_particle_cost) &&
+        !rebalance && (global_variable::nranks > 1) &&
+        ((pmy_mesh->ncycle)%(ncyc_check_amr) == 0)) {
+      rebalance = (CostImbalance() > lb_imbalance_max_);
+    }
+
+    // adaptive check cadence: when a check flags no changes, geometrically back off the
+    // interval until the next check (up to ncycle_check_max); any change resets it to
+    // the configured base value
+    if ((ncyc_check_max_ > ncyc_check_base_) &&
+        ((pmy_mesh->ncycle)%(ncyc_check_amr) == 0)) {
+      if ((nnew == 0) && (ndel == 0)) {
+        ncyc_check_amr = std::min(2*ncyc_check_amr, ncyc_check_max_);
+      } else {
+        ncyc_check_amr = ncyc_check_base_;
+      }
+    }
+
+    // in pipelined mode only the (cheap) decision is taken at this step boundary.  The
+    // tree is already updated, but all data movement and the switch of the Mesh arrays
+    // are deferred until the next boundary; cached MeshBlock/neighbor data keep the old
+    // configuration valid for one more cycle of evolution (and any outputs it makes)
+    if (pipelined_regrid && rebalance) {
+      pending_nnew_ = nnew;
+      pending_ndel_ = ndel;
+      regrid_pending_ = true;
+      return;
+    }
+  }
 
   // Refine/derefine mesh and evolved data, set boundary conditions/timestep on new mesh
-  if (nnew != 0 || ndel != 0) { // at least one (de)refinement flagged
+  if (rebalance) { // at least one (de)refinement flagged, or cost imbalance too large
     RedistAndRefineMeshBlocks(pin, nnew, ndel);
     pdriver->InitBoundaryValuesAndPrimitives(pmy_mesh);
 
@@ -152,10 +254,92 @@ void MeshRefinement::AdaptiveMeshRefinement(Driver *pdriver, ParameterInput *pin
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::UpdateMeasuredCosts()
+//! \brief Folds the wallclock time measured over the last cycle into the per-MeshBlock
+//! cost array used by the load balancer. Since every task kernel operates over all the
+//! MeshBlocks in the pack at once, per-block timing is not separable; instead the rank
+//! wallclock is exponentially averaged and attributed evenly to the MeshBlocks on this
+//! rank. Blocks owned by slow ranks (e.g. those dominated by c2p retries or FOFC near a
+//! horizon) thereby acquire a higher cost, so the next rebalance shifts work off them.
+//! Unlike grid work, particle work is separable per block, so when a particle cost
+//! weight is set the per-block particle counts are added on top with that weight,
+//! letting tracer-heavy blocks read as expensive even on otherwise uniform meshes.
+//! Called at the end of each cycle in the main loop in Driver::Execute().
+
+void MeshRefinement::UpdateMeasuredCosts(double cycle_time) {
+  Mesh* pm = pmy_mesh;
+  int nmb = pm->nmb_thisrank;
+  int mbs = pm->gids_eachrank[global_variable::my_rank];
+  float cost = 1.0;  // unit block cost when only particle weighting is enabled
+  if (lb_measured_cost) {
+    if (cycle_cost_ema_ < 0.0) {  // first cycle, seed average with first sample
+      cycle_cost_ema_ = cycle_time;
+    } else {
+      cycle_cost_ema_ = lb_cost_alpha_*cycle_time +
+                        (1.0 - lb_cost_alpha_)*cycle_cost_ema_;
+    }
+    cost = static_cast<float>(cycle_cost_ema_)/static_cast<float>(nmb);
+  }
+  for (int m=0; m<nmb; ++m) {
+    pm->cost_eachmb[mbs + m] = cost;
+  }
+
+  // add weighted per-block particle counts (histogram computed on device)
+  particles::Particles *ppart = pm->pmb_pack->ppart;
+  if (lb_particle_cost && (ppart != nullptr)) {
+    auto &pi = ppart->prtcl_idata;
+    int npart = ppart->nprtcl_thispack;
+    int gids = pm->pmb_pack->gids;
+    DvceArray1D<int> npar_d("npar_mb", nmb);
+    par_for("npar_mb",DevExeSpace(),0,(npart-1), KOKKOS_LAMBDA(const int p) {
+      Kokkos::atomic_fetch_add(&npar_d(pi(PGID,p) - gids), 1);
+    });
+    HostArray1D<int> npar_h("npar_mb_h", nmb);
+    Kokkos::deep_copy(npar_h, npar_d);
+    float w = static_cast<float>(lb_particle_weight_);
+    for (int m=0; m<nmb; ++m) {
+      pm->cost_eachmb[mbs + m] += w*static_cast<float>(npar_h(m));
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  // share costs so that all ranks hold an identical list, since every rank computes the
+  // rebalance decision and new load balance redundantly
+  MPI_Allgatherv(MPI_IN_PLACE, nmb, MPI_FLOAT, pm->cost_eachmb, pm->nmb_eachrank,
+                 pm->gids_eachrank, MPI_FLOAT, amr_comm);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn float MeshRefinement::CostImbalance()
+//! \brief Returns ratio of the most expensive rank's total MeshBlock cost to the mean
+//! rank cost under the current distribution. Result is identical on every rank since
+//! cost_eachmb is kept globally consistent by UpdateMeasuredCosts().
+
+float MeshRefinement::CostImbalance() {
+  Mesh* pm = pmy_mesh;
+  float maxcost = 0.0, totalcost = 0.0;
+  for (int r=0; r<global_variable::nranks; ++r) {
+    float rankcost = 0.0;
+    int mbs = pm->gids_eachrank[r];
+    for (int m=0; m<pm->nmb_eachrank[r]; ++m) {
+      rankcost += pm->cost_eachmb[mbs + m];
+    }
+    maxcost = std::max(maxcost, rankcost);
+    totalcost += rankcost;
+  }
+  return maxcost*static_cast<float>(global_variable::nranks)/totalcost;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn bool MeshRefinement::CheckForRefinement()
 //! \brief Checks for refinement/de-refinement and sets refine_flag(m) for all
-//! MeshBlocks within a MeshBlockPack. Returns true if any MeshBlock needs to be refined.
+//! MeshBlocks within a MeshBlockPack. Returns true if any MeshBlock (on any rank) needs
+//! to be refined or de-refined.  Criteria evaluation, the level/lifetime clamps, and
+//! the any-change decision all run on device; a single scalar reduction is returned to
+//! the host, and the flag arrays are only moved (and gathered across ranks) when a
+//! change is actually flagged.
 //! Default refinement conditions implemented are:
 //!   (1) density max above a threshold value (hydro/MHD)
 //!   (2) gradient of density above a threshold value (hydro/MHD)
@@ -166,20 +350,29 @@ void MeshRefinement::AdaptiveMeshRefinement(Driver *pdriver, ParameterInput *pin
 //! User-defined refinement conditions can also be enrolled by setting the *usr_ref_func
 //! pointer in the problem generator.
 
-void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
-  // reallocate and zero refine_flag in host space and sync with device
-  Kokkos::realloc(refine_flag, pmy_mesh->nmb_total);
-  for (int m=0; m<(pmy_mesh->nmb_total); ++m) {
-    refine_flag.h_view(m) = 0;
-  }
-  refine_flag.template modify<HostMemSpace>();
-  refine_flag.template sync<DevExeSpace>();
+bool MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
+  int nmb_tot = pmy_mesh->nmb_total;
+
+  // increment (on device) cycle counter for each MB.  The host copy goes stale and is
+  // reconciled only when a regrid occurs (in RedistAndRefineMeshBlocks())
+  auto ncyc_d = ncyc_since_ref.d_view;
+  par_for("incr_ncyc", DevExeSpace(), 0, (nmb_tot-1), KOKKOS_LAMBDA(const int m) {
+    ncyc_d(m) += 1;
+  });
+  ncyc_since_ref.template modify<DevExeSpace>();
+  if ((pmbp->pmesh->ncycle)%(ncyc_check_amr) != 0) {return false;} // not cycle to check
 
-  // increment cycle counter for each MB
+  // grow (only if needed) refine_flag, and zero both copies without synchronization:
+  // device criteria below write d_view directly, while host-side criteria (e.g. the
+  // z4c tracker/radii methods) write h_view and push it to device themselves
+  GrowView(refine_flag, pmy_mesh->nmb_total);
   for (int m=0; m<(pmy_mesh->nmb_total); ++m) {
-    ncyc_since_ref(m) += 1;
+    refine_flag.h_view(m) = 0;
   }
-  if ((pmbp->pmesh->ncycle)%(ncyc_check_amr) != 0) {return;}  // not cycle to check
+  auto rflag_d = refine_flag.d_view;
+  par_for("zero_rflag", DevExeSpace(), 0, (nmb_tot-1), KOKKOS_LAMBDA(const int m) {
+    rflag_d(m) = 0;
+  });
 
   // capture variables for kernels
   auto &multi_d = pmy_mesh->multi_d;
@@ -196,6 +389,9 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
   auto &dens_thresh  = d_threshold_;
   auto &ddens_thresh = dd_threshold_;
   auto &dpres_thresh = dp_threshold_;
+  auto &dens_deref  = d_deref_;
+  auto &ddens_deref = dd_deref_;
+  auto &dpres_deref = dp_deref_;
   int nmb = pmbp->nmb_thispack;
   int mbs = pmy_mesh->gids_eachrank[global_variable::my_rank];
   if (((pmbp->phydro != nullptr) || (pmbp->pmhd != nullptr)) && check_cons_) {
@@ -218,7 +414,7 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
         },Kokkos::Max<Real>(team_dmax));
 
         if (team_dmax > dens_thresh) {refine_flag_.d_view(m+mbs) = 1;}
-        if (team_dmax < dens_thresh) {refine_flag_.d_view(m+mbs) = -1;}
+        if (team_dmax < dens_deref) {refine_flag_.d_view(m+mbs) = -1;}
       }
 
       // density gradient threshold
@@ -238,7 +434,7 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
         },Kokkos::Max<Real>(team_ddmax));
 
         if (team_ddmax > ddens_thresh) {refine_flag_.d_view(m+mbs) = 1;}
-        if (team_ddmax < 0.25*ddens_thresh) {refine_flag_.d_view(m+mbs) = -1;}
+        if (team_ddmax < ddens_deref) {refine_flag_.d_view(m+mbs) = -1;}
       }
 
       // pressure gradient threshold
@@ -258,7 +454,7 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
         },Kokkos::Max<Real>(team_dpmax));
 
         if (team_dpmax > dpres_thresh) {refine_flag_.d_view(m+mbs) = 1;}
-        if (team_dpmax < 0.25*dpres_thresh) {refine_flag_.d_view(m+mbs) = -1;}
+        if (team_dpmax < dpres_deref) {refine_flag_.d_view(m+mbs) = -1;}
       }
     });
   }
@@ -267,24 +463,42 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
   if (pmy_mesh->pgen->user_ref_func != nullptr) {
     pmy_mesh->pgen->user_ref_func(pmbp);
   }
-  // sync device array with host
-  refine_flag.template modify<DevExeSpace>();
-  refine_flag.template sync<HostMemSpace>();
 
-  // Check (on host) for MeshBlocks at max/root level flagged for refine/derefine
-  for (int m=0; m<nmb; ++m) {
-    if (pmy_mesh->lloc_eachmb[m+mbs].level == pmy_mesh->max_level) {
-      if (refine_flag.h_view(m+mbs) > 0) {refine_flag.h_view(m+mbs) = 0;}
-    }
-    if (pmy_mesh->lloc_eachmb[m+mbs].level == pmy_mesh->root_level) {
-      if (refine_flag.h_view(m+mbs) < 0) {refine_flag.h_view(m+mbs) = 0;}
-    }
-  }
+  // Apply (on device) level limits and minimum-lifetime hysteresis to the flags of this
+  // rank's MeshBlocks: blocks at the max level cannot refine, blocks at the root level
+  // cannot de-refine, and recently changed blocks hold their level (de-refinement can
+  // be held off longer via derefine_interval to damp refine/derefine ping-pong)
+  auto &mblev = pmbp->pmb->mb_lev;
+  int max_lvl = pmy_mesh->max_level;
+  int root_lvl = pmy_mesh->root_level;
+  int ref_intvl = refinement_interval;
+  int deref_intvl = derefine_interval;
+  par_for("clamp_rflag", DevExeSpace(), 0, (nmb-1), KOKKOS_LAMBDA(const int m) {
+    int f = rflag_d(m+mbs);
+    if ((f > 0) &&
+        ((mblev.d_view(m) == max_lvl) || (ncyc_d(m+mbs) < ref_intvl))) {f = 0;}
+    if ((f < 0) &&
+        ((mblev.d_view(m) == root_lvl) || (ncyc_d(m+mbs) < deref_intvl))) {f = 0;}
+    rflag_d(m+mbs) = f;
+  });
 
-  // Check (on host) that MB has not been recently refined
-  for (int m=0; m<nmb; ++m) {
-    if (ncyc_since_ref(m+mbs) < refinement_interval) {refine_flag.h_view(m+mbs) = 0;}
-  }
+  // Reduce (on device) the number of flagged MeshBlocks to a single scalar.  On the
+  // (common) cycles where nothing is flagged anywhere this is the only data that moves
+  // between device and host; the flag arrays themselves stay put
+  int nflagged = 0;
+  Kokkos::parallel_reduce("any_rflag", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmb),
+  KOKKOS_LAMBDA(const int m, int &sum) {
+    if (rflag_d(m+mbs) != 0) {sum++;}
+  }, Kokkos::Sum<int>(nflagged));
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, &nflagged, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  if (nflagged == 0) {return false;}
+
+  // a change was flagged somewhere: reconcile flags with host, where the tree update
+  // and regrid logic run
+  refine_flag.template modify<DevExeSpace>();
+  refine_flag.template sync<HostMemSpace>();
 #if MPI_PARALLEL_ENABLED
   // Pass refine_flag between all ranks
     MPI_Allgatherv(MPI_IN_PLACE, pmy_mesh->nmb_eachrank[global_variable::my_rank],
@@ -295,7 +509,7 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
   refine_flag.template modify<HostMemSpace>();
   refine_flag.template sync<DevExeSpace>();
 
-  return;
+  return true;
 }
 
 //----------------------------------------------------------------------------------------
@@ -505,15 +719,26 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   }
 
   // Step 3.
-  // Calculate new load balance. Initialize new cost array with the simplest estimate
-  // possible: all the blocks are equal
-  // TODO(@user): implement variable cost per MeshBlock as needed
+  // Calculate new load balance. Map costs from the old to the new MeshBlocks: since
+  // every MeshBlock has the same number of cells, leaves created by refinement inherit
+  // the cost of their parent, while a de-refined block takes the average over its old
+  // leaves. With measured-cost load balancing disabled the costs are uniform, and this
+  // reduces to the equal-cost estimate.
   new_cost_eachmb = new float[new_nmb];
   new_rank_eachmb = new int[new_nmb];
   new_gids_eachrank = new int[global_variable::nranks];
   new_nmb_eachrank = new int[global_variable::nranks];
 
-  for (int i=0; i<new_nmb; i++) {new_cost_eachmb[i] = 1.0;}
+  for (int i=0; i<new_nmb; i++) {
+    int oldm = newtoold[i];
+    if (new_lloc_eachmb[i].level < pm->lloc_eachmb[oldm].level) {  // de-refined
+      float sum = 0.0;
+      for (int l=0; l<nleaf; l++) {sum += pm->cost_eachmb[oldm+l];}
+      new_cost_eachmb[i] = sum/static_cast<float>(nleaf);
+    } else {  // same level, or leaf created by refinement
+      new_cost_eachmb[i] = pm->cost_eachmb[oldm];
+    }
+  }
   pm->LoadBalance(new_cost_eachmb, new_rank_eachmb, new_gids_eachrank, new_nmb_eachrank,
                   new_nmb_total);
   if (new_nmb_eachrank[global_variable::my_rank] > pm->nmb_maxperrank) {
@@ -550,6 +775,9 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
 #if MPI_PARALLEL_ENABLED
   InitRecvAMR(nleaf);
   PackAndSendAMR(nleaf);
+  // with a bounded staging budget only the first wave of transfers is in flight here;
+  // drain the remaining waves (reusing the staging arrays) before local data moves
+  DrainAMRWaves();
   nmb_sent_thisrank += nmb_send;
 #endif
 
@@ -635,18 +863,52 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
     }
   }
 
-  // Update new number of cycles since refinement
+  // Update new number of cycles since refinement.  Counters are incremented on device
+  // by CheckForRefinement(), so fetch them before remapping and push the result back
+  ncyc_since_ref.template sync<HostMemSpace>();
   HostArray1D<int> new_ncyc_since_ref("nnref",new_nmb_total);
   for (int m=0; m<(new_nmb_total); ++m) {
     int oldm = newtoold[m];
     if (refine_flag.h_view(oldm) != 0) {
       new_ncyc_since_ref(m) = 0;
     } else {
-      new_ncyc_since_ref(m) = ncyc_since_ref(oldm);
+      new_ncyc_since_ref(m) = ncyc_since_ref.h_view(oldm);
     }
   }
   Kokkos::realloc(ncyc_since_ref, new_nmb_total);
-  Kokkos::deep_copy(ncyc_since_ref, new_ncyc_since_ref);
+  Kokkos::deep_copy(ncyc_since_ref.h_view, new_ncyc_since_ref);
+  ncyc_since_ref.template modify<HostMemSpace>();
+  ncyc_since_ref.template sync<DevExeSpace>();
+
+  // Save old neighbor lists on this rank, and flag those new MBs on this rank whose
+  // entire neighborhood is unchanged by this regrid (block itself and every one of its
+  // old neighbors kept the same logical location, and block did not change rank).  The
+  // neighbor lists of flagged blocks can be translated through the gid maps in
+  // SetNeighbors() below, instead of recomputed with ~2x26 tree searches per block;
+  // with only a small fraction of MBs changing per regrid nearly all blocks qualify.
+  MeshBlock* pmbold = pm->pmb_pack->pmb;
+  int old_gids_myrank = pm->gids_eachrank[global_variable::my_rank];
+  int new_gids_myrank = new_gids_eachrank[global_variable::my_rank];
+  int new_nmb_myrank  = new_nmb_eachrank[global_variable::my_rank];
+  HostArray2D<NeighborBlock> old_nghbr("old_nghbr", pmbold->nghbr.h_view.extent(0),
+                                       pmbold->nghbr.h_view.extent(1));
+  Kokkos::deep_copy(old_nghbr, pmbold->nghbr.h_view);
+  HostArray1D<int> old_lid("old_lid", new_nmb_myrank);
+  for (int n=0; n<new_nmb_myrank; ++n) {
+    old_lid(n) = -1;
+    int oldm = newtoold[n + new_gids_myrank];
+    if ((pm->rank_eachmb[oldm] != global_variable::my_rank) ||
+        (refine_flag.h_view(oldm) != 0)) {continue;}
+    bool unchanged = true;
+    for (int nb=0; nb<(pmbold->nnghbr); ++nb) {
+      int ngid = old_nghbr((oldm - old_gids_myrank), nb).gid;
+      if ((ngid >= 0) && (refine_flag.h_view(ngid) != 0)) {
+        unchanged = false;
+        break;
+      }
+    }
+    if (unchanged) {old_lid(n) = oldm - old_gids_myrank;}
+  }
 
   // Step 10.
   // Update data in Mesh/MeshBlockPack/MeshBlock classes with new grid properties
@@ -671,7 +933,8 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   delete (pm->pmb_pack->pcoord);
   pm->pmb_pack->AddMeshBlocks(pin);
   pm->pmb_pack->AddCoordinates(pin);
-  pm->pmb_pack->pmb->SetNeighbors(pm->ptree, pm->rank_eachmb);
+  pm->pmb_pack->pmb->SetNeighbors(pm->ptree, pm->rank_eachmb, old_nghbr, old_lid,
+                                  oldtonew);
 
   // clean-up and return
   delete [] newtoold;
@@ -30,6 +30,8 @@ struct AMRBuffer {
   int cnt;                   // total number of elements stored in buffer incl all vars
   int offset=0;              // starting index of data for this buffer
   int lid;                   // local ID (gid - gids) of MeshBlock on this rank
+  int trank=0;               // rank of communication partner (host use only)
+  int tag=0;                 // MPI tag of this message (host use only)
   bool use_coarse=false;     // pack/unpack from coarse array when true
 };
 #endif
@@ -49,11 +51,18 @@ class MeshRefinement {
   int nmb_sent_thisrank;     // # of MeshBlocks sent during load balancing on this rank
   int ncyc_check_amr;        // # of cycles between checking mesh for ref/derefinement
   int refinement_interval;   // # of cycles between allowing successive ref/derefinement
+  int derefine_interval;     // # of cycles a MB must exist before it can be de-refined
   bool prolong_prims;        // flag to enable prolongation of primitive vars
-
-  // following 2x Views are dimensioned [nmb_total]
+  bool lb_measured_cost;     // flag to enable measured-cost load balancing
+  bool lb_particle_cost;     // flag to fold per-MB particle counts into MB costs
+  bool pipelined_regrid;     // flag to defer regrid commit by one cycle
+  int amr_staging_count;     // device staging budget (in Reals, per direction) for load
+                             // balancing transfers; 0 = stage every transfer at once
+
+  // following 2x Views are dimensioned [nmb_total].  Both are maintained on device by
+  // CheckForRefinement(); host copies are reconciled only when a regrid occurs
   DualArray1D<int> refine_flag;    // refinement flag for each MeshBlock
-  HostArray1D<int> ncyc_since_ref; // # of cycles since MB last refined/derefined
+  DualArray1D<int> ncyc_since_ref; // # of cycles since MB last refined/derefined
 
   // following 4x arrays allocated with length [nranks] only with AMR
   int *nref_eachrank;     // number of MBs refined per rank
@@ -90,11 +99,25 @@ class MeshRefinement {
   DualArray1D<AMRBuffer> sendbuf, recvbuf; // send/recv buffers
   MPI_Request *send_req, *recv_req;
   DvceArray1D<Real> send_data, recv_data;    // send/recv device data
+  // bounded ("chunked") staging for load balancing transfers.  With a positive
+  // <mesh_refinement>/amr_staging_mb the transfers of a regrid are partitioned into
+  // waves whose send and receive staging both fit the budget on every rank; the device
+  // staging arrays are sized to the largest wave and reused, with received data parked
+  // in a pinned host holding area until it is unpacked.  The wave assignment is
+  // computed identically on all ranks (see ComputeLBWaves), so no extra communication
+  // is needed and the wave-by-wave send/receive schedule cannot deadlock
+  int lb_nwaves=1;                  // number of transfer waves in current regrid
+  int lb_send_wmax=0, lb_recv_wmax=0;  // largest per-wave staging size (Reals)
+  int lb_recv_total=0;              // total volume received this regrid (Reals)
+  std::vector<int> lb_send_wstart;  // first sendbuf index of each wave [lb_nwaves+1]
+  std::vector<int> lb_recv_wstart;  // first recvbuf index of each wave [lb_nwaves+1]
+  StageArray1D<Real> recv_hold;     // pinned host holding area for drained recv waves
 #endif
 
   // functions
-  void CheckForRefinement(MeshBlockPack* pmbp);
+  bool CheckForRefinement(MeshBlockPack* pmbp);
   void AdaptiveMeshRefinement(Driver *pdrive, ParameterInput *pin);
+  void UpdateMeasuredCosts(double cycle_time);
   void UpdateMeshBlockTree(int &nnew, int &ndel);
   void RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, int ndel);
 
@@ -115,14 +138,24 @@ class MeshRefinement {
   void RestrictFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb);
   void HighOrderRestrictCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
 
-  // functions for load balancing (in file load_balance.cpp)
+  // functions for load balancing (in file load_balance.cpp).  The pack/unpack functions
+  // operate on the range of buffer indices [nbs,nbe) with data offsets measured from
+  // base; the defaults cover every transfer (nbe=-1 means nmb_send/nmb_recv)
   void InitRecvAMR(int nleaf);
   void PackAndSendAMR(int nleaf);
-  void PackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, int ncc, int nfc);
-  void PackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb, int ncc,int nfc);
+  void ComputeLBWaves(int nleaf, int ncc, int nfc);
+  void PostRecvAMRWave(int w);
+  void PackAndSendAMRWave(int w);
+  void DrainAMRWaves();
+  void PackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, int ncc, int nfc,
+                        int nbs=0, int nbe=-1, int base=0);
+  void PackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb, int ncc, int nfc,
+                        int nbs=0, int nbe=-1, int base=0);
   void ClearRecvAndUnpackAMR();
-  void UnpackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, int ncc,int nfc);
-  void UnpackAMRBuffersFC(DvceFaceFld4D<Real> &b,DvceFaceFld4D<Real> &cb,int ncc,int nfc);
+  void UnpackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, int ncc, int nfc,
+                          int nbs=0, int nbe=-1, int base=0);
+  void UnpackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb, int ncc,
+                          int nfc, int nbs=0, int nbe=-1, int base=0);
   void ClearSendAMR();
 
   // initialize interpolation weights
@@ -132,6 +165,20 @@ class MeshRefinement {
   // data
   Mesh *pmy_mesh;
   Real d_threshold_, dd_threshold_, dp_threshold_, dv_threshold_, chi_threshold_;
+  // de-refinement thresholds (hysteresis bands below the refinement thresholds above)
+  Real d_deref_, dd_deref_, dp_deref_;
   bool check_cons_;
+  Real lb_cost_alpha_;       // weight of newest sample in exponential cost average
+  Real lb_particle_weight_;  // cost added per particle (same units as MB cost)
+  Real lb_imbalance_max_;    // max/mean rank cost ratio that triggers redistribution
+  double cycle_cost_ema_;    // exponentially averaged cycle wallclock on this rank
+  bool regrid_pending_;      // true when tree updated but regrid not yet committed
+  int pending_nnew_;         // # of MBs created by the pending regrid
+  int pending_ndel_;         // # of MBs destroyed by the pending regrid
+  int ncyc_check_base_;      // configured check interval (floor of adaptive cadence)
+  int ncyc_check_max_;       // ceiling of adaptive check cadence (= base disables)
+
+  // functions
+  float CostImbalance();
 };
 #endif // MESH_MESH_REFINEMENT_HPP_
@@ -42,11 +42,27 @@ class MeshBlock {
   DualArray2D<BoundaryFlag> mb_bcs;  // boundary conditions at 6 faces of each MeshBlock
   DualArray2D<NeighborBlock> nghbr;  // data on all (up to 56) neighbors for each MB
 
-  // function to set data describing neighbors
+  // partition of MeshBlocks in this pack into a "boundary" subset (at least one neighbor
+  // on another rank) and its complement.  Used to restrict communication-facing kernels
+  // to the MeshBlocks that actually touch off-rank data.  Set in SetNeighbors(), so the
+  // partition is rebuilt whenever neighbors change (e.g. on AMR regrids)
+  int nmb_bndry;                // number of MBs in this pack with off-rank neighbors
+  DualArray1D<int> bndry_mbs;   // pack indices of MBs with off-rank neighbors
+
+  // functions to set data describing neighbors.  Second (incremental) version is used
+  // during AMR regrids: MBs flagged in old_lid have their old neighbor lists translated
+  // through the old-to-new gid map rather than recomputed with tree searches
   void SetNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklist);
+  void SetNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklist,
+                    const HostArray2D<NeighborBlock> &old_nghbr,
+                    const HostArray1D<int> &old_lid, const int *oldtonew);
 
  private:
   // data
   MeshBlockPack* pmy_pack;
+
+  // functions
+  void SearchNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklist, int b);
+  void SyncNeighbors();
 };
 #endif // MESH_MESHBLOCK_HPP_
@@ -29,6 +29,7 @@
 #include "srcterms/turb_driver.hpp"
 #include "particles/particles.hpp"
 #include "units/units.hpp"
+#include "gravity/gravity.hpp"
 #include "meshblock_pack.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -39,6 +40,12 @@ MeshBlockPack::MeshBlockPack(Mesh *pm, int igids, int igide) :
   gids(igids),
   gide(igide),
   nmb_thispack(igide - igids + 1) {
+  // create independent execution space instance (stream on GPU backends) used to overlap
+  // packing/sending of off-rank boundary buffers with compute on the default instance
+  {
+    auto instances = Kokkos::Experimental::partition_space(DevExeSpace(), 1);
+    exec_comm = instances[0];
+  }
   // create map for task lists
   tl_map.insert(std::make_pair("before_timeintegrator",std::make_shared<TaskList>()));
   tl_map.insert(std::make_pair("after_timeintegrator",std::make_shared<TaskList>()));
@@ -63,6 +70,7 @@ MeshBlockPack::~MeshBlockPack() {
   if (punit  != nullptr) {delete punit;}
   if (pz4c   != nullptr) {delete pz4c;}
   if (ppart  != nullptr) {delete ppart;}
+  if (pgrav  != nullptr) {delete pgrav;}
   // must be last, since it calls ~BoundaryValues() which (MPI) uses pmy_pack->pmb->nnghbr
   delete pmb;
 }
@@ -180,6 +188,17 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
     pturb = nullptr;
   }
 
+  // (6b) SELF-GRAVITY
+  // Solves for the gravitational potential of the fluid with a distributed FFT Poisson
+  // solver (uniform periodic grids only), and adds the gravitational acceleration as a
+  // source term in each stage of the integrator.
+  if (pin->DoesBlockExist("gravity")) {
+    pgrav = new gravity::Gravity(this, pin);
+    pgrav->IncludeSelfGravityTasks(tl_map["stagen"], none);
+  } else {
+    pgrav = nullptr;
+  }
+
   // (7) Z4c and ADM
   // Create Z4c and ADM physics module.
   if (pin->DoesBlockExist("z4c")) {
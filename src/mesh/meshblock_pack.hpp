@@ -34,6 +34,7 @@ namespace z4c {class Z4c;}
 namespace adm {class ADM;}
 namespace particles {class Particles;}
 namespace units {class Units;}
+namespace gravity {class Gravity;}
 
 //----------------------------------------------------------------------------------------
 //! \class MeshBlockPack
@@ -72,6 +73,7 @@ class MeshBlockPack {
   TurbulenceDriver *pturb=nullptr;
   radiation::Radiation *prad=nullptr;
   particles::Particles *ppart=nullptr;
+  gravity::Gravity *pgrav=nullptr;
 
   // units (needed to convert code units to cgs for, e.g., cooling or radiation)
   units::Units *punit=nullptr;
@@ -79,6 +81,13 @@ class MeshBlockPack {
   // map for task lists which operate over all MeshBlocks in this MeshBlockPack
   std::map<std::string, std::shared_ptr<TaskList>> tl_map;
 
+  // Independent execution space instances (streams on GPU backends) used to overlap
+  // communication-facing kernels (e.g. packing of off-rank boundary buffers) with
+  // compute kernels submitted to the default instance.  Work on exec_comm is unordered
+  // with respect to the default instance; users must fence the producing instance before
+  // launching dependent work on the other.
+  DevExeSpace exec_comm;
+
   // functions
   void AddPhysics(ParameterInput *pin);
   void AddMeshBlocks(ParameterInput *pin);
@@ -6,10 +6,12 @@
 //! \file meshblock_tree.cpp
 //  \brief implementation of constructor and functions in the MeshBlockTree class
 
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <vector>
 
 #include "athena.hpp"
 #include "parameter_input.hpp"
@@ -145,6 +147,59 @@ void MeshBlockTree::AddNodeWithoutRefinement(LogicalLocation rloc) {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBlockTree::AddNodesWithoutRefinement(const LogicalLocation *llist,int nb)
+//! \brief add nodes for a curve-ordered range of MeshBlock locations to the tree without
+//! refinement, used in restarting.  The leaves of any node occupy a contiguous range of
+//! the space-filling curve, so each node partitions its range among its children in a
+//! single scan and recurses into each sub-range.  Every list entry is then visited only
+//! along its own root-to-leaf path instead of being re-descended from the root, which
+//! dominates restart start-up on meshes with ~10^6 MeshBlocks.
+//! MeshBlockTree::CreateRootGrid must be called before this method
+
+void MeshBlockTree::AddNodesWithoutRefinement(const LogicalLocation *llist, int nb) {
+  if (nb == 0) return;
+  // range is a single MeshBlock at this node's level -> this node is its leaf
+  if ((nb == 1) && (llist[0].level == lloc_.level)) return;
+
+  if (pleaf_ == nullptr) {
+    pleaf_ = new MeshBlockTree*[nleaf_];
+    for (int n=0; n<nleaf_; n++) {
+      pleaf_[n] = nullptr;
+    }
+  }
+
+  // partition range into consecutive runs of entries belonging to the same child and
+  // recurse.  With a curve-ordered list each child receives at most one run; an
+  // unordered list still builds the correct tree, just with more recursive calls
+  int is = 0;
+  while (is < nb) {
+    int sh = llist[is].level - lloc_.level - 1;
+    if (sh < 0) {++is; continue;}  // entry is this node itself
+    int mx = ((llist[is].lx1>>sh) & 1) == 1;
+    int my = ((llist[is].lx2>>sh) & 1) == 1;
+    int mz = ((llist[is].lx3>>sh) & 1) == 1;
+    int n = mx + (my<<1) + (mz<<2);
+    int ie = is + 1;
+    while (ie < nb) {
+      int shn = llist[ie].level - lloc_.level - 1;
+      if (shn < 0) break;
+      int nn = ((((llist[ie].lx1>>shn) & 1) == 1)    )
+             + ((((llist[ie].lx2>>shn) & 1) == 1)<<1)
+             + ((((llist[ie].lx3>>shn) & 1) == 1)<<2);
+      if (nn != n) break;
+      ++ie;
+    }
+    if (pleaf_[n] == nullptr) {
+      pleaf_[n] = new MeshBlockTree(this, mx, my, mz);
+    }
+    pleaf_[n]->AddNodesWithoutRefinement(&(llist[is]), (ie - is));
+    is = ie;
+  }
+
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshBlockTree::Refine(int &nnew)
 //! \brief make finer leaves
@@ -295,7 +350,12 @@ void MeshBlockTree::Derefine(int &ndel) {
     }
   }
 
-  gid_ = pleaf_[0]->gid_; // now this is a leaf; inherit the first leaf's GID
+  // now this is a leaf; inherit smallest GID of old leaves (= first visited on curve,
+  // which is not necessarily pleaf_[0] with Hilbert ordering)
+  gid_ = pleaf_[0]->gid_;
+  for (int n=1; n<nleaf_; n++) {
+    gid_ = std::min(gid_, pleaf_[n]->gid_);
+  }
   for (int n=0; n<nleaf_; n++) {
     delete pleaf_[n];
   }
@@ -322,6 +382,55 @@ void MeshBlockTree::CountMeshBlocks(int& count) {
   return;
 }
 
+namespace {
+
+//----------------------------------------------------------------------------------------
+//! \fn void AxesToTranspose(std::uint32_t *x, int b, int n)
+//! \brief converts n coordinates of b bits each into the transposed-bit form of the
+//! Hilbert index, using the algorithm of J. Skilling, "Programming the Hilbert curve",
+//! AIP Conf. Proc. 707, 381 (2004).  Interleaving the output words MSB-first across
+//! dimensions yields the distance along the Hilbert curve through the 2^b cube.
+
+void AxesToTranspose(std::uint32_t *x, int b, int n) {
+  std::uint32_t m = 1U << (b - 1), p, q, t;
+  // inverse undo
+  for (q = m; q > 1; q >>= 1) {
+    p = q - 1;
+    for (int i=0; i<n; i++) {
+      if (x[i] & q) {
+        x[0] ^= p;
+      } else {
+        t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+  // Gray encode
+  for (int i=1; i<n; i++) {x[i] ^= x[i-1];}
+  t = 0;
+  for (q = m; q > 1; q >>= 1) {
+    if (x[n-1] & q) {t ^= q - 1;}
+  }
+  for (int i=0; i<n; i++) {x[i] ^= t;}
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \struct HilbertLeaf
+//! \brief tree node together with its Hilbert key (up to 3x31 bits, split across two
+//! 64-bit words with k0 holding the most significant bits)
+
+struct HilbertLeaf {
+  std::uint64_t k0, k1;
+  MeshBlockTree* pnode;
+  bool operator<(const HilbertLeaf &other) const {
+    return (k0 == other.k0)? (k1 < other.k1) : (k0 < other.k0);
+  }
+};
+
+} // namespace
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshBlockTree::CreateZOrderedLLList(LogicalLocation *list, int *pg, int& cnt)
 //! \brief Creates the Location list for tree sorted by Z-ordering, and creates new MB ids
@@ -332,8 +441,14 @@ void MeshBlockTree::CountMeshBlocks(int& count) {
 //! to an integer array that is used to store old gid of node on old tree, before creating
 //! a new gid based on Z-ordering in the new tree. Thus pglist[n] is a mapping of
 //! (new gid n) --> (old gid). Also returns total number of MBs in tree in third argument.
+//! With <mesh>/block_ordering = hilbert the list is sorted along a Hilbert curve instead
+//! of the Morton (Z-)ordering; the name is kept for all the existing call sites.
 
 void MeshBlockTree::CreateZOrderedLLList(LogicalLocation *list, int *pglist, int& count) {
+  if ((lloc_.level == 0) && (pmesh_->hilbert_ordering) && !(pmesh_->one_d)) {
+    CreateHilbertOrderedLLList(list, pglist, count);
+    return;
+  }
   if (lloc_.level == 0) {count=0;}
 
   if (pleaf_ == nullptr) {
@@ -349,6 +464,74 @@ void MeshBlockTree::CreateZOrderedLLList(LogicalLocation *list, int *pglist, int
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBlockTree::CreateHilbertOrderedLLList()
+//! \brief Hilbert-ordered version of CreateZOrderedLLList(), called from it when
+//! <mesh>/block_ordering = hilbert.  Each leaf is promoted to the finest level present
+//! in the tree and keyed by the Hilbert distance of its first cell; since the curve is
+//! hierarchical, the leaves of a subtree always occupy a contiguous key range, so the
+//! nleaf siblings created by (de)refinement remain consecutive in the list exactly as
+//! the gid-mapping logic in RedistAndRefineMeshBlocks requires.
+
+void MeshBlockTree::CreateHilbertOrderedLLList(LogicalLocation *list, int *pglist,
+                                               int& count) {
+  std::vector<MeshBlockTree*> leaves;
+  CollectLeaves(leaves);
+
+  // bit depth of the Hilbert cube = finest logical level present in the tree
+  int bmax = 1;
+  for (auto *pl : leaves) {
+    bmax = std::max(bmax, static_cast<int>(pl->lloc_.level));
+  }
+  int ndim = (pmesh_->three_d)? 3 : 2;
+
+  std::vector<HilbertLeaf> keys(leaves.size());
+  for (std::size_t n=0; n<leaves.size(); ++n) {
+    LogicalLocation &ll = leaves[n]->lloc_;
+    int shift = bmax - ll.level;
+    std::uint32_t x[3];
+    x[0] = static_cast<std::uint32_t>(ll.lx1) << shift;
+    x[1] = static_cast<std::uint32_t>(ll.lx2) << shift;
+    x[2] = static_cast<std::uint32_t>(ll.lx3) << shift;
+    AxesToTranspose(x, bmax, ndim);
+    // interleave transposed bits MSB-first into (k0,k1)
+    keys[n].k0 = 0;
+    keys[n].k1 = 0;
+    for (int q=bmax-1; q>=0; q--) {
+      for (int i=0; i<ndim; i++) {
+        keys[n].k0 = (keys[n].k0 << 1) | (keys[n].k1 >> 63);
+        keys[n].k1 = (keys[n].k1 << 1) | ((x[i] >> q) & 1);
+      }
+    }
+    keys[n].pnode = leaves[n];
+  }
+  std::sort(keys.begin(), keys.end());
+
+  count = 0;
+  for (auto &kl : keys) {
+    list[count] = kl.pnode->lloc_;
+    if (pglist != nullptr) {pglist[count] = kl.pnode->gid_;}
+    kl.pnode->gid_ = count;
+    count++;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBlockTree::CollectLeaves()
+//! \brief appends every leaf node in this subtree to the input vector, in Z-order
+
+void MeshBlockTree::CollectLeaves(std::vector<MeshBlockTree*> &leaves) {
+  if (pleaf_ == nullptr) {
+    leaves.push_back(this);
+  } else {
+    for (int n=0; n<nleaf_; n++) {
+      if (pleaf_[n] != nullptr) {pleaf_[n]->CollectLeaves(leaves);}
+    }
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn MeshBlockTree* MeshBlockTree::FindNeighbor(LogicalLocation myloc,
 //!                                   int ox1, int ox2, int ox3, bool amrflag)
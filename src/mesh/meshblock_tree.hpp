@@ -15,6 +15,8 @@
 //
 // Original version of this foundational class written c2015-2016 by K. Tomida.
 
+#include <vector>
+
 //--------------------------------------------------------------------------------------
 //! \class MeshBlockTree
 //  \brief Objects are nodes in a binary tree structure.  Thus, the class name does not
@@ -41,6 +43,7 @@ class MeshBlockTree {
   void CreateRootGrid();
   void AddNode(LogicalLocation rloc, int &nnew);
   void AddNodeWithoutRefinement(LogicalLocation rloc);
+  void AddNodesWithoutRefinement(const LogicalLocation *llist, int nb);
   void Refine(int &nnew);
   void Derefine(int &ndel);
   MeshBlockTree* FindMeshBlock(LogicalLocation tloc);
@@ -50,6 +53,10 @@ class MeshBlockTree {
                               bool amrflag=false);
 
  private:
+  // functions
+  void CreateHilbertOrderedLLList(LogicalLocation *list, int *pglist, int& count);
+  void CollectLeaves(std::vector<MeshBlockTree*> &leaves);
+
   // data: note private variable names have trailing underscore for this class
   MeshBlockTree **pleaf_;  // 1D vector of pointers to leafs
   int gid_;                // grid ID
@@ -20,6 +20,8 @@
 #include "srcterms/srcterms.hpp"
 #include "shearing_box/shearing_box.hpp"
 #include "bvals/bvals.hpp"
+#include "utils/memory_accounting.hpp"
+#include "utils/uvm_spill.hpp"
 #include "mhd/mhd.hpp"
 
 namespace mhd {
@@ -52,7 +54,12 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     e3_cc("e3_cc",1,1,1,1),
     utest("utest",1,1,1,1,1),
     bcctest("bcctest",1,1,1,1,1),
-    fofc("fofc",1,1,1,1) {
+    fofc("fofc",1,1,1,1),
+    fofc_list("fofc_list",1),
+    fofc_count("fofc_count",1),
+    fofc_count_host("fofc_count_host",1) {
+  // attribute device allocations made in this constructor to the mhd subsystem
+  memory_accounting::Scope mem_scope("mhd");
   // Total number of MeshBlocks on this rank to be used in array dimensioning
   int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
 
@@ -144,15 +151,24 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     int n_ccells1 = indcs.cnx1 + 2*(indcs.ng);
     int n_ccells2 = (indcs.cnx2 > 1)? (indcs.cnx2 + 2*(indcs.ng)) : 1;
     int n_ccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
-    Kokkos::realloc(coarse_u0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
-    Kokkos::realloc(coarse_w0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
-    Kokkos::realloc(coarse_b0.x1f, nmb, n_ccells3, n_ccells2, n_ccells1+1);
-    Kokkos::realloc(coarse_b0.x2f, nmb, n_ccells3, n_ccells2+1, n_ccells1);
-    Kokkos::realloc(coarse_b0.x3f, nmb, n_ccells3+1, n_ccells2, n_ccells1);
+    uvm_spill::Realloc(coarse_u0, "mhd_coarse_u0",
+                       nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    uvm_spill::Realloc(coarse_w0, "mhd_coarse_w0",
+                       nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    uvm_spill::Realloc(coarse_b0.x1f, "mhd_coarse_b0.x1f",
+                       nmb, n_ccells3, n_ccells2, n_ccells1+1);
+    uvm_spill::Realloc(coarse_b0.x2f, "mhd_coarse_b0.x2f",
+                       nmb, n_ccells3, n_ccells2+1, n_ccells1);
+    uvm_spill::Realloc(coarse_b0.x3f, "mhd_coarse_b0.x3f",
+                       nmb, n_ccells3+1, n_ccells2, n_ccells1);
   }
 
-  // allocate boundary buffers for conserved (cell-centered) and face-centered variables
-  pbval_u = new MeshBoundaryValuesCC(ppack, pin, false);
+  // allocate boundary buffers for conserved (cell-centered) and face-centered variables.
+  // Optional <mhd>/nghost_comm exchanges fewer ghost cells than <mesh>/nghost when the
+  // mesh width is set by a more demanding module (e.g. Z4c); it must cover the MHD
+  // stencil, and only applies to the cell-centered exchange (B stays at full width)
+  pbval_u = new MeshBoundaryValuesCC(ppack, pin, false,
+                                     pin->GetOrAddInteger("mhd", "nghost_comm", -1));
   pbval_u->InitializeBuffers((nmhd+nscalars));
   pbval_b = new MeshBoundaryValuesFC(ppack, pin);
   pbval_b->InitializeBuffers(3);
@@ -175,6 +191,49 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     // determine if FOFC is enabled
     use_fofc = pin->GetOrAddBoolean("mhd","fofc",false);
 
+    // determine if all three flux directions are computed in a single kernel launch,
+    // which reads the primitives once instead of once per direction
+    one_pass_fluxes = pin->GetOrAddBoolean("mhd","one_pass_fluxes",false);
+    if (one_pass_fluxes && use_fofc) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<mhd>/one_pass_fluxes cannot be used with FOFC"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    // optionally stage the x3 reconstruction stencil in scratch: each plane of the
+    // primitives and cell-centered fields is then loaded once per sweep instead of
+    // five times, equalizing per-direction cost
+    staged_x3 = pin->GetOrAddBoolean("mhd","staged_x3",false);
+
+    // determine if corner E-field computation is fused into the CT update, in which
+    // case only the EMFs on the MeshBlock boundary shell (which are exchanged with
+    // neighboring MeshBlocks) are stored in the global edge-field arrays
+    fused_corner_e_ct = pin->GetOrAddBoolean("mhd","fused_corner_e_ct",false);
+    if (fused_corner_e_ct) {
+      if (!(pmy_pack->pmesh->three_d) || pmy_pack->pmesh->multilevel) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl
+                  << "<mhd>/fused_corner_e_ct requires a 3D single-level mesh"
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (presist != nullptr) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl
+                  << "<mhd>/fused_corner_e_ct cannot be used with resistivity"
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (psrc->shearing_box) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl
+                  << "<mhd>/fused_corner_e_ct cannot be used with the shearing box"
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
     // select reconstruction method (default PLM)
     std::string xorder = pin->GetOrAddString("mhd","reconstruct","plm");
     if (xorder.compare("dc") == 0) {
@@ -274,6 +333,12 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
       // HLLD solver
       } else if (rsolver.compare("hlld") == 0) {
         rsolver_method = MHD_RSolver::hlld;
+      // HLLD solver, variant restructured to reduce GPU register pressure
+      } else if (rsolver.compare("hlld_lowreg") == 0) {
+        rsolver_method = MHD_RSolver::hlld_lowreg;
+      // HLLD solver with per-interface LLF fallback at strong shocks
+      } else if (rsolver.compare("hlld_hybrid") == 0) {
+        rsolver_method = MHD_RSolver::hlld_hybrid;
       // Roe solver
       // } else if (rsolver.compare("roe") == 0) {
       //   rsolver_method = MHD_RSolver::roe;
@@ -304,10 +369,22 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
       int ncells1 = indcs.nx1 + 2*(indcs.ng);
       int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
       int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
-      Kokkos::realloc(u1,     nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(b1.x1f, nmb, ncells3, ncells2, ncells1+1);
-      Kokkos::realloc(b1.x2f, nmb, ncells3, ncells2+1, ncells1);
-      Kokkos::realloc(b1.x3f, nmb, ncells3+1, ncells2, ncells1);
+      // with <time>/flux_accumulation the second registers are eliminated: u1/b1 alias
+      // u0/b0 and CopyCons() rebuilds the weighted stage combination by re-applying the
+      // first stage's flux divergence and EMF curl (two-stage integrators only;
+      // validated by the Driver)
+      flux_accum = pin->GetOrAddBoolean("time", "flux_accumulation", false);
+      if (flux_accum) {
+        u1 = u0;
+        b1.x1f = b0.x1f;
+        b1.x2f = b0.x2f;
+        b1.x3f = b0.x3f;
+      } else {
+        uvm_spill::Realloc(u1, "mhd_u1", nmb, (nmhd+nscalars), ncells3,ncells2,ncells1);
+        uvm_spill::Realloc(b1.x1f, "mhd_b1.x1f", nmb, ncells3, ncells2, ncells1+1);
+        uvm_spill::Realloc(b1.x2f, "mhd_b1.x2f", nmb, ncells3, ncells2+1, ncells1);
+        uvm_spill::Realloc(b1.x3f, "mhd_b1.x3f", nmb, ncells3+1, ncells2, ncells1);
+      }
 
       // allocate fluxes, electric fields
       Kokkos::realloc(uflx.x1f, nmb, (nmhd+nscalars), ncells3, ncells2, ncells1+1);
@@ -317,16 +394,22 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
       Kokkos::realloc(efld.x2e, nmb, ncells3+1, ncells2, ncells1+1);
       Kokkos::realloc(efld.x3e, nmb, ncells3, ncells2+1, ncells1+1);
 
-      // allocate scratch arrays for face- and cell-centered E used in CornerE
+      // allocate scratch arrays for face- and cell-centered E used in CornerE.  Only
+      // the components referenced at this dimensionality are allocated; the rest stay
+      // zero-size (they are captured but never accessed in lower-dimensional kernels)
       Kokkos::realloc(e3x1, nmb, ncells3, ncells2, ncells1);
       Kokkos::realloc(e2x1, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e1x2, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e3x2, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e2x3, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e1x3, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e1_cc, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e2_cc, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e3_cc, nmb, ncells3, ncells2, ncells1);
+      if (pmy_pack->pmesh->multi_d) {
+        Kokkos::realloc(e1x2, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e3x2, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e3_cc, nmb, ncells3, ncells2, ncells1);
+      }
+      if (pmy_pack->pmesh->three_d) {
+        Kokkos::realloc(e2x3, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e1x3, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e1_cc, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e2_cc, nmb, ncells3, ncells2, ncells1);
+      }
 
       // allocate array of flags used with FOFC
       if (use_fofc) {
@@ -336,6 +419,21 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
         Kokkos::realloc(bcctest, nmb, 3,    ncells3, ncells2, ncells1);
         Kokkos::deep_copy(fofc, false);
       }
+
+      // allocate compacted list of flagged-cell indices used with FOFC and/or excision
+      if (use_fofc || ((pmy_pack->pcoord->is_general_relativistic ||
+                        pmy_pack->pcoord->is_dynamical_relativistic) &&
+                       pmy_pack->pcoord->coord_data.bh_excise)) {
+        Kokkos::realloc(fofc_list, nmb*ncells3*ncells2*ncells1);
+      }
+
+      // allocate registers for super-time-stepped diffusion.  Passive scalars are not
+      // diffused, so only nmhd components are stored
+      if (pin->GetOrAddBoolean("time", "sts", false) &&
+          ((pvisc != nullptr) || (pcond != nullptr))) {
+        Kokkos::realloc(u_sts0,   nmb, nmhd, ncells3, ncells2, ncells1);
+        Kokkos::realloc(rhs_sts0, nmb, nmhd, ncells3, ncells2, ncells1);
+      }
     }
   }
 }
@@ -36,7 +36,8 @@ using MHDBoundaryFnPtr = void (*)(int m, Mesh* pm, MHD* pmhd, DvceArray5D<Real>
 }
 
 // constants that enumerate MHD Riemann Solver options
-enum class MHD_RSolver {advect, llf, hlle, hlld, roe,   // non-relativistic
+enum class MHD_RSolver {advect, llf, hlle, hlld, hlld_lowreg,  // non-relativistic
+                        hlld_hybrid, roe,
                         llf_sr, hlle_sr,                // SR
                         llf_gr, hlle_gr};                       // GR
 
@@ -52,6 +53,7 @@ struct MHDTaskIDs {
   TaskID sendf;
   TaskID recvf;
   TaskID rkupdt;
+  TaskID rkupdtb;
   TaskID srctrms;
   TaskID sendu_oa;
   TaskID recvu_oa;
@@ -134,6 +136,10 @@ class MHD {
   DvceArray4D<Real> e2x3, e1x3;
   Real dtnew;
 
+  // following used for super-time-stepped diffusion (<time>/sts=true)
+  DvceArray5D<Real> u_sts0;    // state at start of super-step (Y_0 in RKL2 recurrence)
+  DvceArray5D<Real> rhs_sts0;  // diffusive RHS of Y_0, reused by every RKL2 stage
+
   // following used for time derivatives in computation of jcon
   bool wbcc_saved = false;
   DvceArray5D<Real> wsaved;
@@ -142,6 +148,14 @@ class MHD {
   // following used for FOFC algorithm
   DvceArray4D<bool> fofc;  // flag for each cell to indicate if FOFC is needed
   bool use_fofc = false;   // flag to enable FOFC
+  DvceArray1D<int> fofc_list;   // compacted list of flattened indices of flagged cells
+  DvceArray1D<int> fofc_count;  // single-element device counter for flagged cells
+  StageArray1D<int> fofc_count_host;  // persistent pinned landing buffer for the count
+
+  bool one_pass_fluxes = false;  // compute all three flux directions in one kernel
+  bool staged_x3 = false;  // x3 sweep stages stencil planes in scratch, loaded once each
+  bool fused_corner_e_ct = false;  // recompute interior corner EMFs on the fly in CT
+  bool flux_accum = false;  // u1/b1 alias u0/b0; stage-0 state rebuilt in CopyCons()
 
   // container to hold names of TaskIDs
   MHDTaskIDs id;
@@ -159,6 +173,15 @@ class MHD {
   TaskStatus SendFlux(Driver *d, int stage);
   TaskStatus RecvFlux(Driver *d, int stage);
   TaskStatus RKUpdate(Driver *d, int stage);
+  TaskStatus RKUpdateInterior(Driver *d, int stage);
+  TaskStatus RKUpdateBndry(Driver *d, int stage);
+  TaskStatus RKUpdateRange(Driver *d, int stage,
+                           int is, int ie, int js, int je, int ks, int ke);
+  // ...and templated over dimensionality (same dispatch pattern as CalculateFluxes),
+  // so 1D/2D runs compile without the x2/x3 divergence terms and index arithmetic
+  template <int NDIM>
+  TaskStatus RKUpdateRange(Driver *d, int stage,
+                           int is, int ie, int js, int je, int ks, int ke);
   TaskStatus MHDSrcTerms(Driver *d, int stage);
   TaskStatus SendU_OA(Driver *d, int stage);
   TaskStatus RecvU_OA(Driver *d, int stage);
@@ -187,13 +210,22 @@ class MHD {
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);  // also in Driver::Initialize
 
-  // CalculateFluxes function templated over Riemann Solvers
+  // CalculateFluxes function templated over Riemann Solvers; selects reconstruction
+  // method at compile time and calls the doubly-templated version below
   template <MHD_RSolver T>
   void CalculateFluxes(Driver *d, int stage);
+  // ...and templated over both Riemann solver and reconstruction method, so that each
+  // combination compiles to a fully specialized kernel
+  template <MHD_RSolver T, ReconstructionMethod R>
+  void CalculateFluxes(Driver *d, int stage);
 
   // first-order flux correction
   void FOFC(Driver *d, int stage);
 
+  // super-time-stepped diffusion (called from Driver::SuperTimeStep())
+  void STSUpdate(const int jstage, const Real dt, const Real mu, const Real nu,
+                 const Real mu_tilde, const Real gamma_tilde);
+
   DvceArray5D<Real> utest, bcctest;  // scratch arrays for FOFC
 
  private:
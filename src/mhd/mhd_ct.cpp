@@ -38,6 +38,142 @@ TaskStatus MHD::CT(Driver *pdriver, int stage) {
   auto e3 = efld.x3e;
   auto &mbsize = pmy_pack->pmb->mb_size;
 
+  // Fused corner-EMF + CT update (3D single-level meshes only).  Interior corner EMFs
+  // are recomputed on the fly from the face-centered E-fields and cell-centered EMFs
+  // instead of being read back from the global edge arrays, which CornerE fills (and
+  // SendE/RecvE synchronizes) only on the MeshBlock boundary shell in this mode.
+  if (fused_corner_e_ct) {
+    auto e1cc_ = e1_cc;
+    auto e2cc_ = e2_cc;
+    auto e3cc_ = e3_cc;
+    auto e2x1_ = e2x1;
+    auto e3x1_ = e3x1;
+    auto e1x2_ = e1x2;
+    auto e3x2_ = e3x2;
+    auto e1x3_ = e1x3;
+    auto e2x3_ = e2x3;
+    auto flx1 = uflx.x1f;
+    auto flx2 = uflx.x2f;
+    auto flx3 = uflx.x3f;
+    auto bx1f = b0.x1f;
+    auto bx1f_old = b1.x1f;
+    auto bx2f = b0.x2f;
+    auto bx2f_old = b1.x2f;
+    auto bx3f = b0.x3f;
+    auto bx3f_old = b1.x3f;
+    par_for("CT-fused", DevExeSpace(), 0, nmb1, ks, ke+1, js, je+1, is, ie+1,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      // corner E1 at (m,kk,jj,ii): shell corners read stored (exchanged) values,
+      // interior corners are re-integrated using SG07 (cf. MHD::CornerE)
+      auto CornE1 = [&](const int kk, const int jj, const int ii) -> Real {
+        if ((jj==js) || (jj==je+1) || (kk==ks) || (kk==ke+1)) {
+          return e1(m,kk,jj,ii);
+        }
+        Real e1_l3, e1_r3, e1_l2, e1_r2;
+        if (flx2(m,IDN,kk-1,jj,ii) >= 0.0) {
+          e1_l3 = e1x3_(m,kk,jj-1,ii) - e1cc_(m,kk-1,jj-1,ii);
+        } else {
+          e1_l3 = e1x3_(m,kk,jj  ,ii) - e1cc_(m,kk-1,jj  ,ii);
+        }
+        if (flx2(m,IDN,kk,jj,ii) >= 0.0) {
+          e1_r3 = e1x3_(m,kk,jj-1,ii) - e1cc_(m,kk  ,jj-1,ii);
+        } else {
+          e1_r3 = e1x3_(m,kk,jj  ,ii) - e1cc_(m,kk  ,jj  ,ii);
+        }
+        if (flx3(m,IDN,kk,jj-1,ii) >= 0.0) {
+          e1_l2 = e1x2_(m,kk-1,jj,ii) - e1cc_(m,kk-1,jj-1,ii);
+        } else {
+          e1_l2 = e1x2_(m,kk  ,jj,ii) - e1cc_(m,kk  ,jj-1,ii);
+        }
+        if (flx3(m,IDN,kk,jj,ii) >= 0.0) {
+          e1_r2 = e1x2_(m,kk-1,jj,ii) - e1cc_(m,kk-1,jj  ,ii);
+        } else {
+          e1_r2 = e1x2_(m,kk  ,jj,ii) - e1cc_(m,kk  ,jj  ,ii);
+        }
+        return 0.25*(e1_l3 + e1_r3 + e1_l2 + e1_r2 + e1x2_(m,kk-1,jj,ii) +
+                     e1x2_(m,kk,jj,ii) + e1x3_(m,kk,jj-1,ii) + e1x3_(m,kk,jj,ii));
+      };
+      // corner E2 at (m,kk,jj,ii)
+      auto CornE2 = [&](const int kk, const int jj, const int ii) -> Real {
+        if ((ii==is) || (ii==ie+1) || (kk==ks) || (kk==ke+1)) {
+          return e2(m,kk,jj,ii);
+        }
+        Real e2_l3, e2_r3, e2_l1, e2_r1;
+        if (flx1(m,IDN,kk-1,jj,ii) >= 0.0) {
+          e2_l3 = e2x3_(m,kk,jj,ii-1) - e2cc_(m,kk-1,jj,ii-1);
+        } else {
+          e2_l3 = e2x3_(m,kk,jj,ii  ) - e2cc_(m,kk-1,jj,ii  );
+        }
+        if (flx1(m,IDN,kk,jj,ii) >= 0.0) {
+          e2_r3 = e2x3_(m,kk,jj,ii-1) - e2cc_(m,kk  ,jj,ii-1);
+        } else {
+          e2_r3 = e2x3_(m,kk,jj,ii  ) - e2cc_(m,kk  ,jj,ii  );
+        }
+        if (flx3(m,IDN,kk,jj,ii-1) >= 0.0) {
+          e2_l1 = e2x1_(m,kk-1,jj,ii) - e2cc_(m,kk-1,jj,ii-1);
+        } else {
+          e2_l1 = e2x1_(m,kk  ,jj,ii) - e2cc_(m,kk  ,jj,ii-1);
+        }
+        if (flx3(m,IDN,kk,jj,ii) >= 0.0) {
+          e2_r1 = e2x1_(m,kk-1,jj,ii) - e2cc_(m,kk-1,jj,ii  );
+        } else {
+          e2_r1 = e2x1_(m,kk  ,jj,ii) - e2cc_(m,kk  ,jj,ii  );
+        }
+        return 0.25*(e2_l3 + e2_r3 + e2_l1 + e2_r1 + e2x3_(m,kk,jj,ii-1) +
+                     e2x3_(m,kk,jj,ii) + e2x1_(m,kk-1,jj,ii) + e2x1_(m,kk,jj,ii));
+      };
+      // corner E3 at (m,kk,jj,ii)
+      auto CornE3 = [&](const int kk, const int jj, const int ii) -> Real {
+        if ((ii==is) || (ii==ie+1) || (jj==js) || (jj==je+1)) {
+          return e3(m,kk,jj,ii);
+        }
+        Real e3_l2, e3_r2, e3_l1, e3_r1;
+        if (flx1(m,IDN,kk,jj-1,ii) >= 0.0) {
+          e3_l2 = e3x2_(m,kk,jj,ii-1) - e3cc_(m,kk,jj-1,ii-1);
+        } else {
+          e3_l2 = e3x2_(m,kk,jj,ii  ) - e3cc_(m,kk,jj-1,ii  );
+        }
+        if (flx1(m,IDN,kk,jj,ii) >= 0.0) {
+          e3_r2 = e3x2_(m,kk,jj,ii-1) - e3cc_(m,kk,jj  ,ii-1);
+        } else {
+          e3_r2 = e3x2_(m,kk,jj,ii  ) - e3cc_(m,kk,jj  ,ii  );
+        }
+        if (flx2(m,IDN,kk,jj,ii-1) >= 0.0) {
+          e3_l1 = e3x1_(m,kk,jj-1,ii) - e3cc_(m,kk,jj-1,ii-1);
+        } else {
+          e3_l1 = e3x1_(m,kk,jj  ,ii) - e3cc_(m,kk,jj  ,ii-1);
+        }
+        if (flx2(m,IDN,kk,jj,ii) >= 0.0) {
+          e3_r1 = e3x1_(m,kk,jj-1,ii) - e3cc_(m,kk,jj-1,ii  );
+        } else {
+          e3_r1 = e3x1_(m,kk,jj  ,ii) - e3cc_(m,kk,jj  ,ii  );
+        }
+        return 0.25*(e3_l1 + e3_r1 + e3_l2 + e3_r2 + e3x2_(m,kk,jj,ii-1) +
+                     e3x2_(m,kk,jj,ii) + e3x1_(m,kk,jj-1,ii) + e3x1_(m,kk,jj,ii));
+      };
+
+      // update B1
+      if ((j <= je) && (k <= ke)) {
+        bx1f(m,k,j,i) = gam0*bx1f(m,k,j,i) + gam1*bx1f_old(m,k,j,i);
+        bx1f(m,k,j,i) -= beta_dt*(CornE3(k,j+1,i) - CornE3(k,j,i))/mbsize.d_view(m).dx2;
+        bx1f(m,k,j,i) += beta_dt*(CornE2(k+1,j,i) - CornE2(k,j,i))/mbsize.d_view(m).dx3;
+      }
+      // update B2
+      if ((i <= ie) && (k <= ke)) {
+        bx2f(m,k,j,i) = gam0*bx2f(m,k,j,i) + gam1*bx2f_old(m,k,j,i);
+        bx2f(m,k,j,i) += beta_dt*(CornE3(k,j,i+1) - CornE3(k,j,i))/mbsize.d_view(m).dx1;
+        bx2f(m,k,j,i) -= beta_dt*(CornE1(k+1,j,i) - CornE1(k,j,i))/mbsize.d_view(m).dx3;
+      }
+      // update B3
+      if ((i <= ie) && (j <= je)) {
+        bx3f(m,k,j,i) = gam0*bx3f(m,k,j,i) + gam1*bx3f_old(m,k,j,i);
+        bx3f(m,k,j,i) -= beta_dt*(CornE2(k,j,i+1) - CornE2(k,j,i))/mbsize.d_view(m).dx1;
+        bx3f(m,k,j,i) += beta_dt*(CornE1(k,j+1,i) - CornE1(k,j,i))/mbsize.d_view(m).dx2;
+      }
+    });
+    return TaskStatus::complete;
+  }
+
   //---- update B1 (only for 2D/3D problems)
   if (multi_d) {
     auto bx1f = b0.x1f;
@@ -15,6 +15,8 @@
 #include "mesh/mesh.hpp"
 #include "mhd.hpp"
 #include "eos/eos.hpp"
+#include "diffusion/viscosity.hpp"
+#include "diffusion/conduction.hpp"
 #include "reconstruct/dc.hpp"
 #include "reconstruct/plm.hpp"
 #include "reconstruct/ppm.hpp"
@@ -23,6 +25,8 @@
 #include "mhd/rsolvers/llf_mhd.hpp"
 #include "mhd/rsolvers/hlle_mhd.hpp"
 #include "mhd/rsolvers/hlld_mhd.hpp"
+#include "mhd/rsolvers/hlld_mhd_lowreg.hpp"
+#include "mhd/rsolvers/hlld_hybrid_mhd.hpp"
 #include "mhd/rsolvers/llf_srmhd.hpp"
 #include "mhd/rsolvers/hlle_srmhd.hpp"
 #include "mhd/rsolvers/llf_grmhd.hpp"
@@ -34,9 +38,10 @@ namespace mhd {
 //! \fn void MHD::CalculateFlux
 //! \brief Calculate fluxes of conserved variables, and face-centered area-averaged EMFs
 //! for evolution of magnetic field
-//! Note this function is templated over RS for better performance on GPUs.
+//! Note this function is templated over both RS and reconstruction method for better
+//! performance on GPUs, so each combination compiles to a fully specialized kernel.
 
-template <MHD_RSolver rsolver_method_>
+template <MHD_RSolver rsolver_method_, ReconstructionMethod recon_method_>
 void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   RegionIndcs &indcs_ = pmy_pack->pmesh->mb_indcs;
   int is = indcs_.is, ie = indcs_.ie;
@@ -47,9 +52,8 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   int &nmhd_ = nmhd;
   int nvars = nmhd + nscalars;
   int nmb1 = pmy_pack->nmb_thispack - 1;
-  const auto recon_method_ = recon_method;
   bool extrema = false;
-  if (recon_method == ReconstructionMethod::ppmx) {
+  if constexpr (recon_method_ == ReconstructionMethod::ppmx) {
     extrema = true;
   }
 
@@ -58,6 +62,336 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   auto &coord_ = pmy_pack->pcoord->coord_data;
   auto &w0_ = w0;
   auto &b0_ = bcc0;
+  bool multi_d_ = pmy_pack->pmesh->multi_d;
+  bool three_d_ = pmy_pack->pmesh->three_d;
+
+  // viscous and (isotropic) conductive fluxes are added inside the kernels below, while
+  // each row of fluxes is still in cache.  The temperature-dependent conductivity and
+  // the Ohmic energy flux keep their own passes (see Fluxes); with super-time-stepping
+  // viscosity and conduction are applied by Driver::SuperTimeStep() instead
+  bool add_visc_ = (pvisc != nullptr) && !(pdriver->sts);
+  Real nu_iso_ = (add_visc_)? pvisc->nu_iso : 0.0;
+  bool add_cond_ = (pcond != nullptr) && !(pdriver->sts) &&
+                   !(pcond->tdep_kappa) && (pcond->kappa > 0.0);
+  Real kappa_ = (add_cond_)? pcond->kappa : 0.0;
+  const bool is_ideal_ = eos_.is_ideal;
+  const bool use_e_ = eos_.use_e;
+  Real gm1_ = eos_.gamma - 1.0;
+
+  // With GR excision, FOFC rebuilds every face of a fully flux-masked pencil at first
+  // order each stage, so high-order fluxes computed there are always discarded; the
+  // sweeps below skip such pencils outright.
+  const bool excise_ = pmy_pack->pcoord->coord_data.bh_excise;
+  auto &excision_pencil_ = pmy_pack->pcoord->excision_pencil;
+
+  //--------------------------------------------------------------------------------------
+  // single-launch mode: compute fluxes in all three directions in one kernel, so each
+  // row's stencil of w0/bcc0 is read while still resident in cache.  The x2/x3
+  // interface states are built by reconstructing both adjacent rows, trading some
+  // redundant reconstruction work for a 3x reduction in reads of the primitives
+
+  if (one_pass_fluxes) {
+    size_t scr_size_1p = (ScrArray2D<Real>::shmem_size(nvars, ncells1) +
+                          ScrArray2D<Real>::shmem_size(3, ncells1)) * 3;
+    bool multi_d = pmy_pack->pmesh->multi_d;
+    bool three_d = pmy_pack->pmesh->three_d;
+    int kl_1p = (three_d)? ks-1 : ks;
+    int ku_1p = (three_d)? ke+1 : ke;
+    int jl_1p = (multi_d)? js-1 : js;
+    int ju_1p = (multi_d)? je+1 : je;
+    auto &flx1_1p = uflx.x1f;
+    auto &flx2_1p = uflx.x2f;
+    auto &flx3_1p = uflx.x3f;
+    auto &bx_1p = b0.x1f;
+    auto &by_1p = b0.x2f;
+    auto &bz_1p = b0.x3f;
+    auto &e31_1p = e3x1;
+    auto &e21_1p = e2x1;
+    auto &e12_1p = e1x2;
+    auto &e32_1p = e3x2;
+    auto &e23_1p = e2x3;
+    auto &e13_1p = e1x3;
+
+    par_for_outer("mhd_flux_1pass",DevExeSpace(), scr_size_1p, 0, 0, nmb1,
+                  kl_1p, ku_1p, jl_1p, ju_1p,
+    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+      // every face this team writes belongs to a cell of row (k,j), so if the whole
+      // pencil is flux-masked all of them are rebuilt by FOFC; skip the row
+      if (excise_ && excision_pencil_(m,k,j)) {
+        return;
+      }
+      ScrArray2D<Real> wl(member.team_scratch(0), nvars, ncells1);
+      ScrArray2D<Real> wr(member.team_scratch(0), nvars, ncells1);
+      ScrArray2D<Real> wtmp(member.team_scratch(0), nvars, ncells1);
+      ScrArray2D<Real> bl(member.team_scratch(0), 3, ncells1);
+      ScrArray2D<Real> br(member.team_scratch(0), 3, ncells1);
+      ScrArray2D<Real> btmp(member.team_scratch(0), 3, ncells1);
+      // NOTE(@pdmullen): Capture variables prior to if constexpr.  Required for cuda
+      // 11.6+.
+      auto eos = eos_;
+      auto indcs = indcs_;
+      auto size = size_;
+      auto coord = coord_;
+      auto flx1 = flx1_1p;
+      auto flx2 = flx2_1p;
+      auto flx3 = flx3_1p;
+      auto bx = bx_1p;
+      auto by = by_1p;
+      auto bz = bz_1p;
+      auto e31 = e31_1p;
+      auto e21 = e21_1p;
+      auto e12 = e12_1p;
+      auto e32 = e32_1p;
+      auto e23 = e23_1p;
+      auto e13 = e13_1p;
+
+      // x1-fluxes for this row: reconstruct qR[i] and qL[i+1], for both W and Bcc
+      {
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX1(member, m, k, j, is-1, ie+1, w0_, wl, wr);
+          DonorCellX1(member, m, k, j, is-1, ie+1, b0_, bl, br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX1(member, m, k, j, is-1, ie+1, w0_, wl, wr);
+          PiecewiseLinearX1(member, m, k, j, is-1, ie+1, b0_, bl, br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          PiecewiseParabolicX1(member,eos,extrema,true,  m,k,j, is-1, ie+1, w0_, wl, wr);
+          PiecewiseParabolicX1(member,eos,extrema,false, m,k,j, is-1, ie+1, b0_, bl, br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX1(member, eos, true,  m, k, j, is-1, ie+1, w0_, wl, wr);
+          WENOZX1(member, eos, false, m, k, j, is-1, ie+1, b0_, bl, br);
+        }
+        member.team_barrier();
+
+        if constexpr (rsolver_method_ == MHD_RSolver::advect) {
+          Advect(member,eos,indcs,size,coord,m,k,j,is,ie+1,IVX,wl,wr,bl,br,bx,flx1,
+                 e31,e21);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::llf) {
+          LLF(member,eos,indcs,size,coord,m,k,j,is,ie+1,IVX,wl,wr,bl,br,bx,flx1,e31,e21);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlle) {
+          HLLE(member,eos,indcs,size,coord,m,k,j,is,ie+1,IVX,wl,wr,bl,br,bx,flx1,e31,e21);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlld) {
+          HLLD(member,eos,indcs,size,coord,m,k,j,is,ie+1,IVX,wl,wr,bl,br,bx,flx1,e31,e21);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_lowreg) {
+          HLLD_LowReg(member,eos,indcs,size,coord,m,k,j,is,ie+1,IVX,wl,wr,bl,br,bx,flx1,
+                      e31,e21);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_hybrid) {
+          HLLD_Hybrid(member,eos,indcs,size,coord,m,k,j,is,ie+1,IVX,wl,wr,bl,br,bx,flx1,
+                      e31,e21);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::llf_sr) {
+          LLF_SR(member,eos,indcs,size,coord,m,k,j,is,ie+1,IVX,wl,wr,bl,br,bx,flx1,
+                 e31,e21);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlle_sr) {
+          HLLE_SR(member,eos,indcs,size,coord,m,k,j,is,ie+1,IVX,wl,wr,bl,br,bx,flx1,
+                  e31,e21);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::llf_gr) {
+          LLF_GR(member,eos,indcs,size,coord,m,k,j,is,ie+1,IVX,wl,wr,bl,br,bx,flx1,
+                 e31,e21);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlle_gr) {
+          HLLE_GR(member,eos,indcs,size,coord,m,k,j,is,ie+1,IVX,wl,wr,bl,br,bx,flx1,
+                  e31,e21);
+        }
+        member.team_barrier();
+
+        if (nvars > nmhd_) {
+          for (int n=nmhd_; n<nvars; ++n) {
+            par_for_inner(member, is, ie+1, [&](const int i) {
+              if (flx1(m,IDN,k,j,i) >= 0.0) {
+                flx1(m,n,k,j,i) = flx1(m,IDN,k,j,i)*wl(n,i);
+              } else {
+                flx1(m,n,k,j,i) = flx1(m,IDN,k,j,i)*wr(n,i);
+              }
+            });
+          }
+          member.team_barrier();
+        }
+
+        // add diffusive fluxes while this row is still in cache
+        if ((add_visc_ || add_cond_) && (k >= ks) && (k <= ke) &&
+            (j >= js) && (j <= je)) {
+          if (add_visc_) {
+            IsoViscousFluxX1(member, is_ideal_, size, nu_iso_, multi_d_, three_d_,
+                             m, k, j, is, ie+1, w0_, flx1);
+          }
+          if (add_cond_) {
+            IsoHeatFluxX1(member, use_e_, gm1_, size, kappa_, m, k, j, is, ie+1,
+                          w0_, flx1);
+          }
+        }
+      }
+
+      // x2-fluxes on interface j: qL from reconstructing row j-1, qR from row j
+      if (multi_d && (j >= js)) {
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX2(member, m, k, j-1, is-1, ie+1, w0_, wl, wtmp);
+          DonorCellX2(member, m, k, j,   is-1, ie+1, w0_, wtmp, wr);
+          DonorCellX2(member, m, k, j-1, is-1, ie+1, b0_, bl, btmp);
+          DonorCellX2(member, m, k, j,   is-1, ie+1, b0_, btmp, br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX2(member, m, k, j-1, is-1, ie+1, w0_, wl, wtmp);
+          PiecewiseLinearX2(member, m, k, j,   is-1, ie+1, w0_, wtmp, wr);
+          PiecewiseLinearX2(member, m, k, j-1, is-1, ie+1, b0_, bl, btmp);
+          PiecewiseLinearX2(member, m, k, j,   is-1, ie+1, b0_, btmp, br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          PiecewiseParabolicX2(member,eos,extrema,true, m,k,j-1,is-1,ie+1,w0_,wl,wtmp);
+          PiecewiseParabolicX2(member,eos,extrema,true, m,k,j,  is-1,ie+1,w0_,wtmp,wr);
+          PiecewiseParabolicX2(member,eos,extrema,false,m,k,j-1,is-1,ie+1,b0_,bl,btmp);
+          PiecewiseParabolicX2(member,eos,extrema,false,m,k,j,  is-1,ie+1,b0_,btmp,br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX2(member, eos, true,  m, k, j-1, is-1, ie+1, w0_, wl, wtmp);
+          WENOZX2(member, eos, true,  m, k, j,   is-1, ie+1, w0_, wtmp, wr);
+          WENOZX2(member, eos, false, m, k, j-1, is-1, ie+1, b0_, bl, btmp);
+          WENOZX2(member, eos, false, m, k, j,   is-1, ie+1, b0_, btmp, br);
+        }
+        member.team_barrier();
+
+        if constexpr (rsolver_method_ == MHD_RSolver::advect) {
+          Advect(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::llf) {
+          LLF(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlle) {
+          HLLE(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlld) {
+          HLLD(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_lowreg) {
+          HLLD_LowReg(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_hybrid) {
+          HLLD_Hybrid(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::llf_sr) {
+          LLF_SR(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlle_sr) {
+          HLLE_SR(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::llf_gr) {
+          LLF_GR(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlle_gr) {
+          HLLE_GR(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+        }
+        member.team_barrier();
+
+        if (nvars > nmhd_) {
+          for (int n=nmhd_; n<nvars; ++n) {
+            par_for_inner(member, is, ie, [&](const int i) {
+              if (flx2(m,IDN,k,j,i) >= 0.0) {
+                flx2(m,n,k,j,i) = flx2(m,IDN,k,j,i)*wl(n,i);
+              } else {
+                flx2(m,n,k,j,i) = flx2(m,IDN,k,j,i)*wr(n,i);
+              }
+            });
+          }
+          member.team_barrier();
+        }
+
+        // add diffusive fluxes while this row is still in cache
+        if ((add_visc_ || add_cond_) && (k >= ks) && (k <= ke)) {
+          if (add_visc_) {
+            IsoViscousFluxX2(member, is_ideal_, size, nu_iso_, three_d_,
+                             m, k, j, is, ie, w0_, flx2);
+          }
+          if (add_cond_) {
+            IsoHeatFluxX2(member, use_e_, gm1_, size, kappa_, m, k, j, is, ie,
+                          w0_, flx2);
+          }
+        }
+      }
+
+      // x3-fluxes on interface k: qL from reconstructing row k-1, qR from row k
+      if (three_d && (k >= ks)) {
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX3(member, m, k-1, j, is-1, ie+1, w0_, wl, wtmp);
+          DonorCellX3(member, m, k,   j, is-1, ie+1, w0_, wtmp, wr);
+          DonorCellX3(member, m, k-1, j, is-1, ie+1, b0_, bl, btmp);
+          DonorCellX3(member, m, k,   j, is-1, ie+1, b0_, btmp, br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX3(member, m, k-1, j, is-1, ie+1, w0_, wl, wtmp);
+          PiecewiseLinearX3(member, m, k,   j, is-1, ie+1, w0_, wtmp, wr);
+          PiecewiseLinearX3(member, m, k-1, j, is-1, ie+1, b0_, bl, btmp);
+          PiecewiseLinearX3(member, m, k,   j, is-1, ie+1, b0_, btmp, br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          PiecewiseParabolicX3(member,eos,extrema,true, m,k-1,j,is-1,ie+1,w0_,wl,wtmp);
+          PiecewiseParabolicX3(member,eos,extrema,true, m,k,  j,is-1,ie+1,w0_,wtmp,wr);
+          PiecewiseParabolicX3(member,eos,extrema,false,m,k-1,j,is-1,ie+1,b0_,bl,btmp);
+          PiecewiseParabolicX3(member,eos,extrema,false,m,k,  j,is-1,ie+1,b0_,btmp,br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX3(member, eos, true,  m, k-1, j, is-1, ie+1, w0_, wl, wtmp);
+          WENOZX3(member, eos, true,  m, k,   j, is-1, ie+1, w0_, wtmp, wr);
+          WENOZX3(member, eos, false, m, k-1, j, is-1, ie+1, b0_, bl, btmp);
+          WENOZX3(member, eos, false, m, k,   j, is-1, ie+1, b0_, btmp, br);
+        }
+        member.team_barrier();
+
+        if constexpr (rsolver_method_ == MHD_RSolver::advect) {
+          Advect(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::llf) {
+          LLF(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlle) {
+          HLLE(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlld) {
+          HLLD(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_lowreg) {
+          HLLD_LowReg(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_hybrid) {
+          HLLD_Hybrid(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::llf_sr) {
+          LLF_SR(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlle_sr) {
+          HLLE_SR(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::llf_gr) {
+          LLF_GR(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+        } else if constexpr (rsolver_method_ == MHD_RSolver::hlle_gr) {
+          HLLE_GR(member,eos,indcs,size,coord,
+                  m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+        }
+        member.team_barrier();
+
+        if (nvars > nmhd_) {
+          for (int n=nmhd_; n<nvars; ++n) {
+            par_for_inner(member, is, ie, [&](const int i) {
+              if (flx3(m,IDN,k,j,i) >= 0.0) {
+                flx3(m,n,k,j,i) = flx3(m,IDN,k,j,i)*wl(n,i);
+              } else {
+                flx3(m,n,k,j,i) = flx3(m,IDN,k,j,i)*wr(n,i);
+              }
+            });
+          }
+          member.team_barrier();
+        }
+
+        // add diffusive fluxes while this row is still in cache
+        if ((add_visc_ || add_cond_) && (j >= js) && (j <= je)) {
+          if (add_visc_) {
+            IsoViscousFluxX3(member, is_ideal_, size, nu_iso_, m, k, j, is, ie,
+                             w0_, flx3);
+          }
+          if (add_cond_) {
+            IsoHeatFluxX3(member, use_e_, gm1_, size, kappa_, m, k, j, is, ie,
+                          w0_, flx3);
+          }
+        }
+      }
+    });
+    return;
+  }
 
   //--------------------------------------------------------------------------------------
   // i-direction
@@ -84,32 +418,29 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
 
   par_for_outer("mhd_flux1",DevExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku, jl, ju,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    // all x1 faces of a fully flux-masked pencil are rebuilt by FOFC; skip the row
+    if (excise_ && excision_pencil_(m,k,j)) {
+      return;
+    }
     ScrArray2D<Real> wl(member.team_scratch(scr_level), nvars, ncells1);
     ScrArray2D<Real> wr(member.team_scratch(scr_level), nvars, ncells1);
     ScrArray2D<Real> bl(member.team_scratch(scr_level), 3, ncells1);
     ScrArray2D<Real> br(member.team_scratch(scr_level), 3, ncells1);
 
     // Reconstruct qR[i] and qL[i+1], for both W and Bcc
-    switch (recon_method_) {
-      case ReconstructionMethod::dc:
-        DonorCellX1(member, m, k, j, il-1, iu, w0_, wl, wr);
-        DonorCellX1(member, m, k, j, il-1, iu, b0_, bl, br);
-        break;
-      case ReconstructionMethod::plm:
-        PiecewiseLinearX1(member, m, k, j, il-1, iu, w0_, wl, wr);
-        PiecewiseLinearX1(member, m, k, j, il-1, iu, b0_, bl, br);
-        break;
-      case ReconstructionMethod::ppm4:
-      case ReconstructionMethod::ppmx:
-        PiecewiseParabolicX1(member,eos_,extrema,true,  m, k, j, il-1, iu, w0_, wl, wr);
-        PiecewiseParabolicX1(member,eos_,extrema,false, m, k, j, il-1, iu, b0_, bl, br);
-        break;
-      case ReconstructionMethod::wenoz:
-        WENOZX1(member, eos_, true,  m, k, j, il-1, iu, w0_, wl, wr);
-        WENOZX1(member, eos_, false, m, k, j, il-1, iu, b0_, bl, br);
-        break;
-      default:
-        break;
+    if constexpr (recon_method_ == ReconstructionMethod::dc) {
+      DonorCellX1(member, m, k, j, il-1, iu, w0_, wl, wr);
+      DonorCellX1(member, m, k, j, il-1, iu, b0_, bl, br);
+    } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+      PiecewiseLinearX1(member, m, k, j, il-1, iu, w0_, wl, wr);
+      PiecewiseLinearX1(member, m, k, j, il-1, iu, b0_, bl, br);
+    } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                         recon_method_ == ReconstructionMethod::ppmx) {
+      PiecewiseParabolicX1(member,eos_,extrema,true,  m, k, j, il-1, iu, w0_, wl, wr);
+      PiecewiseParabolicX1(member,eos_,extrema,false, m, k, j, il-1, iu, b0_, bl, br);
+    } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+      WENOZX1(member, eos_, true,  m, k, j, il-1, iu, w0_, wl, wr);
+      WENOZX1(member, eos_, false, m, k, j, il-1, iu, b0_, bl, br);
     }
     // Sync all threads in the team so that scratch memory is consistent
     member.team_barrier();
@@ -134,6 +465,12 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
       HLLE(member,eos,indcs,size,coord,m,k,j,il,iu,IVX,wl,wr,bl,br,bx,flx1,e31,e21);
     } else if constexpr (rsolver_method_ == MHD_RSolver::hlld) {
       HLLD(member,eos,indcs,size,coord,m,k,j,il,iu,IVX,wl,wr,bl,br,bx,flx1,e31,e21);
+    } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_lowreg) {
+      HLLD_LowReg(member,eos,indcs,size,coord,m,k,j,il,iu,IVX,wl,wr,bl,br,bx,flx1,
+                  e31,e21);
+    } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_hybrid) {
+      HLLD_Hybrid(member,eos,indcs,size,coord,m,k,j,il,iu,IVX,wl,wr,bl,br,bx,flx1,
+                  e31,e21);
     } else if constexpr (rsolver_method_ == MHD_RSolver::llf_sr) {
       LLF_SR(member,eos,indcs,size,coord,m,k,j,il,iu,IVX,wl,wr,bl,br,bx,flx1,e31,e21);
     } else if constexpr (rsolver_method_ == MHD_RSolver::hlle_sr) {
@@ -157,6 +494,18 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
         });
       }
     }
+
+    // add diffusive fluxes while this row is still in cache
+    if ((add_visc_ || add_cond_) && (k >= ks) && (k <= ke) && (j >= js) && (j <= je)) {
+      if (add_visc_) {
+        IsoViscousFluxX1(member, is_ideal_, size, nu_iso_, multi_d_, three_d_,
+                         m, k, j, is, ie+1, w0_, flx1);
+      }
+      if (add_cond_) {
+        IsoHeatFluxX1(member, use_e_, gm1_, size, kappa_, m, k, j, is, ie+1,
+                      w0_, flx1);
+      }
+    }
   });
 
   //--------------------------------------------------------------------------------------
@@ -203,34 +552,37 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
           bl_jp1 = scr4;
         }
 
+        // FOFC rebuilds face j of a fully flux-masked pencil, so its Riemann solve is
+        // skipped; reconstruction is only needed if face j or face j+1 survives
+        const bool skip_j = excise_ && excision_pencil_(m,k,j);
+        const bool skip_recon =
+            skip_j && (j == ju || excision_pencil_(m,k,j+1));
+
         // Reconstruct qR[j] and qL[j+1], for both W and Bcc
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
+        if (!skip_recon) {
+          if constexpr (recon_method_ == ReconstructionMethod::dc) {
             DonorCellX2(member, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
             DonorCellX2(member, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
-            break;
-          case ReconstructionMethod::plm:
+          } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
             PiecewiseLinearX2(member, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
             PiecewiseLinearX2(member, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
-            break;
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
-            PiecewiseParabolicX2(member,eos_,extrema,true, m,k,j,is-1,ie+1,w0_,wl_jp1,wr);
-            PiecewiseParabolicX2(member,eos_,extrema,false,m,k,j,is-1,ie+1,b0_,bl_jp1,br);
-            break;
-          case ReconstructionMethod::wenoz:
+          } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                               recon_method_ == ReconstructionMethod::ppmx) {
+            PiecewiseParabolicX2(member,eos_,extrema,true, m,k,j,is-1,ie+1,w0_,
+                                 wl_jp1,wr);
+            PiecewiseParabolicX2(member,eos_,extrema,false,m,k,j,is-1,ie+1,b0_,
+                                 bl_jp1,br);
+          } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
             WENOZX2(member, eos_, true,  m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
             WENOZX2(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
-            break;
-          default:
-            break;
+          }
         }
         member.team_barrier();
 
         // compute fluxes over [js,je+1].  MHD RS also computes electric fields, where
         // (IBY) component of flx = E_{x} = -(v x B)_{x} = -(v2*b3 - v3*b2)
         // (IBZ) component of flx = E_{z} = -(v x B)_{z} =  (v2*b1 - v1*b2)
-        if (j>jl) {
+        if (j>jl && !skip_j) {
           // NOTE(@pdmullen): Capture variables prior to if constexpr.
           auto eos = eos_;
           auto indcs = indcs_;
@@ -252,6 +604,12 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
           } else if constexpr (rsolver_method_ == MHD_RSolver::hlld) {
             HLLD(member,eos,indcs,size,coord,
                     m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+          } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_lowreg) {
+            HLLD_LowReg(member,eos,indcs,size,coord,
+                    m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+          } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_hybrid) {
+            HLLD_Hybrid(member,eos,indcs,size,coord,
+                    m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
           } else if constexpr (rsolver_method_ == MHD_RSolver::llf_sr) {
             LLF_SR(member,eos,indcs,size,coord,
                     m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
@@ -269,7 +627,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
         }
 
         // calculate fluxes of scalars (if any)
-        if (nvars > nmhd_) {
+        if (nvars > nmhd_ && !skip_j) {
           for (int n=nmhd_; n<nvars; ++n) {
             par_for_inner(member, is, ie, [&](const int i) {
               if (flx2_(m,IDN,k,j,i) >= 0.0) {
@@ -280,6 +638,19 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
             });
           }
         }
+
+        // add diffusive fluxes while this row is still in cache
+        if ((add_visc_ || add_cond_) && !skip_j && (k >= ks) && (k <= ke) &&
+            (j >= js) && (j <= je+1)) {
+          if (add_visc_) {
+            IsoViscousFluxX2(member, is_ideal_, size_, nu_iso_, three_d_,
+                             m, k, j, is, ie, w0_, flx2_);
+          }
+          if (add_cond_) {
+            IsoHeatFluxX2(member, use_e_, gm1_, size_, kappa_, m, k, j, is, ie,
+                          w0_, flx2_);
+          }
+        }
       } // end of loop over j
     });
   }
@@ -290,6 +661,13 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   if (pmy_pack->pmesh->three_d) {
     scr_size = (ScrArray2D<Real>::shmem_size(nvars, ncells1) +
                 ScrArray2D<Real>::shmem_size(3, ncells1)) * 3;
+    // optional staging tiles holding a five-plane rolling window of w0 and bcc0, so
+    // each plane is loaded from the global arrays once per sweep rather than once per
+    // stencil touch
+    bool staged_ = staged_x3;
+    int stage_cols = (staged_)? 5*ncells1 : 0;
+    scr_size += ScrArray2D<Real>::shmem_size(nvars, stage_cols) +
+                ScrArray2D<Real>::shmem_size(3, stage_cols);
     auto &flx3_ = uflx.x3f;
     auto &bz_ = b0.x3f;
     auto &e23_ = e2x3;
@@ -307,6 +685,31 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
       ScrArray2D<Real> scr4(member.team_scratch(scr_level), 3, ncells1);
       ScrArray2D<Real> scr5(member.team_scratch(scr_level), 3, ncells1);
       ScrArray2D<Real> scr6(member.team_scratch(scr_level), 3, ncells1);
+      ScrArray2D<Real> w0s(member.team_scratch(scr_level), nvars, stage_cols);
+      ScrArray2D<Real> b0s(member.team_scratch(scr_level), 3, stage_cols);
+
+      // stencil radius of the reconstruction method, sizing the staged plane window
+      constexpr int rad =
+          (recon_method_ == ReconstructionMethod::dc)  ? 0 :
+          (recon_method_ == ReconstructionMethod::plm) ? 1 : 2;
+
+      // preload all but the leading plane of the rolling window; plane p lives at
+      // column offset ((p-kl+rad)%5)*ncells1 of the tiles
+      if (staged_) {
+        for (int kk=kl-rad; kk<=kl+rad-1; ++kk) {
+          int s = ((kk-kl+rad)%5)*ncells1;
+          for (int n=0; n<nvars; ++n) {
+            par_for_inner(member, is-1, ie+1, [&](const int i) {
+              w0s(n,s+i) = w0_(m,n,kk,j,i);
+            });
+          }
+          for (int n=0; n<3; ++n) {
+            par_for_inner(member, is-1, ie+1, [&](const int i) {
+              b0s(n,s+i) = b0_(m,n,kk,j,i);
+            });
+          }
+        }
+      }
 
       for (int k=kl; k<=ku; ++k) {
         // Permute scratch arrays.
@@ -323,34 +726,84 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
           bl_kp1 = scr4;
         }
 
+        // FOFC rebuilds face k of a fully flux-masked pencil, so its Riemann solve is
+        // skipped; reconstruction is only needed if face k or face k+1 survives
+        const bool skip_k = excise_ && excision_pencil_(m,k,j);
+        const bool skip_recon =
+            skip_k && (k == ku || excision_pencil_(m,k+1,j));
+
+        // load the leading plane of the rolling window, replacing the plane that has
+        // fallen out of the stencil, then compute this iteration's column offsets
+        int sm2=0, sm1=0, sc=0, sp1=0, sp2=0;
+        if (staged_) {
+          int s = ((k-kl+2*rad)%5)*ncells1;
+          for (int n=0; n<nvars; ++n) {
+            par_for_inner(member, is-1, ie+1, [&](const int i) {
+              w0s(n,s+i) = w0_(m,n,k+rad,j,i);
+            });
+          }
+          for (int n=0; n<3; ++n) {
+            par_for_inner(member, is-1, ie+1, [&](const int i) {
+              b0s(n,s+i) = b0_(m,n,k+rad,j,i);
+            });
+          }
+          member.team_barrier();
+          sm2 = ((k-kl  )%5)*ncells1;
+          sm1 = ((k-kl+1)%5)*ncells1;
+          sc  = ((k-kl+2)%5)*ncells1;
+          sp1 = ((k-kl+3)%5)*ncells1;
+          sp2 = ((k-kl+4)%5)*ncells1;
+        }
+
         // Reconstruct qR[k] and qL[k+1], for both W and Bcc
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
-            DonorCellX3(member, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
-            DonorCellX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
-            break;
-          case ReconstructionMethod::plm:
-            PiecewiseLinearX3(member, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
-            PiecewiseLinearX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
-            break;
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
-            PiecewiseParabolicX3(member,eos_,extrema,true, m,k,j,is-1,ie+1,w0_,wl_kp1,wr);
-            PiecewiseParabolicX3(member,eos_,extrema,false,m,k,j,is-1,ie+1,b0_,bl_kp1,br);
-            break;
-          case ReconstructionMethod::wenoz:
-            WENOZX3(member, eos_, true,  m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
-            WENOZX3(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
-            break;
-          default:
-            break;
+        if (!skip_recon) {
+          if constexpr (recon_method_ == ReconstructionMethod::dc) {
+            if (staged_) {
+              DonorCellX3Staged(member, is-1, ie+1, w0s, sm2, wl_kp1, wr);
+              DonorCellX3Staged(member, is-1, ie+1, b0s, sm2, bl_kp1, br);
+            } else {
+              DonorCellX3(member, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
+              DonorCellX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
+            }
+          } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+            if (staged_) {
+              PiecewiseLinearX3Staged(member, is-1, ie+1, w0s, sm2,sm1,sc, wl_kp1, wr);
+              PiecewiseLinearX3Staged(member, is-1, ie+1, b0s, sm2,sm1,sc, bl_kp1, br);
+            } else {
+              PiecewiseLinearX3(member, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
+              PiecewiseLinearX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
+            }
+          } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                               recon_method_ == ReconstructionMethod::ppmx) {
+            if (staged_) {
+              PiecewiseParabolicX3Staged(member, eos_, extrema, true, is-1, ie+1, w0s,
+                                         sm2, sm1, sc, sp1, sp2, wl_kp1, wr);
+              PiecewiseParabolicX3Staged(member, eos_, extrema, false, is-1, ie+1, b0s,
+                                         sm2, sm1, sc, sp1, sp2, bl_kp1, br);
+            } else {
+              PiecewiseParabolicX3(member,eos_,extrema,true, m,k,j,is-1,ie+1,w0_,
+                                   wl_kp1,wr);
+              PiecewiseParabolicX3(member,eos_,extrema,false,m,k,j,is-1,ie+1,b0_,
+                                   bl_kp1,br);
+            }
+          } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+            if (staged_) {
+              WENOZX3Staged(member, eos_, true,  is-1, ie+1, w0s, sm2, sm1, sc, sp1,
+                            sp2, wl_kp1, wr);
+              WENOZX3Staged(member, eos_, false, is-1, ie+1, b0s, sm2, sm1, sc, sp1,
+                            sp2, bl_kp1, br);
+            } else {
+              WENOZX3(member, eos_, true,  m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
+              WENOZX3(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
+            }
+          }
         }
         member.team_barrier();
 
         // compute fluxes over [ks,ke+1].  MHD RS also computes electric fields, where
         // (IBY) component of flx = E_{y} = -(v x B)_{y} = -(v3*b1 - v1*b3)
         // (IBZ) component of flx = E_{x} = -(v x B)_{x} =  (v3*b2 - v2*b3)
-        if (k>kl) {
+        if (k>kl && !skip_k) {
           // NOTE(@pdmullen): Capture variables prior to if constexpr.
           auto eos = eos_;
           auto indcs = indcs_;
@@ -372,6 +825,12 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
           } else if constexpr (rsolver_method_ == MHD_RSolver::hlld) {
             HLLD(member,eos,indcs,size,coord,
                     m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+          } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_lowreg) {
+            HLLD_LowReg(member,eos,indcs,size,coord,
+                    m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+          } else if constexpr (rsolver_method_ == MHD_RSolver::hlld_hybrid) {
+            HLLD_Hybrid(member,eos,indcs,size,coord,
+                    m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
           } else if constexpr (rsolver_method_ == MHD_RSolver::llf_sr) {
             LLF_SR(member,eos,indcs,size,coord,
                     m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
@@ -389,7 +848,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
         }
 
         // calculate fluxes of scalars (if any)
-        if (nvars > nmhd_) {
+        if (nvars > nmhd_ && !skip_k) {
           for (int n=nmhd_; n<nvars; ++n) {
             par_for_inner(member, is, ie, [&](const int i) {
               if (flx3_(m,IDN,k,j,i) >= 0.0) {
@@ -400,6 +859,19 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
             });
           }
         }
+
+        // add diffusive fluxes while this row is still in cache
+        if ((add_visc_ || add_cond_) && !skip_k && (k >= ks) && (k <= ke+1) &&
+            (j >= js) && (j <= je)) {
+          if (add_visc_) {
+            IsoViscousFluxX3(member, is_ideal_, size_, nu_iso_, m, k, j, is, ie,
+                             w0_, flx3_);
+          }
+          if (add_cond_) {
+            IsoHeatFluxX3(member, use_e_, gm1_, size_, kappa_, m, k, j, is, ie,
+                          w0_, flx3_);
+          }
+        }
       } // end loop over k
     });
   }
@@ -407,11 +879,42 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MHD::CalculateFluxes
+//! \brief Selects reconstruction method at compile time, so that the flux kernels above
+//! are fully specialized over both the Riemann solver and the reconstruction method
+
+template <MHD_RSolver rsolver_method_>
+void MHD::CalculateFluxes(Driver *pdriver, int stage) {
+  switch (recon_method) {
+    case ReconstructionMethod::dc:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::dc>(pdriver, stage);
+      break;
+    case ReconstructionMethod::plm:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::plm>(pdriver, stage);
+      break;
+    case ReconstructionMethod::ppm4:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::ppm4>(pdriver, stage);
+      break;
+    case ReconstructionMethod::ppmx:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::ppmx>(pdriver, stage);
+      break;
+    case ReconstructionMethod::wenoz:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::wenoz>(pdriver, stage);
+      break;
+    default:
+      break;
+  }
+  return;
+}
+
 // function definitions for each template parameter
 template void MHD::CalculateFluxes<MHD_RSolver::advect>(Driver *pdriver, int stage);
 template void MHD::CalculateFluxes<MHD_RSolver::llf>(Driver *pdriver, int stage);
 template void MHD::CalculateFluxes<MHD_RSolver::hlle>(Driver *pdriver, int stage);
 template void MHD::CalculateFluxes<MHD_RSolver::hlld>(Driver *pdriver, int stage);
+template void MHD::CalculateFluxes<MHD_RSolver::hlld_lowreg>(Driver *pdriver, int stage);
+template void MHD::CalculateFluxes<MHD_RSolver::hlld_hybrid>(Driver *pdriver, int stage);
 template void MHD::CalculateFluxes<MHD_RSolver::llf_sr>(Driver *pdriver, int stage);
 template void MHD::CalculateFluxes<MHD_RSolver::hlle_sr>(Driver *pdriver, int stage);
 template void MHD::CalculateFluxes<MHD_RSolver::llf_gr>(Driver *pdriver, int stage);
@@ -61,6 +61,7 @@ void MHD::FOFC(Driver *pdriver, int stage) {
     auto &utest_ = utest;
     auto &bcctest_ = bcctest;
     auto &b1_ = b1;
+    bool fl_accum = flux_accum;
 
     // Index bounds
     int il = is-1, iu = ie+1, jl = js, ju = je, kl = ks, ku = ke;
@@ -91,9 +92,18 @@ void MHD::FOFC(Driver *pdriver, int stage) {
       Real b2old = 0.5*(b1_.x2f(m,k,j,i) + b1_.x2f(m,k,j+1,i));
       Real b3old = 0.5*(b1_.x3f(m,k,j,i) + b1_.x3f(m,k+1,j,i));
 
-      bcctest_(m,IBX,k,j,i) = gam0*bcc0_(m,IBX,k,j,i) + gam1*b1old;
-      bcctest_(m,IBY,k,j,i) = gam0*bcc0_(m,IBY,k,j,i) + gam1*b2old;
-      bcctest_(m,IBZ,k,j,i) = gam0*bcc0_(m,IBZ,k,j,i) + gam1*b3old;
+      if (fl_accum) {
+        // with flux accumulation b1 aliases b0, whose faces already hold the weighted
+        // combination gam0*B^new + gam1*B^old, so the averages above are the combined
+        // cell-centered field directly
+        bcctest_(m,IBX,k,j,i) = b1old;
+        bcctest_(m,IBY,k,j,i) = b2old;
+        bcctest_(m,IBZ,k,j,i) = b3old;
+      } else {
+        bcctest_(m,IBX,k,j,i) = gam0*bcc0_(m,IBX,k,j,i) + gam1*b1old;
+        bcctest_(m,IBY,k,j,i) = gam0*bcc0_(m,IBY,k,j,i) + gam1*b2old;
+        bcctest_(m,IBZ,k,j,i) = gam0*bcc0_(m,IBZ,k,j,i) + gam1*b3old;
+      }
 
       bcctest_(m,IBY,k,j,i) += dtodx1*(e3x1_(m,k,j,i+1) - e3x1_(m,k,j,i));
       bcctest_(m,IBZ,k,j,i) -= dtodx1*(e2x1_(m,k,j,i+1) - e2x1_(m,k,j,i));
@@ -128,9 +138,15 @@ void MHD::FOFC(Driver *pdriver, int stage) {
   if (multi_d) { jl = js-1, ju = je+1; }
   if (three_d) { kl = ks-1, ku = ke+1; }
 
-  // Replace fluxes with first-order LLF fluxes at i,j,k faces for any cell where FOFC
-  // and/or excision is used (if GR+excising)
-  par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
+  // Build compacted list of indices of all flagged cells, so that the (typically rare)
+  // flux replacements below are launched over flagged cells only, not the entire grid
+  int ni = iu - il + 1;
+  int nji = (ju - jl + 1)*ni;
+  int nkji = (ku - kl + 1)*nji;
+  auto &flist_ = fofc_list;
+  auto &fcnt_ = fofc_count;
+  Kokkos::deep_copy(fcnt_, 0);
+  par_for("FOFC-list", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Check for FOFC flag
     bool fofc_flag = false;
@@ -142,8 +158,32 @@ void MHD::FOFC(Driver *pdriver, int stage) {
       if (use_excise_) { fofc_excision = excision_flux_(m,k,j,i); }
     }
 
-    // Apply FOFC
     if (fofc_flag || fofc_excision) {
+      int indx = Kokkos::atomic_fetch_add(&fcnt_(0), 1);
+      flist_(indx) = m*nkji + (k-kl)*nji + (j-jl)*ni + (i-il);
+    }
+  });
+
+  // copy number of flagged cells to host; skip the correction passes if none flagged
+  Kokkos::deep_copy(fofc_count_host, fofc_count);
+  int nflagged = fofc_count_host(0);
+  if (nflagged == 0) { return; }
+
+  // Replace fluxes with first-order LLF fluxes at i,j,k faces for any cell where FOFC
+  // and/or excision is used (if GR+excising)
+  par_for("FOFC-flx", DevExeSpace(), 0, nflagged-1,
+  KOKKOS_LAMBDA(const int n) {
+    // Decode flagged cell indices from compacted list
+    int indx = flist_(n);
+    int m = indx/nkji;
+    int k = (indx - m*nkji)/nji;
+    int j = (indx - m*nkji - k*nji)/ni;
+    int i = (indx - m*nkji - k*nji - j*ni) + il;
+    k += kl;
+    j += jl;
+
+    // Apply FOFC
+    {
       // load W_{i-1} state
       MHDPrim1D wim1;
       wim1.d  = w0_(m,IDN,k,j,i-1);
@@ -307,20 +347,19 @@ void MHD::FOFC(Driver *pdriver, int stage) {
 
   // Replace fluxes with first-order LLF fluxes at i+1,j+1,k+1 faces for any cell where
   // FOFC and/or excision is used (if GR+excising)
-  par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
-  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    // Check for FOFC flag
-    bool fofc_flag = false;
-    if (use_fofc_) { fofc_flag = fofc_(m,k,j,i); }
-
-    // Check for GR + excision
-    bool fofc_excision = false;
-    if (is_gr) {
-      if (use_excise_) { fofc_excision = excision_flux_(m,k,j,i); }
-    }
+  par_for("FOFC-flx", DevExeSpace(), 0, nflagged-1,
+  KOKKOS_LAMBDA(const int n) {
+    // Decode flagged cell indices from compacted list
+    int indx = flist_(n);
+    int m = indx/nkji;
+    int k = (indx - m*nkji)/nji;
+    int j = (indx - m*nkji - k*nji)/ni;
+    int i = (indx - m*nkji - k*nji - j*ni) + il;
+    k += kl;
+    j += jl;
 
     // Apply FOFC
-    if (fofc_flag || fofc_excision) {
+    {
       // load W_{i} state
       MHDPrim1D wi;
       wi.d  = w0_(m,IDN,k,j,i);
@@ -67,6 +67,15 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
       min_dt2 = fmin((mbsize.d_view(m).dx2/fabs(w0_(m,IVY,k,j,i))), min_dt2);
       min_dt3 = fmin((mbsize.d_view(m).dx3/fabs(w0_(m,IVZ,k,j,i))), min_dt3);
     }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3));
+  } else if (is_general_relativistic_ || is_dynamical_relativistic_) {
+    // in GR the maximum signal speed is the speed of light, so the minimum dt depends
+    // only on the grid spacing of each MeshBlock; reduce over blocks on the host
+    // instead of sweeping the whole grid
+    for (int m=0; m<(pmy_pack->nmb_thispack); ++m) {
+      dt1 = std::min(dt1, mbsize.h_view(m).dx1);
+      dt2 = std::min(dt2, mbsize.h_view(m).dx2);
+      dt3 = std::min(dt3, mbsize.h_view(m).dx3);
+    }
   } else {
     // find smallest dx/(v +/- Cf) in each direction for mhd problems
     auto &bcc0_ = bcc0;
@@ -82,13 +91,8 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
       j += js;
       Real max_dv1 = 0.0, max_dv2 = 0.0, max_dv3 = 0.0;
 
-      // timestep in GR MHD
-      if (is_general_relativistic_ || is_dynamical_relativistic_) {
-        max_dv1 = 1.0;
-        max_dv2 = 1.0;
-        max_dv3 = 1.0;
       // timestep in SR MHD
-      } else if (is_special_relativistic_) {
+      if (is_special_relativistic_) {
         Real &wd = w0_(m,IDN,k,j,i);
         Real &ux = w0_(m,IVX,k,j,i);
         Real &uy = w0_(m,IVY,k,j,i);
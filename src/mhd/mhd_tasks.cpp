@@ -38,47 +38,81 @@ void MHD::AssembleMHDTasks(std::map<std::string, std::shared_ptr<TaskList>> tl)
   TaskID none(0);
 
   // assemble "before_timeintegrator" task list
-  id.savest = tl["before_timeintegrator"]->AddTask(&MHD::SaveMHDState, this, none);
+  id.savest = tl["before_timeintegrator"]->AddTask(&MHD::SaveMHDState, this, none,
+      "MHD::SaveMHDState");
 
   // assemble "before_stagen" task list
-  id.irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, this, none);
+  id.irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, this, none, "MHD::InitRecv");
 
   // assemble "stagen" task list
-  id.copyu     = tl["stagen"]->AddTask(&MHD::CopyCons, this, none);
-  id.flux      = tl["stagen"]->AddTask(&MHD::Fluxes, this, id.copyu);
-  id.sendf     = tl["stagen"]->AddTask(&MHD::SendFlux, this, id.flux);
-  id.recvf     = tl["stagen"]->AddTask(&MHD::RecvFlux, this, id.sendf);
-  id.rkupdt    = tl["stagen"]->AddTask(&MHD::RKUpdate, this, id.recvf);
-  id.srctrms   = tl["stagen"]->AddTask(&MHD::MHDSrcTerms, this, id.rkupdt);
-  id.sendu_oa  = tl["stagen"]->AddTask(&MHD::SendU_OA, this, id.srctrms);
-  id.recvu_oa  = tl["stagen"]->AddTask(&MHD::RecvU_OA, this, id.sendu_oa);
-  id.restu     = tl["stagen"]->AddTask(&MHD::RestrictU, this, id.recvu_oa);
-  id.sendu     = tl["stagen"]->AddTask(&MHD::SendU, this, id.restu);
-  id.recvu     = tl["stagen"]->AddTask(&MHD::RecvU, this, id.sendu);
-  id.sendu_shr = tl["stagen"]->AddTask(&MHD::SendU_Shr, this, id.recvu);
-  id.recvu_shr = tl["stagen"]->AddTask(&MHD::RecvU_Shr, this, id.sendu_shr);
-  id.efld      = tl["stagen"]->AddTask(&MHD::CornerE, this, id.recvu_shr);
-  id.efldsrc   = tl["stagen"]->AddTask(&MHD::EFieldSrc, this, id.efld);
-  id.sende     = tl["stagen"]->AddTask(&MHD::SendE, this, id.efldsrc);
-  id.recve     = tl["stagen"]->AddTask(&MHD::RecvE, this, id.sende);
-  id.ct        = tl["stagen"]->AddTask(&MHD::CT, this, id.recve);
-  id.sendb_oa  = tl["stagen"]->AddTask(&MHD::SendB_OA, this, id.ct);
-  id.recvb_oa  = tl["stagen"]->AddTask(&MHD::RecvB_OA, this, id.sendb_oa);
-  id.restb     = tl["stagen"]->AddTask(&MHD::RestrictB, this, id.recvb_oa);
-  id.sendb     = tl["stagen"]->AddTask(&MHD::SendB, this, id.restb);
-  id.recvb     = tl["stagen"]->AddTask(&MHD::RecvB, this, id.sendb);
-  id.sendb_shr = tl["stagen"]->AddTask(&MHD::SendB_Shr, this, id.recvb);
-  id.recvb_shr = tl["stagen"]->AddTask(&MHD::RecvB_Shr, this, id.sendb_shr);
-  id.bcs       = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, this, id.recvb_shr);
-  id.prol      = tl["stagen"]->AddTask(&MHD::Prolongate, this, id.bcs);
-  id.c2p       = tl["stagen"]->AddTask(&MHD::ConToPrim, this, id.prol);
-  id.newdt     = tl["stagen"]->AddTask(&MHD::NewTimeStep, this, id.c2p);
+  id.copyu     = tl["stagen"]->AddTask(&MHD::CopyCons, this, none, "MHD::CopyCons");
+  id.flux      = tl["stagen"]->AddTask(&MHD::Fluxes, this, id.copyu, "MHD::Fluxes");
+  id.sendf     = tl["stagen"]->AddTask(&MHD::SendFlux, this, id.flux, "MHD::SendFlux");
+  id.recvf     = tl["stagen"]->AddTask(&MHD::RecvFlux, this, id.sendf, "MHD::RecvFlux");
+  // interior update does not depend on corrected fluxes, so it only waits on Fluxes and
+  // overlaps with flux-correction communication; the one-cell strip adjacent to the
+  // MeshBlock faces is updated separately once RecvFlux completes
+  id.rkupdt    = tl["stagen"]->AddTask(&MHD::RKUpdateInterior, this, id.flux,
+      "MHD::RKUpdateInterior");
+  TaskID dep_rkb = id.recvf | id.rkupdt;
+  id.rkupdtb   = tl["stagen"]->AddTask(&MHD::RKUpdateBndry, this, dep_rkb,
+      "MHD::RKUpdateBndry");
+  id.srctrms   = tl["stagen"]->AddTask(&MHD::MHDSrcTerms, this, id.rkupdtb,
+      "MHD::MHDSrcTerms");
+  id.sendu_oa  = tl["stagen"]->AddTask(&MHD::SendU_OA, this, id.srctrms, "MHD::SendU_OA");
+  id.recvu_oa  = tl["stagen"]->AddTask(&MHD::RecvU_OA, this, id.sendu_oa,
+      "MHD::RecvU_OA");
+  id.restu     = tl["stagen"]->AddTask(&MHD::RestrictU, this, id.recvu_oa,
+      "MHD::RestrictU");
+  id.sendu     = tl["stagen"]->AddTask(&MHD::SendU, this, id.restu, "MHD::SendU");
+  id.recvu     = tl["stagen"]->AddTask(&MHD::RecvU, this, id.sendu, "MHD::RecvU");
+  id.sendu_shr = tl["stagen"]->AddTask(&MHD::SendU_Shr, this, id.recvu, "MHD::SendU_Shr");
+  id.recvu_shr = tl["stagen"]->AddTask(&MHD::RecvU_Shr, this, id.sendu_shr,
+      "MHD::RecvU_Shr");
+  id.efld      = tl["stagen"]->AddTask(&MHD::CornerE, this, id.recvu_shr, "MHD::CornerE");
+  id.efldsrc   = tl["stagen"]->AddTask(&MHD::EFieldSrc, this, id.efld, "MHD::EFieldSrc");
+  id.sende     = tl["stagen"]->AddTask(&MHD::SendE, this, id.efldsrc, "MHD::SendE");
+  id.recve     = tl["stagen"]->AddTask(&MHD::RecvE, this, id.sende, "MHD::RecvE");
+  id.ct        = tl["stagen"]->AddTask(&MHD::CT, this, id.recve, "MHD::CT");
+  id.sendb_oa  = tl["stagen"]->AddTask(&MHD::SendB_OA, this, id.ct, "MHD::SendB_OA");
+  id.recvb_oa  = tl["stagen"]->AddTask(&MHD::RecvB_OA, this, id.sendb_oa,
+      "MHD::RecvB_OA");
+  id.restb     = tl["stagen"]->AddTask(&MHD::RestrictB, this, id.recvb_oa,
+      "MHD::RestrictB");
+  id.sendb     = tl["stagen"]->AddTask(&MHD::SendB, this, id.restb, "MHD::SendB");
+  id.recvb     = tl["stagen"]->AddTask(&MHD::RecvB, this, id.sendb, "MHD::RecvB");
+  id.sendb_shr = tl["stagen"]->AddTask(&MHD::SendB_Shr, this, id.recvb, "MHD::SendB_Shr");
+  id.recvb_shr = tl["stagen"]->AddTask(&MHD::RecvB_Shr, this, id.sendb_shr,
+      "MHD::RecvB_Shr");
+  id.bcs       = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, this, id.recvb_shr,
+      "MHD::ApplyPhysicalBCs");
+  id.prol      = tl["stagen"]->AddTask(&MHD::Prolongate, this, id.bcs, "MHD::Prolongate");
+  id.c2p       = tl["stagen"]->AddTask(&MHD::ConToPrim, this, id.prol, "MHD::ConToPrim");
+  id.newdt     = tl["stagen"]->AddTask(&MHD::NewTimeStep, this, id.c2p,
+      "MHD::NewTimeStep");
+
+  // hoist send-side tasks ahead of local-only work and drain receives last, so MPI
+  // messages are on the wire before long compute kernels run and polling for messages
+  // that have not arrived does not block tasks that are ready
+  tl["stagen"]->SetPriority(id.sendf, 1);
+  tl["stagen"]->SetPriority(id.sendu, 1);
+  tl["stagen"]->SetPriority(id.sendu_shr, 1);
+  tl["stagen"]->SetPriority(id.sende, 1);
+  tl["stagen"]->SetPriority(id.sendb, 1);
+  tl["stagen"]->SetPriority(id.sendb_shr, 1);
+  tl["stagen"]->SetPriority(id.recvf, -1);
+  tl["stagen"]->SetPriority(id.recvu, -1);
+  tl["stagen"]->SetPriority(id.recvu_shr, -1);
+  tl["stagen"]->SetPriority(id.recve, -1);
+  tl["stagen"]->SetPriority(id.recvb, -1);
+  tl["stagen"]->SetPriority(id.recvb_shr, -1);
 
   // assemble "after_stagen" task list
-  id.csend = tl["after_stagen"]->AddTask(&MHD::ClearSend, this, none);
+  id.csend = tl["after_stagen"]->AddTask(&MHD::ClearSend, this, none, "MHD::ClearSend");
   // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
   // task list anyways to catch potential bugs in MPI communication logic
-  id.crecv = tl["after_stagen"]->AddTask(&MHD::ClearRecv, this, id.csend);
+  id.crecv = tl["after_stagen"]->AddTask(&MHD::ClearRecv, this, id.csend,
+      "MHD::ClearRecv");
 
   return;
 }
@@ -154,9 +188,89 @@ TaskStatus MHD::InitRecv(Driver *pdrive, int stage) {
 
 //----------------------------------------------------------------------------------------
 //! \fn TaskStatus MHD::CopyCons
-//! \brief Simple task list function that copies u0 --> u1, and b0 --> b1 in first stage
+//! \brief Simple task list function that copies u0 --> u1, and b0 --> b1 in first stage.
+//! With <time>/flux_accumulation u1/b1 alias u0/b0 and there is nothing to copy;
+//! instead, at the second stage this task re-applies the first stage's flux divergence
+//! and EMF curl (still in uflx/efld, which the Fluxes and CornerE tasks have not yet
+//! overwritten) with weight gam1*beta0*dt, turning u0/b0 into the weighted combinations
+//! gam0*U^1 + gam1*U^0 and gam0*B^1 + gam1*B^0 that the update kernels would otherwise
+//! assemble from the two registers; their gam0*u0 + gam1*u1 then reduces to u0 exactly
+//! (gam0 + gam1 = 1 for rk1/rk2).  Divergence and curl terms are accumulated in the
+//! same per-direction order as RKUpdateRange() and CT() so round-off matches the
+//! two-register update.
 
 TaskStatus MHD::CopyCons(Driver *pdrive, int stage) {
+  if (flux_accum) {
+    if (stage == 2) {
+      auto &indcs = pmy_pack->pmesh->mb_indcs;
+      int is = indcs.is, ie = indcs.ie;
+      int js = indcs.js, je = indcs.je;
+      int ks = indcs.ks, ke = indcs.ke;
+      bool &multi_d = pmy_pack->pmesh->multi_d;
+      bool &three_d = pmy_pack->pmesh->three_d;
+      Real g1b0_dt = (pdrive->gam1[1])*(pdrive->beta[0])*(pmy_pack->pmesh->dt);
+      int nmb1 = pmy_pack->nmb_thispack - 1;
+      int nvar = nmhd + nscalars;
+      auto u0_ = u0;
+      auto flx1 = uflx.x1f;
+      auto flx2 = uflx.x2f;
+      auto flx3 = uflx.x3f;
+      auto &mbsize = pmy_pack->pmb->mb_size;
+
+      // FOFC tests a one-cell ring outside the active cells, where first-stage fluxes
+      // were also computed, so rebuild the combination there as well
+      int il = is, iu = ie, jl = js, ju = je, kl = ks, ku = ke;
+      if (use_fofc) {
+        il -= 1; iu += 1;
+        if (multi_d) {jl -= 1; ju += 1;}
+        if (three_d) {kl -= 1; ku += 1;}
+      }
+      par_for("mhd_flx_accum",DevExeSpace(),0,nmb1,0,nvar-1,kl,ku,jl,ju,il,iu,
+      KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+        Real divf = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+        if (multi_d) {
+          divf += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+        }
+        if (three_d) {
+          divf += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+        }
+        u0_(m,n,k,j,i) += g1b0_dt*divf;
+      });
+
+      // re-apply the first stage's EMF curl to the face-centered fields with the signs
+      // of CT() reversed, over the same face ranges as CT()
+      auto e1 = efld.x1e;
+      auto e2 = efld.x2e;
+      auto e3 = efld.x3e;
+      if (multi_d) {
+        auto bx1f = b0.x1f;
+        par_for("mhd_emf_accum1", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
+        KOKKOS_LAMBDA(int m, int k, int j, int i) {
+          bx1f(m,k,j,i) += g1b0_dt*(e3(m,k,j+1,i) - e3(m,k,j,i))/mbsize.d_view(m).dx2;
+          if (three_d) {
+            bx1f(m,k,j,i) -= g1b0_dt*(e2(m,k+1,j,i) - e2(m,k,j,i))/mbsize.d_view(m).dx3;
+          }
+        });
+      }
+      auto bx2f = b0.x2f;
+      par_for("mhd_emf_accum2", DevExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
+      KOKKOS_LAMBDA(int m, int k, int j, int i) {
+        bx2f(m,k,j,i) -= g1b0_dt*(e3(m,k,j,i+1) - e3(m,k,j,i))/mbsize.d_view(m).dx1;
+        if (three_d) {
+          bx2f(m,k,j,i) += g1b0_dt*(e1(m,k+1,j,i) - e1(m,k,j,i))/mbsize.d_view(m).dx3;
+        }
+      });
+      auto bx3f = b0.x3f;
+      par_for("mhd_emf_accum3", DevExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
+      KOKKOS_LAMBDA(int m, int k, int j, int i) {
+        bx3f(m,k,j,i) += g1b0_dt*(e2(m,k,j,i+1) - e2(m,k,j,i))/mbsize.d_view(m).dx1;
+        if (multi_d) {
+          bx3f(m,k,j,i) -= g1b0_dt*(e1(m,k,j+1,i) - e1(m,k,j,i))/mbsize.d_view(m).dx2;
+        }
+      });
+    }
+    return TaskStatus::complete;
+  }
   if (stage == 1) {
     Kokkos::deep_copy(DevExeSpace(), u1, u0);
     Kokkos::deep_copy(DevExeSpace(), b1.x1f, b0.x1f);
@@ -181,6 +295,10 @@ TaskStatus MHD::Fluxes(Driver *pdrive, int stage) {
     CalculateFluxes<MHD_RSolver::hlle>(pdrive, stage);
   } else if (rsolver_method == MHD_RSolver::hlld) {
     CalculateFluxes<MHD_RSolver::hlld>(pdrive, stage);
+  } else if (rsolver_method == MHD_RSolver::hlld_lowreg) {
+    CalculateFluxes<MHD_RSolver::hlld_lowreg>(pdrive, stage);
+  } else if (rsolver_method == MHD_RSolver::hlld_hybrid) {
+    CalculateFluxes<MHD_RSolver::hlld_hybrid>(pdrive, stage);
   } else if (rsolver_method == MHD_RSolver::llf_sr) {
     CalculateFluxes<MHD_RSolver::llf_sr>(pdrive, stage);
   } else if (rsolver_method == MHD_RSolver::hlle_sr) {
@@ -191,15 +309,16 @@ TaskStatus MHD::Fluxes(Driver *pdrive, int stage) {
     CalculateFluxes<MHD_RSolver::hlle_gr>(pdrive, stage);
   }
 
-  // Add viscous, resistive, heat-flux, etc fluxes
-  if (pvisc != nullptr) {
-    pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
-  }
+  // Viscous and isotropic conductive fluxes are fused into the flux kernels above; only
+  // the Ohmic energy flux (which needs face-centered B) and the temperature-dependent
+  // conductivity require their own full-grid passes.  With super-time-stepping viscosity
+  // and conduction are applied by Driver::SuperTimeStep() instead; resistivity updates
+  // B through the corner EMFs in CT and always remains on the main integrator
   if ((presist != nullptr) && (peos->eos_data.is_ideal)) {
     presist->OhmicEnergyFlux(b0, uflx);
   }
-  if (pcond != nullptr) {
-    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  if ((pcond != nullptr) && !(pdrive->sts) && pcond->tdep_kappa) {
+    pcond->TempDependentHeatFlux(w0, peos->eos_data, uflx);
   }
 
   // call FOFC if necessary
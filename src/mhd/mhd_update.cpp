@@ -19,14 +19,53 @@
 namespace mhd {
 //----------------------------------------------------------------------------------------
 //! \fn  void MHD::Update
-//  \brief Explicit RK update including flux divergence terms
+//  \brief Explicit RK update including flux divergence terms over all active cells.
+//  Wrapper over RKUpdateRange(); used directly by task lists (e.g. ion-neutral,
+//  radiation, dynamical GR) that do not split the update around flux-correction recvs.
 
 TaskStatus MHD::RKUpdate(Driver *pdriver, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  return RKUpdateRange(pdriver, stage, indcs.is, indcs.ie, indcs.js, indcs.je,
+                       indcs.ks, indcs.ke);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void MHD::RKUpdateInterior
+//  \brief Explicit RK update of interior cells, i.e. those whose flux divergence cannot
+//  be changed by flux corrections from finer neighbors (which only overwrite fluxes on
+//  the outermost faces of a MeshBlock).  Runs without waiting on RecvFlux, so this
+//  update overlaps with flux-correction communication; the remaining one-cell-wide
+//  strip is updated by RKUpdateBndry() once the corrected fluxes have arrived.
+
+TaskStatus MHD::RKUpdateInterior(Driver *pdriver, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  // on single-level meshes there are no flux corrections, so update everything here
+  if (!(pmy_pack->pmesh->multilevel)) {
+    return RKUpdateRange(pdriver, stage, indcs.is, indcs.ie, indcs.js, indcs.je,
+                         indcs.ks, indcs.ke);
+  }
+  int il = indcs.is + 1, iu = indcs.ie - 1;
+  int jl = indcs.js, ju = indcs.je;
+  int kl = indcs.ks, ku = indcs.ke;
+  if (pmy_pack->pmesh->multi_d) {jl += 1; ju -= 1;}
+  if (pmy_pack->pmesh->three_d) {kl += 1; ku -= 1;}
+  return RKUpdateRange(pdriver, stage, il, iu, jl, ju, kl, ku);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void MHD::RKUpdateBndry
+//  \brief Explicit RK update of the one-cell-wide strip adjacent to MeshBlock faces,
+//  skipped by RKUpdateInterior().  Gated on RecvFlux in the task list, so it sees
+//  corrected fluxes on faces shared with finer neighbors.  No-op on single-level
+//  meshes, where RKUpdateInterior() already updated every cell.  Face-centered B is
+//  untouched here; it is evolved by CT() after the EMF corrections are received.
+
+TaskStatus MHD::RKUpdateBndry(Driver *pdriver, int stage) {
+  if (!(pmy_pack->pmesh->multilevel)) {return TaskStatus::complete;}
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int is = indcs.is, ie = indcs.ie;
   int js = indcs.js, je = indcs.je;
   int ks = indcs.ks, ke = indcs.ke;
-  int ncells1 = indcs.nx1 + 2*(indcs.ng);
   bool &multi_d = pmy_pack->pmesh->multi_d;
   bool &three_d = pmy_pack->pmesh->three_d;
 
@@ -42,6 +81,70 @@ TaskStatus MHD::RKUpdate(Driver *pdriver, int stage) {
   auto flx3 = uflx.x3f;
   auto &mbsize = pmy_pack->pmb->mb_size;
 
+  // loop over all (k,j) rows; rows on x2/x3 faces update every i, while rows interior
+  // in x2/x3 update only the two cells on the x1 faces.  This partitions the strip
+  // exactly, so no cell is updated twice.  Divergence terms are accumulated in the same
+  // per-direction order as RKUpdateRange() so round-off is identical to unsplit update
+  par_for_outer("mhd_update_bndry",DevExeSpace(),0,0,0,nmb1,0,nv1,ks,ke,js,je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int n, const int k, const int j) {
+    bool row_on_face = (multi_d && ((j == js) || (j == je))) ||
+                       (three_d && ((k == ks) || (k == ke)));
+    par_for_inner(member, is, ie, [&](const int i) {
+      if (row_on_face || (i == is) || (i == ie)) {
+        Real divf = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+        if (multi_d) {
+          divf += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+        }
+        if (three_d) {
+          divf += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+        }
+        u0_(m,n,k,j,i) = gam0*u0_(m,n,k,j,i) + gam1*u1_(m,n,k,j,i) - beta_dt*divf;
+      }
+    });
+  });
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void MHD::RKUpdateRange
+//  \brief Explicit RK update of cells in [is:ie,js:je,ks:ke] on every MeshBlock.
+//  Dispatches at runtime on the mesh dimensionality to the templated version below,
+//  following the same pattern used to select Riemann solvers in CalculateFluxes()
+
+TaskStatus MHD::RKUpdateRange(Driver *pdriver, int stage,
+                              int is, int ie, int js, int je, int ks, int ke) {
+  if (pmy_pack->pmesh->three_d) {
+    return RKUpdateRange<3>(pdriver, stage, is, ie, js, je, ks, ke);
+  } else if (pmy_pack->pmesh->multi_d) {
+    return RKUpdateRange<2>(pdriver, stage, is, ie, js, je, ks, ke);
+  }
+  return RKUpdateRange<1>(pdriver, stage, is, ie, js, je, ks, ke);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void MHD::RKUpdateRange (templated over dimensionality)
+//  \brief Explicit RK update of cells in [is:ie,js:je,ks:ke] on every MeshBlock.  The
+//  x2/x3 divergence terms are guarded by if constexpr on NDIM, so the 1D and 2D
+//  instantiations carry no index arithmetic or branches for the absent dimensions
+
+template <int NDIM>
+TaskStatus MHD::RKUpdateRange(Driver *pdriver, int stage,
+                              int is, int ie, int js, int je, int ks, int ke) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+
+  Real &gam0 = pdriver->gam0[stage-1];
+  Real &gam1 = pdriver->gam1[stage-1];
+  Real beta_dt = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nv1 = nmhd + nscalars - 1;
+  auto u0_ = u0;
+  auto u1_ = u1;
+  auto flx1 = uflx.x1f;
+  auto flx2 = uflx.x2f;
+  auto flx3 = uflx.x3f;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+
   // hierarchical parallel loop that updates conserved variables to intermediate step
   // using weights and fractional time step appropriate to stages of time-integrator used
   // Vector inner loop used for good performance on cpus
@@ -60,7 +163,7 @@ TaskStatus MHD::RKUpdate(Driver *pdriver, int stage) {
 
     // Add dF2/dx2
     // Fluxes must be summed in pairs to symmetrize round-off error in each dir
-    if (multi_d) {
+    if constexpr (NDIM >= 2) {
       par_for_inner(member, is, ie, [&](const int i) {
         divf(i) += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
       });
@@ -69,7 +172,7 @@ TaskStatus MHD::RKUpdate(Driver *pdriver, int stage) {
 
     // Add dF3/dx3
     // Fluxes must be summed in pairs to symmetrize round-off error in each dir
-    if (three_d) {
+    if constexpr (NDIM >= 3) {
       par_for_inner(member, is, ie, [&](const int i) {
         divf(i) += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
       });
@@ -82,4 +185,12 @@ TaskStatus MHD::RKUpdate(Driver *pdriver, int stage) {
   });
   return TaskStatus::complete;
 }
+
+// explicit instantiation of the dimension-specialized update functions
+template TaskStatus MHD::RKUpdateRange<1>(Driver *pdriver, int stage,
+                                    int is, int ie, int js, int je, int ks, int ke);
+template TaskStatus MHD::RKUpdateRange<2>(Driver *pdriver, int stage,
+                                    int is, int ie, int js, int je, int ks, int ke);
+template TaskStatus MHD::RKUpdateRange<3>(Driver *pdriver, int stage,
+                                    int is, int ie, int js, int je, int ks, int ke);
 } // namespace mhd
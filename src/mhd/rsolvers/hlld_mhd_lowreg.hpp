@@ -0,0 +1,557 @@
+#ifndef MHD_RSOLVERS_HLLD_MHD_LOWREG_HPP_
+#define MHD_RSOLVERS_HLLD_MHD_LOWREG_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file hlld_mhd_lowreg.hpp
+//! \brief Register-pressure-reduced variant of the HLLD Riemann solver for ideal gas EOS
+//! in MHD, selected with <mhd>/rsolver = hlld_lowreg.
+//!
+//! Algebraically identical to the standard solver in hlld_mhd.hpp, but restructured into
+//! phases for better GPU occupancy: all five signal speeds and the star-state pressure
+//! are computed first using only scalar temporaries, the flux regime is selected, and
+//! then only the intermediate states that regime actually needs are materialized (one
+//! side's conserved state, flux, and star states instead of all of them).  Cheap
+//! quantities are recomputed inside each branch rather than kept live across phases.
+//! The isothermal path has a much smaller working set and is unchanged from the
+//! standard solver.
+//!
+//! REFERENCES:
+//! - T. Miyoshi & K. Kusano, "A multi-state HLL approximate Riemann solver for ideal
+//!   MHD", JCP, 208, 315 (2005)
+
+namespace mhd {
+
+#ifndef HLLD_SMALL_NUMBER
+#define HLLD_SMALL_NUMBER 1.0e-4
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \fn
+
+KOKKOS_INLINE_FUNCTION
+void HLLD_LowReg(TeamMember_t const &member, const EOS_Data &eos,
+     const RegionIndcs &indcs,const DualArray1D<RegionSize> &size,const CoordData &coord,
+     const int m, const int k, const int j, const int il, const int iu, const int ivx,
+     const ScrArray2D<Real> &wl, const ScrArray2D<Real> &wr,
+     const ScrArray2D<Real> &bl, const ScrArray2D<Real> &br, const DvceArray4D<Real> &bx,
+     DvceArray5D<Real> flx, DvceArray4D<Real> ey, DvceArray4D<Real> ez) {
+  int ivy = IVX + ((ivx-IVX)+1)%3;
+  int ivz = IVX + ((ivx-IVX)+2)%3;
+  int iby = ((ivx-IVX) + 1)%3;
+  int ibz = ((ivx-IVX) + 2)%3;
+
+  //------------------------ ADIABATIC HLLD solver ---------------------------------------
+  if (eos.is_ideal) {
+    Real gm1 = eos.gamma - 1.0;
+    Real igm1 = 1.0/gm1;
+    par_for_inner(member, il, iu, [&](const int i) {
+      //--- Phase 1.  Compute all signal speeds and star-state pressure using scalars only
+
+      Real &wl_idn=wl(IDN,i);
+      Real &wl_ivx=wl(ivx,i);
+      Real &wl_ivy=wl(ivy,i);
+      Real &wl_ivz=wl(ivz,i);
+      Real &wl_iby=bl(iby,i);
+      Real &wl_ibz=bl(ibz,i);
+
+      Real &wr_idn=wr(IDN,i);
+      Real &wr_ivx=wr(ivx,i);
+      Real &wr_ivy=wr(ivy,i);
+      Real &wr_ivz=wr(ivz,i);
+      Real &wr_iby=br(iby,i);
+      Real &wr_ibz=br(ibz,i);
+
+      Real wl_ipr = eos.IdealGasPressure(wl(IEN,i));
+      Real wr_ipr = eos.IdealGasPressure(wr(IEN,i));
+
+      Real &bxi = bx(m,k,j,i);
+      Real bxsq = bxi*bxi;
+      // (KGF): group transverse components for floating-point associativity symmetry
+      Real pbl = 0.5*(bxsq + (SQR(wl_iby) + SQR(wl_ibz)));  // magnetic pressure (l/r)
+      Real pbr = 0.5*(bxsq + (SQR(wr_iby) + SQR(wr_ibz)));
+      Real ptl = wl_ipr + pbl;  // total pressures L,R
+      Real ptr = wr_ipr + pbr;
+
+      // L & R wave speeds according to Miyoshi & Kusano, eqn. (67)
+      Real cfl = eos.IdealMHDFastSpeed(wl_idn, wl_ipr, bxi, wl_iby, wl_ibz);
+      Real cfr = eos.IdealMHDFastSpeed(wr_idn, wr_ipr, bxi, wr_iby, wr_ibz);
+      Real sl = fmin( wl_ivx-cfl, wr_ivx-cfr );
+      Real sr = fmax( wl_ivx+cfl, wr_ivx+cfr );
+
+      Real sdl = sl - wl_ivx;  // S_i-u_i (i=L or R)
+      Real sdr = sr - wr_ivx;
+
+      // S_M: eqn (38) of Miyoshi & Kusano; mx recomputed from primitives
+      // (KGF): group ptl, ptr terms for floating-point associativity symmetry
+      Real sm = (sdr*(wr_idn*wr_ivx) - sdl*(wl_idn*wl_ivx) + (ptl - ptr))/
+                (sdr*wr_idn - sdl*wl_idn);
+
+      Real sdml = sl - sm;  // S_i-S_M (i=L or R)
+      Real sdmr = sr - sm;
+      Real sdml_inv = 1.0/sdml;
+      Real sdmr_inv = 1.0/sdmr;
+
+      // star-state densities, eqn (43) of Miyoshi & Kusano
+      Real dlst = wl_idn * sdl * sdml_inv;
+      Real drst = wr_idn * sdr * sdmr_inv;
+      Real dlst_inv = 1.0/dlst;
+      Real drst_inv = 1.0/drst;
+      Real sqrtdl = sqrt(dlst);
+      Real sqrtdr = sqrt(drst);
+
+      // Alfven wave speeds, eqn (51) of Miyoshi & Kusano
+      Real sal = sm - fabs(bxi)/sqrtdl;
+      Real sar = sm + fabs(bxi)/sqrtdr;
+
+      // total pressure in star states; eqn (23) explicitly becomes eq (41) of M&K
+      Real ptst = 0.5*((ptr + wr_idn*sdr*(sm-wr_ivx)) + (ptl + wl_idn*sdl*(sm-wl_ivx)));
+
+      //--- Phase 2.  Select flux regime, then build only the states that regime needs
+
+      MHDCons1D flxi;  // flux at the interface
+      if (sl >= 0.0) {
+        // return Fl if flow is supersonic; recompute UL and FL from primitives
+        Real el = wl_ipr*igm1 + 0.5*wl_idn*(SQR(wl_ivx)+(SQR(wl_ivy)+SQR(wl_ivz))) + pbl;
+        flxi.d  = wl_idn*wl_ivx;
+        flxi.mx = flxi.d*wl_ivx + ptl - bxsq;
+        flxi.my = wl_idn*wl_ivy*wl_ivx - bxi*wl_iby;
+        flxi.mz = wl_idn*wl_ivz*wl_ivx - bxi*wl_ibz;
+        flxi.e  = wl_ivx*(el + ptl - bxsq) - bxi*(wl_ivy*wl_iby + wl_ivz*wl_ibz);
+        flxi.by = wl_iby*wl_ivx - bxi*wl_ivy;
+        flxi.bz = wl_ibz*wl_ivx - bxi*wl_ivz;
+      } else if (sr <= 0.0) {
+        // return Fr if flow is supersonic
+        Real er = wr_ipr*igm1 + 0.5*wr_idn*(SQR(wr_ivx)+(SQR(wr_ivy)+SQR(wr_ivz))) + pbr;
+        flxi.d  = wr_idn*wr_ivx;
+        flxi.mx = flxi.d*wr_ivx + ptr - bxsq;
+        flxi.my = wr_idn*wr_ivy*wr_ivx - bxi*wr_iby;
+        flxi.mz = wr_idn*wr_ivz*wr_ivx - bxi*wr_ibz;
+        flxi.e  = wr_ivx*(er + ptr - bxsq) - bxi*(wr_ivy*wr_iby + wr_ivz*wr_ibz);
+        flxi.by = wr_iby*wr_ivx - bxi*wr_ivy;
+        flxi.bz = wr_ibz*wr_ivx - bxi*wr_ivz;
+      } else if (sm >= 0.0) {
+        // flux is FL* or FL**: build left conserved state, flux, and star state only
+        MHDCons1D ul, ulst;
+        ul.d  = wl_idn;
+        ul.mx = wl_ivx*ul.d;
+        ul.my = wl_ivy*ul.d;
+        ul.mz = wl_ivz*ul.d;
+        ul.e  = wl_ipr*igm1 + 0.5*wl_idn*(SQR(wl_ivx)+(SQR(wl_ivy)+SQR(wl_ivz))) + pbl;
+        ul.by = wl_iby;
+        ul.bz = wl_ibz;
+
+        // ul* - eqn (39) of M&K
+        ulst.d  = dlst;
+        ulst.mx = dlst * sm;
+        if (fabs(ul.d*sdl*sdml-bxsq) < (HLLD_SMALL_NUMBER)*ptst) {
+          // Degenerate case
+          ulst.my = dlst * wl_ivy;
+          ulst.mz = dlst * wl_ivz;
+          ulst.by = ul.by;
+          ulst.bz = ul.bz;
+        } else {
+          // eqns (44) and (46) of M&K
+          Real tmp = bxi*(sdl - sdml)/(ul.d*sdl*sdml - bxsq);
+          ulst.my = dlst * (wl_ivy - ul.by*tmp);
+          ulst.mz = dlst * (wl_ivz - ul.bz*tmp);
+          // eqns (45) and (47) of M&K
+          tmp = (ul.d*SQR(sdl) - bxsq)/(ul.d*sdl*sdml - bxsq);
+          ulst.by = ul.by * tmp;
+          ulst.bz = ul.bz * tmp;
+        }
+        // v_i* dot B_i*
+        // (KGF): group transverse momenta terms for floating-point assoc. symmetry
+        Real vbstl = (ulst.mx*bxi+(ulst.my*ulst.by+ulst.mz*ulst.bz))*dlst_inv;
+        // eqn (48) of M&K
+        // (KGF): group transverse by, bz terms for floating-point assoc. symmetry
+        ulst.e = (sdl*ul.e - ptl*wl_ivx + ptst*sm +
+                  bxi*(wl_ivx*bxi + (wl_ivy*ul.by + wl_ivz*ul.bz) - vbstl))*sdml_inv;
+
+        // FL* = FL + SL*(UL* - UL), eqn (64) of M&K
+        flxi.d  = ul.mx                                   + sl*(ulst.d  - ul.d);
+        flxi.mx = ul.mx*wl_ivx + ptl - bxsq               + sl*(ulst.mx - ul.mx);
+        flxi.my = ul.my*wl_ivx - bxi*ul.by                + sl*(ulst.my - ul.my);
+        flxi.mz = ul.mz*wl_ivx - bxi*ul.bz                + sl*(ulst.mz - ul.mz);
+        flxi.e  = wl_ivx*(ul.e + ptl - bxsq) -
+                  bxi*(wl_ivy*ul.by + wl_ivz*ul.bz)       + sl*(ulst.e  - ul.e);
+        flxi.by = ul.by*wl_ivx - bxi*wl_ivy               + sl*(ulst.by - ul.by);
+        flxi.bz = ul.bz*wl_ivx - bxi*wl_ivz               + sl*(ulst.bz - ul.bz);
+
+        if ((sal < 0.0) && (0.5*bxsq >= (HLLD_SMALL_NUMBER)*ptst)) {
+          // flux is FL**: need transverse components of UR* (eqns 59-62 couple L/R)
+          Real rmy, rmz, rby, rbz;  // my/mz/by/bz of ur*
+          if (fabs(wr_idn*sdr*sdmr - bxsq) < (HLLD_SMALL_NUMBER)*ptst) {
+            // Degenerate case
+            rmy = drst * wr_ivy;
+            rmz = drst * wr_ivz;
+            rby = wr_iby;
+            rbz = wr_ibz;
+          } else {
+            // eqns (44) and (46) of M&K
+            Real tmp = bxi*(sdr - sdmr)/(wr_idn*sdr*sdmr - bxsq);
+            rmy = drst * (wr_ivy - wr_iby*tmp);
+            rmz = drst * (wr_ivz - wr_ibz*tmp);
+            // eqns (45) and (47) of M&K
+            tmp = (wr_idn*SQR(sdr) - bxsq)/(wr_idn*sdr*sdmr - bxsq);
+            rby = wr_iby * tmp;
+            rbz = wr_ibz * tmp;
+          }
+
+          MHDCons1D uldst;
+          Real invsumd = 1.0/(sqrtdl + sqrtdr);
+          Real bxsig = (bxi > 0.0 ? 1.0 : -1.0);
+          uldst.d  = ulst.d;
+          uldst.mx = ulst.mx;
+          // eqn (59) of M&K
+          Real tmp = invsumd*(sqrtdl*(ulst.my*dlst_inv) + sqrtdr*(rmy*drst_inv) +
+                              bxsig*(rby - ulst.by));
+          uldst.my = uldst.d * tmp;
+          // eqn (60) of M&K
+          tmp = invsumd*(sqrtdl*(ulst.mz*dlst_inv) + sqrtdr*(rmz*drst_inv) +
+                         bxsig*(rbz - ulst.bz));
+          uldst.mz = uldst.d * tmp;
+          // eqn (61) of M&K
+          uldst.by = invsumd*(sqrtdl*rby + sqrtdr*ulst.by +
+                              bxsig*sqrtdl*sqrtdr*((rmy*drst_inv) -
+                                                   (ulst.my*dlst_inv)));
+          // eqn (62) of M&K
+          uldst.bz = invsumd*(sqrtdl*rbz + sqrtdr*ulst.bz +
+                              bxsig*sqrtdl*sqrtdr*((rmz*drst_inv) -
+                                                   (ulst.mz*dlst_inv)));
+          // eqn (63) of M&K
+          tmp = sm*bxi + (uldst.my*uldst.by + uldst.mz*uldst.bz)/uldst.d;
+          uldst.e = ulst.e - sqrtdl*bxsig*(vbstl - tmp);
+
+          // FL** = FL* + SL*(UL** - UL*), eqn (65) of M&K
+          flxi.d  += sal*(uldst.d  - ulst.d);
+          flxi.mx += sal*(uldst.mx - ulst.mx);
+          flxi.my += sal*(uldst.my - ulst.my);
+          flxi.mz += sal*(uldst.mz - ulst.mz);
+          flxi.e  += sal*(uldst.e  - ulst.e);
+          flxi.by += sal*(uldst.by - ulst.by);
+          flxi.bz += sal*(uldst.bz - ulst.bz);
+        }
+      } else {
+        // flux is FR* or FR**: mirror image of the left star branch
+        MHDCons1D ur, urst;
+        ur.d  = wr_idn;
+        ur.mx = wr_ivx*ur.d;
+        ur.my = wr_ivy*ur.d;
+        ur.mz = wr_ivz*ur.d;
+        ur.e  = wr_ipr*igm1 + 0.5*wr_idn*(SQR(wr_ivx)+(SQR(wr_ivy)+SQR(wr_ivz))) + pbr;
+        ur.by = wr_iby;
+        ur.bz = wr_ibz;
+
+        // ur* - eqn (39) of M&K
+        urst.d  = drst;
+        urst.mx = drst * sm;
+        if (fabs(ur.d*sdr*sdmr - bxsq) < (HLLD_SMALL_NUMBER)*ptst) {
+          // Degenerate case
+          urst.my = drst * wr_ivy;
+          urst.mz = drst * wr_ivz;
+          urst.by = ur.by;
+          urst.bz = ur.bz;
+        } else {
+          // eqns (44) and (46) of M&K
+          Real tmp = bxi*(sdr - sdmr)/(ur.d*sdr*sdmr - bxsq);
+          urst.my = drst * (wr_ivy - ur.by*tmp);
+          urst.mz = drst * (wr_ivz - ur.bz*tmp);
+          // eqns (45) and (47) of M&K
+          tmp = (ur.d*SQR(sdr) - bxsq)/(ur.d*sdr*sdmr - bxsq);
+          urst.by = ur.by * tmp;
+          urst.bz = ur.bz * tmp;
+        }
+        // v_i* dot B_i*
+        // (KGF): group transverse momenta terms for floating-point assoc. symmetry
+        Real vbstr = (urst.mx*bxi+(urst.my*urst.by+urst.mz*urst.bz))*drst_inv;
+        // eqn (48) of M&K
+        // (KGF): group transverse by, bz terms for floating-point assoc. symmetry
+        urst.e = (sdr*ur.e - ptr*wr_ivx + ptst*sm +
+                  bxi*(wr_ivx*bxi + (wr_ivy*ur.by + wr_ivz*ur.bz) - vbstr))*sdmr_inv;
+
+        // FR* = FR + SR*(UR* - UR), eqn (64) of M&K
+        flxi.d  = ur.mx                                   + sr*(urst.d  - ur.d);
+        flxi.mx = ur.mx*wr_ivx + ptr - bxsq               + sr*(urst.mx - ur.mx);
+        flxi.my = ur.my*wr_ivx - bxi*ur.by                + sr*(urst.my - ur.my);
+        flxi.mz = ur.mz*wr_ivx - bxi*ur.bz                + sr*(urst.mz - ur.mz);
+        flxi.e  = wr_ivx*(ur.e + ptr - bxsq) -
+                  bxi*(wr_ivy*ur.by + wr_ivz*ur.bz)       + sr*(urst.e  - ur.e);
+        flxi.by = ur.by*wr_ivx - bxi*wr_ivy               + sr*(urst.by - ur.by);
+        flxi.bz = ur.bz*wr_ivx - bxi*wr_ivz               + sr*(urst.bz - ur.bz);
+
+        if ((sar > 0.0) && (0.5*bxsq >= (HLLD_SMALL_NUMBER)*ptst)) {
+          // flux is FR**: need transverse components of UL* (eqns 59-62 couple L/R)
+          Real lmy, lmz, lby, lbz;  // my/mz/by/bz of ul*
+          if (fabs(wl_idn*sdl*sdml - bxsq) < (HLLD_SMALL_NUMBER)*ptst) {
+            // Degenerate case
+            lmy = dlst * wl_ivy;
+            lmz = dlst * wl_ivz;
+            lby = wl_iby;
+            lbz = wl_ibz;
+          } else {
+            // eqns (44) and (46) of M&K
+            Real tmp = bxi*(sdl - sdml)/(wl_idn*sdl*sdml - bxsq);
+            lmy = dlst * (wl_ivy - wl_iby*tmp);
+            lmz = dlst * (wl_ivz - wl_ibz*tmp);
+            // eqns (45) and (47) of M&K
+            tmp = (wl_idn*SQR(sdl) - bxsq)/(wl_idn*sdl*sdml - bxsq);
+            lby = wl_iby * tmp;
+            lbz = wl_ibz * tmp;
+          }
+
+          MHDCons1D urdst;
+          Real invsumd = 1.0/(sqrtdl + sqrtdr);
+          Real bxsig = (bxi > 0.0 ? 1.0 : -1.0);
+          urdst.d  = urst.d;
+          urdst.mx = urst.mx;
+          // eqn (59) of M&K
+          Real tmp = invsumd*(sqrtdl*(lmy*dlst_inv) + sqrtdr*(urst.my*drst_inv) +
+                              bxsig*(urst.by - lby));
+          urdst.my = urdst.d * tmp;
+          // eqn (60) of M&K
+          tmp = invsumd*(sqrtdl*(lmz*dlst_inv) + sqrtdr*(urst.mz*drst_inv) +
+                         bxsig*(urst.bz - lbz));
+          urdst.mz = urdst.d * tmp;
+          // eqn (61) of M&K
+          urdst.by = invsumd*(sqrtdl*urst.by + sqrtdr*lby +
+                              bxsig*sqrtdl*sqrtdr*((urst.my*drst_inv) -
+                                                   (lmy*dlst_inv)));
+          // eqn (62) of M&K
+          urdst.bz = invsumd*(sqrtdl*urst.bz + sqrtdr*lbz +
+                              bxsig*sqrtdl*sqrtdr*((urst.mz*drst_inv) -
+                                                   (lmz*dlst_inv)));
+          // eqn (63) of M&K; the density-scaled transverse components of UL** and UR**
+          // are equal, so either double-star state gives the same v dot B here
+          tmp = sm*bxi + (urdst.my*urdst.by + urdst.mz*urdst.bz)/urdst.d;
+          urdst.e = urst.e + sqrtdr*bxsig*(vbstr - tmp);
+
+          // FR** = FR* + SR*(UR** - UR*), eqn (65) of M&K
+          flxi.d  += sar*(urdst.d  - urst.d);
+          flxi.mx += sar*(urdst.mx - urst.mx);
+          flxi.my += sar*(urdst.my - urst.my);
+          flxi.mz += sar*(urdst.mz - urst.mz);
+          flxi.e  += sar*(urdst.e  - urst.e);
+          flxi.by += sar*(urdst.by - urst.by);
+          flxi.bz += sar*(urdst.bz - urst.bz);
+        }
+      }
+
+      flx(m,IDN,k,j,i) = flxi.d;
+      flx(m,ivx,k,j,i) = flxi.mx;
+      flx(m,ivy,k,j,i) = flxi.my;
+      flx(m,ivz,k,j,i) = flxi.mz;
+      flx(m,IEN,k,j,i) = flxi.e;
+      ey(m,k,j,i) = -flxi.by;
+      ez(m,k,j,i) =  flxi.bz;
+    });
+
+  //------------------------- ISOTHERMAL HLLD solver -------------------------------------
+  // working set is already small here; identical to the standard solver
+  } else {
+    Real spd[5];         // signal speeds, left to right
+    auto &dfloor_ = eos.dfloor;
+    Real iso_cs = eos.iso_cs;
+    par_for_inner(member, il, iu, [&](const int i) {
+      //--- Step 1.  Load L/R states into local variables
+
+      Real &wl_idn=wl(IDN,i);
+      Real &wl_ivx=wl(ivx,i);
+      Real &wl_ivy=wl(ivy,i);
+      Real &wl_ivz=wl(ivz,i);
+      Real &wl_iby=bl(iby,i);
+      Real &wl_ibz=bl(ibz,i);
+
+      Real &wr_idn=wr(IDN,i);
+      Real &wr_ivx=wr(ivx,i);
+      Real &wr_ivy=wr(ivy,i);
+      Real &wr_ivz=wr(ivz,i);
+      Real &wr_iby=br(iby,i);
+      Real &wr_ibz=br(ibz,i);
+
+      Real &bxi = bx(m,k,j,i);
+
+      // Compute L/R states for selected conserved variables
+      MHDCons1D ul,ur;
+      ul.d  = wl_idn;
+      ul.mx = wl_ivx*ul.d;
+      ul.my = wl_ivy*ul.d;
+      ul.mz = wl_ivz*ul.d;
+      ul.by = wl_iby;
+      ul.bz = wl_ibz;
+
+      ur.d  = wr_idn;
+      ur.mx = wr_ivx*ur.d;
+      ur.my = wr_ivy*ur.d;
+      ur.mz = wr_ivz*ur.d;
+      ur.by = wr_iby;
+      ur.bz = wr_ibz;
+
+      //--- Step 2.  Compute L & R wave speeds according to Miyoshi & Kusano, eqn. (67)
+
+      Real cfl = eos.IdealMHDFastSpeed(wl_idn, bxi, wl_iby, wl_ibz);
+      Real cfr = eos.IdealMHDFastSpeed(wr_idn, bxi, wr_iby, wr_ibz);
+
+      spd[0] = fmin( wl_ivx-cfl, wr_ivx-cfr );
+      spd[4] = fmax( wl_ivx+cfl, wr_ivx+cfr );
+
+      //--- Step 3.  Compute L/R fluxes
+
+      // total pressures L,R
+      Real bxsq = bxi*bxi;
+      Real ptl = SQR(iso_cs)*wl_idn + 0.5*(bxsq + SQR(wl_iby) + SQR(wl_ibz));
+      Real ptr = SQR(iso_cs)*wr_idn + 0.5*(bxsq + SQR(wr_iby) + SQR(wr_ibz));
+
+      MHDCons1D fl,fr,flxi;  // Fluxes for left & right states, and interface
+      fl.d  = ul.mx;
+      fl.mx = ul.mx*wl_ivx + ptl - bxsq;
+      fl.my = ul.my*wl_ivx - bxi*ul.by;
+      fl.mz = ul.mz*wl_ivx - bxi*ul.bz;
+      fl.by = ul.by*wl_ivx - bxi*wl_ivy;
+      fl.bz = ul.bz*wl_ivx - bxi*wl_ivz;
+
+      fr.d  = ur.mx;
+      fr.mx = ur.mx*wr_ivx + ptr - bxsq;
+      fr.my = ur.my*wr_ivx - bxi*ur.by;
+      fr.mz = ur.mz*wr_ivx - bxi*ur.bz;
+      fr.by = ur.by*wr_ivx - bxi*wr_ivy;
+      fr.bz = ur.bz*wr_ivx - bxi*wr_ivz;
+
+      //--- Step 4.  Compute hll averages and Alfven wave speed
+
+      // inverse of difference between right and left signal speeds
+      Real idspd = 1.0/(spd[4]-spd[0]);
+
+      // rho component of U^{hll} from Mignone eqn. (15); uses F_L and F_R from eqn. (6)
+      Real dhll = (spd[4]*ur.d - spd[0]*ul.d - fr.d + fl.d)*idspd;
+      dhll = fmax(dhll, dfloor_);
+      Real sqrtdhll = sqrt(dhll);
+
+      // rho and mx components of F^{hll} from Mignone eqn. (17)
+      Real fdhll  = (spd[4]*fl.d  - spd[0]*fr.d  + spd[4]*spd[0]*(ur.d -ul.d ))*idspd;
+      Real fmxhll = (spd[4]*fl.mx - spd[0]*fr.mx + spd[4]*spd[0]*(ur.mx-ul.mx))*idspd;
+
+      // ustar from paragraph between eqns. (23) and (24)
+      Real ustar = fdhll/dhll;
+
+      // mx component of U^{hll} from Mignone eqn. (15); paragraph referenced
+      // above states that mxhll should NOT be used to compute ustar
+      Real mxhll = (spd[4]*ur.mx - spd[0]*ul.mx - fr.mx + fl.mx)*idspd;
+
+      // S*_L and S*_R from Mignone eqn. (29)
+      spd[1] = ustar - fabs(bxi)/sqrtdhll;
+      spd[3] = ustar + fabs(bxi)/sqrtdhll;
+
+      //--- Step 5. Compute intermediate states
+
+      MHDCons1D ulst,urst,ucst;  // Conserved variable for all states
+      // Ul* - eqn. (20) of Mignone
+      ulst.d  = dhll;
+      ulst.mx = mxhll; // eqn. (24) of Mignone
+
+      Real tmp = (spd[0]-spd[1])*(spd[0]-spd[3]);
+      if (fabs(spd[0]-spd[1]) < (HLLD_SMALL_NUMBER)*iso_cs) {
+        // degenerate case described below eqn. (39)
+        ulst.my = ul.my;
+        ulst.mz = ul.mz;
+        ulst.by = ul.by;
+        ulst.bz = ul.bz;
+      } else {
+        Real mfact = bxi*(ustar-wl_ivx)/tmp;
+        Real bfact = (ul.d*SQR(spd[0]-wl_ivx) - bxsq)/(dhll*tmp);
+
+        ulst.my = dhll*wl_ivy - ul.by*mfact; // eqn. (30) of Mignone
+        ulst.mz = dhll*wl_ivz - ul.bz*mfact; // eqn. (31) of Mignone
+        ulst.by = ul.by*bfact; // eqn. (32) of Mignone
+        ulst.bz = ul.bz*bfact; // eqn. (33) of Mignone
+      }
+
+      // Ur* - eqn. (20) of Mignone */
+      urst.d  = dhll;
+      urst.mx = mxhll; // eqn. (24) of Mignone
+
+      tmp = (spd[4]-spd[1])*(spd[4]-spd[3]);
+      if (fabs(spd[4]-spd[3]) < (HLLD_SMALL_NUMBER)*iso_cs) {
+        // degenerate case described below eqn. (39)
+        urst.my = ur.my;
+        urst.mz = ur.mz;
+        urst.by = ur.by;
+        urst.bz = ur.bz;
+      } else {
+        Real mfact = bxi*(ustar-wr_ivx)/tmp;
+        Real bfact = (ur.d*SQR(spd[4]-wr_ivx) - bxsq)/(dhll*tmp);
+
+        urst.my = dhll*wr_ivy - ur.by*mfact; // eqn. (30) of Mignone
+        urst.mz = dhll*wr_ivz - ur.bz*mfact; // eqn. (31) of Mignone
+        urst.by = ur.by*bfact; // eqn. (32) of Mignone
+        urst.bz = ur.bz*bfact; // eqn. (33) of Mignone
+      }
+
+      // Uc*
+      Real x = sqrtdhll*(bxi > 0.0 ? 1.0 : -1.0); // from below eqn. (37) of Mignone
+      ucst.d  = dhll;  // eqn. (20) of Mignone
+      ucst.mx = mxhll; // eqn. (24) of Mignone
+      ucst.my = 0.5*(ulst.my + urst.my + (urst.by-ulst.by)*x); // eqn. (34) of Mignone
+      ucst.mz = 0.5*(ulst.mz + urst.mz + (urst.bz-ulst.bz)*x); // eqn. (35) of Mignone
+      ucst.by = 0.5*(ulst.by + urst.by + (urst.my-ulst.my)/x); // eqn. (36) of Mignone
+      ucst.bz = 0.5*(ulst.bz + urst.bz + (urst.mz-ulst.mz)/x); // eqn. (37) of Mignone
+
+      //--- Step 6.  Compute flux
+
+      if (spd[0] >= 0.0) {
+        // return Fl if flow is supersonic, eqn. (38a) of Mignone
+        flxi.d  = fl.d;
+        flxi.mx = fl.mx;
+        flxi.my = fl.my;
+        flxi.mz = fl.mz;
+        flxi.by = fl.by;
+        flxi.bz = fl.bz;
+      } else if (spd[4] <= 0.0) {
+        // return Fr if flow is supersonic, eqn. (38e) of Mignone
+        flxi.d  = fr.d;
+        flxi.mx = fr.mx;
+        flxi.my = fr.my;
+        flxi.mz = fr.mz;
+        flxi.by = fr.by;
+        flxi.bz = fr.bz;
+      } else if (spd[1] >= 0.0) {
+        // return (Fl+Sl*(Ulst-Ul)), eqn. (38b) of Mignone
+        flxi.d  = fl.d  + spd[0]*(ulst.d  - ul.d);
+        flxi.mx = fl.mx + spd[0]*(ulst.mx - ul.mx);
+        flxi.my = fl.my + spd[0]*(ulst.my - ul.my);
+        flxi.mz = fl.mz + spd[0]*(ulst.mz - ul.mz);
+        flxi.by = fl.by + spd[0]*(ulst.by - ul.by);
+        flxi.bz = fl.bz + spd[0]*(ulst.bz - ul.bz);
+      } else if (spd[3] <= 0.0) {
+        // return (Fr+Sr*(Urst-Ur)), eqn. (38d) of Mignone
+        flxi.d  = fr.d  + spd[4]*(urst.d  - ur.d);
+        flxi.mx = fr.mx + spd[4]*(urst.mx - ur.mx);
+        flxi.my = fr.my + spd[4]*(urst.my - ur.my);
+        flxi.mz = fr.mz + spd[4]*(urst.mz - ur.mz);
+        flxi.by = fr.by + spd[4]*(urst.by - ur.by);
+        flxi.bz = fr.bz + spd[4]*(urst.bz - ur.bz);
+      } else {
+        // return Fcst, eqn. (38c) of Mignone, using eqn. (24)
+        flxi.d  = dhll*ustar;
+        flxi.mx = fmxhll;
+        flxi.my = ucst.my*ustar - bxi*ucst.by;
+        flxi.mz = ucst.mz*ustar - bxi*ucst.bz;
+        flxi.by = ucst.by*ustar - bxi*ucst.my/ucst.d;
+        flxi.bz = ucst.bz*ustar - bxi*ucst.mz/ucst.d;
+      }
+
+      flx(m,IDN,k,j,i) = flxi.d;
+      flx(m,ivx,k,j,i) = flxi.mx;
+      flx(m,ivy,k,j,i) = flxi.my;
+      flx(m,ivz,k,j,i) = flxi.mz;
+      ey(m,k,j,i) = -flxi.by;
+      ez(m,k,j,i) =  flxi.bz;
+    });
+  } // end ideal gas/isothermal solvers
+
+  return;
+}
+} // namespace mhd
+#endif // MHD_RSOLVERS_HLLD_MHD_LOWREG_HPP_
@@ -36,8 +36,6 @@ void HLLE_GR(TeamMember_t const &member, const EOS_Data &eos,
 
   const Real gm1 = (eos.gamma - 1.0);
   const Real gamma_prime = eos.gamma/(gm1);
-  auto &flat = coord.is_minkowski;
-  auto &spin = coord.bh_spin;
 
   int is = indcs.is;
   int js = indcs.js;
@@ -88,7 +86,8 @@ void HLLE_GR(TeamMember_t const &member, const EOS_Data &eos,
       x3v = LeftEdgeX  (k-ks, indcs.nx3, x3min, x3max);
     }
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    MetricAndInverseAt(coord, 1+(ivx-IVX), m, k, j, i, x1v, x2v, x3v,
+                       glower, gupper);
 
     // Calculate 4-velocity in left state (contravariant compt)
     Real q = glower[ivx][ivx] * SQR(wl_ivx) + glower[ivy][ivy] * SQR(wl_ivy) +
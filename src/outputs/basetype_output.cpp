@@ -27,6 +27,8 @@
 #include "z4c/z4c.hpp"
 #include "srcterms/srcterms.hpp"
 #include "srcterms/turb_driver.hpp"
+#include "pgen/pgen.hpp"
+#include "utils/uvm_spill.hpp"
 #include "outputs.hpp"
 
 #if MPI_PARALLEL_ENABLED
@@ -42,6 +44,21 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
     outarray("cc_outvar",1,1,1,1,1),
     outfield("fc_outvar",1,1,1,1),
     out_params(opar) {
+#if MPI_PARALLEL_ENABLED
+  // asynchronous writes: check thread support and create a unique communicator, so that
+  // MPI-IO calls made from the writer thread cannot interleave with collective calls
+  // made on MPI_COMM_WORLD by the main thread during evolution
+  if (out_params.async_write) {
+    if (global_variable::mpi_thread_provided < MPI_THREAD_MULTIPLE) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "async=true in output block '" << out_params.block_name
+          << "' requires MPI_THREAD_MULTIPLE, but MPI library only provides level "
+          << global_variable::mpi_thread_provided << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    MPI_Comm_dup(MPI_COMM_WORLD, &io_comm_);
+  }
+#endif
   // exit for history, restart, or event log files
   if (out_params.file_type.compare("hst") == 0 ||
       out_params.file_type.compare("rst") == 0 ||
@@ -51,128 +68,177 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
   // initialize vector containing number of output MBs per rank
   noutmbs.assign(global_variable::nranks, 0);
 
-  // check for valid choice of variables
-  int ivar = -1;
-  for (int i=0; i<(NOUTPUT_CHOICES); ++i) {
-    if (out_params.variable.compare(var_choice[i]) == 0) {ivar = i;}
-  }
-  if (ivar < 0) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Variable '" << out_params.variable << "' in block '" << out_params.block_name
-       << "' in input file is not a valid choice" << std::endl;
-    std::exit(EXIT_FAILURE);
-  }
-
-  // check that appropriate physics is defined for requested output variable
-  // TODO(@user): Index limits of variable choices below may change if more choices added
-  if ((ivar<16) && (pm->pmb_pack->phydro == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of Hydro variable requested in <output> block '"
-       << out_params.block_name << "' but no Hydro object has been constructed."
-       << std::endl << "Input file is likely missing a <hydro> block" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  if ((ivar>=16) && (ivar<49) && (pm->pmb_pack->pmhd == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of MHD variable requested in <output> block '"
-       << out_params.block_name << "' but no MHD object has been constructed."
-       << std::endl << "Input file is likely missing a <mhd> block" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  if ((ivar==49) && (pm->pmb_pack->pturb == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of Force variable requested in <output> block '"
-       << out_params.block_name << "' but no Force object has been constructed."
-       << std::endl << "Input file is likely missing a <forcing> block" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  if (ivar==50 && (pm->pmb_pack->prad == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of Radiation moments requested in <output> block '"
-       << out_params.block_name << "' but no Radiation object has been constructed."
-       << std::endl << "Input file is likely missing a <radiation> block" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  if ((ivar==51 || ivar==52) &&
-      ((pm->pmb_pack->prad == nullptr) ||
-       (pm->pmb_pack->phydro == nullptr && pm->pmb_pack->pmhd == nullptr))) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of Fluid Frame Radiation moments requested in <output> block '"
-       << out_params.block_name << "' but either Radiation object has not been "
-       << " constructed, or corresponding Hydro or MHD object missing" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  if ((ivar>=52) && (ivar<67) &&
-      (pm->pmb_pack->prad == nullptr || pm->pmb_pack->phydro == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of Radiation Hydro variables requested in <output> block '"
-       << out_params.block_name << "' but Radiation and/or Hydro object not constructed."
-       << std::endl << "Input file is likely missing corresponding block" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  if ((ivar>=67) && (ivar<87) &&
-      (pm->pmb_pack->prad == nullptr || pm->pmb_pack->pmhd == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of Radiation MHD variables requested in <output> block '"
-       << out_params.block_name << "' but Radiation and/or MHD object not constructed."
-       << std::endl << "Input file is likely missing corresponding block" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  if ((ivar>=87) && (ivar<105) && (pm->pmb_pack->padm == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of ADM variable requested in <output> block '"
-       << out_params.block_name << "' but ADM object not constructed."
-       << std::endl << "Input file is likely missing corresponding block" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  if ((ivar>=105) && (ivar<128) && (pm->pmb_pack->pz4c == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of Z4c variable requested in <output> block '"
-       << out_params.block_name << "' but Z4c object not constructed."
-       << std::endl << "Input file is likely missing corresponding block" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  if ((ivar>=128) && (ivar<131) && (pm->pmb_pack->pz4c == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of weyl variable requested in <output> block '"
-       << out_params.block_name << "' but weyl object not constructed."
-       << std::endl << "Input file is likely missing corresponding block" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  if ((ivar>=131) && (ivar<139) && (pm->pmb_pack->pz4c == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of constraint variables request in <output> block '"
-       << out_params.block_name << "' but Z4c object not constructed."
-       << std::endl << "Input file is likely missing corresponding block" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  if ((ivar>=139) && (ivar<150) && (pm->pmb_pack->ptmunu == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of Tmunu variable requested in <output> block '"
-       << out_params.block_name << "' but no Tmunu object has been constructed."
-       << std::endl << "Input file is likely missing a <adm> block" << std::endl;
-  }
-  if ((ivar>=150) && (ivar<152) && (pm->pmb_pack->ppart == nullptr)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-       << "Output of particles requested in <output> block '"
-       << out_params.block_name << "' but particle object not constructed."
-       << std::endl << "Input file is likely missing corresponding block" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-
-  // Now load STL vector of output variables
-  outvars.clear();
-
-  // make a vector of out_params.variables
+  // make a vector of out_params.variables.  The variable parameter may be a
+  // comma-separated list of names; each name is validated and registered separately,
+  // and derived quantities in the list are evaluated together in fused kernels
   std::vector<std::string> variables;
-
-  variables.push_back(out_params.variable);
+  {
+    std::string rem = out_params.variable;
+    while (!(rem.empty())) {
+      std::string::size_type pos = rem.find(',');
+      std::string tok = rem.substr(0, pos);
+      if (pos == std::string::npos) {
+        rem.clear();
+      } else {
+        rem.erase(0, pos+1);
+      }
+      std::string::size_type tb = tok.find_first_not_of(' ');
+      std::string::size_type te = tok.find_last_not_of(' ');
+      tok = (tb == std::string::npos)? "" : tok.substr(tb, te-tb+1);
+      if (!(tok.empty())) {variables.push_back(tok);}
+    }
+  }
   if (out_params.file_type == "pdf") {
     if (out_params.nbin2 > 1) {
       variables.push_back(out_params.variable_2);
     }
   }
 
+  for (const auto& variable : variables) {
+    // check for valid choice of variables
+    int ivar = -1;
+    for (int i=0; i<(NOUTPUT_CHOICES); ++i) {
+      if (variable.compare(var_choice[i]) == 0) {ivar = i;}
+    }
+    if (ivar < 0) {
+      // not a built-in choice; check derived quantities enrolled at runtime by the
+      // problem generator (see ProblemGenerator::EnrollDerivedVariable)
+      bool user_derived = false;
+      if (pm->pgen != nullptr) {
+        for (auto &udv : pm->pgen->user_dvars) {
+          if (variable.compare(udv.name) == 0) {user_derived = true;}
+        }
+      }
+      if (user_derived) {
+        out_params.contains_derived = true;
+        out_params.n_derived += 1;
+        int i_derived = out_params.n_derived - 1;
+        outvars.emplace_back(variable,i_derived,&(derived_var));
+        continue;
+      }
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Variable '" << variable << "' in block '"
+         << out_params.block_name << "' in input file is not a valid choice" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    // variables that occupy multiple slots in derived_var (or resize it) cannot be
+    // combined with other variables in a comma-separated list
+    if ((variables.size() > 1) &&
+        ((variable.compare("mhd_jcon") == 0) ||
+         (variable.compare("hydro_sgs") == 0) ||
+         (variable.compare("mhd_sgs") == 0) ||
+         (variable.compare("mhd_dynamo_ks") == 0) ||
+         (variable.compare(0, 3, "rad") == 0) ||
+         (variable.compare(0, 5, "prtcl") == 0))) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Variable '" << variable << "' in block '"
+         << out_params.block_name << "' cannot be combined with other variables"
+         << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    // check that appropriate physics is defined for requested output variable
+    // TODO(@user): Index limits of variable choices below may change if more added
+    if ((ivar<16) && (pm->pmb_pack->phydro == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of Hydro variable requested in <output> block '"
+         << out_params.block_name << "' but no Hydro object has been constructed."
+         << std::endl << "Input file is likely missing a <hydro> block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((ivar>=16) && (ivar<49) && (pm->pmb_pack->pmhd == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of MHD variable requested in <output> block '"
+         << out_params.block_name << "' but no MHD object has been constructed."
+         << std::endl << "Input file is likely missing a <mhd> block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((ivar==49) && (pm->pmb_pack->pturb == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of Force variable requested in <output> block '"
+         << out_params.block_name << "' but no Force object has been constructed."
+         << std::endl << "Input file is likely missing a <forcing> block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if (ivar==50 && (pm->pmb_pack->prad == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of Radiation moments requested in <output> block '"
+         << out_params.block_name << "' but no Radiation object has been constructed."
+         << std::endl << "Input file is likely missing a <radiation> block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((ivar==51 || ivar==52) &&
+        ((pm->pmb_pack->prad == nullptr) ||
+         (pm->pmb_pack->phydro == nullptr && pm->pmb_pack->pmhd == nullptr))) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of Fluid Frame Radiation moments requested in <output> "
+         << "block '" << out_params.block_name << "' but either Radiation object has not "
+         << "been constructed, or corresponding Hydro or MHD object missing" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((ivar>=52) && (ivar<67) &&
+        (pm->pmb_pack->prad == nullptr || pm->pmb_pack->phydro == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of Radiation Hydro variables requested in <output> block"
+         << " '" << out_params.block_name << "' but Radiation and/or Hydro object not "
+         << "constructed." << std::endl
+         << "Input file is likely missing corresponding block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((ivar>=67) && (ivar<87) &&
+        (pm->pmb_pack->prad == nullptr || pm->pmb_pack->pmhd == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of Radiation MHD variables requested in <output> block '"
+         << out_params.block_name << "' but Radiation and/or MHD object not constructed."
+         << std::endl << "Input file is likely missing corresponding block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((ivar>=87) && (ivar<105) && (pm->pmb_pack->padm == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of ADM variable requested in <output> block '"
+         << out_params.block_name << "' but ADM object not constructed."
+         << std::endl << "Input file is likely missing corresponding block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((ivar>=105) && (ivar<128) && (pm->pmb_pack->pz4c == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of Z4c variable requested in <output> block '"
+         << out_params.block_name << "' but Z4c object not constructed."
+         << std::endl << "Input file is likely missing corresponding block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((ivar>=128) && (ivar<131) && (pm->pmb_pack->pz4c == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of weyl variable requested in <output> block '"
+         << out_params.block_name << "' but weyl object not constructed."
+         << std::endl << "Input file is likely missing corresponding block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((ivar>=131) && (ivar<139) && (pm->pmb_pack->pz4c == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of constraint variables request in <output> block '"
+         << out_params.block_name << "' but Z4c object not constructed."
+         << std::endl << "Input file is likely missing corresponding block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((ivar>=139) && (ivar<150) && (pm->pmb_pack->ptmunu == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of Tmunu variable requested in <output> block '"
+         << out_params.block_name << "' but no Tmunu object has been constructed."
+         << std::endl << "Input file is likely missing a <adm> block" << std::endl;
+    }
+    if ((ivar>=150) && (ivar<152) && (pm->pmb_pack->ppart == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of particles requested in <output> block '"
+         << out_params.block_name << "' but particle object not constructed."
+         << std::endl << "Input file is likely missing corresponding block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  // Now load STL vector of output variables
+  outvars.clear();
 
   for (const auto& variable : variables) {
     // hydro (lab-frame) density
@@ -527,7 +593,7 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
     }
 
     // added by GNW --- contravariant components of magnetic field
-    if (out_params.variable.compare("mhd_jcon") == 0) {
+    if (variable.compare("mhd_jcon") == 0) {
       pm->pmb_pack->pmhd->SetSaveWBcc();
       out_params.contains_derived = true;
       out_params.n_derived += 4;
@@ -683,6 +749,38 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
   noutmbs.assign(global_variable::nranks, 0);
 }
 
+//----------------------------------------------------------------------------------------
+// BaseTypeOutput base class destructor
+// Blocks until any asynchronous write has finished, so in-flight buffers are not lost
+// when the code exits (pout is destroyed before MPI_Finalize() is called in main())
+
+BaseTypeOutput::~BaseTypeOutput() {
+  FinishPendingWrite();
+#if MPI_PARALLEL_ENABLED
+  if (out_params.async_write) {MPI_Comm_free(&io_comm_);}
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BaseTypeOutput::FinishPendingWrite()
+//! \brief Joins the writer thread if a previous asynchronous write is still in flight.
+//! No-op for synchronous outputs.
+
+void BaseTypeOutput::FinishPendingWrite() {
+  if (cwriter_.joinable()) {cwriter_.join();}
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BaseTypeOutput::LaunchAsyncWrite()
+//! \brief Hands wfunc (which must perform all file I/O for one dump using only state
+//! captured by value) to the writer thread.  Blocks only if the previous dump from this
+//! output is still being written, so at most one write per output is ever outstanding.
+
+void BaseTypeOutput::LaunchAsyncWrite(std::function<void()> wfunc) {
+  FinishPendingWrite();
+  cwriter_ = std::thread(std::move(wfunc));
+}
+
 //----------------------------------------------------------------------------------------
 // BaseTypeOutput::LoadOutputData()
 // create std::vector of HostArray3Ds containing data specified in <output> block for
@@ -755,6 +853,42 @@ void BaseTypeOutput::LoadOutputData(Mesh *pm) {
       oke = oks;
     }
 
+    // check for region-of-interest, trim index ranges of MBs partially inside it
+    if (out_params.region) {
+      // skip this MB if it does not overlap the region
+      if (out_params.rgn_x1max <= size.h_view(m).x1min ||
+          out_params.rgn_x1min >= size.h_view(m).x1max ||
+          out_params.rgn_x2max <= size.h_view(m).x2min ||
+          out_params.rgn_x2min >= size.h_view(m).x2max ||
+          out_params.rgn_x3max <= size.h_view(m).x3min ||
+          out_params.rgn_x3min >= size.h_view(m).x3max) { continue; }
+      // trim index ranges to the cells containing the region boundaries
+      if (out_params.rgn_x1min > size.h_view(m).x1min) {
+        ois = indcs.is + CellCenterIndex(out_params.rgn_x1min, indcs.nx1,
+                                         size.h_view(m).x1min, size.h_view(m).x1max);
+      }
+      if (out_params.rgn_x1max < size.h_view(m).x1max) {
+        oie = indcs.is + CellCenterIndex(out_params.rgn_x1max, indcs.nx1,
+                                         size.h_view(m).x1min, size.h_view(m).x1max);
+      }
+      if (out_params.rgn_x2min > size.h_view(m).x2min) {
+        ojs = indcs.js + CellCenterIndex(out_params.rgn_x2min, indcs.nx2,
+                                         size.h_view(m).x2min, size.h_view(m).x2max);
+      }
+      if (out_params.rgn_x2max < size.h_view(m).x2max) {
+        oje = indcs.js + CellCenterIndex(out_params.rgn_x2max, indcs.nx2,
+                                         size.h_view(m).x2min, size.h_view(m).x2max);
+      }
+      if (out_params.rgn_x3min > size.h_view(m).x3min) {
+        oks = indcs.ks + CellCenterIndex(out_params.rgn_x3min, indcs.nx3,
+                                         size.h_view(m).x3min, size.h_view(m).x3max);
+      }
+      if (out_params.rgn_x3max < size.h_view(m).x3max) {
+        oke = indcs.ks + CellCenterIndex(out_params.rgn_x3max, indcs.nx3,
+                                         size.h_view(m).x3min, size.h_view(m).x3max);
+      }
+    }
+
     // set coordinate geometry information for MB
     Real x1min = size.h_view(m).x1min;
     Real x1max = size.h_view(m).x1max;
@@ -781,11 +915,18 @@ void BaseTypeOutput::LoadOutputData(Mesh *pm) {
   int nout_vars = outvars.size();
   int nout_mbs = outmbs.size();
   // note that while ois,oie,etc. can be different on each MB, the number of cells output
-  // on each MeshBlock, i.e. (ois-ois+1), etc. is the same.
+  // on each MeshBlock, i.e. (ois-ois+1), etc. is the same, EXCEPT with a region output,
+  // where MBs partially inside the region are trimmed to different sizes.  So size the
+  // host array with the largest extents in each direction
   if (nout_mbs > 0) {
     int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
     int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
     int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
+    for (int m=1; m<nout_mbs; ++m) {
+      nout1 = std::max(nout1, outmbs[m].oie - outmbs[m].ois + 1);
+      nout2 = std::max(nout2, outmbs[m].oje - outmbs[m].ojs + 1);
+      nout3 = std::max(nout3, outmbs[m].oke - outmbs[m].oks + 1);
+    }
     // NB: outarray stores all output data on Host
     Kokkos::realloc(outarray, nout_vars, nout_mbs, nout3, nout2, nout1);
   }
@@ -802,22 +943,44 @@ void BaseTypeOutput::LoadOutputData(Mesh *pm) {
       std::pair<int,int> irange = std::make_pair(outmbs[m].ois, outmbs[m].oie+1);
       std::pair<int,int> jrange = std::make_pair(outmbs[m].ojs, outmbs[m].oje+1);
       std::pair<int,int> krange = std::make_pair(outmbs[m].oks, outmbs[m].oke+1);
-      int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
-      int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
-      int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
-
-      // copy output variable to new device View
-      DvceArray3D<Real> d_output_var("d_out_var",nout3,nout2,nout1);
-      auto d_slice = Kokkos::subview(*(outvars[n].data_ptr), mbi, outvars[n].data_index,
-                                     krange,jrange,irange);
-      Kokkos::deep_copy(d_output_var,d_slice);
-
-      // copy new device View to host mirror View
-      DvceArray3D<Real>::HostMirror h_output_var = Kokkos::create_mirror(d_output_var);
+      int nout1 = (outmbs[m].oie - outmbs[m].ois + 1);
+      int nout2 = (outmbs[m].oje - outmbs[m].ojs + 1);
+      int nout3 = (outmbs[m].oke - outmbs[m].oks + 1);
+
+      // copy output variable to persistent device scratch View, resized only when the
+      // output block dimensions change (with uniform outputs, only on the first block)
+      if ((d_out_scratch.extent_int(0) != nout3) ||
+          (d_out_scratch.extent_int(1) != nout2) ||
+          (d_out_scratch.extent_int(2) != nout1)) {
+        uvm_spill::Realloc(d_out_scratch, "output_scratch", nout3, nout2, nout1);
+        Kokkos::realloc(h_out_scratch, nout3, nout2, nout1);
+      }
+      auto &d_output_var = d_out_scratch;
+      // derived variables may be stored at diagnostic precision; deep_copy converts
+      bool from_diag = false;
+#if DIAG_SINGLE_PRECISION_ENABLED
+      if (outvars[n].diag_ptr != nullptr) {
+        from_diag = true;
+        auto d_slice = Kokkos::subview(*(outvars[n].diag_ptr), mbi,
+                                       outvars[n].data_index, krange,jrange,irange);
+        Kokkos::deep_copy(d_output_var,d_slice);
+      }
+#endif
+      if (!from_diag) {
+        auto d_slice = Kokkos::subview(*(outvars[n].data_ptr), mbi,
+                                       outvars[n].data_index, krange,jrange,irange);
+        Kokkos::deep_copy(d_output_var,d_slice);
+      }
+
+      // copy device scratch to its pinned host landing buffer; both persist across
+      // dumps, so no allocation recurs and the transfer runs at pinned-memory speed
+      auto &h_output_var = h_out_scratch;
       Kokkos::deep_copy(h_output_var,d_output_var);
 
-      // copy host mirror to 5D host View containing all output variables
-      auto h_slice = Kokkos::subview(outarray,n,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+      // copy host mirror to 5D host View containing all output variables.  Extents of
+      // this MB may be smaller than those of outarray with a region output
+      auto h_slice = Kokkos::subview(outarray,n,m,std::make_pair(0,nout3),
+                                     std::make_pair(0,nout2),std::make_pair(0,nout1));
       Kokkos::deep_copy(h_slice,h_output_var);
     }
   }
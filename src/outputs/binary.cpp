@@ -9,8 +9,10 @@
 
 #include <sys/stat.h>  // mkdir
 
+#include <cstdint>
 #include <cstdio>      // fwrite(), fclose(), fopen(), fnprintf(), snprintf()
 #include <cstdlib>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <numeric>
@@ -25,11 +27,24 @@
 #include "mesh/mesh.hpp"
 #include "outputs.hpp"
 
+#if ZSTD_COMPRESSION_ENABLED
+#include <zstd.h>
+#endif
+
 //----------------------------------------------------------------------------------------
 // Constructor: also calls BaseTypeOutput base class constructor
 
 MeshBinaryOutput::MeshBinaryOutput(ParameterInput *pin, Mesh *pm, OutputParameters op) :
   BaseTypeOutput(pin, pm, op) {
+#if !(ZSTD_COMPRESSION_ENABLED)
+  if (out_params.compression.compare("zstd") == 0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "compression=zstd requested in output block '"
+        << out_params.block_name << "', but code was not compiled with ZSTD support."
+        << std::endl << "Rebuild with -D Athena_ENABLE_ZSTD=ON" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+#endif
   // create directories for outputs
   // useful for mpiio-based outputs because on some supercomputers you may need to
   // set different stripe counts depending on whether mpiio is used in order to
@@ -60,49 +75,49 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   fname.append(number);
   fname.append(".bin");
 
-  IOWrapper binfile;
-  std::size_t header_offset=0;
-  binfile.Open(fname.c_str(), IOWrapper::FileMode::write);
+  // check if per-MeshBlock compression of data is enabled; compressed files carry a
+  // format version bump, an extra preheader line, and a block index table (see below)
+  bool compressed = (out_params.compression.compare("none") != 0);
 
   // Basic parts of the format:
   // 1. Size of the header
   // 2. Current time
   // 3. List of variables in the file
   // 4. Header (input file information)
+  // Header text is assembled into strings here; all file I/O happens in the write
+  // function below, which runs on the writer thread when async=true
+  std::string hdr1;
   {
     std::stringstream msg;
-    msg << "Athena binary output version=1.1" << std::endl
+    msg << "Athena binary output version=" << ((compressed)? "1.2" : "1.1") << std::endl
         // preheader size includes "size of preheader" line up to "number of variables"
-        << "  size of preheader=5" << std::endl
+        << "  size of preheader=" << ((compressed)? 6 : 5) << std::endl
         << "  time=" << pm->time << std::endl
         << "  cycle=" << pm->ncycle << std::endl
         << "  size of location=" << sizeof(Real) << std::endl
-        << "  size of variable=" << sizeof(float) << std::endl
-        << "  number of variables=" << outvars.size() << std::endl
+        << "  size of variable=" << sizeof(float) << std::endl;
+    if (compressed) {
+      msg << "  compression=" << out_params.compression << std::endl;
+    }
+    msg << "  number of variables=" << outvars.size() << std::endl
         << "  variables:  ";
     for (int n=0; n<outvars.size(); n++) {
       msg << outvars[n].label.c_str() << "  ";
     }
     msg << std::endl;
-    if (global_variable::my_rank == 0) {
-      binfile.Write_any_type(msg.str().c_str(),msg.str().size(),"byte");
-    }
-    header_offset += msg.str().size();
+    hdr1 = msg.str();
   }
+  std::string hdr2, pardump;
   {
     std::stringstream msg;
     // prepare the input parameters
     std::stringstream ost;
     pin->ParameterDump(ost);
-    std::string sbuf=ost.str();
-    msg << "  header offset=" << sbuf.size()*sizeof(char)  << std::endl;
-    if (global_variable::my_rank == 0) {
-      binfile.Write_any_type(msg.str().c_str(),msg.str().size(),"byte");
-      binfile.Write_any_type(sbuf.c_str(),sbuf.size(),"byte");
-    }
-    header_offset += sbuf.size()*sizeof(char);
-    header_offset += msg.str().size();
+    pardump = ost.str();
+    msg << "  header offset=" << pardump.size()*sizeof(char)  << std::endl;
+    hdr2 = msg.str();
   }
+  std::size_t header_offset = hdr1.size() + hdr2.size() + pardump.size()*sizeof(char);
 
   //  5. Data.  An arbitrary number of scalars and vectors can be written (every element
   //  of the outvars vector), all in binary floats format
@@ -119,19 +134,33 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
 
   // ois, oie, ojs, oje, oks, oke + il1, il2, il3, level +
   // x1min, x1max, x2min, x2max, x3min, x3max + data
-  std::size_t data_size = 10*sizeof(int32_t) + 6*sizeof(Real)
-                        + (cells*nout_vars)*sizeof(float);
+  std::size_t mbhdr_size = 10*sizeof(int32_t) + 6*sizeof(Real);
+  std::size_t data_size = mbhdr_size + (cells*nout_vars)*sizeof(float);
+
+  // with a region output, MBs trimmed to the region have records of different sizes, so
+  // compute per-MB record offsets into the data buffer (trivially uniform otherwise)
+  bool region_out = out_params.region;
+  std::vector<std::size_t> mb_offset(nout_mbs+1, 0);
+  std::size_t max_cells = 0;
+  for (int m=0; m<nout_mbs; ++m) {
+    std::size_t ncells = static_cast<std::size_t>(outmbs[m].oie - outmbs[m].ois + 1)
+                       * (outmbs[m].oje - outmbs[m].ojs + 1)
+                       * (outmbs[m].oke - outmbs[m].oks + 1);
+    max_cells = std::max(max_cells, ncells);
+    mb_offset[m+1] = mb_offset[m] + mbhdr_size + (ncells*nout_vars)*sizeof(float);
+  }
+  std::size_t mybytes = mb_offset[nout_mbs];
 
   int ns_mbs = pm->gids_eachrank[global_variable::my_rank];
   int nb_mbs = pm->nmb_eachrank[global_variable::my_rank];
 
   // allocate 1D vector of floats used to convert and output data
-  char *data = new char[nb_mbs*data_size];
-  float *single_data = new float[cells];
+  char *data = new char[(region_out)? mybytes : nb_mbs*data_size];
+  float *single_data = new float[max_cells];
 
   // Loop over MeshBlocks
   for (int m=0; m<nout_mbs; ++m) {
-    char *pdata=&(data[m*data_size]);
+    char *pdata=&(data[mb_offset[m]]);
     LogicalLocation loc = pm->lloc_eachmb[outmbs[m].mb_gid];
     int &ois = outmbs[m].ois;
     int &oie = outmbs[m].oie;
@@ -139,6 +168,7 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     int &oje = outmbs[m].oje;
     int &oks = outmbs[m].oks;
     int &oke = outmbs[m].oke;
+    int ncells = (oie-ois+1)*(oje-ojs+1)*(oke-oks+1);
 
     // output indexing for MB
     int32_t nx = (int32_t)(ois);
@@ -209,67 +239,227 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
           }
         }
       }
-      memcpy(pdata,single_data,cells*sizeof(float));
-      pdata+=cells*sizeof(float);
+      memcpy(pdata,single_data,ncells*sizeof(float));
+      pdata+=ncells*sizeof(float);
     }
   }
+  delete [] single_data;
+
+  // snapshot remaining rank/MeshBlock counts needed by the write function, so it does
+  // not touch the Mesh (which evolves while an asynchronous write is in flight)
+  std::vector<int> noutmbs_ = noutmbs;
+  int noutmbs_min_ = noutmbs_min;
+  // max/min number of MeshBlocks across all ranks, for per-MB writes of >2^31 bytes
+  int nrankmbs_max = pm->nmb_eachrank[0];
+  int nrankmbs_min = pm->nmb_eachrank[0];
+  for (int i=0; i<(global_variable::nranks); ++i) {
+    nrankmbs_max = std::max(nrankmbs_max,pm->nmb_eachrank[i]);
+    nrankmbs_min = std::min(nrankmbs_min,pm->nmb_eachrank[i]);
+  }
+  int nmb_thisrank = pm->nmb_thisrank;
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm iocomm = (out_params.async_write)? io_comm_ : MPI_COMM_WORLD;
+#endif
+
+  // with a region output, byte counts differ across ranks; exchange them here to compute
+  // this rank's offset into the (uncompressed) file
+  std::size_t region_offset = 0;
+#if MPI_PARALLEL_ENABLED
+  if (region_out) {
+    std::vector<std::uint64_t> rank_bytes(global_variable::nranks, 0);
+    rank_bytes[global_variable::my_rank] = mybytes;
+    MPI_Allgather(MPI_IN_PLACE, 1, MPI_UINT64_T, rank_bytes.data(), 1, MPI_UINT64_T,
+                  MPI_COMM_WORLD);
+    for (int r=0; r<(global_variable::my_rank); ++r) {region_offset += rank_bytes[r];}
+  }
+#endif
+
+  // Write functions.  Each performs ALL file I/O for this dump using only state captured
+  // by value, so it can run on the writer thread concurrently with subsequent cycles,
+  // and takes ownership of (and frees) the data buffer.
+
+  // write function for raw (uncompressed) data.  Per-MB records have fixed size (except
+  // with a region output, where per-rank byte counts were exchanged above), so all file
+  // offsets are known in advance and no index table is needed
+  std::function<void()> write_file_raw = [=]() {
+    IOWrapper binfile;
+#if MPI_PARALLEL_ENABLED
+    binfile.SetCommunicator(iocomm);
+#endif
+    binfile.Open(fname.c_str(), IOWrapper::FileMode::write);
+    if (global_variable::my_rank == 0) {
+      binfile.Write_any_type(hdr1.c_str(),hdr1.size(),"byte");
+      binfile.Write_any_type(hdr2.c_str(),hdr2.size(),"byte");
+      binfile.Write_any_type(pardump.c_str(),pardump.size(),"byte");
+    }
 
-  // now write binary data
-  if (bin_slice) {
-    std::vector<int> rank_offset(global_variable::nranks, 0);
-    std::partial_sum(noutmbs.begin(),std::prev(noutmbs.end()),
-                     std::next(rank_offset.begin()));
-    std::size_t myoffset=header_offset+data_size*rank_offset[global_variable::my_rank];
-    if (noutmbs_min > 0) {
-      binfile.Write_any_type_at_all(data,(data_size*nout_mbs),myoffset,"byte");
+    // now write binary data
+    if (region_out) {
+      // records of MBs trimmed to the region have different sizes, so this rank's
+      // offset comes from the exchanged per-rank byte counts
+      std::size_t myoffset = header_offset + region_offset;
+      if (noutmbs_min_ > 0) {
+        binfile.Write_any_type_at_all(data,mybytes,myoffset,"byte");
+      } else {
+        if (nout_mbs > 0) {
+          binfile.Write_any_type_at(data,mybytes,myoffset,"byte");
+        }
+      }
+    } else if (bin_slice) {
+      std::vector<int> rank_offset(global_variable::nranks, 0);
+      std::partial_sum(noutmbs_.begin(),std::prev(noutmbs_.end()),
+                       std::next(rank_offset.begin()));
+      std::size_t myoffset=header_offset+data_size*rank_offset[global_variable::my_rank];
+      if (noutmbs_min_ > 0) {
+        binfile.Write_any_type_at_all(data,(data_size*nout_mbs),myoffset,"byte");
+      } else {
+        if (nout_mbs > 0) {
+          binfile.Write_any_type_at(data,(data_size*nout_mbs),myoffset,"byte");
+        }
+      }
     } else {
-      if (nout_mbs > 0) {
-        binfile.Write_any_type_at(data,(data_size*nout_mbs),myoffset,"byte");
+      // check if elements larger than 2^31
+      if (data_size*nb_mbs<=2147483648) {
+        // now write binary data in parallel
+        std::size_t myoffset=header_offset+data_size*ns_mbs;
+        binfile.Write_any_type_at_all(data,(data_size*nb_mbs),myoffset,"byte");
+      } else {
+        // write data over each MeshBlock sequentially and in parallel
+        for (int m=0;  m<nrankmbs_max; ++m) {
+          char *pdata=&(data[m*data_size]);
+          std::size_t myoffset=header_offset+data_size*ns_mbs+data_size*m;
+          // every rank has a MB to write, so write collectively
+          if (m < nrankmbs_min) {
+            if (binfile.Write_any_type_at_all(pdata,(data_size),myoffset,"byte") != 1) {
+              std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "binary data not written correctly to binary file, "
+                  << "binary file is broken." << std::endl;
+              exit(EXIT_FAILURE);
+            }
+          // some ranks are finished writing, so use non-collective write
+          } else if (m < nmb_thisrank) {
+            if (binfile.Write_any_type_at(pdata,(data_size),myoffset,"byte") != 1) {
+              std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                   << std::endl << "binary data not written correctly to binary file, "
+                   << "binary file is broken." << std::endl;
+              exit(EXIT_FAILURE);
+            }
+          }
+        }
       }
     }
-  } else {
-    // check if elements larger than 2^31
-    if (data_size*nb_mbs<=2147483648) {
-      // now write binary data in parallel
-      std::size_t myoffset=header_offset+data_size*ns_mbs;
-      binfile.Write_any_type_at_all(data,(data_size*nb_mbs),myoffset,"byte");
-    } else {
-      // write data over each MeshBlock sequentially and in parallel
-      // calculate max/min number of MeshBlocks across all ranks
-      noutmbs_max = pm->nmb_eachrank[0];
-      noutmbs_min = pm->nmb_eachrank[0];
-      for (int i=0; i<(global_variable::nranks); ++i) {
-        noutmbs_max = std::max(noutmbs_max,pm->nmb_eachrank[i]);
-        noutmbs_min = std::min(noutmbs_min,pm->nmb_eachrank[i]);
+
+    // close the output file and clean up ptr to data
+    binfile.Close();
+    delete [] data;
+  };
+
+#if ZSTD_COMPRESSION_ENABLED
+  // write function for ZSTD-compressed data.  Each per-MB record is compressed into its
+  // own frame, so MeshBlocks remain independently addressable by readers; frame sizes
+  // are exchanged between ranks to compute file offsets and written as an index table
+  // (uint64 block count followed by one uint64 frame size per block, in gid order)
+  // between the header and the frames.  Note compression itself runs here, i.e. on the
+  // writer thread (on otherwise-idle host cores) when async=true
+  int clevel = out_params.compression_level;
+  std::function<void()> write_file_zstd = [=]() {
+    // compress each MeshBlock record into one frame in a single contiguous buffer
+    std::size_t max_record = mbhdr_size + (max_cells*nout_vars)*sizeof(float);
+    std::size_t cbound = ZSTD_compressBound(max_record);
+    char *cdata = new char[std::max(static_cast<std::size_t>(1), nout_mbs*cbound)];
+    std::vector<std::uint64_t> csize(nout_mbs);
+    std::size_t cbytes = 0;
+    for (int m=0; m<nout_mbs; ++m) {
+      csize[m] = ZSTD_compress(&(cdata[cbytes]), cbound,
+                               &(data[mb_offset[m]]), mb_offset[m+1]-mb_offset[m],
+                               clevel);
+      if (ZSTD_isError(csize[m])) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "ZSTD compression of binary output data failed: "
+            << ZSTD_getErrorName(csize[m]) << std::endl;
+        exit(EXIT_FAILURE);
       }
-      for (int m=0;  m<noutmbs_max; ++m) {
-        char *pdata=&(data[m*data_size]);
-        std::size_t myoffset=header_offset+data_size*ns_mbs+data_size*m;
-        // every rank has a MB to write, so write collectively
-        if (m < noutmbs_min) {
-          if (binfile.Write_any_type_at_all(pdata,(data_size),myoffset,"byte") != 1) {
-            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                << std::endl << "binary data not written correctly to binary file, "
-                << "binary file is broken." << std::endl;
-            exit(EXIT_FAILURE);
-          }
-        // some ranks are finished writing, so use non-collective write
-        } else if (m < pm->nmb_thisrank) {
-          if (binfile.Write_any_type_at(pdata,(data_size),myoffset,"byte") != 1) {
-            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                 << std::endl << "binary data not written correctly to binary file, "
-                 << "binary file is broken." << std::endl;
-            exit(EXIT_FAILURE);
-          }
+      cbytes += csize[m];
+    }
+    delete [] data;
+
+    // gather frame sizes of all blocks on all ranks to build the index table
+    int nblk_tot = 0;
+    std::vector<int> displs(global_variable::nranks, 0);
+    for (int r=0; r<(global_variable::nranks); ++r) {
+      displs[r] = nblk_tot;
+      nblk_tot += noutmbs_[r];
+    }
+    std::vector<std::uint64_t> all_csize(nblk_tot, 0);
+    for (int m=0; m<nout_mbs; ++m) {
+      all_csize[displs[global_variable::my_rank] + m] = csize[m];
+    }
+#if MPI_PARALLEL_ENABLED
+    MPI_Allgatherv(MPI_IN_PLACE, nout_mbs, MPI_UINT64_T, all_csize.data(),
+                   noutmbs_.data(), displs.data(), MPI_UINT64_T, iocomm);
+#endif
+
+    // file layout: header | index table | compressed frames (in gid order)
+    std::size_t table_size = (1 + nblk_tot)*sizeof(std::uint64_t);
+    std::size_t myoffset = header_offset + table_size;
+    for (int b=0; b<(displs[global_variable::my_rank]); ++b) {myoffset += all_csize[b];}
+
+    IOWrapper binfile;
+#if MPI_PARALLEL_ENABLED
+    binfile.SetCommunicator(iocomm);
+#endif
+    binfile.Open(fname.c_str(), IOWrapper::FileMode::write);
+    if (global_variable::my_rank == 0) {
+      binfile.Write_any_type(hdr1.c_str(),hdr1.size(),"byte");
+      binfile.Write_any_type(hdr2.c_str(),hdr2.size(),"byte");
+      binfile.Write_any_type(pardump.c_str(),pardump.size(),"byte");
+      std::vector<std::uint64_t> table(1 + nblk_tot);
+      table[0] = static_cast<std::uint64_t>(nblk_tot);
+      for (int b=0; b<nblk_tot; ++b) {table[1+b] = all_csize[b];}
+      binfile.Write_any_type_at(table.data(), table_size, header_offset, "byte");
+    }
+
+    // write frames collectively only if every rank's payload fits in one MPI count;
+    // (this choice is consistent across ranks since all_csize is identical everywhere)
+    std::uint64_t maxbytes = 0;
+    for (int r=0; r<(global_variable::nranks); ++r) {
+      std::uint64_t rbytes = 0;
+      for (int b=displs[r]; b<(displs[r] + noutmbs_[r]); ++b) {rbytes += all_csize[b];}
+      maxbytes = std::max(maxbytes, rbytes);
+    }
+    if (maxbytes <= 2147483648) {
+      binfile.Write_any_type_at_all(cdata, cbytes, myoffset, "byte");
+    } else {
+      // write in <=2^30 byte slabs; slab counts differ per rank, so non-collective
+      std::size_t done = 0;
+      while (done < cbytes) {
+        std::size_t slab = std::min(cbytes - done, static_cast<std::size_t>(1073741824));
+        if (binfile.Write_any_type_at(&(cdata[done]), slab, myoffset+done,"byte") == 0) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "compressed data not written correctly to binary file, "
+              << "binary file is broken." << std::endl;
+          exit(EXIT_FAILURE);
         }
+        done += slab;
       }
     }
-  }
+    binfile.Close();
+    delete [] cdata;
+  };
+#endif  // ZSTD_COMPRESSION_ENABLED
 
-  // close the output file and clean up ptrs to data
-  binfile.Close();
-  delete [] data;
-  delete [] single_data;
+  std::function<void()> write_file = write_file_raw;
+#if ZSTD_COMPRESSION_ENABLED
+  if (compressed) {write_file = write_file_zstd;}
+#endif
+
+  // hand I/O to the writer thread (blocking only if the previous dump from this output
+  // is still being written), or else write synchronously
+  if (out_params.async_write) {
+    LaunchAsyncWrite(write_file);
+  } else {
+    write_file();
+  }
 
   // increment counters
   out_params.file_number++;
@@ -161,124 +161,135 @@ void CoarsenedBinaryOutput::LoadOutputData(Mesh *pm) {
     ComputeDerivedVariable(out_params.variable, pm);
   }
 
-  // Now copy data to host (outarray) over all variables and MeshBlocks
-  for (int n=0; n<nout_vars; ++n) {
-    for (int m=0; m<nout_mbs; ++m) {
-      int mbi = pm->FindMeshBlockIndex(outmbs[m].mb_gid);
-      std::pair<int,int> irange = std::make_pair(outmbs[m].ois, outmbs[m].oie+1);
-      std::pair<int,int> jrange = std::make_pair(outmbs[m].ojs, outmbs[m].oje+1);
-      std::pair<int,int> krange = std::make_pair(outmbs[m].oks, outmbs[m].oke+1);
-      std::pair<int,int> moment_range;
-      if (out_params.compute_moments) {
-        moment_range = std::make_pair(n*4, n*4+4);
-      } else {
-        moment_range = std::make_pair(n, n+1);
-      }
-      int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
-      int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
-      int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
-      int coarsened_nout1 = nout1/out_params.coarsen_factor;
-      int coarsened_nout2 = nout2/out_params.coarsen_factor;
-      int coarsened_nout3 = nout3/out_params.coarsen_factor;
-
-      // copy output variable to new device View
-      DvceArray3D<Real> d_output_var("d_out_var",nout3,nout2,nout1);
-      auto d_slice = Kokkos::subview(*(outvars[n].data_ptr), mbi, outvars[n].data_index,
-                                     krange,jrange,irange);
-      Kokkos::deep_copy(d_output_var,d_slice);
-      Kokkos::fence(); // Ensure complete copy
-
-
-      int number_of_moments = 1;
-      if (out_params.compute_moments) {
-        number_of_moments = 4;
-      }
-      DvceArray4D<Real> d_output_var_coarsened("d_output_var_coarsened",
-        number_of_moments, coarsened_nout3, coarsened_nout2, coarsened_nout1);
-
-      // Coarsen the d_slice and store the result in d_output_var
-      // CoarsenVariable(d_output_var, d_output_var_coarsened, out_params.coarsen_factor);
-      int coarsen_factor = out_params.coarsen_factor;
-      int coarsen_factor_cubed = coarsen_factor * coarsen_factor * coarsen_factor;
-
-      if (nout1 % coarsen_factor != 0 || nout2 % coarsen_factor != 0
-                                      || nout3 % coarsen_factor != 0) {
-          std::cout << "Error: Full data dimensions are not divisible by coarsen_factor"
-          << std::endl;
-          exit(EXIT_FAILURE);
-      }
+  if (nout_mbs == 0) { return; }
+
+  int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
+  int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
+  int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
+  int cf = out_params.coarsen_factor;
+  if (nout1 % cf != 0 || nout2 % cf != 0 || nout3 % cf != 0) {
+      std::cout << "Error: Full data dimensions are not divisible by coarsen_factor"
+      << std::endl;
+      exit(EXIT_FAILURE);
+  }
+  int cnout1 = nout1/cf;
+  int cnout2 = nout2/cf;
+  int cnout3 = nout3/cf;
+
+  // resize persistent device staging buffer holding the coarsened moments of every
+  // variable on every output MB, plus its pinned host landing buffer.  Resized only
+  // when the output dimensions change (with uniform outputs, once for the whole run)
+  if ((d_coarse_scratch.extent_int(0) != nout_vars_with_moments) ||
+      (d_coarse_scratch.extent_int(1) != nout_mbs) ||
+      (d_coarse_scratch.extent_int(2) != cnout3) ||
+      (d_coarse_scratch.extent_int(3) != cnout2) ||
+      (d_coarse_scratch.extent_int(4) != cnout1)) {
+    Kokkos::realloc(d_coarse_scratch, nout_vars_with_moments, nout_mbs,
+                    cnout3, cnout2, cnout1);
+    Kokkos::realloc(h_coarse_scratch, nout_vars_with_moments, nout_mbs,
+                    cnout3, cnout2, cnout1);
+  }
 
-      int total_iterations = coarsened_nout3
-        * coarsened_nout2 * coarsened_nout1 * coarsen_factor_cubed;
-
-      bool compute_moments = out_params.compute_moments;
-      Kokkos::parallel_for("coarsen_variable",
-       Kokkos::RangePolicy<DevExeSpace>(0, total_iterations),
-      KOKKOS_LAMBDA(const int idx) {
-        // Calculate the 3D indices for the coarsened data
-        int total_coarsened_elements = coarsened_nout1*coarsened_nout2*coarsened_nout3;
-        int k_c = (idx / (coarsened_nout2 * coarsened_nout1)) % coarsened_nout3;
-        int j_c = (idx / coarsened_nout1) % coarsened_nout2;
-        int i_c = idx % coarsened_nout1;
-
-        // Calculate the offset within the coarsen_factor_cubed cube
-        int offset = idx / total_coarsened_elements;
-        int kk = offset / (coarsen_factor * coarsen_factor);
-        int jj = (offset / coarsen_factor) % coarsen_factor;
-        int ii = offset % coarsen_factor;
-
-        // Calculate the corresponding indices in the full data
-        int k = k_c * coarsen_factor + kk;
-        int j = j_c * coarsen_factor + jj;
-        int i = i_c * coarsen_factor + ii;
-
-        // Perform the coarsening operation
-        if(k < nout3 && j < nout2 && i < nout1) {
-          Kokkos::atomic_add(&d_output_var_coarsened(0, k_c, j_c, i_c),
-            d_output_var(k, j, i));
-          if (compute_moments) {
-            Kokkos::atomic_add(&d_output_var_coarsened(1, k_c, j_c, i_c),
-              d_output_var(k, j, i)*d_output_var(k, j, i));
-            Kokkos::atomic_add(&d_output_var_coarsened(2, k_c, j_c, i_c),
-              d_output_var(k, j, i)*d_output_var(k, j, i)*d_output_var(k, j, i));
-            Kokkos::atomic_add(&d_output_var_coarsened(3, k_c, j_c, i_c),
-               d_output_var(k, j, i)*d_output_var(k, j, i)
-              *d_output_var(k, j, i)*d_output_var(k, j, i));
+  // map each output MB to its index in the MeshBlockPack and its starting cell, so the
+  // coarsening kernels can read the source variable arrays in place
+  if (coarse_mbmap.extent_int(0) != nout_mbs) {
+    Kokkos::realloc(coarse_mbmap, nout_mbs, 4);
+  }
+  for (int m=0; m<nout_mbs; ++m) {
+    coarse_mbmap.h_view(m,0) = pm->FindMeshBlockIndex(outmbs[m].mb_gid);
+    coarse_mbmap.h_view(m,1) = outmbs[m].ois;
+    coarse_mbmap.h_view(m,2) = outmbs[m].ojs;
+    coarse_mbmap.h_view(m,3) = outmbs[m].oks;
+  }
+  coarse_mbmap.template modify<HostMemSpace>();
+  coarse_mbmap.template sync<DevExeSpace>();
+
+  // Coarsen all variables on all output MBs directly into the device staging buffer:
+  // one fused kernel per variable, where each thread volume-averages its factor^3
+  // block of fine cells in registers (the same restriction operation the mesh applies
+  // between refinement levels, generalized to an arbitrary factor) and writes the
+  // normalized moments in place.  No atomics, no zeroing, and no per-MB copies.
+  bool moments = out_params.compute_moments;
+  auto &mbmap = coarse_mbmap;
+  auto &dbuf = d_coarse_scratch;
+  Real cfc = static_cast<Real>(cf*cf*cf);
+  for (int n=0; n<nout_vars; ++n) {
+    int vidx = outvars[n].data_index;
+    int nb = (moments)? 4*n : n;
+    // derived variables may be stored at diagnostic precision
+    bool from_diag = false;
+#if DIAG_SINGLE_PRECISION_ENABLED
+    if (outvars[n].diag_ptr != nullptr) {
+      from_diag = true;
+      auto &a = *(outvars[n].diag_ptr);
+      par_for("coarsen_variable", DevExeSpace(), 0,(nout_mbs-1),
+              0,(cnout3-1), 0,(cnout2-1), 0,(cnout1-1),
+      KOKKOS_LAMBDA(const int m, const int ck, const int cj, const int ci) {
+        int mbi = mbmap.d_view(m,0);
+        int fi = mbmap.d_view(m,1) + ci*cf;
+        int fj = mbmap.d_view(m,2) + cj*cf;
+        int fk = mbmap.d_view(m,3) + ck*cf;
+        Real s1=0.0, s2=0.0, s3=0.0, s4=0.0;
+        for (int kk=0; kk<cf; ++kk) {
+          for (int jj=0; jj<cf; ++jj) {
+            for (int ii=0; ii<cf; ++ii) {
+              Real val = static_cast<Real>(a(mbi,vidx,fk+kk,fj+jj,fi+ii));
+              s1 += val;
+              if (moments) {
+                s2 += val*val;
+                s3 += val*val*val;
+                s4 += val*val*val*val;
+              }
+            }
           }
         }
+        dbuf(nb,m,ck,cj,ci) = static_cast<DiagReal>(s1/cfc);
+        if (moments) {
+          dbuf(nb+1,m,ck,cj,ci) = static_cast<DiagReal>(s2/cfc);
+          dbuf(nb+2,m,ck,cj,ci) = static_cast<DiagReal>(s3/cfc);
+          dbuf(nb+3,m,ck,cj,ci) = static_cast<DiagReal>(s4/cfc);
+        }
       });
-      // Normalize the coarsened data
-      int normalize_iterations = number_of_moments * coarsened_nout3
-                                * coarsened_nout2 * coarsened_nout1;
-      Kokkos::parallel_for("normalize_coarsened_variable",
-        Kokkos::RangePolicy<DevExeSpace>(0, normalize_iterations),
-      KOKKOS_LAMBDA(const int idx) {
-        int moment_idx = idx / (coarsened_nout3 * coarsened_nout2 * coarsened_nout1);
-        int k = (idx / (coarsened_nout2 * coarsened_nout1)) % coarsened_nout3;
-        int j = (idx / coarsened_nout1) % coarsened_nout2;
-        int i = idx % coarsened_nout1;
-
-        d_output_var_coarsened(moment_idx, k, j, i) /= coarsen_factor_cubed;
+    }
+#endif
+    if (!from_diag) {
+      auto &a = *(outvars[n].data_ptr);
+      par_for("coarsen_variable", DevExeSpace(), 0,(nout_mbs-1),
+              0,(cnout3-1), 0,(cnout2-1), 0,(cnout1-1),
+      KOKKOS_LAMBDA(const int m, const int ck, const int cj, const int ci) {
+        int mbi = mbmap.d_view(m,0);
+        int fi = mbmap.d_view(m,1) + ci*cf;
+        int fj = mbmap.d_view(m,2) + cj*cf;
+        int fk = mbmap.d_view(m,3) + ck*cf;
+        Real s1=0.0, s2=0.0, s3=0.0, s4=0.0;
+        for (int kk=0; kk<cf; ++kk) {
+          for (int jj=0; jj<cf; ++jj) {
+            for (int ii=0; ii<cf; ++ii) {
+              Real val = a(mbi,vidx,fk+kk,fj+jj,fi+ii);
+              s1 += val;
+              if (moments) {
+                s2 += val*val;
+                s3 += val*val*val;
+                s4 += val*val*val*val;
+              }
+            }
+          }
+        }
+        dbuf(nb,m,ck,cj,ci) = static_cast<DiagReal>(s1/cfc);
+        if (moments) {
+          dbuf(nb+1,m,ck,cj,ci) = static_cast<DiagReal>(s2/cfc);
+          dbuf(nb+2,m,ck,cj,ci) = static_cast<DiagReal>(s3/cfc);
+          dbuf(nb+3,m,ck,cj,ci) = static_cast<DiagReal>(s4/cfc);
+        }
       });
-
-
-      // Now, create a host mirror for the coarsened data.
-      DvceArray4D<Real>::HostMirror h_output_var = Kokkos::create_mirror(
-        d_output_var_coarsened
-      );
-
-      // Copy the coarsened data to the host mirror.
-      Kokkos::deep_copy(h_output_var, d_output_var_coarsened);
-      Kokkos::fence(); // Ensure complete copy before using h_output_var on the host
-
-      // copy host mirror to 5D host View containing all output variables
-      // if (out_params.compute_moments) {
-      auto h_slice = Kokkos::subview(outarray,
-        moment_range,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL
-      );
-      Kokkos::deep_copy(h_slice,h_output_var);
     }
   }
+
+  // single device-to-host transfer of every coarsened variable into the pinned landing
+  // buffer, then an elementwise (DiagReal -> Real) copy into outarray on the host
+  Kokkos::deep_copy(h_coarse_scratch, d_coarse_scratch);
+  Kokkos::fence();
+  Kokkos::deep_copy(outarray, h_coarse_scratch);
 }
 
 //----------------------------------------------------------------------------------------
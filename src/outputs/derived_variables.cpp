@@ -11,10 +11,14 @@
 //!   - magnitude of vorticity Curl(v)^2  [non-relativistic]
 //!   - z-component of current density Jz  [non-relativistic]
 //!   - magnitude of current density J^2  [non-relativistic]
+//! When several derived variables are requested as a comma-separated list, all
+//! quantities sharing the same source data are evaluated in a single fused kernel.
 
 #include <iostream>
 #include <sstream>
 #include <string>   // std::string, to_string()
+#include <utility>  // pair<>
+#include <vector>
 
 #include "athena.hpp"
 #include "parameter_input.hpp"
@@ -28,6 +32,7 @@
 #include "radiation/radiation.hpp"
 #include "radiation/radiation_tetrad.hpp"
 #include "particles/particles.hpp"
+#include "pgen/pgen.hpp"
 #include "outputs.hpp"
 #include "utils/current.hpp"
 
@@ -49,123 +54,113 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
   auto &multi_d = pm->multi_d;
   auto &three_d = pm->three_d;
 
-  // derived variable index
-  int &i_dv = out_params.i_derived;
+  // derived variable count
   int &n_dv = out_params.n_derived;
 
-  // temperature = pressure / density
-  if (name.compare("temperature") == 0) {
-    if (derived_var.extent(4) <= 1)
-      Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
-    auto dv = derived_var;
-    auto &w0_ = (name.compare("hydro_wz") == 0)?
-      pm->pmb_pack->phydro->w0 : pm->pmb_pack->pmhd->w0;
-    par_for("temperature", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
-    KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      dv(m,i_dv,k,j,i) = (w0_(m,IEN,k,j,i+1) / w0_(m,IDN,k,j,i-1));
-    });
-    i_dv += 1; // increment derived variable index
-  }
-
-  // z-component of vorticity.
-  // Not computed in ghost zones since requires derivative
-  if (name.compare("hydro_wz") == 0 ||
-      name.compare("mhd_wz") == 0) {
-    if (derived_var.extent(4) <= 1)
-      Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
-    auto dv = derived_var;
-    auto &w0_ = (name.compare("hydro_wz") == 0)?
-      pm->pmb_pack->phydro->w0 : pm->pmb_pack->pmhd->w0;
-    par_for("vorz", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
-    KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      dv(m,i_dv,k,j,i) = (w0_(m,IVY,k,j,i+1) - w0_(m,IVY,k,j,i-1))/size.d_view(m).dx1;
-      if (multi_d) {
-        dv(m,i_dv,k,j,i) -=(w0_(m,IVX,k,j+1,i) - w0_(m,IVX,k,j-1,i))/size.d_view(m).dx2;
-      }
-    });
-    i_dv += 1; // increment derived variable index
-  }
-
-  // magnitude of vorticity.
-  // Not computed in ghost zones since requires derivative
-  if (name.compare("hydro_w2") == 0 ||
-      name.compare("mhd_w2") == 0) {
-    if (derived_var.extent(4) <= 1)
-      Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
-    auto dv = derived_var;
-    auto &w0_ = (name.compare("hydro_w2") == 0)?
-      pm->pmb_pack->phydro->w0 : pm->pmb_pack->pmhd->w0;
-    par_for("vor2", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
-    KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      Real w1 = 0.0;
-      Real w2 = -(w0_(m,IVZ,k,j,i+1) - w0_(m,IVZ,k,j,i-1))/size.d_view(m).dx1;
-      Real w3 =  (w0_(m,IVY,k,j,i+1) - w0_(m,IVY,k,j,i-1))/size.d_view(m).dx1;
-      if (multi_d) {
-        w1 += (w0_(m,IVZ,k,j+1,i) - w0_(m,IVZ,k,j-1,i))/size.d_view(m).dx2;
-        w3 -= (w0_(m,IVX,k,j+1,i) - w0_(m,IVX,k,j-1,i))/size.d_view(m).dx2;
+  // The variable name may be a comma-separated list.  Scan it in token order and assign
+  // each quantity handled by the fused kernels below its slot in derived_var; slots
+  // match the indices given to outvars in the BaseTypeOutput constructor.  Quantities
+  // not requested keep slot=-1 and are skipped inside the kernels, so that all requested
+  // quantities are evaluated in a single pass over the grid.
+  int i_temp=-1, i_vorz=-1, i_vor2=-1, i_jz=-1, i_j2=-1, i_curv=-1, i_curv_alt=-1,
+      i_kjxb=-1, i_cperp=-1, i_bmag=-1, i_divb=-1;
+  bool vor_from_hydro = false;
+  // (enrollment index, slot) pairs for user-enrolled derived quantities in the list
+  std::vector<std::pair<int,int>> user_calls;
+  {
+    int islot = 0;
+    std::string rem = name;
+    while (!(rem.empty())) {
+      std::string::size_type pos = rem.find(',');
+      std::string tok = rem.substr(0, pos);
+      if (pos == std::string::npos) {
+        rem.clear();
+      } else {
+        rem.erase(0, pos+1);
       }
-      if (three_d) {
-        w1 -= (w0_(m,IVY,k+1,j,i) - w0_(m,IVY,k-1,j,i))/size.d_view(m).dx3;
-        w2 += (w0_(m,IVX,k+1,j,i) - w0_(m,IVX,k-1,j,i))/size.d_view(m).dx3;
+      std::string::size_type tb = tok.find_first_not_of(' ');
+      std::string::size_type te = tok.find_last_not_of(' ');
+      tok = (tb == std::string::npos)? "" : tok.substr(tb, te-tb+1);
+      if        (tok.compare("temperature") == 0)   {i_temp = islot++;
+      } else if (tok.compare("hydro_wz") == 0)      {i_vorz = islot++;
+                                                     vor_from_hydro = true;
+      } else if (tok.compare("mhd_wz") == 0)        {i_vorz = islot++;
+      } else if (tok.compare("hydro_w2") == 0)      {i_vor2 = islot++;
+                                                     vor_from_hydro = true;
+      } else if (tok.compare("mhd_w2") == 0)        {i_vor2 = islot++;
+      } else if (tok.compare("mhd_jz") == 0)        {i_jz = islot++;
+      } else if (tok.compare("mhd_j2") == 0)        {i_j2 = islot++;
+      } else if (tok.compare("mhd_curv") == 0)      {i_curv = islot++;
+      } else if (tok.compare("mhd_curv_alt") == 0)  {i_curv_alt = islot++;
+      } else if (tok.compare("mhd_k_jxb") == 0)     {i_kjxb = islot++;
+      } else if (tok.compare("mhd_curv_perp") == 0) {i_cperp = islot++;
+      } else if (tok.compare("mhd_bmag") == 0)      {i_bmag = islot++;
+      } else if (tok.compare("mhd_divb") == 0)      {i_divb = islot++;
+      } else if (pm->pgen != nullptr) {
+        // derived quantities enrolled at runtime by the problem generator
+        for (int u=0; u<static_cast<int>(pm->pgen->user_dvars.size()); ++u) {
+          if (tok.compare(pm->pgen->user_dvars[u].name) == 0) {
+            user_calls.emplace_back(u, islot++);
+          }
+        }
       }
-      dv(m,i_dv,k,j,i) = w1*w1 + w2*w2 + w3*w3;
-    });
-    i_dv += 1; // increment derived variable index
+    }
   }
 
-  // z-component of current density.  Calculated from cell-centered fields.
-  // This makes for a large stencil, but approximates volume-averaged value within cell.
-  // Not computed in ghost zones since requires derivative
-  if (name.compare("mhd_jz") == 0) {
+  // fused kernel over quantities derived from w0 (temperature, vorticity).
+  // Not computed in ghost zones since vorticity requires derivative
+  if ((i_temp >= 0) || (i_vorz >= 0) || (i_vor2 >= 0)) {
     if (derived_var.extent(4) <= 1)
       Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
     auto dv = derived_var;
-    auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("jz", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    auto &w0_ = (vor_from_hydro)?
+      pm->pmb_pack->phydro->w0 : pm->pmb_pack->pmhd->w0;
+    par_for("derived_w0", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      dv(m,i_dv,k,j,i) = (bcc(m,IBY,k,j,i+1) - bcc(m,IBY,k,j,i-1))/size.d_view(m).dx1;
-      if (multi_d) {
-        dv(m,i_dv,k,j,i) -=(bcc(m,IBX,k,j+1,i) - bcc(m,IBX,k,j-1,i))/size.d_view(m).dx2;
+      // temperature = pressure / density
+      if (i_temp >= 0) {
+        dv(m,i_temp,k,j,i) = (w0_(m,IEN,k,j,i+1) / w0_(m,IDN,k,j,i-1));
       }
-    });
-    i_dv += 1; // increment derived variable index
-  }
-
-  // magnitude of current density.  Calculated from cell-centered fields.
-  // Not computed in ghost zones since requires derivative
-  if (name.compare("mhd_j2") == 0) {
-    if (derived_var.extent(4) <= 1)
-      Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
-    auto dv = derived_var;
-    auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("j2", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
-    KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      Real j1 = 0.0;
-      Real j2 = -(bcc(m,IBZ,k,j,i+1) - bcc(m,IBZ,k,j,i-1))/size.d_view(m).dx1;
-      Real j3 =  (bcc(m,IBY,k,j,i+1) - bcc(m,IBY,k,j,i-1))/size.d_view(m).dx1;
-      if (multi_d) {
-        j1 += (bcc(m,IBZ,k,j+1,i) - bcc(m,IBZ,k,j-1,i))/size.d_view(m).dx2;
-        j3 -= (bcc(m,IBX,k,j+1,i) - bcc(m,IBX,k,j-1,i))/size.d_view(m).dx2;
+      // z-component of vorticity (useful in 2D)
+      if (i_vorz >= 0) {
+        Real vorz = (w0_(m,IVY,k,j,i+1) - w0_(m,IVY,k,j,i-1))/size.d_view(m).dx1;
+        if (multi_d) {
+          vorz -= (w0_(m,IVX,k,j+1,i) - w0_(m,IVX,k,j-1,i))/size.d_view(m).dx2;
+        }
+        dv(m,i_vorz,k,j,i) = vorz;
       }
-      if (three_d) {
-        j1 -= (bcc(m,IBY,k+1,j,i) - bcc(m,IBY,k-1,j,i))/size.d_view(m).dx3;
-        j2 += (bcc(m,IBX,k+1,j,i) - bcc(m,IBX,k-1,j,i))/size.d_view(m).dx3;
+      // magnitude of vorticity (useful in 3D)
+      if (i_vor2 >= 0) {
+        Real w1 = 0.0;
+        Real w2 = -(w0_(m,IVZ,k,j,i+1) - w0_(m,IVZ,k,j,i-1))/size.d_view(m).dx1;
+        Real w3 =  (w0_(m,IVY,k,j,i+1) - w0_(m,IVY,k,j,i-1))/size.d_view(m).dx1;
+        if (multi_d) {
+          w1 += (w0_(m,IVZ,k,j+1,i) - w0_(m,IVZ,k,j-1,i))/size.d_view(m).dx2;
+          w3 -= (w0_(m,IVX,k,j+1,i) - w0_(m,IVX,k,j-1,i))/size.d_view(m).dx2;
+        }
+        if (three_d) {
+          w1 -= (w0_(m,IVY,k+1,j,i) - w0_(m,IVY,k-1,j,i))/size.d_view(m).dx3;
+          w2 += (w0_(m,IVX,k+1,j,i) - w0_(m,IVX,k-1,j,i))/size.d_view(m).dx3;
+        }
+        dv(m,i_vor2,k,j,i) = w1*w1 + w2*w2 + w3*w3;
       }
-      dv(m,i_dv,k,j,i) = j1*j1 + j2*j2 + j3*j3;
     });
-    i_dv += 1; // increment derived variable index
   }
 
-  // magnitude of curvature = |B^-2 (B.gradB) - B^-4 (BB:gradB)|.
-  // or curvature = |(B.gradB).(I - bhat bhat)/B^2|
-  // Calculated from cell-centered fields.
+  // fused kernel over quantities derived from cell-centered magnetic fields (current
+  // density, field-line curvature, |B|).  Using cell-centered fields makes for a large
+  // stencil, but approximates volume-averaged value within cell.  Shared intermediates
+  // (j = Curl(B), gradients of b_hat) are computed once per cell no matter how many of
+  // the requested quantities consume them.
   // Not computed in ghost zones since requires derivative
-  if (name.compare("mhd_curv") == 0) {
+  if ((i_jz >= 0) || (i_j2 >= 0) || (i_curv >= 0) || (i_curv_alt >= 0) ||
+      (i_kjxb >= 0) || (i_cperp >= 0) || (i_bmag >= 0)) {
     if (derived_var.extent(4) <= 1)
       Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
     auto dv = derived_var;
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("curv", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    const bool need_j = ((i_jz >= 0) || (i_j2 >= 0) || (i_kjxb >= 0) || (i_cperp >= 0));
+    par_for("derived_bcc", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       // Calculate |B|
       Real &Bx = bcc(m,IBX,k,j,i);
@@ -174,142 +169,182 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
 
       Real B_mag_squared = ( Bx*Bx + By*By + Bz*Bz);
 
-      // Calculate gradB tensor
-      Real dBx_dx = (bcc(m,IBX,k,j,i+1) - bcc(m,IBX,k,j,i-1))/(2.0*size.d_view(m).dx1);
-      Real dBx_dy = (bcc(m,IBX,k,j+1,i) - bcc(m,IBX,k,j-1,i))/(2.0*size.d_view(m).dx2);
-      Real dBx_dz = (bcc(m,IBX,k+1,j,i) - bcc(m,IBX,k-1,j,i))/(2.0*size.d_view(m).dx3);
-
-      Real dBy_dx = (bcc(m,IBY,k,j,i+1) - bcc(m,IBY,k,j,i-1))/(2.0*size.d_view(m).dx1);
-      Real dBy_dy = (bcc(m,IBY,k,j+1,i) - bcc(m,IBY,k,j-1,i))/(2.0*size.d_view(m).dx2);
-      Real dBy_dz = (bcc(m,IBY,k+1,j,i) - bcc(m,IBY,k-1,j,i))/(2.0*size.d_view(m).dx3);
-
-      Real dBz_dx = (bcc(m,IBZ,k,j,i+1) - bcc(m,IBZ,k,j,i-1))/(2.0*size.d_view(m).dx1);
-      Real dBz_dy = (bcc(m,IBZ,k,j+1,i) - bcc(m,IBZ,k,j-1,i))/(2.0*size.d_view(m).dx2);
-      Real dBz_dz = (bcc(m,IBZ,k+1,j,i) - bcc(m,IBZ,k-1,j,i))/(2.0*size.d_view(m).dx3);
-
-      Real BdotGradB_x = (Bx * dBx_dx + By * dBx_dy + Bz * dBx_dz);
-      Real BdotGradB_y = (Bx * dBy_dx + By * dBy_dy + Bz * dBy_dz);
-      Real BdotGradB_z = (Bx * dBz_dx + By * dBz_dy + Bz * dBz_dz);
-
-      Real Identity_minus_bhat_bhat_xx = 1.0 - Bx*Bx/B_mag_squared;
-      Real Identity_minus_bhat_bhat_xy = 0.0 - Bx*By/B_mag_squared;
-      Real Identity_minus_bhat_bhat_xz = 0.0 - Bx*Bz/B_mag_squared;
-
-      Real Identity_minus_bhat_bhat_yx = 0.0 - By*Bx/B_mag_squared;
-      Real Identity_minus_bhat_bhat_yy = 1.0 - By*By/B_mag_squared;
-      Real Identity_minus_bhat_bhat_yz = 0.0 - By*Bz/B_mag_squared;
-
-      Real Identity_minus_bhat_bhat_zx = 0.0 - Bz*Bx/B_mag_squared;
-      Real Identity_minus_bhat_bhat_zy = 0.0 - Bz*By/B_mag_squared;
-      Real Identity_minus_bhat_bhat_zz = 1.0 - Bz*Bz/B_mag_squared;
-
-      // Calculate curvature which is |(B.gradB).(I - bhat bhat)/B^2|
-      Real curv1 = (
-            BdotGradB_x * Identity_minus_bhat_bhat_xx
-          + BdotGradB_y * Identity_minus_bhat_bhat_yx
-          + BdotGradB_z * Identity_minus_bhat_bhat_zx
-        );
-      Real curv2 = (
-            BdotGradB_x * Identity_minus_bhat_bhat_xy
-          + BdotGradB_y * Identity_minus_bhat_bhat_yy
-          + BdotGradB_z * Identity_minus_bhat_bhat_zy
-        );
-      Real curv3 = (
-            BdotGradB_x * Identity_minus_bhat_bhat_xz
-          + BdotGradB_y * Identity_minus_bhat_bhat_yz
-          + BdotGradB_z * Identity_minus_bhat_bhat_zz
-        );
-
-      dv(m,i_dv,k,j,i) = sqrt(curv1*curv1 + curv2*curv2 + curv3*curv3)/B_mag_squared;
-    });
-    i_dv += 1; // increment derived variable index
-  }
+      // magnitude of bmag = |bcc|
+      if (i_bmag >= 0) {
+        dv(m,i_bmag,k,j,i) = sqrt(B_mag_squared);
+      }
 
-  // magnitude of curvature = |b_hat dot nabla b_hat|.
-  // Calculated from cell-centered fields.
-  // Not computed in ghost zones since requires derivative
-  if (name.compare("mhd_curv_alt") == 0) {
-    if (derived_var.extent(4) <= 1)
-      Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
-    auto dv = derived_var;
-    auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("curv_alt", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
-    KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      // Calculate |B|
-      Real B_mag = sqrt( bcc(m,IBX,k,j,i)*bcc(m,IBX,k,j,i)
-                       + bcc(m,IBY,k,j,i)*bcc(m,IBY,k,j,i)
-                       + bcc(m,IBZ,k,j,i)*bcc(m,IBZ,k,j,i));
-      // Calculate b_hat vector
-      Real b1 = bcc(m,IBX,k,j,i)/B_mag;
-      Real b2 = bcc(m,IBY,k,j,i)/B_mag;
-      Real b3 = bcc(m,IBZ,k,j,i)/B_mag;
-
-      // calculate b_hat vector at i +/- 1
-      Real B_mag_ip1 = sqrt( bcc(m,IBX,k,j,i+1)*bcc(m,IBX,k,j,i+1)
-                           + bcc(m,IBY,k,j,i+1)*bcc(m,IBY,k,j,i+1)
-                           + bcc(m,IBZ,k,j,i+1)*bcc(m,IBZ,k,j,i+1));
-      Real b1_ip1 = bcc(m,IBX,k,j,i+1)/B_mag_ip1;
-      Real b2_ip1 = bcc(m,IBY,k,j,i+1)/B_mag_ip1;
-      Real b3_ip1 = bcc(m,IBZ,k,j,i+1)/B_mag_ip1;
-
-      Real B_mag_im1 = sqrt( bcc(m,IBX,k,j,i-1)*bcc(m,IBX,k,j,i-1)
-                           + bcc(m,IBY,k,j,i-1)*bcc(m,IBY,k,j,i-1)
-                           + bcc(m,IBZ,k,j,i-1)*bcc(m,IBZ,k,j,i-1));
-      Real b1_im1 = bcc(m,IBX,k,j,i-1)/B_mag_im1;
-      Real b2_im1 = bcc(m,IBY,k,j,i-1)/B_mag_im1;
-      Real b3_im1 = bcc(m,IBZ,k,j,i-1)/B_mag_im1;
-
-      // calculate b_hat vector at j +/- 1
-      Real B_mag_jp1 = sqrt( bcc(m,IBX,k,j+1,i)*bcc(m,IBX,k,j+1,i)
-                           + bcc(m,IBY,k,j+1,i)*bcc(m,IBY,k,j+1,i)
-                           + bcc(m,IBZ,k,j+1,i)*bcc(m,IBZ,k,j+1,i));
-      Real b1_jp1 = bcc(m,IBX,k,j+1,i)/B_mag_jp1;
-      Real b2_jp1 = bcc(m,IBY,k,j+1,i)/B_mag_jp1;
-      Real b3_jp1 = bcc(m,IBZ,k,j+1,i)/B_mag_jp1;
-
-      Real B_mag_jm1 = sqrt( bcc(m,IBX,k,j-1,i)*bcc(m,IBX,k,j-1,i)
-                           + bcc(m,IBY,k,j-1,i)*bcc(m,IBY,k,j-1,i)
-                           + bcc(m,IBZ,k,j-1,i)*bcc(m,IBZ,k,j-1,i));
-      Real b1_jm1 = bcc(m,IBX,k,j-1,i)/B_mag_jm1;
-      Real b2_jm1 = bcc(m,IBY,k,j-1,i)/B_mag_jm1;
-      Real b3_jm1 = bcc(m,IBZ,k,j-1,i)/B_mag_jm1;
-
-      // calculate b_hat vector at k +/- 1
-      Real B_mag_kp1 = sqrt( bcc(m,IBX,k+1,j,i)*bcc(m,IBX,k+1,j,i)
-                           + bcc(m,IBY,k+1,j,i)*bcc(m,IBY,k+1,j,i)
-                           + bcc(m,IBZ,k+1,j,i)*bcc(m,IBZ,k+1,j,i));
-      Real b1_kp1 = bcc(m,IBX,k+1,j,i)/B_mag_kp1;
-      Real b2_kp1 = bcc(m,IBY,k+1,j,i)/B_mag_kp1;
-      Real b3_kp1 = bcc(m,IBZ,k+1,j,i)/B_mag_kp1;
-
-      Real B_mag_km1 = sqrt( bcc(m,IBX,k-1,j,i)*bcc(m,IBX,k-1,j,i)
-                           + bcc(m,IBY,k-1,j,i)*bcc(m,IBY,k-1,j,i)
-                           + bcc(m,IBZ,k-1,j,i)*bcc(m,IBZ,k-1,j,i));
-      Real b1_km1 = bcc(m,IBX,k-1,j,i)/B_mag_km1;
-      Real b2_km1 = bcc(m,IBY,k-1,j,i)/B_mag_km1;
-      Real b3_km1 = bcc(m,IBZ,k-1,j,i)/B_mag_km1;
-
-      // Central differencing of b_hat vector
-      Real db1_dx1 = (b1_ip1 - b1_im1)/(2.0*size.d_view(m).dx1);
-      Real db2_dx1 = (b2_ip1 - b2_im1)/(2.0*size.d_view(m).dx1);
-      Real db3_dx1 = (b3_ip1 - b3_im1)/(2.0*size.d_view(m).dx1);
-
-      Real db1_dx2 = (b1_jp1 - b1_jm1)/(2.0*size.d_view(m).dx2);
-      Real db2_dx2 = (b2_jp1 - b2_jm1)/(2.0*size.d_view(m).dx2);
-      Real db3_dx2 = (b3_jp1 - b3_jm1)/(2.0*size.d_view(m).dx2);
-
-      Real db1_dx3 = (b1_kp1 - b1_km1)/(2.0*size.d_view(m).dx3);
-      Real db2_dx3 = (b2_kp1 - b2_km1)/(2.0*size.d_view(m).dx3);
-      Real db3_dx3 = (b3_kp1 - b3_km1)/(2.0*size.d_view(m).dx3);
-
-      // Calculate curvature = |b_hat dot nabla b_hat|
-      Real curv1 = b1*db1_dx1 + b2*db1_dx2 + b3*db1_dx3;
-      Real curv2 = b1*db2_dx1 + b2*db2_dx2 + b3*db2_dx3;
-      Real curv3 = b1*db3_dx1 + b2*db3_dx2 + b3*db3_dx3;
-
-      dv(m,i_dv,k,j,i) = sqrt(curv1*curv1 + curv2*curv2 + curv3*curv3);
+      // current density j = Curl(B), shared by mhd_jz/mhd_j2/mhd_k_jxb/mhd_curv_perp
+      Real jc1 = 0.0, jc2 = 0.0, jc3 = 0.0;
+      if (need_j) {
+        jc2 = -(bcc(m,IBZ,k,j,i+1) - bcc(m,IBZ,k,j,i-1))/size.d_view(m).dx1;
+        jc3 =  (bcc(m,IBY,k,j,i+1) - bcc(m,IBY,k,j,i-1))/size.d_view(m).dx1;
+        if (multi_d) {
+          jc1 += (bcc(m,IBZ,k,j+1,i) - bcc(m,IBZ,k,j-1,i))/size.d_view(m).dx2;
+          jc3 -= (bcc(m,IBX,k,j+1,i) - bcc(m,IBX,k,j-1,i))/size.d_view(m).dx2;
+        }
+        if (three_d) {
+          jc1 -= (bcc(m,IBY,k+1,j,i) - bcc(m,IBY,k-1,j,i))/size.d_view(m).dx3;
+          jc2 += (bcc(m,IBX,k+1,j,i) - bcc(m,IBX,k-1,j,i))/size.d_view(m).dx3;
+        }
+      }
+
+      // z-component of current density
+      if (i_jz >= 0) {
+        dv(m,i_jz,k,j,i) = jc3;
+      }
+
+      // magnitude of current density
+      if (i_j2 >= 0) {
+        dv(m,i_j2,k,j,i) = jc1*jc1 + jc2*jc2 + jc3*jc3;
+      }
+
+      // magnitude of K_JxB = | j x B | / B^2
+      if (i_kjxb >= 0) {
+        Real jxB1 = jc2*Bz - jc3*By;
+        Real jxB2 = jc3*Bx - jc1*Bz;
+        Real jxB3 = jc1*By - jc2*Bx;
+        dv(m,i_kjxb,k,j,i) = sqrt(jxB1*jxB1 + jxB2*jxB2 + jxB3*jxB3) / B_mag_squared;
+      }
+
+      // magnitude of curvature = |B^-2 (B.gradB) - B^-4 (BB:gradB)|.
+      // or curvature = |(B.gradB).(I - bhat bhat)/B^2|
+      if (i_curv >= 0) {
+        // Calculate gradB tensor
+        Real dBx_dx = (bcc(m,IBX,k,j,i+1)-bcc(m,IBX,k,j,i-1))/(2.0*size.d_view(m).dx1);
+        Real dBx_dy = (bcc(m,IBX,k,j+1,i)-bcc(m,IBX,k,j-1,i))/(2.0*size.d_view(m).dx2);
+        Real dBx_dz = (bcc(m,IBX,k+1,j,i)-bcc(m,IBX,k-1,j,i))/(2.0*size.d_view(m).dx3);
+
+        Real dBy_dx = (bcc(m,IBY,k,j,i+1)-bcc(m,IBY,k,j,i-1))/(2.0*size.d_view(m).dx1);
+        Real dBy_dy = (bcc(m,IBY,k,j+1,i)-bcc(m,IBY,k,j-1,i))/(2.0*size.d_view(m).dx2);
+        Real dBy_dz = (bcc(m,IBY,k+1,j,i)-bcc(m,IBY,k-1,j,i))/(2.0*size.d_view(m).dx3);
+
+        Real dBz_dx = (bcc(m,IBZ,k,j,i+1)-bcc(m,IBZ,k,j,i-1))/(2.0*size.d_view(m).dx1);
+        Real dBz_dy = (bcc(m,IBZ,k,j+1,i)-bcc(m,IBZ,k,j-1,i))/(2.0*size.d_view(m).dx2);
+        Real dBz_dz = (bcc(m,IBZ,k+1,j,i)-bcc(m,IBZ,k-1,j,i))/(2.0*size.d_view(m).dx3);
+
+        Real BdotGradB_x = (Bx * dBx_dx + By * dBx_dy + Bz * dBx_dz);
+        Real BdotGradB_y = (Bx * dBy_dx + By * dBy_dy + Bz * dBy_dz);
+        Real BdotGradB_z = (Bx * dBz_dx + By * dBz_dy + Bz * dBz_dz);
+
+        Real Identity_minus_bhat_bhat_xx = 1.0 - Bx*Bx/B_mag_squared;
+        Real Identity_minus_bhat_bhat_xy = 0.0 - Bx*By/B_mag_squared;
+        Real Identity_minus_bhat_bhat_xz = 0.0 - Bx*Bz/B_mag_squared;
+
+        Real Identity_minus_bhat_bhat_yx = 0.0 - By*Bx/B_mag_squared;
+        Real Identity_minus_bhat_bhat_yy = 1.0 - By*By/B_mag_squared;
+        Real Identity_minus_bhat_bhat_yz = 0.0 - By*Bz/B_mag_squared;
+
+        Real Identity_minus_bhat_bhat_zx = 0.0 - Bz*Bx/B_mag_squared;
+        Real Identity_minus_bhat_bhat_zy = 0.0 - Bz*By/B_mag_squared;
+        Real Identity_minus_bhat_bhat_zz = 1.0 - Bz*Bz/B_mag_squared;
+
+        // Calculate curvature which is |(B.gradB).(I - bhat bhat)/B^2|
+        Real curv1 = (
+              BdotGradB_x * Identity_minus_bhat_bhat_xx
+            + BdotGradB_y * Identity_minus_bhat_bhat_yx
+            + BdotGradB_z * Identity_minus_bhat_bhat_zx
+          );
+        Real curv2 = (
+              BdotGradB_x * Identity_minus_bhat_bhat_xy
+            + BdotGradB_y * Identity_minus_bhat_bhat_yy
+            + BdotGradB_z * Identity_minus_bhat_bhat_zy
+          );
+        Real curv3 = (
+              BdotGradB_x * Identity_minus_bhat_bhat_xz
+            + BdotGradB_y * Identity_minus_bhat_bhat_yz
+            + BdotGradB_z * Identity_minus_bhat_bhat_zz
+          );
+
+        dv(m,i_curv,k,j,i) = sqrt(curv1*curv1+curv2*curv2+curv3*curv3)/B_mag_squared;
+      }
+
+      // parallel curvature b_hat dot nabla b_hat, shared by mhd_curv_alt/mhd_curv_perp
+      if ((i_curv_alt >= 0) || (i_cperp >= 0)) {
+        Real B_mag = sqrt(B_mag_squared);
+        // Calculate b_hat vector
+        Real b1 = Bx/B_mag;
+        Real b2 = By/B_mag;
+        Real b3 = Bz/B_mag;
+
+        // calculate b_hat vector at i +/- 1
+        Real B_mag_ip1 = sqrt( bcc(m,IBX,k,j,i+1)*bcc(m,IBX,k,j,i+1)
+                             + bcc(m,IBY,k,j,i+1)*bcc(m,IBY,k,j,i+1)
+                             + bcc(m,IBZ,k,j,i+1)*bcc(m,IBZ,k,j,i+1));
+        Real b1_ip1 = bcc(m,IBX,k,j,i+1)/B_mag_ip1;
+        Real b2_ip1 = bcc(m,IBY,k,j,i+1)/B_mag_ip1;
+        Real b3_ip1 = bcc(m,IBZ,k,j,i+1)/B_mag_ip1;
+
+        Real B_mag_im1 = sqrt( bcc(m,IBX,k,j,i-1)*bcc(m,IBX,k,j,i-1)
+                             + bcc(m,IBY,k,j,i-1)*bcc(m,IBY,k,j,i-1)
+                             + bcc(m,IBZ,k,j,i-1)*bcc(m,IBZ,k,j,i-1));
+        Real b1_im1 = bcc(m,IBX,k,j,i-1)/B_mag_im1;
+        Real b2_im1 = bcc(m,IBY,k,j,i-1)/B_mag_im1;
+        Real b3_im1 = bcc(m,IBZ,k,j,i-1)/B_mag_im1;
+
+        // calculate b_hat vector at j +/- 1
+        Real B_mag_jp1 = sqrt( bcc(m,IBX,k,j+1,i)*bcc(m,IBX,k,j+1,i)
+                             + bcc(m,IBY,k,j+1,i)*bcc(m,IBY,k,j+1,i)
+                             + bcc(m,IBZ,k,j+1,i)*bcc(m,IBZ,k,j+1,i));
+        Real b1_jp1 = bcc(m,IBX,k,j+1,i)/B_mag_jp1;
+        Real b2_jp1 = bcc(m,IBY,k,j+1,i)/B_mag_jp1;
+        Real b3_jp1 = bcc(m,IBZ,k,j+1,i)/B_mag_jp1;
+
+        Real B_mag_jm1 = sqrt( bcc(m,IBX,k,j-1,i)*bcc(m,IBX,k,j-1,i)
+                             + bcc(m,IBY,k,j-1,i)*bcc(m,IBY,k,j-1,i)
+                             + bcc(m,IBZ,k,j-1,i)*bcc(m,IBZ,k,j-1,i));
+        Real b1_jm1 = bcc(m,IBX,k,j-1,i)/B_mag_jm1;
+        Real b2_jm1 = bcc(m,IBY,k,j-1,i)/B_mag_jm1;
+        Real b3_jm1 = bcc(m,IBZ,k,j-1,i)/B_mag_jm1;
+
+        // calculate b_hat vector at k +/- 1
+        Real B_mag_kp1 = sqrt( bcc(m,IBX,k+1,j,i)*bcc(m,IBX,k+1,j,i)
+                             + bcc(m,IBY,k+1,j,i)*bcc(m,IBY,k+1,j,i)
+                             + bcc(m,IBZ,k+1,j,i)*bcc(m,IBZ,k+1,j,i));
+        Real b1_kp1 = bcc(m,IBX,k+1,j,i)/B_mag_kp1;
+        Real b2_kp1 = bcc(m,IBY,k+1,j,i)/B_mag_kp1;
+        Real b3_kp1 = bcc(m,IBZ,k+1,j,i)/B_mag_kp1;
+
+        Real B_mag_km1 = sqrt( bcc(m,IBX,k-1,j,i)*bcc(m,IBX,k-1,j,i)
+                             + bcc(m,IBY,k-1,j,i)*bcc(m,IBY,k-1,j,i)
+                             + bcc(m,IBZ,k-1,j,i)*bcc(m,IBZ,k-1,j,i));
+        Real b1_km1 = bcc(m,IBX,k-1,j,i)/B_mag_km1;
+        Real b2_km1 = bcc(m,IBY,k-1,j,i)/B_mag_km1;
+        Real b3_km1 = bcc(m,IBZ,k-1,j,i)/B_mag_km1;
+
+        // Central differencing of b_hat vector
+        Real db1_dx1 = (b1_ip1 - b1_im1)/(2.0*size.d_view(m).dx1);
+        Real db2_dx1 = (b2_ip1 - b2_im1)/(2.0*size.d_view(m).dx1);
+        Real db3_dx1 = (b3_ip1 - b3_im1)/(2.0*size.d_view(m).dx1);
+
+        Real db1_dx2 = (b1_jp1 - b1_jm1)/(2.0*size.d_view(m).dx2);
+        Real db2_dx2 = (b2_jp1 - b2_jm1)/(2.0*size.d_view(m).dx2);
+        Real db3_dx2 = (b3_jp1 - b3_jm1)/(2.0*size.d_view(m).dx2);
+
+        Real db1_dx3 = (b1_kp1 - b1_km1)/(2.0*size.d_view(m).dx3);
+        Real db2_dx3 = (b2_kp1 - b2_km1)/(2.0*size.d_view(m).dx3);
+        Real db3_dx3 = (b3_kp1 - b3_km1)/(2.0*size.d_view(m).dx3);
+
+        // Calculate curvature = |b_hat dot nabla b_hat|
+        Real curv1 = b1*db1_dx1 + b2*db1_dx2 + b3*db1_dx3;
+        Real curv2 = b1*db2_dx1 + b2*db2_dx2 + b3*db2_dx3;
+        Real curv3 = b1*db3_dx1 + b2*db3_dx2 + b3*db3_dx3;
+
+        if (i_curv_alt >= 0) {
+          dv(m,i_curv_alt,k,j,i) = sqrt(curv1*curv1 + curv2*curv2 + curv3*curv3);
+        }
+
+        // magnitude of curv_perp = |(j x B / B^2) - b_hat dot nabla b_hat|
+        if (i_cperp >= 0) {
+          Real jxB1_Bsq = (jc2*Bz - jc3*By)/(B_mag_squared);
+          Real jxB2_Bsq = (jc3*Bx - jc1*Bz)/(B_mag_squared);
+          Real jxB3_Bsq = (jc1*By - jc2*Bx)/(B_mag_squared);
+          dv(m,i_cperp,k,j,i) = sqrt((jxB1_Bsq - curv1)*(jxB1_Bsq - curv1)
+                               + (jxB2_Bsq - curv2)*(jxB2_Bsq - curv2)
+                               + (jxB3_Bsq - curv3)*(jxB3_Bsq - curv3));
+        }
+      }
     });
-    i_dv += 1; // increment derived variable index
   }
 
   // contravariant four-current jcon.  Calculated from cell-centered fields.
@@ -705,170 +740,6 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
   }
 
 
-  // magnitude of K_JxB = | j x B | / B^2
-  // Calculated from cell-centered fields.
-  // Not computed in ghost zones since requires derivative
-  if (name.compare("mhd_k_jxb") == 0) {
-    if (derived_var.extent(4) <= 1)
-      Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
-    auto dv = derived_var;
-    auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("mhd_k_jxb", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
-    KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      // calculate j
-      Real j1 = 0.0;
-      Real j2 = -(bcc(m,IBZ,k,j,i+1) - bcc(m,IBZ,k,j,i-1))/size.d_view(m).dx1;
-      Real j3 =  (bcc(m,IBY,k,j,i+1) - bcc(m,IBY,k,j,i-1))/size.d_view(m).dx1;
-      if (multi_d) {
-        j1 += (bcc(m,IBZ,k,j+1,i) - bcc(m,IBZ,k,j-1,i))/size.d_view(m).dx2;
-        j3 -= (bcc(m,IBX,k,j+1,i) - bcc(m,IBX,k,j-1,i))/size.d_view(m).dx2;
-      }
-      if (three_d) {
-        j1 -= (bcc(m,IBY,k+1,j,i) - bcc(m,IBY,k-1,j,i))/size.d_view(m).dx3;
-        j2 += (bcc(m,IBX,k+1,j,i) - bcc(m,IBX,k-1,j,i))/size.d_view(m).dx3;
-      }
-      // calculate B
-      Real B_mag_sq =    bcc(m,IBX,k,j,i)*bcc(m,IBX,k,j,i)
-                       + bcc(m,IBY,k,j,i)*bcc(m,IBY,k,j,i)
-                       + bcc(m,IBZ,k,j,i)*bcc(m,IBZ,k,j,i);
-
-      // calculate j x B
-      Real jxB1 = j2*bcc(m,IBZ,k,j,i) - j3*bcc(m,IBY,k,j,i);
-      Real jxB2 = j3*bcc(m,IBX,k,j,i) - j1*bcc(m,IBZ,k,j,i);
-      Real jxB3 = j1*bcc(m,IBY,k,j,i) - j2*bcc(m,IBX,k,j,i);
-
-      // calculate | j x B | / B^2
-      dv(m,i_dv,k,j,i) = sqrt(jxB1*jxB1 + jxB2*jxB2 + jxB3*jxB3) / B_mag_sq;
-    });
-  }
-
-  // magnitude of curv_perp = |(j x B / B^2) - b_hat dot nabla b_hat|
-  // Calculated from cell-centered fields.
-  // Not computed in ghost zones since requires derivative
-  if (name.compare("mhd_curv_perp") == 0) {
-    if (derived_var.extent(4) <= 1)
-      Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
-    auto dv = derived_var;
-    auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("curv_perp", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
-    KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      // calculate j
-      Real j1 = 0.0;
-      Real j2 = -(bcc(m,IBZ,k,j,i+1) - bcc(m,IBZ,k,j,i-1))/size.d_view(m).dx1;
-      Real j3 =  (bcc(m,IBY,k,j,i+1) - bcc(m,IBY,k,j,i-1))/size.d_view(m).dx1;
-      if (multi_d) {
-        j1 += (bcc(m,IBZ,k,j+1,i) - bcc(m,IBZ,k,j-1,i))/size.d_view(m).dx2;
-        j3 -= (bcc(m,IBX,k,j+1,i) - bcc(m,IBX,k,j-1,i))/size.d_view(m).dx2;
-      }
-      if (three_d) {
-        j1 -= (bcc(m,IBY,k+1,j,i) - bcc(m,IBY,k-1,j,i))/size.d_view(m).dx3;
-        j2 += (bcc(m,IBX,k+1,j,i) - bcc(m,IBX,k-1,j,i))/size.d_view(m).dx3;
-      }
-      // calculate B
-      Real B_mag_sq =    bcc(m,IBX,k,j,i)*bcc(m,IBX,k,j,i)
-                       + bcc(m,IBY,k,j,i)*bcc(m,IBY,k,j,i)
-                       + bcc(m,IBZ,k,j,i)*bcc(m,IBZ,k,j,i);
-
-      // calculate j x B
-      Real jxB1_Bsq = (j2*bcc(m,IBZ,k,j,i) - j3*bcc(m,IBY,k,j,i))/(B_mag_sq);
-      Real jxB2_Bsq = (j3*bcc(m,IBX,k,j,i) - j1*bcc(m,IBZ,k,j,i))/(B_mag_sq);
-      Real jxB3_Bsq = (j1*bcc(m,IBY,k,j,i) - j2*bcc(m,IBX,k,j,i))/(B_mag_sq);
-
-
-      // now calculate curve_parallel
-      // Calculate b_hat vector
-      Real b1 = bcc(m,IBX,k,j,i)/sqrt(B_mag_sq);
-      Real b2 = bcc(m,IBY,k,j,i)/sqrt(B_mag_sq);
-      Real b3 = bcc(m,IBZ,k,j,i)/sqrt(B_mag_sq);
-
-      // calculate b_hat vector at i +/- 1
-      Real B_mag_ip1 = sqrt( bcc(m,IBX,k,j,i+1)*bcc(m,IBX,k,j,i+1)
-                           + bcc(m,IBY,k,j,i+1)*bcc(m,IBY,k,j,i+1)
-                           + bcc(m,IBZ,k,j,i+1)*bcc(m,IBZ,k,j,i+1));
-      Real b1_ip1 = bcc(m,IBX,k,j,i+1)/B_mag_ip1;
-      Real b2_ip1 = bcc(m,IBY,k,j,i+1)/B_mag_ip1;
-      Real b3_ip1 = bcc(m,IBZ,k,j,i+1)/B_mag_ip1;
-
-      Real B_mag_im1 = sqrt( bcc(m,IBX,k,j,i-1)*bcc(m,IBX,k,j,i-1)
-                           + bcc(m,IBY,k,j,i-1)*bcc(m,IBY,k,j,i-1)
-                           + bcc(m,IBZ,k,j,i-1)*bcc(m,IBZ,k,j,i-1));
-      Real b1_im1 = bcc(m,IBX,k,j,i-1)/B_mag_im1;
-      Real b2_im1 = bcc(m,IBY,k,j,i-1)/B_mag_im1;
-      Real b3_im1 = bcc(m,IBZ,k,j,i-1)/B_mag_im1;
-
-      // calculate b_hat vector at j +/- 1
-      Real B_mag_jp1 = sqrt( bcc(m,IBX,k,j+1,i)*bcc(m,IBX,k,j+1,i)
-                           + bcc(m,IBY,k,j+1,i)*bcc(m,IBY,k,j+1,i)
-                           + bcc(m,IBZ,k,j+1,i)*bcc(m,IBZ,k,j+1,i));
-      Real b1_jp1 = bcc(m,IBX,k,j+1,i)/B_mag_jp1;
-      Real b2_jp1 = bcc(m,IBY,k,j+1,i)/B_mag_jp1;
-      Real b3_jp1 = bcc(m,IBZ,k,j+1,i)/B_mag_jp1;
-
-      Real B_mag_jm1 = sqrt( bcc(m,IBX,k,j-1,i)*bcc(m,IBX,k,j-1,i)
-                           + bcc(m,IBY,k,j-1,i)*bcc(m,IBY,k,j-1,i)
-                           + bcc(m,IBZ,k,j-1,i)*bcc(m,IBZ,k,j-1,i));
-      Real b1_jm1 = bcc(m,IBX,k,j-1,i)/B_mag_jm1;
-      Real b2_jm1 = bcc(m,IBY,k,j-1,i)/B_mag_jm1;
-      Real b3_jm1 = bcc(m,IBZ,k,j-1,i)/B_mag_jm1;
-
-      // calculate b_hat vector at k +/- 1
-      Real B_mag_kp1 = sqrt( bcc(m,IBX,k+1,j,i)*bcc(m,IBX,k+1,j,i)
-                           + bcc(m,IBY,k+1,j,i)*bcc(m,IBY,k+1,j,i)
-                           + bcc(m,IBZ,k+1,j,i)*bcc(m,IBZ,k+1,j,i));
-      Real b1_kp1 = bcc(m,IBX,k+1,j,i)/B_mag_kp1;
-      Real b2_kp1 = bcc(m,IBY,k+1,j,i)/B_mag_kp1;
-      Real b3_kp1 = bcc(m,IBZ,k+1,j,i)/B_mag_kp1;
-
-      Real B_mag_km1 = sqrt( bcc(m,IBX,k-1,j,i)*bcc(m,IBX,k-1,j,i)
-                           + bcc(m,IBY,k-1,j,i)*bcc(m,IBY,k-1,j,i)
-                           + bcc(m,IBZ,k-1,j,i)*bcc(m,IBZ,k-1,j,i));
-      Real b1_km1 = bcc(m,IBX,k-1,j,i)/B_mag_km1;
-      Real b2_km1 = bcc(m,IBY,k-1,j,i)/B_mag_km1;
-      Real b3_km1 = bcc(m,IBZ,k-1,j,i)/B_mag_km1;
-
-      // Central differencing of b_hat vector
-      Real db1_dx1 = (b1_ip1 - b1_im1)/(2.0*size.d_view(m).dx1);
-      Real db2_dx1 = (b2_ip1 - b2_im1)/(2.0*size.d_view(m).dx1);
-      Real db3_dx1 = (b3_ip1 - b3_im1)/(2.0*size.d_view(m).dx1);
-
-      Real db1_dx2 = (b1_jp1 - b1_jm1)/(2.0*size.d_view(m).dx2);
-      Real db2_dx2 = (b2_jp1 - b2_jm1)/(2.0*size.d_view(m).dx2);
-      Real db3_dx2 = (b3_jp1 - b3_jm1)/(2.0*size.d_view(m).dx2);
-
-      Real db1_dx3 = (b1_kp1 - b1_km1)/(2.0*size.d_view(m).dx3);
-      Real db2_dx3 = (b2_kp1 - b2_km1)/(2.0*size.d_view(m).dx3);
-      Real db3_dx3 = (b3_kp1 - b3_km1)/(2.0*size.d_view(m).dx3);
-
-      // Calculate curvature = |b_hat dot nabla b_hat|
-      Real curv1 = b1*db1_dx1 + b2*db1_dx2 + b3*db1_dx3;
-      Real curv2 = b1*db2_dx1 + b2*db2_dx2 + b3*db2_dx3;
-      Real curv3 = b1*db3_dx1 + b2*db3_dx2 + b3*db3_dx3;
-
-      // calculate |(j x B / B^2) - b_hat dot nabla b_hat|
-      dv(m,i_dv,k,j,i) = sqrt((jxB1_Bsq - curv1)*(jxB1_Bsq - curv1)
-                         + (jxB2_Bsq - curv2)*(jxB2_Bsq - curv2)
-                         + (jxB3_Bsq - curv3)*(jxB3_Bsq - curv3));
-    });
-    i_dv += 1; // increment derived variable index
-  }
-
-  // magnitude of bmag = |bcc|
-  // Calculated from cell-centered fields.
-  // Not computed in ghost zones since requires derivative
-  if (name.compare("mhd_bmag") == 0) {
-    if (derived_var.extent(4) <= 1)
-      Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
-    auto dv = derived_var;
-    auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("bmag", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
-    KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      dv(m,i_dv,k,j,i) = sqrt( bcc(m,IBX,k,j,i)*bcc(m,IBX,k,j,i)
-                          + bcc(m,IBY,k,j,i)*bcc(m,IBY,k,j,i)
-                          + bcc(m,IBZ,k,j,i)*bcc(m,IBZ,k,j,i));
-    });
-    i_dv += 1; // increment derived variable index
-  }
-
   // Calculated from cell-centered fields.
   // Not computed in ghost zones since requires derivative
   if (name.compare("mhd_dynamo_ks") == 0) {
@@ -971,8 +842,9 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     });
   }
 
-  // divergence of B, including ghost zones
-  if (name.compare("mhd_divb") == 0) {
+  // divergence of B, including ghost zones.  Kept as a separate kernel since it uses
+  // face-centered fields and extended loop limits, unlike the fused kernels above.
+  if (i_divb >= 0) {
     if (derived_var.extent(4) <= 1)
       Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
 
@@ -995,9 +867,8 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
       if (three_d) {
         divb += (b0.x3f(m,k+1,j,i) - b0.x3f(m,k,j,i))/size.d_view(m).dx3;
       }
-      dv(m,i_dv,k,j,i) = divb;
+      dv(m,i_divb,k,j,i) = divb;
     });
-    i_dv += 1; // increment derived variable index
   }
 
   // radiation moments
@@ -1016,13 +887,11 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     bool &flat = coord.is_minkowski;
     Real &spin = coord.bh_spin;
 
-    // Radiation
-    int nang1 = pm->pmb_pack->prad->prgeo->nangles - 1;
-    auto nh_c_ = pm->pmb_pack->prad->nh_c;
-    auto tet_c_ = pm->pmb_pack->prad->tet_c;
+    // Radiation: coordinate-frame moments come from the shared per-cycle cache (see
+    // Radiation::ComputeMoments); only frame transformations are computed here
+    pm->pmb_pack->prad->ComputeMoments();
+    auto mc = pm->pmb_pack->prad->moments_coord;
     auto tetcov_c_ = pm->pmb_pack->prad->tetcov_c;
-    auto solid_angles_ = pm->pmb_pack->prad->prgeo->solid_angles;
-    auto i0_ = pm->pmb_pack->prad->i0;
     auto norm_to_tet_ = pm->pmb_pack->prad->norm_to_tet;
 
     // Select either Hydro or MHD (if fluid enabled)
@@ -1035,55 +904,42 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
 
     par_for("moments",DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),0,(n1-1),
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      Real &x1min = size.d_view(m).x1min;
-      Real &x1max = size.d_view(m).x1max;
-      Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
-
-      Real &x2min = size.d_view(m).x2min;
-      Real &x2max = size.d_view(m).x2max;
-      Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
-
-      Real &x3min = size.d_view(m).x3min;
-      Real &x3max = size.d_view(m).x3max;
-      Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
-
-      // Extract components of metric
-      Real glower[4][4], gupper[4][4];
-      ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
-
-      // coordinate component n^0
-      Real n0 = tet_c_(m,0,0,k,j,i);
-
-      // set coordinate frame components
-      for (int n1=0, n12=0; n1<4; ++n1) {
-        for (int n2=n1; n2<4; ++n2, ++n12) {
-          dv(m,n12,k,j,i) = 0.0;
-          for (int n=0; n<=nang1; ++n) {
-            Real nmun1 = 0.0; Real nmun2 = 0.0; Real n_0 = 0.0;
-            for (int d=0; d<4; ++d) {
-              nmun1 += tet_c_   (m,d,n1,k,j,i)*nh_c_.d_view(n,d);
-              nmun2 += tet_c_   (m,d,n2,k,j,i)*nh_c_.d_view(n,d);
-              n_0   += tetcov_c_(m,d,0, k,j,i)*nh_c_.d_view(n,d);
-            }
-            dv(m,n12,k,j,i) += (nmun1*nmun2*(i0_(m,n,k,j,i)/(n0*n_0))*
-                                solid_angles_.d_view(n));
-          }
+      // set coordinate frame components from the cached moments
+      if (needs_coord_only || needs_both) {
+        for (int n12=0; n12<10; ++n12) {
+          dv(m,n12,k,j,i) = mc(m,n12,k,j,i);
         }
       }
 
       if (needs_fluid_only || needs_both) {
+        Real &x1min = size.d_view(m).x1min;
+        Real &x1max = size.d_view(m).x1max;
+        Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+        Real &x2min = size.d_view(m).x2min;
+        Real &x2max = size.d_view(m).x2max;
+        Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+        Real &x3min = size.d_view(m).x3min;
+        Real &x3max = size.d_view(m).x3max;
+        Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+        // Extract components of metric (only needed for the fluid-frame boost)
+        Real glower[4][4], gupper[4][4];
+        ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
+
         // stash coordinate frame moments
         Real moments_coord[4][4];
-        moments_coord[0][0] = dv(m,0,k,j,i);
-        moments_coord[0][1] = dv(m,1,k,j,i);
-        moments_coord[0][2] = dv(m,2,k,j,i);
-        moments_coord[0][3] = dv(m,3,k,j,i);
-        moments_coord[1][1] = dv(m,4,k,j,i);
-        moments_coord[1][2] = dv(m,5,k,j,i);
-        moments_coord[1][3] = dv(m,6,k,j,i);
-        moments_coord[2][2] = dv(m,7,k,j,i);
-        moments_coord[2][3] = dv(m,8,k,j,i);
-        moments_coord[3][3] = dv(m,9,k,j,i);
+        moments_coord[0][0] = mc(m,0,k,j,i);
+        moments_coord[0][1] = mc(m,1,k,j,i);
+        moments_coord[0][2] = mc(m,2,k,j,i);
+        moments_coord[0][3] = mc(m,3,k,j,i);
+        moments_coord[1][1] = mc(m,4,k,j,i);
+        moments_coord[1][2] = mc(m,5,k,j,i);
+        moments_coord[1][3] = mc(m,6,k,j,i);
+        moments_coord[2][2] = mc(m,7,k,j,i);
+        moments_coord[2][3] = mc(m,8,k,j,i);
+        moments_coord[3][3] = mc(m,9,k,j,i);
         moments_coord[1][0] = moments_coord[0][1];
         moments_coord[2][0] = moments_coord[0][2];
         moments_coord[3][0] = moments_coord[0][3];
@@ -1207,5 +1063,15 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
       pdens(m,0,kp,jp,ip) += 1.0;
     });
   }
-  i_dv = i_dv % n_dv; // reset derived variable index
+
+  // call user-enrolled derived quantity functions (in the order their names appear in
+  // the variable list); each launches its own kernel(s) filling its slot of derived_var
+  if (!(user_calls.empty())) {
+    if (derived_var.extent(4) <= 1) {
+      Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
+    }
+    for (auto &uc : user_calls) {
+      (pm->pgen->user_dvars[uc.first].func)(pm->pmb_pack, derived_var, uc.second);
+    }
+  }
 }
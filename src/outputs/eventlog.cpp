@@ -24,15 +24,34 @@
 // ctor: also calls BaseTypeOutput base class constructor
 
 EventLogOutput::EventLogOutput(ParameterInput *pin, Mesh *pm, OutputParameters op) :
-  BaseTypeOutput(pin, pm, op) {
+  BaseTypeOutput(pin, pm, op),
+  ectr_stage("ectr_stage", NEVENT_CTR) {
   header_written = false;
 }
 
 //----------------------------------------------------------------------------------------
 //! \fn void EventLogOutput::LoadOutputData()
-//! \brief sums event counter data across MPI ranks
+//! \brief drains device-resident event counters, then sums data across MPI ranks
 
 void EventLogOutput::LoadOutputData(Mesh *pm) {
+  // drain counters accumulated on device (with atomics) into the host struct, then
+  // zero the device array for the next output interval.  This is the only place the
+  // device counters are synchronized with the host.  The copy lands in a persistent
+  // pinned buffer so the drain allocates nothing; it stays a blocking copy so that
+  // increments from kernels still in flight are never lost between copy and zero
+  auto &ectr_host = ectr_stage;
+  Kokkos::deep_copy(ectr_host, pm->ecounter_dvce);
+  Kokkos::deep_copy(pm->ecounter_dvce, 0);
+  pm->ecounter.nfofc       += ectr_host(ECNFOFC);
+  pm->ecounter.neos_dfloor += ectr_host(ECDFLOOR);
+  pm->ecounter.neos_efloor += ectr_host(ECEFLOOR);
+  pm->ecounter.neos_tfloor += ectr_host(ECTFLOOR);
+  pm->ecounter.neos_vceil  += ectr_host(ECVCEIL);
+  pm->ecounter.neos_fail   += ectr_host(ECFAIL);
+  if (ectr_host(ECMAXIT) > pm->ecounter.maxit_c2p) {
+    pm->ecounter.maxit_c2p = ectr_host(ECMAXIT);
+  }
+
 #if MPI_PARALLEL_ENABLED
   // perform in-place sum or max over all MPI ranks, depending on counter
   int* pdfloor = &(pm->ecounter.neos_dfloor);
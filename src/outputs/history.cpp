@@ -13,6 +13,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -56,11 +57,25 @@ HistoryOutput::HistoryOutput(ParameterInput *pin, Mesh *pm, OutputParameters op)
 //  appropriate LoadXXXData() function for that physics
 
 void HistoryOutput::LoadOutputData(Mesh *pm) {
+  // When both Hydro and MHD modules are active their sums are evaluated in a single
+  // fused reduction kernel, avoiding a second sweep over the grid
+  HistoryData *phyd_data = nullptr, *pmhd_data = nullptr;
+  for (auto &data : hist_data) {
+    if (data.physics == PhysicsModule::HydroDynamics) {phyd_data = &data;}
+    if (data.physics == PhysicsModule::MagnetoHydroDynamics) {pmhd_data = &data;}
+  }
+
   for (auto &data : hist_data) {
     if (data.physics == PhysicsModule::HydroDynamics) {
-      LoadHydroHistoryData(&data, pm);
+      if (pmhd_data != nullptr) {
+        LoadHydroMHDHistoryData(&data, pmhd_data, pm);  // fills both entries
+      } else {
+        LoadHydroHistoryData(&data, pm);
+      }
     } else if (data.physics == PhysicsModule::MagnetoHydroDynamics) {
-      LoadMHDHistoryData(&data, pm);
+      if (phyd_data == nullptr) {
+        LoadMHDHistoryData(&data, pm);
+      }
     } else if (data.physics == PhysicsModule::SpaceTimeDynamics) {
       LoadZ4cHistoryData(&data, pm);
     } else if (data.physics == PhysicsModule::UserDefined) {
@@ -170,6 +185,15 @@ void HistoryOutput::LoadZ4cHistoryData(HistoryData *pdata, Mesh *pm) {
   pdata->label[6] = "Theta-norm2";
   pdata->label[7] = "C-norm2";
 
+  // with sampled constraint monitoring the norms were already accumulated over a
+  // decimated cell subset by Z4c::ADMConstraintsNorms(); use them directly
+  if (pm->pmb_pack->pz4c->opt.con_norm_stride > 1) {
+    for (int n=0; n<pdata->nhist; ++n) {
+      pdata->hdata[n] = pm->pmb_pack->pz4c->con_norms[n];
+    }
+    return;
+  }
+
   // capture class variabels for kernel
   auto &u0_ = pm->pmb_pack->pz4c->u0;
   auto &u_con_ = pm->pmb_pack->pz4c->u_con;
@@ -323,23 +347,174 @@ void HistoryOutput::LoadMHDHistoryData(HistoryData *pdata, Mesh *pm) {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void HistoryOutput::LoadHydroMHDHistoryData()
+//  \brief Compute and store history data for both Hydro and MHD modules in a single
+//  fused reduction kernel.  Hydro sums occupy the first phdata->nhist slots of the
+//  accumulator array, MHD sums follow, so that one sweep over the grid fills both
+//  HistoryData entries.
+
+void HistoryOutput::LoadHydroMHDHistoryData(HistoryData *phdata, HistoryData *pmdata,
+                                            Mesh *pm) {
+  auto &heos_data = pm->pmb_pack->phydro->peos->eos_data;
+  auto &meos_data = pm->pmb_pack->pmhd->peos->eos_data;
+  int &nhydro_ = pm->pmb_pack->phydro->nhydro;
+  int &nmhd_ = pm->pmb_pack->pmhd->nmhd;
+
+  // set number of and names of history variables for hydro
+  if (heos_data.is_ideal) {
+    phdata->nhist = 8;
+  } else {
+    phdata->nhist = 7;
+  }
+  phdata->label[IDN] = "mass";
+  phdata->label[IM1] = "1-mom";
+  phdata->label[IM2] = "2-mom";
+  phdata->label[IM3] = "3-mom";
+  if (heos_data.is_ideal) {
+    phdata->label[IEN] = "tot-E";
+  }
+  phdata->label[nhydro_  ] = "1-KE";
+  phdata->label[nhydro_+1] = "2-KE";
+  phdata->label[nhydro_+2] = "3-KE";
+
+  // set number of and names of history variables for mhd
+  if (meos_data.is_ideal) {
+    pmdata->nhist = 11;
+  } else {
+    pmdata->nhist = 10;
+  }
+  pmdata->label[IDN] = "mass";
+  pmdata->label[IM1] = "1-mom";
+  pmdata->label[IM2] = "2-mom";
+  pmdata->label[IM3] = "3-mom";
+  if (meos_data.is_ideal) {
+    pmdata->label[IEN] = "tot-E";
+  }
+  pmdata->label[nmhd_  ] = "1-KE";
+  pmdata->label[nmhd_+1] = "2-KE";
+  pmdata->label[nmhd_+2] = "3-KE";
+  pmdata->label[nmhd_+3] = "1-ME";
+  pmdata->label[nmhd_+4] = "2-ME";
+  pmdata->label[nmhd_+5] = "3-ME";
+
+  // capture class variables for kernel; MHD sums are stored at offset moff
+  auto &uh0_ = pm->pmb_pack->phydro->u0;
+  auto &um0_ = pm->pmb_pack->pmhd->u0;
+  auto &bx1f = pm->pmb_pack->pmhd->b0.x1f;
+  auto &bx2f = pm->pmb_pack->pmhd->b0.x2f;
+  auto &bx3f = pm->pmb_pack->pmhd->b0.x3f;
+  auto &size = pm->pmb_pack->pmb->mb_size;
+  const int moff = phdata->nhist;
+  const int nhist_tot = phdata->nhist + pmdata->nhist;
+
+  // loop over all MeshBlocks in this pack
+  auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
+  int is = indcs.is; int nx1 = indcs.nx1;
+  int js = indcs.js; int nx2 = indcs.nx2;
+  int ks = indcs.ks; int nx3 = indcs.nx3;
+  const int nmkji = (pm->pmb_pack->nmb_thispack)*nx3*nx2*nx1;
+  const int nkji = nx3*nx2*nx1;
+  const int nji  = nx2*nx1;
+  array_sum::GlobalSum sum_this_mb;
+  Kokkos::parallel_reduce("HistSums",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx, array_sum::GlobalSum &mb_sum) {
+    // compute n,k,j,i indices of thread
+    int m = (idx)/nkji;
+    int k = (idx - m*nkji)/nji;
+    int j = (idx - m*nkji - k*nji)/nx1;
+    int i = (idx - m*nkji - k*nji - j*nx1) + is;
+    k += ks;
+    j += js;
+
+    Real vol = size.d_view(m).dx1*size.d_view(m).dx2*size.d_view(m).dx3;
+
+    // Hydro conserved variables:
+    array_sum::GlobalSum hvars;
+    hvars.the_array[IDN] = vol*uh0_(m,IDN,k,j,i);
+    hvars.the_array[IM1] = vol*uh0_(m,IM1,k,j,i);
+    hvars.the_array[IM2] = vol*uh0_(m,IM2,k,j,i);
+    hvars.the_array[IM3] = vol*uh0_(m,IM3,k,j,i);
+    if (heos_data.is_ideal) {
+      hvars.the_array[IEN] = vol*uh0_(m,IEN,k,j,i);
+    }
+
+    // Hydro KE
+    hvars.the_array[nhydro_  ] = vol*0.5*SQR(uh0_(m,IM1,k,j,i))/uh0_(m,IDN,k,j,i);
+    hvars.the_array[nhydro_+1] = vol*0.5*SQR(uh0_(m,IM2,k,j,i))/uh0_(m,IDN,k,j,i);
+    hvars.the_array[nhydro_+2] = vol*0.5*SQR(uh0_(m,IM3,k,j,i))/uh0_(m,IDN,k,j,i);
+
+    // MHD conserved variables:
+    hvars.the_array[moff+IDN] = vol*um0_(m,IDN,k,j,i);
+    hvars.the_array[moff+IM1] = vol*um0_(m,IM1,k,j,i);
+    hvars.the_array[moff+IM2] = vol*um0_(m,IM2,k,j,i);
+    hvars.the_array[moff+IM3] = vol*um0_(m,IM3,k,j,i);
+    if (meos_data.is_ideal) {
+      hvars.the_array[moff+IEN] = vol*um0_(m,IEN,k,j,i);
+    }
+
+    // MHD KE
+    hvars.the_array[moff+nmhd_  ] = vol*0.5*SQR(um0_(m,IM1,k,j,i))/um0_(m,IDN,k,j,i);
+    hvars.the_array[moff+nmhd_+1] = vol*0.5*SQR(um0_(m,IM2,k,j,i))/um0_(m,IDN,k,j,i);
+    hvars.the_array[moff+nmhd_+2] = vol*0.5*SQR(um0_(m,IM3,k,j,i))/um0_(m,IDN,k,j,i);
+
+    // MHD ME
+    hvars.the_array[moff+nmhd_+3] = vol*0.25*(SQR(bx1f(m,k,j,i+1)) + SQR(bx1f(m,k,j,i)));
+    hvars.the_array[moff+nmhd_+4] = vol*0.25*(SQR(bx2f(m,k,j+1,i)) + SQR(bx2f(m,k,j,i)));
+    hvars.the_array[moff+nmhd_+5] = vol*0.25*(SQR(bx3f(m,k+1,j,i)) + SQR(bx3f(m,k,j,i)));
+
+    // fill rest of the_array with zeros, if nhist_tot < NREDUCTION_VARIABLES
+    for (int n=nhist_tot; n<NREDUCTION_VARIABLES; ++n) {
+      hvars.the_array[n] = 0.0;
+    }
+
+    // sum into parallel reduce
+    mb_sum += hvars;
+  }, Kokkos::Sum<array_sum::GlobalSum>(sum_this_mb));
+  Kokkos::fence();
+
+  // store data into hdata arrays
+  for (int n=0; n<phdata->nhist; ++n) {
+    phdata->hdata[n] = sum_this_mb.the_array[n];
+  }
+  for (int n=0; n<pmdata->nhist; ++n) {
+    pmdata->hdata[n] = sum_this_mb.the_array[moff+n];
+  }
+
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void HistoryOutput::WriteOutputFile()
 //  \brief Cycles through hist_data vector and writes history file for each component
 
 void HistoryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
-  for (auto &data : hist_data) {
-    // first, perform in-place sum over all MPI ranks
 #if MPI_PARALLEL_ENABLED
+  // first, sum history data from all physics modules over all MPI ranks with a single
+  // batched reduction; only the master rank needs the result
+  {
+    int nhist_tot = 0;
+    for (auto &data : hist_data) {nhist_tot += data.nhist;}
+    std::vector<Real> buf(nhist_tot);
+    int n = 0;
+    for (auto &data : hist_data) {
+      for (int i=0; i<data.nhist; ++i) {buf[n++] = data.hdata[i];}
+    }
     if (global_variable::my_rank == 0) {
-      MPI_Reduce(MPI_IN_PLACE, &(data.hdata[0]), data.nhist, MPI_ATHENA_REAL,
+      MPI_Reduce(MPI_IN_PLACE, buf.data(), nhist_tot, MPI_ATHENA_REAL,
          MPI_SUM, 0, MPI_COMM_WORLD);
+      n = 0;
+      for (auto &data : hist_data) {
+        for (int i=0; i<data.nhist; ++i) {data.hdata[i] = buf[n++];}
+      }
     } else {
-      MPI_Reduce(&(data.hdata[0]), &(data.hdata[0]), data.nhist,
-         MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
+      MPI_Reduce(buf.data(), buf.data(), nhist_tot, MPI_ATHENA_REAL,
+         MPI_SUM, 0, MPI_COMM_WORLD);
     }
+  }
 #endif
 
+  for (auto &data : hist_data) {
     // only the master rank writes the file
     if (global_variable::my_rank == 0) {
       // create filename: "file_basename" + ".physics" + ".hst"
@@ -361,35 +536,66 @@ void HistoryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
         default:
           break;
       }
-      fname.append(".hst");
+      fname.append((out_params.hst_binary)? ".bhst" : ".hst");
 
       // open file for output
       FILE *pfile;
-      if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
+      const char *mode = (out_params.hst_binary)? "ab" : "a";
+      if ((pfile = std::fopen(fname.c_str(),mode)) == nullptr) {
         std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
           << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
         exit(EXIT_FAILURE);
       }
 
-      // Write header, if it has not been written already
-      if (!(data.header_written)) {
-        int iout = 1;
-        std::fprintf(pfile,"# Athena++ history data\n");
-        std::fprintf(pfile,"#  [%d]=time      ", iout++);
-        std::fprintf(pfile,"[%d]=dt       ", iout++);
-        for (int n=0; n<data.nhist; ++n) {
-          std::fprintf(pfile,"[%d]=%.10s    ", iout++, data.label[n].c_str());
+      if (out_params.hst_binary) {
+        // Binary mode: self-describing text header followed by fixed-width records of
+        // native-endian Reals, one appended per dump with a single write (convert with
+        // vis/python/hst_convert.py).  The header is only written when the file is
+        // empty, so restarts extend the record stream seamlessly.
+        if (!(data.header_written)) {
+          std::fseek(pfile, 0, SEEK_END);
+          if (std::ftell(pfile) == 0) {
+            int iout = 1;
+            std::fprintf(pfile,"# AthenaK binary history\n");
+            std::fprintf(pfile,"# realsize=%d nvar=%d\n",
+                         static_cast<int>(sizeof(Real)), data.nhist+2);
+            std::fprintf(pfile,"#  [%d]=time      ", iout++);
+            std::fprintf(pfile,"[%d]=dt       ", iout++);
+            for (int n=0; n<data.nhist; ++n) {
+              std::fprintf(pfile,"[%d]=%.10s    ", iout++, data.label[n].c_str());
+            }
+            std::fprintf(pfile,"\n# end_header\n");
+          }
+          data.header_written = true;
         }
-        std::fprintf(pfile,"\n");                              // terminate line
-        data.header_written = true;
-      }
 
-      // write history variables
-      std::fprintf(pfile, out_params.data_format.c_str(), pm->time);
-      std::fprintf(pfile, out_params.data_format.c_str(), pm->dt);
-      for (int n=0; n<data.nhist; ++n)
-        std::fprintf(pfile, out_params.data_format.c_str(), data.hdata[n]);
-      std::fprintf(pfile,"\n"); // terminate line
+        // write history variables as one fixed-width binary record
+        Real rec[2+NHISTORY_VARIABLES];
+        rec[0] = pm->time;
+        rec[1] = pm->dt;
+        for (int n=0; n<data.nhist; ++n) {rec[2+n] = data.hdata[n];}
+        std::fwrite(rec, sizeof(Real), 2+data.nhist, pfile);
+      } else {
+        // Write header, if it has not been written already
+        if (!(data.header_written)) {
+          int iout = 1;
+          std::fprintf(pfile,"# Athena++ history data\n");
+          std::fprintf(pfile,"#  [%d]=time      ", iout++);
+          std::fprintf(pfile,"[%d]=dt       ", iout++);
+          for (int n=0; n<data.nhist; ++n) {
+            std::fprintf(pfile,"[%d]=%.10s    ", iout++, data.label[n].c_str());
+          }
+          std::fprintf(pfile,"\n");                              // terminate line
+          data.header_written = true;
+        }
+
+        // write history variables
+        std::fprintf(pfile, out_params.data_format.c_str(), pm->time);
+        std::fprintf(pfile, out_params.data_format.c_str(), pm->dt);
+        for (int n=0; n<data.nhist; ++n)
+          std::fprintf(pfile, out_params.data_format.c_str(), data.hdata[n]);
+        std::fprintf(pfile,"\n"); // terminate line
+      }
       std::fclose(pfile);
     }
   } // End loop over hist_data vector
@@ -0,0 +1,139 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file insitu_analysis.cpp
+//  \brief runs in-situ analysis plugins enrolled by the problem generator and writes
+//  their results in history format, one file per plugin.  Plugins reduce device-resident
+//  data to a handful of scalars at output cadence, replacing post-processing pipelines
+//  that dump full grid data only to re-read and reduce it offline.
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "pgen/pgen.hpp"
+#include "outputs.hpp"
+
+//----------------------------------------------------------------------------------------
+// Constructor: also calls BaseTypeOutput base class constructor
+
+InSituAnalysisOutput::InSituAnalysisOutput(ParameterInput *pin, Mesh *pm,
+                                           OutputParameters op) :
+  BaseTypeOutput(pin, pm, op) {
+  // add a HistoryData struct for each enrolled plugin
+  if (pm->pgen->user_analysis.empty()) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Output block '" << op.block_name << "' has file_type=insitu, "
+        << "but no plugins were enrolled by EnrollInSituAnalysis()." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  plugin_data.clear();
+  for (std::size_t p=0; p<(pm->pgen->user_analysis.size()); ++p) {
+    plugin_data.emplace_back(PhysicsModule::UserDefined);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void InSituAnalysisOutput::LoadOutputData()
+//  \brief Cycles through enrolled plugins, each of which performs its own device-side
+//  reductions over the MeshBlockPack arrays and fills its HistoryData with rank-local
+//  sums.  Plugins share the UserHistoryFnPtr signature, so existing user history
+//  functions can be enrolled unchanged.
+
+void InSituAnalysisOutput::LoadOutputData(Mesh *pm) {
+  for (std::size_t p=0; p<plugin_data.size(); ++p) {
+    (pm->pgen->user_analysis[p].func)(&(plugin_data[p]), pm);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void InSituAnalysisOutput::WriteOutputFile()
+//  \brief Sums plugin results over all ranks and appends them in history format to
+//  "file_basename.<plugin>.hst".  Appended text files can be tailed by live monitoring
+//  tools while the run advances.
+
+void InSituAnalysisOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
+#if MPI_PARALLEL_ENABLED
+  // sum results from all plugins over all MPI ranks with a single batched reduction;
+  // only the master rank needs the result
+  {
+    int nhist_tot = 0;
+    for (auto &data : plugin_data) {nhist_tot += data.nhist;}
+    std::vector<Real> buf(nhist_tot);
+    int n = 0;
+    for (auto &data : plugin_data) {
+      for (int i=0; i<data.nhist; ++i) {buf[n++] = data.hdata[i];}
+    }
+    if (global_variable::my_rank == 0) {
+      MPI_Reduce(MPI_IN_PLACE, buf.data(), nhist_tot, MPI_ATHENA_REAL,
+         MPI_SUM, 0, MPI_COMM_WORLD);
+      n = 0;
+      for (auto &data : plugin_data) {
+        for (int i=0; i<data.nhist; ++i) {data.hdata[i] = buf[n++];}
+      }
+    } else {
+      MPI_Reduce(buf.data(), buf.data(), nhist_tot, MPI_ATHENA_REAL,
+         MPI_SUM, 0, MPI_COMM_WORLD);
+    }
+  }
+#endif
+
+  for (std::size_t p=0; p<plugin_data.size(); ++p) {
+    auto &data = plugin_data[p];
+    // only the master rank writes the file
+    if (global_variable::my_rank == 0) {
+      // create filename: "file_basename" + "." + "plugin name" + ".hst"
+      // There is no file number or id in analysis output filenames.
+      std::string fname;
+      fname.assign(out_params.file_basename);
+      fname.append(".");
+      fname.append(pm->pgen->user_analysis[p].name);
+      fname.append(".hst");
+
+      // open file for output
+      FILE *pfile;
+      if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+        exit(EXIT_FAILURE);
+      }
+
+      // Write header, if it has not been written already
+      if (!(data.header_written)) {
+        int iout = 1;
+        std::fprintf(pfile,"# Athena++ history data\n");
+        std::fprintf(pfile,"#  [%d]=time      ", iout++);
+        std::fprintf(pfile,"[%d]=dt       ", iout++);
+        for (int n=0; n<data.nhist; ++n) {
+          std::fprintf(pfile,"[%d]=%.10s    ", iout++, data.label[n].c_str());
+        }
+        std::fprintf(pfile,"\n");                              // terminate line
+        data.header_written = true;
+      }
+
+      // write analysis results
+      std::fprintf(pfile, out_params.data_format.c_str(), pm->time);
+      std::fprintf(pfile, out_params.data_format.c_str(), pm->dt);
+      for (int n=0; n<data.nhist; ++n)
+        std::fprintf(pfile, out_params.data_format.c_str(), data.hdata[n]);
+      std::fprintf(pfile,"\n"); // terminate line
+      std::fclose(pfile);
+    }
+  } // End loop over plugin_data vector
+
+  // increment counters, clean up
+  if (out_params.last_time < 0.0) {
+    out_params.last_time = pm->time;
+  } else {
+    out_params.last_time += out_params.dt;
+  }
+  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+  return;
+}
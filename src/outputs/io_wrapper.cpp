@@ -6,13 +6,20 @@
 //! \file io_wrapper.cpp
 //! \brief functions that provide wrapper for MPI-IO versus serial input/output
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "io_wrapper.hpp"
@@ -23,6 +30,7 @@
 //! This function must not be called by multiple threads in shared memory parallel regions
 
 int IOWrapper::Open(const char* fname, FileMode rw) {
+  fname_ = fname;  // remember pathname for MapRead()
   // open file for reads
   if (rw == FileMode::read) {
 #if MPI_PARALLEL_ENABLED
@@ -450,6 +458,101 @@ std::size_t IOWrapper::Write_any_type_at_all(const void *buf, IOWrapperSizeT cnt
 #endif
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn char *IOWrapper::MapRead()
+//! \brief maps the file opened with Open() read-only into memory with {mmap}, so callers
+//! can copy record data directly out of the page cache instead of issuing many small
+//! read calls.  Intended for files staged on node-local storage.  Returns nullptr if the
+//! mapping cannot be made; callers must then fall back to the Read_* functions.
+
+char *IOWrapper::MapRead() {
+  int fd = open(fname_.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat fstatus;
+  if (fstat(fd, &fstatus) != 0 || fstatus.st_size == 0) {
+    close(fd);
+    return nullptr;
+  }
+  void *base = mmap(nullptr, fstatus.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // mapping remains valid after the descriptor is closed
+  if (base == MAP_FAILED) {
+    return nullptr;
+  }
+  // start readahead now so later copies find the pages already resident
+  madvise(base, fstatus.st_size, MADV_SEQUENTIAL);
+  madvise(base, fstatus.st_size, MADV_WILLNEED);
+  map_base_ = static_cast<char *>(base);
+  map_size_ = fstatus.st_size;
+  return map_base_;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void IOWrapper::UnmapRead()
+//! \brief releases the mapping made by MapRead(), if any
+
+void IOWrapper::UnmapRead() {
+  if (map_base_ != nullptr) {
+    munmap(map_base_, map_size_);
+    map_base_ = nullptr;
+    map_size_ = 0;
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool IOWrapper::CopyFile()
+//  \brief copies a finished file between filesystems with buffered stdio, returning
+//  false on any error.  Static (no IOWrapper state), so it can run on a background
+//  thread while other IOWrapper objects are in use, e.g. draining a burst-tier
+//  checkpoint to the parallel filesystem
+
+bool IOWrapper::CopyFile(const char *src, const char *dst) {
+  FILE *fin = std::fopen(src, "rb");
+  if (fin == nullptr) {return false;}
+  FILE *fout = std::fopen(dst, "wb");
+  if (fout == nullptr) {
+    std::fclose(fin);
+    return false;
+  }
+  constexpr std::size_t bufsize = 1<<20;
+  std::vector<char> buf(bufsize);
+  bool ok = true;
+  std::size_t nread;
+  while ((nread = std::fread(buf.data(), 1, bufsize, fin)) > 0) {
+    if (std::fwrite(buf.data(), 1, nread, fout) != nread) {
+      ok = false;
+      break;
+    }
+  }
+  if (std::ferror(fin)) {ok = false;}
+  std::fclose(fin);
+  // fclose flushes buffered data, so its status is part of the copy's success
+  if (std::fclose(fout) != 0) {ok = false;}
+  return ok;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void IOWrapper::UnpackReals()
+//  \brief converts count floating-point values of width realsize bytes, packed in src,
+//  into this build's Real.  Allows a restart file written at one precision to be read
+//  by a build at the other, so long campaigns can switch precision at restart
+//  boundaries.  realsize is validated (4 or 8) by callers before any data is read
+
+void IOWrapper::UnpackReals(Real *dst, const char *src, IOWrapperSizeT count,
+                            IOWrapperSizeT realsize) {
+  if (realsize == sizeof(Real)) {
+    std::memcpy(dst, src, count*sizeof(Real));
+  } else if (realsize == sizeof(float)) {
+    const float *fsrc = reinterpret_cast<const float *>(src);
+    for (IOWrapperSizeT n=0; n<count; ++n) {dst[n] = static_cast<Real>(fsrc[n]);}
+  } else {
+    const double *dsrc = reinterpret_cast<const double *>(src);
+    for (IOWrapperSizeT n=0; n<count; ++n) {dst[n] = static_cast<Real>(dsrc[n]);}
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void IOWrapper::Close()
 //  \brief wrapper for {MPI_File_close} versus {std::fclose}
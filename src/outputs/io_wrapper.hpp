@@ -24,10 +24,10 @@ using IOWrapperSizeT = std::uint64_t;
 class IOWrapper {
  public:
 #if MPI_PARALLEL_ENABLED
-  IOWrapper() : fh_(nullptr), comm_(MPI_COMM_WORLD) {}
+  IOWrapper() : fh_(nullptr), comm_(MPI_COMM_WORLD), map_base_(nullptr), map_size_(0) {}
   void SetCommunicator(MPI_Comm scomm) { comm_=scomm;}
 #else
-  IOWrapper() {fh_=nullptr;}
+  IOWrapper() : fh_(nullptr), map_base_(nullptr), map_size_(0) {}
 #endif
   ~IOWrapper() {}
   // nested type definition of strongly typed/scoped enum in class definition
@@ -52,10 +52,31 @@ class IOWrapper {
   int Seek(IOWrapperSizeT offset);
   IOWrapperSizeT GetPosition();
 
+  // copy a finished file between filesystems with buffered stdio.  Used to drain
+  // burst-tier checkpoints to their final location from a background thread; safe to
+  // call concurrently with other I/O since it holds no IOWrapper state
+  static bool CopyFile(const char *src, const char *dst);
+
+  // convert count floating-point values of width realsize (4 or 8 bytes), packed in
+  // src, into this build's Real.  Used when reading a restart file written by a build
+  // at the other precision
+  static void UnpackReals(Real *dst, const char *src, IOWrapperSizeT count,
+                          IOWrapperSizeT realsize);
+
+  // memory-mapped read path, useful when input files are staged on node-local storage.
+  // Returns nullptr if the file cannot be mapped; callers must then fall back to the
+  // read functions above.
+  char *MapRead();
+  void UnmapRead();
+  IOWrapperSizeT GetMapSize() const {return map_size_;}
+
  private:
   IOWrapperFile fh_;
 #if MPI_PARALLEL_ENABLED
   MPI_Comm comm_;
 #endif
+  std::string fname_;          // pathname passed to Open(), kept for MapRead()
+  char *map_base_;             // base address of mapping made by MapRead()
+  IOWrapperSizeT map_size_;    // length of mapping made by MapRead()
 };
 #endif // OUTPUTS_IO_WRAPPER_HPP_
@@ -17,7 +17,8 @@
 //!
 //! Required parameters that must be specified in an <output[n]> block are:
 //!   - variable  = [list of currently implemented strings for specifing output variables
-//!                  is defined at start of outputs.hpp file]
+//!                  is defined at start of outputs.hpp file; may be a comma-separated
+//!                  list of names, in which case derived quantities are fused]
 //!   - file_type = tab,vtk,hst,bin,rst
 //!   - dt        = problem time between outputs
 //!
@@ -92,7 +93,8 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
       if (opar.file_type.compare("hst") != 0 &&
           opar.file_type.compare("rst") != 0 &&
           opar.file_type.compare("log") != 0 &&
-          opar.file_type.compare("trk") != 0) {
+          opar.file_type.compare("trk") != 0 &&
+          opar.file_type.compare("insitu") != 0) {
         opar.variable = pin->GetString(opar.block_name, "variable");
         opar.file_id = pin->GetOrAddString(opar.block_name,"id",opar.variable);
       }
@@ -161,6 +163,52 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
         opar.slice3 = false;
       }
 
+      // read region-of-interest options.  Each MeshBlock is trimmed to the cells inside
+      // the region, so only the requested sub-volume is staged on the host and written.
+      // Unspecified bounds default to the full Mesh extent in that direction
+      opar.region = (pin->DoesParameterExist(opar.block_name,"rgn_x1min") ||
+                     pin->DoesParameterExist(opar.block_name,"rgn_x1max") ||
+                     pin->DoesParameterExist(opar.block_name,"rgn_x2min") ||
+                     pin->DoesParameterExist(opar.block_name,"rgn_x2max") ||
+                     pin->DoesParameterExist(opar.block_name,"rgn_x3min") ||
+                     pin->DoesParameterExist(opar.block_name,"rgn_x3max"));
+      if (opar.region) {
+        opar.rgn_x1min = pin->GetOrAddReal(opar.block_name,"rgn_x1min",
+                                           pm->mesh_size.x1min);
+        opar.rgn_x1max = pin->GetOrAddReal(opar.block_name,"rgn_x1max",
+                                           pm->mesh_size.x1max);
+        opar.rgn_x2min = pin->GetOrAddReal(opar.block_name,"rgn_x2min",
+                                           pm->mesh_size.x2min);
+        opar.rgn_x2max = pin->GetOrAddReal(opar.block_name,"rgn_x2max",
+                                           pm->mesh_size.x2max);
+        opar.rgn_x3min = pin->GetOrAddReal(opar.block_name,"rgn_x3min",
+                                           pm->mesh_size.x3min);
+        opar.rgn_x3max = pin->GetOrAddReal(opar.block_name,"rgn_x3max",
+                                           pm->mesh_size.x3max);
+        if ((opar.rgn_x1min >= opar.rgn_x1max) ||
+            (opar.rgn_x2min >= opar.rgn_x2max) ||
+            (opar.rgn_x3min >= opar.rgn_x3max)) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Region bounds in output block '" << opar.block_name
+              << "' are empty (min must be less than max)" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        // MeshBlocks partially inside the region produce records of different sizes,
+        // which only the bin format supports
+        if (opar.file_type.compare("bin") != 0) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Region output requested in output block '"
+              << opar.block_name << "' is only supported with file_type=bin" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        if (pin->GetOrAddBoolean(opar.block_name, "ghost_zones", false)) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Region output requested in output block '"
+              << opar.block_name << "' cannot include ghost_zones" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+      }
+
       // read ghost cell option
       opar.include_gzs = pin->GetOrAddBoolean(opar.block_name, "ghost_zones", false);
 
@@ -182,7 +230,8 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
       // set output variable and optional file id (default is output variable name)
       if (opar.file_type.compare("hst") != 0 &&
           opar.file_type.compare("rst") != 0 &&
-          opar.file_type.compare("log") != 0) {
+          opar.file_type.compare("log") != 0 &&
+          opar.file_type.compare("insitu") != 0) {
         opar.variable = pin->GetString(opar.block_name, "variable");
         opar.file_id = pin->GetOrAddString(opar.block_name,"id",opar.variable);
       }
@@ -206,6 +255,9 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
       // set optional boolean to output only user-defined history variables
       if (opar.file_type.compare("hst") == 0) {
         opar.user_hist_only =pin->GetOrAddBoolean(opar.block_name,"user_hist_only",false);
+        // optional binary history mode: one fixed-width record appended per dump
+        // instead of per-value text formatting (convert with vis/python/hst_convert.py)
+        opar.hst_binary = pin->GetOrAddBoolean(opar.block_name,"binary",false);
         if (opar.user_hist_only && !(pm->pgen->user_hist)) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
               << std::endl << "User-history file requested in output block '"
@@ -218,6 +270,17 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
       opar.data_format = pin->GetOrAddString(opar.block_name, "data_format", "%12.5e");
       opar.data_format.insert(0, " "); // prepend with blank to separate columns
 
+      // set optional boolean to hand file I/O for this output to a writer thread
+      opar.async_write = pin->GetOrAddBoolean(opar.block_name, "async", false);
+      if (opar.async_write && (opar.file_type.compare("bin") != 0) &&
+          (opar.file_type.compare("vtk") != 0) &&
+          (opar.file_type.compare("rst") != 0)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "async=true in output block '" << opar.block_name
+            << "' is only supported with file_type = bin, vtk, or rst" << std::endl;
+        exit(EXIT_FAILURE);
+      }
+
       // Construct new BaseTypeOutput according to file format
       // NEW_OUTPUT_TYPES: Add block to construct new types here
       BaseTypeOutput *pnode;
@@ -241,6 +304,9 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
       } else if (opar.file_type.compare("trk") == 0) {
         pnode = new TrackedParticleOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
+      } else if (opar.file_type.compare("insitu") == 0) {
+        pnode = new InSituAnalysisOutput(pin,pm,opar);
+        pout_list.insert(pout_list.begin(),pnode);
       } else if (opar.file_type.compare("cbin") == 0) {
         opar.coarsen_factor = pin->GetInteger(opar.block_name,"coarsen_factor");
         opar.compute_moments = pin->GetOrAddBoolean(opar.block_name,
@@ -270,9 +336,54 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
         pnode = new PDFOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
       } else if (opar.file_type.compare("bin") == 0) {
+        opar.compression = pin->GetOrAddString(opar.block_name,"compression","none");
+        opar.compression_level = pin->GetOrAddInteger(opar.block_name,
+                                                      "compression_level",3);
+        if ((opar.compression.compare("none") != 0) &&
+            (opar.compression.compare("zstd") != 0)) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "compression='" << opar.compression << "' in output block '"
+              << opar.block_name << "' is not a valid choice (none or zstd)" << std::endl;
+          exit(EXIT_FAILURE);
+        }
         pnode = new MeshBinaryOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
       } else if (opar.file_type.compare("rst") == 0) {
+        opar.incremental = pin->GetOrAddBoolean(opar.block_name,"incremental",false);
+        opar.dn_full = pin->GetOrAddInteger(opar.block_name,"dn_full",10);
+        if (opar.incremental && (opar.dn_full < 2)) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "dn_full=" << opar.dn_full << " in output block '"
+              << opar.block_name << "' must be at least 2 for incremental restarts"
+              << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        // number of MeshBlocks staged on the host at a time while writing; bounds peak
+        // host memory at the cost of streaming the payload in several smaller writes
+        opar.rst_chunk = pin->GetOrAddInteger(opar.block_name,"mb_per_chunk",0);
+        if (opar.rst_chunk < 0) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "mb_per_chunk=" << opar.rst_chunk << " in output block '"
+              << opar.block_name << "' must be positive" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        if ((opar.rst_chunk > 0) && (opar.incremental || opar.async_write)) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "mb_per_chunk in output block '" << opar.block_name
+              << "' cannot be combined with incremental or async restarts" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        // burst-buffer staging directory for two-tier checkpoints.  Must be a path
+        // writable by every rank (e.g. a job-local burst-buffer mount); checkpoints are
+        // written there synchronously and drained to rst/ in the background
+        opar.burst_dir = pin->GetOrAddString(opar.block_name,"burst_dir","");
+        if (!(opar.burst_dir.empty()) && opar.async_write) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "burst_dir in output block '" << opar.block_name
+              << "' cannot be combined with async=true (the burst write is synchronous "
+              << "and only the drain to rst/ runs in the background)" << std::endl;
+          exit(EXIT_FAILURE);
+        }
       // Add restarts to the tail end of BaseTypeOutput list, so file counters for other
       // output types are up-to-date in restart file
         pnode = new RestartOutput(pin,pm,opar);
@@ -8,7 +8,12 @@
 //! \file outputs.hpp
 //  \brief provides classes to handle ALL types of data output
 
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "Kokkos_ScatterView.hpp"
@@ -123,9 +128,21 @@ struct OutputParameters {
   int gid;
   bool slice1, slice2, slice3;
   Real slice_x1, slice_x2, slice_x3;
+  bool region=false;          // restrict output to sub-volume of mesh (bin outputs only)
+  Real rgn_x1min, rgn_x1max;  // bounds of output region in each direction
+  Real rgn_x2min, rgn_x2max;
+  Real rgn_x3min, rgn_x3max;
   bool user_hist_only;
+  bool hst_binary=false;      // fixed-width binary history records (.bhst files)
   std::string data_format;
   bool contains_derived=false;
+  bool async_write=false;     // hand file I/O to a writer thread (bin, vtk, rst only)
+  std::string compression="none"; // per-MeshBlock compression of bin data (none/zstd)
+  int compression_level=3;    // ZSTD compression level for bin data
+  bool incremental=false;     // write delta checkpoints between full restart snapshots
+  int dn_full=10;             // cadence of full snapshots in incremental restart mode
+  int rst_chunk=0;            // MeshBlocks staged per chunk in restart writes (0 = all)
+  std::string burst_dir="";   // burst-buffer staging dir for restarts ("" = disabled)
   // DBF parameters for coarsened binary:
   // cannot be less than 2 and must be a power of 2 and
   // cannot be greater than shortest meshblock dimension
@@ -133,8 +150,8 @@ struct OutputParameters {
   bool compute_moments; // if true then will compute
   // <q>, <q^2>, <q^3>, <q^4> for each variable q
   // DBF parameters for PDF:
-  // number of derived variables, index of current derived variable
-  int n_derived=0, i_derived=0;
+  // number of derived variables
+  int n_derived=0;
   std::string variable_2; // DBF: for 2d PDFs
   Real bin_min, bin_max;
   Real bin2_min, bin2_max;
@@ -151,9 +168,18 @@ struct OutputVariableInfo {
   std::string label;             // "name" of variable
   int data_index;                // index of variable in device array
   DvceArray5D<Real> *data_ptr;   // ptr to device array containing variable
+#if DIAG_SINGLE_PRECISION_ENABLED
+  // with single precision diagnostics, derived variables live in a binary32 array; a
+  // variable has exactly one of data_ptr/diag_ptr set and readers branch on diag_ptr
+  DvceArray5D<DiagReal> *diag_ptr = nullptr;
+#endif
   // constructor(s)
   OutputVariableInfo(std::string lab, int indx, DvceArray5D<Real> *ptr) :
     label(lab), data_index(indx), data_ptr(ptr) {}
+#if DIAG_SINGLE_PRECISION_ENABLED
+  OutputVariableInfo(std::string lab, int indx, DvceArray5D<DiagReal> *ptr) :
+    label(lab), data_index(indx), data_ptr(nullptr), diag_ptr(ptr) {}
+#endif
 };
 
 //----------------------------------------------------------------------------------------
@@ -204,7 +230,7 @@ struct TrackedParticleData {
 class BaseTypeOutput {
  public:
   BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
-  virtual ~BaseTypeOutput() = default;
+  virtual ~BaseTypeOutput();
   // copy constructor and assignment operator
   BaseTypeOutput(const BaseTypeOutput& copy_other) = default;
   BaseTypeOutput& operator=(const BaseTypeOutput& copy_other) = default;
@@ -214,7 +240,9 @@ class BaseTypeOutput {
 
   // data
   OutputParameters out_params;   // params read from <output> block for this type
-  DvceArray5D<Real> derived_var; // array to store output variables computed from u0/b0
+  // array to store output variables computed from u0/b0; stored as DiagReal since it
+  // never feeds back into the evolution (binary32 with single precision diagnostics)
+  DvceArray5D<DiagReal> derived_var;
 
   // function which computes derived output variables like vorticity and current density
   void ComputeDerivedVariable(std::string name, Mesh *pm);
@@ -223,6 +251,9 @@ class BaseTypeOutput {
   virtual void LoadOutputData(Mesh *pm);
   virtual void WriteOutputFile(Mesh *pm, ParameterInput *pin) = 0;
 
+  // block until the writer thread (if any) has finished the previous dump
+  void FinishPendingWrite();
+
   // Functions to detect big endian machine, and to byte-swap 32-bit words.  The vtk
   // legacy format requires data to be stored as big-endian.
   int IsBigEndian() {
@@ -237,12 +268,29 @@ class BaseTypeOutput {
   }
 
  protected:
+  // Run wfunc on the writer thread, joining any write still in flight first, so at most
+  // one dump is outstanding.  wfunc must capture (by value) everything it touches; in
+  // particular it must not reference the Mesh, ParameterInput, or class members, all of
+  // which evolve while it runs.  Only bin and vtk outputs use this (when async=true).
+  void LaunchAsyncWrite(std::function<void()> wfunc);
+  std::thread cwriter_;    // thread performing file I/O for async writes
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm io_comm_;       // unique communicator for MPI-IO from the writer thread
+#endif
+
   // CC output data on host with dims (n,m,k,j,i) except
   // for restarts, where dims are (m,n,k,j,i)
   HostArray5D<Real> outarray;
   HostArray5D<Real> outarray_hyd, outarray_mhd, outarray_rad,
                     outarray_force, outarray_z4c, outarray_adm;
   HostFaceFld4D<Real> outfield;  // FC output field on host
+
+  // persistent scratch for device-to-host copies in LoadOutputData: a device copy of
+  // one output block and its pinned host landing buffer.  Resized only when the output
+  // block dimensions change (with uniform outputs, once for the whole run), so steady
+  // dumps allocate nothing and the transfer runs into pinned memory at DMA bandwidth
+  DvceArray3D<DiagReal> d_out_scratch;
+  StageArray3D<DiagReal> h_out_scratch;
   std::vector<int> noutmbs;   // with MPI, number of output MBs across all ranks
   int noutmbs_min;            // with MPI, minimum number of output MBs across all ranks
   int noutmbs_max;            // with MPI, maximum number of output MBs across all ranks
@@ -280,10 +328,29 @@ class HistoryOutput : public BaseTypeOutput {
   void LoadOutputData(Mesh *pm) override;
   void LoadHydroHistoryData(HistoryData *pdata, Mesh *pm);
   void LoadMHDHistoryData(HistoryData *pdata, Mesh *pm);
+  void LoadHydroMHDHistoryData(HistoryData *phdata, HistoryData *pmdata, Mesh *pm);
   void LoadZ4cHistoryData(HistoryData *pdata, Mesh *pm);
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
 };
 
+//----------------------------------------------------------------------------------------
+//! \class InSituAnalysisOutput
+//  \brief derived BaseTypeOutput class running in-situ analysis plugins enrolled by the
+//  problem generator (see ProblemGenerator::EnrollInSituAnalysis).  At output cadence
+//  each plugin reduces device-resident data to a handful of scalars, which are written
+//  in history format to one file per plugin; no grid data is ever dumped or re-read
+
+class InSituAnalysisOutput : public BaseTypeOutput {
+ public:
+  InSituAnalysisOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+
+  // vector of length [# of enrolled plugins] containing hdata arrays
+  std::vector<HistoryData> plugin_data;
+
+  void LoadOutputData(Mesh *pm) override;
+  void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+};
+
 //----------------------------------------------------------------------------------------
 //! \class CoarsenedBinaryOutput
 //  \brief derived BaseTypeOutput class for coarsened binary grid data
@@ -297,6 +364,17 @@ class CoarsenedBinaryOutput : public BaseTypeOutput {
   //                            const int coarsen_factor);
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+
+ protected:
+  // persistent device/pinned-host pair holding the coarsened moments of every output
+  // variable on every output MeshBlock, reused across dumps like d_out_scratch /
+  // h_out_scratch in the base class.  Filled by one fused restriction kernel per
+  // variable and drained with a single device-to-host transfer per dump
+  DvceArray5D<DiagReal> d_coarse_scratch;
+  StageArray5D<DiagReal> h_coarse_scratch;
+  // map from output MB index to (MeshBlockPack index, ois, ojs, oks), so the
+  // coarsening kernel can read the source variable arrays in place
+  DualArray2D<int> coarse_mbmap;
 };
 
 //----------------------------------------------------------------------------------------
@@ -305,6 +383,7 @@ class CoarsenedBinaryOutput : public BaseTypeOutput {
 
 struct PDFData {
   int pdf_dimension;
+  int npdf=1;        // number of 1D PDFs stacked in the rows of result_
   int nbin, nbin2;
   Kokkos::View<Real*> bins;
   Kokkos::View<Real*> bins2;
@@ -333,6 +412,8 @@ class PDFOutput : public BaseTypeOutput {
   PDFOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
 
   PDFData pdf_data;
+  // device-resident gather of the PDF source variables, reused between outputs
+  DvceArray5D<Real> pdf_vars_;
 
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
@@ -380,8 +461,22 @@ class MeshBinaryOutput : public BaseTypeOutput {
 class RestartOutput : public BaseTypeOutput {
  public:
   RestartOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  ~RestartOutput() override;
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+
+ private:
+  // bookkeeping for incremental checkpoints: hash of every MeshBlock payload at the
+  // previous checkpoint, keyed by logical location (lx1,lx2,lx3,level) so that entries
+  // remain valid across regridding and load balancing
+  std::map<std::array<std::int32_t,4>, std::uint64_t> block_hash_;
+  int nrst_since_full_=0;  // number of delta checkpoints written since last full one
+
+  // two-tier burst-buffer checkpoints (<output>/burst_dir): the drain thread copies the
+  // finished burst-tier file to its final location while evolution continues
+  void FinishPendingDrain();
+  std::thread cdrainer_;          // rank-0 thread draining burst files to the final dir
+  std::string last_burst_fname_;  // newest burst-tier file; removed after next drain
 };
 
 //----------------------------------------------------------------------------------------
@@ -396,6 +491,10 @@ class EventLogOutput : public BaseTypeOutput {
   bool header_written=false;
   bool no_output=true;
 
+  // persistent pinned-host landing buffer for draining the device counters; allocated
+  // once so the drain allocates nothing and the copy can run on the comm stream
+  StageArray1D<int> ectr_stage;
+
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
 };
@@ -407,15 +506,20 @@ class EventLogOutput : public BaseTypeOutput {
 class TrackedParticleOutput : public BaseTypeOutput {
  public:
   TrackedParticleOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  ~TrackedParticleOutput() override;
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
  protected:
+  void FlushTrackBuffer();
   int ntrack;           // total number of tracked particles across all ranks
-  int ntrack_thisrank;  // number of tracked particles this rank (guess)
-  int npout;            // number of tracked particles to be written this rank
-  bool header_written;
-  std::vector<int> npout_eachrank;
-  HostArray1D<TrackedParticleData> outpart;
+  int flush_interval;   // # of samples accumulated on device before writing
+  int nbuf;             // # of samples currently buffered
+  // device-side sample buffer, capacity flush_interval*ntrack; sample k occupies
+  // entries [k*ntrack, k*ntrack + nbuf_npout[k])
+  DvceArray1D<TrackedParticleData> track_buf;
+  std::vector<int> nbuf_npout;   // per-sample # of records gathered on this rank
+  std::vector<Real> nbuf_time;   // per-sample simulation time
+  std::vector<int> nbuf_cycle;   // per-sample cycle number
 };
 
 //----------------------------------------------------------------------------------------
@@ -44,7 +44,8 @@
 // Constructor: also calls BaseTypeOutput base class constructor
 // this is not right yet
 PDFOutput::PDFOutput(ParameterInput *pin, Mesh *pm, OutputParameters op) :
-  BaseTypeOutput(pin, pm, op) , pdf_data(op.nbin2 == 0 ? 1 : 2, op.nbin, op.nbin2) {
+  BaseTypeOutput(pin, pm, op) , pdf_data(op.nbin2 == 0 ? 1 : 2, op.nbin, op.nbin2),
+  pdf_vars_("pdf_vars",1,1,1,1,1) {
   // create directories for outputs
   // create a new directory for each pdf
   std::string dir_name;
@@ -141,10 +142,20 @@ PDFOutput::PDFOutput(ParameterInput *pin, Mesh *pm, OutputParameters op) :
   }
 
 
+  // A comma-separated variable list accumulates one 1D PDF per name, all sharing the
+  // same bin grid, in a single sweep over the data; each PDF fills one row of result_.
+  // Joint (2D) PDFs take exactly one name in each of variable and variable_2
+  if (pdf_data.pdf_dimension == 2 && outvars.size() != 2) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "2D PDFs require a single name in each of variable and variable_2"
+      << std::endl;
+    exit(EXIT_FAILURE);
+  }
   if (pdf_data.pdf_dimension == 2) {
     pdf_data.result_ = DvceArray2D<Real>("result", op.nbin2+2, op.nbin+2);
   } else if (pdf_data.pdf_dimension == 1) {
-    pdf_data.result_ = DvceArray2D<Real>("result", 1, op.nbin+2);
+    pdf_data.npdf = static_cast<int>(outvars.size());
+    pdf_data.result_ = DvceArray2D<Real>("result", pdf_data.npdf, op.nbin+2);
   }
   pdf_data.scatter_result = Kokkos::Experimental::ScatterView<Real **, LayoutWrapper>(
     pdf_data.result_
@@ -159,14 +170,16 @@ PDFOutput::PDFOutput(ParameterInput *pin, Mesh *pm, OutputParameters op) :
 //  appropriate LoadXXXData() function for that physics
 
 void PDFOutput::LoadOutputData(Mesh *pm) {
-  // Calculate derived variables, if required
-  // if out_params.variable or out_params.variable_2 not a derived
-  // then ComputeDerivedVariable does nothing, so this should be fine
-  // although maybe not optimal -- should probably have a way to
-  // know beforehand which needs to be computed
+  // Calculate derived variables, if required.  Both variables are passed as a single
+  // comma-separated list so that ComputeDerivedVariable assigns slots in the same order
+  // as the BaseTypeOutput constructor and fuses the kernels; names that are not derived
+  // quantities are simply ignored there
   if (out_params.contains_derived) {
-    ComputeDerivedVariable(out_params.variable, pm);
-    ComputeDerivedVariable(out_params.variable_2, pm);
+    std::string dvars = out_params.variable;
+    if (out_params.nbin2 > 1) {
+      dvars += "," + out_params.variable_2;
+    }
+    ComputeDerivedVariable(dvars, pm);
   }
 
   // Pointer for initial determination
@@ -207,14 +220,31 @@ void PDFOutput::LoadOutputData(Mesh *pm) {
   int nx2 = indcs.nx2 + 2*indcs.ng;
   int nx3 = indcs.nx3 + 2*indcs.ng;
 
-  // Copy MeshBlock data from host to device
-  DvceArray5D<Real> outvars_device("outvars_device", outvars.size(), nmb, nx3, nx2, nx1);
+  // Gather the source variables into a device array; the buffer is persistent and only
+  // reallocated when the number of variables or MeshBlocks changes (e.g. with AMR)
+  if (pdf_vars_.extent_int(0) != static_cast<int>(outvars.size()) ||
+      pdf_vars_.extent_int(1) != nmb) {
+    Kokkos::realloc(pdf_vars_, outvars.size(), nmb, nx3, nx2, nx1);
+  }
+  DvceArray5D<Real> outvars_device = pdf_vars_;
   for (std::size_t i = 0; i < outvars.size(); ++i) {
-      auto d_slice = Kokkos::subview(*(outvars[i].data_ptr),
-      Kokkos::ALL(), outvars[i].data_index, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
       auto d_target_slice = Kokkos::subview(outvars_device, i,
       Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
-      Kokkos::deep_copy(d_target_slice, d_slice);
+      // derived variables may be stored at diagnostic precision; deep_copy converts
+      bool from_diag = false;
+#if DIAG_SINGLE_PRECISION_ENABLED
+      if (outvars[i].diag_ptr != nullptr) {
+        from_diag = true;
+        auto d_slice = Kokkos::subview(*(outvars[i].diag_ptr),
+        Kokkos::ALL(), outvars[i].data_index, Kokkos::ALL(),Kokkos::ALL(),Kokkos::ALL());
+        Kokkos::deep_copy(d_target_slice, d_slice);
+      }
+#endif
+      if (!from_diag) {
+        auto d_slice = Kokkos::subview(*(outvars[i].data_ptr),
+        Kokkos::ALL(), outvars[i].data_index, Kokkos::ALL(),Kokkos::ALL(),Kokkos::ALL());
+        Kokkos::deep_copy(d_target_slice, d_slice);
+      }
   }
   Kokkos::fence();
 
@@ -236,53 +266,58 @@ void PDFOutput::LoadOutputData(Mesh *pm) {
   auto nbin_ = pdf_data.nbin;
   auto nbin2_ = pdf_data.nbin2;
   int pdf_dimension = pdf_data.pdf_dimension;
+  int npdf_ = pdf_data.npdf;
   bool logscale = pdf_data.logscale;
   bool logscale2 = pdf_data.logscale2;
   bool mass_weighted = pdf_data.mass_weighted;
 
+  // All PDFs are accumulated in one sweep over the data: a stack of 1D PDFs fills one
+  // row of the result array per variable, while a joint (2D) PDF bins its second
+  // variable into the rows
   par_for("pdf", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
-    auto &x_val = outvars_device(0, m, k, j, i);
-    int x_bin = -1;
-    // First handle edge cases explicitly
-    if (x_val < bins(0)) {
-      x_bin = 0;
-    } else if (x_val >= bins(nbin_)) {
-      x_bin = nbin_ + 1;
-    } else {
-      if (logscale == false) {
-        x_bin = static_cast<int>((x_val - bins(0)) / step_size) + 1;
-      } else if (logscale == true) {
-        x_bin = static_cast<int>(std::log10(x_val / bins(0)) / step_size) + 1;
-      }
-    }
-    // needs to be zero as for the 1D histogram we need 0 as first index of the 2D
-    // result array
-    int y_bin = 0;
-    if (pdf_dimension == 2) {
-      auto &y_val = outvars_device(1, m, k, j, i);
-
-      y_bin = -1; // reset to impossible value
-      // First handle edge cases explicitly
-      if (y_val < bins2(0)) {
-        y_bin = 0;
-      } else if (y_val >= bins2(nbin2_)) {
-        y_bin = nbin2_ + 1;
-      } else {
-        // for lin and log directly pick index
-        if (logscale2 == false) {
-          y_bin = static_cast<int>((y_val - bins2(0)) / step_size2) + 1;
-        } else if (logscale2 == true) {
-          y_bin = static_cast<int>(std::log10(y_val/bins2(0)) / step_size2) + 1;
-        }
-      }
-    }
     auto res = scatter.access();
     Real weight = size.d_view(m).dx1*size.d_view(m).dx2*size.d_view(m).dx3;
     weight *= mass_weighted == false
               ? 1.0
               : u0_(m, IDN, k, j, i);
-    res(y_bin, x_bin) += weight;
+    for (int v=0; v<npdf_; ++v) {
+      auto &x_val = outvars_device(v, m, k, j, i);
+      int x_bin = -1;
+      // First handle edge cases explicitly
+      if (x_val < bins(0)) {
+        x_bin = 0;
+      } else if (x_val >= bins(nbin_)) {
+        x_bin = nbin_ + 1;
+      } else {
+        if (logscale == false) {
+          x_bin = static_cast<int>((x_val - bins(0)) / step_size) + 1;
+        } else if (logscale == true) {
+          x_bin = static_cast<int>(std::log10(x_val / bins(0)) / step_size) + 1;
+        }
+      }
+      // for a 1D histogram stack the row is the pdf index
+      int y_bin = v;
+      if (pdf_dimension == 2) {
+        auto &y_val = outvars_device(1, m, k, j, i);
+
+        y_bin = -1; // reset to impossible value
+        // First handle edge cases explicitly
+        if (y_val < bins2(0)) {
+          y_bin = 0;
+        } else if (y_val >= bins2(nbin2_)) {
+          y_bin = nbin2_ + 1;
+        } else {
+          // for lin and log directly pick index
+          if (logscale2 == false) {
+            y_bin = static_cast<int>((y_val - bins2(0)) / step_size2) + 1;
+          } else if (logscale2 == true) {
+            y_bin = static_cast<int>(std::log10(y_val/bins2(0)) / step_size2) + 1;
+          }
+        }
+      }
+      res(y_bin, x_bin) += weight;
+    }
   });
 
   // "reduce" results from scatter view to original view.
@@ -333,9 +368,9 @@ void PDFOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
       }
 
       std::fprintf(pfile,"# pdf bins \n");
-      std::fprintf(pfile,"# [1]= %.20s \n", outvars[0].label.c_str());
-      if (pdf_data.pdf_dimension == 2) {
-        std::fprintf(pfile,"# [2]= %.20s \n", outvars[1].label.c_str());
+      for (std::size_t n=0; n<outvars.size(); ++n) {
+        std::fprintf(pfile,"# [%d]= %.20s \n", static_cast<int>(n+1),
+                     outvars[n].label.c_str());
       }
 
       // write bins
@@ -397,7 +432,8 @@ void PDFOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     std::fprintf(pfile, "# time= ");
     std::fprintf(pfile, out_params.data_format.c_str(), pm->time);
     std::fprintf(pfile, "\n");
-    int number_n2_bins = pdf_data.pdf_dimension == 2 ? pdf_data.nbin2+2 : 1;
+    // one row per second-variable bin for 2D PDFs, or one row per stacked 1D PDF
+    int number_n2_bins = pdf_data.pdf_dimension == 2 ? pdf_data.nbin2+2 : pdf_data.npdf;
     for (int n2=0; n2<number_n2_bins; ++n2) {
       for (int n=0; n<pdf_data.nbin+2; ++n) {
         std::fprintf(pfile, out_params.data_format.c_str(), result_host(n2, n));
@@ -9,13 +9,17 @@
 #include <sys/stat.h>  // mkdir
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <cstdio>      // fwrite(), fclose(), fopen(), fnprintf(), snprintf()
 #include <cstdlib>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <utility> // make_pair
+#include <vector>
 
 #include "athena.hpp"
 #include "coordinates/cell_locations.hpp"
@@ -31,6 +35,38 @@
 #include "srcterms/turb_driver.hpp"
 //#include "outputs.hpp"
 
+namespace {
+
+//----------------------------------------------------------------------------------------
+//! \fn std::uint64_t FNV1aHash()
+//! \brief accumulates a 64-bit FNV-1a hash over a byte range, continuing from the hash
+//! value passed in.  Used to detect MeshBlocks whose payload changed between checkpoints
+
+std::uint64_t FNV1aHash(const char *pbuf, std::size_t nbytes, std::uint64_t hash) {
+  for (std::size_t i=0; i<nbytes; ++i) {
+    hash ^= static_cast<std::uint64_t>(static_cast<unsigned char>(pbuf[i]));
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void AppendManifest()
+//! \brief appends one "<tier> <path>" line to the burst-checkpoint manifest.  The last
+//! line names the newest complete checkpoint; the last "final" line names the newest
+//! one guaranteed to survive loss of the burst tier.  Lines are appended only after the
+//! corresponding file is complete, so every listed path is restartable with '-r'
+
+void AppendManifest(const std::string &mname, const std::string &tier,
+                    const std::string &path) {
+  FILE *fp = std::fopen(mname.c_str(), "a");
+  if (fp == nullptr) {return;}
+  std::fprintf(fp, "%s %s\n", tier.c_str(), path.c_str());
+  std::fclose(fp);
+}
+
+} // namespace
+
 //----------------------------------------------------------------------------------------
 // ctor: also calls BaseTypeOutput base class constructor
 
@@ -38,6 +74,24 @@ RestartOutput::RestartOutput(ParameterInput *pin, Mesh *pm, OutputParameters op)
   BaseTypeOutput(pin, pm, op) {
   // create directories for outputs. Comments in binary.cpp constructor explain why
   mkdir("rst",0775);
+  if (!(out_params.burst_dir.empty())) {mkdir(out_params.burst_dir.c_str(),0775);}
+}
+
+//----------------------------------------------------------------------------------------
+// dtor: blocks until any background drain of a burst-tier checkpoint has finished, so
+// the final file and manifest entry are not lost when the code exits
+
+RestartOutput::~RestartOutput() {
+  FinishPendingDrain();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void RestartOutput::FinishPendingDrain()
+//! \brief joins the drain thread if a burst-tier checkpoint is still being copied to
+//! its final location.  No-op when burst_dir is unset or no drain is in flight.
+
+void RestartOutput::FinishPendingDrain() {
+  if (cdrainer_.joinable()) {cdrainer_.join();}
 }
 
 //----------------------------------------------------------------------------------------
@@ -46,6 +100,10 @@ RestartOutput::RestartOutput(ParameterInput *pin, Mesh *pm, OutputParameters op)
 // variables, including ghost zones.
 
 void RestartOutput::LoadOutputData(Mesh *pm) {
+  // the writer thread reads the outarrays below in place (there is no separate staging
+  // buffer as in bin/vtk outputs), so join any write still in flight before refilling
+  FinishPendingWrite();
+
   // get spatial dimensions of arrays, including ghost zones
   auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
   int nout1 = indcs.nx1 + 2*(indcs.ng);
@@ -77,44 +135,49 @@ void RestartOutput::LoadOutputData(Mesh *pm) {
     nrad = prad->prgeo->nangles;
   }
 
-  // Note for restarts, outarrays are dimensioned (m,n,k,j,i)
-  if (phydro != nullptr) {
-    Kokkos::realloc(outarray_hyd, nmb, nhydro, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_hyd, Kokkos::subview(phydro->u0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
-  }
-  if (pmhd != nullptr) {
-    Kokkos::realloc(outarray_mhd, nmb, nmhd, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_mhd, Kokkos::subview(pmhd->u0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
-    Kokkos::realloc(outfield.x1f, nmb, nout3, nout2, nout1+1);
-    Kokkos::deep_copy(outfield.x1f, Kokkos::subview(pmhd->b0.x1f, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
-    Kokkos::realloc(outfield.x2f, nmb, nout3, nout2+1, nout1);
-    Kokkos::deep_copy(outfield.x2f, Kokkos::subview(pmhd->b0.x2f, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
-    Kokkos::realloc(outfield.x3f, nmb, nout3+1, nout2, nout1);
-    Kokkos::deep_copy(outfield.x3f, Kokkos::subview(pmhd->b0.x3f, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
-  }
-  if (prad != nullptr) {
-    Kokkos::realloc(outarray_rad, nmb, nrad, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_rad, Kokkos::subview(prad->i0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
-  }
-  if (pturb != nullptr) {
-    Kokkos::realloc(outarray_force, nmb, nforce, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_force, Kokkos::subview(pturb->force, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
-  }
-  if (pz4c != nullptr) {
-    Kokkos::realloc(outarray_z4c, nmb, nz4c, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_z4c, Kokkos::subview(pz4c->u0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
-  } else if (padm != nullptr) {
-    Kokkos::realloc(outarray_adm, nmb, nadm, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_adm, Kokkos::subview(padm->u_adm, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+  // Note for restarts, outarrays are dimensioned (m,n,k,j,i).  In chunked mode the
+  // payload is instead staged chunk-by-chunk in WriteOutputFile, bounding peak host
+  // memory by the chunk size, so the full staging copies here are skipped
+  if (out_params.rst_chunk <= 0) {
+    if (phydro != nullptr) {
+      Kokkos::realloc(outarray_hyd, nmb, nhydro, nout3, nout2, nout1);
+      Kokkos::deep_copy(outarray_hyd, Kokkos::subview(phydro->u0, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    }
+    if (pmhd != nullptr) {
+      Kokkos::realloc(outarray_mhd, nmb, nmhd, nout3, nout2, nout1);
+      Kokkos::deep_copy(outarray_mhd, Kokkos::subview(pmhd->u0, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+      Kokkos::realloc(outfield.x1f, nmb, nout3, nout2, nout1+1);
+      Kokkos::deep_copy(outfield.x1f, Kokkos::subview(pmhd->b0.x1f, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+      Kokkos::realloc(outfield.x2f, nmb, nout3, nout2+1, nout1);
+      Kokkos::deep_copy(outfield.x2f, Kokkos::subview(pmhd->b0.x2f, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+      Kokkos::realloc(outfield.x3f, nmb, nout3+1, nout2, nout1);
+      Kokkos::deep_copy(outfield.x3f, Kokkos::subview(pmhd->b0.x3f, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    }
+    if (prad != nullptr) {
+      Kokkos::realloc(outarray_rad, nmb, nrad, nout3, nout2, nout1);
+      Kokkos::deep_copy(outarray_rad, Kokkos::subview(prad->i0, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    }
+    if (pturb != nullptr) {
+      Kokkos::realloc(outarray_force, nmb, nforce, nout3, nout2, nout1);
+      Kokkos::deep_copy(outarray_force, Kokkos::subview(pturb->force,
+                        std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    }
+    if (pz4c != nullptr) {
+      Kokkos::realloc(outarray_z4c, nmb, nz4c, nout3, nout2, nout1);
+      Kokkos::deep_copy(outarray_z4c, Kokkos::subview(pz4c->u0, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    } else if (padm != nullptr) {
+      Kokkos::realloc(outarray_adm, nmb, nadm, nout3, nout2, nout1);
+      Kokkos::deep_copy(outarray_adm, Kokkos::subview(padm->u_adm, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    }
   }
 
   // calculate max/min number of MeshBlocks across all ranks
@@ -158,17 +221,158 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   } else if (padm != nullptr) {
     nadm = padm->nadm;
   }
+
+  // In incremental mode, decide whether this checkpoint is a full snapshot or a delta
+  // containing only MeshBlocks whose payload changed since the previous checkpoint.
+  // The first checkpoint of a run is always a full snapshot.
+  bool write_delta = false;
+  if (out_params.incremental) {
+    if (!(block_hash_.empty()) && (nrst_since_full_ < (out_params.dn_full - 1))) {
+      write_delta = true;
+    }
+  }
+
+  // total size of all cell-centered variables and face-centered fields to be written
+  // for each MeshBlock
+  IOWrapperSizeT data_size = 0;
+  if (phydro != nullptr) {
+    data_size += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
+  }
+  if (pmhd != nullptr) {
+    data_size += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
+    data_size += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
+    data_size += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
+    data_size += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
+  }
+  if (prad != nullptr) {
+    data_size += nout1*nout2*nout3*nrad*sizeof(Real);   // radiation i0
+  }
+  if (pturb != nullptr) {
+    data_size += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
+  }
+  if (pz4c != nullptr) {
+    data_size += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
+  } else if (padm != nullptr) {
+    data_size += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
+  }
+
+  // Hash the payload of every local MeshBlock, traversing variables in the order they
+  // appear in the file so the hash covers exactly the bytes that would be written
+  int nmb = pm->pmb_pack->nmb_thispack;
+  int mygids = pm->gids_eachrank[global_variable::my_rank];
+  std::vector<std::uint64_t> my_hash(nmb);
+  if (out_params.incremental) {
+    for (int m=0; m<nmb; ++m) {
+      std::uint64_t h = 14695981039346656037ULL;  // FNV-1a offset basis
+      if (phydro != nullptr) {
+        auto mbptr = Kokkos::subview(outarray_hyd, m, Kokkos::ALL, Kokkos::ALL,
+                                     Kokkos::ALL, Kokkos::ALL);
+        h = FNV1aHash(reinterpret_cast<char *>(mbptr.data()),
+                      mbptr.size()*sizeof(Real), h);
+      }
+      if (pmhd != nullptr) {
+        auto mbptr = Kokkos::subview(outarray_mhd, m, Kokkos::ALL, Kokkos::ALL,
+                                     Kokkos::ALL, Kokkos::ALL);
+        h = FNV1aHash(reinterpret_cast<char *>(mbptr.data()),
+                      mbptr.size()*sizeof(Real), h);
+        auto x1fptr = Kokkos::subview(outfield.x1f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+        h = FNV1aHash(reinterpret_cast<char *>(x1fptr.data()),
+                      x1fptr.size()*sizeof(Real), h);
+        auto x2fptr = Kokkos::subview(outfield.x2f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+        h = FNV1aHash(reinterpret_cast<char *>(x2fptr.data()),
+                      x2fptr.size()*sizeof(Real), h);
+        auto x3fptr = Kokkos::subview(outfield.x3f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+        h = FNV1aHash(reinterpret_cast<char *>(x3fptr.data()),
+                      x3fptr.size()*sizeof(Real), h);
+      }
+      if (prad != nullptr) {
+        auto mbptr = Kokkos::subview(outarray_rad, m, Kokkos::ALL, Kokkos::ALL,
+                                     Kokkos::ALL, Kokkos::ALL);
+        h = FNV1aHash(reinterpret_cast<char *>(mbptr.data()),
+                      mbptr.size()*sizeof(Real), h);
+      }
+      if (pturb != nullptr) {
+        auto mbptr = Kokkos::subview(outarray_force, m, Kokkos::ALL, Kokkos::ALL,
+                                     Kokkos::ALL, Kokkos::ALL);
+        h = FNV1aHash(reinterpret_cast<char *>(mbptr.data()),
+                      mbptr.size()*sizeof(Real), h);
+      }
+      if (pz4c != nullptr) {
+        auto mbptr = Kokkos::subview(outarray_z4c, m, Kokkos::ALL, Kokkos::ALL,
+                                     Kokkos::ALL, Kokkos::ALL);
+        h = FNV1aHash(reinterpret_cast<char *>(mbptr.data()),
+                      mbptr.size()*sizeof(Real), h);
+      } else if (padm != nullptr) {
+        auto mbptr = Kokkos::subview(outarray_adm, m, Kokkos::ALL, Kokkos::ALL,
+                                     Kokkos::ALL, Kokkos::ALL);
+        h = FNV1aHash(reinterpret_cast<char *>(mbptr.data()),
+                      mbptr.size()*sizeof(Real), h);
+      }
+      my_hash[m] = h;
+    }
+  }
+
+  // Determine which MeshBlocks changed since the last checkpoint, and share per-rank
+  // counts so that every rank can compute its slots in the delta index and payloads
+  int nchanged_mine = nmb;
+  std::vector<int> changed(nmb, 1);
+  if (write_delta) {
+    nchanged_mine = 0;
+    for (int m=0; m<nmb; ++m) {
+      LogicalLocation &lloc = pm->lloc_eachmb[mygids + m];
+      std::array<std::int32_t,4> key = {lloc.lx1, lloc.lx2, lloc.lx3, lloc.level};
+      auto it = block_hash_.find(key);
+      if ((it != block_hash_.end()) && (it->second == my_hash[m])) {
+        changed[m] = 0;
+      } else {
+        nchanged_mine++;
+      }
+    }
+  }
+  int nchanged_total = nchanged_mine;
+  int changed_displ = 0;
+#if MPI_PARALLEL_ENABLED
+  if (write_delta) {
+    std::vector<int> nchanged_eachrank(global_variable::nranks);
+    MPI_Allgather(&nchanged_mine, 1, MPI_INT, nchanged_eachrank.data(), 1, MPI_INT,
+                  MPI_COMM_WORLD);
+    nchanged_total = 0;
+    for (int r=0; r<(global_variable::nranks); ++r) {
+      if (r < global_variable::my_rank) {changed_displ += nchanged_eachrank[r];}
+      nchanged_total += nchanged_eachrank[r];
+    }
+  }
+#endif
+
   // create filename: "rst/file_basename" + "." + XXXXX + ".rst"
-  // where XXXXX = 5-digit file_number
+  // where XXXXX = 5-digit file_number.  Deltas are given a distinct ".drst" extension so
+  // they are never mistaken for self-contained restart files; a full .rst file can be
+  // reconstructed from a snapshot and a chain of deltas with vis/python/rst_merge.py
   std::string fname;
   char number[6];
   std::snprintf(number, sizeof(number), "%05d", out_params.file_number);
+  std::int64_t prev_fnum = static_cast<std::int64_t>(out_params.file_number) - 1;
 
   fname.assign("rst/");
   fname.append(out_params.file_basename);
   fname.append(".");
   fname.append(number);
-  fname.append(".rst");
+  fname.append((write_delta)? ".drst" : ".rst");
+
+  // with a burst tier, the checkpoint is first written (synchronously, but fast) to
+  // burst_dir under the same name, then drained to fname in the background while
+  // evolution continues.  Both tiers hold complete files in the identical format, so
+  // either path is restartable; the manifest records which is newest (see below)
+  bool burst = !(out_params.burst_dir.empty());
+  std::string wname = fname;
+  if (burst) {
+    wname.assign(out_params.burst_dir);
+    wname.append("/");
+    wname.append(out_params.file_basename);
+    wname.append(".");
+    wname.append(number);
+    wname.append((write_delta)? ".drst" : ".rst");
+  }
 
   // increment counters now so values for *next* dump are stored in restart file
   out_params.file_number++;
@@ -179,398 +383,757 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   }
   pin->SetInteger(out_params.block_name, "file_number", out_params.file_number);
   pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+  // record the floating-point width of this build so a restart by a build at the other
+  // precision can detect the mismatch and convert on read
+  pin->SetInteger("job", "real_size", static_cast<int>(sizeof(Real)));
 
   // create string holding input parameters (copy of input file)
   std::stringstream ost;
   pin->ParameterDump(ost);
   std::string sbuf = ost.str();
 
-  //--- STEP 1.  Root process writes header data (input file, critical variables)
-  // Input file data is read by ParameterInput on restart, and the remaining header
-  // variables are read in Mesh::BuildTreeFromRestart()
-
-  // open file and  write the header; this part is serial
-  IOWrapper resfile;
-  resfile.Open(fname.c_str(), IOWrapper::FileMode::write);
-  if (global_variable::my_rank == 0) {
-    // output the input parameters (input file)
-    resfile.Write_any_type(sbuf.c_str(),sbuf.size(),"byte");
-
-    // output Mesh information
-    resfile.Write_any_type(&(pm->nmb_total), (sizeof(int)), "byte");
-    resfile.Write_any_type(&(pm->root_level), (sizeof(int)), "byte");
-    resfile.Write_any_type(&(pm->mesh_size), (sizeof(RegionSize)), "byte");
-    resfile.Write_any_type(&(pm->mesh_indcs), (sizeof(RegionIndcs)), "byte");
-    resfile.Write_any_type(&(pm->mb_indcs), (sizeof(RegionIndcs)), "byte");
-    resfile.Write_any_type(&(pm->time), (sizeof(Real)), "byte");
-    resfile.Write_any_type(&(pm->dt), (sizeof(Real)), "byte");
-    resfile.Write_any_type(&(pm->ncycle), (sizeof(int)), "byte");
-  }
+  // calculate size of data written in Steps 1-3 below
+  IOWrapperSizeT step1size = sbuf.size()*sizeof(char) + 3*sizeof(int) + 2*sizeof(Real) +
+                             sizeof(RegionSize) + 2*sizeof(RegionIndcs);
+  IOWrapperSizeT step2size = (pm->nmb_total)*(sizeof(LogicalLocation) + sizeof(float));
 
-  //--- STEP 2.  Root process writes list of logical locations and cost of MeshBlocks
-  // This data read in Mesh::BuildTreeFromRestart()
+  IOWrapperSizeT step3size = 3*nco*sizeof(Real);
+  if (pz4c != nullptr) step3size += sizeof(Real);
+  if (pturb != nullptr) step3size += sizeof(RNG_State);
 
-  if (global_variable::my_rank == 0) {
-    resfile.Write_any_type(&(pm->lloc_eachmb[0]),(pm->nmb_total)*sizeof(LogicalLocation),
-                           "byte");
-    resfile.Write_any_type(&(pm->cost_eachmb[0]), (pm->nmb_total)*sizeof(float),"byte");
-  }
+  if (write_delta) step1size += 8*sizeof(std::int64_t);  // delta preamble
 
-  //--- STEP 3.  Root process writes internal state of objects that require it
-  if (global_variable::my_rank == 0) {
-    // store z4c information
-    if (pz4c != nullptr) {
-      resfile.Write_any_type(&(pz4c->last_output_time), sizeof(Real), "byte");
-    }
-    // output puncture tracker data
-    if (nco > 0) {
-      for (auto & pt : pz4c->ptracker) {
-        resfile.Write_any_type(pt.GetPos(), 3*sizeof(Real), "byte");
-      }
+  // snapshot Mesh and physics-module state needed by the write function, so it does not
+  // touch the Mesh (which evolves while an asynchronous write is in flight).  The
+  // outarray_* staging views themselves are stable until the next LoadOutputData(),
+  // which joins the writer thread before refilling them
+  int nmb_total_ = pm->nmb_total;
+  int root_level_ = pm->root_level;
+  RegionSize mesh_size_ = pm->mesh_size;
+  RegionIndcs mesh_indcs_ = pm->mesh_indcs;
+  RegionIndcs mb_indcs_ = pm->mb_indcs;
+  Real time_ = pm->time;
+  Real dt_ = pm->dt;
+  int ncycle_ = pm->ncycle;
+  std::vector<LogicalLocation> lloc_eachmb_(pm->lloc_eachmb,
+                                            pm->lloc_eachmb + nmb_total_);
+  std::vector<float> cost_eachmb_(pm->cost_eachmb, pm->cost_eachmb + nmb_total_);
+  int nmb_thisrank_ = pm->nmb_thisrank;
+  int noutmbs_max_ = noutmbs_max;
+  int noutmbs_min_ = noutmbs_min;
+  Real z4c_last_out_ = (pz4c != nullptr)? pz4c->last_output_time : 0.0;
+  std::vector<std::array<Real,3>> co_pos_;
+  if (nco > 0) {
+    for (auto & pt : pz4c->ptracker) {
+      const Real *pos = pt.GetPos();
+      co_pos_.push_back({pos[0], pos[1], pos[2]});
     }
-    // turbulence driver internal RNG
-    if (pturb != nullptr) {
-      resfile.Write_any_type(&(pturb->rstate), sizeof(RNG_State), "byte");
+  }
+  RNG_State turb_rstate_{};
+  if (pturb != nullptr) {turb_rstate_ = pturb->rstate;}
+  // in chunked mode the payload is staged and written in chunks of rst_chunk MBs
+  int chunk_ = out_params.rst_chunk;
+  bool chunked = (chunk_ > 0);
+  std::vector<LogicalLocation> my_llocs;
+  if (write_delta && (nchanged_mine > 0)) {
+    my_llocs.reserve(nchanged_mine);
+    for (int m=0; m<nmb; ++m) {
+      if (changed[m] != 0) {my_llocs.push_back(pm->lloc_eachmb[mygids + m]);}
     }
   }
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm iocomm = (out_params.async_write)? io_comm_ : MPI_COMM_WORLD;
+#endif
 
-  //--- STEP 4.  All ranks write data over all MeshBlocks (5D arrays) in parallel
-  // This data read in ProblemGenerator constructor for restarts
+  // Write function.  Performs ALL file I/O for this checkpoint using only state captured
+  // by value plus the outarray_* staging views (read in place on the writer thread), so
+  // it can run concurrently with subsequent cycles when async=true
+  std::function<void()> write_file = [=]() {
+    //--- STEP 1.  Root process writes header data (input file, critical variables)
+    // Input file data is read by ParameterInput on restart, and the remaining header
+    // variables are read in Mesh::BuildTreeFromRestart()
 
-  // total size of all cell-centered variables and face-centered fields to be written by
-  // this rank
-  IOWrapperSizeT data_size = 0;
-  if (phydro != nullptr) {
-    data_size += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
-  }
-  if (pmhd != nullptr) {
-    data_size += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
-    data_size += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
-    data_size += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
-    data_size += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
-  }
-  if (prad != nullptr) {
-    data_size += nout1*nout2*nout3*nrad*sizeof(Real);   // radiation i0
-  }
-  if (pturb != nullptr) {
-    data_size += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
-  }
-  if (pz4c != nullptr) {
-    data_size += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
-  } else if (padm != nullptr) {
-    data_size += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
-  }
-  if (global_variable::my_rank == 0) {
-    resfile.Write_any_type(&(data_size), sizeof(IOWrapperSizeT), "byte");
-  }
+    // open file and  write the header; this part is serial
+    IOWrapper resfile;
+#if MPI_PARALLEL_ENABLED
+    resfile.SetCommunicator(iocomm);
+#endif
+    resfile.Open(wname.c_str(), IOWrapper::FileMode::write);
+    if (global_variable::my_rank == 0) {
+      // output the input parameters (input file)
+      resfile.Write_any_type(sbuf.c_str(),sbuf.size(),"byte");
 
-  // calculate size of data written in Steps 1-2 above
-  IOWrapperSizeT step1size = sbuf.size()*sizeof(char) + 3*sizeof(int) + 2*sizeof(Real) +
-                             sizeof(RegionSize) + 2*sizeof(RegionIndcs);
-  IOWrapperSizeT step2size = (pm->nmb_total)*(sizeof(LogicalLocation) + sizeof(float));
+      // delta files carry a fixed preamble between the input parameters and the standard
+      // header, recording the sizes needed to navigate this file and its base snapshot
+      if (write_delta) {
+        std::int64_t pre[8] = {1, sizeof(Real), sizeof(IOWrapperSizeT),
+                               static_cast<std::int64_t>(step3size),
+                               static_cast<std::int64_t>(data_size),
+                               static_cast<std::int64_t>(nmb_total_),
+                               nchanged_total, prev_fnum};
+        resfile.Write_any_type(&(pre[0]), 8*sizeof(std::int64_t), "byte");
+      }
 
-  IOWrapperSizeT step3size = 3*nco*sizeof(Real);
-  if (pz4c != nullptr) step3size += sizeof(Real);
-  if (pturb != nullptr) step3size += sizeof(RNG_State);
+      // output Mesh information
+      resfile.Write_any_type(&(nmb_total_), (sizeof(int)), "byte");
+      resfile.Write_any_type(&(root_level_), (sizeof(int)), "byte");
+      resfile.Write_any_type(&(mesh_size_), (sizeof(RegionSize)), "byte");
+      resfile.Write_any_type(&(mesh_indcs_), (sizeof(RegionIndcs)), "byte");
+      resfile.Write_any_type(&(mb_indcs_), (sizeof(RegionIndcs)), "byte");
+      resfile.Write_any_type(&(time_), (sizeof(Real)), "byte");
+      resfile.Write_any_type(&(dt_), (sizeof(Real)), "byte");
+      resfile.Write_any_type(&(ncycle_), (sizeof(int)), "byte");
+    }
 
-  // write cell-centered variables in parallel
-  IOWrapperSizeT offset_myrank  = step1size + step2size + step3size +
-        sizeof(IOWrapperSizeT) + data_size*(pm->gids_eachrank[global_variable::my_rank]);
-  IOWrapperSizeT myoffset = offset_myrank;
+    //--- STEP 2.  Root process writes list of logical locations and cost of MeshBlocks
+    // This data read in Mesh::BuildTreeFromRestart()
 
-  // write cell-centered variables, one MeshBlock at a time (but parallelized over all
-  // ranks). MeshBlocks are written seperately to reduce number of data elements per write
-  // call, to avoid exceeding 2^31 limit for very large grids per MPI rank.
-  if (phydro != nullptr) {
-    for (int m=0;  m<noutmbs_max; ++m) {
-      // every rank has a MB to write, so write collectively
-      if (m < noutmbs_min) {
-        // get ptr to cell-centered MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_hyd, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at_all(mbptr.data(),mbcnt,myoffset,"Real") != mbcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered hydro data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
-        }
-        myoffset += data_size;
+    if (global_variable::my_rank == 0) {
+      resfile.Write_any_type(lloc_eachmb_.data(), nmb_total_*sizeof(LogicalLocation),
+                             "byte");
+      resfile.Write_any_type(cost_eachmb_.data(), nmb_total_*sizeof(float),"byte");
+    }
 
-      // some ranks are finished writing, so use non-collective write
-      } else if (m < pm->nmb_thisrank) {
-        // get ptr to MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_hyd, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at(mbptr.data(), mbcnt, myoffset,"Real") != mbcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered hydro data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
+    //--- STEP 3.  Root process writes internal state of objects that require it
+    if (global_variable::my_rank == 0) {
+      // store z4c information
+      if (pz4c != nullptr) {
+        resfile.Write_any_type(&(z4c_last_out_), sizeof(Real), "byte");
+      }
+      // output puncture tracker data
+      if (nco > 0) {
+        for (auto & pos : co_pos_) {
+          resfile.Write_any_type(pos.data(), 3*sizeof(Real), "byte");
         }
-        myoffset += data_size;
+      }
+      // turbulence driver internal RNG
+      if (pturb != nullptr) {
+        resfile.Write_any_type(&(turb_rstate_), sizeof(RNG_State), "byte");
       }
     }
-    offset_myrank += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
-    myoffset = offset_myrank;
-  }
-  if (pmhd != nullptr) {
-    for (int m=0;  m<noutmbs_max; ++m) {
-      // every rank has a MB to write, so write collectively
-      if (m < noutmbs_min) {
-        // get ptr to cell-centered MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_mhd, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at_all(mbptr.data(),mbcnt,myoffset,"Real") != mbcnt) {
+
+    //--- STEP 4.  All ranks write data over all MeshBlocks (5D arrays) in parallel
+    // This data read in ProblemGenerator constructor for restarts
+
+    if (global_variable::my_rank == 0) {
+      resfile.Write_any_type(&(data_size), sizeof(IOWrapperSizeT), "byte");
+    }
+
+    // helper for non-collective writes at known offsets, used by the delta and chunked
+    // paths below
+    auto write_reals_at = [&](const Real *pdata, int cnt, IOWrapperSizeT offset) {
+      if (resfile.Write_any_type_at(pdata, cnt, offset, "Real") !=
+          static_cast<std::size_t>(cnt)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "MeshBlock data not written correctly to rst file, "
+        << "checkpoint is broken." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+    };
+
+    // In incremental mode, write the delta index (logical locations of changed MeshBlocks
+    // in gid order) followed by the payload of each changed block, packed contiguously.
+    // Per-block payload records have the same internal layout as in a full snapshot.
+    if (write_delta) {
+      IOWrapperSizeT indx_offset = step1size + step2size + step3size +
+                                   sizeof(IOWrapperSizeT);
+      if (nchanged_mine > 0) {
+        IOWrapperSizeT icnt = nchanged_mine*sizeof(LogicalLocation);
+        if (resfile.Write_any_type_at(my_llocs.data(), icnt,
+            indx_offset + changed_displ*sizeof(LogicalLocation), "byte") != icnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered mhd data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
+          << std::endl << "delta index not written correctly to rst file, "
+          << "checkpoint is broken." << std::endl;
           exit(EXIT_FAILURE);
         }
-        myoffset += data_size;
+      }
 
-      // some ranks are finished writing, so use non-collective write
-      } else if (m < pm->nmb_thisrank) {
-        // get ptr to MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_mhd, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at(mbptr.data(), mbcnt, myoffset,"Real") != mbcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered mhd data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
+      IOWrapperSizeT blk_offset = indx_offset + nchanged_total*sizeof(LogicalLocation) +
+                                  changed_displ*data_size;
+      for (int m=0; m<nmb; ++m) {
+        if (changed[m] == 0) {continue;}
+        IOWrapperSizeT off = blk_offset;
+        if (phydro != nullptr) {
+          auto mbptr = Kokkos::subview(outarray_hyd, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          write_reals_at(mbptr.data(), mbcnt, off);
+          off += mbcnt*sizeof(Real);
+        }
+        if (pmhd != nullptr) {
+          auto mbptr = Kokkos::subview(outarray_mhd, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          write_reals_at(mbptr.data(), mbcnt, off);
+          off += mbcnt*sizeof(Real);
+          auto x1fptr = Kokkos::subview(outfield.x1f, m, Kokkos::ALL, Kokkos::ALL,
+                                        Kokkos::ALL);
+          int fldcnt = x1fptr.size();
+          write_reals_at(x1fptr.data(), fldcnt, off);
+          off += fldcnt*sizeof(Real);
+          auto x2fptr = Kokkos::subview(outfield.x2f, m, Kokkos::ALL, Kokkos::ALL,
+                                        Kokkos::ALL);
+          fldcnt = x2fptr.size();
+          write_reals_at(x2fptr.data(), fldcnt, off);
+          off += fldcnt*sizeof(Real);
+          auto x3fptr = Kokkos::subview(outfield.x3f, m, Kokkos::ALL, Kokkos::ALL,
+                                        Kokkos::ALL);
+          fldcnt = x3fptr.size();
+          write_reals_at(x3fptr.data(), fldcnt, off);
+          off += fldcnt*sizeof(Real);
+        }
+        if (prad != nullptr) {
+          auto mbptr = Kokkos::subview(outarray_rad, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          write_reals_at(mbptr.data(), mbcnt, off);
+          off += mbcnt*sizeof(Real);
         }
-        myoffset += data_size;
+        if (pturb != nullptr) {
+          auto mbptr = Kokkos::subview(outarray_force, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          write_reals_at(mbptr.data(), mbcnt, off);
+          off += mbcnt*sizeof(Real);
+        }
+        if (pz4c != nullptr) {
+          auto mbptr = Kokkos::subview(outarray_z4c, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          write_reals_at(mbptr.data(), mbcnt, off);
+          off += mbcnt*sizeof(Real);
+        } else if (padm != nullptr) {
+          auto mbptr = Kokkos::subview(outarray_adm, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          write_reals_at(mbptr.data(), mbcnt, off);
+          off += mbcnt*sizeof(Real);
+        }
+        blk_offset += data_size;
       }
     }
-    offset_myrank += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
-    myoffset = offset_myrank;
 
-    for (int m=0;  m<noutmbs_max; ++m) {
-      // every rank has a MB to write, so write collectively
-      if (m < noutmbs_min) {
-        // get ptr to x1-face field
-        auto x1fptr = Kokkos::subview(outfield.x1f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
-        int fldcnt = x1fptr.size();
-        if (resfile.Write_any_type_at_all(x1fptr.data(),fldcnt,myoffset,"Real")!=fldcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                    << std::endl << "b0.x1f data not written correctly to rst file, "
-                    << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
-        }
-        myoffset += fldcnt*sizeof(Real);
+    // In chunked mode, stage and write the payload in chunks of at most rst_chunk
+    // MeshBlocks, so peak host memory is bounded by the chunk size rather than the full
+    // rank-local payload.  Chunked restarts always run synchronously on this thread
+    // (async=true is disallowed), so the device arrays can be read here directly
+    if (chunked) {
+      int cnk = std::min(chunk_, nmb);
+      HostArray5D<Real> hbuf_hyd("rst_hyd",1,1,1,1,1), hbuf_mhd("rst_mhd",1,1,1,1,1),
+                        hbuf_rad("rst_rad",1,1,1,1,1), hbuf_frc("rst_frc",1,1,1,1,1),
+                        hbuf_z4c("rst_z4c",1,1,1,1,1), hbuf_adm("rst_adm",1,1,1,1,1);
+      HostFaceFld4D<Real> hbuf_fld("rst_fld",1,1,1,1);
+      if (phydro != nullptr) {
+        Kokkos::realloc(hbuf_hyd, cnk, nhydro, nout3, nout2, nout1);
+      }
+      if (pmhd != nullptr) {
+        Kokkos::realloc(hbuf_mhd, cnk, nmhd, nout3, nout2, nout1);
+        Kokkos::realloc(hbuf_fld.x1f, cnk, nout3, nout2, nout1+1);
+        Kokkos::realloc(hbuf_fld.x2f, cnk, nout3, nout2+1, nout1);
+        Kokkos::realloc(hbuf_fld.x3f, cnk, nout3+1, nout2, nout1);
+      }
+      if (prad != nullptr) {
+        Kokkos::realloc(hbuf_rad, cnk, nrad, nout3, nout2, nout1);
+      }
+      if (pturb != nullptr) {
+        Kokkos::realloc(hbuf_frc, cnk, nforce, nout3, nout2, nout1);
+      }
+      if (pz4c != nullptr) {
+        Kokkos::realloc(hbuf_z4c, cnk, nz4c, nout3, nout2, nout1);
+      } else if (padm != nullptr) {
+        Kokkos::realloc(hbuf_adm, cnk, nadm, nout3, nout2, nout1);
+      }
 
-        // get ptr to x2-face field
-        auto x2fptr = Kokkos::subview(outfield.x2f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
-        fldcnt = x2fptr.size();
-        if (resfile.Write_any_type_at_all(x2fptr.data(),fldcnt,myoffset,"Real")!=fldcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                    << std::endl << "b0.x2f data not written correctly to rst file, "
-                    << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
+      for (int ms=0; ms<nmb; ms+=cnk) {
+        int me = std::min(ms+cnk, nmb);  // exclusive
+        int nc = me - ms;
+        auto hrng = std::make_pair(0,nc);
+        auto drng = std::make_pair(ms,me);
+
+        // copy this chunk of each array from device into the (reused) host buffers
+        if (phydro != nullptr) {
+          Kokkos::deep_copy(Kokkos::subview(hbuf_hyd, hrng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL),
+                            Kokkos::subview(phydro->u0, drng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL));
+        }
+        if (pmhd != nullptr) {
+          Kokkos::deep_copy(Kokkos::subview(hbuf_mhd, hrng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL),
+                            Kokkos::subview(pmhd->u0, drng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL));
+          Kokkos::deep_copy(Kokkos::subview(hbuf_fld.x1f, hrng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL),
+                            Kokkos::subview(pmhd->b0.x1f, drng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL));
+          Kokkos::deep_copy(Kokkos::subview(hbuf_fld.x2f, hrng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL),
+                            Kokkos::subview(pmhd->b0.x2f, drng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL));
+          Kokkos::deep_copy(Kokkos::subview(hbuf_fld.x3f, hrng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL),
+                            Kokkos::subview(pmhd->b0.x3f, drng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL));
+        }
+        if (prad != nullptr) {
+          Kokkos::deep_copy(Kokkos::subview(hbuf_rad, hrng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL),
+                            Kokkos::subview(prad->i0, drng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL));
+        }
+        if (pturb != nullptr) {
+          Kokkos::deep_copy(Kokkos::subview(hbuf_frc, hrng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL),
+                            Kokkos::subview(pturb->force, drng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL));
+        }
+        if (pz4c != nullptr) {
+          Kokkos::deep_copy(Kokkos::subview(hbuf_z4c, hrng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL),
+                            Kokkos::subview(pz4c->u0, drng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL));
+        } else if (padm != nullptr) {
+          Kokkos::deep_copy(Kokkos::subview(hbuf_adm, hrng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL),
+                            Kokkos::subview(padm->u_adm, drng, Kokkos::ALL, Kokkos::ALL,
+                                            Kokkos::ALL, Kokkos::ALL));
         }
-        myoffset += fldcnt*sizeof(Real);
 
-        // get ptr to x3-face field
-        auto x3fptr = Kokkos::subview(outfield.x3f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
-        fldcnt = x3fptr.size();
-        if (resfile.Write_any_type_at_all(x3fptr.data(),fldcnt,myoffset,"Real")!=fldcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                    << std::endl << "b0.x3f data not written correctly to rst file, "
-                    << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
+        // write each MeshBlock record in this chunk at its known offset
+        IOWrapperSizeT blk_offset = step1size + step2size + step3size +
+                                    sizeof(IOWrapperSizeT) + data_size*(mygids + ms);
+        for (int m=0; m<nc; ++m) {
+          IOWrapperSizeT off = blk_offset;
+          if (phydro != nullptr) {
+            auto mbptr = Kokkos::subview(hbuf_hyd, m, Kokkos::ALL, Kokkos::ALL,
+                                         Kokkos::ALL, Kokkos::ALL);
+            int mbcnt = mbptr.size();
+            write_reals_at(mbptr.data(), mbcnt, off);
+            off += mbcnt*sizeof(Real);
+          }
+          if (pmhd != nullptr) {
+            auto mbptr = Kokkos::subview(hbuf_mhd, m, Kokkos::ALL, Kokkos::ALL,
+                                         Kokkos::ALL, Kokkos::ALL);
+            int mbcnt = mbptr.size();
+            write_reals_at(mbptr.data(), mbcnt, off);
+            off += mbcnt*sizeof(Real);
+            auto x1fptr = Kokkos::subview(hbuf_fld.x1f, m, Kokkos::ALL, Kokkos::ALL,
+                                          Kokkos::ALL);
+            int fldcnt = x1fptr.size();
+            write_reals_at(x1fptr.data(), fldcnt, off);
+            off += fldcnt*sizeof(Real);
+            auto x2fptr = Kokkos::subview(hbuf_fld.x2f, m, Kokkos::ALL, Kokkos::ALL,
+                                          Kokkos::ALL);
+            fldcnt = x2fptr.size();
+            write_reals_at(x2fptr.data(), fldcnt, off);
+            off += fldcnt*sizeof(Real);
+            auto x3fptr = Kokkos::subview(hbuf_fld.x3f, m, Kokkos::ALL, Kokkos::ALL,
+                                          Kokkos::ALL);
+            fldcnt = x3fptr.size();
+            write_reals_at(x3fptr.data(), fldcnt, off);
+            off += fldcnt*sizeof(Real);
+          }
+          if (prad != nullptr) {
+            auto mbptr = Kokkos::subview(hbuf_rad, m, Kokkos::ALL, Kokkos::ALL,
+                                         Kokkos::ALL, Kokkos::ALL);
+            int mbcnt = mbptr.size();
+            write_reals_at(mbptr.data(), mbcnt, off);
+            off += mbcnt*sizeof(Real);
+          }
+          if (pturb != nullptr) {
+            auto mbptr = Kokkos::subview(hbuf_frc, m, Kokkos::ALL, Kokkos::ALL,
+                                         Kokkos::ALL, Kokkos::ALL);
+            int mbcnt = mbptr.size();
+            write_reals_at(mbptr.data(), mbcnt, off);
+            off += mbcnt*sizeof(Real);
+          }
+          if (pz4c != nullptr) {
+            auto mbptr = Kokkos::subview(hbuf_z4c, m, Kokkos::ALL, Kokkos::ALL,
+                                         Kokkos::ALL, Kokkos::ALL);
+            int mbcnt = mbptr.size();
+            write_reals_at(mbptr.data(), mbcnt, off);
+            off += mbcnt*sizeof(Real);
+          } else if (padm != nullptr) {
+            auto mbptr = Kokkos::subview(hbuf_adm, m, Kokkos::ALL, Kokkos::ALL,
+                                         Kokkos::ALL, Kokkos::ALL);
+            int mbcnt = mbptr.size();
+            write_reals_at(mbptr.data(), mbcnt, off);
+            off += mbcnt*sizeof(Real);
+          }
+          blk_offset += data_size;
         }
-        myoffset += fldcnt*sizeof(Real);
+      }
+    }
 
-        myoffset += data_size-(x1fptr.size()+x2fptr.size()+x3fptr.size())*sizeof(Real);
+    // write cell-centered variables in parallel
+    IOWrapperSizeT offset_myrank  = step1size + step2size + step3size +
+                                    sizeof(IOWrapperSizeT) + data_size*mygids;
+    IOWrapperSizeT myoffset = offset_myrank;
 
-      // some ranks are finished writing, so use non-collective write
-      } else if (m < pm->nmb_thisrank) {
-        // get ptr to x1-face field
-        auto x1fptr = Kokkos::subview(outfield.x1f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
-        int fldcnt = x1fptr.size();
-        if (resfile.Write_any_type_at(x1fptr.data(),fldcnt,myoffset,"Real") != fldcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                    << std::endl << "b0.x1f data not written correctly to rst file, "
-                    << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
-        }
-        myoffset += fldcnt*sizeof(Real);
+    // write cell-centered variables, one MeshBlock at a time (but parallelized over
+    // all ranks). MeshBlocks are written seperately to reduce number of data elements
+    // per write call, to avoid exceeding 2^31 limit for very large grids per MPI rank.
+    if (!write_delta && !chunked && phydro != nullptr) {
+      for (int m=0;  m<noutmbs_max_; ++m) {
+        // every rank has a MB to write, so write collectively
+        if (m < noutmbs_min_) {
+          // get ptr to cell-centered MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_hyd, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at_all(mbptr.data(), mbcnt, myoffset,
+                                            "Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered hydro data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
 
-        // get ptr to x2-face field
-        auto x2fptr = Kokkos::subview(outfield.x2f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
-        fldcnt = x2fptr.size();
-        if (resfile.Write_any_type_at(x2fptr.data(),fldcnt,myoffset,"Real") != fldcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                    << std::endl << "b0.x2f data not written correctly to rst file, "
-                    << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
+        // some ranks are finished writing, so use non-collective write
+        } else if (m < nmb_thisrank_) {
+          // get ptr to MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_hyd, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at(mbptr.data(), mbcnt, myoffset,"Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered hydro data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
         }
-        myoffset += fldcnt*sizeof(Real);
+      }
+      offset_myrank += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
+      myoffset = offset_myrank;
+    }
+    if (!write_delta && !chunked && pmhd != nullptr) {
+      for (int m=0;  m<noutmbs_max_; ++m) {
+        // every rank has a MB to write, so write collectively
+        if (m < noutmbs_min_) {
+          // get ptr to cell-centered MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_mhd, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at_all(mbptr.data(), mbcnt, myoffset,
+                                            "Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered mhd data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
 
-        // get ptr to x3-face field
-        auto x3fptr = Kokkos::subview(outfield.x3f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
-        fldcnt = x3fptr.size();
-        if (resfile.Write_any_type_at(x3fptr.data(),fldcnt,myoffset,"Real") != fldcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                    << std::endl << "b0.x3f data not written correctly to rst file, "
-                    << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
+        // some ranks are finished writing, so use non-collective write
+        } else if (m < nmb_thisrank_) {
+          // get ptr to MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_mhd, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at(mbptr.data(), mbcnt, myoffset,"Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered mhd data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
         }
-        myoffset += fldcnt*sizeof(Real);
+      }
+      offset_myrank += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
+      myoffset = offset_myrank;
 
-        myoffset += data_size-(x1fptr.size()+x2fptr.size()+x3fptr.size())*sizeof(Real);
+      for (int m=0;  m<noutmbs_max_; ++m) {
+        // every rank has a MB to write, so write collectively
+        if (m < noutmbs_min_) {
+          // get ptr to x1-face field
+          auto x1fptr = Kokkos::subview(outfield.x1f, m, Kokkos::ALL, Kokkos::ALL,
+                                        Kokkos::ALL);
+          int fldcnt = x1fptr.size();
+          if (resfile.Write_any_type_at_all(x1fptr.data(), fldcnt, myoffset,
+                                            "Real") != fldcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                      << std::endl << "b0.x1f data not written correctly to rst file, "
+                      << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += fldcnt*sizeof(Real);
+
+          // get ptr to x2-face field
+          auto x2fptr = Kokkos::subview(outfield.x2f, m, Kokkos::ALL, Kokkos::ALL,
+                                        Kokkos::ALL);
+          fldcnt = x2fptr.size();
+          if (resfile.Write_any_type_at_all(x2fptr.data(), fldcnt, myoffset,
+                                            "Real") != fldcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                      << std::endl << "b0.x2f data not written correctly to rst file, "
+                      << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += fldcnt*sizeof(Real);
+
+          // get ptr to x3-face field
+          auto x3fptr = Kokkos::subview(outfield.x3f, m, Kokkos::ALL, Kokkos::ALL,
+                                        Kokkos::ALL);
+          fldcnt = x3fptr.size();
+          if (resfile.Write_any_type_at_all(x3fptr.data(), fldcnt, myoffset,
+                                            "Real") != fldcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                      << std::endl << "b0.x3f data not written correctly to rst file, "
+                      << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += fldcnt*sizeof(Real);
+
+          myoffset += data_size-(x1fptr.size()+x2fptr.size()+x3fptr.size())*sizeof(Real);
+
+        // some ranks are finished writing, so use non-collective write
+        } else if (m < nmb_thisrank_) {
+          // get ptr to x1-face field
+          auto x1fptr = Kokkos::subview(outfield.x1f, m, Kokkos::ALL, Kokkos::ALL,
+                                        Kokkos::ALL);
+          int fldcnt = x1fptr.size();
+          if (resfile.Write_any_type_at(x1fptr.data(),fldcnt,myoffset,"Real") != fldcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                      << std::endl << "b0.x1f data not written correctly to rst file, "
+                      << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += fldcnt*sizeof(Real);
+
+          // get ptr to x2-face field
+          auto x2fptr = Kokkos::subview(outfield.x2f, m, Kokkos::ALL, Kokkos::ALL,
+                                        Kokkos::ALL);
+          fldcnt = x2fptr.size();
+          if (resfile.Write_any_type_at(x2fptr.data(),fldcnt,myoffset,"Real") != fldcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                      << std::endl << "b0.x2f data not written correctly to rst file, "
+                      << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += fldcnt*sizeof(Real);
+
+          // get ptr to x3-face field
+          auto x3fptr = Kokkos::subview(outfield.x3f, m, Kokkos::ALL, Kokkos::ALL,
+                                        Kokkos::ALL);
+          fldcnt = x3fptr.size();
+          if (resfile.Write_any_type_at(x3fptr.data(),fldcnt,myoffset,"Real") != fldcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                      << std::endl << "b0.x3f data not written correctly to rst file, "
+                      << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += fldcnt*sizeof(Real);
+
+          myoffset += data_size-(x1fptr.size()+x2fptr.size()+x3fptr.size())*sizeof(Real);
+        }
       }
+      offset_myrank += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
+      offset_myrank += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
+      offset_myrank += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
+      myoffset = offset_myrank;
     }
-    offset_myrank += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
-    offset_myrank += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
-    offset_myrank += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
-    myoffset = offset_myrank;
-  }
 
-  if (prad != nullptr) {
-    for (int m=0;  m<noutmbs_max; ++m) {
-      // every rank has a MB to write, so write collectively
-      if (m < noutmbs_min) {
-        // get ptr to cell-centered MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_rad, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at_all(mbptr.data(),mbcnt,myoffset,"Real") != mbcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered rad data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
-        }
-        myoffset += data_size;
+    if (!write_delta && !chunked && prad != nullptr) {
+      for (int m=0;  m<noutmbs_max_; ++m) {
+        // every rank has a MB to write, so write collectively
+        if (m < noutmbs_min_) {
+          // get ptr to cell-centered MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_rad, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at_all(mbptr.data(), mbcnt, myoffset,
+                                            "Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered rad data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
 
-      // some ranks are finished writing, so use non-collective write
-      } else if (m < pm->nmb_thisrank) {
-        // get ptr to MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_rad, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at(mbptr.data(),mbcnt,myoffset,"Real") != mbcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered rad data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
+        // some ranks are finished writing, so use non-collective write
+        } else if (m < nmb_thisrank_) {
+          // get ptr to MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_rad, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at(mbptr.data(),mbcnt,myoffset,"Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered rad data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
         }
-        myoffset += data_size;
       }
+      offset_myrank += nout1*nout2*nout3*nrad*sizeof(Real);   // radiation i0
+      myoffset = offset_myrank;
     }
-    offset_myrank += nout1*nout2*nout3*nrad*sizeof(Real);   // radiation i0
-    myoffset = offset_myrank;
-  }
 
-  if (pturb != nullptr) {
-    for (int m=0;  m<noutmbs_max; ++m) {
-      // every rank has a MB to write, so write collectively
-      if (m < noutmbs_min) {
-        // get ptr to cell-centered MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_force, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at_all(mbptr.data(),mbcnt,myoffset,"Real") != mbcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered turb data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
-        }
-        myoffset += data_size;
+    if (!write_delta && !chunked && pturb != nullptr) {
+      for (int m=0;  m<noutmbs_max_; ++m) {
+        // every rank has a MB to write, so write collectively
+        if (m < noutmbs_min_) {
+          // get ptr to cell-centered MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_force, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at_all(mbptr.data(), mbcnt, myoffset,
+                                            "Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered turb data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
 
-      // some ranks are finished writing, so use non-collective write
-      } else if (m < pm->nmb_thisrank) {
-        // get ptr to MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_force, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at(mbptr.data(), mbcnt, myoffset,"Real") != mbcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered turb data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
+        // some ranks are finished writing, so use non-collective write
+        } else if (m < nmb_thisrank_) {
+          // get ptr to MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_force, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at(mbptr.data(), mbcnt, myoffset,"Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered turb data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
         }
-        myoffset += data_size;
       }
+      offset_myrank += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
+      myoffset = offset_myrank;
     }
-    offset_myrank += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
-    myoffset = offset_myrank;
-  }
 
-  if (pz4c != nullptr) {
-    for (int m=0;  m<noutmbs_max; ++m) {
-      // every rank has a MB to write, so write collectively
-      if (m < noutmbs_min) {
-        // get ptr to cell-centered MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_z4c, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at_all(mbptr.data(),mbcnt,myoffset,"Real") != mbcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered z4c data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
+    if (!write_delta && !chunked && pz4c != nullptr) {
+      for (int m=0;  m<noutmbs_max_; ++m) {
+        // every rank has a MB to write, so write collectively
+        if (m < noutmbs_min_) {
+          // get ptr to cell-centered MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_z4c, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at_all(mbptr.data(), mbcnt, myoffset,
+                                            "Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered z4c data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
+
+        // some ranks are finished writing, so use non-collective write
+        } else if (m < nmb_thisrank_) {
+          // get ptr to MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_z4c, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at(mbptr.data(), mbcnt, myoffset,"Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered z4c data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
         }
-        myoffset += data_size;
+      }
+      offset_myrank += nout1*nout2*nout3*nz4c*sizeof(Real); // z4c u0
+      myoffset = offset_myrank;
+    } else if (!write_delta && !chunked && padm != nullptr) {
+      for (int m=0;  m<noutmbs_max_; ++m) {
+        // every rank has a MB to write, so write collectively
+        if (m < noutmbs_min_) {
+          // get ptr to cell-centered MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_adm, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at_all(mbptr.data(), mbcnt, myoffset,
+                                            "Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered adm data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
 
-      // some ranks are finished writing, so use non-collective write
-      } else if (m < pm->nmb_thisrank) {
-        // get ptr to MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_z4c, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at(mbptr.data(), mbcnt, myoffset,"Real") != mbcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered z4c data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
+        // some ranks are finished writing, so use non-collective write
+        } else if (m < nmb_thisrank_) {
+          // get ptr to MeshBlock data
+          auto mbptr = Kokkos::subview(outarray_adm, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at(mbptr.data(), mbcnt, myoffset,"Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "cell-centered adm data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
         }
-        myoffset += data_size;
       }
+      offset_myrank += nout1*nout2*nout3*nadm*sizeof(Real); // adm u_adm
+      myoffset = offset_myrank;
     }
-    offset_myrank += nout1*nout2*nout3*nz4c*sizeof(Real); // z4c u0
-    myoffset = offset_myrank;
-  } else if (padm != nullptr) {
-    for (int m=0;  m<noutmbs_max; ++m) {
-      // every rank has a MB to write, so write collectively
-      if (m < noutmbs_min) {
-        // get ptr to cell-centered MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_adm, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at_all(mbptr.data(),mbcnt,myoffset,"Real") != mbcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered adm data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
-        }
-        myoffset += data_size;
+    // close file, clean up
+    resfile.Close();
+  };
 
-      // some ranks are finished writing, so use non-collective write
-      } else if (m < pm->nmb_thisrank) {
-        // get ptr to MeshBlock data
-        auto mbptr = Kokkos::subview(outarray_adm, m, Kokkos::ALL, Kokkos::ALL,
-                                     Kokkos::ALL, Kokkos::ALL);
-        int mbcnt = mbptr.size();
-        if (resfile.Write_any_type_at(mbptr.data(), mbcnt, myoffset,"Real") != mbcnt) {
-          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "cell-centered adm data not written correctly to rst file, "
-          << "restart file is broken." << std::endl;
-          exit(EXIT_FAILURE);
+  // hand I/O to the writer thread (blocking only if the previous checkpoint is still
+  // being written), or else write synchronously
+  if (out_params.async_write) {
+    LaunchAsyncWrite(write_file);
+  } else if (burst) {
+    // join any drain still in flight so at most one is outstanding (and manifest
+    // appends stay ordered), write the burst-tier file synchronously, then hand the
+    // copy to the final location to the drain thread.  Only rank 0 drains: the burst
+    // file is a single complete checkpoint shared by all ranks
+    FinishPendingDrain();
+    write_file();
+    std::string manifest = "rst/" + out_params.file_basename + ".manifest";
+    if (global_variable::my_rank == 0) {
+      AppendManifest(manifest, "burst", wname);
+      std::string src = wname;
+      std::string dst = fname;
+      std::string prev = last_burst_fname_;
+      cdrainer_ = std::thread([=]() {
+        // drain through a .part file so a partially-copied checkpoint can never be
+        // mistaken for a complete one at the final path
+        std::string part = dst + ".part";
+        if (!(IOWrapper::CopyFile(src.c_str(), part.c_str())) ||
+            (std::rename(part.c_str(), dst.c_str()) != 0)) {
+          std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "Failed to drain burst-tier checkpoint '" << src
+                    << "' to '" << dst << "'; restart from the burst tier" << std::endl;
+          return;
         }
-        myoffset += data_size;
-      }
+        AppendManifest(manifest, "final", dst);
+        // bound burst-tier usage: keep only the newest checkpoint there
+        if (!(prev.empty())) {std::remove(prev.c_str());}
+      });
     }
-    offset_myrank += nout1*nout2*nout3*nadm*sizeof(Real); // adm u_adm
-    myoffset = offset_myrank;
+    last_burst_fname_ = wname;
+  } else {
+    write_file();
   }
 
-  // close file, clean up
-  resfile.Close();
+  // Replace the hash table with the state of this checkpoint.  Hashes of every MeshBlock
+  // (not just local ones) are gathered so that blocks migrated by load balancing between
+  // checkpoints are still recognized as unchanged.
+  if (out_params.incremental) {
+    std::vector<std::uint64_t> hash_eachmb(pm->nmb_total);
+    for (int m=0; m<nmb; ++m) {hash_eachmb[mygids + m] = my_hash[m];}
+#if MPI_PARALLEL_ENABLED
+    MPI_Allgatherv(MPI_IN_PLACE, nmb, MPI_UINT64_T, hash_eachmb.data(),
+                   pm->nmb_eachrank, pm->gids_eachrank, MPI_UINT64_T, MPI_COMM_WORLD);
+#endif
+    block_hash_.clear();
+    for (int m=0; m<(pm->nmb_total); ++m) {
+      LogicalLocation &lloc = pm->lloc_eachmb[m];
+      block_hash_[{lloc.lx1, lloc.lx2, lloc.lx3, lloc.level}] = hash_eachmb[m];
+    }
+    nrst_since_full_ = (write_delta)? (nrst_since_full_ + 1) : 0;
+  }
 
   return;
 }
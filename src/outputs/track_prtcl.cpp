@@ -4,9 +4,13 @@
 // Licensed under the 3-clause BSD License (the "LICENSE")
 //========================================================================================
 //! \file track_prtcl.cpp
-//! \brief writes data for tracked particles in unformatted binary
+//! \brief writes data for tracked particles in unformatted binary.  Samples are
+//! accumulated in a device-side buffer and flushed to disk in batches, so high-cadence
+//! (even every-step) tracking costs one gather kernel per sample and one host copy plus
+//! one file pass per flush_interval samples.
 
 #include <sys/stat.h>  // mkdir
+#include <utility>
 #include <vector>
 
 #include <algorithm>
@@ -28,63 +32,89 @@
 
 TrackedParticleOutput::TrackedParticleOutput(ParameterInput *pin, Mesh *pm,
                                              OutputParameters op) :
-  BaseTypeOutput(pin, pm, op) {
+  BaseTypeOutput(pin, pm, op),
+  nbuf(0) {
   // create new directory for this output. Comments in binary.cpp constructor explain why
   mkdir("trk",0775);
-  // allocate arrays
-  npout_eachrank.resize(global_variable::nranks);
   ntrack = pin->GetInteger(op.block_name,"nparticles");
-  // TODO(@user) improve guess below?
-  ntrack_thisrank = ntrack;
+  // number of samples accumulated on device before they are written in one pass
+  flush_interval = pin->GetOrAddInteger(op.block_name,"flush_interval",1);
+  Kokkos::realloc(track_buf, flush_interval*ntrack);
+}
+
+//----------------------------------------------------------------------------------------
+// dtor: write out any samples still sitting in the buffer
+
+TrackedParticleOutput::~TrackedParticleOutput() {
+  FlushTrackBuffer();
 }
 
 //----------------------------------------------------------------------------------------
 // TrackedParticleOutput::LoadOutputData()
-// Copies data for tracked particles on this rank to host outpart array
+// Appends state of tracked particles on this rank to the device-side sample buffer.
+// No host copy or communication happens here; both are deferred to the flush.
 
 void TrackedParticleOutput::LoadOutputData(Mesh *pm) {
-  // Load data for tracked particles on this rank into new device array
-  DualArray1D<TrackedParticleData> tracked_prtcl("d_trked",ntrack_thisrank);
   int npart = pm->nprtcl_thisrank;
   auto &pr = pm->pmb_pack->ppart->prtcl_rdata;
   auto &pi = pm->pmb_pack->ppart->prtcl_idata;
   int counter=0;
   int *pcounter = &counter;
-  par_for("part_update",DevExeSpace(),0,(npart-1), KOKKOS_LAMBDA(const int p) {
-    if (pi(PTAG,p) < ntrack) {
-      int index = Kokkos::atomic_fetch_add(pcounter,1);
-      tracked_prtcl.d_view(index).tag = pi(PTAG,p);
-      tracked_prtcl.d_view(index).x   = pr(IPX,p);
-      tracked_prtcl.d_view(index).y   = pr(IPY,p);
-      tracked_prtcl.d_view(index).z   = pr(IPZ,p);
-      tracked_prtcl.d_view(index).vx  = pr(IPVX,p);
-      tracked_prtcl.d_view(index).vy  = pr(IPVY,p);
-      tracked_prtcl.d_view(index).vz  = pr(IPVZ,p);
+  auto &buf = track_buf;
+  int start = nbuf*ntrack;
+  int ntrack_ = ntrack;
+  par_for("track_buf",DevExeSpace(),0,(npart-1), KOKKOS_LAMBDA(const int p) {
+    if (pi(PTAG,p) < ntrack_) {
+      int index = start + Kokkos::atomic_fetch_add(pcounter,1);
+      buf(index).tag = pi(PTAG,p);
+      buf(index).x   = pr(IPX,p);
+      buf(index).y   = pr(IPY,p);
+      buf(index).z   = pr(IPZ,p);
+      buf(index).vx  = pr(IPVX,p);
+      buf(index).vy  = pr(IPVY,p);
+      buf(index).vz  = pr(IPVZ,p);
     }
   });
-  npout = counter;
-  // share number of tracked particles to be output across all ranks
-  npout_eachrank[global_variable::my_rank] = npout;
-#if MPI_PARALLEL_ENABLED
-  MPI_Allgather(&npout, 1, MPI_INT, npout_eachrank.data(), 1, MPI_INT, MPI_COMM_WORLD);
-#endif
-  tracked_prtcl.resize(npout);
-  // sync tracked particle device array with host
-  tracked_prtcl.template modify<DevExeSpace>();
-  tracked_prtcl.template sync<HostMemSpace>();
-
-  // copy host view into host outpart array
-  Kokkos::realloc(outpart, npout);
-  Kokkos::deep_copy(outpart, tracked_prtcl.h_view);
+  // record per-sample metadata needed to reconstruct headers and offsets at the flush
+  nbuf_npout.push_back(counter);
+  nbuf_time.push_back(pm->time);
+  nbuf_cycle.push_back(pm->ncycle);
+  nbuf++;
 }
 
 //----------------------------------------------------------------------------------------
 //! \fn void TrackedParticleOutput:::WriteOutputFile(Mesh *pm)
-//! \brief Cycles over all tracked particles on this rank and writes ouput data
+//! \brief Flushes the sample buffer once full, then updates the output counters.
 //! With MPI, all particles are written to the same file.
 
 void TrackedParticleOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
-  int big_end = IsBigEndian(); // =1 on big endian machine
+  if (nbuf >= flush_interval) {
+    FlushTrackBuffer();
+  }
+
+  // increment counters
+  if (out_params.last_time < 0.0) {
+    out_params.last_time = pm->time;
+  } else {
+    out_params.last_time += out_params.dt;
+  }
+  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TrackedParticleOutput::FlushTrackBuffer()
+//! \brief Copies all buffered samples to the host in one copy and appends them to the
+//! track file in one pass.  Headers are formatted identically on every rank from the
+//! buffered metadata, so all ranks advance their file offsets without communication.
+
+void TrackedParticleOutput::FlushTrackBuffer() {
+  if (nbuf == 0) {return;}
+
+  // single device->host copy of every buffered sample
+  int ntot = nbuf*ntrack;
+  HostArray1D<TrackedParticleData> hbuf("h_trked", ntot);
+  Kokkos::deep_copy(hbuf, Kokkos::subview(track_buf, std::make_pair(0, ntot)));
 
   // create filename: "trk/file_basename".trk
   std::string fname;
@@ -92,83 +122,57 @@ void TrackedParticleOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   fname.append(out_params.file_basename);
   fname.append(".trk");
 
-  // Root process opens/creates file and appends string
-  if (global_variable::my_rank == 0) {
+  // all ranks open file and append data
+  IOWrapper partfile;
+  partfile.Open(fname.c_str(), IOWrapper::FileMode::append);
+  std::size_t offset = partfile.GetPosition();
+
+  // 1D array of floats used to convert and output particle data
+  float *data = new float[6*ntrack];
+  for (int k=0; k<nbuf; ++k) {
+    // header built from buffered metadata, identically on every rank
     std::stringstream msg;
-    msg << std::endl << "# AthenaK tracked particle data at time= " << pm->time
+    msg << std::endl << "# AthenaK tracked particle data at time= " << nbuf_time[k]
         << "  nranks= " << global_variable::nranks
-        << "  cycle=" << pm->ncycle
+        << "  cycle=" << nbuf_cycle[k]
         << "  ntracked_prtcls=" << ntrack << std::endl;
-    FILE *pfile;
-    if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-        << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
-      exit(EXIT_FAILURE);
+    std::string header = msg.str() + " \n";
+    if (global_variable::my_rank == 0) {
+      partfile.Write_any_type_at(header.c_str(), header.size(), offset, "byte");
     }
-    std::fprintf(pfile,"%s \n",msg.str().c_str());
-    std::fclose(pfile);
-  }
-
-  // Now all ranks open file and append data
-  IOWrapper partfile;
-  partfile.Open(fname.c_str(), IOWrapper::FileMode::append);
-  std::size_t header_offset = partfile.GetPosition();
-//  std::size_t header_offset = 0;
-
-  // allocate 1D vector of floats used to convert and output particle data
-  float *data = new float[6*npout];
-  // Loop over particles, load positions into data[]
-  for (int p=0; p<npout; ++p) {
-    data[ 6*p   ] = static_cast<float>(outpart(p).x);
-    data[(6*p)+1] = static_cast<float>(outpart(p).y);
-    data[(6*p)+2] = static_cast<float>(outpart(p).z);
-    data[(6*p)+3] = static_cast<float>(outpart(p).vx);
-    data[(6*p)+4] = static_cast<float>(outpart(p).vy);
-    data[(6*p)+5] = static_cast<float>(outpart(p).vz);
-  }
-  // calculate local data offset
-  std::vector<int> rank_offset(global_variable::nranks, 0);
-  int npout_min = pm->nprtcl_eachrank[0];
-  for (int n=1; n<global_variable::nranks; ++n) {
-    rank_offset[n] = rank_offset[n-1] + npout_eachrank[n-1];
-    npout_min = std::min(npout_min, npout_eachrank[n]);
-  }
-
-  // Write tracked particle data collectively over minimum shared number of prtcls
-  for (int p=0; p<npout_min; ++p) {
-    // offset computed assuming tags run 0...(ntrack-1) sequentially
-    std::size_t myoffset = header_offset + 6*outpart(p).tag;
-    // Write particle positions collectively for minimum number of particles across ranks
-    if (partfile.Write_any_type_at_all(&(data[0]),6,myoffset,"float") != 6) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "particle data not written correctly to tracked particle file"
-          << std::endl;
-      exit(EXIT_FAILURE);
+    offset += header.size();
+
+    // convert this sample's records to float
+    int npout = nbuf_npout[k];
+    for (int p=0; p<npout; ++p) {
+      const auto &rec = hbuf(k*ntrack + p);
+      data[ 6*p   ] = static_cast<float>(rec.x);
+      data[(6*p)+1] = static_cast<float>(rec.y);
+      data[(6*p)+2] = static_cast<float>(rec.z);
+      data[(6*p)+3] = static_cast<float>(rec.vx);
+      data[(6*p)+4] = static_cast<float>(rec.vy);
+      data[(6*p)+5] = static_cast<float>(rec.vz);
     }
-  }
-  // Write particle positions individually for remaining particles on each rank
-  for (int p=npout_min; p<npout; ++p) {
-    // offset computed assuming tags run 0...(ntrack-1) sequentially
-    std::size_t myoffset = header_offset + 6*outpart(p).tag;
-    // Write particle positions collectively for minimum number of particles across ranks
-    if (partfile.Write_any_type_at(&(data[0]),6,myoffset,"float") != 6) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "particle data not written correctly to tracked particle file"
-          << std::endl;
-      exit(EXIT_FAILURE);
+    // write each record at the slot given by its tag (tags run 0...(ntrack-1))
+    for (int p=0; p<npout; ++p) {
+      std::size_t myoffset = offset + 6*sizeof(float)*(hbuf(k*ntrack + p).tag);
+      if (partfile.Write_any_type_at(&(data[6*p]),6,myoffset,"float") != 6) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "particle data not written correctly to tracked particle file"
+            << std::endl;
+        exit(EXIT_FAILURE);
+      }
     }
+    offset += 6*sizeof(float)*ntrack;
   }
 
   // close the output file and clean up
   partfile.Close();
   delete[] data;
 
-  // increment counters
-  if (out_params.last_time < 0.0) {
-    out_params.last_time = pm->time;
-  } else {
-    out_params.last_time += out_params.dt;
-  }
-  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+  nbuf = 0;
+  nbuf_npout.clear();
+  nbuf_time.clear();
+  nbuf_cycle.clear();
   return;
 }
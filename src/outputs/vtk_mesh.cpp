@@ -21,6 +21,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 #include <limits> // numeric_limits<>
 
 #include "athena.hpp"
@@ -134,184 +135,212 @@ void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   msg.seekp(0, std::ios_base::end);
   msg << std::endl << "CELL_DATA " << nout1*nout2*nout3 << std::endl;
 
-  bool parallel_write=false;
+  // snapshot everything the write function needs, so it does not touch the Mesh, the
+  // input parameters, or class members (all of which evolve while an asynchronous write
+  // is in flight).  The outarray View is captured by value below; its reference count
+  // keeps the current host buffer alive until the writer thread is done with it.
+  std::string hdr = msg.str();
+  HostArray5D<Real> outdata = outarray;
+  int nout_vars = outvars.size();
+  std::vector<std::string> labels(nout_vars);
+  for (int n=0; n<nout_vars; ++n) {labels[n] = outvars[n].label;}
+  // indices of each output MB in 3D grid of MBs, and copy of output cell index ranges
+  std::vector<int> imbs(nout_mbs), jmbs(nout_mbs), kmbs(nout_mbs);
+  std::vector<OutputMeshBlockInfo> outmbs_ = outmbs;
+  for (int m=0; m<nout_mbs; ++m) {
+    LogicalLocation lloc = pm->lloc_eachmb[outmbs[m].mb_gid];
+    imbs[m] = (out_params.slice1 || (out_params.gid >= 0))? 0 : lloc.lx1;
+    jmbs[m] = (out_params.slice2 || (out_params.gid >= 0))? 0 : lloc.lx2;
+    kmbs[m] = (out_params.slice3 || (out_params.gid >= 0))? 0 : lloc.lx3;
+  }
+  int snx1 = indcs.nx1, snx2 = indcs.nx2, snx3 = indcs.nx3;
+  bool multi_mb_file = ((pm->nmb_total > 1) && (out_params.gid < 0));
 #if MPI_PARALLEL_ENABLED
-  //----- WRITE IN PARALLEL WITH MPI: -----
-  // For MPI runs, create derived data types for outarray and Cartesian grid of MBs.
-  // MPI then takes care of writing to file in proper order.
-  // If GID is specified in input file so only one MB written, then file is written
-  // using serial mode below
+  MPI_Comm iocomm = (out_params.async_write)? io_comm_ : MPI_COMM_WORLD;
+#endif
 
-  // open file and write file header
-  if ((pm->nmb_total > 1) && (out_params.gid < 0)) {
-    MPI_File fh;
-    if (MPI_File_open(MPI_COMM_WORLD, fname.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY,
-                      MPI_INFO_NULL, &fh) != MPI_SUCCESS) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-        << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
-        exit(EXIT_FAILURE);
-    }
-    if (global_variable::my_rank == 0) {
-      MPI_File_write(fh, msg.str().c_str(), msg.str().size(), MPI_BYTE,MPI_STATUS_IGNORE);
-    }
-    size_t header_size = msg.str().size();
-
-    // allocate 1D vector of floats used to convert and output entire 3D data
-    int nx1 = outmbs[0].oie - outmbs[0].ois + 1;
-    int nx2 = outmbs[0].oje - outmbs[0].ojs + 1;
-    int nx3 = outmbs[0].oke - outmbs[0].oks + 1;
-    float *data = new float[nx1*nx2*nx3];
-
-    // create new datatype representing array of cells in MeshBlocks
-    MPI_Datatype block;
-    int bsize[3] = {nx3, nx2, nx1};      // total number of cells in MB
-    int bstrt[3] = {0, 0, 0};            // i/j/k starting index of this block
-    MPI_Type_create_subarray(3,bsize,bsize,bstrt,MPI_ORDER_C,MPI_FLOAT,&block);
-    MPI_Type_commit(&block);
-
-    // create new datatype representing grid of MeshBlocks
-    MPI_Datatype grid;
-    int gridsize[3] = {nout3, nout2, nout1};   // total number of cells over all MBs
-    int mbstrt[3] = {0, 0, 0};                 // i/j/k starting index of blocks
-    int mbsize[3] = {nx3, nx2, nx1};           // number of cells in blocks
-    MPI_Type_create_subarray(3,gridsize,mbsize,mbstrt,MPI_ORDER_C,MPI_FLOAT,&grid);
-    MPI_Type_commit(&grid);
-
-    // Loop over variables
-    int nout_vars = outvars.size();
-    for (int n=0; n<nout_vars; ++n) {
-      // write header this variable (SCALARS or VECTORS, name, type, color table)
-      std::stringstream data_msg;
-      data_msg << std::endl << "SCALARS " << outvars[n].label.c_str()
-               << " float" << std::endl
-               << "LOOKUP_TABLE default" << std::endl;
+  // Write function.  Performs ALL file I/O for this dump using only state captured by
+  // value, so it can run on the writer thread concurrently with subsequent cycles.
+  auto write_file = [=]() {
+    bool parallel_write=false;
+#if MPI_PARALLEL_ENABLED
+    //----- WRITE IN PARALLEL WITH MPI: -----
+    // For MPI runs, all MeshBlocks are written to a single file with collective MPI-IO.
+    // One derived datatype per rank describes every cell-row this rank contributes to
+    // the global grid, with file offsets precomputed from the block positions, so each
+    // variable is written with a single collective call; there is no per-MeshBlock
+    // coordination, and dump time depends on bytes written rather than on rank count.
+    // If GID is specified in input file so only one MB written, then file is written
+    // using serial mode below
+
+    // open file and write file header
+    if (multi_mb_file) {
+      MPI_File fh;
+      if (MPI_File_open(iocomm, fname.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                        MPI_INFO_NULL, &fh) != MPI_SUCCESS) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+          exit(EXIT_FAILURE);
+      }
       if (global_variable::my_rank == 0) {
-        MPI_File_write(fh, data_msg.str().c_str(), data_msg.str().size(),
-                          MPI_BYTE, MPI_STATUS_IGNORE);
+        MPI_File_write(fh, hdr.c_str(), hdr.size(), MPI_BYTE, MPI_STATUS_IGNORE);
       }
-      header_size += data_msg.str().size();
-
-      // Loop over max number of MeshBlocks to be written on any rank
-      // This guarantees collective MPI functions are called by all ranks
-      MPI_Datatype mygrid;
-      for (int m=0; m<noutmbs_max; ++m) {
-        // if there is a MB to be written, set location in 3D grid of MBs in output file.
-        if (m < nout_mbs) {
-          LogicalLocation lloc = pm->lloc_eachmb[outmbs[m].mb_gid];
-          // calculate indices of this MeshBlock in 3D grid of MBs
-          int imb = (out_params.slice1 || (out_params.gid >= 0))? 0 : lloc.lx1;
-          int jmb = (out_params.slice2 || (out_params.gid >= 0))? 0 : lloc.lx2;
-          int kmb = (out_params.slice3 || (out_params.gid >= 0))? 0 : lloc.lx3;
-
-          // convert data to float and byte swap into big endian order
-          for (int k=0; k<nx3; ++k) {
-            for (int j=0; j<nx2; ++j) {
-              for (int i=0; i<nx1; ++i) {
-                int indx = i + j*indcs.nx1 + k*indcs.nx1*indcs.nx2;
-                data[indx] = static_cast<float>(outarray(n,m,k,j,i));
-              }
-            }
+      size_t header_size = hdr.size();
+
+      // number of cells output per MeshBlock in each direction (a rank may have no
+      // blocks to write with slices)
+      int nx1 = 0, nx2 = 0, nx3 = 0;
+      if (nout_mbs > 0) {
+        nx1 = outmbs_[0].oie - outmbs_[0].ois + 1;
+        nx2 = outmbs_[0].oje - outmbs_[0].ojs + 1;
+        nx3 = outmbs_[0].oke - outmbs_[0].oks + 1;
+      }
+
+      // precompute the file offset of every x-row this rank writes from the position of
+      // its blocks in the global grid of cells, then sort the rows by offset (the MPI
+      // file view requires monotone displacements); the pattern is identical for every
+      // variable, so the datatype is built once
+      struct OutRow {
+        size_t disp;   // byte displacement of row within one variable's data section
+        int m, k, j;   // source MeshBlock and cell-row therein
+      };
+      std::vector<OutRow> rows;
+      rows.reserve(static_cast<size_t>(nout_mbs)*nx3*nx2);
+      for (int m=0; m<nout_mbs; ++m) {
+        for (int k=0; k<nx3; ++k) {
+          for (int j=0; j<nx2; ++j) {
+            size_t gk = static_cast<size_t>(kmbs[m])*nx3 + k;
+            size_t gj = static_cast<size_t>(jmbs[m])*nx2 + j;
+            size_t cell = (gk*nout2 + gj)*nout1 + static_cast<size_t>(imbs[m])*nx1;
+            rows.push_back({cell*sizeof(float), m, k, j});
+          }
+        }
+      }
+      std::sort(rows.begin(), rows.end(),
+                [](const OutRow &a, const OutRow &b) {return a.disp < b.disp;});
+      int nrows = static_cast<int>(rows.size());
+
+      // build the file view datatype: nrows blocks of nx1 floats at the sorted offsets;
+      // a rank with nothing to write (possible with slices) tiles the view with plain
+      // floats and participates in the collectives with zero-length writes
+      MPI_Datatype rowtype = MPI_FLOAT;
+      if (nrows > 0) {
+        std::vector<int> blens(nrows, nx1);
+        std::vector<MPI_Aint> disps(nrows);
+        for (int r=0; r<nrows; ++r) {disps[r] = static_cast<MPI_Aint>(rows[r].disp);}
+        MPI_Type_create_hindexed(nrows, blens.data(), disps.data(), MPI_FLOAT, &rowtype);
+        MPI_Type_commit(&rowtype);
+      }
+
+      // packed buffer holding this rank's rows in file order
+      float *data = new float[static_cast<size_t>(nrows)*nx1];
+
+      // Loop over variables
+      for (int n=0; n<nout_vars; ++n) {
+        // write header this variable (SCALARS or VECTORS, name, type, color table)
+        std::stringstream data_msg;
+        data_msg << std::endl << "SCALARS " << labels[n].c_str()
+                 << " float" << std::endl
+                 << "LOOKUP_TABLE default" << std::endl;
+        if (global_variable::my_rank == 0) {
+          MPI_File_write(fh, data_msg.str().c_str(), data_msg.str().size(),
+                            MPI_BYTE, MPI_STATUS_IGNORE);
+        }
+        header_size += data_msg.str().size();
+
+        // pack rows in file order, converting to big-endian floats
+        for (int r=0; r<nrows; ++r) {
+          float *prow = &data[static_cast<size_t>(r)*nx1];
+          for (int i=0; i<nx1; ++i) {
+            prow[i] = static_cast<float>(outdata(n,rows[r].m,rows[r].k,rows[r].j,i));
           }
           if (!big_end) {
-            for (int i=0; i<(nx1*nx2*nx3); ++i) {
-              Swap4Bytes(&data[i]);
-            }
+            for (int i=0; i<nx1; ++i) {Swap4Bytes(&prow[i]);}
           }
-          // create new datatype representing this block in grid of MBs, and set file view
-          int strt[3] = {kmb*nx3, jmb*nx2, imb*nx1};   // starting indices of this block
-          MPI_Type_create_subarray(3,gridsize,mbsize,strt,MPI_ORDER_C,MPI_FLOAT,&mygrid);
-          MPI_Type_commit(&mygrid);
-          MPI_File_set_view(fh, header_size, MPI_FLOAT, mygrid, "native", MPI_INFO_NULL);
-        } else {
-          // if no data to be written, set file view to default
-          // file view function is a collective operation, so must be called by all ranks
-          MPI_File_set_view(fh, header_size, MPI_FLOAT, grid, "native", MPI_INFO_NULL);
         }
 
-        // every rank has a MB to write, so write collectively
-        if (m < noutmbs_min) {
-          MPI_File_write_all(fh, &(data[0]), 1, block, MPI_STATUS_IGNORE);
-        // some ranks are finished writing, so use non-collective write
-        } else if (m < nout_mbs) {
-          MPI_File_write(fh, &(data[0]), 1, block, MPI_STATUS_IGNORE);
-        }
-      }  // end loop over MeshBlocks
-      MPI_Type_free(&mygrid);
-
-      // reset view to stream of bytes in preparation for adding next data header
-      header_size += nout1*nout2*nout3*sizeof(float);
-      MPI_File_set_view(fh, header_size, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
-    }  // end loop over variables
-
-    // close the output file and clean up
-    MPI_Type_free(&block);
-    MPI_Type_free(&grid);
-    MPI_File_close(&fh);
-    delete[] data;
-    parallel_write=true;
-  }
+        // one collective write for this variable
+        MPI_File_set_view(fh, header_size, MPI_FLOAT, rowtype, "native", MPI_INFO_NULL);
+        MPI_File_write_all(fh, &(data[0]), nrows*nx1, MPI_FLOAT, MPI_STATUS_IGNORE);
 
-#endif
-  if (!(parallel_write)) {
-    //----- WRITE SERIAL FILES: -----
-    // For serial (non-mpi) runs, use standard Unix-I/O functions.
-    // open file and write header
-    FILE *pfile;
-    if ((pfile = std::fopen(fname.c_str(),"w")) == nullptr) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-        << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
-        exit(EXIT_FAILURE);
+        // reset view to stream of bytes in preparation for adding next data header
+        header_size += static_cast<size_t>(nout1)*nout2*nout3*sizeof(float);
+        MPI_File_set_view(fh, header_size, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
+      }  // end loop over variables
+
+      // close the output file and clean up
+      if (rowtype != MPI_FLOAT) {MPI_Type_free(&rowtype);}
+      MPI_File_close(&fh);
+      delete[] data;
+      parallel_write=true;
     }
-    std::fprintf(pfile,"%s",msg.str().c_str());
-
-    // allocate 1D vector of floats used to convert and output entire 3D data
-    float *data = new float[nout1*nout2*nout3];
-    // Loop over variables
-    int nout_vars = outvars.size();
-    for (int n=0; n<nout_vars; ++n) {
-      // write data type (SCALARS or VECTORS) and name
-      std::stringstream data_msg;
-      data_msg << std::endl << "SCALARS " << outvars[n].label.c_str()
-               << " float" << std::endl
-               << "LOOKUP_TABLE default" << std::endl;
-      std::fprintf(pfile,"%s",data_msg.str().c_str());
-
-      // Loop over MeshBlocks, insert variable into 3D array
-      for (int m=0; m<nout_mbs; ++m) {
-        LogicalLocation lloc = pm->lloc_eachmb[outmbs[m].mb_gid];
-        // calculate indices of this MeshBlock in 3D grid of MBs
-        int imb = (out_params.slice1 || (out_params.gid >= 0))? 0 : lloc.lx1;
-        int jmb = (out_params.slice2 || (out_params.gid >= 0))? 0 : lloc.lx2;
-        int kmb = (out_params.slice3 || (out_params.gid >= 0))? 0 : lloc.lx3;
-
-        int &ois = outmbs[m].ois;
-        int &oie = outmbs[m].oie;
-        int &ojs = outmbs[m].ojs;
-        int &oje = outmbs[m].oje;
-        int &oks = outmbs[m].oks;
-        int &oke = outmbs[m].oke;
-        for (int k=oks; k<=oke; ++k) {
-          for (int j=ojs; j<=oje; ++j) {
-            for (int i=ois; i<=oie; ++i) {
-              int indx = imb*indcs.nx1 + (i-ois) +
-                        (jmb*indcs.nx2 + (j-ojs))*nout1 +
-                        (kmb*indcs.nx3 + (k-oks))*nout1*nout2;
-              data[indx] = static_cast<float>(outarray(n,m,k-oks,j-ojs,i-ois));
+
+#endif
+    if (!(parallel_write)) {
+      //----- WRITE SERIAL FILES: -----
+      // For serial (non-mpi) runs, use standard Unix-I/O functions.
+      // open file and write header
+      FILE *pfile;
+      if ((pfile = std::fopen(fname.c_str(),"w")) == nullptr) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+          exit(EXIT_FAILURE);
+      }
+      std::fprintf(pfile,"%s",hdr.c_str());
+
+      // allocate 1D vector of floats used to convert and output entire 3D data
+      float *data = new float[nout1*nout2*nout3];
+      // Loop over variables
+      for (int n=0; n<nout_vars; ++n) {
+        // write data type (SCALARS or VECTORS) and name
+        std::stringstream data_msg;
+        data_msg << std::endl << "SCALARS " << labels[n].c_str()
+                 << " float" << std::endl
+                 << "LOOKUP_TABLE default" << std::endl;
+        std::fprintf(pfile,"%s",data_msg.str().c_str());
+
+        // Loop over MeshBlocks, insert variable into 3D array
+        for (int m=0; m<nout_mbs; ++m) {
+          const int &ois = outmbs_[m].ois;
+          const int &oie = outmbs_[m].oie;
+          const int &ojs = outmbs_[m].ojs;
+          const int &oje = outmbs_[m].oje;
+          const int &oks = outmbs_[m].oks;
+          const int &oke = outmbs_[m].oke;
+          for (int k=oks; k<=oke; ++k) {
+            for (int j=ojs; j<=oje; ++j) {
+              for (int i=ois; i<=oie; ++i) {
+                int indx = imbs[m]*snx1 + (i-ois) +
+                          (jmbs[m]*snx2 + (j-ojs))*nout1 +
+                          (kmbs[m]*snx3 + (k-oks))*nout1*nout2;
+                data[indx] = static_cast<float>(outdata(n,m,k-oks,j-ojs,i-ois));
+              }
             }
           }
-        }
-      }  // end loop over MeshBlocks
+        }  // end loop over MeshBlocks
 
-      // swap data for this variable into big endian order
-      if (!big_end) {
-        for (int i=0; i<(nout1*nout2*nout3); ++i) { Swap4Bytes(&data[i]); }
+        // swap data for this variable into big endian order
+        if (!big_end) {
+          for (int i=0; i<(nout1*nout2*nout3); ++i) { Swap4Bytes(&data[i]); }
+        }
+        // now write the data as unformatted binary
+        std::fwrite(&(data[0]), sizeof(float), nout1*nout2*nout3, pfile);
       }
-      // now write the data as unformatted binary
-      std::fwrite(&(data[0]), sizeof(float), nout1*nout2*nout3, pfile);
+      // close the output file and clean up
+      std::fclose(pfile);
+      delete[] data;
     }
-    // close the output file and clean up
-    std::fclose(pfile);
-    delete[] data;
+  };
+
+  // hand I/O to the writer thread (blocking only if the previous dump from this output
+  // is still being written), or else write synchronously
+  if (out_params.async_write) {
+    LaunchAsyncWrite(write_file);
+    // detach the host buffer; the next LoadOutputData() then fills a fresh allocation
+    // while the writer thread drains this one (i.e. outarray is double-buffered)
+    outarray = HostArray5D<Real>("cc_outvar",1,1,1,1,1);
+  } else {
+    write_file();
   }
 
   // increment counters
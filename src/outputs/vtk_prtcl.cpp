@@ -146,38 +146,26 @@ void ParticleVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   if (!big_end) {
     for (int i=0; i<(3*npout_thisrank); ++i) { Swap4Bytes(&data[i]); }
   }
-  // calculate local data offset
+  // calculate local data offset from scan of per-rank particle counts
   std::vector<int> rank_offset(global_variable::nranks, 0);
-  int npout_min = pm->nprtcl_eachrank[0];
   for (int n=1; n<global_variable::nranks; ++n) {
     rank_offset[n] = rank_offset[n-1] + pm->nprtcl_eachrank[n-1];
-    npout_min = std::min(npout_min, pm->nprtcl_eachrank[n]);
   }
 
-  // Write particle positions
+  // Write particle positions.  Each rank writes its whole block in one collective call
+  // at the offset given by the particle-count scan; collective writes permit different
+  // counts per rank, so arbitrary imbalance (including empty ranks) needs no fallback
+  // to individual writes
   {
     std::size_t datasize = sizeof(float);
     std::size_t myoffset=header_offset + 3*rank_offset[global_variable::my_rank]*datasize;
-    // collective writes for minimum number of particles across ranks
-    if (partfile.Write_any_type_at_all(&(data[0]),3*npout_min,myoffset,"float")
-          != 3*npout_min) {
+    if (partfile.Write_any_type_at_all(&(data[0]),3*npout_thisrank,myoffset,"float")
+          != 3*npout_thisrank) {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
           << std::endl << "particle data not written correctly to vtk particle file, "
           << "vtk file is broken." << std::endl;
       exit(EXIT_FAILURE);
     }
-    // individual writes for remaining particles on each rank
-    myoffset += datasize*3*npout_min;
-    int nremain = pm->nprtcl_thisrank - npout_min;
-    if (nremain > 0) {
-      if (partfile.Write_any_type_at(&(data[3*npout_min]),3*nremain,myoffset,"float")
-            != 3*nremain) {
-        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-            << std::endl << "particle data not written correctly to vtk particle file, "
-            << "vtk file is broken." << std::endl;
-        exit(EXIT_FAILURE);
-      }
-    }
     header_offset += 3*pm->nprtcl_total*datasize;
   }
 
@@ -216,29 +204,16 @@ void ParticleVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
       for (int i=0; i<npout_thisrank; ++i) { Swap4Bytes(&data[i]); }
     }
 
-    // calculate local data offset and write gid
+    // calculate local data offset and write this rank's whole block collectively
     std::size_t datasize = sizeof(float);
     std::size_t myoffset=header_offset + rank_offset[global_variable::my_rank]*datasize;
-    // collective writes for minimum number of particles across ranks
-    if (partfile.Write_any_type_at_all(&(data[0]),npout_min,myoffset,"float")
-          != npout_min) {
+    if (partfile.Write_any_type_at_all(&(data[0]),npout_thisrank,myoffset,"float")
+          != npout_thisrank) {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
           << std::endl << "particle data not written correctly to vtk particle file, "
           << "vtk file is broken." << std::endl;
       exit(EXIT_FAILURE);
     }
-    // individual writes for remaining particles on each rank
-    myoffset += datasize*npout_min;
-    int nremain = pm->nprtcl_thisrank - npout_min;
-    if (nremain > 0) {
-      if (partfile.Write_any_type_at(&(data[npout_min]),nremain,myoffset,"float")
-            != nremain) {
-        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-            << std::endl << "particle data not written correctly to vtk particle file, "
-            << "vtk file is broken." << std::endl;
-        exit(EXIT_FAILURE);
-      }
-    }
     header_offset += pm->nprtcl_total*datasize;
   }
 
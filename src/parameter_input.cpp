@@ -168,43 +168,50 @@ void ParameterInput::LoadFromStream(std::istream &is) {
 
 //----------------------------------------------------------------------------------------
 //! \fn  void ParameterInput::LoadFromFile(IOWrapper &input)
-//  \brief Read the parameters from an input or restart file.
+//  \brief Read the parameters from an input or restart file.  Only rank 0 touches the
+//  file: it reads the whole header by itself, then the header is shared with a single
+//  size+payload broadcast and every rank parses it locally.  (Broadcasting each 4KB
+//  chunk from inside the read loop, as was done previously, serializes startup at
+//  large rank counts.)
 
 void ParameterInput::LoadFromFile(IOWrapper &input) {
-  std::stringstream par;
   constexpr int kBufSize = 4096;
   char buf[kBufSize];
-  IOWrapperSizeT header = 0, ret, loc;
+  IOWrapperSizeT header = 0, ret;
+  std::string par_str;
 
-  // search for <par_end> (reading from restart files) or EOF (reading from input file).
-  do {
-    if (global_variable::my_rank == 0) { // only the master process reads header from file
+  // search for <par_end> (reading from restart files) or EOF (reading from input file)
+  if (global_variable::my_rank == 0) {
+    do {
       ret = input.Read_bytes(buf, sizeof(char), kBufSize);
-    }
+      par_str.append(buf, ret);   // add the buffer to the accumulated header
+      header += ret;
+      IOWrapperSizeT loc = par_str.find("<par_end>", 0); // search from the top
+      if (loc != std::string::npos) { // found <par_end>
+        header = loc + 10; // store the header length
+        par_str.resize(header); // discard anything read past the header
+        break;
+      }
+      if (header > kBufSize*10) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<par_end> is not found in the first 40KBytes."
+                  << std::endl << "Probably the file is broken or the wrong file is "
+                  << "specified" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    } while (ret == kBufSize); // till EOF (or par_end is found)
+  }
+
 #if MPI_PARALLEL_ENABLED
-    // then broadcasts it
-    MPI_Bcast(&ret, sizeof(IOWrapperSizeT), MPI_BYTE, 0, MPI_COMM_WORLD);
-    MPI_Bcast(buf, ret, MPI_BYTE, 0, MPI_COMM_WORLD);
+  // single size+payload broadcast of the whole header
+  MPI_Bcast(&header, sizeof(IOWrapperSizeT), MPI_BYTE, 0, MPI_COMM_WORLD);
+  par_str.resize(header);
+  MPI_Bcast(par_str.data(), header, MPI_BYTE, 0, MPI_COMM_WORLD);
 #endif
-    par.write(buf, ret); // add the buffer into the stream
-    header += ret;
-    std::string sbuf = par.str(); // create string for search
-    loc = sbuf.find("<par_end>", 0); // search from the top of the stream
-    if (loc != std::string::npos) { // found <par_end>
-      header = loc + 10; // store the header length
-      break;
-    }
-    if (header > kBufSize*10) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                << std::endl << "<par_end> is not found in the first 40KBytes."
-                << std::endl << "Probably the file is broken or the wrong file is "
-                << "specified" << std::endl;
-      std::exit(EXIT_FAILURE);
-    }
-  } while (ret == kBufSize); // till EOF (or par_end is found)
 
-  // Now par contains the parameter inputs + some additional including <par_end>
+  // Now par_str contains the parameter inputs + some additional including <par_end>
   // Read the stream and load the parameters
+  std::stringstream par(par_str);
   LoadFromStream(par);
   // Seek the file to the end of the header
   input.Seek(header);
@@ -30,6 +30,16 @@ Particles::Particles(MeshBlockPack *ppack, ParameterInput *pin) :
     std::exit(EXIT_FAILURE);
   }
 
+  // particles are owned through their parent MeshBlock GID, and AMR regrids renumber
+  // and redistribute GIDs without migrating particle data, which would leave every
+  // particle pointing at a stale block.  Refuse the combination until particle
+  // migration is implemented alongside RedistAndRefineMeshBlocks()
+  if (pmy_pack->pmesh->adaptive) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Particle module does not yet support AMR" <<std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   // read number of particles per cell, and calculate number of particles this pack
   Real ppc = pin->GetOrAddReal("particles","ppc",1.0);
 
@@ -87,6 +97,20 @@ Particles::Particles(MeshBlockPack *ppack, ParameterInput *pin) :
   Kokkos::realloc(prtcl_rdata, nrdata, nprtcl_thispack);
   Kokkos::realloc(prtcl_idata, nidata, nprtcl_thispack);
 
+  // cycles between bin-sorts of particle arrays by cell, which keep field gathers in
+  // the pushers coalesced as particle order decorrelates from spatial order (0 = never)
+  sort_interval = pin->GetOrAddInteger("particles","sort_interval",0);
+
+  // deposit particle number density onto the mesh every cycle (see DepositToMesh)
+  deposit_density = pin->GetOrAddBoolean("particles","deposit",false);
+  if (deposit_density) {
+    Kokkos::realloc(prtcl_dens, pmy_pack->nmb_thispack,
+                    indcs.nx3 + 2*indcs.ng*(pmy_pack->pmesh->three_d ? 1 : 0),
+                    indcs.nx2 + 2*indcs.ng,
+                    indcs.nx1 + 2*indcs.ng);
+    Kokkos::deep_copy(prtcl_dens, 0.0);
+  }
+
   // allocate boundary object
   pbval_part = new ParticlesBoundaryValues(this, pin);
 }
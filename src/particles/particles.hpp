@@ -30,6 +30,8 @@ enum class ParticleType {cosmic_ray};
 //  \brief container to hold TaskIDs of all particles tasks
 
 struct ParticlesTaskIDs {
+  TaskID sort;
+  TaskID deposit;
   TaskID push;
   TaskID newgid;
   TaskID count;
@@ -55,11 +57,15 @@ class Particles {
   ParticleType particle_type;
   int nprtcl_thispack;             // number of particles this MeshBlockPack
   int nrdata, nidata;
-//  DvceArray1D<int>  prtcl_gid;     // GID of MeshBlock containing each par
-//  DvceArray2D<Real> prtcl_pos;     // positions
-//  DvceArray2D<Real> prtcl_vel;     // velocities
+  // Particle properties are stored property-major (LayoutRight with the particle index
+  // last), so each property is a separate contiguous stream and kernels that read only
+  // positions (e.g. the boundary check) never touch velocity or auxiliary rows.  The
+  // single allocation also lets the MPI pack/unpack treat all properties uniformly.
   DvceArray2D<Real> prtcl_rdata;   // real number properties each particle (x,v,etc.)
   DvceArray2D<int>  prtcl_idata;   // integer properties each particle (gid, tag, etc.)
+  int sort_interval;               // cycles between bin-sorts by cell (0 = never)
+  bool deposit_density;            // deposit particle number density onto the mesh
+  DvceArray4D<Real> prtcl_dens;    // deposited number density (per cell volume)
   Real dtnew;
 
   ParticlesPusher pusher;
@@ -73,6 +79,8 @@ class Particles {
   // functions...
   void CreateParticleTags(ParameterInput *pin);
   void AssembleTasks(std::map<std::string, std::shared_ptr<TaskList>> tl);
+  TaskStatus SortByCell(Driver *pdriver, int stage);
+  TaskStatus DepositToMesh(Driver *pdriver, int stage);
   TaskStatus Push(Driver *pdriver, int stage);
   TaskStatus NewGID(Driver *pdriver, int stage);
   TaskStatus SendCnt(Driver *pdriver, int stage);
@@ -0,0 +1,92 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file particles_sort.cpp
+//! \brief periodic counting sort of particle arrays by cell.  After a few cycles the
+//! storage order of particles decorrelates from their spatial order, so the per-particle
+//! gathers of MeshBlock data in the pushers become random access.  Re-binning particles
+//! by (MeshBlock, cell) restores coalesced access for particles handled by the same warp.
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "particles.hpp"
+
+namespace particles {
+//----------------------------------------------------------------------------------------
+//! \fn  TaskStatus Particles::SortByCell
+//! \brief counting sort of prtcl_rdata/prtcl_idata by cell index, run every
+//! sort_interval cycles (0 = never).  Order of particles within a cell is not preserved,
+//! which is irrelevant since no algorithm depends on it.
+
+TaskStatus Particles::SortByCell(Driver *pdriver, int stage) {
+  if (sort_interval <= 0) {return TaskStatus::complete;}
+  if ((pmy_pack->pmesh->ncycle)%(sort_interval) != 0) {return TaskStatus::complete;}
+  int npart = nprtcl_thispack;
+  if (npart == 0) {return TaskStatus::complete;}
+
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, nx1 = indcs.nx1;
+  int js = indcs.js, nx2 = indcs.nx2;
+  int ks = indcs.ks, nx3 = indcs.nx3;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  auto &pi = prtcl_idata;
+  auto &pr = prtcl_rdata;
+  auto gids = pmy_pack->gids;
+  int ncells = nx1*nx2*nx3;
+  int nbins = (pmy_pack->nmb_thispack)*ncells;
+
+  // bin each particle by (MeshBlock, cell) with cells in the same (m,k,j,i) order used
+  // by grid kernels, and histogram the bin populations
+  DvceArray1D<int> bin_count("bin_count", nbins);
+  DvceArray1D<int> prtcl_bin("prtcl_bin", npart);
+  par_for("part_bin",DevExeSpace(),0,(npart-1),
+  KOKKOS_LAMBDA(const int p) {
+    int m = pi(PGID,p) - gids;
+    int ip = (pr(IPX,p) - mbsize.d_view(m).x1min)/mbsize.d_view(m).dx1;
+    ip = (ip < 0)? 0 : ((ip > nx1-1)? nx1-1 : ip);
+    int b = ip;
+    if (multi_d) {
+      int jp = (pr(IPY,p) - mbsize.d_view(m).x2min)/mbsize.d_view(m).dx2;
+      jp = (jp < 0)? 0 : ((jp > nx2-1)? nx2-1 : jp);
+      b += nx1*jp;
+    }
+    if (three_d) {
+      int kp = (pr(IPZ,p) - mbsize.d_view(m).x3min)/mbsize.d_view(m).dx3;
+      kp = (kp < 0)? 0 : ((kp > nx3-1)? nx3-1 : kp);
+      b += nx1*nx2*kp;
+    }
+    b += m*ncells;
+    prtcl_bin(p) = b;
+    Kokkos::atomic_fetch_add(&bin_count(b),1);
+  });
+
+  // exclusive prefix sum of the histogram gives the first slot of each bin
+  DvceArray1D<int> bin_offset("bin_offset", nbins);
+  Kokkos::parallel_scan("part_bin_offset", Kokkos::RangePolicy<>(DevExeSpace(), 0, nbins),
+  KOKKOS_LAMBDA(const int b, int &sum, const bool final_pass) {
+    if (final_pass) {bin_offset(b) = sum;}
+    sum += bin_count(b);
+  });
+
+  // scatter particles to their bin slots in scratch arrays, then copy back
+  int nrdata_ = nrdata;
+  int nidata_ = nidata;
+  DvceArray2D<Real> rbuf("prtcl_rsort", nrdata, npart);
+  DvceArray2D<int>  ibuf("prtcl_isort", nidata, npart);
+  par_for("part_scatter",DevExeSpace(),0,(npart-1),
+  KOKKOS_LAMBDA(const int p) {
+    int dest = Kokkos::atomic_fetch_add(&bin_offset(prtcl_bin(p)),1);
+    for (int n=0; n<nrdata_; ++n) {rbuf(n,dest) = pr(n,p);}
+    for (int n=0; n<nidata_; ++n) {ibuf(n,dest) = pi(n,p);}
+  });
+  Kokkos::deep_copy(DevExeSpace(), prtcl_rdata, rbuf);
+  Kokkos::deep_copy(DevExeSpace(), prtcl_idata, ibuf);
+
+  return TaskStatus::complete;
+}
+} // namespace particles
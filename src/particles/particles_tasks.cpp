@@ -29,14 +29,30 @@ void Particles::AssembleTasks(std::map<std::string, std::shared_ptr<TaskList>> t
   TaskID none(0);
 
   // particle integration done in "before_timeintegrator" task list
-  id.push   = tl["before_timeintegrator"]->AddTask(&Particles::Push, this, none);
-  id.newgid = tl["before_timeintegrator"]->AddTask(&Particles::NewGID, this, id.push);
-  id.count  = tl["before_timeintegrator"]->AddTask(&Particles::SendCnt, this, id.newgid);
-  id.irecv  = tl["before_timeintegrator"]->AddTask(&Particles::InitRecv, this, id.count);
-  id.sendp  = tl["before_timeintegrator"]->AddTask(&Particles::SendP, this, id.irecv);
-  id.recvp  = tl["before_timeintegrator"]->AddTask(&Particles::RecvP, this, id.sendp);
-  id.crecv  = tl["before_timeintegrator"]->AddTask(&Particles::ClearRecv, this, id.recvp);
-  id.csend  = tl["before_timeintegrator"]->AddTask(&Particles::ClearSend, this, id.crecv);
+  id.sort   = tl["before_timeintegrator"]->AddTask(&Particles::SortByCell, this, none,
+      "Particles::SortByCell");
+  id.push   = tl["before_timeintegrator"]->AddTask(&Particles::Push, this, id.sort,
+      "Particles::Push");
+  id.newgid = tl["before_timeintegrator"]->AddTask(&Particles::NewGID, this, id.push,
+      "Particles::NewGID");
+  id.count  = tl["before_timeintegrator"]->AddTask(&Particles::SendCnt, this, id.newgid,
+      "Particles::SendCnt");
+  id.irecv  = tl["before_timeintegrator"]->AddTask(&Particles::InitRecv, this, id.count,
+      "Particles::InitRecv");
+  id.sendp  = tl["before_timeintegrator"]->AddTask(&Particles::SendP, this, id.irecv,
+      "Particles::SendP");
+  // receives are drained in the first-stage "stagen" list rather than here, so the
+  // particle communication latency hides under the fluid boundary/update tasks instead
+  // of adding directly to cycle time (sends were already posted above)
+  id.recvp  = tl["stagen"]->AddTask(&Particles::RecvP, this, none,
+      "Particles::RecvP");
+  id.crecv  = tl["stagen"]->AddTask(&Particles::ClearRecv, this, id.recvp,
+      "Particles::ClearRecv");
+  id.csend  = tl["stagen"]->AddTask(&Particles::ClearSend, this, id.crecv,
+      "Particles::ClearSend");
+  // deposition runs once the receives are unpacked, so counts reflect final positions
+  id.deposit = tl["stagen"]->AddTask(&Particles::DepositToMesh, this, id.recvp,
+      "Particles::DepositToMesh");
 
   return;
 }
@@ -85,6 +101,9 @@ TaskStatus Particles::SendP(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to receive/unpack particles
 
 TaskStatus Particles::RecvP(Driver *pdrive, int stage) {
+  // receives posted in "before_timeintegrator" are drained during stage 1 only, while
+  // fluid tasks in the same list proceed; later stages have nothing to do
+  if (stage != 1) {return TaskStatus::complete;}
   TaskStatus tstat = pbval_part->RecvAndUnpackPrtcls();
   return tstat;
 }
@@ -95,6 +114,7 @@ TaskStatus Particles::RecvP(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function that checks all MPI sends have completed.
 
 TaskStatus Particles::ClearSend(Driver *pdrive, int stage) {
+  if (stage != 1) {return TaskStatus::complete;}
   // check sends of particles complete
   TaskStatus tstat = pbval_part->ClearPrtclSend();
   return tstat;
@@ -105,6 +125,7 @@ TaskStatus Particles::ClearSend(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function that checks all MPI receives have completed.
 
 TaskStatus Particles::ClearRecv(Driver *pdrive, int stage) {
+  if (stage != 1) {return TaskStatus::complete;}
   // check receives of particles complete
   TaskStatus tstat = pbval_part->ClearPrtclRecv();
   return tstat;
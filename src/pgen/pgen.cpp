@@ -80,6 +80,11 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm) :
     SphericalCollapse(pin, false);
   } else if (pgen_fun_name.compare("diffusion") == 0) {
     Diffusion(pin, false);
+  // chain entries for pgens compiled into the registry via '-D PGEN_REGISTRY'
+  // (generated by CMake; empty when no registry pgens are configured)
+#define PGEN_REGISTRY_RESTART false
+#include "pgen_registry_dispatch.hpp"
+#undef PGEN_REGISTRY_RESTART
   // else, name not set on command line or input file, print warning and quit
   } else {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
@@ -173,11 +178,29 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     nadm = padm->nadm;
   }
 
+  // floating-point width of the build that wrote this file, recorded in <job>/real_size
+  // and already validated in Mesh::BuildTreeFromRestart().  When it differs from this
+  // build's Real, every floating-point record below is read at the file width and
+  // converted, so a long campaign can switch precision at a restart boundary (e.g. run
+  // the early phase of an inspiral in single precision and restart in double)
+  const IOWrapperSizeT frsz = pin->GetOrAddInteger("job", "real_size", sizeof(Real));
+
+  // reads cnt Reals at the current file pointer on the calling rank, converting from
+  // the file width when it differs from this build
+  auto read_file_reals = [&](Real *pdata, IOWrapperSizeT cnt) -> std::size_t {
+    if (frsz == sizeof(Real)) {return resfile.Read_Reals(pdata, cnt);}
+    char *fbuf = new char[cnt*frsz];
+    std::size_t nread = resfile.Read_bytes(fbuf, frsz, cnt);
+    IOWrapper::UnpackReals(pdata, fbuf, cnt, frsz);
+    delete [] fbuf;
+    return nread;
+  };
+
   // root process reads z4c last_output_time and tracker data
   if (pz4c != nullptr) {
     Real last_output_time;
     if (global_variable::my_rank == 0) {
-      if (resfile.Read_Reals(&last_output_time, 1) != 1) {
+      if (read_file_reals(&last_output_time, 1) != 1) {
         std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                   << std::endl << "z4c::last_output_time data size read from restart "
                   << "file is incorrect, restart file is broken." << std::endl;
@@ -192,7 +215,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     for (auto &pt : pz4c->ptracker) {
       Real pos[3];
       if (global_variable::my_rank == 0) {
-        if (resfile.Read_Reals(&pos[0], 3) != 3) {
+        if (read_file_reals(&pos[0], 3) != 3) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "compact object tracker data size read from restart "
                     << "file is incorrect, restart file is broken." << std::endl;
@@ -257,24 +280,24 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
 
   IOWrapperSizeT data_size_ = 0;
   if (phydro != nullptr) {
-    data_size_ += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
+    data_size_ += nout1*nout2*nout3*nhydro*frsz; // hydro u0
   }
   if (pmhd != nullptr) {
-    data_size_ += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
-    data_size_ += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
-    data_size_ += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
-    data_size_ += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
+    data_size_ += nout1*nout2*nout3*nmhd*frsz;   // mhd u0
+    data_size_ += (nout1+1)*nout2*nout3*frsz;    // mhd b0.x1f
+    data_size_ += nout1*(nout2+1)*nout3*frsz;    // mhd b0.x2f
+    data_size_ += nout1*nout2*(nout3+1)*frsz;    // mhd b0.x3f
   }
   if (prad != nullptr) {
-    data_size_ += nout1*nout2*nout3*nrad*sizeof(Real);   // rad i0
+    data_size_ += nout1*nout2*nout3*nrad*frsz;   // rad i0
   }
   if (pturb != nullptr) {
-    data_size_ += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
+    data_size_ += nout1*nout2*nout3*nforce*frsz; // forcing
   }
   if (pz4c != nullptr) {
-    data_size_ += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
+    data_size_ += nout1*nout2*nout3*nz4c*frsz;   // z4c u0
   } else if (padm != nullptr) {
-    data_size_ += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
+    data_size_ += nout1*nout2*nout3*nadm*frsz;   // adm u_adm
   }
 
   if (data_size_ != data_size) {
@@ -285,10 +308,122 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     exit(EXIT_FAILURE);
   }
 
-  // read CC data into host array
+  // Attempt to memory-map the restart file.  When the file is staged on node-local
+  // storage this replaces the many small reads per MeshBlock below with copies straight
+  // out of the page cache; the data still reaches the device with one deep_copy per
+  // physics module.  Collective reads require every rank to participate, so the mapping
+  // is only used if it succeeded (and covers the full payload) on every rank.
+  char *map_base = resfile.MapRead();
+  if (map_base != nullptr &&
+      resfile.GetMapSize() < (headeroffset + data_size*(pm->nmb_total))) {
+    resfile.UnmapRead();
+    map_base = nullptr;
+  }
+#if MPI_PARALLEL_ENABLED
+  int map_ok = (map_base != nullptr)? 1 : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &map_ok, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  if (map_ok == 0 && map_base != nullptr) {
+    resfile.UnmapRead();
+    map_base = nullptr;
+  }
+#endif
+
+  // read CC data into host array.  gids_eachrank holds the distribution computed by
+  // Mesh::LoadBalance() for the current rank count, so each rank reads its final blocks
+  // straight from the file even when the job was resized since the file was written.
   int mygids = pm->gids_eachrank[global_variable::my_rank];
   IOWrapperSizeT offset_myrank = headeroffset + data_size_*mygids;
   IOWrapperSizeT myoffset = offset_myrank;
+  // file offset of the first byte of this rank's payload slice; offset_myrank above is
+  // advanced through the sections below, so the lambda must not capture it
+  const IOWrapperSizeT slice_myrank = offset_myrank;
+
+  // Two-phase aggregated read (optional; MPI only, '<job>/restart_read_aggregators').
+  // A subset of aggregator ranks each stream the contiguous payload range owned by
+  // their group of ranks with a few large chunk-aligned reads, and forward each rank
+  // its slice over the interconnect.  Parallel filesystems serve a few large streams
+  // from a few clients far better than nranks strided medium-sized reads, so this is
+  // collective buffering done explicitly; used only when the memory map above is
+  // unavailable.  Costs one copy of the rank's slice in host memory.
+  char *agg_data = nullptr;
+#if MPI_PARALLEL_ENABLED
+  int nagg = pin->GetOrAddInteger("job", "restart_read_aggregators", 0);
+  {
+    int nranks = global_variable::nranks;
+    int myrank = global_variable::my_rank;
+    nagg = std::max(0, std::min(nagg, nranks));
+    if (map_base == nullptr && nagg > 0) {
+      // chunk size sets both the read granularity and the alignment of read offsets;
+      // make it a multiple of the filesystem stripe size (it is clamped so message
+      // lengths stay below the 2GB MPI count limit)
+      IOWrapperSizeT chunk = 1048576*static_cast<IOWrapperSizeT>(std::max(1,
+          std::min(2047, pin->GetOrAddInteger("job", "restart_read_chunk_mib", 256))));
+
+      // this rank's group and the aggregator (first rank) serving it; group g spans
+      // ranks r with (r*nagg)/nranks == g, so groups differ in size by at most one
+      int mygroup = static_cast<int>(
+          (static_cast<IOWrapperSizeT>(myrank)*nagg)/nranks);
+      auto group_first = [&](int g) {
+        return static_cast<int>(
+            (static_cast<IOWrapperSizeT>(g)*nranks + nagg - 1)/nagg);
+      };
+      int rfirst = group_first(mygroup);
+      int rlast = group_first(mygroup+1) - 1;
+
+      // byte range of a rank's payload slice within the restart file
+      auto slice_beg = [&](int r) {
+        return headeroffset + data_size*(pm->gids_eachrank[r]);
+      };
+      auto slice_end = [&](int r) {
+        return headeroffset + data_size*(pm->gids_eachrank[r] + pm->nmb_eachrank[r]);
+      };
+
+      agg_data = new char[data_size*(pm->nmb_thisrank)];
+      if (myrank == rfirst) {
+        // aggregator: read the group range one aligned chunk at a time, then pass each
+        // owner the part of the chunk inside its slice (order matches the receivers)
+        char *chunk_data = new char[chunk];
+        IOWrapperSizeT gend = slice_end(rlast);
+        for (IOWrapperSizeT cbeg = (slice_beg(rfirst)/chunk)*chunk; cbeg < gend;
+             cbeg += chunk) {
+          IOWrapperSizeT rbeg = std::max(cbeg, slice_beg(rfirst));
+          IOWrapperSizeT rend = std::min(cbeg + chunk, gend);
+          if (resfile.Read_bytes_at(chunk_data, 1, rend-rbeg, rbeg) != (rend-rbeg)) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                      << std::endl << "Aggregated read from restart file failed, "
+                      << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          for (int r=rfirst; r<=rlast; ++r) {
+            IOWrapperSizeT pbeg = std::max(rbeg, slice_beg(r));
+            IOWrapperSizeT pend = std::min(rend, slice_end(r));
+            if (pbeg >= pend) continue;
+            if (r == myrank) {
+              std::memcpy(agg_data + (pbeg - slice_beg(r)), chunk_data + (pbeg - rbeg),
+                          pend - pbeg);
+            } else {
+              MPI_Send(chunk_data + (pbeg - rbeg), static_cast<int>(pend - pbeg),
+                       MPI_CHAR, r, 0, MPI_COMM_WORLD);
+            }
+          }
+        }
+        delete [] chunk_data;
+      } else {
+        // owner: receive the pieces of my slice in the same chunk order in which the
+        // aggregator walks its group range
+        IOWrapperSizeT sbeg = slice_beg(myrank);
+        IOWrapperSizeT sfin = slice_end(myrank);
+        for (IOWrapperSizeT cbeg = (sbeg/chunk)*chunk; cbeg < sfin; cbeg += chunk) {
+          IOWrapperSizeT pbeg = std::max(cbeg, sbeg);
+          IOWrapperSizeT pend = std::min(cbeg + chunk, sfin);
+          if (pbeg >= pend) continue;
+          MPI_Recv(agg_data + (pbeg - sbeg), static_cast<int>(pend - pbeg), MPI_CHAR,
+                   rfirst, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        }
+      }
+    }
+  }
+#endif
 
   HostArray5D<Real> ccin("rst-cc-in", 1, 1, 1, 1, 1);
   HostFaceFld4D<Real> fcin("rst-fc-in", 1, 1, 1, 1);
@@ -301,6 +436,44 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     noutmbs_min = std::min(noutmbs_min,pm->nmb_eachrank[i]);
   }
 
+  // reads cnt Reals at the given offset, either by copying from the mapped file or the
+  // aggregated payload slice, or with MPI-IO; the everyone flag selects the collective
+  // read on the MPI-IO path.  All offsets are in file-width (frsz) units; values are
+  // converted when the file was written at the other precision
+  auto read_reals = [&](Real *pdata, int cnt, IOWrapperSizeT offset, bool everyone)
+                    -> std::size_t {
+    if (frsz == sizeof(Real)) {
+      if (map_base != nullptr) {
+        std::memcpy(pdata, map_base + offset, cnt*sizeof(Real));
+        return static_cast<std::size_t>(cnt);
+      }
+      if (agg_data != nullptr) {
+        std::memcpy(pdata, agg_data + (offset - slice_myrank), cnt*sizeof(Real));
+        return static_cast<std::size_t>(cnt);
+      }
+      if (everyone) {
+        return resfile.Read_Reals_at_all(pdata, cnt, offset);
+      }
+      return resfile.Read_Reals_at(pdata, cnt, offset);
+    }
+    // file written at the other precision: fetch the raw values, then convert.  The
+    // host-side conversion pass is negligible next to the read itself
+    std::size_t nread = static_cast<std::size_t>(cnt);
+    char *fbuf = new char[cnt*frsz];
+    if (map_base != nullptr) {
+      std::memcpy(fbuf, map_base + offset, cnt*frsz);
+    } else if (agg_data != nullptr) {
+      std::memcpy(fbuf, agg_data + (offset - slice_myrank), cnt*frsz);
+    } else if (everyone) {
+      nread = resfile.Read_bytes_at_all(fbuf, frsz, cnt, offset);
+    } else {
+      nread = resfile.Read_bytes_at(fbuf, frsz, cnt, offset);
+    }
+    IOWrapper::UnpackReals(pdata, fbuf, cnt, frsz);
+    delete [] fbuf;
+    return nread;
+  };
+
   if (phydro != nullptr) {
     Kokkos::realloc(ccin, nmb, nhydro, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
@@ -310,7 +483,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                      Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at_all(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, true) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC hydro data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -324,7 +497,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                      Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, false) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC hydro data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -335,7 +508,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     }
     Kokkos::deep_copy(Kokkos::subview(phydro->u0, std::make_pair(0,nmb), Kokkos::ALL,
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
-    offset_myrank += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
+    offset_myrank += nout1*nout2*nout3*nhydro*frsz; // hydro u0
     myoffset = offset_myrank;
   }
 
@@ -348,7 +521,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                    Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at_all(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, true) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC mhd data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -361,7 +534,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                      Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, false) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC mhd data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -372,7 +545,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     }
     Kokkos::deep_copy(Kokkos::subview(pmhd->u0, std::make_pair(0,nmb), Kokkos::ALL,
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
-    offset_myrank += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
+    offset_myrank += nout1*nout2*nout3*nmhd*frsz;   // mhd u0
     myoffset = offset_myrank;
 
     Kokkos::realloc(fcin.x1f, nmb, nout3, nout2, nout1+1);
@@ -386,77 +559,77 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto x1fptr = Kokkos::subview(fcin.x1f, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
         int fldcnt = x1fptr.size();
 
-        if (resfile.Read_Reals_at_all(x1fptr.data(), fldcnt, myoffset) != fldcnt) {
+        if (read_reals(x1fptr.data(), fldcnt, myoffset, true) != fldcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                 << std::endl << "Input b0.x1f field not read correctly from rst file, "
                 << "restart file is broken." << std::endl;
           exit(EXIT_FAILURE);
         }
-        myoffset += fldcnt*sizeof(Real);
+        myoffset += fldcnt*frsz;
 
         // get ptr to x2-face field
         auto x2fptr = Kokkos::subview(fcin.x2f, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
         fldcnt = x2fptr.size();
 
-        if (resfile.Read_Reals_at_all(x2fptr.data(), fldcnt, myoffset) != fldcnt) {
+        if (read_reals(x2fptr.data(), fldcnt, myoffset, true) != fldcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                 << std::endl << "Input b0.x2f field not read correctly from rst file, "
                 << "restart file is broken." << std::endl;
           exit(EXIT_FAILURE);
         }
-        myoffset += fldcnt*sizeof(Real);
+        myoffset += fldcnt*frsz;
 
         // get ptr to x3-face field
         auto x3fptr = Kokkos::subview(fcin.x3f, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
         fldcnt = x3fptr.size();
 
-        if (resfile.Read_Reals_at_all(x3fptr.data(), fldcnt, myoffset) != fldcnt) {
+        if (read_reals(x3fptr.data(), fldcnt, myoffset, true) != fldcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                 << std::endl << "Input b0.x3f field not read correctly from rst file, "
                 << "restart file is broken." << std::endl;
           exit(EXIT_FAILURE);
         }
-        myoffset += fldcnt*sizeof(Real);
+        myoffset += fldcnt*frsz;
 
-        myoffset += data_size-(x1fptr.size()+x2fptr.size()+x3fptr.size())*sizeof(Real);
+        myoffset += data_size-(x1fptr.size()+x2fptr.size()+x3fptr.size())*frsz;
       } else if (m < pm->nmb_thisrank) {
         // get ptr to x1-face field
         auto x1fptr = Kokkos::subview(fcin.x1f, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
         int fldcnt = x1fptr.size();
 
-        if (resfile.Read_Reals_at(x1fptr.data(), fldcnt, myoffset) != fldcnt) {
+        if (read_reals(x1fptr.data(), fldcnt, myoffset, false) != fldcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                 << std::endl << "Input b0.x1f field not read correctly from rst file, "
                 << "restart file is broken." << std::endl;
           exit(EXIT_FAILURE);
         }
-        myoffset += fldcnt*sizeof(Real);
+        myoffset += fldcnt*frsz;
 
         // get ptr to x2-face field
         auto x2fptr = Kokkos::subview(fcin.x2f, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
         fldcnt = x2fptr.size();
 
-        if (resfile.Read_Reals_at(x2fptr.data(), fldcnt, myoffset) != fldcnt) {
+        if (read_reals(x2fptr.data(), fldcnt, myoffset, false) != fldcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                 << std::endl << "Input b0.x2f field not read correctly from rst file, "
                 << "restart file is broken." << std::endl;
           exit(EXIT_FAILURE);
         }
-        myoffset += fldcnt*sizeof(Real);
+        myoffset += fldcnt*frsz;
 
         // get ptr to x3-face field
         auto x3fptr = Kokkos::subview(fcin.x3f, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
         fldcnt = x3fptr.size();
 
-        if (resfile.Read_Reals_at(x3fptr.data(), fldcnt, myoffset) != fldcnt) {
+        if (read_reals(x3fptr.data(), fldcnt, myoffset, false) != fldcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                 << std::endl << "Input b0.x3f field not read correctly from rst file, "
                 << "restart file is broken." << std::endl;
           exit(EXIT_FAILURE);
         }
-        myoffset += fldcnt*sizeof(Real);
+        myoffset += fldcnt*frsz;
 
-        myoffset += data_size-(x1fptr.size()+x2fptr.size()+x3fptr.size())*sizeof(Real);
+        myoffset += data_size-(x1fptr.size()+x2fptr.size()+x3fptr.size())*frsz;
       }
     }
     Kokkos::deep_copy(Kokkos::subview(pmhd->b0.x1f, std::make_pair(0,nmb), Kokkos::ALL,
@@ -465,9 +638,9 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
                       Kokkos::ALL, Kokkos::ALL), fcin.x2f);
     Kokkos::deep_copy(Kokkos::subview(pmhd->b0.x3f, std::make_pair(0,nmb), Kokkos::ALL,
                       Kokkos::ALL, Kokkos::ALL), fcin.x3f);
-    offset_myrank += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
-    offset_myrank += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
-    offset_myrank += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
+    offset_myrank += (nout1+1)*nout2*nout3*frsz;    // mhd b0.x1f
+    offset_myrank += nout1*(nout2+1)*nout3*frsz;    // mhd b0.x2f
+    offset_myrank += nout1*nout2*(nout3+1)*frsz;    // mhd b0.x3f
     myoffset = offset_myrank;
   }
 
@@ -480,7 +653,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                      Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at_all(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, true) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC rad data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -494,7 +667,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                      Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, false) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC rad data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -505,7 +678,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     }
     Kokkos::deep_copy(Kokkos::subview(prad->i0, std::make_pair(0,nmb), Kokkos::ALL,
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
-    offset_myrank += nout1*nout2*nout3*nrad*sizeof(Real);   // radiation i0
+    offset_myrank += nout1*nout2*nout3*nrad*frsz;   // radiation i0
     myoffset = offset_myrank;
   }
 
@@ -518,7 +691,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                      Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at_all(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, true) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC turb data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -532,7 +705,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                      Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, false) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC turb data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -543,7 +716,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     }
     Kokkos::deep_copy(Kokkos::subview(pturb->force, std::make_pair(0,nmb), Kokkos::ALL,
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
-    offset_myrank += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
+    offset_myrank += nout1*nout2*nout3*nforce*frsz; // forcing
     myoffset = offset_myrank;
   }
 
@@ -556,7 +729,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                      Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at_all(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, true) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC z4c data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -570,7 +743,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                      Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, false) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC z4c data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -581,7 +754,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     }
     Kokkos::deep_copy(Kokkos::subview(pz4c->u0, std::make_pair(0,nmb), Kokkos::ALL,
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
-    offset_myrank += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
+    offset_myrank += nout1*nout2*nout3*nz4c*frsz;   // z4c u0
     myoffset = offset_myrank;
 
     // We also need to reinitialize the ADM data.
@@ -595,7 +768,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                      Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at_all(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, true) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC adm data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -609,7 +782,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                                      Kokkos::ALL);
         int mbcnt = mbptr.size();
-        if (resfile.Read_Reals_at(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+        if (read_reals(mbptr.data(), mbcnt, myoffset, false) != mbcnt) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                     << std::endl << "CC adm data not read correctly from rst file, "
                     << "restart file is broken." << std::endl;
@@ -620,10 +793,14 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     }
     Kokkos::deep_copy(Kokkos::subview(padm->u_adm, std::make_pair(0,nmb), Kokkos::ALL,
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
-    offset_myrank += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
+    offset_myrank += nout1*nout2*nout3*nadm*frsz;   // adm u_adm
     myoffset = offset_myrank;
   }
 
+  // release the mapping and/or aggregated payload slice, if made
+  resfile.UnmapRead();
+  delete [] agg_data;
+
   // call problem generator again to re-initialize data, fn ptrs, as needed
 #if USER_PROBLEM_ENABLED
   UserProblem(pin, true);
@@ -658,6 +835,10 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     SphericalCollapse(pin, true);
   } else if (pgen_fun_name.compare("diffusion") == 0) {
     Diffusion(pin, true);
+  // chain entries for pgens compiled into the registry (as in constructor above)
+#define PGEN_REGISTRY_RESTART true
+#include "pgen_registry_dispatch.hpp"
+#undef PGEN_REGISTRY_RESTART
   } else {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
         << "Problem generator name could not be found in <problem> block in input file"
@@ -698,3 +879,86 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     }
   }
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void ProblemGenerator::EnrollDerivedVariable()
+//! \brief Enrolls a derived output quantity computed by a user-supplied function, making
+//! 'name' a valid entry in the variable list of <output> blocks.  'depends' is a
+//! comma-separated list of physics modules the quantity reads (e.g. "mhd"), checked
+//! here so a bad input file fails at startup rather than inside a kernel at the first
+//! dump.  Called from UserProblem(), before the Outputs constructor runs.
+
+void ProblemGenerator::EnrollDerivedVariable(std::string name, std::string depends,
+                                             UserDerivedFnPtr func) {
+  // check for duplicate enrollment
+  for (auto &udv : user_dvars) {
+    if (name.compare(udv.name) == 0) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Derived variable '" << name
+                << "' enrolled more than once." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  // check that the physics modules this quantity depends on are constructed
+  MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
+  std::string rem = depends;
+  while (!(rem.empty())) {
+    std::string::size_type pos = rem.find(',');
+    std::string tok = rem.substr(0, pos);
+    if (pos == std::string::npos) {
+      rem.clear();
+    } else {
+      rem.erase(0, pos+1);
+    }
+    std::string::size_type tb = tok.find_first_not_of(' ');
+    std::string::size_type te = tok.find_last_not_of(' ');
+    tok = (tb == std::string::npos)? "" : tok.substr(tb, te-tb+1);
+    if (tok.empty()) {continue;}
+
+    bool present = false;
+    if        (tok.compare("hydro") == 0)     {present = (pmbp->phydro != nullptr);
+    } else if (tok.compare("mhd") == 0)       {present = (pmbp->pmhd != nullptr);
+    } else if (tok.compare("rad") == 0)       {present = (pmbp->prad != nullptr);
+    } else if (tok.compare("z4c") == 0)       {present = (pmbp->pz4c != nullptr);
+    } else if (tok.compare("adm") == 0)       {present = (pmbp->padm != nullptr);
+    } else if (tok.compare("particles") == 0) {present = (pmbp->ppart != nullptr);
+    } else {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Derived variable '" << name
+                << "' lists unknown dependency '" << tok << "'." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if (!present) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Derived variable '" << name << "' requires the '"
+                << tok << "' module, which is not constructed for this problem."
+                << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  user_dvars.emplace_back(name, depends, func);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ProblemGenerator::EnrollInSituAnalysis()
+//! \brief Enrolls an in-situ analysis plugin, run at the cadence of <output> blocks with
+//! file_type=insitu.  The function fills a HistoryData with rank-local sums computed by
+//! its own device-side reductions; results are reduced across ranks and appended to
+//! "file_basename.<name>.hst".  Called from UserProblem(), before the Outputs
+//! constructor runs.
+
+void ProblemGenerator::EnrollInSituAnalysis(std::string name, UserHistoryFnPtr func) {
+  for (auto &plugin : user_analysis) {
+    if (name.compare(plugin.name) == 0) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "In-situ analysis plugin '" << name
+                << "' enrolled more than once." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  user_analysis.emplace_back(name, func);
+  return;
+}
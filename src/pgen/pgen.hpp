@@ -10,6 +10,7 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "geodesic-grid/spherical_grid.hpp"
@@ -20,6 +21,38 @@ using UserBoundaryFnPtr = void (*)(Mesh* pm);
 using UserSrctermFnPtr = void (*)(Mesh* pm, const Real bdt);
 using UserRefinementFnPtr = void (*)(MeshBlockPack* pmbp);
 using UserHistoryFnPtr = void (*)(HistoryData *pdata, Mesh *pm);
+using UserDerivedFnPtr = void (*)(MeshBlockPack *pmbp, DvceArray5D<DiagReal> &dvar,
+                                  const int islot);
+
+//----------------------------------------------------------------------------------------
+//! \struct InSituAnalysisPlugin
+//  \brief in-situ analysis quantity enrolled at runtime by a problem generator.  The
+//  enrolled function has the same signature as user history functions: it is called at
+//  the cadence of an <output> block with file_type=insitu, performs its own device-side
+//  reductions over the (device-resident) MeshBlockPack arrays, and fills a HistoryData
+//  with rank-local sums.  Results are reduced across ranks and appended to
+//  "file_basename.<name>.hst" by the output system
+
+struct InSituAnalysisPlugin {
+  std::string name;     // used in the output filename
+  UserHistoryFnPtr func;
+  InSituAnalysisPlugin(std::string n, UserHistoryFnPtr f) : name(n), func(f) {}
+};
+
+//----------------------------------------------------------------------------------------
+//! \struct UserDerivedVariable
+//  \brief derived output quantity enrolled at runtime by a problem generator.  The
+//  enrolled function is called by BaseTypeOutput::ComputeDerivedVariable() whenever
+//  'name' appears in the variable list of an <output> block, and must launch kernel(s)
+//  filling slot 'islot' of the derived_var array over all MeshBlocks and active zones
+
+struct UserDerivedVariable {
+  std::string name;     // variable name accepted in <output> blocks
+  std::string depends;  // comma-separated physics modules required (e.g. "hydro,mhd")
+  UserDerivedFnPtr func;
+  UserDerivedVariable(std::string n, std::string d, UserDerivedFnPtr f) :
+    name(n), depends(d), func(f) {}
+};
 
 //----------------------------------------------------------------------------------------
 //! \class ProblemGenerator
@@ -53,6 +86,18 @@ class ProblemGenerator {
   UserRefinementFnPtr user_ref_func=nullptr;
   UserHistoryFnPtr user_hist_func=nullptr;
 
+  // derived output quantities enrolled by EnrollDerivedVariable().  Names are accepted
+  // in <output> blocks alongside the built-in choices; the output system assigns each
+  // a slot in its derived_var array and calls the enrolled function to fill it
+  std::vector<UserDerivedVariable> user_dvars;
+  void EnrollDerivedVariable(std::string name, std::string depends,
+                             UserDerivedFnPtr func);
+
+  // in-situ analysis plugins enrolled by EnrollInSituAnalysis(), run at the cadence of
+  // <output> blocks with file_type=insitu (see InSituAnalysisOutput)
+  std::vector<InSituAnalysisPlugin> user_analysis;
+  void EnrollInSituAnalysis(std::string name, UserHistoryFnPtr func);
+
   // predefined problem generator functions (default test suite)
   void Advection(ParameterInput *pin, const bool restart);
   void AlfvenWave(ParameterInput *pin, const bool restart);
@@ -69,8 +114,17 @@ class ProblemGenerator {
   void SphericalCollapse(ParameterInput *pin, const bool restart);
   void Diffusion(ParameterInput *pin, const bool restart);
 
-  // template for user-specified problem generator
+  // template for user-specified problem generator.  When a pgen file is compiled into
+  // the registry (-D PGEN_REGISTRY), its translation unit defines UserProblem as a macro
+  // renaming this function to UserProblem_<file>, so the un-renamed declaration must be
+  // suppressed there to avoid a duplicate member declaration.
+#ifndef UserProblem
   void UserProblem(ParameterInput *pin, const bool restart);
+#endif
+
+  // renamed UserProblem() entry points for registry pgens (generated by CMake; empty
+  // unless '-D PGEN_REGISTRY=file1;file2;...' was given at configure time)
+#include "pgen_registry_decls.hpp"
 
  private:
   Mesh* pmy_mesh_;
@@ -7,8 +7,11 @@
 //! \brief implementation of Radiation class constructor and assorted other functions
 
 #include <float.h>
+#include <math.h>
 
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include "athena.hpp"
@@ -17,6 +20,7 @@
 #include "eos/eos.hpp"
 #include "srcterms/srcterms.hpp"
 #include "bvals/bvals.hpp"
+#include "utils/memory_accounting.hpp"
 #include "coordinates/coordinates.hpp"
 #include "geodesic-grid/geodesic_grid.hpp"
 #include "units/units.hpp"
@@ -29,6 +33,7 @@ namespace radiation {
 Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
     pmy_pack(ppack),
     i0("i0",1,1,1,1,1),
+    moments_coord("moments_coord",1,1,1,1,1),
     i1("i1",1,1,1,1,1),
     iflx("iflx",1,1,1,1,1),
     divfa("divfa",1,1,1,1,1),
@@ -42,6 +47,8 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
     na("na",1,1,1,1,1,1),
     norm_to_tet("norm_to_tet",1,1,1,1,1,1),
     beam_mask("beam_mask",1,1,1,1,1) {
+  // attribute device allocations made in this constructor to the radiation subsystem
+  memory_accounting::Scope mem_scope("radiation");
   // Check for general relativity
   if (!(pmy_pack->pcoord->is_general_relativistic)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -79,10 +86,27 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
 
   // Set radiation coupling parameters including scattering and absorption opacities,
   // radiation constant, and source term behavior.
+  table_opacity = false;
   if (rad_source) {
     kappa_s = pin->GetReal("radiation","kappa_s");
     power_opacity = pin->GetOrAddBoolean("radiation","power_opacity",false);
-    if (!(power_opacity)) {
+    table_opacity = pin->GetOrAddBoolean("radiation","table_opacity",false);
+    if (power_opacity && table_opacity) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "At most one of <radiation>/power_opacity and "
+        << "<radiation>/table_opacity can be enabled" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (table_opacity) {
+      if (!(are_units_enabled)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Tabulated opacities are indexed by cgs (rho,T) and "
+          << "require enabling units" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      ReadOpacityTable(pin->GetString("radiation","opacity_table"));
+    }
+    if (!(power_opacity) && !(table_opacity)) {
       kappa_a = pin->GetReal("radiation","kappa_a");
       kappa_p = pin->GetReal("radiation","kappa_p");
     }
@@ -105,6 +129,17 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
   // Check for fluid evolution
   fixed_fluid = pin->GetOrAddBoolean("radiation","fixed_fluid",false);
 
+  // Reduced speed of light factor (RSLA).  Scales the transport speed (spatial and
+  // angular fluxes) and the per-step source coupling by the same fraction, preserving
+  // radiative equilibria while relaxing the light-crossing timestep limit
+  reduced_c = pin->GetOrAddReal("radiation","reduced_c",1.0);
+  if (reduced_c <= 0.0 || reduced_c > 1.0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "<radiation>/reduced_c must satisfy 0 < reduced_c <= 1, but "
+      << "reduced_c=" << reduced_c << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   // Other rad source terms (constructor parses input file to init only srcterms needed)
   beam_source = pin->GetOrAddBoolean("radiation","beam_source",false);
   psrc = new SourceTerms("radiation", ppack, pin);
@@ -132,6 +167,8 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
   if (angular_fluxes) {Kokkos::realloc(na,nmb,prgeo->nangles,ncells3,ncells2,ncells1,6);}
   if (is_hydro_enabled || is_mhd_enabled) {
     Kokkos::realloc(norm_to_tet,nmb,4,4,ncells3,ncells2,ncells1);
+    Kokkos::realloc(g_dd_c,nmb,6,ncells3,ncells2,ncells1);
+    Kokkos::realloc(alpha_c,nmb,ncells3,ncells2,ncells1);
   }
   }
   SetOrthonormalTetrad();
@@ -157,10 +194,22 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
     Kokkos::realloc(coarse_i0,nmb,prgeo->nangles,nccells3,nccells2,nccells1);
   }
 
-  // allocate boundary buffers for conserved (cell-centered) variables
-  pbval_i = new MeshBoundaryValuesCC(ppack, pin, false);
+  // allocate boundary buffers for conserved (cell-centered) variables.  Optional
+  // <radiation>/nghost_comm exchanges fewer ghost cells than <mesh>/nghost when the
+  // mesh width is set by a more demanding module; it must cover the intensity stencil
+  pbval_i = new MeshBoundaryValuesCC(ppack, pin, false,
+                                pin->GetOrAddInteger("radiation", "nghost_comm", -1));
   pbval_i->InitializeBuffers(prgeo->nangles);
 
+  // Optionally restrict the intensity boundary buffers to the hemisphere of angles
+  // propagating across each face (by far the largest message volume in radiation-MHD
+  // runs).  Ghost values of excluded angles are never updated; they only enter the
+  // limited reconstruction slopes of the first interior cell, so the default is off
+  hemisphere_bvals = pin->GetOrAddBoolean("radiation","hemisphere_bvals",false);
+  if (hemisphere_bvals) {
+    SetHemisphereMasks();
+  }
+
   // for time-evolving problems, continue to construct methods, allocate arrays
   if (evolution_t.compare("stationary") != 0) {
     // select reconstruction method (default PLM)
@@ -211,6 +260,64 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::ReadOpacityTable()
+//! \brief reads tabulated Rosseland and Planck absorption opacities and stores them on
+//! device for inline lookups in the source kernel (see OpacityTableLookup).  The file
+//! is whitespace-separated ASCII: a header of
+//!     nrho  ntemp  log10(rho_min)  log10(rho_max)  log10(T_min)  log10(T_max)
+//! (cgs; uniform log spacing) followed by nrho*ntemp pairs of kappa_Rosseland and
+//! kappa_Planck in cm^2/g, with the temperature index varying fastest.  Lines starting
+//! with '#' are skipped.  Opacities are stored as log10 for log-log interpolation.
+
+void Radiation::ReadOpacityTable(std::string fname) {
+  std::ifstream file(fname);
+  if (!(file.is_open())) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Cannot open opacity table file '" << fname << "'" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // strip comment lines, then parse the concatenated stream
+  std::stringstream data;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (!(line.empty()) && (line[0] == '#')) {continue;}
+    data << line << '\n';
+  }
+
+  Real lrho_max, ltemp_max;
+  if (!(data >> otable.nrho >> otable.ntemp >> otable.lrho_min >> lrho_max
+             >> otable.ltemp_min >> ltemp_max) ||
+      (otable.nrho < 2) || (otable.ntemp < 2) ||
+      !(lrho_max > otable.lrho_min) || !(ltemp_max > otable.ltemp_min)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Error in header of opacity table file '" << fname << "'"
+      << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  otable.inv_dlrho  = (otable.nrho  - 1)/(lrho_max  - otable.lrho_min);
+  otable.inv_dltemp = (otable.ntemp - 1)/(ltemp_max - otable.ltemp_min);
+
+  Kokkos::realloc(otable.lkappa, otable.nrho, otable.ntemp, 2);
+  for (int ir=0; ir<otable.nrho; ++ir) {
+    for (int it=0; it<otable.ntemp; ++it) {
+      Real k_r, k_p;
+      if (!(data >> k_r >> k_p) || !(k_r > 0.0) || !(k_p > 0.0)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Error reading entry (" << ir << "," << it << ") of "
+          << "opacity table file '" << fname << "'" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      otable.lkappa.h_view(ir,it,0) = log10(k_r);
+      otable.lkappa.h_view(ir,it,1) = log10(k_p);
+    }
+  }
+  otable.lkappa.template modify<HostMemSpace>();
+  otable.lkappa.template sync<DevExeSpace>();
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 // destructor
 
@@ -16,6 +16,7 @@
 #include "parameter_input.hpp"
 #include "tasklist/task_list.hpp"
 #include "bvals/bvals.hpp"
+#include "radiation/radiation_opacities.hpp"
 
 // forward declarations
 class EquationOfState;
@@ -102,6 +103,17 @@ class Radiation {
   bool power_opacity;       // flag to enable Kramer's law opacity for kappa_a
   bool is_compton_enabled;  // flag to enable/disable compton
 
+  // tabulated (rho,T) absorption opacities: a device-resident log-log table evaluated
+  // inline in the source kernel (see OpacityTableLookup); scattering stays constant
+  bool table_opacity;       // flag to enable tabulated opacities
+  OpacityTableData otable;  // device-resident opacity table
+  void ReadOpacityTable(std::string fname);
+
+  // Reduced speed of light (RSLA).  Fraction (<=1) multiplying the transport speed and
+  // the per-step matter coupling; relaxes the light-crossing timestep limit for
+  // non-relativistic problems at the cost of slower radiation equilibration
+  Real reduced_c;
+
   // Extra physics (i.e., other srcterms)
   bool beam_source;
   SourceTerms *psrc = nullptr;
@@ -122,15 +134,31 @@ class Radiation {
   DvceArray5D<Real> tet_d3_x3f;       // tetrad components (subset) at x3f
   DvceArray6D<Real> na;               // n^a
   DvceArray6D<Real> norm_to_tet;      // used in transform b/w normal frame and tet frame
+  // stationary-spacetime metric cache consumed by the source term kernel; components
+  // stored as (g_11,g_12,g_13,g_22,g_23,g_33).  Built once in SetOrthonormalTetrad()
+  DvceArray5D<Real> g_dd_c;           // spatial metric components at cell centers
+  DvceArray4D<Real> alpha_c;          // lapse at cell centers
   void SetOrthonormalTetrad();
 
   // intensity arrays
   DvceArray5D<Real> i0;         // intensities
   DvceArray5D<Real> coarse_i0;  // intensities on 2x coarser grid (for SMR/AMR)
 
+  // coordinate-frame radiation moments (10 symmetric components R^00,R^01,...,R^33),
+  // assembled from i0 at most once per cycle and shared by every consumer instead of
+  // each repeating the O(ncells*nangles) reduction; allocated on first use
+  DvceArray5D<Real> moments_coord;
+  void ComputeMoments();
+
   // Boundary communication buffers and functions for i
   MeshBoundaryValuesCC *pbval_i;
 
+  // Hemispheric ghost-zone exchange.  Upwinding means a face only consumes the angles
+  // propagating across it, so the intensity boundary buffers can ship roughly half of
+  // the angular grid per face; see SetHemisphereMasks()
+  bool hemisphere_bvals;
+  void SetHemisphereMasks();
+
   // following only used for time-evolving flow
   DvceArray5D<Real> i1;         // intensity at intermediate step
   DvceFaceFld5D<Real> iflx;     // spatial fluxes on zone faces
@@ -167,6 +195,7 @@ class Radiation {
 
  private:
   MeshBlockPack* pmy_pack;  // ptr to MeshBlockPack containing this Radiation
+  int moments_cycle_ = -1;  // cycle at which moments_coord was last assembled
 };
 
 } // namespace radiation
@@ -5,6 +5,12 @@
 //========================================================================================
 //! \file radiation_fluxes.cpp
 //  \brief Calculate 3D fluxes for radiation
+//
+//  Flux kernels are tiled over teams: all angles at a given cell share the same tetrad
+//  and geometry data, so each team stages the face tetrad components and the inverse of
+//  tet_c for one (m,k,j) row in scratch once, then sweeps every angle over the staged
+//  row.  With O(100) angles on the geodesic grid this removes nearly all of the
+//  redundant geometry traffic (and the per-angle divides) of a flat (m,n,k,j,i) loop.
 
 #include <float.h>
 
@@ -31,179 +37,256 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
   int &ks = indcs.ks, &ke = indcs.ke;
   int nang1 = prgeo->nangles - 1;
   int nmb1 = pmy_pack->nmb_thispack - 1;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  int nang = nang1 + 1;
 
   const auto &recon_method_ = recon_method;
 
   auto &i0_ = i0;
   auto &nh_c_ = nh_c;
   auto &tet_c_ = tet_c;
+  Real &reduced_c_ = reduced_c;  // transport speed fraction (RSLA); 1 is full speed
 
   //--------------------------------------------------------------------------------------
   // i-direction
 
+  size_t scr_size = ScrArray2D<Real>::shmem_size(4, ncells1) +
+                    ScrArray1D<Real>::shmem_size(ncells1);
+  int scr_level = 0;
+  int nface1 = ie + 1 - is + 1;
+
   auto &t1d1 = tet_d1_x1f;
   auto &flx1 = iflx.x1f;
-  par_for("rflux_x1",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie+1,
-  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
-    // calculate n^1 (hence determining upwinding direction)
-    Real n1 = t1d1(m,0,k,j,i)*nh_c_.d_view(n,0) + t1d1(m,1,k,j,i)*nh_c_.d_view(n,1)
-            + t1d1(m,2,k,j,i)*nh_c_.d_view(n,2) + t1d1(m,3,k,j,i)*nh_c_.d_view(n,3);
-
-    // convert to primitive n_0 I
-    Real iim1, iicc, iim2, iip1, iim3, iip2;
-    iim1 = i0_(m,n,k,j,i-1)/tet_c_(m,0,0,k,j,i-1);
-    iicc = i0_(m,n,k,j,i  )/tet_c_(m,0,0,k,j,i  );
-    if (recon_method_ > 0) {
-      iim2 = i0_(m,n,k,j,i-2)/tet_c_(m,0,0,k,j,i-2);
-      iip1 = i0_(m,n,k,j,i+1)/tet_c_(m,0,0,k,j,i+1);
-    }
-    if (recon_method_ > 1) {
-      iim3 = i0_(m,n,k,j,i-3)/tet_c_(m,0,0,k,j,i-3);
-      iip2 = i0_(m,n,k,j,i+2)/tet_c_(m,0,0,k,j,i+2);
-    }
-
-    // reconstruct primitive intensity
-    Real iiu, scr;
-    switch (recon_method_) {
-      case ReconstructionMethod::dc:
-        if (n1 > 0.0) iiu = iim1;
-        else          iiu = iicc;
-        break;
-      case ReconstructionMethod::plm:
-        if (n1 > 0.0) PLM(iim2, iim1, iicc, iiu, scr);
-        else          PLM(iim1, iicc, iip1, scr, iiu);
-        break;
-      case ReconstructionMethod::ppm4:
-        if (n1 > 0.0) PPM4(iim3, iim2, iim1, iicc, iip1, iiu, scr);
-        else          PPM4(iim2, iim1, iicc, iip1, iip2, scr, iiu);
-        break;
-      case ReconstructionMethod::ppmx:
-        if (n1 > 0.0) PPMX(iim3, iim2, iim1, iicc, iip1, iiu, scr);
-        else          PPMX(iim2, iim1, iicc, iip1, iip2, scr, iiu);
-        break;
-      case ReconstructionMethod::wenoz:
-        if (n1 > 0.0) WENOZ(iim3, iim2, iim1, iicc, iip1, iiu, scr);
-        else          WENOZ(iim2, iim1, iicc, iip1, iip2, scr, iiu);
-        break;
-      default:
-        break;
-    }
-
-    // compute x1flux
-    flx1(m,n,k,j,i) = n1*iiu;
-  });
-
-  //--------------------------------------------------------------------------------------
-  // j-direction
+  par_for_outer("rflux_x1",DevExeSpace(),scr_size,scr_level,0,nmb1,ks,ke,js,je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    // stage face tetrad components and inverse tet_c for this row; identical for
+    // every angle swept below
+    ScrArray2D<Real> td(member.team_scratch(scr_level), 4, ncells1);
+    ScrArray1D<Real> itc(member.team_scratch(scr_level), ncells1);
+    par_for_inner(member, 0, ncells1-1, [&](const int i) {
+      if ((i >= is) && (i <= ie+1)) {
+        td(0,i) = t1d1(m,0,k,j,i);
+        td(1,i) = t1d1(m,1,k,j,i);
+        td(2,i) = t1d1(m,2,k,j,i);
+        td(3,i) = t1d1(m,3,k,j,i);
+      }
+      itc(i) = 1.0/tet_c_(m,0,0,k,j,i);
+    });
+    member.team_barrier();
 
-  if (pmy_pack->pmesh->multi_d) {
-    auto &t2d2 = tet_d2_x2f;
-    auto &flx2 = iflx.x2f;
-    par_for("rflux_x2",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je+1,is,ie,
-    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
-      // calculate n^2 (hence determining upwinding direction)
-      Real n2 = t2d2(m,0,k,j,i)*nh_c_.d_view(n,0) + t2d2(m,1,k,j,i)*nh_c_.d_view(n,1)
-              + t2d2(m,2,k,j,i)*nh_c_.d_view(n,2) + t2d2(m,3,k,j,i)*nh_c_.d_view(n,3);
+    par_for_inner(member, 0, (nang*nface1)-1, [&](const int idx) {
+      int n = idx/nface1;
+      int i = idx%nface1 + is;
+      // calculate n^1 (hence determining upwinding direction)
+      Real n1 = td(0,i)*nh_c_.d_view(n,0) + td(1,i)*nh_c_.d_view(n,1)
+              + td(2,i)*nh_c_.d_view(n,2) + td(3,i)*nh_c_.d_view(n,3);
 
       // convert to primitive n_0 I
       Real iim1, iicc, iim2, iip1, iim3, iip2;
-      iim1 = i0_(m,n,k,j-1,i)/tet_c_(m,0,0,k,j-1,i);
-      iicc = i0_(m,n,k,j  ,i)/tet_c_(m,0,0,k,j  ,i);
+      iim1 = i0_(m,n,k,j,i-1)*itc(i-1);
+      iicc = i0_(m,n,k,j,i  )*itc(i  );
       if (recon_method_ > 0) {
-        iim2 = i0_(m,n,k,j-2,i)/tet_c_(m,0,0,k,j-2,i);
-        iip1 = i0_(m,n,k,j+1,i)/tet_c_(m,0,0,k,j+1,i);
+        iim2 = i0_(m,n,k,j,i-2)*itc(i-2);
+        iip1 = i0_(m,n,k,j,i+1)*itc(i+1);
       }
       if (recon_method_ > 1) {
-        iim3 = i0_(m,n,k,j-3,i)/tet_c_(m,0,0,k,j-3,i);
-        iip2 = i0_(m,n,k,j+2,i)/tet_c_(m,0,0,k,j+2,i);
+        iim3 = i0_(m,n,k,j,i-3)*itc(i-3);
+        iip2 = i0_(m,n,k,j,i+2)*itc(i+2);
       }
 
       // reconstruct primitive intensity
       Real iiu, scr;
       switch (recon_method_) {
         case ReconstructionMethod::dc:
-          if (n2 > 0.0) iiu = iim1;
+          if (n1 > 0.0) iiu = iim1;
           else          iiu = iicc;
           break;
         case ReconstructionMethod::plm:
-          if (n2 > 0.0) PLM(iim2, iim1, iicc, iiu, scr);
+          if (n1 > 0.0) PLM(iim2, iim1, iicc, iiu, scr);
           else          PLM(iim1, iicc, iip1, scr, iiu);
           break;
         case ReconstructionMethod::ppm4:
-          if (n2 > 0.0) PPM4(iim3, iim2, iim1, iicc, iip1, iiu, scr);
+          if (n1 > 0.0) PPM4(iim3, iim2, iim1, iicc, iip1, iiu, scr);
           else          PPM4(iim2, iim1, iicc, iip1, iip2, scr, iiu);
           break;
         case ReconstructionMethod::ppmx:
-          if (n2 > 0.0) PPMX(iim3, iim2, iim1, iicc, iip1, iiu, scr);
+          if (n1 > 0.0) PPMX(iim3, iim2, iim1, iicc, iip1, iiu, scr);
           else          PPMX(iim2, iim1, iicc, iip1, iip2, scr, iiu);
           break;
         case ReconstructionMethod::wenoz:
-          if (n2 > 0.0) WENOZ(iim3, iim2, iim1, iicc, iip1, iiu, scr);
+          if (n1 > 0.0) WENOZ(iim3, iim2, iim1, iicc, iip1, iiu, scr);
           else          WENOZ(iim2, iim1, iicc, iip1, iip2, scr, iiu);
           break;
         default:
           break;
       }
 
-      // compute x2flux
-      flx2(m,n,k,j,i) = n2*iiu;
+      // compute x1flux
+      flx1(m,n,k,j,i) = reduced_c_*n1*iiu;
+    });
+  });
+
+  //--------------------------------------------------------------------------------------
+  // j-direction
+
+  if (pmy_pack->pmesh->multi_d) {
+    int nci = ie - is + 1;
+    scr_size = ScrArray2D<Real>::shmem_size(4, ncells1) +
+               ScrArray2D<Real>::shmem_size(6, ncells1);
+    auto &t2d2 = tet_d2_x2f;
+    auto &flx2 = iflx.x2f;
+    par_for_outer("rflux_x2",DevExeSpace(),scr_size,scr_level,0,nmb1,ks,ke,js,je+1,
+    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+      // stage face tetrad components and inverse tet_c for the full j-stencil
+      // (rows clamped at the array edge are staged but never read below)
+      ScrArray2D<Real> td(member.team_scratch(scr_level), 4, ncells1);
+      ScrArray2D<Real> itc(member.team_scratch(scr_level), 6, ncells1);
+      par_for_inner(member, is, ie, [&](const int i) {
+        td(0,i) = t2d2(m,0,k,j,i);
+        td(1,i) = t2d2(m,1,k,j,i);
+        td(2,i) = t2d2(m,2,k,j,i);
+        td(3,i) = t2d2(m,3,k,j,i);
+        for (int s=0; s<=5; ++s) {
+          int jj = j + s - 3;
+          jj = (jj < 0)? 0 : ((jj > ncells2-1)? (ncells2-1) : jj);
+          itc(s,i) = 1.0/tet_c_(m,0,0,k,jj,i);
+        }
+      });
+      member.team_barrier();
+
+      par_for_inner(member, 0, (nang*nci)-1, [&](const int idx) {
+        int n = idx/nci;
+        int i = idx%nci + is;
+        // calculate n^2 (hence determining upwinding direction)
+        Real n2 = td(0,i)*nh_c_.d_view(n,0) + td(1,i)*nh_c_.d_view(n,1)
+                + td(2,i)*nh_c_.d_view(n,2) + td(3,i)*nh_c_.d_view(n,3);
+
+        // convert to primitive n_0 I
+        Real iim1, iicc, iim2, iip1, iim3, iip2;
+        iim1 = i0_(m,n,k,j-1,i)*itc(2,i);
+        iicc = i0_(m,n,k,j  ,i)*itc(3,i);
+        if (recon_method_ > 0) {
+          iim2 = i0_(m,n,k,j-2,i)*itc(1,i);
+          iip1 = i0_(m,n,k,j+1,i)*itc(4,i);
+        }
+        if (recon_method_ > 1) {
+          iim3 = i0_(m,n,k,j-3,i)*itc(0,i);
+          iip2 = i0_(m,n,k,j+2,i)*itc(5,i);
+        }
+
+        // reconstruct primitive intensity
+        Real iiu, scr;
+        switch (recon_method_) {
+          case ReconstructionMethod::dc:
+            if (n2 > 0.0) iiu = iim1;
+            else          iiu = iicc;
+            break;
+          case ReconstructionMethod::plm:
+            if (n2 > 0.0) PLM(iim2, iim1, iicc, iiu, scr);
+            else          PLM(iim1, iicc, iip1, scr, iiu);
+            break;
+          case ReconstructionMethod::ppm4:
+            if (n2 > 0.0) PPM4(iim3, iim2, iim1, iicc, iip1, iiu, scr);
+            else          PPM4(iim2, iim1, iicc, iip1, iip2, scr, iiu);
+            break;
+          case ReconstructionMethod::ppmx:
+            if (n2 > 0.0) PPMX(iim3, iim2, iim1, iicc, iip1, iiu, scr);
+            else          PPMX(iim2, iim1, iicc, iip1, iip2, scr, iiu);
+            break;
+          case ReconstructionMethod::wenoz:
+            if (n2 > 0.0) WENOZ(iim3, iim2, iim1, iicc, iip1, iiu, scr);
+            else          WENOZ(iim2, iim1, iicc, iip1, iip2, scr, iiu);
+            break;
+          default:
+            break;
+        }
+
+        // compute x2flux
+        flx2(m,n,k,j,i) = reduced_c_*n2*iiu;
+      });
     });
   }
 
   //--------------------------------------------------------------------------------------
-  // k-direction. Note order of k,j loops switched
+  // k-direction
 
   if (pmy_pack->pmesh->three_d) {
+    int nci = ie - is + 1;
+    scr_size = ScrArray2D<Real>::shmem_size(4, ncells1) +
+               ScrArray2D<Real>::shmem_size(6, ncells1);
     auto &t3d3 = tet_d3_x3f;
     auto &flx3 = iflx.x3f;
-    par_for("rflux_x3",DevExeSpace(),0,nmb1,0,nang1,ks,ke+1,js,je,is,ie,
-    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
-      // calculate n^3 (hence determining upwinding direction)
-      Real n3 = t3d3(m,0,k,j,i)*nh_c_.d_view(n,0) + t3d3(m,1,k,j,i)*nh_c_.d_view(n,1)
-              + t3d3(m,2,k,j,i)*nh_c_.d_view(n,2) + t3d3(m,3,k,j,i)*nh_c_.d_view(n,3);
+    par_for_outer("rflux_x3",DevExeSpace(),scr_size,scr_level,0,nmb1,ks,ke+1,js,je,
+    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+      // stage face tetrad components and inverse tet_c for the full k-stencil
+      // (rows clamped at the array edge are staged but never read below)
+      ScrArray2D<Real> td(member.team_scratch(scr_level), 4, ncells1);
+      ScrArray2D<Real> itc(member.team_scratch(scr_level), 6, ncells1);
+      par_for_inner(member, is, ie, [&](const int i) {
+        td(0,i) = t3d3(m,0,k,j,i);
+        td(1,i) = t3d3(m,1,k,j,i);
+        td(2,i) = t3d3(m,2,k,j,i);
+        td(3,i) = t3d3(m,3,k,j,i);
+        for (int s=0; s<=5; ++s) {
+          int kk = k + s - 3;
+          kk = (kk < 0)? 0 : ((kk > ncells3-1)? (ncells3-1) : kk);
+          itc(s,i) = 1.0/tet_c_(m,0,0,kk,j,i);
+        }
+      });
+      member.team_barrier();
 
-      // convert to primitive n_0 I
-      Real iim1, iicc, iim2, iip1, iim3, iip2;
-      iim1 = i0_(m,n,k-1,j,i)/tet_c_(m,0,0,k-1,j,i);
-      iicc = i0_(m,n,k  ,j,i)/tet_c_(m,0,0,k  ,j,i);
-      if (recon_method_ > 0) {
-        iim2 = i0_(m,n,k-2,j,i)/tet_c_(m,0,0,k-2,j,i);
-        iip1 = i0_(m,n,k+1,j,i)/tet_c_(m,0,0,k+1,j,i);
-      }
-      if (recon_method_ > 1) {
-        iim3 = i0_(m,n,k-3,j,i)/tet_c_(m,0,0,k-3,j,i);
-        iip2 = i0_(m,n,k+2,j,i)/tet_c_(m,0,0,k+2,j,i);
-      }
+      par_for_inner(member, 0, (nang*nci)-1, [&](const int idx) {
+        int n = idx/nci;
+        int i = idx%nci + is;
+        // calculate n^3 (hence determining upwinding direction)
+        Real n3 = td(0,i)*nh_c_.d_view(n,0) + td(1,i)*nh_c_.d_view(n,1)
+                + td(2,i)*nh_c_.d_view(n,2) + td(3,i)*nh_c_.d_view(n,3);
 
-      // reconstruct primitive intensity
-      Real iiu, scr;
-      switch (recon_method_) {
-        case ReconstructionMethod::dc:
-          if (n3 > 0.0) iiu = iim1;
-          else          iiu = iicc;
-          break;
-        case ReconstructionMethod::plm:
-          if (n3 > 0.0) PLM(iim2, iim1, iicc, iiu, scr);
-          else          PLM(iim1, iicc, iip1, scr, iiu);
-          break;
-        case ReconstructionMethod::ppm4:
-          if (n3 > 0.0) PPM4(iim3, iim2, iim1, iicc, iip1, iiu, scr);
-          else          PPM4(iim2, iim1, iicc, iip1, iip2, scr, iiu);
-          break;
-        case ReconstructionMethod::ppmx:
-          if (n3 > 0.0) PPMX(iim3, iim2, iim1, iicc, iip1, iiu, scr);
-          else          PPMX(iim2, iim1, iicc, iip1, iip2, scr, iiu);
-          break;
-        case ReconstructionMethod::wenoz:
-          if (n3 > 0.0) WENOZ(iim3, iim2, iim1, iicc, iip1, iiu, scr);
-          else          WENOZ(iim2, iim1, iicc, iip1, iip2, scr, iiu);
-          break;
-        default:
-          break;
-      }
+        // convert to primitive n_0 I
+        Real iim1, iicc, iim2, iip1, iim3, iip2;
+        iim1 = i0_(m,n,k-1,j,i)*itc(2,i);
+        iicc = i0_(m,n,k  ,j,i)*itc(3,i);
+        if (recon_method_ > 0) {
+          iim2 = i0_(m,n,k-2,j,i)*itc(1,i);
+          iip1 = i0_(m,n,k+1,j,i)*itc(4,i);
+        }
+        if (recon_method_ > 1) {
+          iim3 = i0_(m,n,k-3,j,i)*itc(0,i);
+          iip2 = i0_(m,n,k+2,j,i)*itc(5,i);
+        }
 
-      // compute x3flux
-      flx3(m,n,k,j,i) = n3*iiu;
+        // reconstruct primitive intensity
+        Real iiu, scr;
+        switch (recon_method_) {
+          case ReconstructionMethod::dc:
+            if (n3 > 0.0) iiu = iim1;
+            else          iiu = iicc;
+            break;
+          case ReconstructionMethod::plm:
+            if (n3 > 0.0) PLM(iim2, iim1, iicc, iiu, scr);
+            else          PLM(iim1, iicc, iip1, scr, iiu);
+            break;
+          case ReconstructionMethod::ppm4:
+            if (n3 > 0.0) PPM4(iim3, iim2, iim1, iicc, iip1, iiu, scr);
+            else          PPM4(iim2, iim1, iicc, iip1, iip2, scr, iiu);
+            break;
+          case ReconstructionMethod::ppmx:
+            if (n3 > 0.0) PPMX(iim3, iim2, iim1, iicc, iip1, iiu, scr);
+            else          PPMX(iim2, iim1, iicc, iip1, iip2, scr, iiu);
+            break;
+          case ReconstructionMethod::wenoz:
+            if (n3 > 0.0) WENOZ(iim3, iim2, iim1, iicc, iip1, iiu, scr);
+            else          WENOZ(iim2, iim1, iicc, iip1, iip2, scr, iiu);
+            break;
+          default:
+            break;
+        }
+
+        // compute x3flux
+        flx3(m,n,k,j,i) = reduced_c_*n3*iiu;
+      });
     });
   }
 
@@ -211,24 +294,41 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
   // Angular Fluxes
 
   if (angular_fluxes) {
-    auto &numn = prgeo->num_neighbors;
-    auto &indn = prgeo->ind_neighbors;
-    auto &arcl = prgeo->arc_lengths;
-    auto &solid_angles_ = prgeo->solid_angles;
+    auto &nboff = prgeo->nbr_offsets;
+    auto &nbind = prgeo->nbr_indices;
+    auto &nbgeo = prgeo->nbr_arc_solid;
 
     auto &na_ = na;
     auto &divfa_ = divfa;
 
-    par_for("rflux_angular",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie,
-    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
-      divfa_(m,n,k,j,i) = 0.0;
-      for (int nb=0; nb<numn.d_view(n); ++nb) {
-        Real flx_edge = na_(m,n,k,j,i,nb) *
-                        ((na_(m,n,k,j,i,nb) < 0.0) ?
-                         i0_(m,indn.d_view(n,nb),k,j,i)/tet_c_(m,0,0,k,j,i) :
-                         i0_(m,n,k,j,i)/tet_c_(m,0,0,k,j,i));
-        divfa_(m,n,k,j,i) += (arcl.d_view(n,nb)*flx_edge/solid_angles_.d_view(n));
-      }
+    int nci = ie - is + 1;
+    scr_size = ScrArray1D<Real>::shmem_size(ncells1);
+    par_for_outer("rflux_angular",DevExeSpace(),scr_size,scr_level,0,nmb1,ks,ke,js,je,
+    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+      // stage inverse tet_c for this row; shared by every angle and edge below
+      ScrArray1D<Real> itc(member.team_scratch(scr_level), ncells1);
+      par_for_inner(member, is, ie, [&](const int i) {
+        itc(i) = 1.0/tet_c_(m,0,0,k,j,i);
+      });
+      member.team_barrier();
+
+      par_for_inner(member, 0, (nang*nci)-1, [&](const int idx) {
+        int n = idx/nci;
+        int i = idx%nci + is;
+        // gather over this angle's packed (CSR) neighbor list; entries are contiguous
+        Real divf = 0.0;
+        int estart = nboff.d_view(n);
+        int eend = nboff.d_view(n+1);
+        for (int e=estart; e<eend; ++e) {
+          int nb = e - estart;
+          Real flx_edge = na_(m,n,k,j,i,nb) *
+                          ((na_(m,n,k,j,i,nb) < 0.0) ?
+                           i0_(m,nbind.d_view(e),k,j,i)*itc(i) :
+                           i0_(m,n,k,j,i)*itc(i));
+          divf += (nbgeo.d_view(e)*flx_edge);
+        }
+        divfa_(m,n,k,j,i) = reduced_c_*divf;
+      });
     });
   }
 
@@ -58,19 +58,28 @@ TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
   auto &numn = prgeo->num_neighbors;
   auto &indn = prgeo->ind_neighbors;
 
-  // find smallest (dx/c) and (dangle/na) in each direction for radiation problems
-  Kokkos::parallel_reduce("RadiationNudt",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx,Real &min_dt1,Real &min_dt2,Real &min_dt3,Real &min_dta) {
-    // compute m,k,j,i indices of thread and call function
-    int m = (idx)/nkji;
-    int k = (idx - m*nkji)/nji;
-    int j = (idx - m*nkji - k*nji)/nx1;
-    int i = (idx - m*nkji - k*nji - j*nx1) + is;
-    k += ks;
-    j += js;
+  // The transport speed is the speed of light, so the spatial timestep limit depends
+  // only on the grid spacing of each MeshBlock; reduce over blocks on the host.  A
+  // full-grid reduction kernel is only needed for the angular timestep limit (dangle/na)
+  // when angular fluxes are active
+  for (int m=0; m<(pmy_pack->nmb_thispack); ++m) {
+    dt1 = std::min(dt1, size.h_view(m).dx1);
+    dt2 = std::min(dt2, size.h_view(m).dx2);
+    dt3 = std::min(dt3, size.h_view(m).dx3);
+  }
 
-    Real tmp_min_dta = (FLT_MAX);
-    if (angular_fluxes_) {
+  if (angular_fluxes_) {
+    Kokkos::parallel_reduce("RadiationNudt",Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
+    KOKKOS_LAMBDA(const int &idx, Real &min_dta) {
+      // compute m,k,j,i indices of thread and call function
+      int m = (idx)/nkji;
+      int k = (idx - m*nkji)/nji;
+      int j = (idx - m*nkji - k*nji)/nx1;
+      int i = (idx - m*nkji - k*nji - j*nx1) + is;
+      k += ks;
+      j += js;
+
+      Real tmp_min_dta = (FLT_MAX);
       for (int n=0; n<=nang1; ++n) {
         // find position at angle center
         Real x = nh_c_.d_view(n,1);
@@ -92,13 +101,9 @@ TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
           }
         }
       }
-    }
-    min_dt1 = fmin((size.d_view(m).dx1), min_dt1);
-    min_dt2 = fmin((size.d_view(m).dx2), min_dt2);
-    min_dt3 = fmin((size.d_view(m).dx3), min_dt3);
-    min_dta = fmin((tmp_min_dta),        min_dta);
-  }, Kokkos::Min<Real>(dt1),  Kokkos::Min<Real>(dt2), Kokkos::Min<Real>(dt3),
-     Kokkos::Min<Real>(dta));
+      min_dta = fmin((tmp_min_dta), min_dta);
+    }, Kokkos::Min<Real>(dta));
+  }
 
   // compute minimum of dt1/dt2/dt3 for 1D/2D/3D problems
   dtnew = dt1;
@@ -106,6 +111,11 @@ TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
   if (pmy_pack->pmesh->three_d) { dtnew = std::min(dtnew, dt3); }
   if (angular_fluxes_) { dtnew = std::min(dtnew, dta); }
 
+  // all limits above assume transport at the speed of light; with a reduced speed of
+  // light the (spatial and angular) transport speeds scale by reduced_c, so the
+  // timestep limit relaxes by the same factor
+  dtnew /= reduced_c;
+
   return TaskStatus::complete;
 }
 } // namespace radiation
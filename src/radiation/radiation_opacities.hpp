@@ -12,6 +12,22 @@
 
 #include "athena.hpp"
 
+//----------------------------------------------------------------------------------------
+//! \struct OpacityTableData
+//! \brief device-resident tabulated opacities on a uniform log10(rho)-log10(T) grid
+//! (cgs).  The Rosseland and Planck absorption opacities are stored interleaved at each
+//! node, dimensioned (nrho, ntemp, 2) with temperature fastest, so one lookup touches
+//! two adjacent contiguous pairs.  Values are log10(kappa [cm^2/g]) and interpolation
+//! is bilinear in log-log space; arguments outside the grid are clamped to its edges
+
+struct OpacityTableData {
+  int nrho=0, ntemp=0;                // number of grid points in each direction
+  Real lrho_min=0.0, ltemp_min=0.0;   // log10 of first grid point in each direction
+  Real inv_dlrho=0.0, inv_dltemp=0.0; // inverse (uniform) grid spacings
+  DualArray3D<Real> lkappa;           // log10 opacity, (irho, itemp, [Ross, Planck])
+  OpacityTableData() : lkappa("otable",1,1,1) {}
+};
+
 //----------------------------------------------------------------------------------------
 //! \fn void OpacityFunction
 //! \brief sets sigma_a, sigma_s, sigma_p in the comoving frame
@@ -45,4 +61,53 @@ void OpacityFunction(// density and density scale
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void OpacityTableLookup
+//! \brief sets sigma_a, sigma_s, sigma_p in the comoving frame from tabulated (rho,T)
+//! absorption opacities, evaluated inline in the source kernel with a single bilinear
+//! interpolation in log-log space (no searches; the grid is uniform).  As in
+//! OpacityFunction, sigma_p holds the Planck-minus-Rosseland contribution and
+//! scattering is the constant coefficient k_s
+
+KOKKOS_INLINE_FUNCTION
+void OpacityTableLookup(// device-resident opacity table
+                        const OpacityTableData &tab,
+                        // density and density scale
+                        const Real dens, const Real density_scale,
+                        // temperature and temperature scale
+                        const Real temp, const Real temperature_scale,
+                        // length scale and constant scattering coefficient
+                        const Real length_scale, const Real k_s,
+                        // output sigma
+                        Real& sigma_a, Real& sigma_s, Real& sigma_p) {
+  // fractional grid coordinates of (log10 rho, log10 T), clamped to the table edges
+  Real x = (log10(dens*density_scale) - tab.lrho_min)*tab.inv_dlrho;
+  Real y = (log10(temp*temperature_scale) - tab.ltemp_min)*tab.inv_dltemp;
+  x = fmin(fmax(x, 0.0), static_cast<Real>(tab.nrho - 1));
+  y = fmin(fmax(y, 0.0), static_cast<Real>(tab.ntemp - 1));
+  int ir = static_cast<int>(x);
+  int it = static_cast<int>(y);
+  if (ir > (tab.nrho - 2)) {ir = tab.nrho - 2;}
+  if (it > (tab.ntemp - 2)) {it = tab.ntemp - 2;}
+  Real fr = x - ir;
+  Real ft = y - it;
+
+  // bilinear interpolation; the interleaved [Ross, Planck] pairs share the fetches
+  Real lk_r = (1.0-fr)*((1.0-ft)*tab.lkappa.d_view(ir  ,it  ,0)
+                      +      ft *tab.lkappa.d_view(ir  ,it+1,0))
+            +      fr *((1.0-ft)*tab.lkappa.d_view(ir+1,it  ,0)
+                      +      ft *tab.lkappa.d_view(ir+1,it+1,0));
+  Real lk_p = (1.0-fr)*((1.0-ft)*tab.lkappa.d_view(ir  ,it  ,1)
+                      +      ft *tab.lkappa.d_view(ir  ,it+1,1))
+            +      fr *((1.0-ft)*tab.lkappa.d_view(ir+1,it  ,1)
+                      +      ft *tab.lkappa.d_view(ir+1,it+1,1));
+  Real k_a_r = pow(10.0, lk_r);
+  Real k_a_p = pow(10.0, lk_p);
+
+  sigma_a = dens*k_a_r*density_scale*length_scale;
+  sigma_p = dens*(k_a_p - k_a_r)*density_scale*length_scale;
+  sigma_s = dens*k_s*density_scale*length_scale;
+  return;
+}
+
 #endif // RADIATION_RADIATION_OPACITIES_HPP_
@@ -8,9 +8,7 @@
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
 #include "driver/driver.hpp"
-#include "coordinates/cartesian_ks.hpp"
 #include "coordinates/coordinates.hpp"
-#include "coordinates/cell_locations.hpp"
 #include "geodesic-grid/geodesic_grid.hpp"
 #include "eos/eos.hpp"
 #include "hydro/hydro.hpp"
@@ -44,7 +42,6 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
   int &ks = indcs.ks, &ke = indcs.ke;
   int nmb1 = pmy_pack->nmb_thispack - 1;
   int nang1 = prgeo->nangles - 1;
-  auto &size = pmy_pack->pmb->mb_size;
   bool &is_hydro_enabled_ = is_hydro_enabled;
   bool &is_mhd_enabled_ = is_mhd_enabled;
   bool &are_units_enabled_ = are_units_enabled;
@@ -52,10 +49,7 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
   bool &fixed_fluid_ = fixed_fluid;
   bool &affect_fluid_ = affect_fluid;
 
-  // Extract coordinate/excision data
-  auto &coord = pmy_pack->pcoord->coord_data;
-  bool &flat = coord.is_minkowski;
-  Real &spin = coord.bh_spin;
+  // Extract excision data
   bool &excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &rad_mask_ = pmy_pack->pcoord->excision_floor;
   Real &n_0_floor_ = n_0_floor;
@@ -90,10 +84,14 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
   Real &kappa_s_ = kappa_s;
   Real &kappa_p_ = kappa_p;
   bool &power_opacity_ = power_opacity;
+  bool &table_opacity_ = table_opacity;
+  auto &otable_ = otable;
   auto &nh_c_ = nh_c;
   auto &tt = tet_c;
   auto &tc = tetcov_c;
   auto &norm_to_tet_ = norm_to_tet;
+  auto &g_dd_ = g_dd_c;
+  auto &alpha_ = alpha_c;
   auto &solid_angles_ = prgeo->solid_angles;
 
   // Extract hydro/mhd quantities
@@ -106,8 +104,9 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
     w0_ = pmy_pack->pmhd->w0;
   }
 
-  // Extract timestep
-  Real dt_ = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  // Extract timestep, scaled by the reduced speed of light so the matter coupling
+  // advances the radiation field at the same (reduced) rate as the transport step
+  Real dt_ = reduced_c*(pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
 
   // Call ConsToPrim over active zones prior to source term application
   if (!(fixed_fluid_)) {
@@ -120,25 +119,16 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
     }
   }
 
-  // compute implicit source term
-  par_for("radiation_source",DevExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
-  KOKKOS_LAMBDA(int m, int k, int j, int i) {
-    Real &x1min = size.d_view(m).x1min;
-    Real &x1max = size.d_view(m).x1max;
-    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
-
-    Real &x2min = size.d_view(m).x2min;
-    Real &x2max = size.d_view(m).x2max;
-    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
-
-    Real &x3min = size.d_view(m).x3min;
-    Real &x3max = size.d_view(m).x3max;
-    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
-
-    // compute metric and inverse
-    Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
-    Real alpha = sqrt(-1.0/gupper[0][0]);
+  // compute implicit source term.  Each team works on one cell: the angle sums needed
+  // to assemble the moments are team-parallel reductions and the intensity updates are
+  // applied in parallel over angles, while per-cell scalar work (opacities, the quartic
+  // temperature solve) is performed redundantly by every thread of the team
+  int nang = nang1 + 1;
+  par_for_outer("radiation_source",DevExeSpace(),0,0,0,nmb1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(TeamMember_t tmember, int m, int k, int j, int i) {
+    // load cached lapse and spatial metric (set once in SetOrthonormalTetrad(); the
+    // spacetime is stationary, so there is no need to re-evaluate the Kerr metric)
+    Real alpha = alpha_(m,k,j,i);
 
     // fluid state
     Real &wdn = w0_(m,IDN,k,j,i);
@@ -150,20 +140,27 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
     // derived quantities
     Real pgas = gm1*wen;
     Real tgas = pgas/wdn;
-    Real q = glower[1][1]*wvx*wvx + 2.0*glower[1][2]*wvx*wvy + 2.0*glower[1][3]*wvx*wvz
-           + glower[2][2]*wvy*wvy + 2.0*glower[2][3]*wvy*wvz
-           + glower[3][3]*wvz*wvz;
+    Real q = g_dd_(m,0,k,j,i)*wvx*wvx + 2.0*g_dd_(m,1,k,j,i)*wvx*wvy
+           + 2.0*g_dd_(m,2,k,j,i)*wvx*wvz + g_dd_(m,3,k,j,i)*wvy*wvy
+           + 2.0*g_dd_(m,4,k,j,i)*wvy*wvz + g_dd_(m,5,k,j,i)*wvz*wvz;
     Real gamma = sqrt(1.0 + q);
     Real u0 = gamma/alpha;
 
-    // set opacities
+    // set opacities (tabulated opacities are interpolated inline from the device table)
     Real sigma_a, sigma_s, sigma_p;
-    OpacityFunction(wdn, density_scale_,
-                    tgas, temperature_scale_,
-                    length_scale_, gm1, mean_mol_weight_,
-                    power_opacity_, rosseland_coef_, planck_minus_rosseland_coef_,
-                    kappa_a_, kappa_s_, kappa_p_,
-                    sigma_a, sigma_s, sigma_p);
+    if (table_opacity_) {
+      OpacityTableLookup(otable_, wdn, density_scale_,
+                         tgas, temperature_scale_,
+                         length_scale_, kappa_s_,
+                         sigma_a, sigma_s, sigma_p);
+    } else {
+      OpacityFunction(wdn, density_scale_,
+                      tgas, temperature_scale_,
+                      length_scale_, gm1, mean_mol_weight_,
+                      power_opacity_, rosseland_coef_, planck_minus_rosseland_coef_,
+                      kappa_a_, kappa_s_, kappa_p_,
+                      sigma_a, sigma_s, sigma_p);
+    }
     Real dtcsiga = dt_*sigma_a;
     Real dtcsigs = dt_*sigma_s;
     Real dtcsigp = dt_*sigma_p;
@@ -185,11 +182,11 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
     // coordinate component n^0
     Real n0 = tt(m,0,0,k,j,i);
 
-    // Calculate polynomial coefficients
-    Real wght_sum = 0.0;
-    Real suma1 = 0.0;
-    Real suma2 = 0.0;
-    for (int n=0; n<=nang1; ++n) {
+    // Calculate polynomial coefficients.  The angle sums are a team reduction; the
+    // reduced values are broadcast to every thread of the team
+    array_sum::GlobalSum asum;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nang),
+    [&](const int n, array_sum::GlobalSum &tsum) {
       Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
                  tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
       Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
@@ -199,12 +196,13 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
       Real vncsigma = 1.0/(n0 + (dtcsiga + dtcsigs)*n0_cm);
       Real vncsigma2 = n0_cm*vncsigma;
       Real ir_weight = intensity_cm*omega_cm;
-      wght_sum += omega_cm;
-      suma1 += omega_cm*vncsigma2;
-      suma2 += ir_weight*n0*vncsigma;
-    }
-    suma1 /= wght_sum;
-    suma2 /= wght_sum;
+      tsum.the_array[0] += omega_cm;
+      tsum.the_array[1] += omega_cm*vncsigma2;
+      tsum.the_array[2] += ir_weight*n0*vncsigma;
+    }, Kokkos::Sum<array_sum::GlobalSum>(asum));
+    Real wght_sum = asum.the_array[0];
+    Real suma1 = asum.the_array[1]/wght_sum;
+    Real suma2 = asum.the_array[2]/wght_sum;
     Real suma3 = suma1*(dtcsigs - dtcsigp);
     suma1 *= (dtcsiga + dtcsigp);
 
@@ -213,7 +211,8 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
     coef[1] = (dtaucsiga+dtaucsigp-(dtaucsiga+dtaucsigp)*suma1/(1.0-suma3))*arad_*gm1/wdn;
     coef[0] = -tgas-(dtaucsiga+dtaucsigp)*suma2*gm1/(wdn*(1.0-suma3));
 
-    // Calculate new gas temperature
+    // Calculate new gas temperature (computed redundantly by every thread; the root
+    // solve is deterministic, so all threads of the team arrive at the same answer)
     Real tgasnew = tgas;
     bool badcell = false;
     if (fabs(coef[1]) > 1.0e-20) {
@@ -231,8 +230,12 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
       // Calculate emission coefficient and updated jr_cm
       Real emission = arad_*SQR(SQR(tgasnew));
       Real jr_cm = (suma1*emission + suma2)/(1.0 - suma3);
-      Real m_old[4] = {0.0}; Real m_new[4] = {0.0};
-      for (int n=0; n<=nang1; ++n) {
+      // single team-parallel pass over angles: moments before coupling accumulate in
+      // slots 0-3, each angle's intensity is updated exactly once, and moments after
+      // coupling accumulate in slots 4-7
+      array_sum::GlobalSum msum;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nang),
+      [&](const int n, array_sum::GlobalSum &tsum) {
         // compute coordinate normal components
         Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
                  + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
@@ -244,10 +247,10 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
                  + tc(m,2,3,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,3,k,j,i)*nh_c_.d_view(n,3);
 
         // compute moments before coupling
-        m_old[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-        m_old[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_old[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_old[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+        tsum.the_array[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
+        tsum.the_array[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+        tsum.the_array[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+        tsum.the_array[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
 
         // update intensity
         Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
@@ -262,10 +265,10 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
                                      di_cm/(4.0*M_PI*SQR(SQR(n0_cm))), 0.0);
 
         // compute moments after coupling
-        m_new[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-        m_new[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_new[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_new[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+        tsum.the_array[4] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
+        tsum.the_array[5] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+        tsum.the_array[6] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+        tsum.the_array[7] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
 
         // handle excision
         // NOTE(@pdmullen): The below zeroes all intensities within rks <= r_excision and
@@ -277,13 +280,15 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
                                  (!(is_compton_enabled_) && fabs(n_0) < n_0_floor_));
           if (apply_excision) { i0_(m,n,k,j,i) = 0.0; }
         }
-      }
-      // update conserved fluid variables
+      }, Kokkos::Sum<array_sum::GlobalSum>(msum));
+      // update conserved fluid variables (once per cell)
       if (affect_fluid_) {
-        u0_(m,IEN,k,j,i) += (m_old[0] - m_new[0]);
-        u0_(m,IM1,k,j,i) += (m_old[1] - m_new[1]);
-        u0_(m,IM2,k,j,i) += (m_old[2] - m_new[2]);
-        u0_(m,IM3,k,j,i) += (m_old[3] - m_new[3]);
+        Kokkos::single(Kokkos::PerTeam(tmember), [&]() {
+          u0_(m,IEN,k,j,i) += (msum.the_array[0] - msum.the_array[4]);
+          u0_(m,IM1,k,j,i) += (msum.the_array[1] - msum.the_array[5]);
+          u0_(m,IM2,k,j,i) += (msum.the_array[2] - msum.the_array[6]);
+          u0_(m,IM3,k,j,i) += (msum.the_array[3] - msum.the_array[7]);
+        });
       }
     }
 
@@ -293,19 +298,22 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
       tgas = tgasnew;
 
       // compute polynomial coefficients using partially updated gas temp and intensity
-      suma1 = 0.0;
-      Real jr_cm = 0.0;
-      for (int n=0; n<=nang1; ++n) {
+      // (team reduction over angles; the preceding reduction already synchronized the
+      // team, so the intensity updates above are visible here)
+      array_sum::GlobalSum csum;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nang),
+      [&](const int n, array_sum::GlobalSum &tsum) {
         Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
                    tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
         Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
                       u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
         Real wght_cm = solid_angles_.d_view(n)/SQR(n0_cm)/wght_sum;
         Real intensity_cm = 4.0*M_PI*(i0_(m,n,k,j,i)/(n0*n_0))*SQR(SQR(n0_cm));
-        Real ir_weight = intensity_cm*wght_cm;
-        jr_cm += ir_weight;
-        suma1 += (n0_cm/n0)*4.0*dtcsigs*inv_t_electron_*wght_cm;
-      }
+        tsum.the_array[0] += intensity_cm*wght_cm;
+        tsum.the_array[1] += (n0_cm/n0)*4.0*dtcsigs*inv_t_electron_*wght_cm;
+      }, Kokkos::Sum<array_sum::GlobalSum>(csum));
+      Real jr_cm = csum.the_array[0];
+      suma1 = csum.the_array[1];
       suma2 = 4.0*dtaucsigs*inv_t_electron_*gm1/wdn;
 
       // compute partially updated radiation temperature
@@ -328,8 +336,9 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
       if (!(badcell) && !(temp_equil)) {
         // Compute updated gas temperature
         tgasnew = (arad_*SQR(SQR(tradnew)) - jr_cm)/(suma1*jr_cm) + tradnew;
-        Real m_old[4] = {0.0}; Real m_new[4] = {0.0};
-        for (int n=0; n<=nang1; ++n) {
+        array_sum::GlobalSum msum;
+        Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nang),
+        [&](const int n, array_sum::GlobalSum &tsum) {
           // compute coordinate normal components
           Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
                    + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
@@ -341,10 +350,10 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
                    + tc(m,2,3,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,3,k,j,i)*nh_c_.d_view(n,3);
 
           // compute moments before coupling
-          m_old[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-          m_old[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_old[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_old[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+          tsum.the_array[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
+          tsum.the_array[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+          tsum.the_array[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+          tsum.the_array[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
 
           // update intensity
           Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
@@ -354,36 +363,38 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
                                        di_cm/(4.0*M_PI*SQR(SQR(n0_cm))), 0.0);
 
           // compute moments after coupling
-          m_new[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-          m_new[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_new[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_new[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+          tsum.the_array[4] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
+          tsum.the_array[5] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+          tsum.the_array[6] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+          tsum.the_array[7] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
 
           // handle excision (see notes above)
           if (excise) {
             if (rad_mask_(m,k,j,i) || fabs(n_0) < n_0_floor_) { i0_(m,n,k,j,i) = 0.0; }
           }
-        }
+        }, Kokkos::Sum<array_sum::GlobalSum>(msum));
 
-        // feedback on fluid
+        // feedback on fluid (once per cell)
         if (affect_fluid_) {
-          u0_(m,IEN,k,j,i) += (m_old[0] - m_new[0]);
-          u0_(m,IM1,k,j,i) += (m_old[1] - m_new[1]);
-          u0_(m,IM2,k,j,i) += (m_old[2] - m_new[2]);
-          u0_(m,IM3,k,j,i) += (m_old[3] - m_new[3]);
+          Kokkos::single(Kokkos::PerTeam(tmember), [&]() {
+            u0_(m,IEN,k,j,i) += (msum.the_array[0] - msum.the_array[4]);
+            u0_(m,IM1,k,j,i) += (msum.the_array[1] - msum.the_array[5]);
+            u0_(m,IM2,k,j,i) += (msum.the_array[2] - msum.the_array[6]);
+            u0_(m,IM3,k,j,i) += (msum.the_array[3] - msum.the_array[7]);
+          });
         }
       } else {
         // NOTE(@pdmullen): At this point, it is possible that excision has not been
         // entirely applied if Compton is enabled and a badcell or temperature equilibrium
         // was encountered.. apply excision
         if (excise) {
-          for (int n=0; n<=nang1; ++n) {
+          par_for_inner(tmember, 0, nang1, [&](const int n) {
             Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)+
                        tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)+
                        tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)+
                        tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
             if (rad_mask_(m,k,j,i) || fabs(n_0) < n_0_floor_) { i0_(m,n,k,j,i) = 0.0; }
-          }
+          });
         }
       }
     }
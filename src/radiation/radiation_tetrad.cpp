@@ -219,9 +219,13 @@ void Radiation::SetOrthonormalTetrad() {
     });
   }
 
-  // set transformation between normal and tetrad frame
+  // set transformation between normal and tetrad frame.  Also cache the lapse and
+  // spatial metric at cell centers: the spacetime is stationary, so the source term
+  // kernel can read these every stage instead of re-evaluating the Kerr metric
   if (is_hydro_enabled || is_mhd_enabled) {
     auto norm_to_tet_ = norm_to_tet;
+    auto g_dd_c_ = g_dd_c;
+    auto alpha_c_ = alpha_c;
     par_for("norm_to_tet",DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),0,(n1-1),
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real &x1min = size.d_view(m).x1min;
@@ -271,10 +275,103 @@ void Radiation::SetOrthonormalTetrad() {
           }
         }
       }
+
+      // cache lapse and spatial metric for the source term kernel
+      alpha_c_(m,k,j,i) = alpha;
+      g_dd_c_(m,0,k,j,i) = glower[1][1];
+      g_dd_c_(m,1,k,j,i) = glower[1][2];
+      g_dd_c_(m,2,k,j,i) = glower[1][3];
+      g_dd_c_(m,3,k,j,i) = glower[2][2];
+      g_dd_c_(m,4,k,j,i) = glower[2][3];
+      g_dd_c_(m,5,k,j,i) = glower[3][3];
     });
   }
 
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn  void Radiation::SetHemisphereMasks()
+//! \brief restricts the intensity boundary buffers to the hemisphere of angles that
+//! propagate across each MeshBlock face.  An angle is kept for a face if its
+//! coordinate-frame normal component (contracted from the face tetrads) points into
+//! this MeshBlock anywhere on the face, since the upwind flux only consumes ghost
+//! intensities of incoming angles.  Evaluated once from the (stationary) tetrads and
+//! installed in the boundary buffers via SetFaceVarMasksCC().
+
+void Radiation::SetHemisphereMasks() {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is, &ie = indcs.ie;
+  int &js = indcs.js, &je = indcs.je;
+  int &ks = indcs.ks, &ke = indcs.ke;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nang1 = prgeo->nangles - 1;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+
+  DualArray3D<bool> needed("hem_mask",(nmb1+1),6,(nang1+1));
+  auto &nh_c_ = nh_c;
+  auto &t1_ = tet_d1_x1f;
+  auto &t2_ = tet_d2_x2f;
+  auto &t3_ = tet_d3_x3f;
+  par_for("rad_hem_mask",DevExeSpace(),0,nmb1,0,nang1,
+  KOKKOS_LAMBDA(int m, int n) {
+    // extrema of the coordinate-frame normal component n^1 over each x1 face: an angle
+    // enters through the inner (outer) face if n^1 > 0 (< 0) anywhere on it
+    Real x1min_max = -(FLT_MAX), x1max_min = (FLT_MAX);
+    for (int k=ks; k<=ke; ++k) {
+      for (int j=js; j<=je; ++j) {
+        Real ni = 0.0, no = 0.0;
+        for (int d=0; d<4; ++d) {
+          ni += t1_(m,d,k,j,is  )*nh_c_.d_view(n,d);
+          no += t1_(m,d,k,j,ie+1)*nh_c_.d_view(n,d);
+        }
+        x1min_max = fmax(x1min_max, ni);
+        x1max_min = fmin(x1max_min, no);
+      }
+    }
+    needed.d_view(m,BoundaryFace::inner_x1,n) = (x1min_max > 0.0);
+    needed.d_view(m,BoundaryFace::outer_x1,n) = (x1max_min < 0.0);
+
+    Real x2min_max = -(FLT_MAX), x2max_min = (FLT_MAX);
+    if (multi_d) {
+      for (int k=ks; k<=ke; ++k) {
+        for (int i=is; i<=ie; ++i) {
+          Real ni = 0.0, no = 0.0;
+          for (int d=0; d<4; ++d) {
+            ni += t2_(m,d,k,js  ,i)*nh_c_.d_view(n,d);
+            no += t2_(m,d,k,je+1,i)*nh_c_.d_view(n,d);
+          }
+          x2min_max = fmax(x2min_max, ni);
+          x2max_min = fmin(x2max_min, no);
+        }
+      }
+    }
+    needed.d_view(m,BoundaryFace::inner_x2,n) = !(multi_d) || (x2min_max > 0.0);
+    needed.d_view(m,BoundaryFace::outer_x2,n) = !(multi_d) || (x2max_min < 0.0);
+
+    Real x3min_max = -(FLT_MAX), x3max_min = (FLT_MAX);
+    if (three_d) {
+      for (int j=js; j<=je; ++j) {
+        for (int i=is; i<=ie; ++i) {
+          Real ni = 0.0, no = 0.0;
+          for (int d=0; d<4; ++d) {
+            ni += t3_(m,d,ks  ,j,i)*nh_c_.d_view(n,d);
+            no += t3_(m,d,ke+1,j,i)*nh_c_.d_view(n,d);
+          }
+          x3min_max = fmax(x3min_max, ni);
+          x3max_min = fmin(x3max_min, no);
+        }
+      }
+    }
+    needed.d_view(m,BoundaryFace::inner_x3,n) = !(three_d) || (x3min_max > 0.0);
+    needed.d_view(m,BoundaryFace::outer_x3,n) = !(three_d) || (x3max_min < 0.0);
+  });
+  needed.template modify<DevExeSpace>();
+  needed.template sync<HostMemSpace>();
+
+  pbval_i->SetFaceVarMasksCC(needed);
+  return;
+}
+
 } // namespace radiation
@@ -95,4 +95,60 @@ TaskStatus Radiation::RKUpdate(Driver *pdriver, int stage) {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn  void Radiation::ComputeMoments()
+//  \brief assembles the ten symmetric coordinate-frame radiation moments R^{\mu\nu}
+//   from i0, at most once per cycle.  Consumers (derived-variable outputs, problem
+//   generators) read the cached array instead of each repeating the O(ncells*nangles)
+//   reduction; frame transformations are cheap per-cell work applied on top of these.
+//   The array is allocated on first use, so runs that never request moments carry no
+//   memory or compute cost.
+
+void Radiation::ComputeMoments() {
+  if (moments_cycle_ == pmy_pack->pmesh->ncycle) {return;}
+  moments_cycle_ = pmy_pack->pmesh->ncycle;
+
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int n1 = indcs.nx1 + 2*ng;
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng) : 1;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nang1 = prgeo->nangles - 1;
+
+  if (moments_coord.extent_int(0) != (nmb1+1)) {
+    Kokkos::realloc(moments_coord,(nmb1+1),10,n3,n2,n1);
+  }
+
+  auto &nh_c_ = nh_c;
+  auto &tet_c_ = tet_c;
+  auto &tetcov_c_ = tetcov_c;
+  auto &solid_angles_ = prgeo->solid_angles;
+  auto &i0_ = i0;
+  auto &mc = moments_coord;
+  par_for("rad_moments",DevExeSpace(),0,nmb1,0,(n3-1),0,(n2-1),0,(n1-1),
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    // coordinate component n^0
+    Real n0 = tet_c_(m,0,0,k,j,i);
+
+    // set coordinate frame components
+    for (int m1=0, m12=0; m1<4; ++m1) {
+      for (int m2=m1; m2<4; ++m2, ++m12) {
+        Real rmom = 0.0;
+        for (int n=0; n<=nang1; ++n) {
+          Real nmun1 = 0.0; Real nmun2 = 0.0; Real n_0 = 0.0;
+          for (int d=0; d<4; ++d) {
+            nmun1 += tet_c_   (m,d,m1,k,j,i)*nh_c_.d_view(n,d);
+            nmun2 += tet_c_   (m,d,m2,k,j,i)*nh_c_.d_view(n,d);
+            n_0   += tetcov_c_(m,d,0, k,j,i)*nh_c_.d_view(n,d);
+          }
+          rmom += (nmun1*nmun2*(i0_(m,n,k,j,i)/(n0*n_0))*solid_angles_.d_view(n));
+        }
+        mc(m,m12,k,j,i) = rmom;
+      }
+    }
+  });
+  return;
+}
+
 } // namespace radiation
@@ -16,10 +16,11 @@
 //! Therefore range of indices for which BOTH L/R states returned is il+1 to il-1
 //! This function should be called over [is-1,ie+1] to get BOTH L/R states over [is,ie]
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void DonorCellX1(TeamMember_t const &member, const int m, const int k, const int j,
      const int il, const int iu, const DvceArray5D<Real> &q,
-     ScrArray2D<Real> &ql, ScrArray2D<Real> &qr) {
+     ScrArray2D<T> &ql, ScrArray2D<T> &qr) {
   int nvar = q.extent_int(1);
   for (int n=0; n<nvar; ++n) {
     par_for_inner(member, il, iu, [&](const int i) {
@@ -35,10 +36,11 @@ void DonorCellX1(TeamMember_t const &member, const int m, const int k, const int
 //! \brief For each cell-centered value q(j), returns ql(j+1) and qr(j) over il to iu.
 //! This function should be called over [js-1,je+1] to get BOTH L/R states over [js,je]
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void DonorCellX2(TeamMember_t const &member, const int m, const int k, const int j,
      const int il, const int iu, const DvceArray5D<Real> &q,
-     ScrArray2D<Real> &ql_jp1, ScrArray2D<Real> &qr_j) {
+     ScrArray2D<T> &ql_jp1, ScrArray2D<T> &qr_j) {
   int nvar = q.extent_int(1);
   for (int n=0; n<nvar; ++n) {
     par_for_inner(member, il, iu, [&](const int i) {
@@ -54,10 +56,11 @@ void DonorCellX2(TeamMember_t const &member, const int m, const int k, const int
 //! \brief For each cell-centered value q(k), returns ql(k+1) and qr(k) over il to iu.
 //! This function should be called over [ks-1,ke+1] to get BOTH L/R states over [ks,ke]
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void DonorCellX3(TeamMember_t const &member, const int m, const int k, const int j,
      const int il, const int iu, const DvceArray5D<Real> &q,
-     ScrArray2D<Real> &ql_kp1, ScrArray2D<Real> &qr_k) {
+     ScrArray2D<T> &ql_kp1, ScrArray2D<T> &qr_k) {
   int nvar = q.extent_int(1);
   for (int n=0; n<nvar; ++n) {
     par_for_inner(member, il, iu, [&](const int i) {
@@ -67,4 +70,25 @@ void DonorCellX3(TeamMember_t const &member, const int m, const int k, const int
   }
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn DonorCellX3Staged()
+//! \brief Staged variant of DonorCellX3 that reads plane k from a scratch staging tile
+//! filled by the x3 flux kernel, rather than from the global cell-centered array.  The
+//! sc argument is the column offset of plane k within the tile.
+
+template <typename T>
+KOKKOS_INLINE_FUNCTION
+void DonorCellX3Staged(TeamMember_t const &member, const int il, const int iu,
+     const ScrArray2D<T> &q, const int sc,
+     ScrArray2D<T> &ql_kp1, ScrArray2D<T> &qr_k) {
+  int nvar = q.extent_int(0);
+  for (int n=0; n<nvar; ++n) {
+    par_for_inner(member, il, iu, [&](const int i) {
+      ql_kp1(n,i) = q(n,sc+i);
+      qr_k  (n,i) = q(n,sc+i);
+    });
+  }
+  return;
+}
 #endif // RECONSTRUCT_DC_HPP_
@@ -17,22 +17,24 @@
 //! \brief Reconstructs linear slope in cell i to compute ql(i+1) and qr(i). Works for
 //! reconstruction in any dimension by passing in the appropriate q_im1, q_i, and q_ip1.
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void PLM(const Real &q_im1, const Real &q_i, const Real &q_ip1,
-         Real &ql_ip1, Real &qr_i) {
-  // compute L/R slopes
-  Real dql = (q_i - q_im1);
-  Real dqr = (q_ip1 - q_i);
+         T &ql_ip1, T &qr_i) {
+  // compute L/R slopes in the interface-state precision T
+  T dql = static_cast<T>(q_i) - static_cast<T>(q_im1);
+  T dqr = static_cast<T>(q_ip1) - static_cast<T>(q_i);
 
   // Apply limiters for Cartesian-like coordinate with uniform mesh spacing
-  Real dq2 = dql*dqr;
-  Real dqm = dq2/(dql + dqr);
-  //Real dqm = 0.5*fmin(fabs(dql), fabs(dqr));
-  if (dq2 <= 0.0) dqm = 0.0;
+  // Written as a select (not a branch) so the compiler can emit masked SIMD on CPU
+  // builds; when dq2 > 0 the denominator is guaranteed nonzero
+  T dq2 = dql*dqr;
+  T dqm = (dq2 > static_cast<T>(0.0)) ? dq2/(dql + dqr) : static_cast<T>(0.0);
+  //T dqm = 0.5*fmin(fabs(dql), fabs(dqr));
 
   // compute ql_(i+1/2) and qr_(i-1/2) using limited slopes
-  ql_ip1 = q_i + dqm;
-  qr_i   = q_i - dqm;
+  ql_ip1 = static_cast<T>(q_i) + dqm;
+  qr_i   = static_cast<T>(q_i) - dqm;
   return;
 }
 
@@ -41,10 +43,11 @@ void PLM(const Real &q_im1, const Real &q_i, const Real &q_ip1,
 //! \brief Wrapper function for PLM reconstruction in x1-direction.
 //! This function should be called over [is-1,ie+1] to get BOTH L/R states over [is,ie]
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void PiecewiseLinearX1(TeamMember_t const &member, const int m, const int k, const int j,
      const int il, const int iu, const DvceArray5D<Real> &q,
-     ScrArray2D<Real> &ql, ScrArray2D<Real> &qr) {
+     ScrArray2D<T> &ql, ScrArray2D<T> &qr) {
   int nvar = q.extent_int(1);
   for (int n=0; n<nvar; ++n) {
     par_for_inner(member, il, iu, [&](const int i) {
@@ -59,10 +62,11 @@ void PiecewiseLinearX1(TeamMember_t const &member, const int m, const int k, con
 //! \brief Wrapper function for PLM reconstruction in x2-direction.
 //! This function should be called over [js-1,je+1] to get BOTH L/R states over [js,je]
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void PiecewiseLinearX2(TeamMember_t const &member, const int m, const int k, const int j,
      const int il, const int iu, const DvceArray5D<Real> &q,
-     ScrArray2D<Real> &ql_jp1, ScrArray2D<Real> &qr_j) {
+     ScrArray2D<T> &ql_jp1, ScrArray2D<T> &qr_j) {
   int nvar = q.extent_int(1);
   for (int n=0; n<nvar; ++n) {
     par_for_inner(member, il, iu, [&](const int i) {
@@ -77,10 +81,11 @@ void PiecewiseLinearX2(TeamMember_t const &member, const int m, const int k, con
 //! \brief Wrapper function for PLM reconstruction in x3-direction.
 //! This function should be called over [ks-1,ke+1] to get BOTH L/R states over [ks,ke]
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void PiecewiseLinearX3(TeamMember_t const &member, const int m, const int k, const int j,
      const int il, const int iu, const DvceArray5D<Real> &q,
-     ScrArray2D<Real> &ql_kp1, ScrArray2D<Real> &qr_k) {
+     ScrArray2D<T> &ql_kp1, ScrArray2D<T> &qr_k) {
   int nvar = q.extent_int(1);
   for (int n=0; n<nvar; ++n) {
     par_for_inner(member, il, iu, [&](const int i) {
@@ -89,4 +94,25 @@ void PiecewiseLinearX3(TeamMember_t const &member, const int m, const int k, con
   }
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn PiecewiseLinearX3Staged()
+//! \brief Staged variant of PiecewiseLinearX3 that reads the k-stencil from a scratch
+//! staging tile filled by the x3 flux kernel, so each plane of the global array is
+//! loaded once per sweep.  The sm1/sc/sp1 arguments are the column offsets of planes
+//! k-1, k, and k+1 within the tile.
+
+template <typename T>
+KOKKOS_INLINE_FUNCTION
+void PiecewiseLinearX3Staged(TeamMember_t const &member, const int il, const int iu,
+     const ScrArray2D<T> &q, const int sm1, const int sc, const int sp1,
+     ScrArray2D<T> &ql_kp1, ScrArray2D<T> &qr_k) {
+  int nvar = q.extent_int(0);
+  for (int n=0; n<nvar; ++n) {
+    par_for_inner(member, il, iu, [&](const int i) {
+      PLM(q(n,sm1+i), q(n,sc+i), q(n,sp1+i), ql_kp1(n,i), qr_k(n,i));
+    });
+  }
+  return;
+}
 #endif // RECONSTRUCT_PLM_HPP_
@@ -40,9 +40,10 @@
 //! interpolated values at L/R edges of cell i, that is ql(i+1) and qr(i). Works for
 //! reconstruction in any dimension by passing in the appropriate q_im2,...,q _ip2.
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void PPM4(const Real &q_im2, const Real &q_im1, const Real &q_i, const Real &q_ip1,
-          const Real &q_ip2, Real &ql_ip1, Real &qr_i) {
+          const Real &q_ip2, T &ql_ip1, T &qr_i) {
   //---- Interpolate L/R values (CS eqn 16, PH 3.26 and 3.27) ----
   // qlv = q at left  side of cell-center = q[i-1/2] = a_{j,-} in CS
   // qrv = q at right side of cell-center = q[i+1/2] = a_{j,+} in CS
@@ -83,9 +84,10 @@ void PPM4(const Real &q_im2, const Real &q_im1, const Real &q_i, const Real &q_i
 //! interpolated values at L/R edges of cell i, that is ql(i+1) and qr(i). Works for
 //! reconstruction in any dimension by passing in the appropriate q_im2,...,q _ip2.
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void PPMX(const Real &q_im2, const Real &q_im1, const Real &q_i, const Real &q_ip1,
-          const Real &q_ip2, Real &ql_ip1, Real &qr_i) {
+          const Real &q_ip2, T &ql_ip1, T &qr_i) {
   //---- Compute L/R values (CS eqns 12-15, PH 3.26 and 3.27) ----
   // qlv = q at left  side of cell-center = q[i-1/2] = a_{j,-} in CS
   // qrv = q at right side of cell-center = q[i+1/2] = a_{j,+} in CS
@@ -187,11 +189,12 @@ void PPMX(const Real &q_im2, const Real &q_im1, const Real &q_i, const Real &q_i
 //! \brief Wrapper function for PPM reconstruction in x1-direction.
 //! This function should be called over [is-1,ie+1] to get BOTH L/R states over [is,ie]
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void PiecewiseParabolicX1(TeamMember_t const &member,
      const EOS_Data &eos, const bool extremum_preserving, const bool apply_floors,
      const int m, const int k, const int j, const int il, const int iu,
-     const DvceArray5D<Real> &q, ScrArray2D<Real> &ql, ScrArray2D<Real> &qr) {
+     const DvceArray5D<Real> &q, ScrArray2D<T> &ql, ScrArray2D<T> &qr) {
   int nvar = q.extent_int(1);
   const Real &dfloor_ = eos.dfloor;
   // TODO(jmstone): ideal gas only for now
@@ -235,11 +238,12 @@ void PiecewiseParabolicX1(TeamMember_t const &member,
 //! \brief Wrapper function for PPM reconstruction in x2-direction.
 //! This function should be called over [js-1,je+1] to get BOTH L/R states over [js,je]
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void PiecewiseParabolicX2(TeamMember_t const &member,
      const EOS_Data &eos, const bool extremum_preserving, const bool apply_floors,
      const int m, const int k, const int j, const int il, const int iu,
-     const DvceArray5D<Real> &q, ScrArray2D<Real> &ql_jp1, ScrArray2D<Real> &qr_j) {
+     const DvceArray5D<Real> &q, ScrArray2D<T> &ql_jp1, ScrArray2D<T> &qr_j) {
   int nvar = q.extent_int(1);
   const Real &dfloor_ = eos.dfloor;
   // TODO(jmstone): ideal gas only for now
@@ -283,11 +287,12 @@ void PiecewiseParabolicX2(TeamMember_t const &member,
 //! \brief Wrapper function for PPM reconstruction in x3-direction.
 //! This function should be called over [ks-1,ke+1] to get BOTH L/R states over [ks,ke]
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void PiecewiseParabolicX3(TeamMember_t const &member,
      const EOS_Data &eos, const bool extremum_preserving, const bool apply_floors,
      const int m, const int k, const int j, const int il, const int iu,
-     const DvceArray5D<Real> &q, ScrArray2D<Real> &ql_kp1, ScrArray2D<Real> &qr_k) {
+     const DvceArray5D<Real> &q, ScrArray2D<T> &ql_kp1, ScrArray2D<T> &qr_k) {
   int nvar = q.extent_int(1);
   const Real &dfloor_ = eos.dfloor;
   // TODO(jmstone): ideal gas only for now
@@ -325,4 +330,299 @@ void PiecewiseParabolicX3(TeamMember_t const &member,
   }
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn PiecewiseParabolicX3Staged()
+//! \brief Staged variant of PiecewiseParabolicX3 that reads the k-stencil from a scratch
+//! staging tile filled by the x3 flux kernel, so each plane of the global array is
+//! loaded once per sweep.  The sm2..sp2 arguments are the column offsets of planes
+//! k-2 through k+2 within the tile.
+
+template <typename T>
+KOKKOS_INLINE_FUNCTION
+void PiecewiseParabolicX3Staged(TeamMember_t const &member,
+     const EOS_Data &eos, const bool extremum_preserving, const bool apply_floors,
+     const int il, const int iu, const ScrArray2D<T> &q,
+     const int sm2, const int sm1, const int sc, const int sp1, const int sp2,
+     ScrArray2D<T> &ql_kp1, ScrArray2D<T> &qr_k) {
+  int nvar = q.extent_int(0);
+  const Real &dfloor_ = eos.dfloor;
+  // TODO(jmstone): ideal gas only for now
+  Real efloor_ = eos.pfloor/(eos.gamma - 1.0);
+  for (int n=0; n<nvar; ++n) {
+    if (extremum_preserving) {
+      par_for_inner(member, il, iu, [&](const int i) {
+        PPMX(q(n,sm2+i), q(n,sm1+i), q(n,sc+i), q(n,sp1+i), q(n,sp2+i),
+             ql_kp1(n,i), qr_k(n,i));
+        if (apply_floors) {
+          if (n==IDN) {
+            ql_kp1(IDN,i) = fmax(ql_kp1(IDN,i), dfloor_);
+            qr_k  (IDN,i) = fmax(qr_k  (IDN,i), dfloor_);
+          }
+          if (n==IEN) {
+            ql_kp1(IEN,i) = fmax(ql_kp1(IEN,i), efloor_);
+            qr_k  (IEN,i) = fmax(qr_k  (IEN,i), efloor_);
+          }
+        }
+      });
+    } else {
+      par_for_inner(member, il, iu, [&](const int i) {
+        PPM4(q(n,sm2+i), q(n,sm1+i), q(n,sc+i), q(n,sp1+i), q(n,sp2+i),
+             ql_kp1(n,i), qr_k(n,i));
+      });
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn PiecewiseParabolicCharX1()
+//! \brief Wrapper function for PPM reconstruction in x1-direction with projection onto
+//! characteristic variables (non-relativistic ideal-gas hydrodynamics only).  The
+//! 5-point stencil of (d, v_n, e) is projected onto the left eigenvectors of the
+//! primitive-variable flux Jacobian evaluated at the cell center, the acoustic and
+//! entropy fields are limited independently by PPM4/PPMX, and the interface states are
+//! projected back with the right eigenvectors, all inside the reconstruction tile.
+//! Transverse velocities and passive scalars are their own characteristics and are
+//! limited in primitives as usual.  Limiting in characteristic space keeps the waves
+//! decoupled across strong shocks, which sharply reduces the oscillations that
+//! otherwise trigger FOFC.
+//! This function should be called over [is-1,ie+1] to get BOTH L/R states over [is,ie]
+
+template <typename T>
+KOKKOS_INLINE_FUNCTION
+void PiecewiseParabolicCharX1(TeamMember_t const &member,
+     const EOS_Data &eos, const bool extremum_preserving, const bool apply_floors,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &q, ScrArray2D<T> &ql, ScrArray2D<T> &qr) {
+  int nvar = q.extent_int(1);
+  const Real &dfloor_ = eos.dfloor;
+  Real efloor_ = eos.pfloor/(eos.gamma - 1.0);
+  const Real gm1 = eos.gamma - 1.0;
+  par_for_inner(member, il, iu, [&](const int i) {
+    // acoustic basis from the cell-centered reference state
+    const Real d0 = q(m,IDN,k,j,i);
+    const Real asq = eos.gamma*gm1*q(m,IEN,k,j,i)/d0;
+    const Real a = sqrt(asq);
+
+    // project 5-point stencils of (d, v_n, e) onto the characteristic fields
+    // (c-,c0,c+) = left eigenvectors for waves (v-a, v, v+a)
+    Real cm[5], c0[5], cp[5];
+    for (int s=0; s<5; ++s) {
+      const Real pa = gm1*q(m,IEN,k,j,i+s-2)/asq;
+      const Real va = d0*q(m,IVX,k,j,i+s-2)/a;
+      cm[s] = 0.5*(pa - va);
+      c0[s] = q(m,IDN,k,j,i+s-2) - pa;
+      cp[s] = 0.5*(pa + va);
+    }
+
+    // limit each characteristic field, and the transverse velocities in primitives
+    Real lm, rm, l0, r0, lp, rp;
+    if (extremum_preserving) {
+      PPMX(cm[0], cm[1], cm[2], cm[3], cm[4], lm, rm);
+      PPMX(c0[0], c0[1], c0[2], c0[3], c0[4], l0, r0);
+      PPMX(cp[0], cp[1], cp[2], cp[3], cp[4], lp, rp);
+      PPMX(q(m,IVY,k,j,i-2), q(m,IVY,k,j,i-1), q(m,IVY,k,j,i), q(m,IVY,k,j,i+1),
+           q(m,IVY,k,j,i+2), ql(IVY,i+1), qr(IVY,i));
+      PPMX(q(m,IVZ,k,j,i-2), q(m,IVZ,k,j,i-1), q(m,IVZ,k,j,i), q(m,IVZ,k,j,i+1),
+           q(m,IVZ,k,j,i+2), ql(IVZ,i+1), qr(IVZ,i));
+    } else {
+      PPM4(cm[0], cm[1], cm[2], cm[3], cm[4], lm, rm);
+      PPM4(c0[0], c0[1], c0[2], c0[3], c0[4], l0, r0);
+      PPM4(cp[0], cp[1], cp[2], cp[3], cp[4], lp, rp);
+      PPM4(q(m,IVY,k,j,i-2), q(m,IVY,k,j,i-1), q(m,IVY,k,j,i), q(m,IVY,k,j,i+1),
+           q(m,IVY,k,j,i+2), ql(IVY,i+1), qr(IVY,i));
+      PPM4(q(m,IVZ,k,j,i-2), q(m,IVZ,k,j,i-1), q(m,IVZ,k,j,i), q(m,IVZ,k,j,i+1),
+           q(m,IVZ,k,j,i+2), ql(IVZ,i+1), qr(IVZ,i));
+    }
+
+    // project back to primitives with the right eigenvectors
+    ql(IDN,i+1) = l0 + lm + lp;
+    qr(IDN,i  ) = r0 + rm + rp;
+    ql(IVX,i+1) = a*(lp - lm)/d0;
+    qr(IVX,i  ) = a*(rp - rm)/d0;
+    ql(IEN,i+1) = asq*(lm + lp)/gm1;
+    qr(IEN,i  ) = asq*(rm + rp)/gm1;
+    if (apply_floors) {
+      ql(IDN,i+1) = fmax(ql(IDN,i+1), dfloor_);
+      qr(IDN,i  ) = fmax(qr(IDN,i  ), dfloor_);
+      ql(IEN,i+1) = fmax(ql(IEN,i+1), efloor_);
+      qr(IEN,i  ) = fmax(qr(IEN,i  ), efloor_);
+    }
+  });
+  // passive scalars are advected with the entropy wave; limit in primitives
+  for (int n=(IEN+1); n<nvar; ++n) {
+    par_for_inner(member, il, iu, [&](const int i) {
+      Real &qim2 = q(m,n,k,j,i-2);
+      Real &qim1 = q(m,n,k,j,i-1);
+      Real &qi   = q(m,n,k,j,i  );
+      Real &qip1 = q(m,n,k,j,i+1);
+      Real &qip2 = q(m,n,k,j,i+2);
+      if (extremum_preserving) {
+        PPMX(qim2, qim1, qi, qip1, qip2, ql(n,i+1), qr(n,i));
+      } else {
+        PPM4(qim2, qim1, qi, qip1, qip2, ql(n,i+1), qr(n,i));
+      }
+    });
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn PiecewiseParabolicCharX2()
+//! \brief Wrapper function for PPM reconstruction in x2-direction with projection onto
+//! characteristic variables.  See PiecewiseParabolicCharX1() for details.
+//! This function should be called over [js-1,je+1] to get BOTH L/R states over [js,je]
+
+template <typename T>
+KOKKOS_INLINE_FUNCTION
+void PiecewiseParabolicCharX2(TeamMember_t const &member,
+     const EOS_Data &eos, const bool extremum_preserving, const bool apply_floors,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &q, ScrArray2D<T> &ql_jp1, ScrArray2D<T> &qr_j) {
+  int nvar = q.extent_int(1);
+  const Real &dfloor_ = eos.dfloor;
+  Real efloor_ = eos.pfloor/(eos.gamma - 1.0);
+  const Real gm1 = eos.gamma - 1.0;
+  par_for_inner(member, il, iu, [&](const int i) {
+    const Real d0 = q(m,IDN,k,j,i);
+    const Real asq = eos.gamma*gm1*q(m,IEN,k,j,i)/d0;
+    const Real a = sqrt(asq);
+
+    Real cm[5], c0[5], cp[5];
+    for (int s=0; s<5; ++s) {
+      const Real pa = gm1*q(m,IEN,k,j+s-2,i)/asq;
+      const Real va = d0*q(m,IVY,k,j+s-2,i)/a;
+      cm[s] = 0.5*(pa - va);
+      c0[s] = q(m,IDN,k,j+s-2,i) - pa;
+      cp[s] = 0.5*(pa + va);
+    }
+
+    Real lm, rm, l0, r0, lp, rp;
+    if (extremum_preserving) {
+      PPMX(cm[0], cm[1], cm[2], cm[3], cm[4], lm, rm);
+      PPMX(c0[0], c0[1], c0[2], c0[3], c0[4], l0, r0);
+      PPMX(cp[0], cp[1], cp[2], cp[3], cp[4], lp, rp);
+      PPMX(q(m,IVX,k,j-2,i), q(m,IVX,k,j-1,i), q(m,IVX,k,j,i), q(m,IVX,k,j+1,i),
+           q(m,IVX,k,j+2,i), ql_jp1(IVX,i), qr_j(IVX,i));
+      PPMX(q(m,IVZ,k,j-2,i), q(m,IVZ,k,j-1,i), q(m,IVZ,k,j,i), q(m,IVZ,k,j+1,i),
+           q(m,IVZ,k,j+2,i), ql_jp1(IVZ,i), qr_j(IVZ,i));
+    } else {
+      PPM4(cm[0], cm[1], cm[2], cm[3], cm[4], lm, rm);
+      PPM4(c0[0], c0[1], c0[2], c0[3], c0[4], l0, r0);
+      PPM4(cp[0], cp[1], cp[2], cp[3], cp[4], lp, rp);
+      PPM4(q(m,IVX,k,j-2,i), q(m,IVX,k,j-1,i), q(m,IVX,k,j,i), q(m,IVX,k,j+1,i),
+           q(m,IVX,k,j+2,i), ql_jp1(IVX,i), qr_j(IVX,i));
+      PPM4(q(m,IVZ,k,j-2,i), q(m,IVZ,k,j-1,i), q(m,IVZ,k,j,i), q(m,IVZ,k,j+1,i),
+           q(m,IVZ,k,j+2,i), ql_jp1(IVZ,i), qr_j(IVZ,i));
+    }
+
+    ql_jp1(IDN,i) = l0 + lm + lp;
+    qr_j  (IDN,i) = r0 + rm + rp;
+    ql_jp1(IVY,i) = a*(lp - lm)/d0;
+    qr_j  (IVY,i) = a*(rp - rm)/d0;
+    ql_jp1(IEN,i) = asq*(lm + lp)/gm1;
+    qr_j  (IEN,i) = asq*(rm + rp)/gm1;
+    if (apply_floors) {
+      ql_jp1(IDN,i) = fmax(ql_jp1(IDN,i), dfloor_);
+      qr_j  (IDN,i) = fmax(qr_j  (IDN,i), dfloor_);
+      ql_jp1(IEN,i) = fmax(ql_jp1(IEN,i), efloor_);
+      qr_j  (IEN,i) = fmax(qr_j  (IEN,i), efloor_);
+    }
+  });
+  for (int n=(IEN+1); n<nvar; ++n) {
+    par_for_inner(member, il, iu, [&](const int i) {
+      Real &qjm2 = q(m,n,k,j-2,i);
+      Real &qjm1 = q(m,n,k,j-1,i);
+      Real &qj   = q(m,n,k,j  ,i);
+      Real &qjp1 = q(m,n,k,j+1,i);
+      Real &qjp2 = q(m,n,k,j+2,i);
+      if (extremum_preserving) {
+        PPMX(qjm2, qjm1, qj, qjp1, qjp2, ql_jp1(n,i), qr_j(n,i));
+      } else {
+        PPM4(qjm2, qjm1, qj, qjp1, qjp2, ql_jp1(n,i), qr_j(n,i));
+      }
+    });
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn PiecewiseParabolicCharX3()
+//! \brief Wrapper function for PPM reconstruction in x3-direction with projection onto
+//! characteristic variables.  See PiecewiseParabolicCharX1() for details.
+//! This function should be called over [ks-1,ke+1] to get BOTH L/R states over [ks,ke]
+
+template <typename T>
+KOKKOS_INLINE_FUNCTION
+void PiecewiseParabolicCharX3(TeamMember_t const &member,
+     const EOS_Data &eos, const bool extremum_preserving, const bool apply_floors,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &q, ScrArray2D<T> &ql_kp1, ScrArray2D<T> &qr_k) {
+  int nvar = q.extent_int(1);
+  const Real &dfloor_ = eos.dfloor;
+  Real efloor_ = eos.pfloor/(eos.gamma - 1.0);
+  const Real gm1 = eos.gamma - 1.0;
+  par_for_inner(member, il, iu, [&](const int i) {
+    const Real d0 = q(m,IDN,k,j,i);
+    const Real asq = eos.gamma*gm1*q(m,IEN,k,j,i)/d0;
+    const Real a = sqrt(asq);
+
+    Real cm[5], c0[5], cp[5];
+    for (int s=0; s<5; ++s) {
+      const Real pa = gm1*q(m,IEN,k+s-2,j,i)/asq;
+      const Real va = d0*q(m,IVZ,k+s-2,j,i)/a;
+      cm[s] = 0.5*(pa - va);
+      c0[s] = q(m,IDN,k+s-2,j,i) - pa;
+      cp[s] = 0.5*(pa + va);
+    }
+
+    Real lm, rm, l0, r0, lp, rp;
+    if (extremum_preserving) {
+      PPMX(cm[0], cm[1], cm[2], cm[3], cm[4], lm, rm);
+      PPMX(c0[0], c0[1], c0[2], c0[3], c0[4], l0, r0);
+      PPMX(cp[0], cp[1], cp[2], cp[3], cp[4], lp, rp);
+      PPMX(q(m,IVX,k-2,j,i), q(m,IVX,k-1,j,i), q(m,IVX,k,j,i), q(m,IVX,k+1,j,i),
+           q(m,IVX,k+2,j,i), ql_kp1(IVX,i), qr_k(IVX,i));
+      PPMX(q(m,IVY,k-2,j,i), q(m,IVY,k-1,j,i), q(m,IVY,k,j,i), q(m,IVY,k+1,j,i),
+           q(m,IVY,k+2,j,i), ql_kp1(IVY,i), qr_k(IVY,i));
+    } else {
+      PPM4(cm[0], cm[1], cm[2], cm[3], cm[4], lm, rm);
+      PPM4(c0[0], c0[1], c0[2], c0[3], c0[4], l0, r0);
+      PPM4(cp[0], cp[1], cp[2], cp[3], cp[4], lp, rp);
+      PPM4(q(m,IVX,k-2,j,i), q(m,IVX,k-1,j,i), q(m,IVX,k,j,i), q(m,IVX,k+1,j,i),
+           q(m,IVX,k+2,j,i), ql_kp1(IVX,i), qr_k(IVX,i));
+      PPM4(q(m,IVY,k-2,j,i), q(m,IVY,k-1,j,i), q(m,IVY,k,j,i), q(m,IVY,k+1,j,i),
+           q(m,IVY,k+2,j,i), ql_kp1(IVY,i), qr_k(IVY,i));
+    }
+
+    ql_kp1(IDN,i) = l0 + lm + lp;
+    qr_k  (IDN,i) = r0 + rm + rp;
+    ql_kp1(IVZ,i) = a*(lp - lm)/d0;
+    qr_k  (IVZ,i) = a*(rp - rm)/d0;
+    ql_kp1(IEN,i) = asq*(lm + lp)/gm1;
+    qr_k  (IEN,i) = asq*(rm + rp)/gm1;
+    if (apply_floors) {
+      ql_kp1(IDN,i) = fmax(ql_kp1(IDN,i), dfloor_);
+      qr_k  (IDN,i) = fmax(qr_k  (IDN,i), dfloor_);
+      ql_kp1(IEN,i) = fmax(ql_kp1(IEN,i), efloor_);
+      qr_k  (IEN,i) = fmax(qr_k  (IEN,i), efloor_);
+    }
+  });
+  for (int n=(IEN+1); n<nvar; ++n) {
+    par_for_inner(member, il, iu, [&](const int i) {
+      Real &qkm2 = q(m,n,k-2,j,i);
+      Real &qkm1 = q(m,n,k-1,j,i);
+      Real &qk   = q(m,n,k  ,j,i);
+      Real &qkp1 = q(m,n,k+1,j,i);
+      Real &qkp2 = q(m,n,k+2,j,i);
+      if (extremum_preserving) {
+        PPMX(qkm2, qkm1, qk, qkp1, qkp2, ql_kp1(n,i), qr_k(n,i));
+      } else {
+        PPM4(qkm2, qkm1, qk, qkp1, qkp2, ql_kp1(n,i), qr_k(n,i));
+      }
+    });
+  }
+  return;
+}
 #endif // RECONSTRUCT_PPM_HPP_
@@ -22,60 +22,59 @@
 //! \brief Reconstructs 5th-order polynomial in cell i to compute ql(i+1) and qr(i).
 //! Works for any dimension by passing in the appropriate q_im2,...,q _ip2.
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void WENOZ(const Real &q_im2, const Real &q_im1, const Real &q_i, const Real &q_ip1,
-           const Real &q_ip2, Real &ql_ip1, Real &qr_i) noexcept  {
-  // Smooth WENO weights: Note that these are from Del Zanna et al. 2007 (A.18)
-  const Real beta_coeff[2]{13. / 12., 0.25};
-
-  Real beta[3];
-  beta[0] = beta_coeff[0] * SQR(q_im2 +     q_i - 2.0*q_im1) +
-            beta_coeff[1] * SQR(q_im2 + 3.0*q_i - 4.0*q_im1);
-
-  beta[1] = beta_coeff[0] * SQR(q_im1 + q_ip1 - 2.0*q_i) +
-            beta_coeff[1] * SQR(q_im1 - q_ip1);
-
-  beta[2] = beta_coeff[0] * SQR(q_ip2 +      q_i - 2.0*q_ip1) +
-            beta_coeff[1] * SQR(q_ip2 + 3.0* q_i - 4.0*q_ip1);
-
+           const Real &q_ip2, T &ql_ip1, T &qr_i) noexcept  {
+  // Smoothness-indicator and linear-weight coefficients: Del Zanna et al. 2007 (A.18).
+  // All constexpr so they fold into the instruction stream rather than a local array
+  constexpr Real bc0 = 13.0/12.0;
+  constexpr Real bc1 = 0.25;
+  constexpr Real lw0 = 0.1;
+  constexpr Real lw1 = 0.6;
+  constexpr Real lw2 = 0.3;
   // Rescale epsilon
-  const Real epsL = 1.0e-42;
-
-  // WENO-Z+: Acker et al. 2016
-  const Real tau_5 = fabs(beta[0] - beta[2]);
-
-  Real indicator[3];
-  indicator[0] = tau_5 / (beta[0] + epsL);
-  indicator[1] = tau_5 / (beta[1] + epsL);
-  indicator[2] = tau_5 / (beta[2] + epsL);
-
-  // compute qL_ip1
-  // Factor of 1/6 in coefficients of f[] array applied to alpha_sum to reduce divisions
-  Real f[3];
-  f[0] = ( 2.0*q_im2 - 7.0*q_im1 + 11.0*q_i  );
-  f[1] = (-1.0*q_im1 + 5.0*q_i   + 2.0 *q_ip1);
-  f[2] = ( 2.0*q_i   + 5.0*q_ip1 -      q_ip2);
-
-  Real alpha[3];
-  alpha[0] = 0.1*(1.0 + SQR(indicator[0]));
-  alpha[1] = 0.6*(1.0 + SQR(indicator[1]));
-  alpha[2] = 0.3*(1.0 + SQR(indicator[2]));
-  Real alpha_sum = 6.0*(alpha[0] + alpha[1] + alpha[2]);
-
-  ql_ip1 = (f[0]*alpha[0] + f[1]*alpha[1] + f[2]*alpha[2])/alpha_sum;
-
-  // compute qR_i
-  // Factor of 1/6 in coefficients of f[] array applied to alpha_sum to reduce divisions
-  f[0] = ( 2.0*q_ip2 - 7.0*q_ip1 + 11.0*q_i  );
-  f[1] = (-1.0*q_ip1 + 5.0*q_i   + 2.0 *q_im1);
-  f[2] = ( 2.0*q_i   + 5.0*q_im1 -      q_im2);
-
-  alpha[0] = 0.1*(1.0 + SQR(indicator[2]));
-  alpha[1] = 0.6*(1.0 + SQR(indicator[1]));
-  alpha[2] = 0.3*(1.0 + SQR(indicator[0]));
-  alpha_sum = 6.0*(alpha[0] + alpha[1] + alpha[2]);
-
-  qr_i = (f[0]*alpha[0] + f[1]*alpha[1] + f[2]*alpha[2])/alpha_sum;
+  constexpr Real epsL = 1.0e-42;
+
+  // Difference stencils entering the smoothness indicators.  The three pairs are
+  // mutually independent, so the multiplies and the beta FMAs below can all issue
+  // without serial dependencies between stencils
+  const Real d0 = q_im2 - 2.0*q_im1 +     q_i;
+  const Real e0 = q_im2 - 4.0*q_im1 + 3.0*q_i;
+  const Real d1 = q_im1 - 2.0*q_i   +     q_ip1;
+  const Real e1 = q_im1 -     q_ip1;
+  const Real d2 = q_ip2 - 2.0*q_ip1 +     q_i;
+  const Real e2 = q_ip2 - 4.0*q_ip1 + 3.0*q_i;
+
+  const Real beta0 = bc0*d0*d0 + bc1*e0*e0;
+  const Real beta1 = bc0*d1*d1 + bc1*e1*e1;
+  const Real beta2 = bc0*d2*d2 + bc1*e2*e2;
+
+  // WENO-Z+: Acker et al. 2016.  The three divides are independent of each other
+  const Real tau_5 = fabs(beta0 - beta2);
+  const Real ind0 = tau_5/(beta0 + epsL);
+  const Real ind1 = tau_5/(beta1 + epsL);
+  const Real ind2 = tau_5/(beta2 + epsL);
+
+  // Nonlinear weights; the center-stencil weight is shared by both interfaces while
+  // the side stencils swap roles between qL_ip1 and qR_i
+  const Real a0 = lw0*(1.0 + ind0*ind0);
+  const Real a1 = lw1*(1.0 + ind1*ind1);
+  const Real a2 = lw2*(1.0 + ind2*ind2);
+  const Real b0 = lw0*(1.0 + ind2*ind2);
+  const Real b2 = lw2*(1.0 + ind0*ind0);
+
+  // Interface polynomials of the three stencils (factor of 1/6 applied to the weight
+  // sums instead, to reduce divisions); all six are independent accumulation chains
+  const Real fl0 =  2.0*q_im2 - 7.0*q_im1 + 11.0*q_i;
+  const Real fl1 = -1.0*q_im1 + 5.0*q_i   +  2.0*q_ip1;
+  const Real fl2 =  2.0*q_i   + 5.0*q_ip1 -      q_ip2;
+  const Real fr0 =  2.0*q_ip2 - 7.0*q_ip1 + 11.0*q_i;
+  const Real fr1 = -1.0*q_ip1 + 5.0*q_i   +  2.0*q_im1;
+  const Real fr2 =  2.0*q_i   + 5.0*q_im1 -      q_im2;
+
+  ql_ip1 = (fl0*a0 + fl1*a1 + fl2*a2)/(6.0*(a0 + a1 + a2));
+  qr_i   = (fr0*b0 + fr1*a1 + fr2*b2)/(6.0*(b0 + a1 + b2));
 
   return;
 }
@@ -84,12 +83,15 @@ void WENOZ(const Real &q_im2, const Real &q_im1, const Real &q_i, const Real &q_
 //----------------------------------------------------------------------------------------
 //! \fn WENOZ
 //! \brief Wrapper function for WENOZ reconstruction in x1-direction.
-//! This function should be called over [is-1,ie+1] to get BOTH L/R states over [is,ie]
+//! This function should be called over [is-1,ie+1] to get BOTH L/R states over [is,ie].
+//! The par_for_inner over the full row is the vectorization tile: on CPU backends the
+//! flattened core above has no cross-iteration state and vectorizes across i
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void WENOZX1(TeamMember_t const &member, const EOS_Data &eos, const bool apply_floors,
      const int m, const int k, const int j, const int il, const int iu,
-     const DvceArray5D<Real> &q, ScrArray2D<Real> &ql, ScrArray2D<Real> &qr) {
+     const DvceArray5D<Real> &q, ScrArray2D<T> &ql, ScrArray2D<T> &qr) {
   int nvar = q.extent_int(1);
   const Real &dfloor_ = eos.dfloor;
   // TODO(jmstone): ideal gas only for now
@@ -122,10 +124,11 @@ void WENOZX1(TeamMember_t const &member, const EOS_Data &eos, const bool apply_f
 //! \brief Wrapper function for WENOZ reconstruction in x1-direction.
 //! This function should be called over [js-1,je+1] to get BOTH L/R states over [js,je]
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void WENOZX2(TeamMember_t const &member, const EOS_Data &eos, const bool apply_floors,
      const int m, const int k, const int j, const int il, const int iu,
-     const DvceArray5D<Real> &q, ScrArray2D<Real> &ql_jp1, ScrArray2D<Real> &qr_j) {
+     const DvceArray5D<Real> &q, ScrArray2D<T> &ql_jp1, ScrArray2D<T> &qr_j) {
   int nvar = q.extent_int(1);
   const Real &dfloor_ = eos.dfloor;
   // TODO(jmstone): ideal gas only for now
@@ -158,10 +161,11 @@ void WENOZX2(TeamMember_t const &member, const EOS_Data &eos, const bool apply_f
 //! \brief Wrapper function for WENOZ reconstruction in x1-direction.
 //! This function should be called over [ks-1,ke+1] to get BOTH L/R states over [ks,ke]
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void WENOZX3(TeamMember_t const &member, const EOS_Data &eos, const bool apply_floors,
      const int m, const int k, const int j, const int il, const int iu,
-     const DvceArray5D<Real> &q, ScrArray2D<Real> &ql_kp1, ScrArray2D<Real> &qr_k) {
+     const DvceArray5D<Real> &q, ScrArray2D<T> &ql_kp1, ScrArray2D<T> &qr_k) {
   int nvar = q.extent_int(1);
   const Real &dfloor_ = eos.dfloor;
   // TODO(jmstone): ideal gas only for now
@@ -188,4 +192,40 @@ void WENOZX3(TeamMember_t const &member, const EOS_Data &eos, const bool apply_f
   }
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn WENOZX3Staged
+//! \brief Staged variant of WENOZX3 that reads the k-stencil from a scratch staging
+//! tile filled by the x3 flux kernel, so each plane of the global array is loaded once
+//! per sweep.  The sm2..sp2 arguments are the column offsets of planes k-2 through k+2
+//! within the tile.
+
+template <typename T>
+KOKKOS_INLINE_FUNCTION
+void WENOZX3Staged(TeamMember_t const &member, const EOS_Data &eos,
+     const bool apply_floors, const int il, const int iu, const ScrArray2D<T> &q,
+     const int sm2, const int sm1, const int sc, const int sp1, const int sp2,
+     ScrArray2D<T> &ql_kp1, ScrArray2D<T> &qr_k) {
+  int nvar = q.extent_int(0);
+  const Real &dfloor_ = eos.dfloor;
+  // TODO(jmstone): ideal gas only for now
+  Real efloor_ = eos.pfloor/(eos.gamma - 1.0);
+  for (int n=0; n<nvar; ++n) {
+    par_for_inner(member, il, iu, [&](const int i) {
+      WENOZ(q(n,sm2+i), q(n,sm1+i), q(n,sc+i), q(n,sp1+i), q(n,sp2+i),
+            ql_kp1(n,i), qr_k(n,i));
+      if (apply_floors) {
+        if (n==IDN) {
+          ql_kp1(IDN,i) = fmax(ql_kp1(IDN,i), dfloor_);
+          qr_k  (IDN,i) = fmax(qr_k  (IDN,i), dfloor_);
+        }
+        if (n==IEN) {
+          ql_kp1(IEN,i) = fmax(ql_kp1(IEN,i), efloor_);
+          qr_k  (IEN,i) = fmax(qr_k  (IEN,i), efloor_);
+        }
+      }
+    });
+  }
+  return;
+}
 #endif // RECONSTRUCT_WENOZ_HPP_
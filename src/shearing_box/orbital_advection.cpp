@@ -31,6 +31,16 @@ OrbitalAdvection::OrbitalAdvection(MeshBlockPack *ppack, ParameterInput *pin) :
   Real xmax = fabs(ppack->pmesh->mesh_size.x1max);
   maxjshift = static_cast<int>((ppack->pmesh->cfl_no)*std::max(xmin,xmax)) + 1;
 
+  // allocate per-column shift map built by ComputeShiftMap()
+  {
+    int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
+    int ncells1 = ppack->pmesh->mb_indcs.nx1 + 2*(ppack->pmesh->mb_indcs.ng);
+    Kokkos::realloc(joff_cc,nmb,ncells1);
+    Kokkos::realloc(joff_fc,nmb,ncells1);
+    Kokkos::realloc(eps_cc,nmb,ncells1);
+    Kokkos::realloc(eps_fc,nmb,ncells1);
+  }
+
 #if MPI_PARALLEL_ENABLED
   // For orbital advection, communication is only with x2-face neighbors
   // initialize vectors of MPI request in 2 elements of fixed length arrays
@@ -48,6 +58,45 @@ OrbitalAdvection::OrbitalAdvection(MeshBlockPack *ppack, ParameterInput *pin) :
 #endif
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvection::ComputeShiftMap()
+//! \brief (Re)build the per-column integer shift and fractional offset used by the CC
+//! and FC remap kernels.  Within a cycle these are identical for every variable and
+//! every k, so they are computed once here instead of per-team in the remap kernels;
+//! the map is reused without rebuilding while dt and q*Omega0 repeat across cycles.
+
+void OrbitalAdvection::ComputeShiftMap(Real qom) {
+  Real dt = pmy_pack->pmesh->dt;
+  if ((dt == dt_cache_) && (qom == qom_cache_)) {return;}
+  dt_cache_ = dt;
+  qom_cache_ = qom;
+
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is;
+  int nx1 = indcs.nx1;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  auto &joffc = joff_cc;
+  auto &jofff = joff_fc;
+  auto &epsc = eps_cc;
+  auto &epsf = eps_fc;
+
+  par_for("oa-shiftmap", DevExeSpace(), 0, nmb1, 0, (ncells1-1),
+  KOKKOS_LAMBDA(const int m, const int i) {
+    Real &x1min = mbsize.d_view(m).x1min;
+    Real &x1max = mbsize.d_view(m).x1max;
+    Real &dx2 = mbsize.d_view(m).dx2;
+    // shift at x1-cell centers (CC variables and B3) and x1-cell faces (B1)
+    Real yshc = -qom*CellCenterX(i-is, nx1, x1min, x1max)*dt;
+    Real yshf = -qom*LeftEdgeX(i-is, nx1, x1min, x1max)*dt;
+    joffc(m,i) = static_cast<int>(yshc/dx2);
+    jofff(m,i) = static_cast<int>(yshf/dx2);
+    epsc(m,i) = fmod(yshc,dx2)/dx2;
+    epsf(m,i) = fmod(yshf,dx2)/dx2;
+  });
+}
+
 //----------------------------------------------------------------------------------------
 // OrbitalAdvection base class destructor
 
@@ -35,7 +35,11 @@ OrbitalAdvectionCC::OrbitalAdvectionCC(MeshBlockPack *pp, ParameterInput *pin, i
   int ncells2 = indcs.ng + maxjshift;
   int ncells1 = indcs.nx1;
   for (int n=0; n<2; ++n) {
+#if MPI_PARALLEL_ENABLED
+    // send buffers are only staging for MPI; on-rank packing writes straight into the
+    // destination receive buffer, so without MPI they are never touched
     Kokkos::realloc(sendbuf[n].vars,nmb,nv,ncells3,ncells2,ncells1);
+#endif
     Kokkos::realloc(recvbuf[n].vars,nmb,nv,ncells3,ncells2,ncells1);
   }
 }
@@ -106,6 +110,10 @@ TaskStatus OrbitalAdvectionCC::PackAndSendCC(DvceArray5D<Real> &a) {
       int dm = nghbr.d_view(m,nnghbr).gid - mbgid.d_view(0);
       int dn = (n+1) % 2;
 
+      // destination rank is uniform over the team, so hoist the branch (and the repeated
+      // neighbor-table load) out of the per-cell copy loop
+      const bool on_rank = (nghbr.d_view(m,nnghbr).rank == my_rank);
+
       // Middle loop over k,j,i
       Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji), [&](const int idx) {
         int k = (idx)/nji;
@@ -114,8 +122,9 @@ TaskStatus OrbitalAdvectionCC::PackAndSendCC(DvceArray5D<Real> &a) {
         k += kl;
         j += jl;
 
-        // copy directly into recv buffer if MeshBlocks on same rank
-        if (nghbr.d_view(m,nnghbr).rank == my_rank) {
+        // copy directly into recv buffer if MeshBlocks on same rank, so the halo slab is
+        // staged exactly once before the remap (there is no separate unpack copy)
+        if (on_rank) {
           rbuf[dn].vars(dm,v,(k-kl),(j-jl),(i-il)) = a(m,v,k,j,i);
 
         // else copy into send buffer for MPI communication below
@@ -224,10 +233,10 @@ TaskStatus OrbitalAdvectionCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
   int jfe = jfs + indcs.nx2 - 1;
   int nfx = indcs.nx2 + 2*(ng + maxjshift);
 
-  auto &mbsize = pmy_pack->pmb->mb_size;
-  auto &mesh_size = pmy_pack->pmesh->mesh_size;
-  Real &dt = pmy_pack->pmesh->dt;
-  Real ly = (mesh_size.x2max - mesh_size.x2min);
+  // cache per-column integer shifts and fractional offsets (shared with the FC remap)
+  ComputeShiftMap(qom);
+  auto &joffc = joff_cc;
+  auto &epsc = eps_cc;
 
   int scr_lvl=0;
   size_t scr_size = ScrArray1D<Real>::shmem_size(nfx) * 3;
@@ -237,13 +246,7 @@ TaskStatus OrbitalAdvectionCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
     ScrArray1D<Real> flx(member.team_scratch(scr_lvl), nfx); // "flux" at faces
     ScrArray1D<Real> q1_(member.team_scratch(scr_lvl), nfx); // scratch array
 
-    Real &x1min = mbsize.d_view(m).x1min;
-    Real &x1max = mbsize.d_view(m).x1max;
-    int nx1 = indcs.nx1;
-    Real x1v = CellCenterX(i-is, nx1, x1min, x1max);
-
-    Real yshear = -qom*x1v*dt;
-    int joffset = static_cast<int>(yshear/(mbsize.d_view(m).dx2));
+    int joffset = joffc(m,i);
 
     // Load scratch array with no shift
     par_for_inner(member, 0, (nfx-1), [&](const int jf) {
@@ -261,7 +264,7 @@ TaskStatus OrbitalAdvectionCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
     member.team_barrier();
 
     // Compute "fluxes" at shifted cell faces
-    Real epsi = fmod(yshear,(mbsize.d_view(m).dx2))/(mbsize.d_view(m).dx2);
+    Real epsi = epsc(m,i);
     switch (rcon) {
       case ReconstructionMethod::dc:
         DCRemapFlx(member, (jfs-joffset), (jfe+1-joffset), epsi, a_, q1_, flx);
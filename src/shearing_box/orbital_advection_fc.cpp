@@ -35,7 +35,11 @@ OrbitalAdvectionFC::OrbitalAdvectionFC(MeshBlockPack *pp, ParameterInput *pin) :
   int ncells2 = indcs.ng + maxjshift;
   int ncells1 = indcs.nx1 + 1;
   for (int n=0; n<2; ++n) {
+#if MPI_PARALLEL_ENABLED
+    // send buffers are only staging for MPI; on-rank packing writes straight into the
+    // destination receive buffer, so without MPI they are never touched
     Kokkos::realloc(sendbuf[n].vars,nmb,2,ncells3,ncells2,ncells1);
+#endif
     Kokkos::realloc(recvbuf[n].vars,nmb,2,ncells3,ncells2,ncells1);
   }
 }
@@ -101,6 +105,10 @@ TaskStatus OrbitalAdvectionFC::PackAndSendFC(DvceFaceFld4D<Real> &b) {
       int dm = nghbr.d_view(m,nnghbr).gid - mbgid.d_view(0);
       int dn = (n+1) % 2;
 
+      // destination rank is uniform over the team, so hoist the branch (and the repeated
+      // neighbor-table load) out of the per-cell copy loop
+      const bool on_rank = (nghbr.d_view(m,nnghbr).rank == my_rank);
+
       // Middle loop over k,j,i
       Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji), [&](const int idx) {
         int k = (idx)/nji;
@@ -109,8 +117,9 @@ TaskStatus OrbitalAdvectionFC::PackAndSendFC(DvceFaceFld4D<Real> &b) {
         k += kl;
         j += jl;
 
-        // copy B1/B3 directly into recv buffer if MeshBlocks on same rank
-        if (nghbr.d_view(m,nnghbr).rank == my_rank) {
+        // copy B1/B3 directly into recv buffer if MeshBlocks on same rank, so the halo
+        // slab is staged exactly once before the remap (there is no separate unpack copy)
+        if (on_rank) {
           rbuf[dn].vars(dm,0,(k-kl),(j-jl),(i-il)) = b.x3f(m,k,j,i);
           rbuf[dn].vars(dm,1,(k-kl),(j-jl),(i-il)) = b.x1f(m,k,j,i);
         // else copy B1/B3 into send buffer for MPI communication below
@@ -221,66 +230,67 @@ TaskStatus OrbitalAdvectionFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b0,
   int nfx = indcs.nx2 + 2*(ng + maxjshift);
 
   auto &mbsize = pmy_pack->pmb->mb_size;
-  auto &mesh_size = pmy_pack->pmesh->mesh_size;
-  Real &dt = pmy_pack->pmesh->dt;
-  Real ly = (mesh_size.x2max - mesh_size.x2min);
+
+  // cache per-column integer shifts and fractional offsets (shared with the CC remap)
+  ComputeShiftMap(qom);
+  auto &jmapc = joff_cc;
+  auto &jmapf = joff_fc;
+  auto &emapc = eps_cc;
+  auto &emapf = eps_fc;
 
   int scr_lvl=0;
-  size_t scr_size = ScrArray1D<Real>::shmem_size(nfx) * 3;
+  // B3 and B1 are remapped in a single team pass, so scratch holds a column of each
+  // plus the per-component remap fluxes and one slope workspace (reused sequentially)
+  size_t scr_size = ScrArray1D<Real>::shmem_size(nfx) * 5;
   DvceArray4D<Real> emfx, emfz;
     int ncells1 = indcs.nx1 + 2*(indcs.ng);
     int ncells2 = indcs.nx2 + 2*(indcs.ng);
     int ncells3 = indcs.nx3 + 2*(indcs.ng);
     Kokkos::realloc(emfx,nmb,ncells3,ncells2,ncells1);
     Kokkos::realloc(emfz,nmb,ncells3,ncells2,ncells1);
-  par_for_outer("oa-unB",DevExeSpace(),scr_size,scr_lvl,0,(nmb-1),0,1,ks,ke+1,is,ie+1,
-  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int v, const int k, const int i) {
-    ScrArray1D<Real> b0_(member.team_scratch(scr_lvl), nfx); // 1D slice of data
-    ScrArray1D<Real> flx(member.team_scratch(scr_lvl), nfx); // "flux" at faces
-    ScrArray1D<Real> q1_(member.team_scratch(scr_lvl), nfx); // scratch array
-
-    Real &x1min = mbsize.d_view(m).x1min;
-    Real &x1max = mbsize.d_view(m).x1max;
-    int nx1 = indcs.nx1;
-
-    Real x1;
-    if (v==0) {
-      // B3 located at x1-cell centers
-      x1 = CellCenterX(i-is, nx1, x1min, x1max);
-    } else if (v==1) {
-      // B1 located at x1-cell faces
-      x1 = LeftEdgeX(i-is, nx1, x1min, x1max);
-    }
-    Real yshear = -qom*x1*dt;
-    int joffset = static_cast<int>(yshear/(mbsize.d_view(m).dx2));
-
-    // Load scratch array with no shift
+  par_for_outer("oa-unB",DevExeSpace(),scr_size,scr_lvl,0,(nmb-1),ks,ke+1,is,ie+1,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int i) {
+    ScrArray1D<Real> b3_(member.team_scratch(scr_lvl), nfx);  // 1D slice of B3
+    ScrArray1D<Real> b1_(member.team_scratch(scr_lvl), nfx);  // 1D slice of B1
+    ScrArray1D<Real> flx3(member.team_scratch(scr_lvl), nfx); // "flux" of B3 at faces
+    ScrArray1D<Real> flx1(member.team_scratch(scr_lvl), nfx); // "flux" of B1 at faces
+    ScrArray1D<Real> q1_(member.team_scratch(scr_lvl), nfx);  // scratch array
+
+    // B3 is located at x1-cell centers, B1 at x1-cell faces, so each component carries
+    // its own (cached) shift; everything else in this column is shared between the two
+    int joffc = jmapc(m,i);
+    int jofff = jmapf(m,i);
+
+    // Load scratch arrays with no shift
     par_for_inner(member, 0, (nfx-1), [&](const int jf) {
       if (jf < jfs) {
         // Load from L boundary buffer
-        b0_(jf) = rbuf[0].vars(m,v,(k-ks),jf,(i-is));
+        b3_(jf) = rbuf[0].vars(m,0,(k-ks),jf,(i-is));
+        b1_(jf) = rbuf[0].vars(m,1,(k-ks),jf,(i-is));
       } else if (jf <= jfe) {
-        // Load from array itself (addressed with j=jf-jfs+js)
-        if (v==0) {
-          b0_(jf) = b0.x3f(m,k,(jf-jfs+js),i);
-        } else if (v==1) {
-          b0_(jf) = b0.x1f(m,k,(jf-jfs+js),i);
-        }
+        // Load from arrays themselves (addressed with j=jf-jfs+js)
+        b3_(jf) = b0.x3f(m,k,(jf-jfs+js),i);
+        b1_(jf) = b0.x1f(m,k,(jf-jfs+js),i);
       } else {
         // Load scratch arrays from R boundary buffer
-        b0_(jf) = rbuf[1].vars(m,v,(k-ks),jf-(jfe+1),(i-is));
+        b3_(jf) = rbuf[1].vars(m,0,(k-ks),jf-(jfe+1),(i-is));
+        b1_(jf) = rbuf[1].vars(m,1,(k-ks),jf-(jfe+1),(i-is));
       }
     });
     member.team_barrier();
 
-    // Compute x2-fluxes at shifted cell faces
-    Real epsi = fmod(yshear,(mbsize.d_view(m).dx2))/(mbsize.d_view(m).dx2);
+    // Compute x2-fluxes at shifted cell faces for each component (remap functions
+    // barrier internally, so the slope workspace can be reused between calls)
+    Real epsc = emapc(m,i);
+    Real epsf = emapf(m,i);
     switch (rcon) {
       case ReconstructionMethod::dc:
-        DCRemapFlx(member, (jfs-joffset), (jfe+1-joffset), epsi, b0_, q1_, flx);
+        DCRemapFlx(member, (jfs-joffc), (jfe+1-joffc), epsc, b3_, q1_, flx3);
+        DCRemapFlx(member, (jfs-jofff), (jfe+1-jofff), epsf, b1_, q1_, flx1);
         break;
       case ReconstructionMethod::plm:
-        PLMRemapFlx(member, (jfs-joffset), (jfe+1-joffset), epsi, b0_, q1_, flx);
+        PLMRemapFlx(member, (jfs-joffc), (jfe+1-joffc), epsc, b3_, q1_, flx3);
+        PLMRemapFlx(member, (jfs-jofff), (jfe+1-jofff), epsf, b1_, q1_, flx1);
         break;
 //      case ReconstructionMethod::ppm4:
 //      case ReconstructionMethod::ppmx:
@@ -290,36 +300,26 @@ TaskStatus OrbitalAdvectionFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b0,
         break;
     }
 
-    // Compute emfx = -VyBz, which is at cell-center in x1-direction
-    if (v==0) {
-      par_for_inner(member, js, je+1, [&](const int j) {
-        int jf = j-js + jfs;
-        emfx(m,k,j,i) = -flx(jf-joffset);
-        // Sum integer offsets into effective EMFs
-        for (int jj=1; jj<=joffset; jj++) {
-          emfx(m,k,j,i) -= b0_(jf-jj);
-        }
-        for (int jj=(joffset+1); jj<=0; jj++) {
-          emfx(m,k,j,i) += b0_(jf-jj);
-        }
-      });
-      member.team_barrier();
-
-    // Compute emfz =  VyBx, which is at cell-face in x1-direction
-    } else if (v==1) {
-      par_for_inner(member, js, je+1, [&](const int j) {
-        int jf = j-js + jfs;
-        emfz(m,k,j,i) = flx(jf-joffset);
-        // Sum integer offsets into effective EMFs
-        for (int jj=1; jj<=joffset; jj++) {
-          emfz(m,k,j,i) += b0_(jf-jj);
-        }
-        for (int jj=(joffset+1); jj<=0; jj++) {
-          emfz(m,k,j,i) -= b0_(jf-jj);
-        }
-      });
-      member.team_barrier();
-    }
+    // Compute emfx = -VyBz (at cell-center in x1) and emfz = VyBx (at cell-face in x1)
+    par_for_inner(member, js, je+1, [&](const int j) {
+      int jf = j-js + jfs;
+      emfx(m,k,j,i) = -flx3(jf-joffc);
+      emfz(m,k,j,i) =  flx1(jf-jofff);
+      // Sum integer offsets into effective EMFs
+      for (int jj=1; jj<=joffc; jj++) {
+        emfx(m,k,j,i) -= b3_(jf-jj);
+      }
+      for (int jj=(joffc+1); jj<=0; jj++) {
+        emfx(m,k,j,i) += b3_(jf-jj);
+      }
+      for (int jj=1; jj<=jofff; jj++) {
+        emfz(m,k,j,i) += b1_(jf-jj);
+      }
+      for (int jj=(jofff+1); jj<=0; jj++) {
+        emfz(m,k,j,i) -= b1_(jf-jj);
+      }
+    });
+    member.team_barrier();
   });
 
   // Update face-centered fields using CT
@@ -8,10 +8,13 @@
 
 #include <algorithm>
 #include <iostream>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "athena.hpp"
+#include "globals.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
 #include "shearing_box.hpp"
@@ -57,6 +60,9 @@ ShearingBoxBoundary::ShearingBoxBoundary(MeshBlockPack *ppack, ParameterInput *p
   x1bndry_mbgid.template modify<HostMemSpace>();
   x1bndry_mbgid.template sync<DevExeSpace>();
 
+  // optionally coalesce all sheared exchanges with each remote rank into one message
+  // per step.  Shares the option controlling the regular boundary exchange
+  coalesce = pin->GetOrAddBoolean("mesh", "coalesce_bvals", false);
 
 #if MPI_PARALLEL_ENABLED
   // initialize vectors of MPI requests for ix1/ox1 boundaries in fixed length arrays
@@ -110,3 +116,276 @@ void ShearingBoxBoundary::FindTargetMB(const int igid, const int jshift, int &gi
   rank = pm->rank_eachmb[gid];
   return;
 }
+
+#if MPI_PARALLEL_ENABLED
+// unmanaged 1D view over a contiguous slab of an existing device buffer, used to
+// gather/scatter j-slabs of the (m,j,v,k,i) boundary buffers (contiguous per MB)
+using UnmanagedDvce1D = Kokkos::View<Real *, LayoutWrapper, DevMemSpace,
+                                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+//----------------------------------------------------------------------------------------
+//! \fn void ShearingBoxBoundary::RemoteSegments()
+//! \brief enumerates every segment of the sheared exchange this step that crosses a rank
+//! boundary, repeating the three shift cases of the pack/unpack functions: senders get
+//! the source j-ranges and target ranks, receivers the destination j-ranges and source
+//! ranks.  Used to build the coalesced per-rank messages when coalesce=true.
+
+void ShearingBoxBoundary::RemoteSegments(const bool send,
+                                         std::vector<ShearSegment> &segs) {
+  segs.clear();
+  const auto &indcs = pmy_pack->pmesh->mb_indcs;
+  const int &js = indcs.js, &je = indcs.je;
+  const int &ng = indcs.ng;
+  const int &nx2 = indcs.nx2;
+  for (int n=0; n<2; ++n) {
+    for (int m=0; m<nmb_x1bndry(n); ++m) {
+      int gid = x1bndry_mbgid.h_view(n,m);
+      int mm = gid - pmy_pack->gids;
+      // Find integer and fractional number of grids over which offset extends.
+      // This assumes every grid has same number of cells in x2-direction!
+      int joffset  = static_cast<int>(yshear/(pmy_pack->pmb->mb_size.h_view(mm).dx2));
+      int ji = joffset/nx2;
+      int jr = joffset - ji*nx2;
+
+      int nseg;
+      std::pair<int,int> jrng[3];
+      int jshift[3];
+      if (jr < ng) {               //--- CASE 1 (in my nomenclature)
+        nseg = 3;
+        if (n==0) {
+          if (send) {
+            jrng[0] = std::make_pair(js,js+ng-jr);
+            jrng[1] = std::make_pair(js,je+1);
+            jrng[2] = std::make_pair(je-(ng-1)-jr,je+1);
+          } else {
+            jrng[0] = std::make_pair(je+1+jr,je+ng+1);
+            jrng[1] = std::make_pair(js+jr,je+jr+1);
+            jrng[2] = std::make_pair(js-ng,js+jr);
+          }
+          for (int l=0; l<3; ++l) {jshift[l] = (send)? (ji+l-1) : -(ji+l-1);}
+        } else {
+          if (send) {
+            jrng[0] = std::make_pair(js,js+ng+jr);
+            jrng[1] = std::make_pair(js,je+1);
+            jrng[2] = std::make_pair(je-(ng-1)+jr,je+1);
+          } else {
+            jrng[0] = std::make_pair(je+1-jr,je+ng+1);
+            jrng[1] = std::make_pair(js-jr,je-jr+1);
+            jrng[2] = std::make_pair(js-ng,js-jr);
+          }
+          for (int l=0; l<3; ++l) {jshift[l] = (send)? (l-1-ji) : -(l-1-ji);}
+        }
+      } else if (jr < (nx2-ng)) {  //--- CASE 2
+        nseg = 2;
+        if (n==0) {
+          if (send) {
+            jrng[0] = std::make_pair(js,je+ng-jr+1);
+            jrng[1] = std::make_pair(je-(ng-1)-jr,je+1);
+          } else {
+            jrng[0] = std::make_pair(js+jr,je+ng+1);
+            jrng[1] = std::make_pair(js-ng,js+jr);
+          }
+          for (int l=0; l<2; ++l) {jshift[l] = (send)? (ji+l) : -(ji+l);}
+        } else {
+          if (send) {
+            jrng[0] = std::make_pair(js,js+ng+jr);
+            jrng[1] = std::make_pair(js-ng+jr,je+1);
+          } else {
+            jrng[0] = std::make_pair(je-jr+1,je+ng+1);
+            jrng[1] = std::make_pair(js-ng,je-jr+1);
+          }
+          for (int l=0; l<2; ++l) {jshift[l] = (send)? (l-1-ji) : -(l-1-ji);}
+        }
+      } else {                     //--- CASE 3
+        nseg = 3;
+        if (n==0) {
+          if (send) {
+            jrng[0] = std::make_pair(js,js+ng+(nx2-jr));
+            jrng[1] = std::make_pair(js,je+1);
+            jrng[2] = std::make_pair(je-(ng-1)+(nx2-jr),je+1);
+          } else {
+            jrng[0] = std::make_pair(je+1-(nx2-jr),je+ng+1);
+            jrng[1] = std::make_pair(js-(nx2-jr),je-(nx2-jr)+1);
+            jrng[2] = std::make_pair(js-ng,js-(nx2-jr));
+          }
+          for (int l=0; l<3; ++l) {jshift[l] = (send)? (ji+l) : -(ji+l);}
+        } else {
+          if (send) {
+            jrng[0] = std::make_pair(js,js+ng-(nx2-jr));
+            jrng[1] = std::make_pair(js,je+1);
+            jrng[2] = std::make_pair(je-(ng-1)-(nx2-jr),je+1);
+          } else {
+            jrng[0] = std::make_pair(je+1+(nx2-jr),je+ng+1);
+            jrng[1] = std::make_pair(js+(nx2-jr),je+(nx2-jr)+1);
+            jrng[2] = std::make_pair(js-ng,js+(nx2-jr));
+          }
+          for (int l=0; l<3; ++l) {jshift[l] = (send)? (l-2-ji) : -(l-2-ji);}
+        }
+      }
+      for (int l=0; l<nseg; ++l) {
+        int tgid, trank;
+        FindTargetMB(gid,jshift[l],tgid,trank);
+        if (trank != global_variable::my_rank) {
+          // ordering key is always the GID of the *receiving* MeshBlock
+          int rgid = (send)? tgid : gid;
+          segs.push_back({n, m, l, rgid, trank, jrng[l].first, jrng[l].second});
+        }
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ShearingBoxBoundary::BuildCoalescedMessages()
+//! \brief groups the remote segments of this step by rank and lays them out in one
+//! contiguous message per rank pair.  Storage comes from a grow-only per-rank pool so
+//! steady-state steps allocate nothing even though the layout changes with the shear.
+
+void ShearingBoxBoundary::BuildCoalescedMessages(
+    const bool send, std::vector<ShearCoalescedBuffer> &coal) {
+  std::vector<ShearSegment> segs;
+  RemoteSegments(send, segs);
+  std::map<int, std::vector<ShearSegment>> by_rank;
+  for (auto &s : segs) {by_rank[s.rank].push_back(s);}
+
+  coal.clear();
+  auto &bufs = (send)? sendbuf : recvbuf;
+  auto &pool = (send)? coal_send_pool_ : coal_recv_pool_;
+  for (auto &[rank, list] : by_rank) {
+    // both ends sort on (receiving GID, side, message index) so offsets agree
+    std::sort(list.begin(), list.end(),
+              [](const ShearSegment &a, const ShearSegment &b) {
+      if (a.rgid != b.rgid) return a.rgid < b.rgid;
+      if (a.n != b.n) return a.n < b.n;
+      return a.l < b.l;
+    });
+    ShearCoalescedBuffer cb;
+    cb.rank = rank;
+    cb.req = MPI_REQUEST_NULL;
+    cb.ndat = 0;
+    for (auto &s : list) {
+      auto &v = bufs[s.n].vars;
+      int jslice = v.extent_int(2)*v.extent_int(3)*v.extent_int(4);
+      cb.offsets.push_back(cb.ndat);
+      cb.ndat += (s.ju - s.jl)*jslice;
+    }
+    cb.segs = std::move(list);
+    auto it = pool.find(rank);
+    if (it == pool.end() || static_cast<int>(it->second.extent(0)) < cb.ndat) {
+      pool[rank] = DvceArray1D<Real>("sbox_coal", cb.ndat);
+    }
+    cb.data = pool[rank];
+    coal.push_back(cb);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus ShearingBoxBoundary::InitCoalescedRecv()
+//! \brief builds the receive-side message layout for this step and posts one
+//! non-blocking receive per remote rank.  The communicator is unique to this boundary
+//! object and only one message per rank pair is in flight, so a fixed tag suffices.
+
+TaskStatus ShearingBoxBoundary::InitCoalescedRecv() {
+  BuildCoalescedMessages(false, coal_recv);
+  bool no_errors=true;
+  for (auto &cb : coal_recv) {
+    int ierr = MPI_Irecv(cb.data.data(), cb.ndat, MPI_ATHENA_REAL, cb.rank, 0,
+                         comm_sbox, &(cb.req));
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in posting coalesced receives" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus ShearingBoxBoundary::SendCoalesced()
+//! \brief gathers the packed send buffers into one contiguous message per remote rank
+//! and posts a single send per rank pair.  Send buffers must already be packed and
+//! fenced; j-slabs of one MB are contiguous in the (m,j,v,k,i) buffer layout so the
+//! gather is a set of flat device-to-device copies.
+
+TaskStatus ShearingBoxBoundary::SendCoalesced() {
+  BuildCoalescedMessages(true, coal_send);
+  for (auto &cb : coal_send) {
+    for (std::size_t s=0; s<cb.segs.size(); ++s) {
+      auto &sg = cb.segs[s];
+      auto &v = sendbuf[sg.n].vars;
+      int jslice = v.extent_int(2)*v.extent_int(3)*v.extent_int(4);
+      int len = (sg.ju - sg.jl)*jslice;
+      size_t start = (static_cast<size_t>(sg.m)*v.extent(1) + sg.jl)*jslice;
+      UnmanagedDvce1D src(v.data() + start, len);
+      auto dst = Kokkos::subview(cb.data,
+                                 std::make_pair(cb.offsets[s], cb.offsets[s] + len));
+      Kokkos::deep_copy(DevExeSpace(), dst, src);
+    }
+  }
+  Kokkos::fence();
+
+  bool no_errors=true;
+  for (auto &cb : coal_send) {
+    int ierr = MPI_Isend(cb.data.data(), cb.ndat, MPI_ATHENA_REAL, cb.rank, 0,
+                         comm_sbox, &(cb.req));
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in posting coalesced sends" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool ShearingBoxBoundary::TestCoalescedRecvs()
+//! \brief returns true only when the coalesced message from every remote rank arrived
+
+bool ShearingBoxBoundary::TestCoalescedRecvs() {
+  bool arrived = true;
+  bool no_errors=true;
+  for (auto &cb : coal_recv) {
+    int test;
+    int ierr = MPI_Test(&(cb.req), &test, MPI_STATUS_IGNORE);
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+    if (!(static_cast<bool>(test))) {arrived = false;}
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in testing coalesced receives" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return arrived;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ShearingBoxBoundary::ScatterCoalescedRecvs()
+//! \brief scatters arrived per-rank messages into the individual recv buffers, after
+//! which unpacking proceeds exactly as with individual messages.  The copies run on the
+//! default execution space instance, so the unpack kernels that follow are
+//! stream-ordered with them and no fence is needed.
+
+void ShearingBoxBoundary::ScatterCoalescedRecvs() {
+  for (auto &cb : coal_recv) {
+    for (std::size_t s=0; s<cb.segs.size(); ++s) {
+      auto &sg = cb.segs[s];
+      auto &v = recvbuf[sg.n].vars;
+      int jslice = v.extent_int(2)*v.extent_int(3)*v.extent_int(4);
+      int len = (sg.ju - sg.jl)*jslice;
+      size_t start = (static_cast<size_t>(sg.m)*v.extent(1) + sg.jl)*jslice;
+      UnmanagedDvce1D dst(v.data() + start, len);
+      auto src = Kokkos::subview(cb.data,
+                                 std::make_pair(cb.offsets[s], cb.offsets[s] + len));
+      Kokkos::deep_copy(DevExeSpace(), dst, src);
+    }
+  }
+  return;
+}
+#endif  // MPI_PARALLEL_ENABLED
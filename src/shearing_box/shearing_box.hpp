@@ -10,6 +10,9 @@
 //! Both OrbitalAdvection and ShearingBox are abstract base classes that are used to
 //! define derived classes for CC and FC variables.
 
+#include <map>
+#include <vector>
+
 #include "athena.hpp"
 #include "parameter_input.hpp"
 #include "tasklist/task_list.hpp"
@@ -57,6 +60,12 @@ class OrbitalAdvection {
   // data
   int maxjshift;            // maximum integer shift of any cell in orbital advection
 
+  // per-column shift map shared by all remap kernels: within a cycle the integer shift
+  // and fractional offset depend only on x1 (not on variable or k), so they are built
+  // once by ComputeShiftMap() and cached while dt and q*Omega0 are unchanged
+  DvceArray2D<int> joff_cc, joff_fc;   // integer x2-shift at x1-cell centers/faces
+  DvceArray2D<Real> eps_cc, eps_fc;    // fractional x2-offset at x1-cell centers/faces
+
   // data buffers for orbital advection. Only two x2-faces communicate
   ShearingBoxBoundaryBuffer sendbuf[2], recvbuf[2];
 
@@ -69,11 +78,13 @@ class OrbitalAdvection {
   TaskStatus InitRecv();
   TaskStatus ClearRecv();
   TaskStatus ClearSend();
+  void ComputeShiftMap(Real qom);
 
  protected:
   // must use pointer to MBPack and not parent physics module since parent can be one of
   // many types (Hydro, MHD, Radiation, etc.)
   MeshBlockPack *pmy_pack;
+  Real dt_cache_ = -1.0, qom_cache_ = 0.0;  // values the shift map was built with
 };
 
 //----------------------------------------------------------------------------------------
@@ -113,6 +124,7 @@ class ShearingBoxBoundary {
   HostArray1D<int> nmb_x1bndry;    // number of MBs that touch x1 boundaries
   DualArray2D<int> x1bndry_mbgid;  // GIDs of MBs at x1 boundaries
   Real yshear;                     // x2-distance x1-boundaries have sheared
+  bool coalesce;                   // exchange one message per rank pair per step
 
   // data buffers for shearing box BCs.  Only two x1-faces get sheared
   // Use seperate variables for ix1/ox1 since number of MBs on each face can be different
@@ -121,12 +133,45 @@ class ShearingBoxBoundary {
 #if MPI_PARALLEL_ENABLED
   // unique MPI communicator for shearing box
   MPI_Comm comm_sbox;
+
+  // host-side description of one remote segment of the sheared exchange.  Both ends
+  // order segments by (rgid,n,l) -- the key encoded in the tags of the individual
+  // messages the coalesced exchange replaces -- so offsets agree without extra
+  // communication
+  struct ShearSegment {
+    int n;        // boundary side (0=ix1, 1=ox1)
+    int m;        // index in x1bndry_mbgid list on this rank
+    int l;        // message index within shift case [0-2]
+    int rgid;     // GID of *receiving* MeshBlock (ordering key on both ends)
+    int rank;     // remote rank exchanged with
+    int jl, ju;   // j-range [jl,ju) within boundary buffer
+  };
+  // contiguous per-rank message assembled from ShearSegments when coalesce=true.
+  // Rebuilt every step since the segment topology changes as the boundaries shear
+  struct ShearCoalescedBuffer {
+    int rank;                         // remote rank exchanged with
+    int ndat;                         // total number of Reals in message
+    DvceArray1D<Real> data;           // message storage (grow-only, from pool)
+    MPI_Request req;
+    std::vector<ShearSegment> segs;   // segments in message order
+    std::vector<int> offsets;         // starting offset of each segment in data
+  };
+  std::vector<ShearCoalescedBuffer> coal_send, coal_recv;
 #endif
 
   // functions
   TaskStatus InitRecv(Real qom, Real time);
   TaskStatus ClearRecv();
   TaskStatus ClearSend();
+#if MPI_PARALLEL_ENABLED
+  // functions implementing the one-message-per-rank-pair exchange
+  void RemoteSegments(const bool send, std::vector<ShearSegment> &segs);
+  void BuildCoalescedMessages(const bool send, std::vector<ShearCoalescedBuffer> &coal);
+  TaskStatus InitCoalescedRecv();
+  TaskStatus SendCoalesced();
+  bool TestCoalescedRecvs();
+  void ScatterCoalescedRecvs();
+#endif
   // function to find target MB offset by shear.  Returns GID and rank
   void FindTargetMB(const int igid, const int jshift, int &gid, int &rank);
   // function to find index in x1bndry array of MB with input GID
@@ -141,6 +186,10 @@ class ShearingBoxBoundary {
   // must use pointer to MBPack and not parent physics module since parent can be one of
   // many types (Hydro, MHD, Radiation, etc.)
   MeshBlockPack *pmy_pack;
+#if MPI_PARALLEL_ENABLED
+  // grow-only per-rank storage reused by the coalesced messages each step
+  std::map<int, DvceArray1D<Real>> coal_send_pool_, coal_recv_pool_;
+#endif
 };
 
 //----------------------------------------------------------------------------------------
@@ -190,7 +190,8 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
             auto dst = subview(recvbuf[n].vars,tm,jdst[l],ALL,ALL,ALL);
             deep_copy(DevExeSpace(), dst, src);
 #if MPI_PARALLEL_ENABLED
-          } else {
+          // individual per-segment sends; skipped when coalescing into per-rank messages
+          } else if (!coalesce) {
             using Kokkos::ALL;
             auto send_ptr = subview(sendbuf[n].vars,m,jsrc[l],ALL,ALL,ALL);
             // create tag using GID of *receiving* MeshBlock
@@ -229,7 +230,8 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
             auto dst = subview(recvbuf[n].vars,tm,jdst[l],ALL,ALL,ALL);
             deep_copy(DevExeSpace(), dst, src);
 #if MPI_PARALLEL_ENABLED
-          } else {
+          // individual per-segment sends; skipped when coalescing into per-rank messages
+          } else if (!coalesce) {
             using Kokkos::ALL;
             auto send_ptr = subview(sendbuf[n].vars,m,jsrc[l],ALL,ALL,ALL);
             // create tag using GID of *receiving* MeshBlock
@@ -272,7 +274,8 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
             auto dst = subview(recvbuf[n].vars,tm,jdst[l],ALL,ALL,ALL);
             deep_copy(DevExeSpace(), dst, src);
 #if MPI_PARALLEL_ENABLED
-          } else {
+          // individual per-segment sends; skipped when coalescing into per-rank messages
+          } else if (!coalesce) {
             using Kokkos::ALL;
             auto send_ptr = subview(sendbuf[n].vars,m,jsrc[l],ALL,ALL,ALL);
             // create tag using GID of *receiving* MeshBlock
@@ -286,6 +289,11 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
       }
     }
   }
+#if MPI_PARALLEL_ENABLED
+  // gather all remote segments into one contiguous message per rank pair and post
+  // single sends (the on-rank deep copies above are unchanged)
+  if (coalesce) {SendCoalesced();}
+#endif
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
        << std::endl << "MPI error in posting sends" << std::endl;
@@ -305,6 +313,14 @@ TaskStatus ShearingBoxBoundaryFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b) {
   const auto &indcs = pmy_pack->pmesh->mb_indcs;
   const int &ng = indcs.ng;
 #if MPI_PARALLEL_ENABLED
+  // with coalesced messaging, test the single per-rank messages and scatter arrived
+  // data into the individual recv buffers; unpacking below then proceeds unchanged.
+  // The per-segment requests tested below are all MPI_REQUEST_NULL in this mode
+  if (coalesce) {
+    if (!(TestCoalescedRecvs())) {return TaskStatus::incomplete;}
+    ScatterCoalescedRecvs();
+  }
+
   //----- STEP 1: check that recv boundary buffer communications have all completed
   const int &nx2 = indcs.nx2;
   bool bflag = false;
@@ -147,6 +147,10 @@ TaskStatus ShearingBoxBoundary::InitRecv(Real qom, Real time) {
   yshear = qom*lx*time;
 
 #if MPI_PARALLEL_ENABLED
+  // with coalesced messaging, post one receive per remote rank instead of the
+  // per-segment receives below
+  if (coalesce) {return InitCoalescedRecv();}
+
   // post non-blocking receives
   bool no_errors=true;
   const auto &indcs = pmy_pack->pmesh->mb_indcs;
@@ -281,6 +285,14 @@ TaskStatus ShearingBoxBoundary::InitRecv(Real qom, Real time) {
 TaskStatus ShearingBoxBoundary::ClearRecv() {
 #if MPI_PARALLEL_ENABLED
   bool no_errors=true;
+  // with coalesced messaging only the single per-rank requests are active; the
+  // per-segment requests below are all MPI_REQUEST_NULL and wait trivially
+  if (coalesce) {
+    for (auto &cb : coal_recv) {
+      int ierr = MPI_Wait(&(cb.req), MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    }
+  }
   const int &ng = pmy_pack->pmesh->mb_indcs.ng;
   const int &nx2 = pmy_pack->pmesh->mb_indcs.nx2;
   // wait for all non-blocking receives for vars to finish before continuing
@@ -354,6 +366,14 @@ TaskStatus ShearingBoxBoundary::ClearRecv() {
 TaskStatus ShearingBoxBoundary::ClearSend() {
 #if MPI_PARALLEL_ENABLED
   bool no_errors=true;
+  // with coalesced messaging only the single per-rank requests are active; the
+  // per-segment requests below are all MPI_REQUEST_NULL and wait trivially
+  if (coalesce) {
+    for (auto &cb : coal_send) {
+      int ierr = MPI_Wait(&(cb.req), MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    }
+  }
   const int &ng = pmy_pack->pmesh->mb_indcs.ng;
   const int &nx2 = pmy_pack->pmesh->mb_indcs.nx2;
   // wait for all non-blocking sends for vars to finish before continuing
@@ -10,7 +10,10 @@
 
 #include "srcterms.hpp"
 
+#include <float.h>
+
 #include <iostream>
+#include <limits>
 #include <string> // string
 
 #include "athena.hpp"
@@ -50,6 +53,54 @@ SourceTerms::SourceTerms(std::string block, MeshBlockPack *pp, ParameterInput *p
   ism_cooling = pin->GetOrAddBoolean(block, "ism_cooling", false);
   if (ism_cooling) {
     hrate = pin->GetReal(block, "hrate");
+    // Optional exact integration of the cooling ODE (Townsend, MNRAS 397, 478, 2009).
+    // Lambda(T) is sampled onto a uniform log-T table and treated as a piecewise power
+    // law, for which the cooling update integrates exactly over any dt; stiff cooling
+    // then no longer constrains the timestep (see SourceTerms::NewTimeStep)
+    exact_cooling = pin->GetOrAddBoolean(block, "exact_cooling", false);
+    if (exact_cooling) {
+      ncool = 321;
+      cool_logtmin = 1.0;
+      cool_dlogt = 0.025;
+      Kokkos::realloc(cool_lam, ncool);
+      Kokkos::realloc(cool_alpha, ncool);
+      Kokkos::realloc(cool_yf, ncool);
+      // sample piecewise rate function onto table points T_n
+      for (int n=0; n<ncool; ++n) {
+        Real tn = pow(10.0, cool_logtmin + cool_dlogt*static_cast<Real>(n));
+        cool_lam.h_view(n) = ISMCoolFn(tn);
+      }
+      // power-law slope of Lambda within each interval [T_n, T_n+1]
+      for (int n=0; n<(ncool-1); ++n) {
+        cool_alpha.h_view(n) = log10(cool_lam.h_view(n+1)/cool_lam.h_view(n))/cool_dlogt;
+      }
+      cool_alpha.h_view(ncool-1) = cool_alpha.h_view(ncool-2);
+      // temporal evolution function Y(T_n) (eq. A6 of Townsend), accumulated downward
+      // from the reference point at the top of the table, where Y=0
+      Real tref = pow(10.0, cool_logtmin + cool_dlogt*static_cast<Real>(ncool-1));
+      Real lref = cool_lam.h_view(ncool-1);
+      cool_yf.h_view(ncool-1) = 0.0;
+      for (int n=(ncool-2); n>=0; --n) {
+        Real tn  = pow(10.0, cool_logtmin + cool_dlogt*static_cast<Real>(n));
+        Real tnp = pow(10.0, cool_logtmin + cool_dlogt*static_cast<Real>(n+1));
+        Real an = cool_alpha.h_view(n);
+        Real fac = (lref/cool_lam.h_view(n))*(tn/tref);
+        if (fabs(an - 1.0) < 1.0e-8) {
+          cool_yf.h_view(n) = cool_yf.h_view(n+1) - fac*log(tn/tnp);
+        } else {
+          cool_yf.h_view(n) = cool_yf.h_view(n+1)
+                              - fac*(1.0 - pow(tn/tnp, an-1.0))/(1.0-an);
+        }
+      }
+      cool_lam.template modify<HostMemSpace>();
+      cool_lam.template sync<DevExeSpace>();
+      cool_alpha.template modify<HostMemSpace>();
+      cool_alpha.template sync<DevExeSpace>();
+      cool_yf.template modify<HostMemSpace>();
+      cool_yf.template sync<DevExeSpace>();
+    }
+  } else {
+    exact_cooling = false;
   }
 
   // (3) beam source (radiation)
@@ -114,11 +165,18 @@ void SourceTerms::ConstantAccel(const DvceArray5D<Real> &w0, const EOS_Data &eos
 
 void SourceTerms::ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_data,
                              const Real bdt, DvceArray5D<Real> &u0) {
+  // with <block>/exact_cooling=true the update is computed by exact integration instead
+  if (exact_cooling) {
+    ISMCoolingExact(w0, eos_data, bdt, u0);
+    return;
+  }
   auto &indcs = pmy_pack->pmesh->mb_indcs;
-  int is = indcs.is, ie = indcs.ie;
-  int js = indcs.js, je = indcs.je;
-  int ks = indcs.ks, ke = indcs.ke;
-  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int is = indcs.is, nx1 = indcs.nx1;
+  int js = indcs.js, nx2 = indcs.nx2;
+  int ks = indcs.ks, nx3 = indcs.nx3;
+  const int nmkji = (pmy_pack->nmb_thispack)*nx3*nx2*nx1;
+  const int nkji = nx3*nx2*nx1;
+  const int nji  = nx2*nx1;
   Real use_e = eos_data.use_e;
   Real gamma = eos_data.gamma;
   Real gm1 = gamma - 1.0;
@@ -130,14 +188,28 @@ void SourceTerms::ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
                       /n_unit/n_unit;
   Real heating_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()/n_unit;
 
-  par_for("cooling", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
-  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+  // the min-dt reduction over (e/cooling_rate) is folded into this kernel as a side
+  // output, replacing the dedicated full-grid sweep in SourceTerms::NewTimeStep
+  Real dt_src = static_cast<Real>(std::numeric_limits<float>::max());
+  Kokkos::parallel_reduce("cooling", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx, Real &min_dt) {
+    // compute m,k,j,i indices of thread and call function
+    int m = (idx)/nkji;
+    int k = (idx - m*nkji)/nji;
+    int j = (idx - m*nkji - k*nji)/nx1;
+    int i = (idx - m*nkji - k*nji - j*nx1) + is;
+    k += ks;
+    j += js;
+
     // temperature in cgs unit
     Real temp = 1.0;
+    Real eint = 1.0;
     if (use_e) {
       temp = temp_unit*w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i)*gm1;
+      eint = w0(m,IEN,k,j,i);
     } else {
       temp = temp_unit*w0(m,ITM,k,j,i);
+      eint = w0(m,ITM,k,j,i)*w0(m,IDN,k,j,i)/gm1;
     }
 
     Real lambda_cooling = ISMCoolFn(temp)/cooling_unit;
@@ -145,6 +217,107 @@ void SourceTerms::ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
 
     u0(m,IEN,k,j,i) -= bdt * w0(m,IDN,k,j,i) *
                         (w0(m,IDN,k,j,i) * lambda_cooling - gamma_heating);
+
+    // add a tiny number
+    Real cooling_heating = FLT_MIN + fabs(w0(m,IDN,k,j,i) *
+                           (w0(m,IDN,k,j,i) * lambda_cooling - gamma_heating));
+
+    min_dt = fmin((eint/cooling_heating), min_dt);
+  }, Kokkos::Min<Real>(dt_src));
+  dtnew = dt_src;
+  dtmin_computed = true;
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SourceTerms::ISMCoolingExact()
+//! \brief Add ISM cooling via exact integration over the timestep following Townsend,
+//! MNRAS 397, 478 (2009).  Lambda(T) is a piecewise power law on the log-T table built
+//! in the constructor, for which the cooling ODE integrates in closed form; the update
+//! is stable and accurate for any dt.  Heating is not stiff and remains explicit.
+// NOTE source terms must be computed using primitive (w0) and NOT conserved (u0) vars
+
+void SourceTerms::ISMCoolingExact(const DvceArray5D<Real> &w0, const EOS_Data &eos_data,
+                                  const Real bdt, DvceArray5D<Real> &u0) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  Real use_e = eos_data.use_e;
+  Real gamma = eos_data.gamma;
+  Real gm1 = gamma - 1.0;
+  Real heating_rate = hrate;
+  Real temp_unit = pmy_pack->punit->temperature_cgs();
+  Real n_unit = pmy_pack->punit->density_cgs()/pmy_pack->punit->mu()
+                /pmy_pack->punit->atomic_mass_unit_cgs;
+  Real cooling_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()
+                      /n_unit/n_unit;
+  Real heating_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()/n_unit;
+
+  int ncool_ = ncool;
+  Real logtmin = cool_logtmin;
+  Real dlogt = cool_dlogt;
+  auto lam = cool_lam;
+  auto alpha = cool_alpha;
+  auto yf = cool_yf;
+  // reference point at the top of the table, where Y=0
+  Real tref = pow(10.0, logtmin + dlogt*static_cast<Real>(ncool_-1));
+  Real lref = lam.h_view(ncool_-1);
+  Real tfloor = pow(10.0, logtmin);
+
+  par_for("cooling_exact", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    // temperature in cgs unit, and internal energy in code units
+    Real temp = 1.0;
+    Real eint = 1.0;
+    if (use_e) {
+      temp = temp_unit*w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i)*gm1;
+      eint = w0(m,IEN,k,j,i);
+    } else {
+      temp = temp_unit*w0(m,ITM,k,j,i);
+      eint = w0(m,ITM,k,j,i)*w0(m,IDN,k,j,i)/gm1;
+    }
+
+    // table interval containing T; edge intervals extrapolate the power law
+    int n = static_cast<int>((log10(temp) - logtmin)/dlogt);
+    n = (n < 0)? 0 : ((n > (ncool_-2))? (ncool_-2) : n);
+    Real tn = pow(10.0, logtmin + dlogt*static_cast<Real>(n));
+    Real an = alpha.d_view(n);
+    Real fac = (lref/lam.d_view(n))*(tn/tref);
+
+    // temporal evolution function Y(T) (eq. A5 of Townsend)
+    Real y;
+    if (fabs(an - 1.0) < 1.0e-8) {
+      y = yf.d_view(n) + fac*log(tn/temp);
+    } else {
+      y = yf.d_view(n) + fac*(pow(tn/temp, an-1.0) - 1.0)/(1.0-an);
+    }
+
+    // advance Y by the (temperature-independent) dimensionless time increment (eq. 26)
+    Real ynew = y + bdt*w0(m,IDN,k,j,i)*gm1*temp_unit*(lref/cooling_unit)/tref;
+
+    // invert Y to find the new temperature (eq. A7); Y increases monotonically toward
+    // low T, so search downward for the interval containing ynew
+    Real tnew;
+    if (ynew >= yf.d_view(0)) {
+      tnew = tfloor;
+    } else {
+      while (n > 0 && yf.d_view(n) < ynew) {--n;}
+      tn = pow(10.0, logtmin + dlogt*static_cast<Real>(n));
+      an = alpha.d_view(n);
+      Real lfac = (lam.d_view(n)/lref)*(tref/tn);
+      if (fabs(an - 1.0) < 1.0e-8) {
+        tnew = tn*exp(-lfac*(ynew - yf.d_view(n)));
+      } else {
+        tnew = tn*pow(1.0 - (1.0-an)*lfac*(ynew - yf.d_view(n)), 1.0/(1.0-an));
+      }
+      tnew = fmax(tnew, tfloor);
+    }
+
+    Real gamma_heating = heating_rate/heating_unit;
+    u0(m,IEN,k,j,i) += eint*(tnew/temp - 1.0) + bdt*w0(m,IDN,k,j,i)*gamma_heating;
   });
 
   return;
@@ -158,24 +331,40 @@ void SourceTerms::ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
 void SourceTerms::RelCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_data,
                              const Real bdt, DvceArray5D<Real> &u0) {
   auto &indcs = pmy_pack->pmesh->mb_indcs;
-  int is = indcs.is, ie = indcs.ie;
-  int js = indcs.js, je = indcs.je;
-  int ks = indcs.ks, ke = indcs.ke;
-  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int is = indcs.is, nx1 = indcs.nx1;
+  int js = indcs.js, nx2 = indcs.nx2;
+  int ks = indcs.ks, nx3 = indcs.nx3;
+  const int nmkji = (pmy_pack->nmb_thispack)*nx3*nx2*nx1;
+  const int nkji = nx3*nx2*nx1;
+  const int nji  = nx2*nx1;
   Real use_e = eos_data.use_e;
   Real gamma = eos_data.gamma;
   Real gm1 = gamma - 1.0;
   Real cooling_rate = crate_rel;
   Real cooling_power = cpower_rel;
 
-  par_for("cooling", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
-  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+  // the min-dt reduction over (e/cooling_rate) is folded into this kernel as a side
+  // output, replacing the dedicated full-grid sweep in SourceTerms::NewTimeStep
+  Real dt_src = static_cast<Real>(std::numeric_limits<float>::max());
+  Kokkos::parallel_reduce("cooling", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx, Real &min_dt) {
+    // compute m,k,j,i indices of thread and call function
+    int m = (idx)/nkji;
+    int k = (idx - m*nkji)/nji;
+    int j = (idx - m*nkji - k*nji)/nx1;
+    int i = (idx - m*nkji - k*nji - j*nx1) + is;
+    k += ks;
+    j += js;
+
     // temperature in cgs unit
     Real temp = 1.0;
+    Real eint = 1.0;
     if (use_e) {
       temp = w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i)*gm1;
+      eint = w0(m,IEN,k,j,i);
     } else {
       temp = w0(m,ITM,k,j,i);
+      eint = w0(m,ITM,k,j,i)*w0(m,IDN,k,j,i)/gm1;
     }
 
     auto &ux = w0(m,IVX,k,j,i);
@@ -189,7 +378,15 @@ void SourceTerms::RelCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
     u0(m,IM1,k,j,i) -= bdt*w0(m,IDN,k,j,i)*ux*pow((temp*cooling_rate), cooling_power);
     u0(m,IM2,k,j,i) -= bdt*w0(m,IDN,k,j,i)*uy*pow((temp*cooling_rate), cooling_power);
     u0(m,IM3,k,j,i) -= bdt*w0(m,IDN,k,j,i)*uz*pow((temp*cooling_rate), cooling_power);
-  });
+
+    // add a tiny number
+    Real cooling_heating = FLT_MIN + fabs(w0(m,IDN,k,j,i) * ut *
+                           pow(temp*cooling_rate, cooling_power));
+
+    min_dt = fmin((eint/cooling_heating), min_dt);
+  }, Kokkos::Min<Real>(dt_src));
+  dtnew = dt_src;
+  dtmin_computed = true;
 
   return;
 }
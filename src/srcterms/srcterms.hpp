@@ -42,6 +42,7 @@ class SourceTerms {
 
   // new timestep
   Real dtnew;
+  bool dtmin_computed = false;  // true once a cooling kernel has reduced dtnew in-place
 
   // magnitude and direction of constant accel
   Real const_accel_val;
@@ -50,6 +51,14 @@ class SourceTerms {
   // heating rate used with ISM cooling
   Real hrate;
 
+  // exact integration of ISM cooling (Townsend, MNRAS 397, 478, 2009) on a log-T table
+  bool exact_cooling;
+  int ncool;                      // number of temperature points in rate table
+  Real cool_logtmin, cool_dlogt;  // log10(T) of first table point, and point spacing
+  DualArray1D<Real> cool_lam;     // tabulated cooling rate Lambda(T_n)
+  DualArray1D<Real> cool_alpha;   // power-law slope of Lambda in [T_n, T_n+1]
+  DualArray1D<Real> cool_yf;      // temporal evolution function Y(T_n)
+
   // cooling rate used with relativistic cooling
   Real crate_rel;
   Real cpower_rel;
@@ -65,6 +74,8 @@ class SourceTerms {
                      const Real dt, DvceArray5D<Real> &u0);
   void ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos,
                   const Real dt, DvceArray5D<Real> &u0);
+  void ISMCoolingExact(const DvceArray5D<Real> &w0, const EOS_Data &eos,
+                       const Real dt, DvceArray5D<Real> &u0);
   void RelCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos,
                   const Real dt, DvceArray5D<Real> &u0);
   void BeamSource(DvceArray5D<Real> &i0, const Real dt);
@@ -23,6 +23,11 @@
 //! \brief Compute new timestep for source terms.
 
 void SourceTerms::NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos_data) {
+  // the min-dt reductions below are folded into the ISMCooling()/RelCooling()
+  // application kernels as a side output, so once a stage has run dtnew is already
+  // current (from beginning-of-stage primitives) and the dedicated sweeps here are
+  // only needed at startup, before any source term has been applied
+  if (dtmin_computed) return;
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int is = indcs.is, nx1 = indcs.nx1;
   int js = indcs.js, nx2 = indcs.nx2;
@@ -32,7 +37,8 @@ void SourceTerms::NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos_d
   const int nji  = nx2*nx1;
   dtnew = static_cast<Real>(std::numeric_limits<float>::max());
 
-  if (ism_cooling) {
+  // exact integration (Townsend 2009) is stable for any dt, so it imposes no limit
+  if (ism_cooling && !exact_cooling) {
     Real use_e = eos_data.use_e;
     Real gamma = eos_data.gamma;
     Real gm1 = gamma - 1.0;
@@ -64,6 +64,20 @@ TurbulenceDriver::TurbulenceDriver(MeshBlockPack *pp, ParameterInput *pin) :
   dedt = pin->GetOrAddReal("turb_driving", "dedt", 0.0);
   // correlation time
   tcorr = pin->GetOrAddReal("turb_driving", "tcorr", 0.0);
+  // number of cycles between rebuilds of the force realization.  Between rebuilds the
+  // OU blend in AddForcing() keeps relaxing the force toward the held realization,
+  // which leaves the driving statistics unchanged provided nsteps_regen*dt << tcorr
+  nsteps_regen = pin->GetOrAddInteger("turb_driving", "nsteps_regen", 1);
+  if (nsteps_regen > 1 && tcorr <= 1e-6) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "nsteps_regen > 1 requires correlated driving "
+              << "(tcorr > 0), but tcorr = " << tcorr << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  // optionally generate the random mode amplitudes on a separate host thread (see
+  // TaskList::AddHostTask), so the serial host loop over modes runs concurrently with
+  // device kernels instead of stalling the task list at large nhigh
+  async_host_modes = pin->GetOrAddBoolean("turb_driving", "async_host_modes", false);
 
   Real nlow_sqr = nlow*nlow;
   Real nhigh_sqr = nhigh*nhigh;
@@ -282,8 +296,17 @@ void TurbulenceDriver::Initialize() {
 
 void TurbulenceDriver::IncludeInitializeModesTask(std::shared_ptr<TaskList> tl,
                                                   TaskID start) {
-  auto id_init = tl->AddTask(&TurbulenceDriver::InitializeModes, this, start);
-  auto id_add = tl->AddTask(&TurbulenceDriver::AddForcing, this, id_init);
+  TaskID dep_init = start;
+  if (async_host_modes) {
+    // fill the new random amplitudes on a host thread; InitializeModes() then syncs
+    // them to the device and builds the force realization
+    dep_init = tl->AddHostTask(&TurbulenceDriver::GenerateAmplitudesTask, this, start,
+        "TurbulenceDriver::GenerateAmplitudes");
+  }
+  auto id_init = tl->AddTask(&TurbulenceDriver::InitializeModes, this, dep_init,
+      "TurbulenceDriver::InitializeModes");
+  auto id_add = tl->AddTask(&TurbulenceDriver::AddForcing, this, id_init,
+      "TurbulenceDriver::AddForcing");
   return;
 }
 
@@ -298,52 +321,35 @@ void TurbulenceDriver::IncludeAddForcingTask(std::shared_ptr<TaskList> tl, TaskI
   if (pmy_pack->pionn == nullptr) {
     if (pmy_pack->phydro != nullptr) {
       auto id = tl->InsertTask(&TurbulenceDriver::AddForcing, this,
-                              pmy_pack->phydro->id.flux, pmy_pack->phydro->id.rkupdt);
+                              pmy_pack->phydro->id.flux, pmy_pack->phydro->id.rkupdt,
+          "TurbulenceDriver::AddForcing");
     }
     if (pmy_pack->pmhd != nullptr) {
       auto id = tl->InsertTask(&TurbulenceDriver::AddForcing, this,
-                              pmy_pack->pmhd->id.flux, pmy_pack->pmhd->id.rkupdt);
+                              pmy_pack->pmhd->id.flux, pmy_pack->pmhd->id.rkupdt,
+          "TurbulenceDriver::AddForcing");
     }
   } else {
     auto id = tl->InsertTask(&TurbulenceDriver::AddForcing, this,
-                            pmy_pack->pionn->id.n_flux, pmy_pack->pionn->id.n_rkupdt);
+                            pmy_pack->pionn->id.n_flux, pmy_pack->pionn->id.n_rkupdt,
+        "TurbulenceDriver::AddForcing");
   }
 
   return;
 }
 
 //----------------------------------------------------------------------------------------
-//! \fn InitializeModes()
-// \brief Initializes driving, and so is only executed once at start of calc.
-// Cannot be included in constructor since (it seems) Kokkos::par_for not allowed in cons.
-
-TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
+//! \fn GenerateAmplitudes()
+// \brief Fills the host views of the mode amplitude arrays with a new Gaussian random
+// realization, the target of the OU blend applied in AddForcing().  Pure host-side
+// work with no Kokkos kernel or MPI calls, so with <turb_driving>/async_host_modes it
+// runs on a separate host thread (see TaskList::AddHostTask) concurrently with device
+// kernels; InitializeModes() then syncs the result to the device.
+
+void TurbulenceDriver::GenerateAmplitudes() {
   Mesh *pm = pmy_pack->pmesh;
-  auto &indcs = pmy_pack->pmesh->mb_indcs;
-  int is = indcs.is, ie = indcs.ie;
-  int js = indcs.js, je = indcs.je;
-  int ks = indcs.ks, ke = indcs.ke;
-  int &nx1 = indcs.nx1;
-  int &nx2 = indcs.nx2;
-  int &nx3 = indcs.nx3;
-  auto &gindcs = pm->mesh_indcs;
-  int &gnx1 = gindcs.nx1;
-  int &gnx2 = gindcs.nx2;
-  int &gnx3 = gindcs.nx3;
-
-  // Now compute new force using new random amplitudes and phases
-
-  // Zero out new force array
-  auto force_tmp_ = force_tmp;
-  int &nmb = pmy_pack->nmb_thispack;
-  par_for("force_init", DevExeSpace(),0,nmb-1,0,2,ks,ke,js,je,is,ie,
-  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
-    force_tmp_(m,n,k,j,i) = 0.0;
-  });
-
   int nlow_sqr = SQR(nlow);
   int nhigh_sqr = SQR(nhigh);
-  auto mode_count_ = mode_count;
 
   auto xccc_ = xccc;
   auto xccs_ = xccs;
@@ -353,7 +359,6 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
   auto xscs_ = xscs;
   auto xssc_ = xssc;
   auto xsss_ = xsss;
-
   auto yccc_ = yccc;
   auto yccs_ = yccs;
   auto ycsc_ = ycsc;
@@ -362,7 +367,6 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
   auto yscs_ = yscs;
   auto yssc_ = yssc;
   auto ysss_ = ysss;
-
   auto zccc_ = zccc;
   auto zccs_ = zccs;
   auto zcsc_ = zcsc;
@@ -608,6 +612,90 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
       }
     }
   }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn RegenThisCycle()
+// \brief Returns true on cycles where a new force realization is built; shared by the
+// amplitude-generation and mode-initialization tasks so both skip the same cycles
+
+bool TurbulenceDriver::RegenThisCycle() {
+  return first_time || ((pmy_pack->pmesh->ncycle % nsteps_regen) == 0);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn GenerateAmplitudesTask()
+// \brief Task wrapper over GenerateAmplitudes(), enrolled via AddHostTask() when
+// <turb_driving>/async_host_modes is set
+
+TaskStatus TurbulenceDriver::GenerateAmplitudesTask(Driver *pdrive, int stage) {
+  if (RegenThisCycle()) {GenerateAmplitudes();}
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn InitializeModes()
+// \brief Initializes driving, and so is only executed once at start of calc.
+// Cannot be included in constructor since (it seems) Kokkos::par_for not allowed in cons.
+
+TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
+  Mesh *pm = pmy_pack->pmesh;
+  // Amortized regeneration: new random amplitudes only refresh the target of the OU
+  // blend applied in AddForcing(), so on intermediate cycles the rebuild (and its
+  // global reductions) can be skipped and the previous realization reused.  Always
+  // rebuild on the first call since force_tmp is empty at startup and on restart
+  if (!(RegenThisCycle())) {
+    return TaskStatus::complete;
+  }
+  first_time = false;
+  // fill the host views of the amplitude arrays with the new random realization (with
+  // async_host_modes this was already done by the concurrent host task)
+  if (!async_host_modes) {GenerateAmplitudes();}
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  int &nx1 = indcs.nx1;
+  int &nx2 = indcs.nx2;
+  int &nx3 = indcs.nx3;
+  auto &gindcs = pm->mesh_indcs;
+  int &gnx1 = gindcs.nx1;
+  int &gnx2 = gindcs.nx2;
+  int &gnx3 = gindcs.nx3;
+
+  // Now compute new force using new random amplitudes and phases
+  auto force_tmp_ = force_tmp;
+  int &nmb = pmy_pack->nmb_thispack;
+
+  auto mode_count_ = mode_count;
+
+  auto xccc_ = xccc;
+  auto xccs_ = xccs;
+  auto xcsc_ = xcsc;
+  auto xcss_ = xcss;
+  auto xscc_ = xscc;
+  auto xscs_ = xscs;
+  auto xssc_ = xssc;
+  auto xsss_ = xsss;
+
+  auto yccc_ = yccc;
+  auto yccs_ = yccs;
+  auto ycsc_ = ycsc;
+  auto ycss_ = ycss;
+  auto yscc_ = yscc;
+  auto yscs_ = yscs;
+  auto yssc_ = yssc;
+  auto ysss_ = ysss;
+
+  auto zccc_ = zccc;
+  auto zccs_ = zccs;
+  auto zcsc_ = zcsc;
+  auto zcss_ = zcss;
+  auto zscc_ = zscc;
+  auto zscs_ = zscs;
+  auto zssc_ = zssc;
+  auto zsss_ = zsss;
 
   xccc_.template modify<HostMemSpace>();
   xccc_.template sync<DevExeSpace>();
@@ -667,37 +755,39 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
   auto zcos_ = zcos;
   auto zsin_ = zsin;
 
-  for (int n=0; n<mode_count_; n++) {
-    par_for("force_compute", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
-    KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      force_tmp_(m,0,k,j,i) += xccc_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xccs_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xcsc_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xcss_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xscc_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xscs_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xssc_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xsss_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-
-      force_tmp_(m,1,k,j,i) += yccc_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yccs_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,1,k,j,i) += ycsc_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += ycss_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yscc_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yscs_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yssc_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += ysss_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-
-      force_tmp_(m,2,k,j,i) += zccc_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zccs_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zcsc_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zcss_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zscc_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zscs_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zssc_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zsss_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-    });
-  }
+  // Sum over modes in a single kernel with the force components accumulated in
+  // registers.  Launching one full-grid kernel per mode (as done previously) streams
+  // the 5D force array through memory O(mode_count) times, which dominates the cost of
+  // the update long before the trig products do and makes large mode counts
+  // infeasible; here the force array is written exactly once however many modes drive
+  par_for("force_compute", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real fx = 0.0, fy = 0.0, fz = 0.0;
+    for (int n=0; n<mode_count_; ++n) {
+      Real xc = xcos_(m,n,i), xs = xsin_(m,n,i);
+      Real yc = ycos_(m,n,j), ys = ysin_(m,n,j);
+      Real zc = zcos_(m,n,k), zs = zsin_(m,n,k);
+      Real cc = xc*yc, cs = xc*ys, sc = xs*yc, ss = xs*ys;
+
+      fx += (xccc_.d_view(n)*cc + xcsc_.d_view(n)*cs
+           + xscc_.d_view(n)*sc + xssc_.d_view(n)*ss)*zc
+          + (xccs_.d_view(n)*cc + xcss_.d_view(n)*cs
+           + xscs_.d_view(n)*sc + xsss_.d_view(n)*ss)*zs;
+
+      fy += (yccc_.d_view(n)*cc + ycsc_.d_view(n)*cs
+           + yscc_.d_view(n)*sc + yssc_.d_view(n)*ss)*zc
+          + (yccs_.d_view(n)*cc + ycss_.d_view(n)*cs
+           + yscs_.d_view(n)*sc + ysss_.d_view(n)*ss)*zs;
+
+      fz += (zccc_.d_view(n)*cc + zcsc_.d_view(n)*cs
+           + zscc_.d_view(n)*sc + zssc_.d_view(n)*ss)*zc
+          + (zccs_.d_view(n)*cc + zcss_.d_view(n)*cs
+           + zscs_.d_view(n)*sc + zsss_.d_view(n)*ss)*zs;
+    }
+    force_tmp_(m,0,k,j,i) = fx;
+    force_tmp_(m,1,k,j,i) = fy;
+    force_tmp_(m,2,k,j,i) = fz;
+  });
 
   DvceArray5D<Real> u0, u0_;
   if (pmy_pack->phydro != nullptr) u0 = (pmy_pack->phydro->u0);
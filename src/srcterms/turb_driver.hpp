@@ -39,10 +39,13 @@ class TurbulenceDriver {
   Real tcorr, dedt;
   Real expo, exp_prl, exp_prp;
   int driving_type;
+  int nsteps_regen;  // number of cycles between force realization rebuilds
+  bool async_host_modes;  // generate random amplitudes on a concurrent host thread
 
   // functions
   void IncludeInitializeModesTask(std::shared_ptr<TaskList> tl, TaskID start);
   void IncludeAddForcingTask(std::shared_ptr<TaskList> tl, TaskID start);
+  TaskStatus GenerateAmplitudesTask(Driver *pdrive, int stage);
   TaskStatus InitializeModes(Driver *pdrive, int stage);
   TaskStatus AddForcing(Driver *pdrive, int stage);
   void Initialize();
@@ -50,6 +53,8 @@ class TurbulenceDriver {
  private:
   bool first_time = true;   // flag to enable initialization on first call
   MeshBlockPack *pmy_pack;  // ptr to MeshBlockPack containing this TurbulenceDriver
+  bool RegenThisCycle();
+  void GenerateAmplitudes();
 };
 
 #endif  // SRCTERMS_TURB_DRIVER_HPP_
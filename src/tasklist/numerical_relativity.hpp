@@ -32,7 +32,6 @@ enum TaskName {
   MHD_Recv,
   MHD_CopyU,
   MHD_Flux,
-  MHD_SetTmunu,
   MHD_SendFlux,
   MHD_RecvFlux,
   MHD_ExplRK,
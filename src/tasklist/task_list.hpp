@@ -13,13 +13,20 @@
 // This version includes improvements due to Josh Dolence and the Parthenon dev team, and
 // extensions by J.M.Stone.
 
+#include <chrono>
+#include <cstdint>
+#include <future>
 #include <iostream>
 #include <bitset>
 #include <functional>
+#include <memory>
+#include <string>
 #include <vector>
 #include <list>
 #include <iterator>
 
+#include <Kokkos_Core.hpp>
+
 class Driver;
 
 // Maximum size of TL
@@ -86,12 +93,19 @@ class TaskID {
 
 class Task {
  public:
-  Task(TaskID id, TaskID dep, std::function<TaskStatus(Driver*, int)> func) :
-  myid_(id), dep_(dep), func_(func) {}
+  Task(TaskID id, TaskID dep, std::function<TaskStatus(Driver*, int)> func,
+       std::string name) :
+  myid_(id), dep_(dep), func_(func), name_(name) {}
   // overloaded operator() calls task function
   TaskStatus operator()(Driver *d, int s) {return func_(d,s);}
   TaskID GetID() {return myid_;}
   TaskID GetDependency() {return dep_;}
+  std::string GetName() {return name_;}
+  // priority only breaks ties between simultaneously-ready tasks; it never overrides
+  // dependencies.  >0 runs ahead of default work (e.g. MPI sends), <0 runs last
+  // (e.g. polling receives)
+  int GetPriority() {return priority_;}
+  void SetPriority(int p) {priority_ = p;}
   void SetComplete() {complete_ = true;}
   void SetIncomplete() {complete_ = false;}
   bool IsComplete() {return complete_;}
@@ -100,12 +114,44 @@ class Task {
     if ((dep_ & id) == id) {dep_ = ((dep_ ^ id) | newdep);}
   }
 
+  // accumulated wallclock timing, filled by TaskList::DoAvailable() when task timing is
+  // enabled.  "exec" counts calls that completed the task, "poll" counts calls that
+  // returned incomplete (e.g. probing for MPI messages that have not arrived).  Note
+  // times measure the host-side call, which includes any fences internal to the task
+  // but not asynchronous kernel execution after the task returns.
+  double time_exec = 0.0;
+  double time_poll = 0.0;
+  std::int64_t ncalls = 0;
+  std::int64_t npolls = 0;
+
  private:
   TaskID myid_;    // encodes task ID in bitfld_
   TaskID dep_;     // encodes dependencies to other tasks in bitfld_
   // bool lb_time_;   // flag to include this task in timing for automatic load balancing
   bool complete_ = false;
+  int priority_ = 0;
   std::function<TaskStatus(Driver*, int)> func_;  // ptr to Task function
+  std::string name_;  // label used in timing reports and traces
+};
+
+//----------------------------------------------------------------------------------------
+//! \struct TaskTrace
+//  \brief global (per-rank) buffer of task execution intervals recorded by
+//  TaskList::DoAvailable() when tracing is active.  The Driver toggles 'active' for
+//  cycles inside the trace window set by <time>/task_trace_start/stop, and exports the
+//  buffer in Chrome tracing JSON format at the end of the run.
+
+struct TaskTrace {
+  struct Event {
+    std::string name;    // task name
+    double start, stop;  // seconds since 'clock' epoch
+    int stage;           // integrator stage ("tid" row in trace viewers)
+    int cycle;
+  };
+  inline static bool active = false;
+  inline static int cycle = 0;
+  inline static std::vector<Event> events;
+  inline static Kokkos::Timer clock;  // common time base for all events on this rank
 };
 
 //----------------------------------------------------------------------------------------
@@ -129,7 +175,20 @@ class TaskList {
   }
   int Size() {return task_list_.size();}
   bool Empty() {return task_list_.empty();}
+  std::list<Task> &GetTasks() {return task_list_;}
+  // enables per-task timers in DoAvailable(); set by Driver from <time>/task_timing
+  inline static bool timing = false;
+  // wraps every task call in a Kokkos Profiling region named after the task, so kernels
+  // in external profiler timelines (Nsight, rocprof) map to the physics/phase/task that
+  // launched them; set by Driver from <time>/profiling_regions
+  inline static bool profiling_regions = false;
   void MarkTaskComplete(TaskID id) { tasks_completed_.SetComplete(id); }
+  // set scheduling priority of task with given ID (see Task::SetPriority)
+  void SetPriority(TaskID id, int p) {
+    for (auto &it : task_list_) {
+      if (it.GetID() == id) {it.SetPriority(p);}
+    }
+  }
   TaskID GetIDLastTask() {return task_list_.back().GetID();}
   // output diagnostics (useful for debugging)
   void PrintIDs() { for (auto &it : task_list_) {it.GetID().PrintID();} }
@@ -139,58 +198,150 @@ class TaskList {
   void Reset() {
     tasks_completed_.Clear();  // TaskID Clear() fn
     for (auto &it : task_list_) { it.SetIncomplete(); }
+    queues_stale_ = true;
   }
 
-  // cycle through task list once, do any tasks whose dependencies are clear
+  // Launch any tasks whose dependencies are clear, in order of availability rather than
+  // the fixed order in which tasks were added.  Tasks are kept in two queues: a ready
+  // queue of tasks whose dependencies are all satisfied, and a waiting queue for the
+  // rest.  Tasks that return incomplete (e.g. a pending MPI receive) are rotated to the
+  // back of the ready queue, so independent work (such as flux kernels for interior
+  // MeshBlocks) is launched while messages are still in flight, instead of being polled
+  // behind the stalled task in list order.  When a task completes, any waiting tasks it
+  // unblocks are moved to the ready queue and may run in this same pass.
   TaskListStatus DoAvailable(Driver *d, int s) {
-    for (auto &task : task_list_) {
-      auto dep = task.GetDependency();
-      if ( tasks_completed_.CheckDependencies(dep) && !(task.IsComplete()) ) {
-        TaskStatus status = task(d,s);  // calls Task function using overloaded operator()
-        if (status == TaskStatus::complete) {
-          task.SetComplete();              // set bool flag in task
-          MarkTaskComplete(task.GetID());  // add TaskID to tasks_completed_
+    if (queues_stale_) {BuildQueues();}
+    std::size_t ntodo = ready_.size();
+    for (std::size_t n=0; n<ntodo; ++n) {
+      Task* ptask = ready_.front();
+      ready_.pop_front();
+      TaskStatus status;
+      if (profiling_regions) {Kokkos::Profiling::pushRegion(ptask->GetName());}
+      if (timing || TaskTrace::active) {
+        // accumulate wallclock of host-side call, split by completed/incomplete returns
+        double tstart = TaskTrace::clock.seconds();
+        status = (*ptask)(d,s);
+        double tstop = TaskTrace::clock.seconds();
+        if (timing) {
+          if (status == TaskStatus::complete) {
+            ptask->time_exec += (tstop - tstart);
+            ptask->ncalls++;
+          } else {
+            ptask->time_poll += (tstop - tstart);
+            ptask->npolls++;
+          }
+        }
+        if (TaskTrace::active) {
+          TaskTrace::events.push_back({ptask->GetName(), tstart, tstop, s,
+                                       TaskTrace::cycle});
+        }
+      } else {
+        status = (*ptask)(d,s);  // calls Task function via overloaded operator()
+      }
+      if (profiling_regions) {Kokkos::Profiling::popRegion();}
+      if (status == TaskStatus::complete) {
+        ptask->SetComplete();              // set bool flag in task
+        MarkTaskComplete(ptask->GetID());  // add TaskID to tasks_completed_
+        // move any tasks unblocked by this completion to ready queue, and extend this
+        // pass so they are launched immediately
+        auto it = waiting_.begin();
+        bool promoted = false;
+        while (it != waiting_.end()) {
+          if (tasks_completed_.CheckDependencies((*it)->GetDependency())) {
+            ready_.push_back(*it);
+            it = waiting_.erase(it);
+            ntodo++;
+            promoted = true;
+          } else {
+            ++it;
+          }
         }
+        // keep ready queue ordered by priority; stable sort preserves rotation order
+        // of equal-priority tasks
+        if (promoted) {SortReady();}
+      } else {
+        // task stalled (or failed); re-queue at back so other ready tasks run first
+        ready_.push_back(ptask);
       }
     }
-    if (IsComplete()) return TaskListStatus::complete;
+    if (ready_.empty() && waiting_.empty()) return TaskListStatus::complete;
     return TaskListStatus::running;
   }
 
   // ADD new Task with ID, given dependency, and a pointer to a static or non-member
   // function to the end of task list.  Returns ID of new task. Task function must have
-  // arguments (Driver*, int). Usage:
-  //     taskid = tl.AddTask(DoSomething, dependency, name);
+  // arguments (Driver*, int). Optional name labels the task in timing reports. Usage:
+  //     taskid = tl.AddTask(DoSomething, dependency, "DoSomething");
   template <class F>
-  TaskID AddTask(F func, TaskID &dep) {
+  TaskID AddTask(F func, TaskID &dep, std::string name = "") {
     auto size = task_list_.size();
     TaskID id(size+1);
+    if (name.empty()) {name = "task" + std::to_string(size+1);}
     task_list_.push_back(
-      Task(id, dep, [=](Driver *d, int s) mutable -> TaskStatus {return func(d,s);}));
+      Task(id, dep, [=](Driver *d, int s) mutable -> TaskStatus {return func(d,s);},
+           name));
     return id;
   }
 
   // ADD new Task with ID, given dependency, and a pointer to a member function of
   // class T to the end of task list.  Returns ID of new task. Task function must have
-  // arguments (Driver*, int).  Usage:
-  //     taskid = tl.AddTask(&T::DoSomething, T, dependency);
+  // arguments (Driver*, int).  Optional name labels the task in timing reports. Usage:
+  //     taskid = tl.AddTask(&T::DoSomething, T, dependency, "T::DoSomething");
   template <class F, class T>
-  TaskID AddTask(F func, T *obj, TaskID &dep) {
+  TaskID AddTask(F func, T *obj, TaskID &dep, std::string name = "") {
     auto size = task_list_.size();
     TaskID id(size+1);
+    if (name.empty()) {name = "task" + std::to_string(size+1);}
     task_list_.push_back( Task(id, dep,
-       [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s);}) );
+       [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s);}, name) );
+    return id;
+  }
+
+  // ADD new Task that executes asynchronously on a host thread, from a pointer to a
+  // member function of class T.  The first call launches the function on a separate
+  // thread and returns incomplete; subsequent calls poll the thread and return its
+  // status once it has finished.  DoAvailable() therefore overlaps the host work with
+  // device kernels launched by other ready tasks, exactly as it overlaps tasks polling
+  // for MPI messages.  Host task functions must touch only host-resident data: no
+  // device kernel launches, no deep copies to/from device memory, and no MPI calls,
+  // none of which are safe from a second thread here.  Data moving between spaces
+  // should be staged by ordinary tasks adjacent in the dependency graph (e.g. a task
+  // that syncs a DualView filled on the host by a preceding host task).  Usage:
+  //     taskid = tl.AddHostTask(&T::DoSomething, T, dependency, "T::DoSomething");
+  template <class F, class T>
+  TaskID AddHostTask(F func, T *obj, TaskID &dep, std::string name = "") {
+    auto size = task_list_.size();
+    TaskID id(size+1);
+    if (name.empty()) {name = "task" + std::to_string(size+1);}
+    // shared future holds the per-task launch state inside the (copyable) closure; it
+    // is emptied again when the result is harvested, re-arming the task for its next
+    // execution after Reset()
+    auto fut = std::make_shared<std::future<TaskStatus>>();
+    task_list_.push_back(Task(id, dep,
+       [=](Driver *d, int s) mutable -> TaskStatus {
+         if (!(fut->valid())) {
+           *fut = std::async(std::launch::async,
+                             [=]() -> TaskStatus {return (obj->*func)(d,s);});
+           return TaskStatus::incomplete;
+         }
+         if (fut->wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+           return TaskStatus::incomplete;
+         }
+         return fut->get();
+       }, name));
     return id;
   }
 
   // ADD new Task with ID, given dependency, and a std::function to the end of task
   // list. Returns ID of new task. Task function must have arguments (Driver*, int).
-  // Usage:
-  //      taskid = tl.AddTask(DoSomething, dependency);
-  TaskID AddTask(std::function<TaskStatus(Driver*, int)> func, TaskID &dep) {
+  // Optional name labels the task in timing reports. Usage:
+  //      taskid = tl.AddTask(DoSomething, dependency, "DoSomething");
+  TaskID AddTask(std::function<TaskStatus(Driver*, int)> func, TaskID &dep,
+                 std::string name = "") {
     auto size = task_list_.size();
     TaskID id(size+1);
-    task_list_.push_back(Task(id, dep, func));
+    if (name.empty()) {name = "task" + std::to_string(size+1);}
+    task_list_.push_back(Task(id, dep, func, name));
     return id;
   }
 
@@ -199,15 +350,17 @@ class TaskList {
   // or taskID(0) if location not found. Usage:
   //     taskid = tl.InsertTask(&T::DoSomething, T, dependency, location);
   template <class F, class T>
-  TaskID InsertTask(F func, T *obj, TaskID &dep, TaskID &loc) {
+  TaskID InsertTask(F func, T *obj, TaskID &dep, TaskID &loc, std::string name = "") {
     std::list<Task>::iterator it;
     for (it=task_list_.begin(); it!=task_list_.end(); ++it) {
       if (it->GetID() == loc) {
         auto size = task_list_.size();
         TaskID id(size+1);
+        if (name.empty()) {name = "task" + std::to_string(size+1);}
         auto old_dep = it->GetDependency();
         task_list_.insert(it, Task(id, dep,
-           [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s); }));
+           [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s); },
+           name));
         // now change dependencies for all but this newly added Task
         for (auto it2=task_list_.begin(); it2!=task_list_.end(); ++it2) {
           if (it2->GetID() != id) {
@@ -223,6 +376,31 @@ class TaskList {
  protected:
   std::list<Task> task_list_;
   TaskID tasks_completed_;
+  // scheduling queues used by DoAvailable(); rebuilt whenever the list is Reset() since
+  // AddTask/InsertTask may be called between executions (e.g. on AMR regrids)
+  std::list<Task*> ready_, waiting_;
+  bool queues_stale_ = true;
+
+  // partition tasks into ready/waiting queues based on current completion state
+  void BuildQueues() {
+    ready_.clear();
+    waiting_.clear();
+    for (auto &task : task_list_) {
+      if (task.IsComplete()) continue;
+      if (tasks_completed_.CheckDependencies(task.GetDependency())) {
+        ready_.push_back(&task);
+      } else {
+        waiting_.push_back(&task);
+      }
+    }
+    SortReady();
+    queues_stale_ = false;
+  }
+
+  // order ready queue by decreasing priority (std::list::sort is stable)
+  void SortReady() {
+    ready_.sort([](Task *a, Task *b) {return a->GetPriority() > b->GetPriority();});
+  }
 };
 
 #endif  // TASKLIST_TASK_LIST_HPP_
@@ -0,0 +1,322 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file c2p_benchmark.cpp
+//! \brief Standalone microbenchmark for the conserved-to-primitive inversions. Fills
+//! device arrays with representative state distributions (atmosphere, bulk flow, and a
+//! high-Lorentz-factor tail), builds consistent conserved states with the SingleP2C
+//! functions, and then times repeated inversions for Newtonian hydro, SR hydro, SR MHD
+//! (across iteration caps), and the PrimitiveSolver ideal-gas variant. Built as the
+//! optional 'c2p_benchmark' target (-D Athena_BUILD_C2P_BENCHMARK=ON); it allows solver
+//! changes to be evaluated without running full simulations.
+//!
+//! Usage: c2p_benchmark [ncells] [nrep]
+//! Precision follows the build (Athena_SINGLE_PRECISION); it is printed in the header.
+
+// C headers
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+
+// C++ headers
+#include <cstdlib>
+#include <string>
+
+// Kokkos headers
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+// AthenaK headers
+#include "athena.hpp"
+#include "eos/eos.hpp"
+#include "eos/ideal_c2p_hyd.hpp"
+#include "eos/ideal_c2p_mhd.hpp"
+#include "eos/primitive-solver/idealgas.hpp"
+#include "eos/primitive-solver/reset_floor.hpp"
+#include "eos/primitive-solver/primitive_solver.hpp"
+
+namespace {
+
+//----------------------------------------------------------------------------------------
+//! \fn void SampleState()
+//! \brief Draws one primitive state from the mixture of populations seen in production
+//! runs: near-floor atmosphere, bulk flow with modest velocities and magnetization, and
+//! a rare high-Lorentz-factor, strongly magnetized tail. Velocities are the spatial
+//! components of the 4-velocity, as stored by the SR/GR solvers.
+
+template <class RNG>
+KOKKOS_INLINE_FUNCTION
+void SampleState(RNG &rand_gen, const EOS_Data &eos, MHDPrim1D &w) {
+  Real sel = rand_gen.frand();
+  Real umag, sigma;
+  if (sel < 0.15) {
+    // atmosphere: near-floor density/energy, nearly static
+    w.d = eos.dfloor*(1.0 + rand_gen.frand());
+    w.e = (eos.pfloor/(eos.gamma - 1.0))*(1.0 + rand_gen.frand());
+    umag = 1.0e-6*rand_gen.frand();
+    sigma = 100.0*rand_gen.frand();  // atmosphere is typically magnetically dominated
+  } else if (sel < 0.95) {
+    // bulk: log-uniform density, p/rho in [1e-3,1], |u| < 2, sigma < 1
+    w.d = pow(10.0, -2.0 + 4.0*rand_gen.frand());
+    w.e = w.d*pow(10.0, -3.0 + 3.0*rand_gen.frand())/(eos.gamma - 1.0);
+    umag = 2.0*rand_gen.frand();
+    sigma = rand_gen.frand();
+  } else {
+    // high-Lorentz tail: W up to ~half the ceiling, strongly magnetized
+    w.d = pow(10.0, -6.0 + 4.0*rand_gen.frand());
+    w.e = w.d*pow(10.0, -2.0 + 2.0*rand_gen.frand())/(eos.gamma - 1.0);
+    Real wlor = 5.0 + (0.5*eos.gamma_max - 5.0)*rand_gen.frand();
+    umag = sqrt(wlor*wlor - 1.0);
+    sigma = 10.0 + 90.0*rand_gen.frand();
+  }
+  // isotropic direction for the velocity; field along a second random direction
+  Real cth = 2.0*rand_gen.frand() - 1.0;
+  Real sth = sqrt(fmax(1.0 - cth*cth, 0.0));
+  Real phi = 2.0*M_PI*rand_gen.frand();
+  w.vx = umag*sth*cos(phi);
+  w.vy = umag*sth*sin(phi);
+  w.vz = umag*cth;
+  Real bmag = sqrt(sigma*w.d);
+  cth = 2.0*rand_gen.frand() - 1.0;
+  sth = sqrt(fmax(1.0 - cth*cth, 0.0));
+  phi = 2.0*M_PI*rand_gen.frand();
+  w.bx = bmag*sth*cos(phi);
+  w.by = bmag*sth*sin(phi);
+  w.bz = bmag*cth;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real TimeKernel()
+//! \brief Runs one untimed warm-up repetition followed by nrep timed repetitions of
+//! func, fencing around the timed section, and returns the elapsed wall-clock time.
+
+template <class Function>
+Real TimeKernel(const int nrep, const Function &func) {
+  func();
+  Kokkos::fence();
+  Kokkos::Timer timer;
+  for (int r=0; r<nrep; ++r) {
+    func();
+  }
+  Kokkos::fence();
+  return timer.seconds();
+}
+
+void PrintRate(const char *name, const int ncells, const int nrep, const Real time) {
+  Real rate = 1.0e-6*static_cast<Real>(ncells)*static_cast<Real>(nrep)/time;
+  printf("%-28s %12.4e s  %10.2f Minv/s\n", name, time, rate);
+}
+
+}  // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn int main()
+
+int main(int argc, char *argv[]) {
+  int ncells = (argc > 1) ? atoi(argv[1]) : 4194304;
+  int nrep   = (argc > 2) ? atoi(argv[2]) : 20;
+
+  Kokkos::initialize(argc, argv);
+  {
+  printf("AthenaK c2p microbenchmark: ncells=%d, nrep=%d, %s precision\n",
+         ncells, nrep, (sizeof(Real) == 4) ? "single" : "double");
+
+  // EOS parameters representative of SR/GR production runs
+  EOS_Data eos;
+  eos.gamma = 5.0/3.0;
+  eos.iso_cs = 0.0;
+  eos.is_ideal = true;
+  eos.use_e = true;
+  eos.use_t = false;
+  eos.dfloor = 1.0e-8;
+  eos.pfloor = 1.0e-10;
+  eos.tfloor = static_cast<Real>(FLT_MIN);
+  eos.sfloor = static_cast<Real>(FLT_MIN);
+  eos.gamma_max = 50.0;
+  eos.c2p_tol = 1.0e-12;
+  eos.c2p_tol_loose = 1.0e-8;
+  eos.c2p_tol_adapt = false;
+
+  // conserved states for each solver family, built from the same primitive samples
+  DvceArray2D<Real> u_hyd("u_hyd", 5, ncells);
+  DvceArray2D<Real> u_srhyd("u_srhyd", 5, ncells);
+  DvceArray2D<Real> u_srmhd("u_srmhd", 8, ncells);
+  DvceArray2D<Real> u_ps("u_ps", NCONS, ncells);
+  DvceArray2D<Real> b_ps("b_ps", NMAG, ncells);
+  DvceArray2D<Real> wout("wout", 8, ncells);
+
+  // PrimitiveSolver with the ideal-gas policy, matching the EOS_Data above
+  Primitive::PrimitiveSolver<Primitive::IdealGas, Primitive::ResetFloor> ps;
+  ps.GetEOSMutable().SetGamma(eos.gamma);
+  ps.GetEOSMutable().SetNSpecies(0);
+  ps.GetEOSMutable().SetDensityFloor(eos.dfloor);
+  ps.GetEOSMutable().SetTemperatureFloor(eos.tfloor);
+  Real vmax = sqrt(1.0 - 1.0/SQR(eos.gamma_max));
+  ps.GetEOSMutable().SetMaxVelocity(vmax);
+  Real mb = ps.GetEOS().GetBaryonMass();
+  auto &eos_ps = ps.GetEOS();
+
+  // sample primitives and build consistent conserved states for every solver family
+  Kokkos::Random_XorShift64_Pool<> rand_pool64(1);
+  par_for("c2p_bench_init", DevExeSpace(), 0, (ncells-1),
+  KOKKOS_LAMBDA(const int idx) {
+    auto rand_gen = rand_pool64.get_state();
+    MHDPrim1D w;
+    SampleState(rand_gen, eos, w);
+    rand_pool64.free_state(rand_gen);
+
+    // Newtonian hydro (4-velocity components reinterpreted as plain velocities)
+    HydPrim1D wh;
+    wh.d = w.d; wh.vx = w.vx; wh.vy = w.vy; wh.vz = w.vz; wh.e = w.e;
+    HydCons1D u;
+    SingleP2C_IdealHyd(wh, u);
+    u_hyd(IDN,idx) = u.d;  u_hyd(IM1,idx) = u.mx;
+    u_hyd(IM2,idx) = u.my; u_hyd(IM3,idx) = u.mz;
+    u_hyd(IEN,idx) = u.e;
+
+    // SR hydro
+    SingleP2C_IdealSRHyd(wh, eos.gamma, u);
+    u_srhyd(IDN,idx) = u.d;  u_srhyd(IM1,idx) = u.mx;
+    u_srhyd(IM2,idx) = u.my; u_srhyd(IM3,idx) = u.mz;
+    u_srhyd(IEN,idx) = u.e;
+
+    // SR MHD
+    SingleP2C_IdealSRMHD(w, eos.gamma, u);
+    u_srmhd(IDN,idx) = u.d;  u_srmhd(IM1,idx) = u.mx;
+    u_srmhd(IM2,idx) = u.my; u_srmhd(IM3,idx) = u.mz;
+    u_srmhd(IEN,idx) = u.e;
+    u_srmhd(5,idx) = w.bx; u_srmhd(6,idx) = w.by; u_srmhd(7,idx) = w.bz;
+
+    // PrimitiveSolver, flat metric
+    Real g3d[NSPMETRIC] = {1.0, 0.0, 0.0, 1.0, 0.0, 1.0};
+    Real prim_pt[NPRIM], cons_pt[NCONS], b[NMAG];
+    prim_pt[PRH] = w.d/mb;
+    prim_pt[PVX] = w.vx;
+    prim_pt[PVY] = w.vy;
+    prim_pt[PVZ] = w.vz;
+    prim_pt[PPR] = (eos.gamma - 1.0)*w.e;
+    Real Y[MAX_SPECIES] = {0.0};
+    prim_pt[PTM] = eos_ps.GetTemperatureFromP(prim_pt[PRH], prim_pt[PPR], Y);
+    b[IBX] = w.bx; b[IBY] = w.by; b[IBZ] = w.bz;
+    ps.PrimToCon(prim_pt, cons_pt, b, g3d);
+    for (int n=0; n<NCONS; ++n) { u_ps(n,idx) = cons_pt[n]; }
+    for (int n=0; n<NMAG; ++n)  { b_ps(n,idx) = b[n]; }
+  });
+
+  //--- Newtonian ideal hydro ------------------------------------------------------------
+  Real wtime = TimeKernel(nrep, [&]() {
+    par_for("c2p_bench_hyd", DevExeSpace(), 0, (ncells-1),
+    KOKKOS_LAMBDA(const int idx) {
+      HydCons1D u;
+      u.d  = u_hyd(IDN,idx);
+      u.mx = u_hyd(IM1,idx); u.my = u_hyd(IM2,idx); u.mz = u_hyd(IM3,idx);
+      u.e  = u_hyd(IEN,idx);
+      HydPrim1D w;
+      bool dfloor_used=false, efloor_used=false, tfloor_used=false;
+      SingleC2P_IdealHyd(u, eos, w, dfloor_used, efloor_used, tfloor_used);
+      wout(IDN,idx) = w.d;
+      wout(IVX,idx) = w.vx; wout(IVY,idx) = w.vy; wout(IVZ,idx) = w.vz;
+      wout(IEN,idx) = w.e;
+    });
+  });
+  PrintRate("ideal_hyd", ncells, nrep, wtime);
+
+  //--- SR ideal hydro -------------------------------------------------------------------
+  wtime = TimeKernel(nrep, [&]() {
+    par_for("c2p_bench_srhyd", DevExeSpace(), 0, (ncells-1),
+    KOKKOS_LAMBDA(const int idx) {
+      HydCons1D u;
+      u.d  = u_srhyd(IDN,idx);
+      u.mx = u_srhyd(IM1,idx); u.my = u_srhyd(IM2,idx); u.mz = u_srhyd(IM3,idx);
+      u.e  = u_srhyd(IEN,idx);
+      Real s2 = SQR(u.mx) + SQR(u.my) + SQR(u.mz);
+      HydPrim1D w;
+      bool dfloor_used=false, efloor_used=false, c2p_failure=false;
+      int iter_used=0;
+      SingleC2P_IdealSRHyd(u, eos, s2, w, dfloor_used, efloor_used, c2p_failure,
+                           iter_used);
+      wout(IDN,idx) = w.d;
+      wout(IVX,idx) = w.vx; wout(IVY,idx) = w.vy; wout(IVZ,idx) = w.vz;
+      wout(IEN,idx) = w.e;
+    });
+  });
+  PrintRate("ideal_srhyd", ncells, nrep, wtime);
+
+  //--- SR ideal MHD, across iteration caps ----------------------------------------------
+  const int caps[3] = {8, 25, 50};
+  for (int c=0; c<3; ++c) {
+    const int iter_cap = caps[c];
+    wtime = TimeKernel(nrep, [&]() {
+      par_for("c2p_bench_srmhd", DevExeSpace(), 0, (ncells-1),
+      KOKKOS_LAMBDA(const int idx) {
+        MHDCons1D u;
+        u.d  = u_srmhd(IDN,idx);
+        u.mx = u_srmhd(IM1,idx); u.my = u_srmhd(IM2,idx); u.mz = u_srmhd(IM3,idx);
+        u.e  = u_srmhd(IEN,idx);
+        u.bx = u_srmhd(5,idx); u.by = u_srmhd(6,idx); u.bz = u_srmhd(7,idx);
+        Real s2 = SQR(u.mx) + SQR(u.my) + SQR(u.mz);
+        Real b2 = SQR(u.bx) + SQR(u.by) + SQR(u.bz);
+        Real rpar = (u.bx*u.mx + u.by*u.my + u.bz*u.mz)/u.d;
+        HydPrim1D w;
+        bool dfloor_used=false, efloor_used=false, c2p_failure=false;
+        int max_iter=0;
+        Real mu = 0.0;  // cold start every repetition
+        SingleC2P_IdealSRMHD(u, eos, s2, b2, rpar, w, dfloor_used, efloor_used,
+                             c2p_failure, max_iter, mu, iter_cap);
+        wout(IDN,idx) = w.d;
+        wout(IVX,idx) = w.vx; wout(IVY,idx) = w.vy; wout(IVZ,idx) = w.vz;
+        wout(IEN,idx) = w.e;
+      });
+    });
+    char name[40];
+    snprintf(name, sizeof(name), "ideal_srmhd (iter_cap=%d)", iter_cap);
+    PrintRate(name, ncells, nrep, wtime);
+
+    // failure fraction for this cap, so rates can be weighed against robustness
+    int nfail = 0;
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<>(DevExeSpace(), 0, ncells),
+    KOKKOS_LAMBDA(const int idx, int &fsum) {
+      MHDCons1D u;
+      u.d  = u_srmhd(IDN,idx);
+      u.mx = u_srmhd(IM1,idx); u.my = u_srmhd(IM2,idx); u.mz = u_srmhd(IM3,idx);
+      u.e  = u_srmhd(IEN,idx);
+      u.bx = u_srmhd(5,idx); u.by = u_srmhd(6,idx); u.bz = u_srmhd(7,idx);
+      Real s2 = SQR(u.mx) + SQR(u.my) + SQR(u.mz);
+      Real b2 = SQR(u.bx) + SQR(u.by) + SQR(u.bz);
+      Real rpar = (u.bx*u.mx + u.by*u.my + u.bz*u.mz)/u.d;
+      HydPrim1D w;
+      bool dfloor_used=false, efloor_used=false, c2p_failure=false;
+      int max_iter=0;
+      Real mu = 0.0;
+      SingleC2P_IdealSRMHD(u, eos, s2, b2, rpar, w, dfloor_used, efloor_used,
+                           c2p_failure, max_iter, mu, iter_cap);
+      if (c2p_failure) {fsum++;}
+    }, Kokkos::Sum<int>(nfail));
+    printf("%-28s   failures: %d / %d\n", "", nfail, ncells);
+  }
+
+  //--- PrimitiveSolver (ideal gas, ResetFloor, flat metric) -----------------------------
+  wtime = TimeKernel(nrep, [&]() {
+    par_for("c2p_bench_ps", DevExeSpace(), 0, (ncells-1),
+    KOKKOS_LAMBDA(const int idx) {
+      Real g3d[NSPMETRIC] = {1.0, 0.0, 0.0, 1.0, 0.0, 1.0};
+      Real g3u[NSPMETRIC] = {1.0, 0.0, 0.0, 1.0, 0.0, 1.0};
+      Real prim_pt[NPRIM], cons_pt[NCONS], b[NMAG];
+      for (int n=0; n<NCONS; ++n) { cons_pt[n] = u_ps(n,idx); }
+      for (int n=0; n<NMAG; ++n)  { b[n] = b_ps(n,idx); }
+      ps.ConToPrim(prim_pt, cons_pt, b, g3d, g3u);
+      wout(IDN,idx) = prim_pt[PRH];
+      wout(IVX,idx) = prim_pt[PVX];
+      wout(IVY,idx) = prim_pt[PVY];
+      wout(IVZ,idx) = prim_pt[PVZ];
+      wout(IEN,idx) = prim_pt[PPR];
+    });
+  });
+  PrintRate("primitive_solver (idealgas)", ncells, nrep, wtime);
+  }
+  Kokkos::finalize();
+
+  return 0;
+}
@@ -0,0 +1,68 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file check_gpu_mpi.cpp
+//! \brief validates at startup that the MPI library can access device memory when the
+//! code is compiled with GPU-aware MPI enabled (see Athena_ENABLE_GPU_AWARE_MPI).  An
+//! MPI library without working GPU-direct support typically crashes or silently falls
+//! back to very slow transfers deep inside the boundary communication routines; this
+//! self-test localizes the failure to startup with an actionable error message.
+
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "utils.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \fn void ValidateGPUAwareMPI()
+//! \brief round-trips a small device buffer through MPI_Sendrecv with this rank itself
+//! and verifies the data, exiting with an error if the MPI library cannot handle device
+//! pointers.  A no-op on host-only builds, and when GPU-aware MPI is disabled (device
+//! buffers are then staged through pinned host memory and never passed to MPI).
+//! Must be called after both MPI_Init() and Kokkos::initialize().
+
+void ValidateGPUAwareMPI() {
+#if MPI_PARALLEL_ENABLED && GPU_AWARE_MPI_ENABLED
+  // nothing to validate when device memory is host memory
+  if (std::is_same<DevMemSpace, HostMemSpace>::value) {return;}
+
+  const int ndat = 64;
+  const int my_rank = global_variable::my_rank;
+  DvceArray1D<Real> sbuf("gpu_mpi_send", ndat), rbuf("gpu_mpi_recv", ndat);
+  par_for("gpu_mpi_fill", DevExeSpace(), 0, ndat-1, KOKKOS_LAMBDA(const int i) {
+    sbuf(i) = static_cast<Real>(my_rank + i);
+  });
+  Kokkos::fence();
+
+  int ierr = MPI_Sendrecv(sbuf.data(), ndat, MPI_ATHENA_REAL, my_rank, 0,
+                          rbuf.data(), ndat, MPI_ATHENA_REAL, my_rank, 0,
+                          MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+  int nbad = 0;
+  if (ierr == MPI_SUCCESS) {
+    Kokkos::parallel_reduce("gpu_mpi_check", Kokkos::RangePolicy<>(DevExeSpace(),0,ndat),
+    KOKKOS_LAMBDA(const int i, int &sum) {
+      if (rbuf(i) != static_cast<Real>(my_rank + i)) {sum += 1;}
+    }, Kokkos::Sum<int>(nbad));
+  }
+
+  if ((ierr != MPI_SUCCESS) || (nbad != 0)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "MPI cannot pass device buffers on this system, but code "
+              << "was compiled with GPU-aware MPI." << std::endl << "Reconfigure with "
+              << "-D Athena_ENABLE_GPU_AWARE_MPI=OFF to stage communication buffers "
+              << "through pinned host memory." << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+#endif
+  return;
+}
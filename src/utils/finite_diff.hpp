@@ -1612,4 +1612,336 @@ Real Diss(int const dir,
   return out*idx[dir];
 }
 
+//----------------------------------------------------------------------------------------
+// Fixed-direction operators (hand-written, not generated by py/write_FD.py).
+//
+// The generated operators above take the differencing direction as a runtime argument,
+// so the index shifts are opaque to the compiler and the unit-stride x1 stencil loads
+// cannot be recognized as contiguous.  The variants below take the direction as a
+// template parameter and express the stencils as loops over constexpr coefficient
+// tables: the loops fully unroll, and for DIR == 0 the accesses become contiguous
+// loads that CPU autovectorizers handle.  Note the finite-difference order itself is
+// already compile time everywhere: NGHOST is a template parameter selected once per
+// task queue or kernel launch (z4c_tasks.cpp, dyn_grmhd.cpp), never inside loops.
+
+template <int NGHOST>
+struct FDCoeff;
+
+template <>
+struct FDCoeff<2> {
+  // weights of q(+s) - q(-s), s = 1..NGHOST-1, for the 1st derivative
+  static constexpr Real d1[1] = {1./2.};
+  // weights of q(0) (s = 0) and q(+s) + q(-s) for the 2nd derivative
+  static constexpr Real d2[2] = {-2., 1.};
+  // weights of q(0) and q(+s) + q(-s), s = 1..NGHOST, for Kreiss-Oliger dissipation
+  static constexpr Real kod[3] = {6., -4., 1.};
+};
+
+template <>
+struct FDCoeff<3> {
+  static constexpr Real d1[2] = {2./3., -1./12.};
+  static constexpr Real d2[3] = {-5./2., 4./3., -1./12.};
+  static constexpr Real kod[4] = {-20., 15., -6., 1.};
+};
+
+template <>
+struct FDCoeff<4> {
+  static constexpr Real d1[3] = {3./4., -3./20., 1./60.};
+  static constexpr Real d2[4] = {-49./18., 3./2., -3./20., 1./90.};
+  static constexpr Real kod[5] = {70., -56., 28., -8., 1.};
+};
+
+// 1st derivative scalar, fixed direction
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dx(const Real idx[], TYPE &quant,
+        int const m,
+        int const k, int const j, int const i) {
+  constexpr int sk = (DIR==2);
+  constexpr int sj = (DIR==1);
+  constexpr int si = (DIR==0);
+  Real out = 0.0;
+  for (int s = 1; s < NGHOST; ++s) {
+    out += FDCoeff<NGHOST>::d1[s-1]
+           *(quant(m,k+s*sk,j+s*sj,i+s*si) - quant(m,k-s*sk,j-s*sj,i-s*si));
+  }
+  return out*idx[DIR];
+}
+
+// 1st derivative vector, fixed direction
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dx(const Real idx[], TYPE &quant,
+        int const m, int const a,
+        int const k, int const j, int const i) {
+  constexpr int sk = (DIR==2);
+  constexpr int sj = (DIR==1);
+  constexpr int si = (DIR==0);
+  Real out = 0.0;
+  for (int s = 1; s < NGHOST; ++s) {
+    out += FDCoeff<NGHOST>::d1[s-1]
+           *(quant(m,a,k+s*sk,j+s*sj,i+s*si) - quant(m,a,k-s*sk,j-s*sj,i-s*si));
+  }
+  return out*idx[DIR];
+}
+
+// 1st derivative 2D tensor, fixed direction
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dx(const Real idx[], TYPE &quant,
+        int const m, int const a, int const b,
+        int const k, int const j, int const i) {
+  constexpr int sk = (DIR==2);
+  constexpr int sj = (DIR==1);
+  constexpr int si = (DIR==0);
+  Real out = 0.0;
+  for (int s = 1; s < NGHOST; ++s) {
+    out += FDCoeff<NGHOST>::d1[s-1]
+           *(quant(m,a,b,k+s*sk,j+s*sj,i+s*si) - quant(m,a,b,k-s*sk,j-s*sj,i-s*si));
+  }
+  return out*idx[DIR];
+}
+
+// 2nd derivative scalar, fixed direction
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dxx(const Real idx[], TYPE &quant,
+        int const m,
+        int const k, int const j, int const i) {
+  constexpr int sk = (DIR==2);
+  constexpr int sj = (DIR==1);
+  constexpr int si = (DIR==0);
+  Real out = FDCoeff<NGHOST>::d2[0]*quant(m,k,j,i);
+  for (int s = 1; s < NGHOST; ++s) {
+    out += FDCoeff<NGHOST>::d2[s]
+           *(quant(m,k+s*sk,j+s*sj,i+s*si) + quant(m,k-s*sk,j-s*sj,i-s*si));
+  }
+  return out*idx[DIR]*idx[DIR];
+}
+
+// 2nd derivative vector, fixed direction
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dxx(const Real idx[], TYPE &quant,
+        int const m, int const a,
+        int const k, int const j, int const i) {
+  constexpr int sk = (DIR==2);
+  constexpr int sj = (DIR==1);
+  constexpr int si = (DIR==0);
+  Real out = FDCoeff<NGHOST>::d2[0]*quant(m,a,k,j,i);
+  for (int s = 1; s < NGHOST; ++s) {
+    out += FDCoeff<NGHOST>::d2[s]
+           *(quant(m,a,k+s*sk,j+s*sj,i+s*si) + quant(m,a,k-s*sk,j-s*sj,i-s*si));
+  }
+  return out*idx[DIR]*idx[DIR];
+}
+
+// 2nd derivative 2D tensor, fixed direction
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dxx(const Real idx[], TYPE &quant,
+        int const m, int const a, int const b,
+        int const k, int const j, int const i) {
+  constexpr int sk = (DIR==2);
+  constexpr int sj = (DIR==1);
+  constexpr int si = (DIR==0);
+  Real out = FDCoeff<NGHOST>::d2[0]*quant(m,a,b,k,j,i);
+  for (int s = 1; s < NGHOST; ++s) {
+    out += FDCoeff<NGHOST>::d2[s]
+           *(quant(m,a,b,k+s*sk,j+s*sj,i+s*si) + quant(m,a,b,k-s*sk,j-s*sj,i-s*si));
+  }
+  return out*idx[DIR]*idx[DIR];
+}
+
+// Kreiss-Oliger dissipation, fixed direction
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Diss(const Real idx[], TYPE &quant,
+        int const m, int const a,
+        int const k, int const j, int const i) {
+  constexpr int sk = (DIR==2);
+  constexpr int sj = (DIR==1);
+  constexpr int si = (DIR==0);
+  Real out = FDCoeff<NGHOST>::kod[0]*quant(m,a,k,j,i);
+  for (int s = 1; s <= NGHOST; ++s) {
+    out += FDCoeff<NGHOST>::kod[s]
+           *(quant(m,a,k+s*sk,j+s*sj,i+s*si) + quant(m,a,k-s*sk,j-s*sj,i-s*si));
+  }
+  return out*idx[DIR];
+}
+
+//----------------------------------------------------------------------------------------
+// Fused derivative operators (hand-written, not generated by py/write_FD.py).
+//
+// The 1st and diagonal 2nd derivative stencils along one direction read the same line
+// of 2*NGHOST-1 points, so when a caller needs both (as the Z4c RHS does for the lapse,
+// chi, shift, and metric) evaluating them together loads each point once and serves
+// both results from the single pass instead of re-reading the line per operator.
+// Coefficients are identical to the generated Dx and Dxx above.
+
+// fused 1st+2nd derivative scalar
+template <int NGHOST, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+void DxDxx(int const dir,
+        const Real idx[], TYPE &quant,
+        int const m,
+        int const k, int const j, int const i,
+        Real &dx, Real &dxx) {
+  int const shiftk = dir==2;
+  int const shiftj = dir==1;
+  int const shifti = dir==0;
+  Real const q0  = quant(m,k,j,i);
+  Real const qm1 = quant(m,k+(-1)*shiftk, j+(-1)*shiftj, i+(-1)*shifti);
+  Real const qp1 = quant(m,k+( 1)*shiftk, j+( 1)*shiftj, i+( 1)*shifti);
+  if constexpr ( NGHOST == 2 ) {
+    dx  = (  -1./2.   * qm1
+             +1./2.   * qp1);
+    dxx = (   +1.     * qm1
+              +1.     * qp1)
+              -2.     * q0;
+  } else if constexpr ( NGHOST == 3 ) {
+    Real const qm2 = quant(m,k+(-2)*shiftk, j+(-2)*shiftj, i+(-2)*shifti);
+    Real const qp2 = quant(m,k+( 2)*shiftk, j+( 2)*shiftj, i+( 2)*shifti);
+    dx  = ( +1./12.   * qm2
+            -1./12.   * qp2)
+        + (  -2./3.   * qm1
+             +2./3.   * qp1);
+    dxx = ( -1./12.   * qm2
+            -1./12.   * qp2)
+        + (  +4./3.   * qm1
+             +4./3.   * qp1)
+             -5./2.   * q0;
+  } else if constexpr ( NGHOST == 4 ) {
+    Real const qm2 = quant(m,k+(-2)*shiftk, j+(-2)*shiftj, i+(-2)*shifti);
+    Real const qp2 = quant(m,k+( 2)*shiftk, j+( 2)*shiftj, i+( 2)*shifti);
+    Real const qm3 = quant(m,k+(-3)*shiftk, j+(-3)*shiftj, i+(-3)*shifti);
+    Real const qp3 = quant(m,k+( 3)*shiftk, j+( 3)*shiftj, i+( 3)*shifti);
+    dx  = ( -1./60.   * qm3
+            +1./60.   * qp3)
+        + ( +3./20.   * qm2
+            -3./20.   * qp2)
+        + (  -3./4.   * qm1
+             +3./4.   * qp1);
+    dxx = ( +1./90.   * qm3
+            +1./90.   * qp3)
+        + ( -3./20.   * qm2
+            -3./20.   * qp2)
+        + (  +3./2.   * qm1
+             +3./2.   * qp1)
+            -49./18.  * q0;
+  }
+  dx  *= idx[dir];
+  dxx *= idx[dir]*idx[dir];
+}
+
+// fused 1st+2nd derivative vector
+template <int NGHOST, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+void DxDxx(int const dir,
+        const Real idx[], TYPE &quant,
+        int const m, int const a,
+        int const k, int const j, int const i,
+        Real &dx, Real &dxx) {
+  int const shiftk = dir==2;
+  int const shiftj = dir==1;
+  int const shifti = dir==0;
+  Real const q0  = quant(m,a,k,j,i);
+  Real const qm1 = quant(m,a,k+(-1)*shiftk, j+(-1)*shiftj, i+(-1)*shifti);
+  Real const qp1 = quant(m,a,k+( 1)*shiftk, j+( 1)*shiftj, i+( 1)*shifti);
+  if constexpr ( NGHOST == 2 ) {
+    dx  = (  -1./2.   * qm1
+             +1./2.   * qp1);
+    dxx = (   +1.     * qm1
+              +1.     * qp1)
+              -2.     * q0;
+  } else if constexpr ( NGHOST == 3 ) {
+    Real const qm2 = quant(m,a,k+(-2)*shiftk, j+(-2)*shiftj, i+(-2)*shifti);
+    Real const qp2 = quant(m,a,k+( 2)*shiftk, j+( 2)*shiftj, i+( 2)*shifti);
+    dx  = ( +1./12.   * qm2
+            -1./12.   * qp2)
+        + (  -2./3.   * qm1
+             +2./3.   * qp1);
+    dxx = ( -1./12.   * qm2
+            -1./12.   * qp2)
+        + (  +4./3.   * qm1
+             +4./3.   * qp1)
+             -5./2.   * q0;
+  } else if constexpr ( NGHOST == 4 ) {
+    Real const qm2 = quant(m,a,k+(-2)*shiftk, j+(-2)*shiftj, i+(-2)*shifti);
+    Real const qp2 = quant(m,a,k+( 2)*shiftk, j+( 2)*shiftj, i+( 2)*shifti);
+    Real const qm3 = quant(m,a,k+(-3)*shiftk, j+(-3)*shiftj, i+(-3)*shifti);
+    Real const qp3 = quant(m,a,k+( 3)*shiftk, j+( 3)*shiftj, i+( 3)*shifti);
+    dx  = ( -1./60.   * qm3
+            +1./60.   * qp3)
+        + ( +3./20.   * qm2
+            -3./20.   * qp2)
+        + (  -3./4.   * qm1
+             +3./4.   * qp1);
+    dxx = ( +1./90.   * qm3
+            +1./90.   * qp3)
+        + ( -3./20.   * qm2
+            -3./20.   * qp2)
+        + (  +3./2.   * qm1
+             +3./2.   * qp1)
+            -49./18.  * q0;
+  }
+  dx  *= idx[dir];
+  dxx *= idx[dir]*idx[dir];
+}
+
+// fused 1st+2nd derivative 2D tensor
+template <int NGHOST, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+void DxDxx(int const dir,
+        const Real idx[], TYPE &quant,
+        int const m, int const a, int const b,
+        int const k, int const j, int const i,
+        Real &dx, Real &dxx) {
+  int const shiftk = dir==2;
+  int const shiftj = dir==1;
+  int const shifti = dir==0;
+  Real const q0  = quant(m,a,b,k,j,i);
+  Real const qm1 = quant(m,a,b,k+(-1)*shiftk, j+(-1)*shiftj, i+(-1)*shifti);
+  Real const qp1 = quant(m,a,b,k+( 1)*shiftk, j+( 1)*shiftj, i+( 1)*shifti);
+  if constexpr ( NGHOST == 2 ) {
+    dx  = (  -1./2.   * qm1
+             +1./2.   * qp1);
+    dxx = (   +1.     * qm1
+              +1.     * qp1)
+              -2.     * q0;
+  } else if constexpr ( NGHOST == 3 ) {
+    Real const qm2 = quant(m,a,b,k+(-2)*shiftk, j+(-2)*shiftj, i+(-2)*shifti);
+    Real const qp2 = quant(m,a,b,k+( 2)*shiftk, j+( 2)*shiftj, i+( 2)*shifti);
+    dx  = ( +1./12.   * qm2
+            -1./12.   * qp2)
+        + (  -2./3.   * qm1
+             +2./3.   * qp1);
+    dxx = ( -1./12.   * qm2
+            -1./12.   * qp2)
+        + (  +4./3.   * qm1
+             +4./3.   * qp1)
+             -5./2.   * q0;
+  } else if constexpr ( NGHOST == 4 ) {
+    Real const qm2 = quant(m,a,b,k+(-2)*shiftk, j+(-2)*shiftj, i+(-2)*shifti);
+    Real const qp2 = quant(m,a,b,k+( 2)*shiftk, j+( 2)*shiftj, i+( 2)*shifti);
+    Real const qm3 = quant(m,a,b,k+(-3)*shiftk, j+(-3)*shiftj, i+(-3)*shifti);
+    Real const qp3 = quant(m,a,b,k+( 3)*shiftk, j+( 3)*shiftj, i+( 3)*shifti);
+    dx  = ( -1./60.   * qm3
+            +1./60.   * qp3)
+        + ( +3./20.   * qm2
+            -3./20.   * qp2)
+        + (  -3./4.   * qm1
+             +3./4.   * qp1);
+    dxx = ( +1./90.   * qm3
+            +1./90.   * qp3)
+        + ( -3./20.   * qm2
+            -3./20.   * qp2)
+        + (  +3./2.   * qm1
+             +3./2.   * qp1)
+            -49./18.  * q0;
+  }
+  dx  *= idx[dir];
+  dxx *= idx[dir]*idx[dir];
+}
+
 #endif // UTILS_FINITE_DIFF_HPP_
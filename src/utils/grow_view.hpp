@@ -0,0 +1,24 @@
+#ifndef UTILS_GROW_VIEW_HPP_
+#define UTILS_GROW_VIEW_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file grow_view.hpp
+//! \brief helper to grow 1D Kokkos (Dual)Views with capacity hysteresis.  AMR regrids
+//! resize several device-side arrays every time the MeshBlock count changes, and the
+//! allocations (plus the fences that come with them) can dominate regrid latency.  This
+//! helper only reallocates when the requested length exceeds the current allocation, and
+//! then reserves headroom (20% by default) so that subsequent small grows are free.
+//! Callers must treat the View length as a capacity and track logical size themselves.
+
+#include "athena.hpp"
+
+template <typename ViewType>
+void GrowView(ViewType &view, int n, int headroom_pct = 20) {
+  if (static_cast<int>(view.extent(0)) >= n) {return;}  // current capacity sufficient
+  Kokkos::realloc(view, n + (n*headroom_pct)/100);
+}
+
+#endif // UTILS_GROW_VIEW_HPP_
@@ -0,0 +1,200 @@
+//========================================================================================
+// AthenaK astrophysical fluid dynamics code
+// Copyright(C) 2021 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file kernel_tuner.cpp
+//! \brief implements the first-cycles launch-parameter autotuner (see kernel_tuner.hpp)
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "kernel_tuner.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace kernel_tuner {
+
+// launch-parameter overrides read by the par_for_outer wrappers in athena.hpp.
+// Defaults leave Kokkos::AUTO team sizes and call-site scratch levels in place
+int team_size = 0;
+int scr_level = -1;
+
+} // namespace kernel_tuner
+
+namespace {
+
+struct Candidate {
+  int team;   // fixed team size (0 = Kokkos::AUTO)
+  int scr;    // scratch level override (-1 = use call-site value)
+  double best = (std::numeric_limits<double>::max)();  // min over samples of max-
+};                                                     // over-ranks cycle time
+
+bool enabled_ = false;
+bool done_ = false;
+std::string cache_file_;
+std::string cache_key_;
+int warmup_left_ = 1;      // first timed cycle discarded (lazy setup, cold caches)
+int nsample_ = 2;          // timed cycles per candidate; min taken to reject noise
+int cand_ = 0, sample_ = 0;
+std::vector<Candidate> cands_;
+
+//----------------------------------------------------------------------------------------
+//! \fn ArchKey()
+//! \brief returns a string identifying the execution architecture, used (with the
+//! MeshBlock dimensions) to key the cache file
+
+std::string ArchKey() {
+  std::string key(Kokkos::DefaultExecutionSpace::name());
+#if defined(KOKKOS_ENABLE_CUDA)
+  int dev;
+  cudaDeviceProp prop;
+  if (cudaGetDevice(&dev) == cudaSuccess &&
+      cudaGetDeviceProperties(&prop, dev) == cudaSuccess) {
+    key += "/";
+    key += prop.name;
+  }
+#elif defined(KOKKOS_ENABLE_HIP)
+  int dev;
+  hipDeviceProp_t prop;
+  if (hipGetDevice(&dev) == hipSuccess &&
+      hipGetDeviceProperties(&prop, dev) == hipSuccess) {
+    key += "/";
+    key += prop.gcnArchName;
+  }
+#endif
+  std::replace(key.begin(), key.end(), ' ', '_');
+  return key;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn ApplyAndFinish()
+//! \brief fixes the given configuration for the rest of the run
+
+void ApplyAndFinish(const int team, const int scr) {
+  kernel_tuner::team_size = team;
+  kernel_tuner::scr_level = scr;
+  done_ = true;
+}
+
+} // namespace
+
+namespace kernel_tuner {
+
+//----------------------------------------------------------------------------------------
+//! \fn void Enable()
+//! \brief enables tuning.  On a cache hit for this (architecture, MeshBlock size) the
+//! stored configuration is applied immediately and the sweep is skipped; rank 0 reads
+//! the file and the result is broadcast so all ranks stay consistent
+
+void Enable(const std::string &cache_file, const int nx1, const int nx2, const int nx3) {
+  enabled_ = true;
+  cache_file_ = cache_file;
+  {
+    std::stringstream key;
+    key << ArchKey() << " " << nx1 << "x" << nx2 << "x" << nx3;
+    cache_key_ = key.str();
+  }
+
+  // candidate sweep: Kokkos::AUTO baseline, fixed team sizes, and (on devices with a
+  // scratch hierarchy) the baseline team size with all scratch forced to level 1
+  cands_.push_back({0, -1});
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP)
+  cands_.push_back({64, -1});
+  cands_.push_back({128, -1});
+  cands_.push_back({256, -1});
+  cands_.push_back({512, -1});
+  cands_.push_back({0, 1});
+#endif
+
+  // look up this (architecture, block size) in the cache file
+  int found[3] = {0, 0, -1};   // {hit, team size, scratch level}
+  if (global_variable::my_rank == 0) {
+    std::ifstream cache(cache_file_);
+    std::string line;
+    while (std::getline(cache, line)) {
+      if (line.compare(0, cache_key_.size(), cache_key_) == 0) {
+        std::stringstream fields(line.substr(cache_key_.size()));
+        fields >> found[1] >> found[2];
+        if (fields) {found[0] = 1;}
+      }
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Bcast(found, 3, MPI_INT, 0, MPI_COMM_WORLD);
+#endif
+  if (found[0]) {
+    ApplyAndFinish(found[1], found[2]);
+    if (global_variable::my_rank == 0) {
+      std::cout << "kernel_tuner: cached config for '" << cache_key_ << "': team_size="
+                << found[1] << " scr_level=" << found[2] << std::endl;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BeginCycle()
+//! \brief applies the candidate configuration to be timed this cycle
+
+void BeginCycle() {
+  if (!enabled_ || done_) return;
+  if (warmup_left_ > 0) {
+    team_size = 0;
+    scr_level = -1;
+  } else {
+    team_size = cands_[cand_].team;
+    scr_level = cands_[cand_].scr;
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void EndCycle()
+//! \brief records the measured cycle time for the current candidate and advances the
+//! sweep.  When all candidates have been timed, fixes the fastest configuration and
+//! appends it to the cache file
+
+void EndCycle(Kokkos::Timer &cycle_timer) {
+  if (!enabled_ || done_) return;
+  Kokkos::fence();   // charge all kernels launched this cycle to its measurement
+  double t = cycle_timer.seconds();
+  if (warmup_left_ > 0) {
+    warmup_left_--;
+    return;
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, &t, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
+  cands_[cand_].best = std::min(cands_[cand_].best, t);
+  if (++sample_ < nsample_) return;
+  sample_ = 0;
+  if (++cand_ < static_cast<int>(cands_.size())) return;
+
+  // sweep complete: pick the fastest candidate and persist it
+  int ibest = 0;
+  for (int i=1; i<static_cast<int>(cands_.size()); ++i) {
+    if (cands_[i].best < cands_[ibest].best) {ibest = i;}
+  }
+  ApplyAndFinish(cands_[ibest].team, cands_[ibest].scr);
+  if (global_variable::my_rank == 0) {
+    std::cout << "kernel_tuner: selected team_size=" << cands_[ibest].team
+              << " scr_level=" << cands_[ibest].scr << " ("
+              << std::scientific << std::setprecision(3) << cands_[ibest].best
+              << " s/cycle vs " << cands_[0].best << " baseline)" << std::endl;
+    std::cout.unsetf(std::ios_base::floatfield);
+    std::ofstream cache(cache_file_, std::ios::app);
+    cache << cache_key_ << " " << cands_[ibest].team << " " << cands_[ibest].scr
+          << std::endl;
+  }
+}
+
+} // namespace kernel_tuner
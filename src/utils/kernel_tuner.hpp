@@ -0,0 +1,35 @@
+#ifndef UTILS_KERNEL_TUNER_HPP_
+#define UTILS_KERNEL_TUNER_HPP_
+//========================================================================================
+// AthenaK astrophysical fluid dynamics code
+// Copyright(C) 2021 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file kernel_tuner.hpp
+//! \brief first-cycles autotuner for the launch parameters of team-based kernels.
+//! The par_for_outer wrappers (athena.hpp) launch every team kernel with Kokkos::AUTO
+//! team size and the call-site scratch level; neither default is best on every
+//! architecture.  When <mesh>/autotune=true the tuner sweeps a small set of global
+//! (team size, scratch level) overrides during the first cycles of the run, timing
+//! whole cycles (so kernels are never re-executed speculatively), fixes the fastest
+//! configuration for the remainder of the run, and persists it to a cache file keyed
+//! by architecture and MeshBlock size so later runs skip the sweep.
+
+#include <string>
+
+#include <Kokkos_Core.hpp>
+
+namespace kernel_tuner {
+
+//! enable tuning; reads the cache file and skips the sweep on a (arch, block) hit
+void Enable(const std::string &cache_file, const int nx1, const int nx2, const int nx3);
+
+//! apply the candidate configuration for this cycle (no-op once tuning is finished)
+void BeginCycle();
+
+//! record the measured cycle time and advance the sweep (fences before reading timer)
+void EndCycle(Kokkos::Timer &cycle_timer);
+
+} // namespace kernel_tuner
+
+#endif // UTILS_KERNEL_TUNER_HPP_
@@ -184,3 +184,195 @@ void LagrangeInterpolator::CalculateWeight() {
     }
   }
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn BatchLagrangeInterpolator::BatchLagrangeInterpolator
+//! \brief allocates device storage for a batch of npts query points
+
+BatchLagrangeInterpolator::BatchLagrangeInterpolator(MeshBlockPack *pmy_pack, int npts) :
+    npts(npts),
+    interp_vals("blagr_vals", npts, 1),
+    pmy_pack(pmy_pack),
+    interp_coord("blagr_coord", npts, 3),
+    interp_indcs("blagr_indcs", npts, 4),
+    interp_wghts("blagr_wghts", npts, 2*(pmy_pack->pmesh->mb_indcs.ng), 3),
+    interp_vlist("blagr_vlist", 1) {
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BatchLagrangeInterpolator::SetPoints
+//! \brief (re)set query point coordinates and rebuild the (point -> MeshBlock, zone,
+//! weights) map.  Owning block, stencil zones, and Lagrange weights of every point are
+//! resolved in one kernel; one thread per point scans the MeshBlocks of this pack.
+
+void BatchLagrangeInterpolator::SetPoints(const HostArray2D<Real> &coords) {
+  for (int n=0; n<npts; ++n) {
+    for (int d=0; d<3; ++d) {
+      interp_coord.h_view(n,d) = coords(n,d);
+    }
+  }
+  interp_coord.template modify<HostMemSpace>();
+  interp_coord.template sync<DevExeSpace>();
+
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  auto &size = pmy_pack->pmb->mb_size;
+  int &ng = indcs.ng;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int npts1 = npts - 1;
+
+  auto &rcoord = interp_coord;
+  auto &iindcs = interp_indcs;
+  auto &iwghts = interp_wghts;
+  par_for("blagr_map",DevExeSpace(),0,npts1,
+  KOKKOS_LAMBDA(int n) {
+    // indices default to -1 if the point is outside this MeshBlockPack
+    iindcs.d_view(n,0) = -1;
+    iindcs.d_view(n,1) = -1;
+    iindcs.d_view(n,2) = -1;
+    iindcs.d_view(n,3) = -1;
+    for (int m=0; m<=nmb1; ++m) {
+      // extract MeshBlock bounds
+      Real &x1min = size.d_view(m).x1min;
+      Real &x1max = size.d_view(m).x1max;
+      Real &x2min = size.d_view(m).x2min;
+      Real &x2max = size.d_view(m).x2max;
+      Real &x3min = size.d_view(m).x3min;
+      Real &x3max = size.d_view(m).x3max;
+
+      // extract MeshBlock grid cell spacings
+      Real &dx1 = size.d_view(m).dx1;
+      Real &dx2 = size.d_view(m).dx2;
+      Real &dx3 = size.d_view(m).dx3;
+
+      // save MeshBlock and zone indices if the point resides in this MeshBlock; bounds
+      // are half-open so that a point on a shared face is claimed by exactly one block
+      if ((rcoord.d_view(n,0) >= x1min && rcoord.d_view(n,0) < x1max) &&
+          (rcoord.d_view(n,1) >= x2min && rcoord.d_view(n,1) < x2max) &&
+          (rcoord.d_view(n,2) >= x3min && rcoord.d_view(n,2) < x3max)) {
+        iindcs.d_view(n,0) = m;
+        iindcs.d_view(n,1) = static_cast<int>(floor((rcoord.d_view(n,0)-
+                                                     (x1min+dx1/2.0))/dx1));
+        iindcs.d_view(n,2) = static_cast<int>(floor((rcoord.d_view(n,1)-
+                                                     (x2min+dx2/2.0))/dx2));
+        iindcs.d_view(n,3) = static_cast<int>(floor((rcoord.d_view(n,2)-
+                                                     (x3min+dx3/2.0))/dx3));
+        break;
+      }
+    }
+
+    // extract indices
+    int ii0 = iindcs.d_view(n,0);
+    int ii1 = iindcs.d_view(n,1);
+    int ii2 = iindcs.d_view(n,2);
+    int ii3 = iindcs.d_view(n,3);
+
+    if (ii0==-1) {  // point not on this rank
+      for (int i=0; i<2*ng; ++i) {
+        iwghts.d_view(n,i,0) = 0.0;
+        iwghts.d_view(n,i,1) = 0.0;
+        iwghts.d_view(n,i,2) = 0.0;
+      }
+    } else {
+      // extract query point position
+      Real &x0 = rcoord.d_view(n,0);
+      Real &y0 = rcoord.d_view(n,1);
+      Real &z0 = rcoord.d_view(n,2);
+
+      // extract MeshBlock bounds
+      Real &x1min = size.d_view(ii0).x1min;
+      Real &x1max = size.d_view(ii0).x1max;
+      Real &x2min = size.d_view(ii0).x2min;
+      Real &x2max = size.d_view(ii0).x2max;
+      Real &x3min = size.d_view(ii0).x3min;
+      Real &x3max = size.d_view(ii0).x3max;
+
+      // set interpolation weights
+      for (int i=0; i<2*ng; ++i) {
+        iwghts.d_view(n,i,0) = 1.;
+        iwghts.d_view(n,i,1) = 1.;
+        iwghts.d_view(n,i,2) = 1.;
+        for (int j=0; j<2*ng; ++j) {
+          if (j != i) {
+            Real x1vpi1 = CellCenterX(ii1-ng+i+1, nx1, x1min, x1max);
+            Real x1vpj1 = CellCenterX(ii1-ng+j+1, nx1, x1min, x1max);
+            iwghts.d_view(n,i,0) *= (x0-x1vpj1)/(x1vpi1-x1vpj1);
+            Real x2vpi1 = CellCenterX(ii2-ng+i+1, nx2, x2min, x2max);
+            Real x2vpj1 = CellCenterX(ii2-ng+j+1, nx2, x2min, x2max);
+            iwghts.d_view(n,i,1) *= (y0-x2vpj1)/(x2vpi1-x2vpj1);
+            Real x3vpi1 = CellCenterX(ii3-ng+i+1, nx3, x3min, x3max);
+            Real x3vpj1 = CellCenterX(ii3-ng+j+1, nx3, x3min, x3max);
+            iwghts.d_view(n,i,2) *= (z0-x3vpj1)/(x3vpi1-x3vpj1);
+          }
+        }
+      }
+    }
+  });
+
+  // sync dual arrays (device is authoritative; host copy kept for host-side consumers)
+  interp_indcs.template modify<DevExeSpace>();
+  interp_indcs.template sync<HostMemSpace>();
+  interp_wghts.template modify<DevExeSpace>();
+  interp_wghts.template sync<HostMemSpace>();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BatchLagrangeInterpolator::Interpolate
+//! \brief interpolate the listed variables of val at every query point in one pass;
+//! results are synced into interp_vals.h_view(n,v) in listed order
+
+void BatchLagrangeInterpolator::Interpolate(DvceArray5D<Real> &val,
+                                            const std::vector<int> &vars) {
+  int nvars = static_cast<int>(vars.size());
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is; int &js = indcs.js; int &ks = indcs.ks;
+  int &ng = indcs.ng;
+  int npts1 = npts - 1;
+  int nvar1 = nvars - 1;
+
+  // reallocate containers only when their shape changes (avoids a device allocation
+  // per call)
+  if (interp_vlist.d_view.extent_int(0) != nvars) {
+    Kokkos::realloc(interp_vlist, nvars);
+  }
+  if (interp_vals.d_view.extent_int(1) != nvars) {
+    Kokkos::realloc(interp_vals, npts, nvars);
+  }
+  for (int v=0; v<nvars; ++v) {
+    interp_vlist.h_view(v) = vars[v];
+  }
+  interp_vlist.template modify<HostMemSpace>();
+  interp_vlist.template sync<DevExeSpace>();
+
+  auto &iindcs = interp_indcs;
+  auto &iwghts = interp_wghts;
+  auto &vlist = interp_vlist;
+  auto &ivals = interp_vals;
+  par_for("blagr_interp",DevExeSpace(),0,npts1,0,nvar1,
+  KOKKOS_LAMBDA(int n, int v) {
+    int ii0 = iindcs.d_view(n,0);
+    int ii1 = iindcs.d_view(n,1);
+    int ii2 = iindcs.d_view(n,2);
+    int ii3 = iindcs.d_view(n,3);
+
+    if (ii0==-1) {  // point not on this rank
+      ivals.d_view(n,v) = 0.0;
+    } else {
+      Real int_value = 0.0;
+      for (int i=0; i<2*ng; i++) {
+        for (int j=0; j<2*ng; j++) {
+          for (int k=0; k<2*ng; k++) {
+            Real iwght = iwghts.d_view(n,i,0)*iwghts.d_view(n,j,1)*iwghts.d_view(n,k,2);
+            int_value += iwght*val(ii0,vlist.d_view(v),
+                                   ii3-(ng-k-ks)+1,ii2-(ng-j-js)+1,ii1-(ng-i-is)+1);
+          }
+        }
+      }
+      ivals.d_view(n,v) = int_value;
+    }
+  });
+
+  // sync dual arrays
+  interp_vals.template modify<DevExeSpace>();
+  interp_vals.template sync<HostMemSpace>();
+}
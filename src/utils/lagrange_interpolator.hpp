@@ -10,6 +10,7 @@
 #include <cmath>
 #include <iostream>
 #include <list>
+#include <vector>
 
 #include "athena.hpp"
 #include "athena_tensor.hpp"
@@ -41,4 +42,39 @@ class LagrangeInterpolator {
   HostArray2D<Real> interp_wghts; // weights for interpolation
 };
 
+//----------------------------------------------------------------------------------------
+//! \class BatchLagrangeInterpolator
+//! \brief device-side Lagrange interpolation at a batch of arbitrary points.  Unlike
+//! LagrangeInterpolator above (one point at a time, host loops with one device sync per
+//! stencil zone), this class resolves the owning MeshBlock, stencil zones, and Lagrange
+//! weights of every point in a single kernel, and interpolates many variables per point
+//! in one pass.  Follows the same stencil conventions as SphericalGrid, which applies
+//! this pattern to its fixed angular grid.
+
+class BatchLagrangeInterpolator {
+ public:
+  BatchLagrangeInterpolator(MeshBlockPack *pmy_pack, int npts);
+  ~BatchLagrangeInterpolator() = default;
+
+  // (re)set query point coordinates from host array shaped (npts,3), and rebuild the
+  // (point -> MeshBlock, zone, weights) map on device
+  void SetPoints(const HostArray2D<Real> &coords);
+  // interpolate the listed variables of val at every point in one pass; results are
+  // synced into interp_vals.h_view(n,v) (in listed order), zero where a point is not
+  // on this rank
+  void Interpolate(DvceArray5D<Real> &val, const std::vector<int> &vars);
+  // true if point n resides in this MeshBlockPack
+  bool PointExists(int n) const {return (interp_indcs.h_view(n,0) != -1);}
+
+  int npts;                        // number of query points
+  DualArray2D<Real> interp_vals;   // values interpolated to the query points
+
+ private:
+  MeshBlockPack *pmy_pack;         // ptr to MeshBlockPack queried by this interpolator
+  DualArray2D<Real> interp_coord;  // xyz coordinates of query points
+  DualArray2D<int> interp_indcs;   // indices of MeshBlock and zones therein for interp
+  DualArray3D<Real> interp_wghts;  // weights for interpolation
+  DualArray1D<int> interp_vlist;   // variable indices gathered in one pass
+};
+
 #endif // UTILS_LAGRANGE_INTERPOLATOR_HPP_
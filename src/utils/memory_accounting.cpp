@@ -0,0 +1,252 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file memory_accounting.cpp
+//! \brief implementation of device memory accounting (see memory_accounting.hpp).
+//! The Kokkos Tools allocate/deallocate callbacks fire on the host for every View
+//! allocation, so a mutex-guarded map from live pointer to (subsystem, size) is cheap:
+//! allocations happen at startup and at regrids, never inside kernels.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "memory_accounting.hpp"
+
+namespace memory_accounting {
+
+namespace {
+
+struct SubsystemStats {
+  std::int64_t current=0;  // bytes currently allocated
+  std::int64_t hwm=0;      // high-water mark of current
+};
+
+std::mutex mtx_;
+bool enabled_ = false;
+std::vector<std::string> scope_;                    // stack of active Scope names
+std::map<std::string, SubsystemStats> stats_;       // ordered for stable printing
+// live allocations: pointer -> (owning subsystem, size); deallocations are debited
+// against the subsystem that made the allocation, not whatever scope is active then
+std::unordered_map<const void *, std::pair<std::string, std::int64_t>> live_;
+std::int64_t last_current_ = -1, last_hwm_ = -1;    // totals at last ReportIfChanged()
+
+// steady-state allocation audit (see EnableAudit); armed around task-list execution
+struct AuditStats {
+  std::int64_t nalloc=0;   // allocations seen under this label while armed
+  std::int64_t nbyte=0;    // bytes allocated
+  int last_cycle=-1;       // most recent cycle with an armed allocation
+};
+
+bool audit_enabled_ = false;
+bool audit_strict_ = false;
+bool audit_armed_ = false;
+int audit_cycle_ = -1;
+std::int64_t cycle_nalloc_ = 0, cycle_nbyte_ = 0;   // totals for the current cycle
+std::map<std::string, AuditStats> audit_;
+
+//----------------------------------------------------------------------------------------
+//! \fn bool DeviceResident()
+//! \brief returns true if an allocation in the named memory space lives on the device.
+//! On GPU builds, host mirrors, pinned staging buffers, and other host-side Views go
+//! through the same callbacks and must not count against device capacity
+
+bool DeviceResident(const char *space_name) {
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP)
+  return (std::strstr(space_name, "Host") == nullptr);
+#else
+  (void) space_name;
+  return true;
+#endif
+}
+
+void AllocateCB(const Kokkos::Tools::SpaceHandle space, const char *label,
+                const void *ptr, const uint64_t size) {
+  if (!DeviceResident(space.name)) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (audit_enabled_ && audit_armed_) {
+    if (audit_strict_) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Allocation of " << size << " bytes for '" << label
+                << "' during task-list execution (cycle=" << audit_cycle_
+                << ") with <mesh>/alloc_audit_strict=true" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    auto &a = audit_[label];
+    a.nalloc += 1;
+    a.nbyte += static_cast<std::int64_t>(size);
+    a.last_cycle = audit_cycle_;
+    cycle_nalloc_ += 1;
+    cycle_nbyte_ += static_cast<std::int64_t>(size);
+  }
+  const std::string &name = (scope_.empty())? std::string("other") : scope_.back();
+  auto &s = stats_[name];
+  s.current += static_cast<std::int64_t>(size);
+  s.hwm = std::max(s.hwm, s.current);
+  live_[ptr] = std::make_pair(name, static_cast<std::int64_t>(size));
+}
+
+void DeallocateCB(const Kokkos::Tools::SpaceHandle space, const char *label,
+                  const void *ptr, const uint64_t size) {
+  (void) label;
+  (void) size;
+  if (!DeviceResident(space.name)) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto it = live_.find(ptr);
+  if (it == live_.end()) {return;}  // allocated before accounting was enabled
+  stats_[it->second.first].current -= it->second.second;
+  live_.erase(it);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void Enable()
+//! \brief install the allocate/deallocate callbacks
+
+void Enable() {
+  Kokkos::Tools::Experimental::set_allocate_data_callback(AllocateCB);
+  Kokkos::Tools::Experimental::set_deallocate_data_callback(DeallocateCB);
+  enabled_ = true;
+}
+
+bool IsEnabled() {
+  return enabled_;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void EnableAudit()
+//! \brief enable the steady-state allocation audit (installs the callbacks if needed)
+
+void EnableAudit(const bool strict) {
+  if (!enabled_) {Enable();}
+  audit_enabled_ = true;
+  audit_strict_ = strict;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void AuditBeginCycle()
+//! \brief print the previous cycle's armed allocations (if any) and roll the counters
+
+void AuditBeginCycle(const int ncycle) {
+  if (!audit_enabled_) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  if ((cycle_nalloc_ > 0) && (global_variable::my_rank == 0)) {
+    std::cout << "alloc_audit: cycle=" << audit_cycle_ << " nalloc=" << cycle_nalloc_
+              << " bytes=" << cycle_nbyte_ << std::endl;
+  }
+  cycle_nalloc_ = 0;
+  cycle_nbyte_ = 0;
+  audit_cycle_ = ncycle;
+}
+
+//----------------------------------------------------------------------------------------
+// ArmAudit/DisarmAudit: bracket the window in which allocations are counted (or fatal)
+
+void ArmAudit() {
+  if (!audit_enabled_) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  audit_armed_ = true;
+}
+
+void DisarmAudit() {
+  if (!audit_enabled_) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  audit_armed_ = false;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void AuditReport()
+//! \brief print table of armed-window allocations by View label
+
+void AuditReport() {
+  if (!audit_enabled_ || (global_variable::my_rank != 0)) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (audit_.empty()) {
+    std::cout << std::endl
+              << "alloc_audit: no allocations during task-list execution" << std::endl;
+    return;
+  }
+  std::cout << std::endl << "alloc_audit: allocations during task-list execution "
+            << "(rank 0):" << std::endl
+            << std::left << std::setw(32) << "label" << std::right
+            << std::setw(12) << "nalloc" << std::setw(16) << "bytes"
+            << std::setw(12) << "last_cycle" << std::endl;
+  for (auto &a : audit_) {
+    std::cout << std::left << std::setw(32) << a.first << std::right
+              << std::setw(12) << a.second.nalloc << std::setw(16) << a.second.nbyte
+              << std::setw(12) << a.second.last_cycle << std::endl;
+  }
+}
+
+//----------------------------------------------------------------------------------------
+// Scope constructor/destructor: push/pop the subsystem name
+
+Scope::Scope(const char *name) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  scope_.push_back(name);
+}
+
+Scope::~Scope() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  scope_.pop_back();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Report()
+//! \brief print table of current and high-water bytes per subsystem.  Values are this
+//! rank's own; with static meshes allocation is symmetric across ranks, and with AMR
+//! the high-water mark of interest is whichever rank aborts first anyway
+
+void Report() {
+  if (!enabled_ || (global_variable::my_rank != 0)) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  std::int64_t tot_current = 0, tot_hwm = 0;
+  std::cout << std::endl << "Device memory accounting (rank 0, bytes):" << std::endl
+            << std::setw(12) << "subsystem" << std::setw(16) << "current"
+            << std::setw(16) << "high-water" << std::endl;
+  for (auto &s : stats_) {
+    std::cout << std::setw(12) << s.first << std::setw(16) << s.second.current
+              << std::setw(16) << s.second.hwm << std::endl;
+    tot_current += s.second.current;
+    tot_hwm += s.second.hwm;
+  }
+  // note total high-water is the sum of per-subsystem marks, an upper bound on the
+  // instantaneous peak if the subsystems did not peak simultaneously
+  std::cout << std::setw(12) << "total" << std::setw(16) << tot_current
+            << std::setw(16) << tot_hwm << std::endl;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ReportIfChanged()
+//! \brief print one-line totals when they changed since the last call
+
+void ReportIfChanged() {
+  if (!enabled_) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  std::int64_t tot_current = 0, tot_hwm = 0;
+  for (auto &s : stats_) {
+    tot_current += s.second.current;
+    tot_hwm += s.second.hwm;
+  }
+  if ((tot_current == last_current_) && (tot_hwm == last_hwm_)) {return;}
+  last_current_ = tot_current;
+  last_hwm_ = tot_hwm;
+  std::cout << "device_mem: current=" << tot_current << " hwm=" << tot_hwm << std::endl;
+  return;
+}
+
+}  // namespace memory_accounting
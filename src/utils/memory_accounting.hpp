@@ -0,0 +1,54 @@
+#ifndef UTILS_MEMORY_ACCOUNTING_HPP_
+#define UTILS_MEMORY_ACCOUNTING_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file memory_accounting.hpp
+//! \brief accounting layer over device memory allocations, attributing every allocation
+//! to the subsystem active when it was made (see Scope) and tracking current and
+//! high-water bytes per subsystem.  Allocation failures at regrid time otherwise
+//! manifest as opaque Kokkos aborts; with <mesh>/memory_accounting=true the footprint
+//! of each subsystem is visible, so devices can be packed close to capacity.
+//! Implemented with the Kokkos Tools in-process allocate/deallocate callbacks, so the
+//! allocation call sites themselves are untouched; enabling it displaces any profiling
+//! tool loaded through KOKKOS_TOOLS_LIBS that uses the same two hooks.
+
+namespace memory_accounting {
+
+// install the Kokkos Tools callbacks; must be called before the Mesh is constructed so
+// that every device allocation is seen
+void Enable();
+bool IsEnabled();
+
+// attribute allocations made while this object is alive to the named subsystem.
+// Scopes nest and the innermost wins; allocations outside any scope count as "other"
+class Scope {
+ public:
+  explicit Scope(const char *name);
+  ~Scope();
+};
+
+// audit of allocations made during steady-state cycling (<mesh>/alloc_audit): every
+// device allocation seen while the audit is armed -- the driver arms it around
+// task-list execution each cycle -- is counted by View label, identifying the call
+// site; with <mesh>/alloc_audit_strict=true such an allocation is instead a fatal
+// error, turning "cycling allocates nothing" into an enforced invariant.  Uses the
+// same callbacks as the accounting, so enabling the audit implies Enable()
+void EnableAudit(const bool strict);
+void AuditBeginCycle(const int ncycle);
+void ArmAudit();
+void DisarmAudit();
+// print table of armed-window allocations by label (rank 0)
+void AuditReport();
+
+// print table of current and high-water bytes per subsystem (rank 0's own values)
+void Report();
+// print one-line totals, but only when they changed since the last call; called from
+// the cycle diagnostics so regrid-time growth appears in the log as it happens
+void ReportIfChanged();
+
+}  // namespace memory_accounting
+
+#endif // UTILS_MEMORY_ACCOUNTING_HPP_
@@ -0,0 +1,215 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file placement_report.cpp
+//! \brief detects and reports runtime placement: the host, CPU affinity mask, and NUMA
+//! node of every rank, and on device builds the device each rank selected with its PCI
+//! bus id and the NUMA node that device is attached to.  ShowConfig() covers the build;
+//! most "slow on machine X" reports instead trace to launch placement (no CPU binding,
+//! several ranks sharing one GPU, ranks bound far from their GPU), all of which are
+//! detectable at startup.  With <job>/placement_report=true a per-rank table is printed
+//! followed by warnings for the misconfigurations above.  Detection uses sched_get*
+//! and sysfs and so reports "unavailable" on non-Linux hosts
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "utils.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace {
+
+// fixed-size per-rank record so records can be exchanged with a single MPI_Gather
+struct PlacementRecord {
+  char host[64];
+  char cpus[64];    // affinity list in cpulist format, truncated if very long
+  int ncpu;         // number of CPUs in the affinity mask (-1 = unknown)
+  int ncpu_node;    // number of CPUs online on the host (-1 = unknown)
+  int numa;         // NUMA node of the CPU this rank is running on (-1 = unknown)
+  int device;       // device id selected by Kokkos (-1 = host-only build)
+  int gpu_numa;     // NUMA node the device is attached to (-1 = unknown)
+  char busid[24];   // PCI bus id of the device
+};
+
+#if defined(__linux__)
+//----------------------------------------------------------------------------------------
+//! \fn int NodeOfCPU()
+//! \brief returns the NUMA node containing the given CPU by scanning the sysfs cpulist
+//! of each node, or -1 if it cannot be determined
+
+int NodeOfCPU(const int cpu) {
+  for (int node=0; node<1024; ++node) {
+    std::ostringstream fname;
+    fname << "/sys/devices/system/node/node" << node << "/cpulist";
+    std::ifstream f(fname.str());
+    if (!f.is_open()) {break;}  // nodes are numbered contiguously
+    std::string list;
+    std::getline(f, list);
+    std::istringstream ranges(list);
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+      int lo, hi;
+      if (std::sscanf(range.c_str(), "%d-%d", &lo, &hi) == 2) {
+        if ((cpu >= lo) && (cpu <= hi)) {return node;}
+      } else if (std::sscanf(range.c_str(), "%d", &lo) == 1) {
+        if (cpu == lo) {return node;}
+      }
+    }
+  }
+  return -1;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn std::string AffinityList()
+//! \brief formats the affinity mask as a cpulist string ("0-15,32-47"), counting the
+//! CPUs it contains in ncpu
+
+std::string AffinityList(const cpu_set_t &mask, int &ncpu) {
+  std::ostringstream list;
+  ncpu = CPU_COUNT(&mask);
+  int run_start = -1;
+  for (int cpu=0; cpu<=CPU_SETSIZE; ++cpu) {
+    bool in = (cpu < CPU_SETSIZE) && CPU_ISSET(cpu, &mask);
+    if (in && (run_start < 0)) {
+      run_start = cpu;
+    } else if (!in && (run_start >= 0)) {
+      if (list.tellp() > 0) {list << ",";}
+      if (run_start == cpu-1) {
+        list << run_start;
+      } else {
+        list << run_start << "-" << (cpu-1);
+      }
+      run_start = -1;
+    }
+  }
+  return list.str();
+}
+#endif  // __linux__
+
+//----------------------------------------------------------------------------------------
+//! \fn PlacementRecord DetectPlacement()
+//! \brief fills a placement record for this rank
+
+PlacementRecord DetectPlacement() {
+  PlacementRecord rec;
+  std::memset(&rec, 0, sizeof(rec));
+  rec.ncpu = -1;
+  rec.ncpu_node = -1;
+  rec.numa = -1;
+  rec.device = -1;
+  rec.gpu_numa = -1;
+  std::strncpy(rec.host, "unknown", sizeof(rec.host)-1);
+#if defined(__linux__)
+  gethostname(rec.host, sizeof(rec.host)-1);
+  rec.ncpu_node = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+  cpu_set_t mask;
+  if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+    std::string list = AffinityList(mask, rec.ncpu);
+    std::strncpy(rec.cpus, list.c_str(), sizeof(rec.cpus)-1);
+  }
+  rec.numa = NodeOfCPU(sched_getcpu());
+#if defined(KOKKOS_ENABLE_CUDA)
+  cudaGetDevice(&rec.device);
+  cudaDeviceGetPCIBusId(rec.busid, sizeof(rec.busid), rec.device);
+#elif defined(KOKKOS_ENABLE_HIP)
+  hipGetDevice(&rec.device);
+  hipDeviceGetPCIBusId(rec.busid, sizeof(rec.busid), rec.device);
+#endif
+  if (rec.busid[0] != '\0') {
+    // sysfs paths use a lower-case bus id
+    std::string busid(rec.busid);
+    for (auto &c : busid) {c = static_cast<char>(std::tolower(c));}
+    std::ifstream f("/sys/bus/pci/devices/" + busid + "/numa_node");
+    if (f.is_open()) {f >> rec.gpu_numa;}
+  }
+#endif  // __linux__
+  return rec;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void ReportRuntimePlacement()
+//! \brief gathers per-rank placement records to rank 0, prints the rank-to-device
+//! mapping table, and warns about detectable placement misconfigurations.  Collective
+
+void ReportRuntimePlacement() {
+  PlacementRecord rec = DetectPlacement();
+  std::vector<PlacementRecord> recs(global_variable::nranks);
+#if MPI_PARALLEL_ENABLED
+  MPI_Gather(&rec, sizeof(rec), MPI_BYTE, recs.data(), sizeof(rec), MPI_BYTE, 0,
+             MPI_COMM_WORLD);
+#else
+  recs[0] = rec;
+#endif
+  if (global_variable::my_rank != 0) {return;}
+
+  std::cout << std::endl << "Runtime placement (rank -> host/cpus/device):" << std::endl
+            << std::setw(6) << "rank" << std::setw(18) << "host" << std::setw(6) <<"ncpu"
+            << std::setw(20) << "cpus" << std::setw(6) << "numa" << std::setw(5) << "dev"
+            << std::setw(14) << "bus_id" << std::setw(9) << "dev_numa" << std::endl;
+  for (int r=0; r<global_variable::nranks; ++r) {
+    std::cout << std::setw(6) << r << std::setw(18) << recs[r].host
+              << std::setw(6) << recs[r].ncpu << std::setw(20) << recs[r].cpus
+              << std::setw(6) << recs[r].numa << std::setw(5) << recs[r].device
+              << std::setw(14) << ((recs[r].busid[0] != '\0')? recs[r].busid : "-")
+              << std::setw(9) << recs[r].gpu_numa << std::endl;
+  }
+
+  // warn when several ranks on the same host selected the same device
+  for (int r=0; r<global_variable::nranks; ++r) {
+    for (int s=0; s<r; ++s) {
+      if ((recs[r].device >= 0) && (recs[r].device == recs[s].device) &&
+          (std::strcmp(recs[r].host, recs[s].host) == 0)) {
+        std::cout << "WARNING: ranks " << s << " and " << r << " on host "
+                  << recs[r].host << " share device " << recs[r].device
+                  << "; check the launcher's GPU binding" << std::endl;
+      }
+    }
+  }
+  // warn when ranks sharing a host are not CPU-bound at all (full affinity mask);
+  // unbound ranks migrate across NUMA domains and contend for the same cores
+  for (int r=0; r<global_variable::nranks; ++r) {
+    if ((recs[r].ncpu > 0) && (recs[r].ncpu == recs[r].ncpu_node)) {
+      bool shared = false;
+      for (int s=0; s<global_variable::nranks; ++s) {
+        if ((s != r) && (std::strcmp(recs[r].host, recs[s].host) == 0)) {shared = true;}
+      }
+      if (shared) {
+        std::cout << "WARNING: rank " << r << " on host " << recs[r].host
+                  << " is not bound to a CPU subset; use the launcher's core binding"
+                  << std::endl;
+      }
+    }
+  }
+  // warn when a rank runs on a different NUMA node than its device is attached to,
+  // which puts the pinned staging buffers (and all H<->D traffic) a hop away
+  for (int r=0; r<global_variable::nranks; ++r) {
+    if ((recs[r].numa >= 0) && (recs[r].gpu_numa >= 0) &&
+        (recs[r].numa != recs[r].gpu_numa)) {
+      std::cout << "WARNING: rank " << r << " runs on NUMA node " << recs[r].numa
+                << " but its device is attached to node " << recs[r].gpu_numa
+                << "; bind the rank near its device" << std::endl;
+    }
+  }
+  return;
+}
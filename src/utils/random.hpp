@@ -189,4 +189,71 @@ static Real RanGaussian(int64_t *idum) {
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn RanPhilox
+//! \brief  Counter-based random number generator following Philox4x32-10 (Salmon et al.
+//! 2011, "Parallel random numbers: as easy as 1, 2, 3").  Unlike Ran2/RanSt above there
+//! is no carried state: the deviate is a pure function of (id, step, seed), so every
+//! thread of a par_for can draw its own number with no sequential dependence, and the
+//! stream a given particle sees is identical regardless of how particles are distributed
+//! across ranks.  Use the particle tag as id and the cycle (or draw) number as step.
+//! Returns a uniform deviate in (0,1), exclusive of the endpoint values.
+
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+
+KOKKOS_INLINE_FUNCTION
+static double RanPhilox(int64_t id, int64_t step, int64_t seed) {
+  // counter holds (id, step); key holds the seed.  All arithmetic is mod 2^32
+  uint32_t c0 = static_cast<uint32_t>(id);
+  uint32_t c1 = static_cast<uint32_t>(static_cast<uint64_t>(id) >> 32);
+  uint32_t c2 = static_cast<uint32_t>(step);
+  uint32_t c3 = static_cast<uint32_t>(static_cast<uint64_t>(step) >> 32);
+  uint32_t k0 = static_cast<uint32_t>(seed);
+  uint32_t k1 = static_cast<uint32_t>(static_cast<uint64_t>(seed) >> 32);
+  for (int r=0; r<10; r++) {
+    uint64_t p0 = static_cast<uint64_t>(PHILOX_M0)*c0;
+    uint64_t p1 = static_cast<uint64_t>(PHILOX_M1)*c2;
+    uint32_t h0 = static_cast<uint32_t>(p0 >> 32), l0 = static_cast<uint32_t>(p0);
+    uint32_t h1 = static_cast<uint32_t>(p1 >> 32), l1 = static_cast<uint32_t>(p1);
+    c0 = h1 ^ c1 ^ k0;
+    c1 = l1;
+    c2 = h0 ^ c3 ^ k1;
+    c3 = l0;
+    k0 += PHILOX_W0;  // bump the key each round (Weyl sequence)
+    k1 += PHILOX_W1;
+  }
+  // fold two of the four output words into a 53-bit mantissa; the +0.5 centers the
+  // deviate in its bin so 0.0 and 1.0 are never returned
+  uint64_t bits = ((static_cast<uint64_t>(c0) << 32) | c1) >> 11;
+  return (static_cast<double>(bits) + 0.5) * (1.0/9007199254740992.0); // 2^-53
+}
+
+#undef PHILOX_M0
+#undef PHILOX_M1
+#undef PHILOX_W0
+#undef PHILOX_W1
+
+//----------------------------------------------------------------------------------------
+//! \fn RanGaussianPhilox
+//! \brief  Gaussian deviate built on RanPhilox by the Box-Mueller transform.  Stateless
+//! like RanPhilox itself; the rejection loop advances the step counter, so callers that
+//! draw again for the same particle must offset step by a stride larger than the few
+//! retries the loop may consume (e.g. step = ncycle*16 + draw).
+
+KOKKOS_INLINE_FUNCTION
+static double RanGaussianPhilox(int64_t id, int64_t step, int64_t seed) {
+  double fac, rsq, v1, v2;
+  do {
+    v1 = 2.0 * RanPhilox(id, step  , seed) - 1.0;
+    v2 = 2.0 * RanPhilox(id, step+1, seed) - 1.0;
+    rsq = v1 * v1 + v2 * v2;
+    step += 2;
+  } while (rsq >= 1.0 || rsq == 0.0);
+  fac = sqrt(-2.0*log(rsq)/rsq);
+  return v2*fac;
+}
+
 #endif // UTILS_RANDOM_HPP_
@@ -24,6 +24,11 @@ void ShowConfig() {
   }
 #if MPI_PARALLEL_ENABLED
   std::cout<<"  MPI parallelism:            ON" << std::endl;
+#if GPU_AWARE_MPI_ENABLED
+  std::cout<<"  GPU-aware MPI:              ON" << std::endl;
+#else
+  std::cout<<"  GPU-aware MPI:              OFF (pinned host staging)" << std::endl;
+#endif
 #else
   std::cout<<"  MPI parallelism:            OFF" << std::endl;
 #endif
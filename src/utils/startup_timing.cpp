@@ -0,0 +1,92 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file startup_timing.cpp
+//! \brief implementation of startup phase timing (see startup_timing.hpp)
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "startup_timing.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace startup_timing {
+
+namespace {
+
+Kokkos::Timer timer_;                                  // reset by Begin()
+double last_ = 0.0;                                    // elapsed at previous mark
+std::vector<std::pair<std::string, double>> phases_;   // (name, seconds) in order
+
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void Begin()
+//! \brief start the startup clock
+
+void Begin() {
+  timer_.reset();
+  last_ = 0.0;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MarkPhase()
+//! \brief record completion of the named phase
+
+void MarkPhase(const char *name) {
+  double now = timer_.seconds();
+  phases_.emplace_back(name, now - last_);
+  last_ = now;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Report()
+//! \brief print table of per-phase elapsed seconds, reduced to min/max across ranks.
+//! A phase whose max is far above its min is limited by one slow or waiting rank
+//! (serialized I/O, imbalanced tree ownership); one whose min is already large is
+//! serial work on every rank
+
+void Report() {
+  int nphase = static_cast<int>(phases_.size());
+  if (nphase == 0) {return;}
+  std::vector<double> tmin(nphase), tmax(nphase);
+  for (int n=0; n<nphase; ++n) {
+    tmin[n] = phases_[n].second;
+    tmax[n] = phases_[n].second;
+  }
+#if MPI_PARALLEL_ENABLED
+  // phases are stamped in the same order on every rank, so reduce elementwise
+  MPI_Allreduce(MPI_IN_PLACE, tmin.data(), nphase, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, tmax.data(), nphase, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
+  if (global_variable::my_rank != 0) {return;}
+  double tot_min = 0.0, tot_max = 0.0;
+  std::cout << std::endl << "Startup timing (seconds, min/max over ranks):" << std::endl
+            << std::setw(24) << "phase" << std::setw(12) << "min"
+            << std::setw(12) << "max" << std::endl;
+  std::cout << std::scientific << std::setprecision(3);
+  for (int n=0; n<nphase; ++n) {
+    std::cout << std::setw(24) << phases_[n].first << std::setw(12) << tmin[n]
+              << std::setw(12) << tmax[n] << std::endl;
+    tot_min += tmin[n];
+    tot_max += tmax[n];
+  }
+  std::cout << std::setw(24) << "total" << std::setw(12) << tot_min
+            << std::setw(12) << tot_max << std::endl;
+  std::cout.unsetf(std::ios_base::floatfield);
+  return;
+}
+
+}  // namespace startup_timing
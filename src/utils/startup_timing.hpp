@@ -0,0 +1,33 @@
+#ifndef UTILS_STARTUP_TIMING_HPP_
+#define UTILS_STARTUP_TIMING_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file startup_timing.hpp
+//! \brief per-phase timing of everything between process start and the first cycle.
+//! On large AMR restarts time-to-first-cycle is dominated by serial phases (tree
+//! build, buffer initialization, problem generator, initial exchanges) that the cycle
+//! diagnostics and per-task timers never see.  Phases are stamped as they complete in
+//! main() and Driver::Initialize(); with <time>/startup_report=true a table of
+//! per-phase min/max seconds across ranks is printed just before cycling begins, so
+//! rank imbalance in startup (e.g. one rank reading while others wait in the first
+//! collective) is visible directly.  Stamping is always on — it costs two reads of
+//! the clock per phase — only the report is optional.
+
+namespace startup_timing {
+
+// start the startup clock; called from main() once Kokkos is initialized
+void Begin();
+
+// record completion of the named phase: elapsed seconds since the previous mark (or
+// since Begin).  Must be called on all ranks in the same order
+void MarkPhase(const char *name);
+
+// print table of per-phase elapsed seconds (min/max over ranks); collective
+void Report();
+
+}  // namespace startup_timing
+
+#endif // UTILS_STARTUP_TIMING_HPP_
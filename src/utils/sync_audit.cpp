@@ -0,0 +1,151 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file sync_audit.cpp
+//! \brief implementation of host-device sync auditing (see sync_audit.hpp).  The
+//! begin-deep-copy callback fires on the host for every Kokkos::deep_copy, including
+//! the one inside DualView::sync(); copies are attributed to the destination View's
+//! label.  Only copies that actually cross the host-device boundary are counted:
+//! pinned staging buffers (e.g. CudaHostPinned) are part of the intended comm path
+//! and are excluded, as are device-to-device copies.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "sync_audit.hpp"
+
+namespace sync_audit {
+
+namespace {
+
+struct LabelStats {
+  std::int64_t nsync=0;   // number of host<->device copies of this View
+  std::int64_t nbyte=0;   // total bytes moved
+  int last_cycle=-1;      // cycle in which the most recent copy fired (-1 = startup)
+};
+
+std::mutex mtx_;
+bool enabled_ = false;
+bool strict_ = false;                     // fatal on syncs during task list execution
+bool armed_ = false;                      // currently inside task list execution
+int cycle_ = -1;                          // current cycle (-1 until the main loop)
+std::int64_t cycle_nsync_ = 0;            // copies so far this cycle
+std::int64_t cycle_nbyte_ = 0;            // bytes so far this cycle
+std::map<std::string, LabelStats> stats_; // per-label totals, ordered for printing
+
+//----------------------------------------------------------------------------------------
+//! \fn bool HostSpace()
+//! \brief returns true only for the plain host memory space, where DualView host
+//! mirrors live.  Pinned host spaces have distinct names and are deliberately excluded
+
+bool HostSpace(const char *space_name) {
+  return (std::strcmp(space_name, "Host") == 0);
+}
+
+void BeginDeepCopyCB(const Kokkos::Tools::SpaceHandle dst_space, const char *dst_label,
+                     const void *dst_ptr, const Kokkos::Tools::SpaceHandle src_space,
+                     const char *src_label, const void *src_ptr, const uint64_t size) {
+  (void) dst_ptr;
+  (void) src_ptr;
+  // only copies with exactly one end in plain host memory cross the boundary
+  if (HostSpace(dst_space.name) == HostSpace(src_space.name)) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  // attribute to the destination label on downloads (device->host the destination is
+  // the host mirror, which carries the DualView's label); likewise uploads
+  const char *label = HostSpace(src_space.name)? dst_label : src_label;
+  auto &s = stats_[label];
+  s.nsync++;
+  s.nbyte += static_cast<std::int64_t>(size);
+  s.last_cycle = cycle_;
+  cycle_nsync_++;
+  cycle_nbyte_ += static_cast<std::int64_t>(size);
+  if (strict_ && armed_) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Host-device sync of '" << label << "' during task list "
+        << "execution in cycle " << cycle_ << " with <mesh>/sync_audit_strict=true"
+        << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void Enable()
+//! \brief install the begin-deep-copy callback
+
+void Enable(const bool strict) {
+  Kokkos::Tools::Experimental::set_begin_deep_copy_callback(BeginDeepCopyCB);
+  enabled_ = true;
+  strict_ = strict;
+}
+
+bool IsEnabled() {
+  return enabled_;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BeginCycle()
+//! \brief roll per-cycle counters; print one-line total for the previous cycle if it
+//! had any host<->device traffic.  On a static mesh in steady state this line should
+//! never appear, so each occurrence is itself the diagnostic
+
+void BeginCycle(const int ncycle) {
+  if (!enabled_) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  if ((cycle_nsync_ > 0) && (global_variable::my_rank == 0)) {
+    std::cout << "sync_audit: cycle=" << cycle_ << " nsync=" << cycle_nsync_
+              << " bytes=" << cycle_nbyte_ << std::endl;
+  }
+  cycle_ = ncycle;
+  cycle_nsync_ = 0;
+  cycle_nbyte_ = 0;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+// ArmStrict()/DisarmStrict(): mark entry/exit of task list execution within a cycle
+
+void ArmStrict() {
+  if (!enabled_) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  armed_ = true;
+}
+
+void DisarmStrict() {
+  if (!enabled_) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  armed_ = false;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Report()
+//! \brief print table of per-label sync counts.  The last-cycle column separates
+//! startup-only syncs (-1, harmless) from ones that fired inside the main loop
+
+void Report() {
+  if (!enabled_ || (global_variable::my_rank != 0)) {return;}
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (stats_.empty()) {return;}
+  std::cout << std::endl << "Host-device sync audit (rank 0):" << std::endl
+            << std::setw(32) << "label" << std::setw(12) << "nsync"
+            << std::setw(16) << "bytes" << std::setw(12) << "last_cycle" << std::endl;
+  for (auto &s : stats_) {
+    std::cout << std::setw(32) << s.first << std::setw(12) << s.second.nsync
+              << std::setw(16) << s.second.nbyte
+              << std::setw(12) << s.second.last_cycle << std::endl;
+  }
+  return;
+}
+
+}  // namespace sync_audit
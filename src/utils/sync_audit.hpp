@@ -0,0 +1,44 @@
+#ifndef UTILS_SYNC_AUDIT_HPP_
+#define UTILS_SYNC_AUDIT_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file sync_audit.hpp
+//! \brief audit surface for host-device synchronization of DualArrays (and any other
+//! host<->device copy).  Mesh and boundary metadata live in DualViews, and a stray
+//! .sync() on the wrong side of a modify() turns into a blocking transfer every cycle
+//! that is invisible in the per-task timers.  With <mesh>/sync_audit=true every
+//! host<->device copy is counted per View label and stamped with the cycle in which it
+//! last fired, a one-line total is printed for any cycle with traffic, and a table of
+//! offending labels is printed at the end of the run.  With <mesh>/sync_audit_strict=
+//! true any such copy during task list execution (the steady-state evolution loop,
+//! where there should be none on a static mesh) is a fatal error naming the View.
+//! Implemented with the Kokkos Tools in-process begin-deep-copy callback, so DualView
+//! call sites are untouched; enabling it displaces any profiling tool loaded through
+//! KOKKOS_TOOLS_LIBS that uses the same hook.  On host-only builds the two sides of a
+//! DualView alias and sync() copies nothing, so the audit only reports on device builds.
+
+namespace sync_audit {
+
+// install the Kokkos Tools callback; strict makes copies during task list execution
+// fatal.  Called before the Mesh is constructed, alongside memory accounting
+void Enable(const bool strict);
+bool IsEnabled();
+
+// roll the per-cycle counters at the top of each cycle of the main loop, printing a
+// one-line total for the previous cycle if it had any host<->device traffic
+void BeginCycle(const int ncycle);
+
+// mark entry/exit of task list execution within a cycle; in strict mode copies are
+// only fatal while inside (AMR, outputs, and startup legitimately sync)
+void ArmStrict();
+void DisarmStrict();
+
+// print table of per-label sync counts, bytes, and last cycle seen (rank 0's own)
+void Report();
+
+}  // namespace sync_audit
+
+#endif // UTILS_SYNC_AUDIT_HPP_
@@ -13,6 +13,8 @@
 
 void ShowConfig();
 void ChangeRunDir(const std::string dir);
+void ValidateGPUAwareMPI();
+void ReportRuntimePlacement();
 int CreateMPITag(int lid, int buff_id, int phys_id);
 
 #endif // UTILS_UTILS_HPP_
@@ -0,0 +1,161 @@
+//========================================================================================
+// AthenaK astrophysical fluid dynamics code
+// Copyright(C) 2021 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file uvm_spill.cpp
+//! \brief implements the managed-memory spill allocator (see uvm_spill.hpp)
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "uvm_spill.hpp"
+
+namespace {
+
+struct SpillRecord {
+  std::string label;
+  void *ptr;
+  std::size_t nbytes;
+};
+
+bool enabled_ = false;
+std::mutex mutex_;
+std::vector<SpillRecord> records_;
+
+} // namespace
+
+namespace uvm_spill {
+
+//----------------------------------------------------------------------------------------
+//! \fn void uvm_spill::Enable()
+
+void Enable() {
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP)
+  enabled_ = true;
+#else
+  std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "<mesh>/uvm_spill requires a CUDA or HIP device build"
+            << std::endl;
+  std::exit(EXIT_FAILURE);
+#endif
+}
+
+bool IsEnabled() {return enabled_;}
+
+//----------------------------------------------------------------------------------------
+//! \fn void *uvm_spill::Allocate()
+//! \brief allocates zeroed managed memory, advises the driver to keep it resident on
+//! (and mapped into) the device, and registers it for Prefetch/Free/Report
+
+void *Allocate(const std::string &label, const std::size_t nbytes) {
+  void *ptr = nullptr;
+#if defined(KOKKOS_ENABLE_CUDA)
+  int dev;
+  if (cudaMallocManaged(&ptr, nbytes) != cudaSuccess ||
+      cudaGetDevice(&dev) != cudaSuccess) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "cudaMallocManaged of " << nbytes << " bytes for '"
+              << label << "' failed" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  cudaMemAdvise(ptr, nbytes, cudaMemAdviseSetPreferredLocation, dev);
+  cudaMemAdvise(ptr, nbytes, cudaMemAdviseSetAccessedBy, dev);
+  cudaMemset(ptr, 0, nbytes);
+#elif defined(KOKKOS_ENABLE_HIP)
+  int dev;
+  if (hipMallocManaged(&ptr, nbytes) != hipSuccess ||
+      hipGetDevice(&dev) != hipSuccess) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "hipMallocManaged of " << nbytes << " bytes for '"
+              << label << "' failed" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  hipMemAdvise(ptr, nbytes, hipMemAdviseSetPreferredLocation, dev);
+  hipMemAdvise(ptr, nbytes, hipMemAdviseSetAccessedBy, dev);
+  hipMemset(ptr, 0, nbytes);
+#endif
+  std::lock_guard<std::mutex> lock(mutex_);
+  records_.push_back({label, ptr, nbytes});
+  return ptr;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void uvm_spill::Free()
+
+void Free(void *ptr) {
+  if (ptr == nullptr) return;
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto it = records_.begin(); it != records_.end(); ++it) {
+    if (it->ptr == ptr) {
+#if defined(KOKKOS_ENABLE_CUDA)
+      cudaFree(ptr);
+#elif defined(KOKKOS_ENABLE_HIP)
+      hipFree(ptr);
+#endif
+      records_.erase(it);
+      return;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void uvm_spill::Prefetch()
+//! \brief queues migration of a registered allocation so its pages are resident before
+//! the access window opens, instead of faulting in on first touch
+
+void Prefetch(void *ptr, const bool to_device) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &rec : records_) {
+    if (rec.ptr == ptr) {
+#if defined(KOKKOS_ENABLE_CUDA)
+      int dev;
+      cudaGetDevice(&dev);
+      cudaMemPrefetchAsync(rec.ptr, rec.nbytes, (to_device)? dev : cudaCpuDeviceId);
+#elif defined(KOKKOS_ENABLE_HIP)
+      int dev;
+      hipGetDevice(&dev);
+      hipMemPrefetchAsync(rec.ptr, rec.nbytes, (to_device)? dev : hipCpuDeviceId);
+#endif
+      return;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void uvm_spill::PrefetchAll()
+
+void PrefetchAll() {
+  if (!enabled_) return;
+  std::vector<void *> ptrs;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &rec : records_) {ptrs.push_back(rec.ptr);}
+  }
+  for (void *p : ptrs) {Prefetch(p, true);}
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void uvm_spill::Report()
+
+void Report() {
+  if (!enabled_ || global_variable::my_rank != 0) return;
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::size_t total = 0;
+  std::cout << std::endl << "uvm_spill: arrays in managed (spill) memory:" << std::endl;
+  for (auto &rec : records_) {
+    std::cout << "  " << std::left << std::setw(24) << rec.label << std::right
+              << std::setw(14) << rec.nbytes << " bytes" << std::endl;
+    total += rec.nbytes;
+  }
+  std::cout << "  " << std::left << std::setw(24) << "total" << std::right
+            << std::setw(14) << total << " bytes" << std::endl;
+}
+
+} // namespace uvm_spill
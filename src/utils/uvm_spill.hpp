@@ -0,0 +1,63 @@
+#ifndef UTILS_UVM_SPILL_HPP_
+#define UTILS_UVM_SPILL_HPP_
+//========================================================================================
+// AthenaK astrophysical fluid dynamics code
+// Copyright(C) 2021 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file uvm_spill.hpp
+//! \brief opt-in managed-memory "spill" allocator for designated cold arrays.  When a
+//! problem slightly exceeds device memory, <mesh>/uvm_spill=true places the second
+//! time-integrator register (u1/b1), the coarse SMR/AMR arrays, and output staging in
+//! CUDA/HIP managed memory instead of device memory.  The driver can then page these
+//! arrays on demand, letting the run exceed HBM capacity at modest slowdown instead of
+//! halving blocks per rank.  Allocations are advised to prefer device residency and
+//! prefetched to the device once after setup; all other arrays stay in device memory.
+
+#include <cstddef>
+#include <string>
+
+#include "athena.hpp"
+
+namespace uvm_spill {
+
+//! enable spilling; fatal error unless built for a device backend with managed memory
+void Enable();
+bool IsEnabled();
+
+//! allocates (zeroed) managed memory registered under label; fatal error on failure
+void *Allocate(const std::string &label, const std::size_t nbytes);
+
+//! releases a registered spill allocation; silently ignores unknown pointers
+void Free(void *ptr);
+
+//! asynchronously migrates a registered allocation toward the device (or host)
+void Prefetch(void *ptr, const bool to_device);
+
+//! prefetches every registered allocation to the device (called once after setup)
+void PrefetchAll();
+
+//! prints per-label spilled bytes on rank 0
+void Report();
+
+//! \fn uvm_spill::Realloc
+//! \brief drop-in replacement for Kokkos::realloc at designated cold-array call sites:
+//! re-allocates the View in managed memory when spilling is enabled, releasing any
+//! spill allocation previously backing it, and falls back to Kokkos::realloc otherwise
+template <typename View, typename... Dims>
+void Realloc(View &arr, const std::string &label, Dims... dims) {
+  if (!IsEnabled()) {
+    Kokkos::realloc(arr, static_cast<int>(dims)...);
+    return;
+  }
+  Free(arr.data());
+  std::size_t nword = 1;
+  for (std::size_t d : {static_cast<std::size_t>(dims)...}) {nword *= d;}
+  using T = typename View::value_type;
+  T *ptr = static_cast<T *>(Allocate(label, nword*sizeof(T)));
+  arr = View(ptr, static_cast<int>(dims)...);
+}
+
+} // namespace uvm_spill
+
+#endif // UTILS_UVM_SPILL_HPP_
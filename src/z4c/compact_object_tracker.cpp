@@ -83,30 +83,42 @@ void CompactObjectTracker::InterpolateVelocity(MeshBlockPack *pmbp) {
   auto &padm = pmbp->padm;
   auto &pmhd = pmbp->pmhd;
   auto &pz4c = pmbp->pz4c;
-  auto *S    = new LagrangeInterpolator(pmbp, pos);
 
-  if (S->point_exist) {
+  // batched interpolator gathers all variables of each array in one device pass,
+  // instead of one host-synchronized read per stencil zone per variable
+  BatchLagrangeInterpolator S(pmbp, 1);
+  HostArray2D<Real> coords("co_pos", 1, 3);
+  for (int a = 0; a < 3; ++a) {
+    coords(0, a) = pos[a];
+  }
+  S.SetPoints(coords);
+
+  if (S.PointExists(0)) {
     owns_compact_object = true;
 
-    Real betax = S->Interpolate(pz4c->u0, pz4c->I_Z4C_BETAX);
-    Real betay = S->Interpolate(pz4c->u0, pz4c->I_Z4C_BETAY);
-    Real betaz = S->Interpolate(pz4c->u0, pz4c->I_Z4C_BETAZ);
+    S.Interpolate(pz4c->u0, {pz4c->I_Z4C_BETAX, pz4c->I_Z4C_BETAY, pz4c->I_Z4C_BETAZ,
+                             pz4c->I_Z4C_ALPHA});
+    Real betax = S.interp_vals.h_view(0, 0);
+    Real betay = S.interp_vals.h_view(0, 1);
+    Real betaz = S.interp_vals.h_view(0, 2);
+    Real alp   = S.interp_vals.h_view(0, 3);
     vel[0] = - betax;
     vel[1] = - betay;
     vel[2] = - betaz;
     if (type == NeutronStar) {
-      Real alp = S->Interpolate(pz4c->u0, pz4c->I_Z4C_ALPHA);
-
-      Real zx = S->Interpolate(pmhd->w0, IVX);
-      Real zy = S->Interpolate(pmhd->w0, IVY);
-      Real zz = S->Interpolate(pmhd->w0, IVZ);
-
-      Real gxx = S->Interpolate(padm->u_adm, padm->I_ADM_GXX);
-      Real gxy = S->Interpolate(padm->u_adm, padm->I_ADM_GXY);
-      Real gxz = S->Interpolate(padm->u_adm, padm->I_ADM_GXZ);
-      Real gyy = S->Interpolate(padm->u_adm, padm->I_ADM_GYY);
-      Real gyz = S->Interpolate(padm->u_adm, padm->I_ADM_GYZ);
-      Real gzz = S->Interpolate(padm->u_adm, padm->I_ADM_GZZ);
+      S.Interpolate(pmhd->w0, {IVX, IVY, IVZ});
+      Real zx = S.interp_vals.h_view(0, 0);
+      Real zy = S.interp_vals.h_view(0, 1);
+      Real zz = S.interp_vals.h_view(0, 2);
+
+      S.Interpolate(padm->u_adm, {padm->I_ADM_GXX, padm->I_ADM_GXY, padm->I_ADM_GXZ,
+                                  padm->I_ADM_GYY, padm->I_ADM_GYZ, padm->I_ADM_GZZ});
+      Real gxx = S.interp_vals.h_view(0, 0);
+      Real gxy = S.interp_vals.h_view(0, 1);
+      Real gxz = S.interp_vals.h_view(0, 2);
+      Real gyy = S.interp_vals.h_view(0, 3);
+      Real gyz = S.interp_vals.h_view(0, 4);
+      Real gzz = S.interp_vals.h_view(0, 5);
 
       Real z_x = gxx*zx + gxy*zy + gxz*zz;
       Real z_y = gxy*zx + gyy*zy + gyz*zz;
@@ -120,8 +132,6 @@ void CompactObjectTracker::InterpolateVelocity(MeshBlockPack *pmbp) {
   } else {
     owns_compact_object = false;
   }
-
-  delete S;
 }
 
 //----------------------------------------------------------------------------------------
@@ -20,6 +20,7 @@
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
 #include "bvals/bvals.hpp"
+#include "utils/memory_accounting.hpp"
 #include "z4c/compact_object_tracker.hpp"
 #include "z4c/z4c.hpp"
 #include "z4c/z4c_amr.hpp"
@@ -65,7 +66,10 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
   u_rhs("u_rhs z4c",1,1,1,1,1),
   u_weyl("u_weyl",1,1,1,1,1),
   coarse_u_weyl("coarse_u_weyl",1,1,1,1,1),
+  weyl_mask("weyl_mask",1),
   pamr(new Z4c_AMR(pin)) {
+  // attribute device allocations made in this constructor to the z4c subsystem
+  memory_accounting::Scope mem_scope("z4c");
   // (1) read time-evolution option [already error checked in driver constructor]
   // Then initialize memory and algorithms for reconstruction and Riemann solvers
   std::string evolution_t = pin->GetString("time","evolution");
@@ -144,6 +148,12 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
   opt.extrap_order = fmax(2,fmin(indcs.ng,fmin(4,
       pin->GetOrAddInteger("z4c", "extrap_order", 2))));
 
+  opt.con_norm_stride = fmax(1, pin->GetOrAddInteger("z4c", "con_norm_stride", 1));
+  opt.weyl_everywhere = pin->GetOrAddBoolean("z4c", "weyl_everywhere", false);
+  for (int n=0; n<8; ++n) {
+    con_norms[n] = 0.0;
+  }
+
   diss = opt.diss*pow(2., -2.*indcs.ng)*(indcs.ng % 2 == 0 ? -1. : 1.);
   }
 
@@ -176,9 +186,12 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
     Real rad = pin->GetOrAddReal("z4c", "extraction_radius_"+std::to_string(i), 10);
     grids.push_back(std::make_unique<SphericalGrid>(ppack, nlev, rad));
   }
-  // TODO(@dur566): Why is the size of psi_out hardcoded?
-  psi_out = new Real[nrad*77*2];
   mkdir("waveforms",0775);
+#if MPI_PARALLEL_ENABLED
+  // the waveform worker thread reduces on its own communicator so its traffic can
+  // never interleave with evolution messages
+  if (nrad > 0) {MPI_Comm_dup(MPI_COMM_WORLD, &wave_comm_);}
+#endif
   waveform_dt = pin->GetOrAddReal("z4c", "waveform_dt", 1);
   last_output_time = 0;
 
@@ -248,7 +261,11 @@ void Z4c::AlgConstr(MeshBlockPack *pmbp) {
 //----------------------------------------------------------------------------------------
 // destructor
 Z4c::~Z4c() {
-  delete[] psi_out;
+  // block until any in-flight waveform decomposition has been written out
+  FinishWaveWorker();
+#if MPI_PARALLEL_ENABLED
+  if (nrad > 0) {MPI_Comm_free(&wave_comm_);}
+#endif
   delete pbval_u;
   delete pbval_weyl;
   delete pamr;
@@ -12,6 +12,7 @@
 #include <memory>    // make_unique, unique_ptr
 #include <list>
 #include <string>
+#include <thread>
 #include <vector>
 #include "athena.hpp"
 #include "utils/finite_diff.hpp"
@@ -160,6 +161,10 @@ class Z4c {
   };
   Constraint_vars con;
 
+  // sampled constraint norms filled by ADMConstraintsNorms(), ordered as the Z4c
+  // history variables (H^2, M^2, Mx^2, My^2, Mz^2, Z^2, Theta^2, C^2)
+  Real con_norms[8];
+
   // aliases for the matter variables
   /*struct Matter_vars {
     AthenaTensor<Real, TensorSymm::NONE, 3, 0> rho;       // matter energy density
@@ -195,6 +200,13 @@ class Z4c {
     bool user_Sbc;
     // Boundary extrapolation order
     int extrap_order;
+    // Stride for sampled constraint monitoring: if >1 the constraints are only
+    // evaluated on every stride-th cell in each direction and reduced to norms,
+    // and the full constraint fields in u_con are not refreshed during evolution
+    int con_norm_stride;
+    // Evaluate the Weyl scalars on every block instead of only on blocks
+    // overlapping an extraction sphere (needed for volume dumps of psi4)
+    bool weyl_everywhere;
   };
   Options opt;
   Real diss;              // Dissipation parameter
@@ -212,11 +224,16 @@ class Z4c {
 
   // geodesic grid for wave extr
   std::vector<std::unique_ptr<SphericalGrid>> spherical_grids;
-  // array storing waveform at each radii
-  Real * psi_out;
+  // flags marking blocks that overlap an extraction sphere (rebuilt per regrid)
+  DualArray1D<bool> weyl_mask;
   Real waveform_dt;
   Real last_output_time;
   int nrad; // number of radii to perform wave extraction
+  // background thread decomposing and writing waveforms; evolution never waits on it
+  std::thread wave_worker_;
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm wave_comm_;  // unique communicator for waveform reductions off-thread
+#endif
 
   // functions
   void QueueZ4cTasks();
@@ -257,8 +274,11 @@ class Z4c {
   template <int NGHOST>
   void ADMConstraints(MeshBlockPack *pmbp);
   template <int NGHOST>
+  void ADMConstraintsNorms(MeshBlockPack *pmbp);
+  template <int NGHOST>
   void Z4cWeyl(MeshBlockPack *pmbp);
   void WaveExtr(MeshBlockPack *pmbp);
+  void FinishWaveWorker();
   void AlgConstr(MeshBlockPack *pmbp);
 
   Z4c_AMR *pamr;
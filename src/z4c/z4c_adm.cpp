@@ -235,44 +235,18 @@ void Z4c::Z4cToADM(MeshBlockPack *pmbp) {
   return;
 }
 //----------------------------------------------------------------------------------------
-//! \fn void Z4c::ADMConstraints(AthenaArray<Real> & u_adm, AthenaArray<Real> & u_mat)
-//! \brief compute constraints ADM vars
-//
-// Note: we are assuming that u_adm has been initialized with the correct
-// metric and matter quantities
-//
-// BAM: adm_constraints_N()
-// https://git.tpi.uni-jena.de/bamdev/adm
-// https://git.tpi.uni-jena.de/bamdev/adm/blob/master/adm_constraints_N.m
+//! \fn void ConstraintsAtPoint
+//! \brief pointwise evaluation of the ADM constraints at cell (m,k,j,i)
 //
-// The constraints are set only in the MeshBlock interior, because derivatives
-// of the ADM quantities are neded to compute them.
+// Shared between ADMConstraints(), which stores the full constraint fields, and
+// ADMConstraintsNorms(), which only accumulates norms over a decimated cell subset.
 template <int NGHOST>
-void Z4c::ADMConstraints(MeshBlockPack *pmbp) {
-  // capture variables for the kernel
-  auto &indcs = pmbp->pmesh->mb_indcs;
-  auto &size = pmbp->pmb->mb_size;
-  int &is = indcs.is; int &ie = indcs.ie;
-  int &js = indcs.js; int &je = indcs.je;
-  int &ks = indcs.ks; int &ke = indcs.ke;
-  //For GLOOPS
-
-  int nmb = pmbp->nmb_thispack;
-
-  auto &z4c = pmbp->pz4c->z4c;
-  auto &adm = pmbp->padm->adm;
-  auto &u_con = pmbp->pz4c->u_con;
-
-  // vacuum or with matter?
-  bool is_vacuum = (pmy_pack->ptmunu == nullptr) ? true : false;
-  Tmunu::Tmunu_vars tmunu;
-  if (!is_vacuum) tmunu = pmy_pack->ptmunu->tmunu;
-
-  Kokkos::deep_copy(u_con, 0.);
-  auto &con = pmbp->pz4c->con;
-  par_for("ADM constraints loop",DevExeSpace(),
-  0,nmb-1,ks,ke,js,je,is,ie,
-  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+KOKKOS_INLINE_FUNCTION
+static void ConstraintsAtPoint(const Z4c::Z4c_vars &z4c, const adm::ADM::ADM_vars &adm,
+                               const Tmunu::Tmunu_vars &tmunu, const bool is_vacuum,
+                               const Real idx[], const int m, const int k, const int j,
+                               const int i,
+                               Real &H, Real &M, Real &Z, Real &C, Real (&vM_d)[3]) {
     AthenaScratchTensor<Real, TensorSymm::NONE, 3, 1> Gamma_u;
     AthenaScratchTensor<Real, TensorSymm::NONE, 3, 1> Gamma_u_z4c;
     AthenaScratchTensor<Real, TensorSymm::NONE, 3, 1> M_u;
@@ -295,8 +269,6 @@ void Z4c::ADMConstraints(MeshBlockPack *pmbp) {
 
     AthenaScratchTensor<Real, TensorSymm::SYM22, 3, 4> ddg_dddd;
 
-    Real idx[] = {1/size.d_view(m).dx1, 1/size.d_view(m).dx2, 1/size.d_view(m).dx3};
-
     // -----------------------------------------------------------------------------------
     // derivatives
     //
@@ -471,9 +443,9 @@ void Z4c::ADMConstraints(MeshBlockPack *pmbp) {
     //
     // Hamiltonian constraint
     //
-    con.H(m,k,j,i) = R + SQR(K) - KK;
+    H = R + SQR(K) - KK;
     if(!is_vacuum) {
-      con.H(m,k,j,i) -= 16*M_PI * tmunu.E(m,k,j,i);
+      H -= 16*M_PI * tmunu.E(m,k,j,i);
     }
     // Momentum constraint (contravariant)
     //
@@ -492,31 +464,174 @@ void Z4c::ADMConstraints(MeshBlockPack *pmbp) {
 
     // Momentum constraint (covariant)
     for(int a = 0; a < 3; ++a) {
+      vM_d[a] = 0.0;
       for(int b = 0; b < 3; ++b) {
-        con.M_d(m,a,k,j,i) += adm.g_dd(m,a,b,k,j,i) * M_u(b);
+        vM_d[a] += adm.g_dd(m,a,b,k,j,i) * M_u(b);
       }
     }
 
     // Momentum constraint (norm squared)
+    M = 0.0;
     for(int a = 0; a < 3; ++a)
     for(int b = 0; b < 3; ++b) {
-      con.M(m,k,j,i) += adm.g_dd(m,a,b,k,j,i) * M_u(a) * M_u(b);
+      M += adm.g_dd(m,a,b,k,j,i) * M_u(a) * M_u(b);
     }
 
     // Constraint violation Z (norm squared)
+    Z = 0.0;
     for(int a = 0; a < 3; ++a)
     for(int b = 0; b < 3; ++b) {
-      con.Z(m,k,j,i) += 0.25*z4c.g_dd(m,a,b,k,j,i)
-                        *(z4c.vGam_u(m,a,k,j,i) - Gamma_u_z4c(a))
-                        *(z4c.vGam_u(m,b,k,j,i) - Gamma_u_z4c(b));
+      Z += 0.25*z4c.g_dd(m,a,b,k,j,i)
+           *(z4c.vGam_u(m,a,k,j,i) - Gamma_u_z4c(a))
+           *(z4c.vGam_u(m,b,k,j,i) - Gamma_u_z4c(b));
     }
 
     // Constraint violation monitor C^2
-    con.C(m,k,j,i) = SQR(con.H(m,k,j,i)) + con.M(m,k,j,i) +
-                     SQR(z4c.vTheta(m,k,j,i)) + 4.0*con.Z(m,k,j,i);
+    C = SQR(H) + M + SQR(z4c.vTheta(m,k,j,i)) + 4.0*Z;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Z4c::ADMConstraints(AthenaArray<Real> & u_adm, AthenaArray<Real> & u_mat)
+//! \brief compute constraints ADM vars
+//
+// Note: we are assuming that u_adm has been initialized with the correct
+// metric and matter quantities
+//
+// BAM: adm_constraints_N()
+// https://git.tpi.uni-jena.de/bamdev/adm
+// https://git.tpi.uni-jena.de/bamdev/adm/blob/master/adm_constraints_N.m
+//
+// The constraints are set only in the MeshBlock interior, because derivatives
+// of the ADM quantities are neded to compute them.
+template <int NGHOST>
+void Z4c::ADMConstraints(MeshBlockPack *pmbp) {
+  // capture variables for the kernel
+  auto &indcs = pmbp->pmesh->mb_indcs;
+  auto &size = pmbp->pmb->mb_size;
+  int &is = indcs.is; int &ie = indcs.ie;
+  int &js = indcs.js; int &je = indcs.je;
+  int &ks = indcs.ks; int &ke = indcs.ke;
+  //For GLOOPS
+
+  int nmb = pmbp->nmb_thispack;
+
+  auto &z4c = pmbp->pz4c->z4c;
+  auto &adm = pmbp->padm->adm;
+  auto &u_con = pmbp->pz4c->u_con;
+
+  // vacuum or with matter?
+  bool is_vacuum = (pmy_pack->ptmunu == nullptr) ? true : false;
+  Tmunu::Tmunu_vars tmunu;
+  if (!is_vacuum) tmunu = pmy_pack->ptmunu->tmunu;
+
+  Kokkos::deep_copy(u_con, 0.);
+  auto &con = pmbp->pz4c->con;
+  par_for("ADM constraints loop",DevExeSpace(),
+  0,nmb-1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    Real idx[] = {1/size.d_view(m).dx1, 1/size.d_view(m).dx2, 1/size.d_view(m).dx3};
+
+    Real H, M, Z, C;
+    Real vM_d[3];
+    ConstraintsAtPoint<NGHOST>(z4c, adm, tmunu, is_vacuum, idx, m, k, j, i,
+                               H, M, Z, C, vM_d);
+
+    con.H(m,k,j,i) = H;
+    con.M(m,k,j,i) = M;
+    con.Z(m,k,j,i) = Z;
+    con.C(m,k,j,i) = C;
+    for(int a = 0; a < 3; ++a) {
+      con.M_d(m,a,k,j,i) = vM_d[a];
+    }
 });
 }
 template void Z4c::ADMConstraints<2>(MeshBlockPack *pmbp);
 template void Z4c::ADMConstraints<3>(MeshBlockPack *pmbp);
 template void Z4c::ADMConstraints<4>(MeshBlockPack *pmbp);
+
+//----------------------------------------------------------------------------------------
+//! \fn void Z4c::ADMConstraintsNorms(MeshBlockPack *pmbp)
+//! \brief accumulate constraint norms over a decimated cell subset
+//
+// Reduction-only counterpart of ADMConstraints(): the constraints are evaluated on
+// every con_norm_stride-th cell in each direction and summed directly, without storing
+// the full constraint fields in u_con. Each sample is weighted by the volume of the
+// stride^3 cells it represents, so the sums are sampled estimates of the volume
+// integrals accumulated by the history output. Results are stored in con_norms[],
+// ordered as the Z4c history variables.
+template <int NGHOST>
+void Z4c::ADMConstraintsNorms(MeshBlockPack *pmbp) {
+  // capture variables for the kernel
+  auto &indcs = pmbp->pmesh->mb_indcs;
+  auto &size = pmbp->pmb->mb_size;
+  int &is = indcs.is;
+  int &js = indcs.js;
+  int &ks = indcs.ks;
+
+  int nmb = pmbp->nmb_thispack;
+
+  auto &z4c = pmbp->pz4c->z4c;
+  auto &adm = pmbp->padm->adm;
+
+  // vacuum or with matter?
+  bool is_vacuum = (pmy_pack->ptmunu == nullptr) ? true : false;
+  Tmunu::Tmunu_vars tmunu;
+  if (!is_vacuum) tmunu = pmy_pack->ptmunu->tmunu;
+
+  // number of samples per direction on the decimated grid
+  int &stride = opt.con_norm_stride;
+  int nx1s = (indcs.nx1 + stride - 1)/stride;
+  int nx2s = (indcs.nx2 + stride - 1)/stride;
+  int nx3s = (indcs.nx3 + stride - 1)/stride;
+  const int nmkji = nmb*nx3s*nx2s*nx1s;
+  const int nkji = nx3s*nx2s*nx1s;
+  const int nji  = nx2s*nx1s;
+  array_sum::GlobalSum sum_this_mb;
+  Kokkos::parallel_reduce("z4c constraint norms",
+  Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &p, array_sum::GlobalSum &mb_sum) {
+    // compute m,k,j,i indices of thread on the decimated grid
+    int m = (p)/nkji;
+    int k = (p - m*nkji)/nji;
+    int j = (p - m*nkji - k*nji)/nx1s;
+    int i = (p - m*nkji - k*nji - j*nx1s)*stride + is;
+    k = k*stride + ks;
+    j = j*stride + js;
+
+    Real idx[] = {1/size.d_view(m).dx1, 1/size.d_view(m).dx2, 1/size.d_view(m).dx3};
+
+    Real H, M, Z, C;
+    Real vM_d[3];
+    ConstraintsAtPoint<NGHOST>(z4c, adm, tmunu, is_vacuum, idx, m, k, j, i,
+                               H, M, Z, C, vM_d);
+
+    // each sample stands in for stride^3 cells
+    Real vol = size.d_view(m).dx1*size.d_view(m).dx2*size.d_view(m).dx3
+               *static_cast<Real>(stride*stride*stride);
+
+    array_sum::GlobalSum hvars;
+    hvars.the_array[0] = vol*SQR(H);       // ||H||^2
+    hvars.the_array[1] = vol*M;            // ||M||^2 (comes already squared)
+    hvars.the_array[2] = vol*SQR(vM_d[0]); // ||Mx||^2
+    hvars.the_array[3] = vol*SQR(vM_d[1]); // ||My||^2
+    hvars.the_array[4] = vol*SQR(vM_d[2]); // ||Mz||^2
+    hvars.the_array[5] = vol*Z;            // ||Z||^2 (comes already squared)
+    hvars.the_array[6] = vol*SQR(z4c.vTheta(m,k,j,i)); // ||Theta||^2
+    hvars.the_array[7] = vol*C;            // ||C||^2 (comes already squared)
+    for (int n=8; n<NREDUCTION_VARIABLES; ++n) {
+      hvars.the_array[n] = 0.0;
+    }
+
+    // sum into parallel reduce
+    mb_sum += hvars;
+  }, Kokkos::Sum<array_sum::GlobalSum>(sum_this_mb));
+
+  for (int n=0; n<8; ++n) {
+    con_norms[n] = sum_this_mb.the_array[n];
+  }
+  return;
+}
+template void Z4c::ADMConstraintsNorms<2>(MeshBlockPack *pmbp);
+template void Z4c::ADMConstraintsNorms<3>(MeshBlockPack *pmbp);
+template void Z4c::ADMConstraintsNorms<4>(MeshBlockPack *pmbp);
 } // namespace z4c
@@ -5,6 +5,7 @@
 //========================================================================================
 
 #include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <iostream>
 #include <limits>
@@ -30,12 +31,20 @@ Z4c_AMR::Z4c_AMR(ParameterInput *pin) {
     method = Trivial;
   } else if (ref_method == "tracker") {
     method = Tracker;
+    // box-in-box: derive the target level of every block analytically from the
+    // puncture distance instead of holding a single level inside a single radius
+    tracker_box_in_box = pin->GetOrAddBoolean("z4c_amr", "tracker_box_in_box", false);
   } else if (ref_method == "chi") {
     method = Chi;
     chi_thresh = pin->GetOrAddReal("z4c_amr", "chi_min", 0.2);
+    // de-refine only once min{chi} rises above this (default keeps historical 1.25x
+    // band); widening the band damps refine/derefine ping-pong near the threshold
+    chi_deref_thresh = pin->GetOrAddReal("z4c_amr", "chi_min_deref", 1.25*chi_thresh);
   } else if (ref_method == "dchi") {
     method = dChi;
     dchi_thresh = pin->GetOrAddReal("z4c_amr", "dchi_max", 0.1);
+    // de-refine only once max{dchi} falls below this (default keeps historical 0.5x)
+    dchi_deref_thresh = pin->GetOrAddReal("z4c_amr", "dchi_max_deref", 0.5*dchi_thresh);
   } else {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line "
               << __LINE__ << std::endl;
@@ -108,7 +117,25 @@ void Z4c_AMR::RefineTracker(MeshBlockPack *pmbp) {
         (pt.GetPos(1) >= x2min && pt.GetPos(1) <= x2max) &&
         (pt.GetPos(2) >= x3min && pt.GetPos(2) <= x3max);
 
-      if (dmin2 < SQ(pt.GetRadius()) || iscontained) {
+      if (tracker_box_in_box) {
+        // target level is fully determined by the puncture distance: the finest level
+        // inside the nominal radius, one level less for each doubling of the distance.
+        // No field data is touched, so the whole check is host-side arithmetic.
+        int finest = (pt.GetReflevel() < 0) ?
+            (pmesh->max_level - pmesh->root_level) : pt.GetReflevel();
+        int target = finest;
+        if (!iscontained && dmin2 > SQ(pt.GetRadius())) {
+          target -= static_cast<int>(
+              std::ceil(std::log2(std::sqrt(dmin2)/pt.GetRadius())));
+        }
+        if (level < target) {
+          flag.push_back(1);
+        } else if (level == target) {
+          flag.push_back(0);
+        } else {
+          flag.push_back(-1);
+        }
+      } else if (dmin2 < SQ(pt.GetRadius()) || iscontained) {
         if (pt.GetReflevel() < 0 || level < pt.GetReflevel()) {
           flag.push_back(1);
         } else if (level == pt.GetReflevel()) {
@@ -144,6 +171,7 @@ void Z4c_AMR::RefineChiMin(MeshBlockPack *pmbp) {
   int I_Z4C_CHI  = pmbp->pz4c->I_Z4C_CHI;
   // note: we need this to prevent capture by this in the lambda expr.
   auto chi_thresh = this->chi_thresh;
+  auto chi_deref  = this->chi_deref_thresh;
 
   par_for_outer(
     "Z4c_AMR::ChiMin", DevExeSpace(), 0, 0, 0, (nmb - 1),
@@ -164,14 +192,11 @@ void Z4c_AMR::RefineChiMin(MeshBlockPack *pmbp) {
       if (team_dmin < chi_thresh) {
         refine_flag.d_view(m + mbs) = 1;
       }
-      if (team_dmin > 1.25 * chi_thresh) {
+      if (team_dmin > chi_deref) {
         refine_flag.d_view(m + mbs) = -1;
       }
     });
-
-  // sync host and device
-  refine_flag.template modify<DevExeSpace>();
-  refine_flag.template sync<HostMemSpace>();
+  // flags are consumed on device; CheckForRefinement() reconciles with host as needed
 }
 
 // refine based on max{dchi}
@@ -190,6 +215,7 @@ void Z4c_AMR::RefineDchiMax(MeshBlockPack *pmbp) {
   int I_Z4C_CHI  = pmbp->pz4c->I_Z4C_CHI;
   // note: we need this to prevent capture by this in the lambda expr.
   auto dchi_thresh = this->dchi_thresh;
+  auto dchi_deref  = this->dchi_deref_thresh;
 
   par_for_outer(
     "Z4c_AMR::ChiMin", DevExeSpace(), 0, 0, 0, (nmb - 1),
@@ -213,14 +239,11 @@ void Z4c_AMR::RefineDchiMax(MeshBlockPack *pmbp) {
       if (team_dmax > dchi_thresh) {
         refine_flag.d_view(m + mbs) = 1;
       }
-      if (team_dmax < 0.5 * dchi_thresh) {
+      if (team_dmax < dchi_deref) {
         refine_flag.d_view(m + mbs) = -1;
       }
     });
-
-  // sync host and device
-  refine_flag.template modify<DevExeSpace>();
-  refine_flag.template sync<HostMemSpace>();
+  // flags are consumed on device; CheckForRefinement() reconciles with host as needed
 }
 
 // Enforce some minimum resolution within a certain spherical region
@@ -35,12 +35,18 @@ class Z4c_AMR {
 
   RefinementMethod method;
 
+  // tracker method: build a nested box-in-box hierarchy around each puncture, with the
+  // target level dropping by one for each doubling of the distance to the object
+  bool tracker_box_in_box;
+
   // Optinally set the minimum refinement level inside different radial shells
   std::vector<Real> radius;
   std::vector<int> reflevel;
 
-  Real chi_thresh;     // chi threshold for chi refinement method
-  Real dchi_thresh;    // dchi threshold for dchi refinement method
+  Real chi_thresh;        // chi threshold for chi refinement method
+  Real chi_deref_thresh;  // chi de-refinement threshold (hysteresis band above chi_min)
+  Real dchi_thresh;       // dchi threshold for dchi refinement method
+  Real dchi_deref_thresh; // dchi de-refinement threshold (hysteresis band below)
 };
 
 } // namespace z4c
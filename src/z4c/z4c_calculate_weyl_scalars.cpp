@@ -42,8 +42,53 @@ void Z4c::Z4cWeyl(MeshBlockPack *pmbp) {
   auto &u_weyl = pmbp->pz4c->u_weyl;
   Kokkos::deep_copy(u_weyl, 0.);
 
+  // psi4 is only consumed interpolated onto the extraction spheres, so unless a
+  // full-mesh evaluation was requested mark the blocks any sphere overlaps and skip
+  // the rest. The interpolation stencil spans 2*ng cells, so blocks are padded by
+  // ng cell widths to also cover stencils served from neighboring ghost zones.
+  // Block positions and sizes change under AMR, hence the mask is rebuilt per call.
+  auto &weyl_mask = pmbp->pz4c->weyl_mask;
+  auto &grids = pmbp->pz4c->spherical_grids;
+  bool everywhere = pmbp->pz4c->opt.weyl_everywhere;
+  if (weyl_mask.extent_int(0) != nmb) {
+    Kokkos::realloc(weyl_mask, nmb);
+  }
+  for (int m=0; m<nmb; ++m) {
+    bool need = everywhere;
+    if (!need) {
+      Real pad1 = indcs.ng*size.h_view(m).dx1;
+      Real pad2 = indcs.ng*size.h_view(m).dx2;
+      Real pad3 = indcs.ng*size.h_view(m).dx3;
+      Real x1min = size.h_view(m).x1min - pad1; Real x1max = size.h_view(m).x1max + pad1;
+      Real x2min = size.h_view(m).x2min - pad2; Real x2max = size.h_view(m).x2max + pad2;
+      Real x3min = size.h_view(m).x3min - pad3; Real x3max = size.h_view(m).x3max + pad3;
+      // nearest and farthest distance of the padded block from the origin
+      Real n1 = fmax(fmax(x1min, -x1max), 0.0);
+      Real n2 = fmax(fmax(x2min, -x2max), 0.0);
+      Real n3 = fmax(fmax(x3min, -x3max), 0.0);
+      Real dmin = std::sqrt(SQR(n1) + SQR(n2) + SQR(n3));
+      Real f1 = fmax(fabs(x1min), fabs(x1max));
+      Real f2 = fmax(fabs(x2min), fabs(x2max));
+      Real f3 = fmax(fabs(x3min), fabs(x3max));
+      Real dmax = std::sqrt(SQR(f1) + SQR(f2) + SQR(f3));
+      for (auto &g : grids) {
+        if (g->radius >= dmin && g->radius <= dmax) {
+          need = true;
+          break;
+        }
+      }
+    }
+    weyl_mask.h_view(m) = need;
+  }
+  weyl_mask.template modify<HostMemSpace>();
+  weyl_mask.template sync<DevExeSpace>();
+
   par_for("z4c_weyl_scalar",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    // block does not touch any extraction sphere: nothing to compute
+    if (!weyl_mask.d_view(m)) {
+      return;
+    }
     // Simplify constants (2 & sqrt 2 factors) featured in re/im[psi4]
     const Real FR4 = 0.25;
     Real &x1min = size.d_view(m).x1min;
@@ -28,29 +28,19 @@ TaskStatus Z4c::NewTimeStep(Driver *pdriver, int stage) {
     return TaskStatus::complete; // only execute last stage
   }
 
-  auto &indcs = pmy_pack->pmesh->mb_indcs;
-  int nx1 = indcs.nx1;
-  int nx2 = indcs.nx2;
-  int nx3 = indcs.nx3;
-
   Real dt1 = std::numeric_limits<float>::max();
   Real dt2 = std::numeric_limits<float>::max();
   Real dt3 = std::numeric_limits<float>::max();
 
-  // capture class variables for kernel
+  // characteristic speeds in Z4c are of order the speed of light, so the minimum dt
+  // depends only on the grid spacing of each MeshBlock; reduce over blocks on the host
+  // instead of launching a full-grid reduction kernel
   auto &mbsize = pmy_pack->pmb->mb_size;
-  const int nmkji = (pmy_pack->nmb_thispack)*nx3*nx2*nx1;
-  const int nkji = nx3*nx2*nx1;
-
-  Kokkos::parallel_reduce("Z4c dt",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
-    // compute m,k,j,i indices of thread and call function
-    int m = (idx)/nkji;
-
-    min_dt1 = fmin((mbsize.d_view(m).dx1), min_dt1);
-    min_dt2 = fmin((mbsize.d_view(m).dx2), min_dt2);
-    min_dt3 = fmin((mbsize.d_view(m).dx3), min_dt3);
-  }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3));
+  for (int m=0; m<(pmy_pack->nmb_thispack); ++m) {
+    dt1 = std::min(dt1, mbsize.h_view(m).dx1);
+    dt2 = std::min(dt2, mbsize.h_view(m).dx2);
+    dt3 = std::min(dt3, mbsize.h_view(m).dx3);
+  }
 
   // compute minimum of dt1/dt2/dt3 for 1D/2D/3D problems
   dtnew = dt1;
@@ -40,18 +40,19 @@ void Z4c::QueueZ4cTasks() {
 
   // Run task list
   pnr->QueueTask(&Z4c::CopyU, this, Z4c_CopyU, "Z4c_CopyU", Task_Run);
+  // MHD_Flux also assembles Tmunu (fused into the flux sweep), so the RHS waits on it
   switch (indcs.ng) {
     case 2:
       pnr->QueueTask(&Z4c::CalcRHS<2>, this, Z4c_CalcRHS, "Z4c_CalcRHS",
-                     Task_Run, {Z4c_CopyU}, {MHD_SetTmunu});
+                     Task_Run, {Z4c_CopyU}, {MHD_Flux});
       break;
     case 3:
       pnr->QueueTask(&Z4c::CalcRHS<3>, this, Z4c_CalcRHS, "Z4c_CalcRHS",
-                     Task_Run, {Z4c_CopyU}, {MHD_SetTmunu});
+                     Task_Run, {Z4c_CopyU}, {MHD_Flux});
       break;
     case 4:
       pnr->QueueTask(&Z4c::CalcRHS<4>, this, Z4c_CalcRHS, "Z4c_CalcRHS",
-                     Task_Run, {Z4c_CopyU}, {MHD_SetTmunu});
+                     Task_Run, {Z4c_CopyU}, {MHD_Flux});
       break;
   }
   pnr->QueueTask(&Z4c::Z4cBoundaryRHS, this, Z4c_SomBC, "Z4c_SomBC", Task_Run,
@@ -135,6 +136,12 @@ TaskStatus Z4c::ClearSend(Driver *pdrive, int stage) {
 TaskStatus Z4c::CopyU(Driver *pdrive, int stage) {
   auto integrator = pdrive->integrator;
 
+  // 2N integrators accumulate the increment in u1 and annihilate its stale contents
+  // through the zero stage-one weight, so no state copy is needed
+  if (pdrive->low_storage) {
+    return TaskStatus::complete;
+  }
+
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int is = indcs.is, ie = indcs.ie;
   int js = indcs.js, je = indcs.je;
@@ -223,13 +230,25 @@ TaskStatus Z4c::UpdateExcisionMasks(Driver *pdrive, int stage) {
 TaskStatus Z4c::ADMConstraints_(Driver *pdrive, int stage) {
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   if (stage == pdrive->nexp_stages) {
-    switch (indcs.ng) {
-      case 2: ADMConstraints<2>(pmy_pack);
-              break;
-      case 3: ADMConstraints<3>(pmy_pack);
-              break;
-      case 4: ADMConstraints<4>(pmy_pack);
-              break;
+    if (opt.con_norm_stride > 1) {
+      // sampled monitoring: only accumulate norms over a decimated cell subset
+      switch (indcs.ng) {
+        case 2: ADMConstraintsNorms<2>(pmy_pack);
+                break;
+        case 3: ADMConstraintsNorms<3>(pmy_pack);
+                break;
+        case 4: ADMConstraintsNorms<4>(pmy_pack);
+                break;
+      }
+    } else {
+      switch (indcs.ng) {
+        case 2: ADMConstraints<2>(pmy_pack);
+                break;
+        case 3: ADMConstraints<3>(pmy_pack);
+                break;
+        case 4: ADMConstraints<4>(pmy_pack);
+                break;
+      }
     }
   }
   return TaskStatus::complete;
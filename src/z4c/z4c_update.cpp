@@ -6,7 +6,8 @@
 //! \file z4c_update.cpp
 //! \brief Performs update of z4c variables (u0) for each stage of explicit
 //  SSP RK integrators (e.g. RK1, RK2, RK3, RK4). Update uses weighted average
-//  and partial time step appropriate to stage.
+//  and partial time step appropriate to stage.  Also implements the 2N-storage
+//  (Williamson) form, in which u1 accumulates the running increment.
 
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
@@ -34,6 +35,22 @@ TaskStatus Z4c::ExpRKUpdate(Driver *pdriver, int stage) {
   int nmb1 = pmy_pack->nmb_thispack - 1;
   int nvar = nz4c;
 
+  // 2N (Williamson) integrators: u1 accumulates the running increment dU instead of
+  // holding a copy of U^n, so no stage-one state copy is required
+  if (pdriver->low_storage) {
+    Real &a2n = pdriver->a2n[stage-1];
+    Real &b2n = pdriver->b2n[stage-1];
+    Real dt = pmy_pack->pmesh->dt;
+    par_for("z4c 2N RK update",DevExeSpace(),
+        0,nmb1,0,nvar-1,ks,ke,js,je,is,ie,
+    KOKKOS_LAMBDA(const int m, const int n, const int k, const int j, const int i) {
+      Real du = a2n*u1(m,n,k,j,i) + dt*u_rhs(m,n,k,j,i);
+      u1(m,n,k,j,i) = du;
+      u0(m,n,k,j,i) += b2n*du;
+    });
+    return TaskStatus::complete;
+  }
+
   par_for("z4c RK update",DevExeSpace(),
       0,nmb1,0,nvar-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int n, const int k, const int j, const int i) {
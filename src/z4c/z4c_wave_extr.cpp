@@ -17,6 +17,9 @@
 #include <fstream>
 #include <algorithm>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #ifdef MPI_PARALLEL
 #include <mpi.h>
@@ -60,16 +63,34 @@ void swsh(Real * ylmR, Real * ylmI, int l, int m, Real theta, Real phi) {
 int LmIndex(int l,int m) {
     return l*l+m+l-4;
 }
+
+// host-side snapshot of one extraction sphere consumed by the waveform worker thread
+namespace {
+struct SphereData {
+  Real radius;
+  int nangles;
+  std::vector<Real> theta, phi, weight, rpsi4, ipsi4;
+};
+} // namespace
+
+//----------------------------------------------------------------------------------------
+// \!fn void Z4c::FinishWaveWorker()
+// \brief join the waveform worker thread if a previous extraction is still in flight
+void Z4c::FinishWaveWorker() {
+  if (wave_worker_.joinable()) {wave_worker_.join();}
+}
+
 //----------------------------------------------------------------------------------------
-// \!fn void Z4c::Z4cWeyl(MeshBlockPack *pmbp)
-// \brief compute the weyl scalars given the adm variables and matter state
+// \!fn void Z4c::WaveExtr(MeshBlockPack *pmbp)
+// \brief decompose the weyl scalars on the extraction spheres and write the waveforms
 //
-// This function operates only on the interior points of the MeshBlock
+// Only the sphere interpolation runs synchronously; the spherical harmonic
+// decomposition, the reduction across ranks, and the file appends are handed to a
+// background thread so the evolution never waits on diagnostics.
 void Z4c::WaveExtr(MeshBlockPack *pmbp) {
   // Spherical Grid for user-defined history
   auto &grids = pmbp->pz4c->spherical_grids;
   auto &u_weyl = pmbp->pz4c->u_weyl;
-  auto &psi_out = pmbp->pz4c->psi_out;
 
   // number of radii
   int nradii = grids.size();
@@ -78,22 +99,47 @@ void Z4c::WaveExtr(MeshBlockPack *pmbp) {
   int lmax = 8;
   // bool bitant = false;
 
+  // Interpolate the Weyl scalars to the surfaces and snapshot the host-side results,
+  // together with the angular quadrature, into plain buffers owned by the worker
+  // thread. The worker must not touch the grids: they are rebuilt on regrid.
+  std::vector<SphereData> spheres(nradii);
+  for (int g=0; g<nradii; ++g) {
+    grids[g]->InterpolateToSphere(2, u_weyl);
+    SphereData &s = spheres[g];
+    s.radius = grids[g]->radius;
+    s.nangles = grids[g]->nangles;
+    s.theta.resize(s.nangles);
+    s.phi.resize(s.nangles);
+    s.weight.resize(s.nangles);
+    s.rpsi4.resize(s.nangles);
+    s.ipsi4.resize(s.nangles);
+    for (int ip = 0; ip < s.nangles; ++ip) {
+      s.theta[ip] = grids[g]->polar_pos.h_view(ip,0);
+      s.phi[ip] = grids[g]->polar_pos.h_view(ip,1);
+      s.weight[ip] = grids[g]->solid_angles.h_view(ip);
+      s.rpsi4[ip] = grids[g]->interp_vals.h_view(ip,0);
+      s.ipsi4[ip] = grids[g]->interp_vals.h_view(ip,1);
+    }
+  }
+
+  Real time = pmbp->pmesh->time;
+
+  // at most one extraction is in flight: drain a previous one before relaunching
+  FinishWaveWorker();
+  wave_worker_ = std::thread(
+      [spheres = std::move(spheres), time, lmax, nradii, this]() {
   Real ylmR,ylmI;
   int count = 0;
+  // number of (l,m) modes per radius: sum_{l=2}^{lmax} (2l+1) = (lmax+3)*(lmax-1)
+  std::vector<Real> psi_out(static_cast<size_t>(nradii)*(lmax+3)*(lmax-1)*2);
   for (int g=0; g<nradii; ++g) {
-    // Interpolate Weyl scalars to the surface
-    grids[g]->InterpolateToSphere(2, u_weyl);
+    const SphereData &s = spheres[g];
     for (int l = 2; l < lmax+1; ++l) {
       for (int m = -l; m < l+1 ; ++m) {
         Real psilmR = 0.0;
         Real psilmI = 0.0;
-          for (int ip = 0; ip < grids[g]->nangles; ++ip) {
-            Real theta = grids[g]->polar_pos.h_view(ip,0);
-            Real phi = grids[g]->polar_pos.h_view(ip,1);
-            Real datareal = grids[g]->interp_vals.h_view(ip,0);
-            Real dataim = grids[g]->interp_vals.h_view(ip,1);
-            Real weight = grids[g]->solid_angles.h_view(ip);
-            swsh(&ylmR,&ylmI,l,m,theta,phi);
+          for (int ip = 0; ip < s.nangles; ++ip) {
+            swsh(&ylmR,&ylmI,l,m,s.theta[ip],s.phi[ip]);
             // The spherical harmonics transform as
             // Y^s_{l m}( Pi-th, ph ) = (-1)^{l+s} Y^s_{l -m}(th, ph)
             // but the PoisitionPolar function returns theta \in [0,\pi],
@@ -102,8 +148,8 @@ void Z4c::WaveExtr(MeshBlockPack *pmbp) {
             // the weyl scalar should pick a - sign,
             // which is accounted for here.
             // Real bitant_z_fac = (bitant && theta > M_PI/2) ? -1 : 1;
-            psilmR += weight*(datareal*ylmR + dataim*ylmI);
-            psilmI += weight*(dataim*ylmR - datareal*ylmI);
+            psilmR += s.weight[ip]*(s.rpsi4[ip]*ylmR + s.ipsi4[ip]*ylmI);
+            psilmI += s.weight[ip]*(s.ipsi4[ip]*ylmR - s.rpsi4[ip]*ylmI);
           }
         psi_out[count++] = psilmR;
         psi_out[count++] = psilmI;
@@ -113,10 +159,14 @@ void Z4c::WaveExtr(MeshBlockPack *pmbp) {
 
   // write output
   #if MPI_PARALLEL_ENABLED
+  // reduced on the dedicated waveform communicator so this thread can never
+  // interleave with evolution messages
   if (0 == global_variable::my_rank) {
-    MPI_Reduce(MPI_IN_PLACE, psi_out, count, MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(MPI_IN_PLACE, psi_out.data(), count, MPI_ATHENA_REAL, MPI_SUM, 0,
+               wave_comm_);
   } else {
-    MPI_Reduce(psi_out, psi_out, count, MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(psi_out.data(), psi_out.data(), count, MPI_ATHENA_REAL, MPI_SUM, 0,
+               wave_comm_);
   }
   #endif
 
@@ -127,7 +177,7 @@ void Z4c::WaveExtr(MeshBlockPack *pmbp) {
       std::string filename = "waveforms/rpsi4_real_";
       std::string filename2 = "waveforms/rpsi4_imag_";
       std::stringstream strObj;
-      strObj << std::setfill('0') << std::setw(4) << grids[g]->radius;
+      strObj << std::setfill('0') << std::setw(4) << spheres[g].radius;
       filename += strObj.str();
       filename += ".txt";
       filename2 += strObj.str();
@@ -198,8 +248,8 @@ void Z4c::WaveExtr(MeshBlockPack *pmbp) {
       outFile2.open(filename2, std::ios::out | std::ios::app);
 
       // first append time
-      outFile << pmbp->pmesh->time << "\t";
-      outFile2 << pmbp->pmesh->time << "\t";
+      outFile << time << "\t";
+      outFile2 << time << "\t";
 
       // append waveform
       for (int l = 2; l < lmax+1; ++l) {
@@ -216,6 +266,7 @@ void Z4c::WaveExtr(MeshBlockPack *pmbp) {
       outFile2.close();
     }
   }
+  });
 }
 
 
@@ -0,0 +1,136 @@
+#!/usr/bin/env python
+
+# Microbenchmark sweep over (Riemann solver, reconstruction) combinations.
+
+# Usage: From this directory, after building the code the same way the
+#        regression tests do (executable at build/src/athena), call:
+#        python run_benchmarks.py
+#
+#        Useful options:
+#        python run_benchmarks.py --suite hydro --blocks 16,32 --nlim 40
+#        python run_benchmarks.py --exe /path/to/athena
+
+# Notes:
+#   - Requires Python 3+.
+#   - Each combination evolves the 3D linear wave problem for a fixed number
+#     of cycles on synthetic (smooth) data, so runtimes are dominated by the
+#     flux/reconstruction kernels being compared and no combination is
+#     penalized by shocks or floors.
+#   - zone-cycles/cpu_second is parsed from the performance summary printed
+#     by the Driver at the end of every run.
+#   - The reported bandwidth is an *effective* figure: zone-cycles/sec times
+#     a minimal-traffic model of bytes moved per zone-cycle (per stage: the
+#     flux kernels read nvar primitives and write 3*nvar fluxes; the update
+#     reads 3*nvar fluxes plus u0 and u1 and writes u0; c2p reads u0 and
+#     writes w0 -- 12*nvar Reals in total).  It is a lower bound on actual
+#     traffic (ghost zones, face fields, and EMFs are not counted) and is
+#     meant for spotting regressions between combinations, not for roofline
+#     comparisons.
+
+# Modules
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+# Prevent generation of .pyc files
+sys.dont_write_bytecode = True
+
+# (rsolver, reconstruction) matrix swept for each suite.  Every entry here is
+# a runtime option of a single build, so no recompilation happens during the
+# sweep.  SR/GR solver variants need different problem setups and are not
+# included.
+_recon = ['dc', 'plm', 'ppm4', 'ppmx', 'wenoz']
+_hydro_flux = ['llf', 'hlle', 'hllc', 'roe']
+_mhd_flux = ['llf', 'hlle', 'hlld', 'hlld_lowreg', 'hlld_hybrid', 'roe']
+# suite -> (input file, input block name, rsolver list, nvar, num outputs)
+_suites = {
+    'hydro': ('tests/linear_wave_hydro.athinput', 'hydro', _hydro_flux, 5, 3),
+    'mhd': ('tests/linear_wave_mhd.athinput', 'mhd', _mhd_flux, 8, 5),
+}
+# number of RK stages of the integrator used below, for the bandwidth model
+_integrator = 'rk2'
+_nstages = 2
+
+
+# Run one (rsolver, reconstruction, block size) combination and return
+# zone-cycles/cpu_second parsed from the performance summary
+def run_one(exe, suite, flux, recon, block, nlim):
+    input_rel, block_name, _, _, nout = _suites[suite]
+    arguments = [exe, '-i', '../inputs/' + input_rel, '-d', 'bench_tmp',
+                 'job/basename=bench',
+                 'time/nlim=' + repr(nlim),
+                 'time/integrator=' + _integrator,
+                 'mesh/nghost=3',
+                 'meshblock/nx1=' + repr(block),
+                 'meshblock/nx2=' + repr(block),
+                 'meshblock/nx3=' + repr(block),
+                 block_name + '/reconstruct=' + recon,
+                 block_name + '/rsolver=' + flux,
+                 'problem/amp=1.0e-6']
+    # disable all file outputs; only the performance summary is wanted
+    for n in range(1, nout + 1):
+        arguments.append('output{0}/dt=-1.0'.format(n))
+    result = subprocess.run(arguments, cwd='.', capture_output=True,
+                            text=True)
+    if result.returncode != 0:
+        print(result.stdout)
+        print(result.stderr, file=sys.stderr)
+        raise RuntimeError('{0} {1}+{2} nxb={3} exited with code {4}'.format(
+            suite, flux, recon, block, result.returncode))
+    match = re.search(r'zone-cycles/cpu_second\s*=\s*(\S+)', result.stdout)
+    if match is None:
+        raise RuntimeError('no performance summary in output of {0} {1}+{2}'
+                           .format(suite, flux, recon))
+    return float(match.group(1))
+
+
+# Main function
+def main(**kwargs):
+    exe = os.path.abspath(kwargs.pop('exe'))
+    if not os.path.isfile(exe):
+        raise SystemExit('executable not found: {0} (build first, or pass '
+                         '--exe)'.format(exe))
+    blocks = [int(b) for b in kwargs.pop('blocks').split(',')]
+    nlim = kwargs.pop('nlim')
+    suites = [kwargs.pop('suite')]
+    if suites == ['all']:
+        suites = list(_suites.keys())
+
+    header = '{0:6s} {1:12s} {2:6s} {3:>4s} {4:>16s} {5:>12s}'.format(
+        'suite', 'rsolver', 'recon', 'nxb', 'zone-cycles/sec', 'eff. GB/s')
+    for suite in suites:
+        _, _, flux_list, nvar, _ = _suites[suite]
+        bytes_per_zc = 12.0 * nvar * 8.0 * _nstages
+        print(header)
+        for flux in flux_list:
+            for recon in _recon:
+                for block in blocks:
+                    zcps = run_one(exe, suite, flux, recon, block, nlim)
+                    gbps = zcps * bytes_per_zc / 1.0e9
+                    print('{0:6s} {1:12s} {2:6s} {3:4d} {4:16.4g} '
+                          '{5:12.4g}'.format(suite, flux, recon, block,
+                                             zcps, gbps))
+        print('')
+
+
+# Execute main function
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--suite',
+                        default='all',
+                        choices=['all'] + list(_suites.keys()),
+                        help='benchmark suite(s) to sweep')
+    parser.add_argument('--exe',
+                        default='build/src/athena',
+                        help='path to athena executable')
+    parser.add_argument('--blocks',
+                        default='16,32',
+                        help='comma-separated MeshBlock sizes (cubed)')
+    parser.add_argument('--nlim',
+                        type=int,
+                        default=20,
+                        help='number of cycles to evolve each combination')
+    args = parser.parse_args()
+    main(**vars(args))
@@ -0,0 +1,206 @@
+#!/usr/bin/env python
+
+# Nightly benchmark matrix with a machine-readable report.
+
+# Usage: From this directory, after building the code the same way the
+#        regression tests do (executable at build/src/athena):
+#
+#        python run_nightly.py                    # full matrix, 60 s per case
+#        or, from the build directory: make benchmarks
+#
+#        Useful options:
+#        python run_nightly.py --cases hydro_turb,mhd_blast_amr
+#        python run_nightly.py --wallclock 300 --out nightly.json
+#        python run_nightly.py --launcher 'mpirun -n {ranks}' --ranks 4
+#        python run_nightly.py --exe /path/to/athena
+
+# Notes:
+#   - Requires Python 3+.
+#   - The matrix covers one canonical configuration per major physics path:
+#     driven hydro turbulence, an MHD blast with AMR, a z4c single puncture,
+#     and a radiation linear wave.  Each case runs for a fixed wallclock
+#     (the executable's -t limit) rather than a fixed cycle count, so the
+#     report is comparable across machines of very different speed.
+#   - Every run sets <time>/task_timing=true, and the report collects from
+#     the printed diagnostics: zone-cycles/cpu_second, the per-task execution
+#     times, and the communication fraction (tasks named Send/Recv/Clear plus
+#     all polling time, over the total task time).  The memory high-water is
+#     ru_maxrss of the launched process tree, from wait4().
+#   - One JSON report is written per invocation, stamped with the date, host,
+#     and git commit, so nightly runs can be archived and diffed across
+#     commits and machines.  No baseline is kept here; for pass/fail gating
+#     against a recorded baseline use run_perf_regression.py instead.
+#   - The cases only use problem generators compiled into the default build
+#     (no -D PROBLEM=... builds needed).
+
+# Modules
+import argparse
+import datetime
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+import tempfile
+
+# Prevent generation of .pyc files
+sys.dont_write_bytecode = True
+
+# case -> input file relative to inputs/
+_cases = {
+    'hydro_turb':    'hydro/turb.athinput',
+    'mhd_blast_amr': 'mhd/blast_mhd_amr.athinput',
+    'z4c_puncture':  'z4c/onepuncture/z4c_onepuncture.athinput',
+    'rad_linwave':   'tests/rad_linwave.athinput',
+}
+
+
+# Count <outputN> blocks in the input file so every file output can be disabled
+def count_output_blocks(input_file):
+    nout = 0
+    with open(input_file, 'r') as f:
+        for line in f:
+            if re.match(r'\s*<output(\d+)>', line):
+                nout += 1
+    return nout
+
+
+# Run one case for a fixed wallclock and return the parsed metrics
+def run_one(exe, case, launcher, ranks, wallclock):
+    input_file = '../inputs/' + _cases[case]
+    arguments = []
+    if launcher:
+        arguments += launcher.format(ranks=ranks).split()
+    arguments += [exe, '-i', input_file, '-d', 'nightly_tmp',
+                  '-t', '0:0:{0}'.format(wallclock),
+                  'job/basename=nightly',
+                  'time/nlim=-1',
+                  'time/tlim=1.0e10',
+                  'time/task_timing=true']
+    # disable all file outputs; only the printed diagnostics are wanted
+    for n in range(1, count_output_blocks(input_file) + 1):
+        arguments.append('output{0}/dt=-1.0'.format(n))
+    # run through Popen + wait4 (instead of subprocess.run) so the rusage of
+    # the process tree, and with it the memory high-water, is available
+    with tempfile.TemporaryFile(mode='w+') as f:
+        proc = subprocess.Popen(arguments, cwd='.', stdout=f,
+                                stderr=subprocess.STDOUT)
+        _, status, rusage = os.wait4(proc.pid, 0)
+        f.seek(0)
+        out = f.read()
+    returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) \
+        else -os.WTERMSIG(status)
+    if returncode != 0:
+        print(out)
+        raise RuntimeError('{0} exited with code {1}'.format(
+            case, returncode))
+
+    def grab(pattern):
+        match = re.search(pattern, out)
+        if match is None:
+            raise RuntimeError('missing diagnostic {0!r} for {1}'.format(
+                pattern, case))
+        return float(match.group(1))
+
+    ncycle = int(grab(r'cycle=(\d+)\s*\n\s*tlim='))
+    zcps = grab(r'zone-cycles/cpu_second\s*=\s*(\S+)')
+    # per-task breakdown and communication fraction from the task timing
+    # table: t_exec of tasks named Send/Recv/Clear plus all polling time,
+    # over the total task time
+    tasks = {}
+    t_comm, t_total = 0.0, 0.0
+    for row in re.finditer(r'^(\S+/\S+)\s+(\S+)\s+(\S+)\s+\d+\s+\d+\s*$',
+                           out, re.MULTILINE):
+        texec, tpoll = float(row.group(2)), float(row.group(3))
+        tasks[row.group(1)] = texec
+        t_total += texec + tpoll
+        t_comm += tpoll
+        if re.search(r'Send|Recv|Clear', row.group(1)):
+            t_comm += texec
+    return {'input': _cases[case],
+            'ncycle': ncycle,
+            'zone_cycles_per_sec': zcps,
+            'comm_fraction': (t_comm / t_total) if t_total > 0.0 else 0.0,
+            'max_rss_mb': rusage.ru_maxrss / 1024.0,
+            'task_exec_sec': tasks}
+
+
+# Return the current commit hash, or None when not run from a git checkout
+def git_commit():
+    try:
+        result = subprocess.run(['git', 'rev-parse', 'HEAD'],
+                                capture_output=True, text=True)
+    except OSError:
+        return None
+    if result.returncode != 0:
+        return None
+    return result.stdout.strip()
+
+
+# Main function
+def main(**kwargs):
+    exe = os.path.abspath(kwargs.pop('exe'))
+    if not os.path.isfile(exe):
+        raise SystemExit('executable not found: {0} (build first, or pass '
+                         '--exe)'.format(exe))
+    cases = kwargs.pop('cases').split(',')
+    if cases == ['all']:
+        cases = list(_cases.keys())
+    for case in cases:
+        if case not in _cases:
+            raise SystemExit('unknown case: ' + case)
+    launcher = kwargs.pop('launcher')
+    ranks = kwargs.pop('ranks')
+    if (ranks != 1) and not launcher:
+        raise SystemExit('--launcher is required to run on more than 1 rank')
+    wallclock = kwargs.pop('wallclock')
+
+    results = {}
+    for case in cases:
+        res = run_one(exe, case, launcher, ranks, wallclock)
+        results[case] = res
+        print('{0:14s} {1:12.4g} zc/s  cycles={2:6d}  comm={3:5.1%}  '
+              'rss={4:8.1f} MB'.format(case, res['zone_cycles_per_sec'],
+                                       res['ncycle'], res['comm_fraction'],
+                                       res['max_rss_mb']))
+
+    report = {'date': datetime.datetime.now().isoformat(timespec='seconds'),
+              'host': platform.node(),
+              'commit': git_commit(),
+              'ranks': ranks,
+              'wallclock_sec': wallclock,
+              'cases': results}
+    out_file = kwargs.pop('out')
+    with open(out_file, 'w') as f:
+        json.dump(report, f, indent=2)
+        f.write('\n')
+    print('nightly report written to ' + out_file)
+
+
+# Execute main function
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--cases',
+                        default='all',
+                        help='comma-separated list of cases (default all)')
+    parser.add_argument('--exe',
+                        default='build/src/athena',
+                        help='path to athena executable')
+    parser.add_argument('--launcher',
+                        default='',
+                        help="launcher template, e.g. 'mpirun -n {ranks}' "
+                             "or 'srun -n {ranks}'")
+    parser.add_argument('--ranks',
+                        type=int,
+                        default=1,
+                        help='number of MPI ranks (needs --launcher if > 1)')
+    parser.add_argument('--wallclock',
+                        type=int,
+                        default=60,
+                        help='wallclock seconds per case')
+    parser.add_argument('--out',
+                        default='nightly_report.json',
+                        help='output JSON report file')
+    args = parser.parse_args()
+    main(**vars(args))
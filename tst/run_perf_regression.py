@@ -0,0 +1,197 @@
+#!/usr/bin/env python
+
+# Performance regression suite with recorded baselines.
+
+# Usage: From this directory, after building the code the same way the
+#        regression tests do (executable at build/src/athena):
+#
+#        python run_perf_regression.py --record   # record a baseline
+#        python run_perf_regression.py            # compare to the baseline
+#
+#        Useful options:
+#        python run_perf_regression.py --cases shock_tube,mhd_cpaw3d
+#        python run_perf_regression.py --tolerance 10 --repeat 5
+#        python run_perf_regression.py --exe /path/to/athena
+
+# Notes:
+#   - Requires Python 3+.
+#   - Each case runs a short canonical problem for a fixed number of cycles
+#     with <time>/task_timing=true.  zone-cycles/cpu_second is parsed from the
+#     performance summary and the per-task execution times from the task
+#     timing table, so a regression report names the kernel group (task) that
+#     slowed down, not just the total.
+#   - Baselines are machine- and configuration-specific, so none is shipped:
+#     record one per machine with --record (written to perf_baseline.json by
+#     default, or pass --baseline) and keep it next to the build it guards.
+#   - Comparison uses the best of --repeat runs of each case to suppress
+#     system noise; the suite fails (exit code 1) if any case is more than
+#     --tolerance percent slower than its baseline.
+#   - The cases only use problem generators compiled into the default build
+#     (no -D PROBLEM=... builds needed).
+
+# Modules
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+# Prevent generation of .pyc files
+sys.dont_write_bytecode = True
+
+# case -> (input file relative to inputs/, number of output blocks, cycles).
+# Cycle counts are chosen so every case runs for O(seconds) on one device;
+# they are recorded in the baseline so stale baselines are detected
+_cases = {
+    'shock_tube':  ('hydro/sod.athinput', 2, 100),
+    'mhd_cpaw3d':  ('tests/cpaw3d.athinput', 3, 10),
+    'z4c_wave3d':  ('tests/linear_wave_z4c.athinput', 3, 10),
+    'rad_linwave': ('tests/rad_linwave.athinput', 2, 100),
+}
+
+
+# Run one case and return (zone-cycles/sec, {task name: exec seconds})
+def run_one(exe, case):
+    input_rel, nout, nlim = _cases[case]
+    arguments = [exe, '-i', '../inputs/' + input_rel, '-d', 'perf_tmp',
+                 'job/basename=perf',
+                 'time/nlim=' + repr(nlim),
+                 'time/task_timing=true']
+    # disable all file outputs; only the printed diagnostics are wanted
+    for n in range(1, nout + 1):
+        arguments.append('output{0}/dt=-1.0'.format(n))
+    result = subprocess.run(arguments, cwd='.', capture_output=True,
+                            text=True)
+    if result.returncode != 0:
+        print(result.stdout)
+        print(result.stderr, file=sys.stderr)
+        raise RuntimeError('{0} exited with code {1}'.format(
+            case, result.returncode))
+    match = re.search(r'zone-cycles/cpu_second\s*=\s*(\S+)', result.stdout)
+    if match is None:
+        raise RuntimeError('no performance summary in output of ' + case)
+    zcps = float(match.group(1))
+    # rows of the task timing table: name, t_exec, t_poll, ncalls, npolls
+    tasks = {}
+    for row in re.finditer(r'^(\S+/\S+)\s+(\S+)\s+\S+\s+\d+\s+\d+\s*$',
+                           result.stdout, re.MULTILINE):
+        tasks[row.group(1)] = float(row.group(2))
+    return zcps, tasks
+
+
+# Run each requested case --repeat times, keeping the fastest run
+def measure(exe, cases, repeat):
+    results = {}
+    for case in cases:
+        best_zcps, best_tasks = 0.0, {}
+        for _ in range(repeat):
+            zcps, tasks = run_one(exe, case)
+            if zcps > best_zcps:
+                best_zcps, best_tasks = zcps, tasks
+        results[case] = {'nlim': _cases[case][2],
+                         'zone_cycles_per_sec': best_zcps,
+                         'task_exec_sec': best_tasks}
+    return results
+
+
+# Compare measured results against the baseline; return True on pass.
+# Prints a per-case summary, and for regressed cases a per-task diff report
+def compare(results, baseline, tolerance):
+    ok = True
+    for case, res in results.items():
+        if case not in baseline:
+            print('{0:12s} no baseline entry (record one with --record)'
+                  .format(case))
+            ok = False
+            continue
+        base = baseline[case]
+        if base['nlim'] != res['nlim']:
+            print('{0:12s} baseline was recorded with nlim={1}, now {2}; '
+                  're-record'.format(case, base['nlim'], res['nlim']))
+            ok = False
+            continue
+        ratio = res['zone_cycles_per_sec'] / base['zone_cycles_per_sec']
+        status = 'ok' if ratio >= 1.0 - 0.01*tolerance else 'REGRESSED'
+        print('{0:12s} {1:16.4g} zc/s  baseline {2:16.4g}  ({3:+6.1f}%) {4}'
+              .format(case, res['zone_cycles_per_sec'],
+                      base['zone_cycles_per_sec'], 100.0*(ratio - 1.0),
+                      status))
+        if status != 'REGRESSED':
+            continue
+        ok = False
+        # report which kernel groups slowed, sorted by absolute time lost
+        diffs = []
+        for name, t in res['task_exec_sec'].items():
+            t0 = base['task_exec_sec'].get(name, 0.0)
+            diffs.append((t - t0, name, t0, t))
+        diffs.sort(reverse=True)
+        for dt, name, t0, t in diffs[:10]:
+            print('    {0:44s} {1:10.3e} -> {2:10.3e} s ({3:+.3e})'
+                  .format(name, t0, t, dt))
+    return ok
+
+
+# Main function
+def main(**kwargs):
+    exe = os.path.abspath(kwargs.pop('exe'))
+    if not os.path.isfile(exe):
+        raise SystemExit('executable not found: {0} (build first, or pass '
+                         '--exe)'.format(exe))
+    baseline_file = kwargs.pop('baseline')
+    cases = kwargs.pop('cases').split(',')
+    if cases == ['all']:
+        cases = list(_cases.keys())
+    for case in cases:
+        if case not in _cases:
+            raise SystemExit('unknown case: ' + case)
+
+    results = measure(exe, cases, kwargs.pop('repeat'))
+
+    if kwargs.pop('record'):
+        # merge into any existing baseline so cases can be recorded separately
+        baseline = {}
+        if os.path.isfile(baseline_file):
+            with open(baseline_file, 'r') as f:
+                baseline = json.load(f)
+        baseline.update(results)
+        with open(baseline_file, 'w') as f:
+            json.dump(baseline, f, indent=2, sort_keys=True)
+            f.write('\n')
+        print('baseline written to ' + baseline_file)
+        return
+
+    if not os.path.isfile(baseline_file):
+        raise SystemExit('baseline not found: {0} (record one with --record)'
+                         .format(baseline_file))
+    with open(baseline_file, 'r') as f:
+        baseline = json.load(f)
+    if not compare(results, baseline, kwargs.pop('tolerance')):
+        raise SystemExit(1)
+
+
+# Execute main function
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--cases',
+                        default='all',
+                        help='comma-separated list of cases (default all)')
+    parser.add_argument('--exe',
+                        default='build/src/athena',
+                        help='path to athena executable')
+    parser.add_argument('--baseline',
+                        default='perf_baseline.json',
+                        help='baseline JSON file to record/compare')
+    parser.add_argument('--record',
+                        action='store_true',
+                        help='record results as the new baseline')
+    parser.add_argument('--tolerance',
+                        type=float,
+                        default=5.0,
+                        help='allowed slowdown in percent before failing')
+    parser.add_argument('--repeat',
+                        type=int,
+                        default=3,
+                        help='runs per case; the fastest is used')
+    args = parser.parse_args()
+    main(**vars(args))
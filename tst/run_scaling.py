@@ -0,0 +1,191 @@
+#!/usr/bin/env python
+
+# Scaling harness: runs one configured problem at several (rank count,
+# MeshBlockPack-per-rank) partitionings inside a single job allocation and
+# writes a machine-readable parallel-efficiency report.
+
+# Usage: From this directory, inside a job allocation:
+#
+#        python run_scaling.py --input ../inputs/mhd/orszag_tang.athinput \
+#            --launcher 'mpirun -n {ranks}' --ranks 1,2,4,8
+#
+#        Useful options:
+#        python run_scaling.py --input ... --packs 1,2,4 --nlim 50
+#        python run_scaling.py --input ... --out scaling.json
+#        python run_scaling.py --input ... --exe /path/to/athena
+
+# Notes:
+#   - Requires Python 3+.
+#   - Each partitioning re-runs the executable with runtime overrides only
+#     (mesh/nmb_packs_per_rank and the launcher's rank count), so one build
+#     and one allocation cover the whole sweep; no input files are edited.
+#   - Every run sets <time>/task_timing=true, and the report derives from
+#     the printed diagnostics: time per cycle from the performance summary,
+#     the communication fraction from the per-task timing table (tasks named
+#     Send/Recv/Clear plus all polling time), and load imbalance from the
+#     max/avg per-rank task time printed below that table.
+#   - Parallel efficiency is reported relative to the first rank count in
+#     the sweep; with --weak the mesh is expected to grow with ranks and
+#     efficiency is time-per-cycle based instead of rate based.
+
+# Modules
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+# Prevent generation of .pyc files
+sys.dont_write_bytecode = True
+
+
+# Count <outputN> blocks in the input file so every file output can be disabled
+def count_output_blocks(input_file):
+    nout = 0
+    with open(input_file, 'r') as f:
+        for line in f:
+            if re.match(r'\s*<output(\d+)>', line):
+                nout += 1
+    return nout
+
+
+# Run one partitioning and return the parsed metrics
+def run_one(exe, input_file, launcher, ranks, packs, nlim, nout):
+    arguments = []
+    if launcher:
+        arguments += launcher.format(ranks=ranks).split()
+    arguments += [exe, '-i', input_file, '-d', 'scale_tmp',
+                  'job/basename=scale',
+                  'time/nlim=' + repr(nlim),
+                  'time/task_timing=true',
+                  'mesh/nmb_packs_per_rank=' + repr(packs)]
+    # disable all file outputs; only the printed diagnostics are wanted
+    for n in range(1, nout + 1):
+        arguments.append('output{0}/dt=-1.0'.format(n))
+    result = subprocess.run(arguments, cwd='.', capture_output=True,
+                            text=True)
+    if result.returncode != 0:
+        print(result.stdout)
+        print(result.stderr, file=sys.stderr)
+        raise RuntimeError('ranks={0} packs={1} exited with code {2}'.format(
+            ranks, packs, result.returncode))
+    out = result.stdout
+
+    def grab(pattern):
+        match = re.search(pattern, out)
+        if match is None:
+            raise RuntimeError('missing diagnostic {0!r} for ranks={1} '
+                               'packs={2}'.format(pattern, ranks, packs))
+        return float(match.group(1))
+
+    ncycle = int(grab(r'cycle=(\d+)\s*\n\s*tlim='))
+    cpu_time = grab(r'cpu time used\s*=\s*(\S+)')
+    zcps = grab(r'zone-cycles/cpu_second\s*=\s*(\S+)')
+    imbalance = grab(r'task-time imbalance \(max/avg over ranks\)\s*=\s*(\S+)')
+    # communication fraction from the per-task timing table: t_exec of tasks
+    # named Send/Recv/Clear plus all polling time, over the total task time
+    t_comm, t_total = 0.0, 0.0
+    for row in re.finditer(r'^(\S+/\S+)\s+(\S+)\s+(\S+)\s+\d+\s+\d+\s*$',
+                           out, re.MULTILINE):
+        texec, tpoll = float(row.group(2)), float(row.group(3))
+        t_total += texec + tpoll
+        t_comm += tpoll
+        if re.search(r'Send|Recv|Clear', row.group(1)):
+            t_comm += texec
+    return {'ranks': ranks,
+            'packs': packs,
+            'ncycle': ncycle,
+            'time_per_cycle': cpu_time / max(ncycle, 1),
+            'zone_cycles_per_sec': zcps,
+            'comm_fraction': (t_comm / t_total) if t_total > 0.0 else 0.0,
+            'imbalance': imbalance}
+
+
+# Main function
+def main(**kwargs):
+    exe = os.path.abspath(kwargs.pop('exe'))
+    if not os.path.isfile(exe):
+        raise SystemExit('executable not found: {0} (build first, or pass '
+                         '--exe)'.format(exe))
+    input_file = os.path.abspath(kwargs.pop('input'))
+    if not os.path.isfile(input_file):
+        raise SystemExit('input file not found: ' + input_file)
+    launcher = kwargs.pop('launcher')
+    ranks_list = [int(r) for r in kwargs.pop('ranks').split(',')]
+    packs_list = [int(p) for p in kwargs.pop('packs').split(',')]
+    nlim = kwargs.pop('nlim')
+    weak = kwargs.pop('weak')
+    nout = count_output_blocks(input_file)
+    if (ranks_list != [1]) and not launcher:
+        raise SystemExit('--launcher is required to run on more than 1 rank')
+
+    runs = []
+    for ranks in ranks_list:
+        for packs in packs_list:
+            res = run_one(exe, input_file, launcher, ranks, packs, nlim,
+                          nout)
+            runs.append(res)
+            print('ranks={0:4d} packs={1:3d} t/cycle={2:10.4g}s '
+                  'comm={3:5.1%} imbalance={4:5.2f}'.format(
+                      ranks, packs, res['time_per_cycle'],
+                      res['comm_fraction'], res['imbalance']))
+
+    # parallel efficiency relative to the first rank count in the sweep (best
+    # pack count per rank count).  Strong scaling compares rates per rank;
+    # weak scaling (mesh grown with ranks) compares times per cycle directly
+    best = {}
+    for res in runs:
+        if (res['ranks'] not in best or
+                res['time_per_cycle'] < best[res['ranks']]['time_per_cycle']):
+            best[res['ranks']] = res
+    base = best[ranks_list[0]]
+    for res in runs:
+        if weak:
+            res['efficiency'] = base['time_per_cycle'] / res['time_per_cycle']
+        else:
+            res['efficiency'] = ((base['time_per_cycle'] * base['ranks']) /
+                                 (res['time_per_cycle'] * res['ranks']))
+
+    report = {'input': input_file,
+              'nlim': nlim,
+              'mode': 'weak' if weak else 'strong',
+              'runs': runs}
+    out_file = kwargs.pop('out')
+    with open(out_file, 'w') as f:
+        json.dump(report, f, indent=2)
+        f.write('\n')
+    print('scaling report written to ' + out_file)
+
+
+# Execute main function
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--input',
+                        required=True,
+                        help='athinput file defining the problem to scale')
+    parser.add_argument('--exe',
+                        default='build/src/athena',
+                        help='path to athena executable')
+    parser.add_argument('--launcher',
+                        default='',
+                        help="launcher template, e.g. 'mpirun -n {ranks}' "
+                             "or 'srun -n {ranks}'")
+    parser.add_argument('--ranks',
+                        default='1',
+                        help='comma-separated rank counts to sweep')
+    parser.add_argument('--packs',
+                        default='1',
+                        help='comma-separated MeshBlockPacks per rank')
+    parser.add_argument('--nlim',
+                        type=int,
+                        default=20,
+                        help='number of cycles per run')
+    parser.add_argument('--weak',
+                        action='store_true',
+                        help='weak-scaling efficiency (time-per-cycle based)')
+    parser.add_argument('--out',
+                        default='scaling.json',
+                        help='output JSON report file')
+    args = parser.parse_args()
+    main(**vars(args))
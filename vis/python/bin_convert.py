@@ -123,7 +123,7 @@ def read_binary(filename):
             + '(should be "Athena")'
         )
     version = code_header[-1].split(b"=")[-1]
-    if version != b"1.1":
+    if version not in (b"1.1", b"1.2"):
         raise TypeError(f"unsupported file format version {version.decode('utf-8')}")
 
     pheader_count = int(fp.readline().split(b"=")[-1])
@@ -135,6 +135,7 @@ def read_binary(filename):
     cycle = int(pheader["cycle"])
     locsizebytes = int(pheader["size of location"])
     varsizebytes = int(pheader["size of variable"])
+    compression = pheader.get("compression", "none")
 
     nvars = int(fp.readline().split(b"=")[-1])
     var_list = [v.decode("utf-8") for v in fp.readline().split()[1:]]
@@ -145,6 +146,34 @@ def read_binary(filename):
     ]
     header = [line for line in header if len(line) > 0]
 
+    # compressed files (version 1.2) carry an index table of per-block compressed frame
+    # sizes between the header and the data; each frame decompresses to one block record
+    if compression == "none":
+
+        def block_records():
+            while fp.tell() < filesize:
+                yield fp
+
+    elif compression == "zstd":
+        import io
+
+        try:
+            import zstandard
+        except ImportError:
+            raise ImportError(
+                "the zstandard package is required to read ZSTD-compressed bin files"
+            )
+        (n_blocks,) = struct.unpack("@Q", fp.read(8))
+        frame_sizes = struct.unpack(f"@{n_blocks}Q", fp.read(8 * n_blocks))
+        dctx = zstandard.ZstdDecompressor()
+
+        def block_records():
+            for fsize in frame_sizes:
+                yield io.BytesIO(dctx.decompress(fp.read(fsize)))
+
+    else:
+        raise ValueError(f"unsupported compression type {compression}")
+
     if locsizebytes not in [4, 8]:
         raise ValueError(f"unsupported location size (in bytes) {locsizebytes}")
     if varsizebytes not in [4, 8]:
@@ -199,21 +228,21 @@ def read_binary(filename):
     for var in var_list:
         mb_data[var] = []
 
-    while fp.tell() < filesize:
-        mb_index.append(np.array(struct.unpack("@6i", fp.read(24))) - nghost)
+    for rp in block_records():
+        mb_index.append(np.array(struct.unpack("@6i", rp.read(24))) - nghost)
         nx1_out = (mb_index[mb_count][1] - mb_index[mb_count][0]) + 1
         nx2_out = (mb_index[mb_count][3] - mb_index[mb_count][2]) + 1
         nx3_out = (mb_index[mb_count][5] - mb_index[mb_count][4]) + 1
 
-        mb_logical.append(np.array(struct.unpack("@4i", fp.read(16))))
+        mb_logical.append(np.array(struct.unpack("@4i", rp.read(16))))
         mb_geometry.append(
-            np.array(struct.unpack("=6" + locfmt, fp.read(6 * locsizebytes)))
+            np.array(struct.unpack("=6" + locfmt, rp.read(6 * locsizebytes)))
         )
 
         data = np.array(
             struct.unpack(
                 f"={nx1_out*nx2_out*nx3_out*n_vars}" + varfmt,
-                fp.read(varsizebytes * nx1_out * nx2_out * nx3_out * n_vars),
+                rp.read(varsizebytes * nx1_out * nx2_out * nx3_out * n_vars),
             )
         )
         data = data.reshape(nvars, nx3_out, nx2_out, nx1_out)
@@ -0,0 +1,73 @@
+#! /usr/bin/env python
+
+# Script for converting AthenaK binary history files (.bhst, written with
+# "binary = true" in an <output> block with file_type = hst) into the plain
+# text .hst format readable by athena_read.hst() and plot_hst.py.
+
+# A .bhst file starts with a short text header:
+#   # AthenaK binary history
+#   # realsize=<bytes per value> nvar=<values per record>
+#   #  [1]=time      [2]=dt       [3]=<label> ...
+#   # end_header
+# followed by fixed-width records of nvar native-endian floating point values
+# appended one per dump (restarted runs extend the stream without a new header).
+
+# Run "hst_convert.py -h" for help.
+
+# Python modules
+import argparse
+
+import numpy as np
+
+END_HEADER = b'# end_header\n'
+
+
+def read_bhst(filename):
+    """Read a .bhst file; returns (column labels, 2D array of records)."""
+    with open(filename, 'rb') as f:
+        raw = f.read()
+    end = raw.find(END_HEADER)
+    if end < 0 or not raw.startswith(b'# AthenaK binary history'):
+        raise RuntimeError('{0} is not an AthenaK binary history file'
+                           .format(filename))
+    header = raw[:end].decode('ascii').splitlines()
+    fields = dict(kv.split('=') for kv in header[1][1:].split())
+    realsize = int(fields['realsize'])
+    nvar = int(fields['nvar'])
+    labels = [token.split('=')[1] for token in header[2][1:].split()]
+
+    dtype = np.float64 if realsize == 8 else np.float32
+    payload = raw[end + len(END_HEADER):]
+    # drop a trailing partial record (possible if the run was killed mid-write)
+    nrec = len(payload) // (nvar * realsize)
+    data = np.frombuffer(payload[:nrec * nvar * realsize], dtype=dtype)
+    return labels, data.reshape(nrec, nvar)
+
+
+def main(**kwargs):
+    input_file = kwargs['input']
+    output_file = kwargs['output']
+    if output_file is None:
+        output_file = input_file.replace('.bhst', '.hst')
+
+    labels, data = read_bhst(input_file)
+
+    with open(output_file, 'w') as f:
+        f.write('# Athena++ history data\n')
+        f.write('# ' + ''.join(' [{0}]={1:<10.10}'.format(i + 1, lab)
+                               for i, lab in enumerate(labels)) + '\n')
+        for rec in data:
+            f.write(''.join(' {0:12.5e}'.format(val) for val in rec) + '\n')
+
+
+# Execute main function
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input',
+                        help='name of binary history (.bhst) file to convert')
+    parser.add_argument('-o', '--output',
+                        default=None,
+                        help='name of text file to write '
+                             '(default: input with .bhst replaced by .hst)')
+    args = parser.parse_args()
+    main(**vars(args))
@@ -0,0 +1,190 @@
+"""
+Reconstruct a self-contained restart (.rst) file from a full snapshot plus a
+chain of incremental delta checkpoints (.drst).
+
+Incremental checkpoints are enabled with "incremental = true" in a <output>
+block with file_type = rst.  In this mode the code periodically writes a full
+snapshot (every "dn_full"-th checkpoint) and, in between, delta files that
+contain only the MeshBlocks whose payload changed since the previous
+checkpoint, keyed by logical location.  A delta is therefore not directly
+restartable; this script rebuilds the equivalent full .rst file by walking the
+chain of files backwards to the most recent full snapshot and resolving each
+MeshBlock payload from the newest file that contains it.
+
+Example: to restart from checkpoint number 17, where number 10 was the last
+full snapshot:
+
+  python rst_merge.py rst/run.00017.drst
+  (writes rst/run.00017.rst from run.00010.rst + run.00011.drst ... .00017.drst)
+
+Delta file layout (native endianness throughout):
+  - input parameter dump, terminated by a line starting with "<par_end>"
+  - preamble of 8 int64: format version, sizeof(Real), sizeof(IOWrapperSizeT),
+    step3size, data_size, nmb_total, nchanged, previous file number
+  - standard restart header: nmb_total, root_level (int32 each), RegionSize
+    (12 Reals), 2 x RegionIndcs (20 int32 each), time, dt (Reals), ncycle
+    (int32), then logical locations (4 int32 each) and costs (float32) of all
+    MeshBlocks, internal state of physics objects (step3size bytes), and
+    data_size (IOWrapperSizeT)
+  - delta index: nchanged logical locations (4 int32 each), in gid order
+  - nchanged payload records of data_size bytes, in the same order
+
+A full .rst file has the same layout without the preamble, delta index, or
+payload filtering, which is what this script emits.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+# sizeof(RegionIndcs): 20 int32, no padding
+REGION_INDCS_SIZE = 80
+# sizeof(LogicalLocation): 4 int32
+LLOC_SIZE = 16
+
+
+def read_parameter_dump(fp):
+    """Reads the input parameter dump, returning it as bytes (including the
+    <par_end> line).  The file position is left at the first byte after it."""
+    dump = b""
+    while True:
+        line = fp.readline()
+        if len(line) == 0:
+            raise RuntimeError("<par_end> not found; not a restart file?")
+        dump += line
+        if line.startswith(b"<par_end>"):
+            return dump
+
+
+def read_delta(fname):
+    """Parses a .drst delta file, returning a dict with its raw header pieces,
+    preamble fields, delta index, and the offset of the first payload."""
+    fp = open(fname, "rb")
+    pardump = read_parameter_dump(fp)
+    pre = struct.unpack("@8q", fp.read(64))
+    (version, szreal, szsize, step3size, data_size, nmb_total, nchanged,
+     prev_fnum) = pre
+    if version != 1:
+        raise RuntimeError(f"unknown delta format version {version} in {fname}")
+    meshinfo_size = 2 * 4 + 12 * szreal + 2 * REGION_INDCS_SIZE + 2 * szreal + 4
+    meshinfo = fp.read(meshinfo_size)
+    llocs_raw = fp.read(nmb_total * LLOC_SIZE)
+    costs_raw = fp.read(nmb_total * 4)
+    step3_raw = fp.read(step3size)
+    dsz_raw = fp.read(szsize)
+    if int.from_bytes(dsz_raw, sys.byteorder) != data_size:
+        raise RuntimeError(f"inconsistent data_size in {fname}")
+    index = [struct.unpack("@4i", fp.read(LLOC_SIZE)) for _ in range(nchanged)]
+    return {
+        "fp": fp,
+        "pardump": pardump,
+        "szreal": szreal,
+        "szsize": szsize,
+        "step3size": step3size,
+        "data_size": data_size,
+        "nmb_total": nmb_total,
+        "prev_fnum": prev_fnum,
+        "meshinfo": meshinfo,
+        "llocs_raw": llocs_raw,
+        "costs_raw": costs_raw,
+        "step3_raw": step3_raw,
+        "dsz_raw": dsz_raw,
+        "index": index,
+        "payload_start": fp.tell(),
+    }
+
+
+def read_full(fname, szreal, szsize, step3size, data_size):
+    """Parses the header of a full .rst file (using struct sizes recorded in a
+    delta preamble), returning its lloc list and the first payload offset."""
+    fp = open(fname, "rb")
+    read_parameter_dump(fp)
+    (nmb_total,) = struct.unpack("@i", fp.read(4))
+    fp.seek(4 + 12 * szreal + 2 * REGION_INDCS_SIZE + 2 * szreal + 4, os.SEEK_CUR)
+    llocs = [struct.unpack("@4i", fp.read(LLOC_SIZE)) for _ in range(nmb_total)]
+    fp.seek(nmb_total * 4 + step3size, os.SEEK_CUR)
+    dsz_raw = fp.read(szsize)
+    if int.from_bytes(dsz_raw, sys.byteorder) != data_size:
+        raise RuntimeError(f"inconsistent data_size in {fname}")
+    return fp, llocs, fp.tell()
+
+
+def find_chain(last_fname):
+    """Walks checkpoint numbering backwards from a .drst file until a full
+    .rst file is found, returning (full_fname, [delta fnames oldest first])."""
+    m = re.match(r"^(.*\.)(\d{5})\.drst$", last_fname)
+    if m is None:
+        raise RuntimeError(f"'{last_fname}' is not named like a .drst file")
+    prefix, num = m.group(1), int(m.group(2))
+    deltas = [last_fname]
+    while num > 0:
+        num -= 1
+        full = f"{prefix}{num:05d}.rst"
+        if os.path.exists(full):
+            return full, deltas[::-1]
+        delta = f"{prefix}{num:05d}.drst"
+        if not os.path.exists(delta):
+            raise RuntimeError(f"chain broken: neither {full} nor {delta} exists")
+        deltas.append(delta)
+    raise RuntimeError(f"no full snapshot found below {last_fname}")
+
+
+def merge(last_fname, out_fname):
+    """Reconstructs a full restart file from the chain ending at last_fname."""
+    full_fname, delta_fnames = find_chain(last_fname)
+    deltas = [read_delta(f) for f in delta_fnames]
+    last = deltas[-1]
+    data_size = last["data_size"]
+    for d in deltas:
+        if d["data_size"] != data_size:
+            raise RuntimeError("data_size differs within chain; mixed configs?")
+    full_fp, full_llocs, full_start = read_full(
+        full_fname, last["szreal"], last["szsize"], last["step3size"], data_size)
+
+    # map each logical location to the newest file containing its payload
+    sources = {}
+    for i, lloc in enumerate(full_llocs):
+        sources[lloc] = (full_fp, full_start + i * data_size)
+    for d in deltas:
+        for i, lloc in enumerate(d["index"]):
+            sources[lloc] = (d["fp"], d["payload_start"] + i * data_size)
+
+    nmb_total = last["nmb_total"]
+    llocs = [struct.unpack("@4i", last["llocs_raw"][i*LLOC_SIZE:(i+1)*LLOC_SIZE])
+             for i in range(nmb_total)]
+    with open(out_fname, "wb") as out:
+        out.write(last["pardump"])
+        out.write(last["meshinfo"])
+        out.write(last["llocs_raw"])
+        out.write(last["costs_raw"])
+        out.write(last["step3_raw"])
+        out.write(last["dsz_raw"])
+        for lloc in llocs:
+            if lloc not in sources:
+                raise RuntimeError(f"no payload found for MeshBlock at {lloc}")
+            fp, offset = sources[lloc]
+            fp.seek(offset)
+            out.write(fp.read(data_size))
+    full_fp.close()
+    for d in deltas:
+        d["fp"].close()
+    print(f"wrote {out_fname} from {full_fname} + {len(deltas)} delta(s)")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="reconstruct a full .rst file from incremental checkpoints")
+    parser.add_argument("delta", help="last .drst file of the chain to merge")
+    parser.add_argument("-o", "--output",
+                        help="output file name (default: delta name with .rst)")
+    parser.add_argument("-f", "--force", action="store_true",
+                        help="overwrite the output file if it exists")
+    args = parser.parse_args()
+    out_fname = args.output
+    if out_fname is None:
+        out_fname = re.sub(r"\.drst$", ".rst", args.delta)
+    if os.path.exists(out_fname) and not args.force:
+        parser.error(f"{out_fname} exists; use --force to overwrite")
+    merge(args.delta, out_fname)